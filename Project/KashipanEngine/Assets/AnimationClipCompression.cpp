@@ -0,0 +1,375 @@
+#include "AnimationClipCompression.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace KashipanEngine {
+
+namespace {
+
+/// @brief smallest-three で省かない3成分が取り得る範囲（±1/√2）
+constexpr float kSmallestThreeRange = 0.70710678f;
+constexpr float kQuantize15Max = 32767.0f;
+constexpr float kQuantize16Max = 65535.0f;
+/// @brief カーソルから線形に進めるキー数の上限（超える場合は二分探索する）
+constexpr std::size_t kCursorLinearSteps = 4;
+/// @brief 許容誤差に収まらない場合に、キー削減の許容誤差を半分にして圧縮し直す回数（その次はキーを全て残す）
+constexpr std::uint32_t kMaxReductionRetries = 3;
+
+std::uint16_t QuantizeUnit16(float normalized) {
+    return static_cast<std::uint16_t>(std::lround(std::clamp(normalized, 0.0f, 1.0f) * kQuantize16Max));
+}
+
+Quaternion NormalizeSafe(const Quaternion &q) {
+    const float lengthSq = q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w;
+    if (lengthSq <= 0.0f) return Quaternion::Identity();
+    const float inv = 1.0f / std::sqrt(lengthSq);
+    return Quaternion(q.x * inv, q.y * inv, q.z * inv, q.w * inv);
+}
+
+/// @brief 2つの回転の間の角度（ラジアン）
+/// @details acos(内積) は float では内積が1付近で精度が落ち（約0.0007ラジアン未満を区別できない）、
+///          許容誤差の判定に使えないため、差と和の長さから atan2 で求める。
+float AngleBetween(const Quaternion &a, const Quaternion &b) {
+    const Quaternion na = NormalizeSafe(a);
+    Quaternion nb = NormalizeSafe(b);
+    // q と -q は同じ回転のため、近い向きにそろえる
+    if (na.x * nb.x + na.y * nb.y + na.z * nb.z + na.w * nb.w < 0.0f) nb = Quaternion(-nb.x, -nb.y, -nb.z, -nb.w);
+    const float dx = na.x - nb.x, dy = na.y - nb.y, dz = na.z - nb.z, dw = na.w - nb.w;
+    const float sx = na.x + nb.x, sy = na.y + nb.y, sz = na.z + nb.z, sw = na.w + nb.w;
+    const float difference = std::sqrt(dx * dx + dy * dy + dz * dz + dw * dw);
+    const float sum = std::sqrt(sx * sx + sy * sy + sz * sz + sw * sw);
+    return 4.0f * std::atan2(difference, sum);
+}
+
+void EncodeSmallestThree(const Quaternion &rotation, std::vector<std::uint16_t> &out) {
+    const Quaternion q = NormalizeSafe(rotation);
+    const float components[4] = { q.x, q.y, q.z, q.w };
+    std::uint32_t largest = 0;
+    for (std::uint32_t i = 1; i < 4; ++i) {
+        if (std::abs(components[i]) > std::abs(components[largest])) largest = i;
+    }
+    // q と -q は同じ回転のため、省く成分が正になる向きにそろえて符号を持たずに済ませる
+    const float sign = components[largest] < 0.0f ? -1.0f : 1.0f;
+
+    std::uint64_t packed = largest;
+    std::uint32_t shift = 2;
+    for (std::uint32_t i = 0; i < 4; ++i) {
+        if (i == largest) continue;
+        const float normalized = (components[i] * sign / kSmallestThreeRange) * 0.5f + 0.5f;
+        const auto quantized = static_cast<std::uint64_t>(std::lround(std::clamp(normalized, 0.0f, 1.0f) * kQuantize15Max));
+        packed |= quantized << shift;
+        shift += 15;
+    }
+    out.push_back(static_cast<std::uint16_t>(packed & 0xFFFFu));
+    out.push_back(static_cast<std::uint16_t>((packed >> 16) & 0xFFFFu));
+    out.push_back(static_cast<std::uint16_t>((packed >> 32) & 0xFFFFu));
+}
+
+/// @brief 残すキーを選ぶ（区間の両端のキーで補間した値が、間の全キーを許容誤差内で再現できる限りキーを飛ばす）
+/// @param isReproducible (始点, 終点) を受け取り、間のキーを全て再現できるか返す
+template <typename IsReproducible>
+std::vector<std::size_t> ReduceKeys(std::size_t count, IsReproducible isReproducible) {
+    std::vector<std::size_t> kept;
+    if (count == 0) return kept;
+    kept.push_back(0);
+    std::size_t anchor = 0;
+    for (std::size_t i = 1; i + 1 < count; ++i) {
+        if (!isReproducible(anchor, i + 1)) {
+            kept.push_back(i);
+            anchor = i;
+        }
+    }
+    if (count > 1) kept.push_back(count - 1);
+    return kept;
+}
+
+template <typename T>
+std::vector<std::pair<float, T>> GetSortedKeys(const KeyframeTimeline &source) {
+    std::vector<std::pair<float, T>> keys;
+    keys.reserve(source.keys.size());
+    for (const auto &key : source.keys) {
+        if (const T *value = std::get_if<T>(&key.value)) keys.emplace_back(key.time, *value);
+    }
+    std::stable_sort(keys.begin(), keys.end(), [](const auto &a, const auto &b) { return a.first < b.first; });
+    return keys;
+}
+
+float GetTimelineDuration(const KeyframeTimeline &source, float lastKeyTime) {
+    return std::max(source.duration, lastKeyTime);
+}
+
+void QuantizeKeyTimes(CompressedTimeline &timeline, const std::vector<float> &times) {
+    timeline.keyTimes.reserve(times.size());
+    for (const float time : times) {
+        timeline.keyTimes.push_back(timeline.duration > 0.0f ? QuantizeUnit16(time / timeline.duration) : 0);
+    }
+}
+
+/// @brief サンプリングする時刻（ループ・クランプ適用後）を求める
+float ResolveSampleTime(float time, float endTime, bool loop) {
+    if (loop) {
+        float sampledTime = std::fmod(time, endTime);
+        if (sampledTime < 0.0f) sampledTime += endTime;
+        return sampledTime;
+    }
+    return std::clamp(time, 0.0f, endTime);
+}
+
+/// @brief キー時刻の列で u 以下の最も後ろにあるキーの位置（先頭キーより前の場合は呼ばないこと）
+/// @param keyTimes 量子化済みの時刻（u も同じ単位）または量子化していない時刻（秒）
+template <typename KeyTimes>
+std::size_t FindFromKeyIndex(const KeyTimes &keyTimes, float u, TimelineCursor &cursor) {
+    const std::size_t count = keyTimes.size();
+    std::size_t index = cursor.keyIndex;
+    if (index < count && static_cast<float>(keyTimes[index]) <= u) {
+        for (std::size_t step = 0; step < kCursorLinearSteps; ++step) {
+            if (index + 1 >= count || static_cast<float>(keyTimes[index + 1]) > u) {
+                cursor.keyIndex = static_cast<std::uint32_t>(index);
+                return index;
+            }
+            ++index;
+        }
+    }
+    const auto upper = std::upper_bound(keyTimes.begin(), keyTimes.end(), u,
+        [](float value, auto keyTime) { return value < static_cast<float>(keyTime); });
+    index = static_cast<std::size_t>(upper - keyTimes.begin()) - 1;
+    cursor.keyIndex = static_cast<std::uint32_t>(index);
+    return index;
+}
+
+/// @brief 補間する2キーの位置と補間係数を求める
+/// @return 補間が不要な場合（先頭より前・末尾以降）は、使うキーの位置を from に入れて false
+bool LocateKeys(const CompressedTimeline &timeline, float time, bool loop, TimelineCursor &cursor,
+    std::size_t &from, float &weight) {
+    const std::size_t count = timeline.GetKeyCount();
+    const float endTime = timeline.duration;
+    if (endTime <= 0.0f) {
+        from = count - 1;
+        return false;
+    }
+
+    const float sampledTime = ResolveSampleTime(time, endTime, loop);
+    if (timeline.IsRaw()) {
+        if (sampledTime < timeline.rawKeyTimes.front()) {
+            from = 0;
+            return false;
+        }
+        from = FindFromKeyIndex(timeline.rawKeyTimes, sampledTime, cursor);
+    } else {
+        const float u = sampledTime * (kQuantize16Max / endTime);
+        if (u < static_cast<float>(timeline.keyTimes.front())) {
+            from = 0;
+            return false;
+        }
+        from = FindFromKeyIndex(timeline.keyTimes, u, cursor);
+    }
+    if (from + 1 >= count) {
+        from = count - 1;
+        return false;
+    }
+
+    const float fromTime = timeline.GetKeyTime(from);
+    const float span = timeline.GetKeyTime(from + 1) - fromTime;
+    weight = span > 0.0f ? (sampledTime - fromTime) / span : 0.0f;
+    return true;
+}
+
+} // namespace
+
+Quaternion CompressedTimeline::GetQuaternionValue(std::size_t index) const noexcept {
+    if (IsRaw()) {
+        const float *value = &rawKeyValues[index * 4];
+        return Quaternion(value[0], value[1], value[2], value[3]);
+    }
+    const std::size_t base = index * 3;
+    const std::uint64_t packed = static_cast<std::uint64_t>(keyValues[base])
+        | (static_cast<std::uint64_t>(keyValues[base + 1]) << 16)
+        | (static_cast<std::uint64_t>(keyValues[base + 2]) << 32);
+
+    const auto largest = static_cast<std::uint32_t>(packed & 0x3u);
+    float components[4] = {};
+    float sumSq = 0.0f;
+    std::uint32_t shift = 2;
+    for (std::uint32_t i = 0; i < 4; ++i) {
+        if (i == largest) continue;
+        const float normalized = static_cast<float>((packed >> shift) & 0x7FFFu) / kQuantize15Max;
+        components[i] = (normalized * 2.0f - 1.0f) * kSmallestThreeRange;
+        sumSq += components[i] * components[i];
+        shift += 15;
+    }
+    components[largest] = std::sqrt(std::max(0.0f, 1.0f - sumSq));
+    return Quaternion(components[0], components[1], components[2], components[3]);
+}
+
+CompressedTimeline CompressFloatTimeline(const KeyframeTimeline &source, float tolerance) {
+    const auto keys = GetSortedKeys<float>(source);
+    CompressedTimeline timeline;
+    timeline.isQuaternion = false;
+    if (keys.empty()) {
+        timeline.duration = std::max(0.0f, source.duration);
+        return timeline;
+    }
+    timeline.duration = GetTimelineDuration(source, keys.back().first);
+
+    std::vector<std::size_t> kept = ReduceKeys(keys.size(), [&](std::size_t begin, std::size_t end) {
+        const float span = keys[end].first - keys[begin].first;
+        for (std::size_t j = begin + 1; j < end; ++j) {
+            const float n = span > 0.0f ? (keys[j].first - keys[begin].first) / span : 0.0f;
+            const float value = keys[begin].second + (keys[end].second - keys[begin].second) * n;
+            if (std::abs(value - keys[j].second) > tolerance) return false;
+        }
+        return true;
+    });
+    // 全区間が一定値の場合はキー1つで表せる
+    if (kept.size() == 2 && std::abs(keys[kept[0]].second - keys[kept[1]].second) <= tolerance) {
+        kept.pop_back();
+    }
+
+    float minValue = keys[kept.front()].second;
+    float maxValue = minValue;
+    std::vector<float> times;
+    times.reserve(kept.size());
+    for (const std::size_t index : kept) {
+        minValue = std::min(minValue, keys[index].second);
+        maxValue = std::max(maxValue, keys[index].second);
+        times.push_back(keys[index].first);
+    }
+    timeline.rangeMin = minValue;
+    timeline.rangeExtent = maxValue - minValue;
+    QuantizeKeyTimes(timeline, times);
+    timeline.keyValues.reserve(kept.size());
+    for (const std::size_t index : kept) {
+        const float normalized = timeline.rangeExtent > 0.0f ? (keys[index].second - minValue) / timeline.rangeExtent : 0.0f;
+        timeline.keyValues.push_back(QuantizeUnit16(normalized));
+    }
+    return timeline;
+}
+
+CompressedTimeline CompressQuaternionTimeline(const KeyframeTimeline &source, float toleranceRadians) {
+    const auto keys = GetSortedKeys<Quaternion>(source);
+    CompressedTimeline timeline;
+    timeline.isQuaternion = true;
+    if (keys.empty()) {
+        timeline.duration = std::max(0.0f, source.duration);
+        return timeline;
+    }
+    timeline.duration = GetTimelineDuration(source, keys.back().first);
+
+    std::vector<std::size_t> kept = ReduceKeys(keys.size(), [&](std::size_t begin, std::size_t end) {
+        const float span = keys[end].first - keys[begin].first;
+        for (std::size_t j = begin + 1; j < end; ++j) {
+            const float n = span > 0.0f ? (keys[j].first - keys[begin].first) / span : 0.0f;
+            const Quaternion value = Quaternion::Slerp(keys[begin].second, keys[end].second, n);
+            if (AngleBetween(value, keys[j].second) > toleranceRadians) return false;
+        }
+        return true;
+    });
+    if (kept.size() == 2 && AngleBetween(keys[kept[0]].second, keys[kept[1]].second) <= toleranceRadians) {
+        kept.pop_back();
+    }
+
+    std::vector<float> times;
+    times.reserve(kept.size());
+    for (const std::size_t index : kept) times.push_back(keys[index].first);
+    QuantizeKeyTimes(timeline, times);
+    timeline.keyValues.reserve(kept.size() * 3);
+    for (const std::size_t index : kept) EncodeSmallestThree(keys[index].second, timeline.keyValues);
+    return timeline;
+}
+
+TimelineCompressionResult CompressTimelineWithinTolerance(const KeyframeTimeline &source, float tolerance) {
+    const bool isQuaternion = source.valueType == KeyframeValueType::Quaternion;
+    const auto compress = [&](float reductionTolerance) {
+        return isQuaternion ? CompressQuaternionTimeline(source, reductionTolerance) : CompressFloatTimeline(source, reductionTolerance);
+    };
+
+    TimelineCompressionResult result;
+    float reductionTolerance = tolerance;
+    for (;;) {
+        result.timeline = compress(reductionTolerance);
+        result.error = MeasureCompressionError(source, result.timeline);
+        if (result.error <= tolerance || reductionTolerance <= 0.0f) break;
+        ++result.retryCount;
+        reductionTolerance = result.retryCount > kMaxReductionRetries ? 0.0f : reductionTolerance * 0.5f;
+    }
+    if (result.error <= tolerance || result.timeline.GetKeyCount() == 0) return result;
+
+    // キーを全て残しても量子化の誤差だけで許容誤差を超えるため、キーをそのまま持つ
+    CompressedTimeline raw;
+    raw.isQuaternion = isQuaternion;
+    raw.duration = result.timeline.duration;
+    if (isQuaternion) {
+        for (const auto &[time, value] : GetSortedKeys<Quaternion>(source)) {
+            raw.rawKeyTimes.push_back(time);
+            raw.rawKeyValues.insert(raw.rawKeyValues.end(), { value.x, value.y, value.z, value.w });
+        }
+    } else {
+        for (const auto &[time, value] : GetSortedKeys<float>(source)) {
+            raw.rawKeyTimes.push_back(time);
+            raw.rawKeyValues.push_back(value);
+        }
+    }
+    result.timeline = std::move(raw);
+    result.error = MeasureCompressionError(source, result.timeline);
+    return result;
+}
+
+float MeasureCompressionError(const KeyframeTimeline &source, const CompressedTimeline &compressed) {
+    float maxError = 0.0f;
+    TimelineCursor cursor;
+    if (compressed.isQuaternion) {
+        for (const auto &[time, value] : GetSortedKeys<Quaternion>(source)) {
+            maxError = std::max(maxError, AngleBetween(SampleCompressedQuaternion(compressed, time, false, cursor), value));
+        }
+    } else {
+        for (const auto &[time, value] : GetSortedKeys<float>(source)) {
+            maxError = std::max(maxError, std::abs(SampleCompressedFloat(compressed, time, false, cursor) - value));
+        }
+    }
+    return maxError;
+}
+
+float SampleCompressedFloat(const CompressedTimeline &timeline, float time, bool loop, TimelineCursor &cursor) {
+    const std::size_t count = timeline.GetKeyCount();
+    if (count == 0) return 0.0f;
+    if (count == 1) return timeline.GetFloatValue(0);
+
+    std::size_t from = 0;
+    float weight = 0.0f;
+    if (!LocateKeys(timeline, time, loop, cursor, from, weight)) return timeline.GetFloatValue(from);
+    const float a = timeline.GetFloatValue(from);
+    const float b = timeline.GetFloatValue(from + 1);
+    return a + (b - a) * weight;
+}
+
+Quaternion SampleCompressedQuaternion(const CompressedTimeline &timeline, float time, bool loop, TimelineCursor &cursor) {
+    const std::size_t count = timeline.GetKeyCount();
+    if (count == 0) return Quaternion::Identity();
+    if (count == 1) return timeline.GetQuaternionValue(0);
+
+    std::size_t from = 0;
+    float weight = 0.0f;
+    if (!LocateKeys(timeline, time, loop, cursor, from, weight)) return timeline.GetQuaternionValue(from);
+    return Quaternion::Slerp(timeline.GetQuaternionValue(from), timeline.GetQuaternionValue(from + 1), weight);
+}
+
+std::vector<KeyframeNode> DecompressTimelineKeys(const CompressedTimeline &timeline) {
+    std::vector<KeyframeNode> keys;
+    keys.reserve(timeline.GetKeyCount());
+    for (std::size_t i = 0; i < timeline.GetKeyCount(); ++i) {
+        KeyframeNode key;
+        key.time = timeline.GetKeyTime(i);
+        if (timeline.isQuaternion) {
+            key.value = timeline.GetQuaternionValue(i);
+        } else {
+            key.value = timeline.GetFloatValue(i);
+        }
+        key.easeType = EaseType::Linear;
+        keys.push_back(std::move(key));
+    }
+    return keys;
+}
+
+} // namespace KashipanEngine
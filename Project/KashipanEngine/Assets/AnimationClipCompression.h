@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Math/Quaternion.h"
+#include "Scene/Components/KeyframeTimeline.h"
+
+namespace KashipanEngine {
+
+/// @brief アニメーションクリップ圧縮時の許容誤差
+struct AnimationCompressionSettings final {
+    /// @brief 移動量の許容誤差
+    float translateTolerance = 0.0005f;
+    /// @brief スケールの許容誤差
+    float scaleTolerance = 0.0005f;
+    /// @brief 回転の許容誤差（ラジアン）
+    float rotateToleranceRadians = 0.0005f;
+};
+
+/// @brief キー削減と量子化を行った圧縮済みタイムライン
+/// @details キー時刻は 0〜duration を16bitで正規化して持つ。値は float の場合キーごとに1要素
+///          （タイムライン内の最小値・幅に対する16bitの相対値）、クォータニオンの場合キーごとに3要素
+///          （絶対値が最大の成分を省いた残り3成分を15bitずつと、省いた成分の位置2bitを詰めた48bit）。
+///          量子化すると許容誤差に収まらないタイムライン（値の幅や長さに対して16bitでは粗すぎるもの）は、
+///          量子化せずにキーを rawKeyTimes / rawKeyValues へ float のまま持つ（この場合 keyTimes / keyValues は空）。
+struct CompressedTimeline final {
+    std::vector<std::uint16_t> keyTimes;
+    std::vector<std::uint16_t> keyValues;
+    /// @brief 量子化していないキー時刻（秒）
+    std::vector<float> rawKeyTimes;
+    /// @brief 量子化していないキーの値（float はキーごとに1要素、クォータニオンは x, y, z, w の4要素）
+    std::vector<float> rawKeyValues;
+    float duration = 0.0f;
+    float rangeMin = 0.0f;
+    float rangeExtent = 0.0f;
+    bool isQuaternion = false;
+
+    /// @brief キーを量子化せずに持っているか
+    bool IsRaw() const noexcept { return !rawKeyTimes.empty(); }
+    std::size_t GetKeyCount() const noexcept { return IsRaw() ? rawKeyTimes.size() : keyTimes.size(); }
+    float GetKeyTime(std::size_t index) const noexcept {
+        if (IsRaw()) return rawKeyTimes[index];
+        return static_cast<float>(keyTimes[index]) * (duration / 65535.0f);
+    }
+    float GetFloatValue(std::size_t index) const noexcept {
+        if (IsRaw()) return rawKeyValues[index];
+        return rangeMin + static_cast<float>(keyValues[index]) * (rangeExtent / 65535.0f);
+    }
+    Quaternion GetQuaternionValue(std::size_t index) const noexcept;
+    /// @brief 保持しているキーデータのバイト数
+    std::size_t GetMemorySize() const noexcept {
+        return (keyTimes.size() + keyValues.size()) * sizeof(std::uint16_t) +
+            (rawKeyTimes.size() + rawKeyValues.size()) * sizeof(float);
+    }
+};
+
+/// @brief CompressTimelineWithinTolerance の結果
+struct TimelineCompressionResult final {
+    CompressedTimeline timeline;
+    /// @brief 元のキー時刻で評価した最大誤差（MeasureCompressionError）
+    float error = 0.0f;
+    /// @brief 許容誤差に収めるためにキー削減を狭めて圧縮し直した回数
+    std::uint32_t retryCount = 0;
+};
+
+/// @brief 圧縮済みタイムラインの再生位置に対応するキーを覚えておくカーソル
+/// @details 前方へ進む再生では前回のキーから数個進めるだけで済み、巻き戻し・シーク時のみ二分探索に戻る
+struct TimelineCursor final {
+    std::uint32_t keyIndex = 0;
+};
+
+/// @brief float のタイムラインを圧縮する（線形補間で tolerance 以内に再現できるキーを削除してから量子化する）
+CompressedTimeline CompressFloatTimeline(const KeyframeTimeline &source, float tolerance);
+/// @brief クォータニオンのタイムラインを圧縮する（球面線形補間で toleranceRadians 以内に再現できるキーを削除してから量子化する）
+CompressedTimeline CompressQuaternionTimeline(const KeyframeTimeline &source, float toleranceRadians);
+
+/// @brief 元のタイムラインとの誤差が tolerance 以内に収まるように圧縮する
+/// @details キー削減は tolerance 以内で行うが、その後の量子化の誤差が上乗せされるため、実際の誤差を測って
+///          超えていればキー削減の許容誤差を狭めて圧縮し直す。キーを全て残しても収まらない場合は量子化をやめ、
+///          キーをそのまま保持する（CompressedTimeline::IsRaw）。クォータニオンの場合 tolerance はラジアン。
+TimelineCompressionResult CompressTimelineWithinTolerance(const KeyframeTimeline &source, float tolerance);
+
+/// @brief 圧縮済みタイムラインを元のタイムラインの全キー時刻で評価した最大誤差（float は値の差、クォータニオンは角度の差）
+float MeasureCompressionError(const KeyframeTimeline &source, const CompressedTimeline &compressed);
+
+/// @brief 圧縮済みタイムラインの指定時刻の値を取得する
+float SampleCompressedFloat(const CompressedTimeline &timeline, float time, bool loop, TimelineCursor &cursor);
+Quaternion SampleCompressedQuaternion(const CompressedTimeline &timeline, float time, bool loop, TimelineCursor &cursor);
+
+/// @brief 圧縮済みタイムラインからキーフレームノードを復元する（量子化後の値のため元のキーとは一致しない）
+std::vector<KeyframeNode> DecompressTimelineKeys(const CompressedTimeline &timeline);
+
+} // namespace KashipanEngine
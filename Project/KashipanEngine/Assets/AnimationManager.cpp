@@ -2,8 +2,10 @@
 #include "Assets/AssimpUtf8IOSystem.h"
 #include "Assets/CaseInsensitive.h"
 
+#include "Core/ProjectPaths.h"
 #include "Debug/Logger.h"
 #include "Utilities/Conversion/ConvertString.h"
+#include "Utilities/FileIO/BinaryStream.h"
 #include "Utilities/FileIO/Directory.h"
 #include "Utilities/Translation.h"
 
@@ -13,6 +15,7 @@
 
 #include <algorithm>
 #include <cctype>
+#include <cstdio>
 #include <filesystem>
 #include <functional>
 #include <unordered_map>
@@ -24,6 +27,16 @@ namespace {
 
 using Handle = AnimationManager::AnimationHandle;
 
+/// @brief 変換済み（圧縮済み）クリップの保存先（プロジェクトルート基準）
+constexpr const char *kCookedFolderName = "Cache/AnimationClips";
+constexpr const char *kCookedExtension = ".kac";
+/// @brief 変換済みクリップファイルの識別子とフォーマットのバージョン
+constexpr std::uint32_t kCookedMagic = 0x4341534Bu; // "KSAC"
+constexpr std::uint32_t kCookedFormatVersion = 2;
+
+/// @brief クリップ圧縮の許容誤差（変更すると変換済みファイルは作り直される）
+constexpr AnimationCompressionSettings kCompressionSettings{};
+
 struct AnimationEntry final {
     std::string fullPath;
     std::string assetPath;
@@ -76,82 +89,233 @@ Handle RegisterEntry(AnimationEntry &&entry) {
     return handle;
 }
 
-KeyframeTimeline BuildTimeline(const std::string &name, KeyframeValueType valueType, const std::vector<KeyframeNode> &keys, bool loop) {
-    KeyframeTimeline timeline;
-    timeline.name = name;
-    timeline.valueType = valueType;
-    timeline.keys = keys;
-    timeline.loop = loop;
-    if (!timeline.keys.empty()) {
-        float maxTime = timeline.keys.front().time;
-        for (const auto &k : timeline.keys) {
-            if (k.time > maxTime) maxTime = k.time;
-        }
-        timeline.duration = maxTime;
+std::string GetCookedClipPath(const std::string &assetPath) {
+    const std::uint64_t keyHash = HashFnv1a(kFnv1aOffsetBasis, assetPath.data(), assetPath.size());
+    char fileName[32] = {};
+    std::snprintf(fileName, sizeof(fileName), "%016llx", static_cast<unsigned long long>(keyHash));
+    return ProjectPaths::InProjectRoot(std::string(kCookedFolderName) + "/" + fileName + kCookedExtension);
+}
+
+/// @brief タイムラインの種類に対応する許容誤差
+float GetCompressionTolerance(const KeyframeTimeline &timeline) {
+    if (timeline.valueType == KeyframeValueType::Quaternion) return kCompressionSettings.rotateToleranceRadians;
+    if (timeline.name.ends_with(".Scale.X") || timeline.name.ends_with(".Scale.Y") || timeline.name.ends_with(".Scale.Z")) {
+        return kCompressionSettings.scaleTolerance;
     }
-    return timeline;
+    return kCompressionSettings.translateTolerance;
 }
 
-} // namespace
+/// @brief クリップの全タイムラインを許容誤差内で圧縮し、ノードごとの誤差を記録してから元のキーを破棄する
+void CompressClip(AnimationClip &clip) {
+    clip.compressedTimelines.clear();
+    clip.compressedTimelines.reserve(clip.timelines.size());
+    std::vector<float> timelineErrors;
+    timelineErrors.reserve(clip.timelines.size());
+    for (const auto &timeline : clip.timelines) {
+        auto result = CompressTimelineWithinTolerance(timeline, GetCompressionTolerance(timeline));
+        if (result.timeline.IsRaw()) {
+            Log(Translation("engine.animation.cooking.uncompressed") + clip.name + " / " + timeline.name +
+                " keys=" + std::to_string(result.timeline.GetKeyCount()), LogSeverity::Info);
+        } else if (result.retryCount > 0) {
+            Log(Translation("engine.animation.cooking.recompressed") + clip.name + " / " + timeline.name +
+                " retries=" + std::to_string(result.retryCount) + " error=" + std::to_string(result.error), LogSeverity::Debug);
+        }
+        timelineErrors.push_back(result.error);
+        clip.compressedTimelines.push_back(std::move(result.timeline));
+    }
 
-AnimationManager::AnimationManager(Passkey<GameEngine>, const std::string &assetsRootPath)
-    : assetsRootPath_(NormalizePathSlashes(assetsRootPath)) {
-    LogScope scope;
-    LoadAllFromAssetsFolder();
-}
+    clip.compressionErrors.clear();
+    for (const auto &[nodeName, timelineIndices] : clip.nodeNameToTimelineIndices) {
+        AnimationNodeCompressionError error;
+        error.nodeName = nodeName;
+        for (const uint32_t timelineIndex : timelineIndices) {
+            if (timelineIndex >= clip.timelines.size()) continue;
+            const auto &timeline = clip.timelines[timelineIndex];
+            const float value = timelineErrors[timelineIndex];
+            if (timeline.valueType == KeyframeValueType::Quaternion) {
+                error.rotateErrorRadians = std::max(error.rotateErrorRadians, value);
+            } else if (timeline.name.find(".Scale.") != std::string::npos) {
+                error.scaleError = std::max(error.scaleError, value);
+            } else {
+                error.translateError = std::max(error.translateError, value);
+            }
+        }
+        clip.compressionErrors.push_back(std::move(error));
+    }
+    std::sort(clip.compressionErrors.begin(), clip.compressionErrors.end(),
+        [](const auto &a, const auto &b) { return a.nodeName < b.nodeName; });
 
-AnimationManager::~AnimationManager() {
-    LogScope scope;
-    sAnimations.clear();
-    sFileNameToHandle.clear();
-    sAssetPathToHandle.clear();
+    for (auto &timeline : clip.timelines) {
+        timeline.keys.clear();
+        timeline.keys.shrink_to_fit();
+    }
 }
 
-void AnimationManager::LoadAllFromAssetsFolder() {
-    LogScope scope;
-    const auto dir = GetDirectoryData(assetsRootPath_, true, true);
+/// @brief クリップの圧縮誤差のうち、チャンネルごとに最も大きいノードをログへ出す
+void LogCompressionError(const AnimationClip &clip) {
+    const AnimationNodeCompressionError *worst[3] = {};
+    for (const auto &error : clip.compressionErrors) {
+        if (!worst[0] || error.translateError > worst[0]->translateError) worst[0] = &error;
+        if (!worst[1] || error.rotateErrorRadians > worst[1]->rotateErrorRadians) worst[1] = &error;
+        if (!worst[2] || error.scaleError > worst[2]->scaleError) worst[2] = &error;
+    }
+    if (!worst[0]) return;
+    Log(Translation("engine.animation.cooking.error") + clip.name +
+        " translate=" + std::to_string(worst[0]->translateError) + " (" + worst[0]->nodeName + ")" +
+        " rotateRad=" + std::to_string(worst[1]->rotateErrorRadians) + " (" + worst[1]->nodeName + ")" +
+        " scale=" + std::to_string(worst[2]->scaleError) + " (" + worst[2]->nodeName + ")", LogSeverity::Debug);
+}
 
-    std::vector<std::string> files;
-    const auto filtered = GetDirectoryDataByExtension(dir,
-        { ".fbx", ".gltf", ".glb", ".dae", ".x", ".blend", ".obj" });
+void WriteSettings(BinaryWriter &writer) {
+    writer.F32(kCompressionSettings.translateTolerance);
+    writer.F32(kCompressionSettings.scaleTolerance);
+    writer.F32(kCompressionSettings.rotateToleranceRadians);
+}
 
-    std::function<void(const DirectoryData &)> flatten = [&](const DirectoryData &d) {
-        for (const auto &f : d.files) files.push_back(f);
-        for (const auto &sd : d.subdirectories) flatten(sd);
-    };
-    flatten(filtered);
+bool ReadAndCompareSettings(BinaryReader &reader) {
+    const float translateTolerance = reader.F32();
+    const float scaleTolerance = reader.F32();
+    const float rotateTolerance = reader.F32();
+    return reader.IsValid() && translateTolerance == kCompressionSettings.translateTolerance &&
+        scaleTolerance == kCompressionSettings.scaleTolerance && rotateTolerance == kCompressionSettings.rotateToleranceRadians;
+}
 
-    for (const auto &f : files) {
-        LoadAnimation(f);
+/// @brief 圧縮済みのクリップ一覧を変換済みファイルへ書き出す
+void SaveCookedClips(const std::string &assetPath, std::uint64_t sourceHash, const std::vector<AnimationClip> &clips) {
+    std::vector<std::uint8_t> data;
+    BinaryWriter writer(data);
+    writer.U32(kCookedMagic);
+    writer.U32(kCookedFormatVersion);
+    writer.String(assetPath);
+    writer.U64(sourceHash);
+    WriteSettings(writer);
+
+    writer.U32(static_cast<std::uint32_t>(clips.size()));
+    for (const auto &clip : clips) {
+        writer.String(clip.name);
+        writer.F32(clip.duration);
+        writer.F32(clip.ticksPerSecond);
+        writer.U32(static_cast<std::uint32_t>(clip.timelines.size()));
+        for (size_t i = 0; i < clip.timelines.size(); ++i) {
+            const auto &timeline = clip.timelines[i];
+            const auto &compressed = clip.compressedTimelines[i];
+            writer.String(timeline.name);
+            writer.U8(static_cast<std::uint8_t>(timeline.valueType));
+            writer.F32(timeline.duration);
+            writer.U8(compressed.isQuaternion ? 1 : 0);
+            writer.F32(compressed.duration);
+            writer.F32(compressed.rangeMin);
+            writer.F32(compressed.rangeExtent);
+            writer.Array(compressed.keyTimes);
+            writer.Array(compressed.keyValues);
+            writer.Array(compressed.rawKeyTimes);
+            writer.Array(compressed.rawKeyValues);
+        }
+        writer.U32(static_cast<std::uint32_t>(clip.nodeNameToTimelineIndices.size()));
+        for (const auto &[nodeName, timelineIndices] : clip.nodeNameToTimelineIndices) {
+            writer.String(nodeName);
+            writer.Array(timelineIndices);
+        }
+        writer.U32(static_cast<std::uint32_t>(clip.compressionErrors.size()));
+        for (const auto &error : clip.compressionErrors) {
+            writer.String(error.nodeName);
+            writer.F32(error.translateError);
+            writer.F32(error.rotateErrorRadians);
+            writer.F32(error.scaleError);
+        }
+    }
+    if (SaveChecksummedBinaryFile(GetCookedClipPath(assetPath), std::move(data))) {
+        Log(Translation("engine.animation.cooking.saved") + assetPath, LogSeverity::Debug);
     }
 }
 
-AnimationManager::AnimationHandle AnimationManager::LoadAnimation(const std::string &filePath) {
-    LogScope scope;
-    if (filePath.empty()) return kInvalidHandle;
-
-    Log(Translation("engine.animation.loading.start") + filePath, LogSeverity::Info);
-
-    {
-        const std::string normalized = NormalizePathSlashes(filePath);
-        auto it = sAssetPathToHandle.find(normalized);
-        if (it != sAssetPathToHandle.end()) {
-            Log(Translation("engine.animation.loading.alreadyloaded") + normalized, LogSeverity::Debug);
-            return it->second;
+/// @brief 変換済みファイルからクリップ一覧を読み込む
+/// @return ファイルが無い・壊れている・元ファイルの内容や圧縮設定が変わっている場合は false
+bool LoadCookedClips(const std::string &assetPath, std::uint64_t sourceHash, std::vector<AnimationClip> &outClips) {
+    std::vector<std::uint8_t> data;
+    if (!LoadChecksummedBinaryFile(GetCookedClipPath(assetPath), data)) return false;
+
+    BinaryReader reader(data.data(), data.size());
+    if (reader.U32() != kCookedMagic || reader.U32() != kCookedFormatVersion) return false;
+    if (reader.String() != assetPath || reader.U64() != sourceHash) return false;
+    if (!ReadAndCompareSettings(reader)) return false;
+
+    std::vector<AnimationClip> clips(reader.U32());
+    for (auto &clip : clips) {
+        if (!reader.IsValid()) return false;
+        clip.name = reader.String();
+        clip.duration = reader.F32();
+        clip.ticksPerSecond = reader.F32();
+        const std::uint32_t timelineCount = reader.U32();
+        for (std::uint32_t i = 0; i < timelineCount && reader.IsValid(); ++i) {
+            KeyframeTimeline timeline;
+            timeline.name = reader.String();
+            timeline.valueType = static_cast<KeyframeValueType>(reader.U8());
+            timeline.duration = reader.F32();
+            timeline.loop = false;
+
+            CompressedTimeline compressed;
+            compressed.isQuaternion = reader.U8() != 0;
+            compressed.duration = reader.F32();
+            compressed.rangeMin = reader.F32();
+            compressed.rangeExtent = reader.F32();
+            compressed.keyTimes = reader.Array<std::uint16_t>();
+            compressed.keyValues = reader.Array<std::uint16_t>();
+            compressed.rawKeyTimes = reader.Array<float>();
+            compressed.rawKeyValues = reader.Array<float>();
+            const size_t valuesPerKey = compressed.isQuaternion ? 3 : 1;
+            if (compressed.keyValues.size() != compressed.keyTimes.size() * valuesPerKey) return false;
+            const size_t rawValuesPerKey = compressed.isQuaternion ? 4 : 1;
+            if (compressed.rawKeyValues.size() != compressed.rawKeyTimes.size() * rawValuesPerKey) return false;
+            if (compressed.IsRaw() && !compressed.keyTimes.empty()) return false;
+
+            clip.timelineNameToIndex[timeline.name] = static_cast<uint32_t>(clip.timelines.size());
+            clip.timelines.push_back(std::move(timeline));
+            clip.compressedTimelines.push_back(std::move(compressed));
+        }
+        const std::uint32_t nodeCount = reader.U32();
+        for (std::uint32_t i = 0; i < nodeCount && reader.IsValid(); ++i) {
+            std::string nodeName = reader.String();
+            std::vector<uint32_t> timelineIndices = reader.Array<uint32_t>();
+            for (const uint32_t timelineIndex : timelineIndices) {
+                if (timelineIndex >= clip.timelines.size()) return false;
+            }
+            clip.nodeNameToTimelineIndices[std::move(nodeName)] = std::move(timelineIndices);
+        }
+        const std::uint32_t errorCount = reader.U32();
+        for (std::uint32_t i = 0; i < errorCount && reader.IsValid(); ++i) {
+            AnimationNodeCompressionError error;
+            error.nodeName = reader.String();
+            error.translateError = reader.F32();
+            error.rotateErrorRadians = reader.F32();
+            error.scaleError = reader.F32();
+            clip.compressionErrors.push_back(std::move(error));
         }
     }
+    if (!reader.IsValid() || !reader.IsAtEnd()) return false;
 
-    const std::filesystem::path p = Utf8StringToPath(filePath);
+    outClips = std::move(clips);
+    return true;
+}
 
-    if (!std::filesystem::exists(p)) {
-        Log(Translation("engine.animation.loading.failed.notfound") + PathToUtf8String(p), LogSeverity::Warning);
-        return kInvalidHandle;
-    }
-    if (!HasSupportedAnimationExtension(p)) {
-        Log(Translation("engine.animation.loading.failed.unsupported") + PathToUtf8String(p), LogSeverity::Warning);
-        return kInvalidHandle;
+KeyframeTimeline BuildTimeline(const std::string &name, KeyframeValueType valueType, const std::vector<KeyframeNode> &keys, bool loop) {
+    KeyframeTimeline timeline;
+    timeline.name = name;
+    timeline.valueType = valueType;
+    timeline.keys = keys;
+    timeline.loop = loop;
+    if (!timeline.keys.empty()) {
+        float maxTime = timeline.keys.front().time;
+        for (const auto &k : timeline.keys) {
+            if (k.time > maxTime) maxTime = k.time;
+        }
+        timeline.duration = maxTime;
     }
+    return timeline;
+}
 
+/// @brief Assimpで元ファイルを読み込み、圧縮前のクリップ一覧を作る
+bool ImportClipsWithAssimp(const std::filesystem::path &p, const std::string &fileName, std::vector<AnimationClip> &outClips) {
     Assimp::Importer importer;
     // Assimpの既定IOSystemはWindows上でfopen（現在のANSIコードページ）を使うため、
     // コードページで表現できない文字を含むパス（多言語のファイル名等）を開けない。
@@ -172,28 +336,22 @@ AnimationManager::AnimationHandle AnimationManager::LoadAnimation(const std::str
     const aiScene *scene = importer.ReadFile(PathToUtf8String(p), flags);
     if (!scene || !scene->mRootNode) {
         Log(Translation("engine.animation.loading.failed.assimp") + PathToUtf8String(p) + " msg=" + importer.GetErrorString(), LogSeverity::Warning);
-        return kInvalidHandle;
+        return false;
     }
 
     if (scene->mNumAnimations == 0) {
         Log(Translation("engine.animation.loading.failed.noanim") + PathToUtf8String(p), LogSeverity::Warning);
-        return kInvalidHandle;
+        return false;
     }
 
-    AnimationEntry entry{};
-    entry.fullPath = NormalizePathSlashes(PathToUtf8String(p));
-    entry.assetPath = MakeAssetRelativePath(assetsRootPath_, entry.fullPath);
-    entry.fileName = PathToUtf8String(p.filename());
-    entry.data.assetRelativePath_ = entry.assetPath;
-
-    entry.data.clips_.reserve(scene->mNumAnimations);
+    outClips.reserve(scene->mNumAnimations);
 
     for (unsigned int ai = 0; ai < scene->mNumAnimations; ++ai) {
         const aiAnimation *anim = scene->mAnimations[ai];
         if (!anim) continue;
 
         AnimationClip clip;
-        clip.name = anim->mName.length > 0 ? anim->mName.C_Str() : (entry.fileName + "#" + std::to_string(ai));
+        clip.name = anim->mName.length > 0 ? anim->mName.C_Str() : (fileName + "#" + std::to_string(ai));
         clip.duration = static_cast<float>(anim->mDuration);
         clip.ticksPerSecond = static_cast<float>(anim->mTicksPerSecond);
         if (clip.ticksPerSecond <= 0.0f) {
@@ -289,6 +447,99 @@ AnimationManager::AnimationHandle AnimationManager::LoadAnimation(const std::str
             clip.timelines.push_back(t);
         }
 
+        outClips.push_back(std::move(clip));
+    }
+    return true;
+}
+
+} // namespace
+
+std::vector<KeyframeNode> AnimationClip::GetTimelineKeys(uint32_t timelineIndex) const {
+    if (timelineIndex < compressedTimelines.size()) return DecompressTimelineKeys(compressedTimelines[timelineIndex]);
+    if (timelineIndex < timelines.size()) return timelines[timelineIndex].keys;
+    return {};
+}
+
+AnimationManager::AnimationManager(Passkey<GameEngine>, const std::string &assetsRootPath)
+    : assetsRootPath_(NormalizePathSlashes(assetsRootPath)) {
+    LogScope scope;
+    LoadAllFromAssetsFolder();
+}
+
+AnimationManager::~AnimationManager() {
+    LogScope scope;
+    sAnimations.clear();
+    sFileNameToHandle.clear();
+    sAssetPathToHandle.clear();
+}
+
+void AnimationManager::LoadAllFromAssetsFolder() {
+    LogScope scope;
+    const auto dir = GetDirectoryData(assetsRootPath_, true, true);
+
+    std::vector<std::string> files;
+    const auto filtered = GetDirectoryDataByExtension(dir,
+        { ".fbx", ".gltf", ".glb", ".dae", ".x", ".blend", ".obj" });
+
+    std::function<void(const DirectoryData &)> flatten = [&](const DirectoryData &d) {
+        for (const auto &f : d.files) files.push_back(f);
+        for (const auto &sd : d.subdirectories) flatten(sd);
+    };
+    flatten(filtered);
+
+    for (const auto &f : files) {
+        LoadAnimation(f);
+    }
+}
+
+AnimationManager::AnimationHandle AnimationManager::LoadAnimation(const std::string &filePath) {
+    LogScope scope;
+    if (filePath.empty()) return kInvalidHandle;
+
+    Log(Translation("engine.animation.loading.start") + filePath, LogSeverity::Info);
+
+    {
+        const std::string normalized = NormalizePathSlashes(filePath);
+        auto it = sAssetPathToHandle.find(normalized);
+        if (it != sAssetPathToHandle.end()) {
+            Log(Translation("engine.animation.loading.alreadyloaded") + normalized, LogSeverity::Debug);
+            return it->second;
+        }
+    }
+
+    const std::filesystem::path p = Utf8StringToPath(filePath);
+
+    if (!std::filesystem::exists(p)) {
+        Log(Translation("engine.animation.loading.failed.notfound") + PathToUtf8String(p), LogSeverity::Warning);
+        return kInvalidHandle;
+    }
+    if (!HasSupportedAnimationExtension(p)) {
+        Log(Translation("engine.animation.loading.failed.unsupported") + PathToUtf8String(p), LogSeverity::Warning);
+        return kInvalidHandle;
+    }
+
+    AnimationEntry entry{};
+    entry.fullPath = NormalizePathSlashes(PathToUtf8String(p));
+    entry.assetPath = MakeAssetRelativePath(assetsRootPath_, entry.fullPath);
+    entry.fileName = PathToUtf8String(p.filename());
+    entry.data.assetRelativePath_ = entry.assetPath;
+
+    // 元ファイルの内容と圧縮設定が同じ変換済みファイルがあれば、Assimpでの読み込みと圧縮を省く
+    const std::uint64_t sourceHash = HashFileContentFnv1a(entry.fullPath);
+    std::vector<AnimationClip> clips;
+    if (LoadCookedClips(entry.assetPath, sourceHash, clips)) {
+        Log(Translation("engine.animation.loading.cooked") + entry.assetPath, LogSeverity::Debug);
+    } else {
+        if (!ImportClipsWithAssimp(p, entry.fileName, clips)) return kInvalidHandle;
+        for (auto &clip : clips) {
+            CompressClip(clip);
+            LogCompressionError(clip);
+        }
+        SaveCookedClips(entry.assetPath, sourceHash, clips);
+    }
+
+    entry.data.clips_.reserve(clips.size());
+    for (auto &clip : clips) {
         entry.data.clipNameToIndex_[clip.name] = static_cast<uint32_t>(entry.data.clips_.size());
         entry.data.clips_.push_back(std::move(clip));
     }
@@ -6,20 +6,38 @@
 #include <vector>
 
 #include "Utilities/Passkeys.h"
-#include "Scene/Components/KeyframeAnimator.h"
+#include "Assets/AnimationClipCompression.h"
+#include "Scene/Components/KeyframeTimeline.h"
 
 namespace KashipanEngine {
 
 class GameEngine;
 
+/// @brief クリップの圧縮で生じたノード（ジョイント）ごとの最大誤差
+struct AnimationNodeCompressionError final {
+    std::string nodeName;
+    float translateError = 0.0f;
+    float rotateErrorRadians = 0.0f;
+    float scaleError = 0.0f;
+};
+
 /// @brief アニメーションクリップデータ
+/// @details キーは読み込み時に圧縮され、compressedTimelines にのみ保持される（timelines は名前・型・長さだけを持ち、keys は空）。
+///          キーフレームノードとして必要な場合は GetTimelineKeys で復元する。
 struct AnimationClip final {
     std::string name;
     float duration = 0.0f;
     float ticksPerSecond = 0.0f;
     std::vector<KeyframeTimeline> timelines;
+    /// @brief timelines と同じ並びの圧縮済みキー
+    std::vector<CompressedTimeline> compressedTimelines;
     std::unordered_map<std::string, uint32_t> timelineNameToIndex;
     std::unordered_map<std::string, std::vector<uint32_t>> nodeNameToTimelineIndices;
+    /// @brief 圧縮による誤差（ノード単位）
+    std::vector<AnimationNodeCompressionError> compressionErrors;
+
+    /// @brief タイムラインのキーを取得する（圧縮済みの場合は復元したもの）
+    std::vector<KeyframeNode> GetTimelineKeys(uint32_t timelineIndex) const;
 };
 
 /// @brief アニメーションデータ
@@ -513,9 +513,10 @@ void AudioManager::LoadAllFromAssetsFolder() {
     flatten(filtered);
 
     // ファイルI/O・デコード(Media Foundation)はCPU処理のみでグローバル状態に触れないため、
-    // スレッドプールで並列実行する。各要素は担当するインデックス以外書き込まないためロック不要
+    // ジョブシステムで並列実行する。各要素は担当するインデックス以外書き込まないためロック不要
     std::vector<SoundEntry> decodedEntries(files.size());
-    std::vector<bool> decodedOk(files.size(), false);
+    // std::vector<bool>はビット単位で詰められ、別インデックスへの並列書き込みでも競合するためバイト単位で持つ
+    std::vector<std::uint8_t> decodedOk(files.size(), 0);
     Plugin::RunParallelAndWait(files.size(), [this, &files, &decodedEntries, &decodedOk](size_t i) {
         decodedOk[i] = DecodeAudioFile(files[i], assetsRootPath_, decodedEntries[i]);
         });
@@ -45,6 +45,8 @@ struct ModelEntry final {
     std::string fullPath;
     std::string assetPath;
     std::string fileName;
+    /// @brief 登録の世代番号（RegisterEntryで割り当てる）
+    uint32_t revision = 0;
 
     ModelData data;
 };
@@ -52,6 +54,8 @@ struct ModelEntry final {
 std::unordered_map<Handle, ModelEntry> sModels;
 FileMap<Handle> sFileNameToHandle;
 FileMap<Handle> sAssetPathToHandle;
+/// @brief 最後に割り当てた世代番号（ハンドルが再利用されても区別できるよう、ModelManagerの破棄時もリセットしない）
+uint32_t sLastRevision = 0;
 
 ModelManager* sActiveInstance = nullptr;
 
@@ -173,6 +177,7 @@ Handle RegisterEntry(ModelEntry&& entry) {
     if (handle == ModelManager::kInvalidHandle) return ModelManager::kInvalidHandle;
     if (sModels.find(handle) != sModels.end()) return ModelManager::kInvalidHandle;
 
+    entry.revision = ++sLastRevision;
     sFileNameToHandle[entry.fileName] = handle;
     sAssetPathToHandle[NormalizePathSlashes(entry.assetPath)] = handle;
     sModels.emplace(handle, std::move(entry));
@@ -237,7 +242,7 @@ void ModelManager::LoadAllFromAssetsFolder() {
     flatten(filtered);
 
     // ファイルI/O・Assimp解析・メッシュ抽出はCPU処理のみでGPUリソース・グローバル状態に触れないため、
-    // スレッドプールで並列実行する（各要素は担当するインデックス以外書き込まないためロック不要）
+    // ジョブシステムで並列実行する（各要素は担当するインデックス以外書き込まないためロック不要）
     std::vector<std::unique_ptr<ParsedModelResult>> parsedResults(files.size());
     Plugin::RunParallelAndWait(files.size(), [this, &files, &parsedResults](size_t i) {
         parsedResults[i] = ParseModelFile(files[i]);
@@ -924,6 +929,11 @@ const ModelData &ModelManager::GetModelData(ModelHandle handle) {
     return it->second.data;
 }
 
+uint32_t ModelManager::GetModelRevision(ModelHandle handle) {
+    auto it = sModels.find(handle);
+    return (it != sModels.end()) ? it->second.revision : 0;
+}
+
 const ModelData &ModelManager::GetModelDataFromFileName(const std::string &fileName) {
     LogScope scope;
     const auto h = GetModelHandleFromFileName(fileName);
@@ -183,6 +183,12 @@ public:
 
     /// @brief ハンドルからモデルデータを取得
     static const ModelData &GetModelData(ModelHandle handle);
+    /// @brief ハンドルに登録されているモデルデータの世代番号を取得する
+    /// @details 登録のたびにプロセス全体で一意な値が割り当てられる。ModelManagerの作り直し等で
+    ///          ハンドルの番号が別のモデルに再利用された場合も値が変わるため、ハンドルから構築した
+    ///          派生データ（衝突判定メッシュ等）のキャッシュが古いかどうかの判定に使う
+    /// @return 未登録のハンドルの場合は0
+    static uint32_t GetModelRevision(ModelHandle handle);
     /// @brief ファイル名単体からモデルデータを取得
     static const ModelData &GetModelDataFromFileName(const std::string& fileName);
     /// @brief Assetsルートからの相対パスからモデルデータを取得
@@ -0,0 +1,247 @@
+#include "SkeletonPoseEvaluator.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <string_view>
+#include <utility>
+
+#include "Assets/AnimationManager.h"
+
+namespace KashipanEngine {
+
+namespace {
+
+/// @brief HalfRate / ReducedBones でクリップを評価する間隔（フレーム数）
+constexpr uint32_t kThrottledSampleInterval = 2;
+
+Matrix4x4 MakeJointLocalMatrix(const SkeletonTransform &transform) {
+    // SkeletonTransform::GetWorldMatrix と同じ S * R * T の順で合成する
+    Matrix4x4 scaleMat;
+    scaleMat.MakeScale(transform.GetScale());
+    Matrix4x4 translateMat;
+    translateMat.MakeTranslate(transform.GetTranslate());
+    return scaleMat * transform.GetRotate().MakeRotateMatrix() * translateMat;
+}
+
+/// @brief 補間用のクォータニオンの線形補間（間引き評価の1フレーム分の差しか補間しないため球面補間は使わない）
+Quaternion NlerpQuaternion(const Quaternion &from, const Quaternion &to, float t) {
+    const float dot = from.x * to.x + from.y * to.y + from.z * to.z + from.w * to.w;
+    const float sign = dot < 0.0f ? -1.0f : 1.0f;
+    const Quaternion result(
+        from.x + (to.x * sign - from.x) * t,
+        from.y + (to.y * sign - from.y) * t,
+        from.z + (to.z * sign - from.z) * t,
+        from.w + (to.w * sign - from.w) * t);
+    return result.Normalize();
+}
+
+} // namespace
+
+void SkeletonPoseEvaluator::SetSkeleton(Skeleton skeleton) {
+    skeleton_ = std::move(skeleton);
+
+    // ジョイント行列は親から順に計算するため、ジョイントの並び（メッシュのボーン順）とは別に計算順を求めておく
+    const size_t jointCount = skeleton_.joints.size();
+    jointEvaluationOrder_.clear();
+    jointEvaluationOrder_.reserve(jointCount);
+    jointDepths_.assign(jointCount, 0);
+    for (uint32_t jointIndex = 0; jointIndex < jointCount; ++jointIndex) {
+        if (skeleton_.joints[jointIndex].parentIndex) continue;
+        jointEvaluationOrder_.push_back(jointIndex);
+    }
+    for (size_t i = 0; i < jointEvaluationOrder_.size(); ++i) {
+        const uint32_t parentIndex = jointEvaluationOrder_[i];
+        for (const int32_t childIndex : skeleton_.joints[parentIndex].childrenIndices) {
+            if (childIndex < 0 || static_cast<size_t>(childIndex) >= jointCount) continue;
+            jointDepths_[static_cast<size_t>(childIndex)] = jointDepths_[parentIndex] + 1;
+            jointEvaluationOrder_.push_back(static_cast<uint32_t>(childIndex));
+        }
+    }
+    previousPose_.assign(jointCount, JointPose{});
+    sampledPose_.assign(jointCount, JointPose{});
+    isPoseHistoryValid_ = false;
+    isJointMatricesDirty_ = true;
+    isClipBindingValid_ = false;
+}
+
+SkeletonPoseEvaluator::ClipBinding *SkeletonPoseEvaluator::BindClip(const AnimationClip *clip) {
+    if (isClipBindingValid_ && clip == boundClip_) return clipBinding_.timelines ? &clipBinding_ : nullptr;
+    isClipBindingValid_ = true;
+    boundClip_ = clip;
+    clipBinding_ = ClipBinding{};
+    // 前のクリップ・スケルトンで先読みした姿勢へ向かって補間しないよう、次の評価でクリップを評価し直す
+    isPoseHistoryValid_ = false;
+    if (!clip || clip->compressedTimelines.size() != clip->timelines.size()) return nullptr;
+    clipBinding_.timelines = &clip->compressedTimelines;
+
+    // タイムライン名の接尾辞からチャンネルを判別する（AnimationManager が付ける名前と対応）
+    struct ChannelSuffix {
+        std::string_view suffix;
+        KeyframeValueType valueType;
+        Channel channel;
+    };
+    static constexpr ChannelSuffix kChannelSuffixes[] = {
+        { ".Translate.X", KeyframeValueType::Float, Channel::TranslateX },
+        { ".Translate.Y", KeyframeValueType::Float, Channel::TranslateY },
+        { ".Translate.Z", KeyframeValueType::Float, Channel::TranslateZ },
+        { ".Scale.X", KeyframeValueType::Float, Channel::ScaleX },
+        { ".Scale.Y", KeyframeValueType::Float, Channel::ScaleY },
+        { ".Scale.Z", KeyframeValueType::Float, Channel::ScaleZ },
+        { ".Rotate", KeyframeValueType::Quaternion, Channel::Rotate },
+    };
+
+    for (uint32_t jointIndex = 0; jointIndex < skeleton_.joints.size(); ++jointIndex) {
+        const auto &joint = skeleton_.joints[jointIndex];
+        if (!joint.transform) continue;
+        auto it = clip->nodeNameToTimelineIndices.find(joint.name);
+        if (it == clip->nodeNameToTimelineIndices.end()) continue;
+
+        for (const uint32_t timelineIndex : it->second) {
+            if (timelineIndex >= clip->timelines.size()) continue;
+            const auto &timeline = clip->timelines[timelineIndex];
+            for (const auto &suffix : kChannelSuffixes) {
+                if (timeline.valueType != suffix.valueType || !timeline.name.ends_with(suffix.suffix)) continue;
+                clipBinding_.channels.push_back({ jointIndex, timelineIndex, suffix.channel, {} });
+                break;
+            }
+        }
+    }
+
+    for (const auto &timeline : clip->compressedTimelines) {
+        clipBinding_.endTime = std::max(clipBinding_.endTime, timeline.duration);
+    }
+    return &clipBinding_;
+}
+
+void SkeletonPoseEvaluator::Evaluate(ClipBinding *binding, AnimationLod lod, float time, float timeStep, bool loop, int reducedBoneDepth) {
+    if (binding && binding->timelines) {
+        switch (lod) {
+            case AnimationLod::HalfRate:
+                EvaluateThrottledPose(*binding, time, timeStep, loop, -1);
+                break;
+            case AnimationLod::ReducedBones:
+                EvaluateThrottledPose(*binding, time, timeStep, loop, reducedBoneDepth);
+                break;
+            default:
+                CapturePose(sampledPose_);
+                SampleClipBinding(*binding, time, loop, -1, sampledPose_);
+                ApplyPose(sampledPose_);
+                break;
+        }
+        isJointMatricesDirty_ = true;
+    }
+    if (isJointMatricesDirty_) UpdateJointMatrices();
+}
+
+void SkeletonPoseEvaluator::EvaluateThrottledPose(ClipBinding &binding, float time, float timeStep, bool loop, int maxDepth) {
+    if (!isPoseHistoryValid_ || framesUntilSample_ == 0) {
+        // 現在の姿勢を補間の始点にして、次にクリップを評価するフレームの時刻の姿勢を先読みしておく
+        uint32_t sampleInterval = kThrottledSampleInterval;
+        if (!isPoseHistoryValid_) {
+            // 評価するフレームが全インスタンスで揃わないよう、最初の間隔だけインスタンスごとにずらす
+            sampleInterval = 1 + static_cast<uint32_t>((reinterpret_cast<uintptr_t>(this) / alignof(SkeletonPoseEvaluator)) % kThrottledSampleInterval);
+        }
+        CapturePose(previousPose_);
+        sampledPose_ = previousPose_;
+        previousPoseTime_ = time - timeStep;
+        sampledPoseTime_ = time + timeStep * static_cast<float>(sampleInterval - 1);
+        SampleClipBinding(binding, sampledPoseTime_, loop, maxDepth, sampledPose_);
+        framesUntilSample_ = sampleInterval;
+        isPoseHistoryValid_ = true;
+    }
+    --framesUntilSample_;
+
+    const float span = sampledPoseTime_ - previousPoseTime_;
+    const float t = span > 0.0f ? std::clamp((time - previousPoseTime_) / span, 0.0f, 1.0f) : 1.0f;
+    for (size_t jointIndex = 0; jointIndex < skeleton_.joints.size(); ++jointIndex) {
+        if (maxDepth >= 0 && jointDepths_[jointIndex] > maxDepth) continue;
+        SkeletonTransform *transform = skeleton_.joints[jointIndex].transform.get();
+        if (!transform) continue;
+        const JointPose &from = previousPose_[jointIndex];
+        const JointPose &to = sampledPose_[jointIndex];
+        transform->SetTranslate(Vector3::Lerp(from.translate, to.translate, t));
+        transform->SetRotate(NlerpQuaternion(from.rotate, to.rotate, t));
+        transform->SetScale(Vector3::Lerp(from.scale, to.scale, t));
+    }
+}
+
+void SkeletonPoseEvaluator::UpdateJointMatrices() {
+    jointMatrices_.resize(skeleton_.joints.size());
+    for (const uint32_t jointIndex : jointEvaluationOrder_) {
+        const auto &joint = skeleton_.joints[jointIndex];
+        if (!joint.transform) {
+            jointMatrices_[jointIndex] = Matrix4x4::Identity();
+            continue;
+        }
+        // jointEvaluationOrder_ は親が先に来るため、親の行列は計算済み
+        const Matrix4x4 local = MakeJointLocalMatrix(*joint.transform);
+        jointMatrices_[jointIndex] = joint.parentIndex ? local * jointMatrices_[static_cast<size_t>(*joint.parentIndex)] : local;
+    }
+    isJointMatricesDirty_ = false;
+}
+
+const std::vector<Matrix4x4> &SkeletonPoseEvaluator::GetJointMatrices() {
+    if (isJointMatricesDirty_) UpdateJointMatrices();
+    return jointMatrices_;
+}
+
+void SkeletonPoseEvaluator::ResetToBindPose() {
+    for (auto &joint : skeleton_.joints) {
+        if (auto *t = joint.transform.get()) t->ResetToBindPose();
+        if (auto *t = joint.skeletonSpaceTransform.get()) t->ResetToBindPose();
+    }
+    isJointMatricesDirty_ = true;
+    isPoseHistoryValid_ = false;
+}
+
+void SkeletonPoseEvaluator::SampleClipBinding(ClipBinding &binding, float time, bool loop, int maxDepth, std::vector<JointPose> &pose) const {
+    const auto &timelines = *binding.timelines;
+    auto &channels = binding.channels;
+
+    // channels はジョイント順に並んでいるため、同じジョイントの連続した区間ごとにまとめて書き込む
+    for (size_t begin = 0; begin < channels.size();) {
+        const uint32_t jointIndex = channels[begin].jointIndex;
+        size_t end = begin;
+        while (end < channels.size() && channels[end].jointIndex == jointIndex) ++end;
+        if (maxDepth >= 0 && jointDepths_[jointIndex] > maxDepth) {
+            begin = end;
+            continue;
+        }
+
+        JointPose &joint = pose[jointIndex];
+        for (; begin < end; ++begin) {
+            auto &channel = channels[begin];
+            const auto &timeline = timelines[channel.timelineIndex];
+            switch (channel.channel) {
+                case Channel::TranslateX: joint.translate.x = SampleCompressedFloat(timeline, time, loop, channel.cursor); break;
+                case Channel::TranslateY: joint.translate.y = SampleCompressedFloat(timeline, time, loop, channel.cursor); break;
+                case Channel::TranslateZ: joint.translate.z = SampleCompressedFloat(timeline, time, loop, channel.cursor); break;
+                case Channel::ScaleX: joint.scale.x = SampleCompressedFloat(timeline, time, loop, channel.cursor); break;
+                case Channel::ScaleY: joint.scale.y = SampleCompressedFloat(timeline, time, loop, channel.cursor); break;
+                case Channel::ScaleZ: joint.scale.z = SampleCompressedFloat(timeline, time, loop, channel.cursor); break;
+                case Channel::Rotate: joint.rotate = SampleCompressedQuaternion(timeline, time, loop, channel.cursor); break;
+            }
+        }
+    }
+}
+
+void SkeletonPoseEvaluator::CapturePose(std::vector<JointPose> &pose) const {
+    pose.resize(skeleton_.joints.size());
+    for (size_t jointIndex = 0; jointIndex < pose.size(); ++jointIndex) {
+        const SkeletonTransform *transform = skeleton_.joints[jointIndex].transform.get();
+        if (!transform) continue;
+        pose[jointIndex] = { transform->GetTranslate(), transform->GetRotate(), transform->GetScale() };
+    }
+}
+
+void SkeletonPoseEvaluator::ApplyPose(const std::vector<JointPose> &pose) {
+    for (size_t jointIndex = 0; jointIndex < pose.size(); ++jointIndex) {
+        SkeletonTransform *transform = skeleton_.joints[jointIndex].transform.get();
+        if (!transform) continue;
+        transform->SetTranslate(pose[jointIndex].translate);
+        transform->SetRotate(pose[jointIndex].rotate);
+        transform->SetScale(pose[jointIndex].scale);
+    }
+}
+
+} // namespace KashipanEngine
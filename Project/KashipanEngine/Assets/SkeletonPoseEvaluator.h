@@ -0,0 +1,145 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include "Assets/AnimationClipCompression.h"
+#include "Assets/SkeletonManager.h"
+#include "Math/Matrix4x4.h"
+
+namespace KashipanEngine {
+
+struct AnimationClip;
+
+/// @brief アニメーションLOD（姿勢の評価をどこまで間引くか）
+enum class AnimationLod {
+    /// @brief LOD基準オブジェクトからの距離・視野に応じて以下の段階を自動で選ぶ
+    Auto = 0,
+    /// @brief 毎フレーム全ジョイントを評価する
+    Full,
+    /// @brief 2フレームに1度だけクリップを評価し、間のフレームは前後の姿勢を補間する
+    HalfRate,
+    /// @brief HalfRate に加え、階層の深いジョイント（指先等）の評価を止める
+    ReducedBones,
+    /// @brief 再生時間だけを進め、姿勢の評価を止める
+    Frozen,
+};
+
+/// @brief スケルトンインスタンス1体分の姿勢評価
+/// @details クリップのサンプリング、間引き評価（HalfRate / ReducedBones）の補間、ジョイント行列の計算を受け持つ。
+///          Animator が1つずつ保持し、一括更新のジョブから Evaluate を呼ぶ。書き込むのは自身が保持する
+///          スケルトンと姿勢バッファだけで、シーンやアセット管理には触れないため、インスタンス単位で並列に評価できる
+class SkeletonPoseEvaluator final {
+public:
+    /// @brief タイムラインが駆動するジョイントのチャンネル
+    enum class Channel : uint8_t {
+        TranslateX,
+        TranslateY,
+        TranslateZ,
+        ScaleX,
+        ScaleY,
+        ScaleZ,
+        Rotate,
+    };
+
+    /// @brief クリップのタイムライン1本をスケルトンのジョイントへ対応付けた結果
+    struct ChannelBinding {
+        uint32_t jointIndex = 0;
+        uint32_t timelineIndex = 0;
+        Channel channel = Channel::TranslateX;
+        /// @brief 前回サンプリングしたキー位置（再生が前へ進む間はキーの探索を省く）
+        TimelineCursor cursor;
+    };
+
+    /// @brief クリップ1つ分のバインディング
+    /// @details channels はジョイント順に並べてあり、毎フレームの適用は文字列操作を行わずにこの配列を走査するだけで済む
+    struct ClipBinding {
+        /// @brief クリップの圧縮済みタイムライン（nullptr の場合はバインディングが無い）
+        const std::vector<CompressedTimeline> *timelines = nullptr;
+        std::vector<ChannelBinding> channels;
+        /// @brief 全タイムラインのうち最も遅い終了時刻（ループしない再生の終了判定用）
+        float endTime = 0.0f;
+    };
+
+    /// @brief 評価するスケルトンを設定し、ジョイント行列の計算順と階層の深さを求め直す
+    /// @details 保持しているクリップのバインディングは古いスケルトンのジョイント番号を指すため、次の BindClip で作り直す
+    void SetSkeleton(Skeleton skeleton);
+    const Skeleton &GetSkeleton() const noexcept { return skeleton_; }
+    Skeleton &GetSkeleton() noexcept { return skeleton_; }
+    /// @brief ジョイントの階層の深さ（ルートジョイントが0）
+    int GetJointDepth(size_t jointIndex) const { return jointDepths_[jointIndex]; }
+
+    /// @brief クリップのタイムラインを現在のスケルトンのジョイントへ対応付けたバインディングを返す
+    /// @details 一度解決したバインディングを保持し、同じクリップが渡される間はそれを返す（毎フレームの文字列照合を避ける）。
+    ///          前回と異なるクリップが渡された場合と、SetSkeleton・InvalidateClipBinding の後は作り直す
+    /// @return clip が nullptr の場合・キーが圧縮されていない場合は nullptr
+    ClipBinding *BindClip(const AnimationClip *clip);
+    /// @brief 保持しているバインディングを捨て、次の BindClip で作り直す（同じクリップのアセットを読み直した場合等）
+    void InvalidateClipBinding() noexcept { isClipBindingValid_ = false; }
+
+    /// @brief クリップを評価してスケルトンの姿勢を更新し、ジョイント行列を計算し直す
+    /// @param binding 評価するクリップ（nullptr の場合は姿勢を変えず、ジョイント行列の計算が残っていれば計算だけ行う）
+    /// @param lod 評価の段階（Auto・Frozen は Full と同じく毎フレーム評価する。Frozen で止める場合は binding を渡さない）
+    /// @param time 今回のフレームの再生時刻
+    /// @param timeStep 今回のフレームで進めた再生時間（間引き評価で先読みする時刻の計算に使う）
+    /// @param reducedBoneDepth ReducedBones で評価を続けるジョイント階層の深さ
+    void Evaluate(ClipBinding *binding, AnimationLod lod, float time, float timeStep, bool loop, int reducedBoneDepth);
+
+    /// @brief 間引き評価で補間に使う前後の姿勢を捨て、次の評価でクリップを評価し直す
+    void InvalidatePoseHistory() noexcept { isPoseHistoryValid_ = false; }
+    /// @brief ジョイント行列が現在の姿勢に対して古いか
+    bool IsJointMatricesDirty() const noexcept { return isJointMatricesDirty_; }
+    /// @brief 各ジョイントのスケルトン空間行列（スケルトンのジョイントと同じ並び）。古い場合はその場で計算する
+    const std::vector<Matrix4x4> &GetJointMatrices();
+
+    /// @brief 全ジョイントをバインドポーズへ戻す
+    void ResetToBindPose();
+
+private:
+    /// @brief ジョイント1つ分のローカルTRS（補間用に保持する姿勢）
+    struct JointPose {
+        Vector3 translate = Vector3::Zero();
+        Quaternion rotate = Quaternion::Identity();
+        Vector3 scale = { 1.0f, 1.0f, 1.0f };
+    };
+
+    /// @brief 間引き評価の段階で、先読みした姿勢と直前の姿勢を補間してスケルトンへ書き込む
+    void EvaluateThrottledPose(ClipBinding &binding, float time, float timeStep, bool loop, int maxDepth);
+    /// @brief ジョイントを親から順に辿り、スケルトン空間行列を計算し直す
+    void UpdateJointMatrices();
+    /// @brief バインディングに従ってクリップの指定時刻の姿勢を pose へ書き込む
+    /// @param maxDepth これより深い階層のジョイントは書き込まない（負の場合は全ジョイント）
+    /// @details タイムラインを持たないチャンネルは pose の値をそのまま残す
+    void SampleClipBinding(ClipBinding &binding, float time, bool loop, int maxDepth, std::vector<JointPose> &pose) const;
+    /// @brief 現在のスケルトンのローカルTRSを pose へ読み取る
+    void CapturePose(std::vector<JointPose> &pose) const;
+    /// @brief pose の全ジョイントをスケルトンへ書き込む
+    void ApplyPose(const std::vector<JointPose> &pose);
+
+    Skeleton skeleton_{};
+    /// @brief 親が子より先に来るジョイントの並び（ジョイント行列の計算順）
+    std::vector<uint32_t> jointEvaluationOrder_;
+    /// @brief ジョイントごとの階層の深さ（ルートジョイントが0）
+    std::vector<int> jointDepths_;
+    /// @brief ジョイントごとのスケルトン空間行列
+    std::vector<Matrix4x4> jointMatrices_;
+    bool isJointMatricesDirty_ = true;
+
+    // 間引き評価用の姿勢バッファ
+    std::vector<JointPose> previousPose_;
+    std::vector<JointPose> sampledPose_;
+    float previousPoseTime_ = 0.0f;
+    float sampledPoseTime_ = 0.0f;
+    /// @brief 次にクリップを評価するまでのフレーム数（0 で評価する）
+    uint32_t framesUntilSample_ = 0;
+    /// @brief previousPose_ / sampledPose_ が現在のクリップ・LODのものか
+    bool isPoseHistoryValid_ = false;
+
+    // BindClip で解決したバインディング
+    ClipBinding clipBinding_;
+    /// @brief clipBinding_ を解決したクリップ
+    const AnimationClip *boundClip_ = nullptr;
+    /// @brief clipBinding_ が boundClip_ と現在のスケルトンのものか
+    bool isClipBindingValid_ = false;
+};
+
+} // namespace KashipanEngine
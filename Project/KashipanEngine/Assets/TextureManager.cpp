@@ -289,7 +289,7 @@ void TextureManager::LoadAllFromAssetsFolder() {
     flatten(filtered);
 
     // ファイルI/O・デコード・ミップマップ生成はCPU処理のみでGPUリソースに触れないため、
-    // スレッドプールで並列実行する（mipMapContainer_はshared_mutexで保護済み）
+    // ジョブシステムで並列実行する（mipMapContainer_はshared_mutexで保護済み）
     Plugin::RunParallelAndWait(files.size(), [this, &files](size_t i) {
         mipMapContainer_.AddMipMap(files[i], LoadTextureFromFile(files[i]));
         });
@@ -22,8 +22,7 @@ std::unordered_map<size_t, bool> &GetObjectComponentBatchProcessedMap() {
     return batchProcessedMap;
 }
 /// @brief バッチ処理対象として登録された型の数（0であればRegenerateUpdateComponentsList側で
-///        型ごとのハッシュ検索そのものを丸ごと省略できる。isBatchProcessed=trueの型が
-///        1つも無い今の時点では常に0になる）
+///        型ごとのハッシュ検索そのものを丸ごと省略できる）
 size_t &GetBatchProcessedTypeCount() {
     static size_t count = 0;
     return count;
@@ -62,9 +61,12 @@ bool RegisterComponentTypeObject(
     std::function<std::unique_ptr<IObjectComponent>()> createFunc,
     std::function<std::unique_ptr<IComponentPoolBase>()> poolFactory,
     bool isBatchProcessed,
+    void (*registerMemberVariables)(),
     const std::vector<std::string> &category) {
     auto &factoryMap = Local::GetObjectComponentFactoryMap();
     if (factoryMap.find(typeName) != factoryMap.end()) return false;
+    // メンバー変数表は型ごとに1回だけ作る（以降のGetMemberVariable等は読み取りのみ）
+    if (registerMemberVariables) registerMemberVariables();
     factoryMap[typeName] = createFunc;
     Local::GetObjectComponentPoolFactoryMap()[typeID] = poolFactory;
     Local::GetObjectComponentBatchProcessedMap()[typeID] = isBatchProcessed;
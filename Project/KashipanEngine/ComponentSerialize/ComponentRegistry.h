@@ -30,12 +30,15 @@ bool RegisterComponentTypeScene(const std::string &typeName, std::function<std::
 /// @param createFunc 型名からデタッチされたunique_ptrインスタンスを生成するファクトリ（JSON等からの状態転送元として使用）
 /// @param poolFactory その型専用の空のComponentPool<T>を生成するファクトリ
 /// @param isBatchProcessed ComponentBatchTraits<T>::kIsBatchProcessed の値
+/// @param registerMemberVariables その型のメンバー変数表を作る関数（IObjectComponent::RegisterMemberVariableTable<T>）。
+///                                型ごとに最初の登録時だけ呼ばれる
 bool RegisterComponentTypeObject(
     const std::string &typeName,
     size_t typeID,
     std::function<std::unique_ptr<IObjectComponent>()> createFunc,
     std::function<std::unique_ptr<IComponentPoolBase>()> poolFactory,
     bool isBatchProcessed,
+    void (*registerMemberVariables)(),
     const std::vector<std::string> &category = {});
 
 std::unique_ptr<ISceneComponent> CreateSceneComponentByType(const std::string &typeName);
@@ -76,6 +79,7 @@ const std::vector<std::string> &GetObjectComponentCategory(const std::string &ty
         []() -> std::unique_ptr<IObjectComponent> { return std::make_unique<ComponentClass>(); }, \
         []() -> std::unique_ptr<IComponentPoolBase> { return std::make_unique<ComponentPool<ComponentClass>>(); }, \
         ComponentBatchTraits<ComponentClass>::kIsBatchProcessed, \
+        &IObjectComponent::RegisterMemberVariableTable<ComponentClass>, \
         ComponentCategoryOf<ComponentClass>::Get() \
     );
 
@@ -0,0 +1,66 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include "Math/Vector2.h"
+#include "Math/Vector3.h"
+#include "Math/Vector4.h"
+#include "Math/Quaternion.h"
+#include "Math/Color.h"
+
+namespace KashipanEngine {
+
+/// @brief ToJSON で保存した値と、メモリ上の値の並びとの対応
+/// @details バイナリシーンの列（SceneBinaryFormat.h）からメンバー変数へ、JSONを経由せずに書き込む際に使う。
+///          Vector3 等の ToJSON がキーごとに float を並べたオブジェクトとして保存する型は、
+///          fieldKeys[i] の値がメモリ上の i 番目の float になる
+struct SerializedLayout {
+    enum class Scalar : std::uint8_t {
+        /// @brief 直接書き込めない型（JSONを経由して読み込む）
+        None,
+        Bool,
+        Int32,
+        UInt32,
+        Float,
+        String,
+    };
+
+    Scalar scalar = Scalar::None;
+    /// @brief 要素のキー（メモリ上の並び順。単体の値の場合は0個）
+    std::array<const char *, 4> fieldKeys{};
+    std::uint8_t fieldCount = 0;
+};
+
+/// @brief 型Tの保存時の並びを求める（JSON.h の ToJSON と対応させること）
+template <typename T>
+constexpr SerializedLayout GetSerializedLayout() {
+    using Scalar = SerializedLayout::Scalar;
+    if constexpr (std::is_same_v<T, bool>) {
+        return { Scalar::Bool };
+    } else if constexpr (std::is_same_v<T, std::int32_t>) {
+        return { Scalar::Int32 };
+    } else if constexpr (std::is_same_v<T, std::uint32_t>) {
+        return { Scalar::UInt32 };
+    } else if constexpr (std::is_same_v<T, float>) {
+        return { Scalar::Float };
+    } else if constexpr (std::is_same_v<T, std::string>) {
+        return { Scalar::String };
+    } else if constexpr (std::is_same_v<T, Vector2>) {
+        static_assert(sizeof(Vector2) == sizeof(float) * 2);
+        return { Scalar::Float, { "x", "y" }, 2 };
+    } else if constexpr (std::is_same_v<T, Vector3>) {
+        static_assert(sizeof(Vector3) == sizeof(float) * 3);
+        return { Scalar::Float, { "x", "y", "z" }, 3 };
+    } else if constexpr (std::is_same_v<T, Vector4> || std::is_same_v<T, Quaternion>) {
+        static_assert(sizeof(T) == sizeof(float) * 4);
+        return { Scalar::Float, { "x", "y", "z", "w" }, 4 };
+    } else if constexpr (std::is_same_v<T, Color>) {
+        static_assert(sizeof(Color) == sizeof(float) * 4);
+        return { Scalar::Float, { "r", "g", "b", "a" }, 4 };
+    } else {
+        return {};
+    }
+}
+
+} // namespace KashipanEngine
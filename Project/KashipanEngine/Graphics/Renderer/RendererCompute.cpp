@@ -250,7 +250,8 @@ void Renderer::ProcessGpuParticles(SceneContext *sceneContext) {
     const float deltaTime = GetDeltaTime();
 
     for (auto *emitter : emitters) {
-        if (!emitter || !emitter->IsActive()) continue;
+        // オブジェクトを使わないCPU Simulationのエミッターも描画のために登録されているため除外する
+        if (!emitter || !emitter->IsActive() || !emitter->IsGPUSimulation()) continue;
         // このフレームにコンポーネントのUpdateが実行されていない（＝シーンがポーズ/停止中の）場合は
         // シミュレーションを進めない。ポーズ中もRenderFrame自体は毎フレーム走るため、ここでゲートしないと
         // GPUパーティクルだけが実時間で動き続けてしまう
@@ -348,9 +348,9 @@ void Renderer::RenderGpuParticles(IRenderTarget *target, PipelineBinder &pipelin
         const auto *meshBuffers = resourceContainer_->GetOrCreateMeshBuffers(meshHandle);
         if (!meshBuffers || !meshBuffers->vertexBuffer || !meshBuffers->indexBuffer) continue;
 
-        auto *instanceMatrixBuffer = emitter->GetGpuInstanceMatrixBuffer(Passkey<Renderer>{});
+        auto *instanceMatrixBuffer = emitter->GetInstanceMatrixBuffer(Passkey<Renderer>{});
         if (!instanceMatrixBuffer) continue;
-        const std::uint32_t instanceCount = emitter->GetGpuParticleCapacity(Passkey<Renderer>{});
+        const std::uint32_t instanceCount = emitter->GetInstanceCount(Passkey<Renderer>{});
         if (instanceCount == 0) continue;
 
         pipelineBinder.UsePipeline(pipelineName);
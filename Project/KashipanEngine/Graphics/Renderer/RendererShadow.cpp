@@ -104,7 +104,7 @@ void Renderer::RenderShadowMaps(SceneContext *sceneContext, SceneRenderer *scene
             up.x, up.y, up.z, 0.0f,
             forward.x, forward.y, forward.z, 0.0f,
             eye.x, eye.y, eye.z, 1.0f);
-        return world.Inverse();
+        return world.InverseAffine();
     };
 
     //--------- 描画先ごとに「その描画先で使うカメラ・ライト」から影ジョブを構築する ---------//
@@ -568,13 +568,14 @@ void Renderer::RenderShadowMaps(SceneContext *sceneContext, SceneRenderer *scene
     }
 
     //--------- GPUパーティクルの影キャスターを収集する ---------//
-    // GPUパーティクルは通常描画（RenderGpuParticles）と同じ考え方で、CPU側にワールド行列を
-    // 持たない（gpuInstanceMatrixBuffer_をそのままgTransformationMatricesとしてバインドする）。
+    // GPUパーティクルは通常描画（RenderGpuParticles）と同じ考え方で、エミッターが持つ
+    // インスタンス行列バッファ（GPU Simulationならコンピュートシェーダーの出力、オブジェクトを
+    // 使わないCPU Simulationなら生存分を書き出したバッファ）をそのままgTransformationMatricesとしてバインドする。
     // マテリアルはエミッター全体で1つのため、instanceCount分だけ複製したバッファを用意する
     // （通常のMeshRenderer由来バッチと違い、他のエミッターとまとめてインスタンシングはできない）
     struct PreparedGpuParticleShadowBatch {
         const ResourceContainer::MeshBuffers *meshBuffers = nullptr;
-        RWStructuredBufferResource *transformBuffer = nullptr;
+        IGraphicsResource *transformBuffer = nullptr;
         StructuredBufferResource *materialBuffer = nullptr;
         std::uint32_t textureHandle = TextureManager::kInvalidHandle;
         SamplerManager::SamplerHandle samplerHandle = SamplerManager::kInvalidHandle;
@@ -584,16 +585,16 @@ void Renderer::RenderShadowMaps(SceneContext *sceneContext, SceneRenderer *scene
     {
         std::uint32_t emitterIndex = 0;
         for (auto *emitter : sceneRenderer->GetGpuParticleEmitters()) {
-            if (!emitter || !emitter->IsActive() || !emitter->IsGPUSimulation() || !emitter->GetCastShadows()) continue;
+            if (!emitter || !emitter->IsActive() || !emitter->GetCastShadows()) continue;
 
             const auto meshHandle = emitter->GetMeshHandle();
             if (meshHandle == ModelManager::kInvalidHandle) continue;
             const auto *meshBuffers = resourceContainer_->GetOrCreateMeshBuffers(meshHandle);
             if (!meshBuffers || !meshBuffers->vertexBuffer || !meshBuffers->indexBuffer) continue;
 
-            auto *instanceMatrixBuffer = emitter->GetGpuInstanceMatrixBuffer(Passkey<Renderer>{});
+            auto *instanceMatrixBuffer = emitter->GetInstanceMatrixBuffer(Passkey<Renderer>{});
             if (!instanceMatrixBuffer) continue;
-            const std::uint32_t instanceCount = emitter->GetGpuParticleCapacity(Passkey<Renderer>{});
+            const std::uint32_t instanceCount = emitter->GetInstanceCount(Passkey<Renderer>{});
             if (instanceCount == 0) continue;
 
             PreparedGpuParticleShadowBatch batch;
@@ -716,8 +717,9 @@ void Renderer::RenderShadowMaps(SceneContext *sceneContext, SceneRenderer *scene
 
                 pipelineBinder.SetVertexBuffer(batch.meshBuffers->vertexBuffer.get(), sizeof(ResourceContainer::MeshVertex));
                 pipelineBinder.SetIndexBuffer(batch.meshBuffers->indexBuffer.get());
-                // 死んでいるパーティクルはgpuInstanceMatrixBuffer_内でスケール0の行列になっているため、
+                // GPU Simulationでは死んでいるパーティクルがスケール0の行列になっているため、
                 // 追加のカリング無しでcapacity件（常にMax Particles分）そのままインスタンス描画する
+                // （CPU Simulationは生存数だけ）
                 commandList->DrawIndexedInstanced(batch.meshBuffers->indexCount, batch.instanceCount, 0, 0, 0);
                 ++drawCallCount_;
             }
@@ -12,8 +12,13 @@
 #include "Utilities/Plugin/Plugins.h"
 #include "Utilities/Translation.h"
 
+#include <objbase.h>
+
 namespace KashipanEngine {
 namespace {
+/// @brief ジョブシステムのワーカースレッドでCOMの初期化に成功したか（終了時の対応するCoUninitialize用）
+thread_local bool isWorkerComInitialized = false;
+
 /// @brief スプラッシュ画面のRAIIガード
 /// @details GameEngineのコンストラクタが例外を投げた場合でも、スコープを抜ける際に
 ///          確実にスプラッシュを閉じてスレッドを回収できるようにする
@@ -71,23 +76,38 @@ int Execute(PasskeyForWinMain winMainPasskey, const std::string &engineSettingsP
     LoadEngineSettings({}, resolvedEngineSettingsPath);
 
 	// --------- プラグインの初期化 ---------//
-	Plugin::ThreadPool threadPool;
-	Plugin::PriorityTaskDispatcher taskDispatcher(
-		[&threadPool](const std::function<void()>& task) {
-			return threadPool.AddTask(task);
+	// COMはスレッドごと（アパートメントごと）の初期化が必要なため、各ワーカースレッドの生存期間中ずっと
+	// 有効なCOM初期化をワーカーの開始時に行う。メインスレッドと同じくMTAへ参加させる
+	// （テクスチャデコード(WIC)や音声デコード(Media Foundation)、モデル読み込み(Assimp)の
+	// ジョブをワーカースレッドで実行できるようにするため）
+	Plugin::JobSystem jobSystem(
+		Plugin::JobSystem::GetDefaultWorkerCount(),
+		[]() {
+			isWorkerComInitialized = SUCCEEDED(CoInitializeEx(nullptr, COINIT_MULTITHREADED));
 		},
-		[&threadPool]() {
-			return threadPool.HasIdleThread();
+		[]() {
+			if (isWorkerComInitialized) CoUninitialize();
+		},
+		// 完了を待つ側のいないジョブ（addAsyncTask等）の例外は、ワーカーを止めずにログへ残す
+		[](std::exception_ptr exception) {
+			try {
+				std::rethrow_exception(exception);
+			} catch (const std::exception& e) {
+				Log(Translation("engine.jobsystem.unhandledexception") + e.what(), LogSeverity::Error);
+			} catch (...) {
+				Log(Translation("engine.jobsystem.unhandledexception") + "unknown", LogSeverity::Error);
+			}
 		}
 	);
-    Plugin::addAsyncTask = [&taskDispatcher](const std::function<void()>& task,int priority) {
-        taskDispatcher.AddTask(task, priority);
+	Plugin::jobSystem = &jobSystem;
+    Plugin::addAsyncTask = [&jobSystem](const std::function<void()>& task, int priority) {
+        jobSystem.Schedule(task, Plugin::ToJobPriority(priority));
 		};
-	Plugin::executeAsyncTasks = [&taskDispatcher]() {
-		taskDispatcher.ExecuteTasks();
+	Plugin::executeAsyncTasks = [&jobSystem]() {
+		jobSystem.RunPendingJob();
 		};
-	Plugin::hasAsyncTasks = [&taskDispatcher]() {
-		return taskDispatcher.HasTasks();
+	Plugin::hasAsyncTasks = [&jobSystem]() {
+		return jobSystem.HasPendingJobs();
 		};
 
     //--------- エンジン実行 ---------//
@@ -109,6 +129,12 @@ int Execute(PasskeyForWinMain winMainPasskey, const std::string &engineSettingsP
     // すべて終わったこの時点で新しいプロセスを起動する
     ProjectManager::LaunchPendingRestart({});
 
+    // ジョブシステムはこの関数を抜けると破棄されるため、グローバルな参照を外しておく
+    Plugin::addAsyncTask = nullptr;
+    Plugin::executeAsyncTasks = nullptr;
+    Plugin::hasAsyncTasks = nullptr;
+    Plugin::jobSystem = nullptr;
+
     ShutdownLogger({});
     return code;
 }
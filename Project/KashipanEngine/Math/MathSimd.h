@@ -0,0 +1,97 @@
+#pragma once
+
+// 行列・ベクトル演算のSIMDバックエンドをコンパイル時に選択する
+// - KASHIPAN_MATH_SIMD_SSE : SSE2（x64では常に有効）。4x4行列の1行を1レジスタで扱う
+// - KASHIPAN_MATH_SIMD_FMA : /arch:AVX2（-mavx2 -mfma）でビルドした場合のみ、積和をFMA命令で行う
+// KASHIPAN_MATH_NO_SIMD を定義すると、従来のスカラー実装のみを使う（結果の比較用）
+#if !defined(KASHIPAN_MATH_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define KASHIPAN_MATH_SIMD_SSE 1
+#if defined(__AVX2__) && (defined(__FMA__) || defined(_MSC_VER))
+#define KASHIPAN_MATH_SIMD_FMA 1
+#endif
+#endif
+
+#if defined(KASHIPAN_MATH_SIMD_SSE)
+#include <immintrin.h>
+
+namespace KashipanEngine {
+namespace MathSimd {
+
+#define KASHIPAN_MATH_SHUFFLE_MASK(x, y, z, w) ((x) | ((y) << 2) | ((z) << 4) | ((w) << 6))
+
+/// @brief a * b + c
+inline __m128 MulAdd(__m128 a, __m128 b, __m128 c) noexcept {
+#if defined(KASHIPAN_MATH_SIMD_FMA)
+    return _mm_fmadd_ps(a, b, c);
+#else
+    return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif
+}
+
+/// @brief 1要素を全レーンへ複製する
+template <int Lane>
+inline __m128 Splat(__m128 v) noexcept {
+    return _mm_shuffle_ps(v, v, KASHIPAN_MATH_SHUFFLE_MASK(Lane, Lane, Lane, Lane));
+}
+
+/// @brief 行ベクトル row と行列の積（row.x * m[0] + row.y * m[1] + row.z * m[2] + row.w * m[3]）
+inline __m128 RowTransform(__m128 row, __m128 m0, __m128 m1, __m128 m2, __m128 m3) noexcept {
+    __m128 result = _mm_mul_ps(Splat<0>(row), m0);
+    result = MulAdd(Splat<1>(row), m1, result);
+    result = MulAdd(Splat<2>(row), m2, result);
+    return MulAdd(Splat<3>(row), m3, result);
+}
+
+/// @brief 4x4行列の積 out = a * b（out は a・b と同じ領域でもよい）
+inline void Multiply(const float (&a)[4][4], const float (&b)[4][4], float (&out)[4][4]) noexcept {
+    const __m128 b0 = _mm_loadu_ps(b[0]);
+    const __m128 b1 = _mm_loadu_ps(b[1]);
+    const __m128 b2 = _mm_loadu_ps(b[2]);
+    const __m128 b3 = _mm_loadu_ps(b[3]);
+    const __m128 r0 = RowTransform(_mm_loadu_ps(a[0]), b0, b1, b2, b3);
+    const __m128 r1 = RowTransform(_mm_loadu_ps(a[1]), b0, b1, b2, b3);
+    const __m128 r2 = RowTransform(_mm_loadu_ps(a[2]), b0, b1, b2, b3);
+    const __m128 r3 = RowTransform(_mm_loadu_ps(a[3]), b0, b1, b2, b3);
+    _mm_storeu_ps(out[0], r0);
+    _mm_storeu_ps(out[1], r1);
+    _mm_storeu_ps(out[2], r2);
+    _mm_storeu_ps(out[3], r3);
+}
+
+/// @brief 単位クォータニオン (x, y, z, w) から回転行列の上3行を作る（各行の w 成分は0）
+inline void QuaternionToRows(float x, float y, float z, float w, __m128 &row0, __m128 &row1, __m128 &row2) noexcept {
+    const __m128 q = _mm_setr_ps(x, y, z, w);
+    const __m128 q2 = _mm_add_ps(q, q);
+    // 対角: (1 - 2(yy + zz), 1 - 2(xx + zz), 1 - 2(xx + yy))
+    const __m128 q_yxx = _mm_shuffle_ps(q, q, KASHIPAN_MATH_SHUFFLE_MASK(1, 0, 0, 3));
+    const __m128 q2_yxx = _mm_shuffle_ps(q2, q2, KASHIPAN_MATH_SHUFFLE_MASK(1, 0, 0, 3));
+    const __m128 q_zzy = _mm_shuffle_ps(q, q, KASHIPAN_MATH_SHUFFLE_MASK(2, 2, 1, 3));
+    const __m128 q2_zzy = _mm_shuffle_ps(q2, q2, KASHIPAN_MATH_SHUFFLE_MASK(2, 2, 1, 3));
+    const __m128 diag = _mm_sub_ps(_mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(q_yxx, q2_yxx)), _mm_mul_ps(q_zzy, q2_zzy));
+    // 非対角: a = 2(xy, xz, yz), b = 2w(z, y, x)
+    const __m128 q_xxy = _mm_shuffle_ps(q, q, KASHIPAN_MATH_SHUFFLE_MASK(0, 0, 1, 3));
+    const __m128 q2_yzz = _mm_shuffle_ps(q2, q2, KASHIPAN_MATH_SHUFFLE_MASK(1, 2, 2, 3));
+    const __m128 a = _mm_mul_ps(q_xxy, q2_yzz);
+    const __m128 b = _mm_mul_ps(Splat<3>(q), _mm_shuffle_ps(q2, q2, KASHIPAN_MATH_SHUFFLE_MASK(2, 1, 0, 3)));
+    const __m128 sum = _mm_add_ps(a, b);   // (xy + wz, xz + wy, yz + wx) * 2
+    const __m128 diff = _mm_sub_ps(a, b);  // (xy - wz, xz - wy, yz - wx) * 2
+
+    // row0 = (diag0, sum0, diff1, 0)
+    // row1 = (diff0, diag1, sum2, 0)
+    // row2 = (sum1, diff2, diag2, 0)
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 d0s0 = _mm_unpacklo_ps(diag, sum);                                                // (diag0, sum0, diag1, sum1)
+    const __m128 f1z = _mm_shuffle_ps(diff, zero, KASHIPAN_MATH_SHUFFLE_MASK(1, 1, 0, 0));         // (diff1, diff1, 0, 0)
+    row0 = _mm_shuffle_ps(d0s0, f1z, KASHIPAN_MATH_SHUFFLE_MASK(0, 1, 0, 2));
+    const __m128 f0d1 = _mm_shuffle_ps(diff, diag, KASHIPAN_MATH_SHUFFLE_MASK(0, 0, 1, 1));        // (diff0, diff0, diag1, diag1)
+    const __m128 s2z = _mm_shuffle_ps(sum, zero, KASHIPAN_MATH_SHUFFLE_MASK(2, 2, 0, 0));          // (sum2, sum2, 0, 0)
+    row1 = _mm_shuffle_ps(f0d1, s2z, KASHIPAN_MATH_SHUFFLE_MASK(0, 2, 0, 2));
+    const __m128 s1f2 = _mm_shuffle_ps(sum, diff, KASHIPAN_MATH_SHUFFLE_MASK(1, 1, 2, 2));         // (sum1, sum1, diff2, diff2)
+    const __m128 d2z = _mm_shuffle_ps(diag, zero, KASHIPAN_MATH_SHUFFLE_MASK(2, 2, 0, 0));         // (diag2, diag2, 0, 0)
+    row2 = _mm_shuffle_ps(s1f2, d2z, KASHIPAN_MATH_SHUFFLE_MASK(0, 2, 0, 2));
+}
+
+} // namespace MathSimd
+} // namespace KashipanEngine
+
+#endif
@@ -109,6 +109,10 @@ Matrix4x4 Matrix4x4::Inverse() const {
     return KashipanEngine::MathUtils::Matrix4x4Inverse(*this);
 }
 
+Matrix4x4 Matrix4x4::InverseAffine() const {
+    return KashipanEngine::MathUtils::Matrix4x4InverseAffine(*this);
+}
+
 void Matrix4x4::MakeIdentity() noexcept {
     *this = KashipanEngine::MathUtils::Matrix4x4Identity();
 }
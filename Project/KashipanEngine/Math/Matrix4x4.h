@@ -1,4 +1,7 @@
 #pragma once
+#include <type_traits>
+
+#include "Math/MathSimd.h"
 
 struct Vector3;
 
@@ -77,6 +80,11 @@ struct Matrix4x4 final {
     /// @return 逆行列
     [[nodiscard]] Matrix4x4 Inverse() const;
 
+    /// @brief アフィン変換行列（4列目が (0, 0, 0, 1)）の逆行列を計算する
+    /// @details 一般の逆行列より高速。ワールド行列からのビュー行列の生成等に使う（射影行列には使えない）
+    /// @return 逆行列
+    [[nodiscard]] Matrix4x4 InverseAffine() const;
+
     /// @brief 自身を単位行列にする
     void MakeIdentity() noexcept;
 
@@ -202,6 +210,14 @@ inline constexpr const Matrix4x4 Matrix4x4::operator*(const float scalar) const
 }
 
 inline constexpr const Matrix4x4 Matrix4x4::operator*(const Matrix4x4 &matrix) const noexcept {
+#if defined(KASHIPAN_MATH_SIMD_SSE)
+    // 定数式の評価時以外はSIMDで1行ずつ計算する
+    if (!std::is_constant_evaluated()) {
+        Matrix4x4 result;
+        KashipanEngine::MathSimd::Multiply(m, matrix.m, result.m);
+        return result;
+    }
+#endif
     // 少しでも速度を稼ぐためにループではなく展開する
     return Matrix4x4(
         m[0][0] * matrix.m[0][0] + m[0][1] * matrix.m[1][0] + m[0][2] * matrix.m[2][0] + m[0][3] * matrix.m[3][0],
@@ -190,6 +190,15 @@ struct Quaternion final {
     }
     Matrix4x4 MakeRotateMatrix() const noexcept {
         Matrix4x4 mat;
+#if defined(KASHIPAN_MATH_SIMD_SSE)
+        __m128 row0, row1, row2;
+        KashipanEngine::MathSimd::QuaternionToRows(x, y, z, w, row0, row1, row2);
+        _mm_storeu_ps(mat.m[0], row0);
+        _mm_storeu_ps(mat.m[1], row1);
+        _mm_storeu_ps(mat.m[2], row2);
+        _mm_storeu_ps(mat.m[3], _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f));
+        return mat;
+#else
         float xx = x * x;
         float yy = y * y;
         float zz = z * z;
@@ -216,6 +225,7 @@ struct Quaternion final {
         mat.m[3][2] = 0.0f;
         mat.m[3][3] = 1.0f;
         return mat;
+#endif
     }
     Vector3 MakeEuler() {
         Matrix4x4 mat = MakeRotateMatrix();
@@ -68,6 +68,30 @@ public:
     /// @brief 現在生存している要素数
     size_t LiveCount() const { return indexByPointer_.size(); }
 
+    /// @brief 確保済みのチャンク数
+    size_t ChunkCount() const { return chunks_.size(); }
+
+    /// @brief 指定チャンク内の生存している全要素について func(T &) をスロット順に呼ぶ
+    /// @details チャンク内のスロットは連続したメモリ上にあるため、ポインタをたどらずに順に走査できる。
+    ///          異なるチャンクの走査は互いに独立しており、要素の追加・削除を行わない限り並列に呼んでよい
+    template <typename Func>
+    void ForEachInChunk(size_t chunkIndex, Func &&func) {
+        Chunk &chunk = *chunks_[chunkIndex];
+        const size_t begin = chunkIndex * kChunkSize;
+        const size_t count = size_ - begin < kChunkSize ? size_ - begin : kChunkSize;
+        for (size_t i = 0; i < count; ++i) {
+            if (chunk[i].has_value()) func(*chunk[i]);
+        }
+    }
+
+    /// @brief 生存している全要素について func(T &) をチャンク順に呼ぶ
+    template <typename Func>
+    void ForEach(Func &&func) {
+        for (size_t chunkIndex = 0; chunkIndex < chunks_.size(); ++chunkIndex) {
+            ForEachInChunk(chunkIndex, func);
+        }
+    }
+
     /// @brief 全要素を破棄し、確保済みチャンクも含めて完全にリセットする
     void Clear() {
         chunks_.clear();
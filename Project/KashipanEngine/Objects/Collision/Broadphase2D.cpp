@@ -0,0 +1,479 @@
+#include "Broadphase2D.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace KashipanEngine {
+
+namespace {
+/// @brief fat AABBを移動方向へ先読みで広げる際の移動量の倍率
+constexpr float kDisplacementMultiplier = 2.0f;
+/// @brief fat AABBがこの倍率の余白より大きくなった場合は、はみ出していなくても縮めるために入れ直す
+constexpr float kLargeMarginMultiplier = 4.0f;
+
+inline Aabb2D Expand(const Aabb2D &aabb, float margin) {
+    return Aabb2D{aabb.minX - margin, aabb.minY - margin, aabb.maxX + margin, aabb.maxY + margin};
+}
+} // namespace
+
+//==================================================
+// DynamicAabbTree2D
+//==================================================
+
+std::int32_t DynamicAabbTree2D::CreateProxy(const Aabb2D &aabb, float margin, std::uint32_t userData) {
+    const std::int32_t proxyId = AllocateNode();
+    Node &node = nodes_[proxyId];
+    node.aabb = MakeFatAabb(aabb, Vector2{0.0f, 0.0f}, margin);
+    node.userData = userData;
+    node.height = 0;
+    InsertLeaf(proxyId);
+    ++proxyCount_;
+    return proxyId;
+}
+
+void DynamicAabbTree2D::DestroyProxy(std::int32_t proxyId) {
+    if (proxyId < 0 || static_cast<std::size_t>(proxyId) >= nodes_.size()) return;
+    if (nodes_[proxyId].height != 0) return;
+    RemoveLeaf(proxyId);
+    FreeNode(proxyId);
+    --proxyCount_;
+}
+
+bool DynamicAabbTree2D::MoveProxy(std::int32_t proxyId, const Aabb2D &aabb, const Vector2 &displacement, float margin) {
+    const Aabb2D &fatAabb = nodes_[proxyId].aabb;
+    const Aabb2D newFatAabb = MakeFatAabb(aabb, displacement, margin);
+
+    if (fatAabb.Contains(aabb)) {
+        // はみ出していなくても、停止や縮小で余白が過大になった場合は入れ直してペアの誤検出を減らす
+        const Aabb2D largeAabb = Expand(newFatAabb, margin * kLargeMarginMultiplier);
+        if (largeAabb.Contains(fatAabb)) return false;
+    }
+
+    RemoveLeaf(proxyId);
+    nodes_[proxyId].aabb = newFatAabb;
+    InsertLeaf(proxyId);
+    return true;
+}
+
+void DynamicAabbTree2D::Clear() {
+    nodes_.clear();
+    root_ = kNullNode;
+    freeList_ = kNullNode;
+    proxyCount_ = 0;
+}
+
+Aabb2D DynamicAabbTree2D::MakeFatAabb(const Aabb2D &aabb, const Vector2 &displacement, float margin) {
+    Aabb2D fat = Expand(aabb, margin);
+    const float dx = displacement.x * kDisplacementMultiplier;
+    const float dy = displacement.y * kDisplacementMultiplier;
+    if (dx < 0.0f) fat.minX += dx; else fat.maxX += dx;
+    if (dy < 0.0f) fat.minY += dy; else fat.maxY += dy;
+    return fat;
+}
+
+bool DynamicAabbTree2D::RayOverlaps(const Aabb2D &aabb, const Vector2 &origin, const Vector2 &direction, float maxDistance) {
+    float tMin = 0.0f;
+    float tMax = maxDistance;
+    const float o[2] = {origin.x, origin.y};
+    const float d[2] = {direction.x, direction.y};
+    const float mn[2] = {aabb.minX, aabb.minY};
+    const float mx[2] = {aabb.maxX, aabb.maxY};
+    for (int i = 0; i < 2; ++i) {
+        if (std::abs(d[i]) < 1.0e-8f) {
+            if (o[i] < mn[i] || mx[i] < o[i]) return false;
+            continue;
+        }
+        const float inv = 1.0f / d[i];
+        float t1 = (mn[i] - o[i]) * inv;
+        float t2 = (mx[i] - o[i]) * inv;
+        if (t1 > t2) std::swap(t1, t2);
+        tMin = std::max(tMin, t1);
+        tMax = std::min(tMax, t2);
+        if (tMin > tMax) return false;
+    }
+    return true;
+}
+
+std::int32_t DynamicAabbTree2D::AllocateNode() {
+    if (freeList_ == kNullNode) {
+        nodes_.emplace_back();
+        return static_cast<std::int32_t>(nodes_.size() - 1);
+    }
+    const std::int32_t nodeId = freeList_;
+    freeList_ = nodes_[nodeId].parent;
+    nodes_[nodeId] = Node{};
+    return nodeId;
+}
+
+void DynamicAabbTree2D::FreeNode(std::int32_t nodeId) {
+    nodes_[nodeId] = Node{};
+    nodes_[nodeId].parent = freeList_;
+    freeList_ = nodeId;
+}
+
+void DynamicAabbTree2D::InsertLeaf(std::int32_t leaf) {
+    if (root_ == kNullNode) {
+        root_ = leaf;
+        nodes_[leaf].parent = kNullNode;
+        return;
+    }
+
+    // 周長の増加量が最小になる兄弟ノードを根から辿って探す
+    const Aabb2D leafAabb = nodes_[leaf].aabb;
+    std::int32_t index = root_;
+    while (!nodes_[index].IsLeaf()) {
+        const std::int32_t child1 = nodes_[index].child1;
+        const std::int32_t child2 = nodes_[index].child2;
+
+        const float perimeter = nodes_[index].aabb.Perimeter();
+        const float combinedPerimeter = Aabb2D::Combine(nodes_[index].aabb, leafAabb).Perimeter();
+
+        // このノードと葉を新しい親でまとめる場合のコスト
+        const float cost = 2.0f * combinedPerimeter;
+        // さらに下へ降りる場合に、このノード以下の全祖先が負担する増加分
+        const float inheritanceCost = 2.0f * (combinedPerimeter - perimeter);
+
+        auto descendCost = [&](std::int32_t child) {
+            const Aabb2D combined = Aabb2D::Combine(leafAabb, nodes_[child].aabb);
+            if (nodes_[child].IsLeaf()) return combined.Perimeter() + inheritanceCost;
+            return (combined.Perimeter() - nodes_[child].aabb.Perimeter()) + inheritanceCost;
+        };
+        const float cost1 = descendCost(child1);
+        const float cost2 = descendCost(child2);
+
+        if (cost < cost1 && cost < cost2) break;
+        index = (cost1 < cost2) ? child1 : child2;
+    }
+
+    const std::int32_t sibling = index;
+    const std::int32_t oldParent = nodes_[sibling].parent;
+    // AllocateNodeでnodes_が再確保される可能性があるため、ここより前のノード参照は保持しない
+    const std::int32_t newParent = AllocateNode();
+    nodes_[newParent].parent = oldParent;
+    nodes_[newParent].aabb = Aabb2D::Combine(leafAabb, nodes_[sibling].aabb);
+    nodes_[newParent].height = nodes_[sibling].height + 1;
+    nodes_[newParent].child1 = sibling;
+    nodes_[newParent].child2 = leaf;
+    nodes_[sibling].parent = newParent;
+    nodes_[leaf].parent = newParent;
+
+    if (oldParent != kNullNode) {
+        if (nodes_[oldParent].child1 == sibling) {
+            nodes_[oldParent].child1 = newParent;
+        } else {
+            nodes_[oldParent].child2 = newParent;
+        }
+    } else {
+        root_ = newParent;
+    }
+
+    RefitAncestors(nodes_[leaf].parent);
+}
+
+void DynamicAabbTree2D::RemoveLeaf(std::int32_t leaf) {
+    if (leaf == root_) {
+        root_ = kNullNode;
+        return;
+    }
+
+    const std::int32_t parent = nodes_[leaf].parent;
+    const std::int32_t grandParent = nodes_[parent].parent;
+    const std::int32_t sibling = (nodes_[parent].child1 == leaf) ? nodes_[parent].child2 : nodes_[parent].child1;
+
+    if (grandParent != kNullNode) {
+        // 親ノードを破棄し、兄弟ノードを祖父ノードへ直接つなぐ
+        if (nodes_[grandParent].child1 == parent) {
+            nodes_[grandParent].child1 = sibling;
+        } else {
+            nodes_[grandParent].child2 = sibling;
+        }
+        nodes_[sibling].parent = grandParent;
+        FreeNode(parent);
+        RefitAncestors(grandParent);
+    } else {
+        root_ = sibling;
+        nodes_[sibling].parent = kNullNode;
+        FreeNode(parent);
+    }
+    nodes_[leaf].parent = kNullNode;
+}
+
+void DynamicAabbTree2D::RefitAncestors(std::int32_t nodeId) {
+    std::int32_t index = nodeId;
+    while (index != kNullNode) {
+        index = Balance(index);
+        Node &node = nodes_[index];
+        const Node &child1 = nodes_[node.child1];
+        const Node &child2 = nodes_[node.child2];
+        node.height = 1 + std::max(child1.height, child2.height);
+        node.aabb = Aabb2D::Combine(child1.aabb, child2.aabb);
+        index = node.parent;
+    }
+}
+
+std::int32_t DynamicAabbTree2D::Balance(std::int32_t iA) {
+    Node &a = nodes_[iA];
+    if (a.IsLeaf() || a.height < 2) return iA;
+
+    const std::int32_t iB = a.child1;
+    const std::int32_t iC = a.child2;
+    Node &b = nodes_[iB];
+    Node &c = nodes_[iC];
+
+    const std::int32_t balance = c.height - b.height;
+
+    // Cを持ち上げる
+    if (balance > 1) {
+        const std::int32_t iF = c.child1;
+        const std::int32_t iG = c.child2;
+        Node &f = nodes_[iF];
+        Node &g = nodes_[iG];
+
+        c.child1 = iA;
+        c.parent = a.parent;
+        a.parent = iC;
+
+        if (c.parent != kNullNode) {
+            if (nodes_[c.parent].child1 == iA) {
+                nodes_[c.parent].child1 = iC;
+            } else {
+                nodes_[c.parent].child2 = iC;
+            }
+        } else {
+            root_ = iC;
+        }
+
+        // 高い方の子をCに残し、低い方をAへ移す
+        if (f.height > g.height) {
+            c.child2 = iF;
+            a.child2 = iG;
+            g.parent = iA;
+            a.aabb = Aabb2D::Combine(b.aabb, g.aabb);
+            c.aabb = Aabb2D::Combine(a.aabb, f.aabb);
+            a.height = 1 + std::max(b.height, g.height);
+            c.height = 1 + std::max(a.height, f.height);
+        } else {
+            c.child2 = iG;
+            a.child2 = iF;
+            f.parent = iA;
+            a.aabb = Aabb2D::Combine(b.aabb, f.aabb);
+            c.aabb = Aabb2D::Combine(a.aabb, g.aabb);
+            a.height = 1 + std::max(b.height, f.height);
+            c.height = 1 + std::max(a.height, g.height);
+        }
+        return iC;
+    }
+
+    // Bを持ち上げる
+    if (balance < -1) {
+        const std::int32_t iD = b.child1;
+        const std::int32_t iE = b.child2;
+        Node &d = nodes_[iD];
+        Node &e = nodes_[iE];
+
+        b.child1 = iA;
+        b.parent = a.parent;
+        a.parent = iB;
+
+        if (b.parent != kNullNode) {
+            if (nodes_[b.parent].child1 == iA) {
+                nodes_[b.parent].child1 = iB;
+            } else {
+                nodes_[b.parent].child2 = iB;
+            }
+        } else {
+            root_ = iB;
+        }
+
+        if (d.height > e.height) {
+            b.child2 = iD;
+            a.child1 = iE;
+            e.parent = iA;
+            a.aabb = Aabb2D::Combine(c.aabb, e.aabb);
+            b.aabb = Aabb2D::Combine(a.aabb, d.aabb);
+            a.height = 1 + std::max(c.height, e.height);
+            b.height = 1 + std::max(a.height, d.height);
+        } else {
+            b.child2 = iE;
+            a.child1 = iD;
+            d.parent = iA;
+            a.aabb = Aabb2D::Combine(c.aabb, d.aabb);
+            b.aabb = Aabb2D::Combine(a.aabb, e.aabb);
+            a.height = 1 + std::max(c.height, d.height);
+            b.height = 1 + std::max(a.height, e.height);
+        }
+        return iB;
+    }
+
+    return iA;
+}
+
+//==================================================
+// Broadphase2D
+//==================================================
+
+void Broadphase2D::UpdateProxy(ColliderID id, const Aabb2D &aabb) {
+    const float margin = ComputeMargin(aabb);
+    const Vector2 center{(aabb.minX + aabb.maxX) * 0.5f, (aabb.minY + aabb.maxY) * 0.5f};
+
+    auto it = proxies_.find(id);
+    if (it == proxies_.end()) {
+        const std::int32_t proxyId = tree_.CreateProxy(aabb, margin, id);
+        proxies_.emplace(id, Proxy{proxyId, center});
+        movedProxies_.push_back(proxyId);
+        return;
+    }
+
+    const Vector2 displacement = center - it->second.center;
+    it->second.center = center;
+    if (tree_.MoveProxy(it->second.proxyId, aabb, displacement, margin)) {
+        movedProxies_.push_back(it->second.proxyId);
+    }
+}
+
+void Broadphase2D::RemoveProxy(ColliderID id) {
+    auto it = proxies_.find(id);
+    if (it == proxies_.end()) return;
+    const std::int32_t proxyId = it->second.proxyId;
+    tree_.DestroyProxy(proxyId);
+    std::erase(movedProxies_, proxyId);
+    proxies_.erase(it);
+}
+
+void Broadphase2D::UpdatePairs() {
+    addedPairs_.clear();
+    removedPairs_.clear();
+
+    // プロキシが破棄された、またはfat AABBが離れたペアをキャッシュから除去する
+    // （ノードの再利用を考慮し、プロキシIDとコライダーIDの両方で生存を確認する）
+    {
+        auto out = pairs_.begin();
+        for (auto it = pairs_.begin(); it != pairs_.end(); ++it) {
+            const bool alive =
+                tree_.IsProxyAlive(it->proxyA, it->a) &&
+                tree_.IsProxyAlive(it->proxyB, it->b) &&
+                tree_.GetFatAabb(it->proxyA).Overlaps(tree_.GetFatAabb(it->proxyB));
+            if (alive) {
+                if (out != it) *out = *it;
+                ++out;
+            } else {
+                removedPairs_.push_back(*it);
+            }
+        }
+        pairs_.erase(out, pairs_.end());
+    }
+
+    if (movedProxies_.empty()) return;
+
+    // 木へ入れ直されたプロキシのみを問い合わせ、新しく重なった相手を探す
+    std::sort(movedProxies_.begin(), movedProxies_.end());
+    movedProxies_.erase(std::unique(movedProxies_.begin(), movedProxies_.end()), movedProxies_.end());
+
+    for (const std::int32_t proxyId : movedProxies_) {
+        const ColliderID selfId = tree_.GetUserData(proxyId);
+        tree_.Query(tree_.GetFatAabb(proxyId), [&](std::int32_t otherProxy) {
+            if (otherProxy == proxyId) return true;
+            const ColliderID otherId = tree_.GetUserData(otherProxy);
+            Pair pair;
+            pair.key = MakePairKey(selfId, otherId);
+            if (selfId < otherId) {
+                pair.a = selfId;
+                pair.b = otherId;
+                pair.proxyA = proxyId;
+                pair.proxyB = otherProxy;
+            } else {
+                pair.a = otherId;
+                pair.b = selfId;
+                pair.proxyA = otherProxy;
+                pair.proxyB = proxyId;
+            }
+            addedPairs_.push_back(pair);
+            return true;
+        });
+    }
+    movedProxies_.clear();
+
+    // 両方とも移動した場合の重複と、既にキャッシュにあるペアを取り除く
+    auto byKey = [](const Pair &l, const Pair &r) { return l.key < r.key; };
+    std::sort(addedPairs_.begin(), addedPairs_.end(), byKey);
+    addedPairs_.erase(
+        std::unique(addedPairs_.begin(), addedPairs_.end(), [](const Pair &l, const Pair &r) { return l.key == r.key; }),
+        addedPairs_.end());
+    std::erase_if(addedPairs_, [&](const Pair &p) {
+        return std::binary_search(pairs_.begin(), pairs_.end(), p, byKey);
+    });
+
+    if (addedPairs_.empty()) return;
+    const auto mid = pairs_.insert(pairs_.end(), addedPairs_.begin(), addedPairs_.end());
+    std::inplace_merge(pairs_.begin(), mid, pairs_.end(), byKey);
+}
+
+void Broadphase2D::AddPair(ColliderID a, ColliderID b, bool isTouching) {
+    if (a == b) return;
+    if (a > b) std::swap(a, b);
+
+    const std::uint64_t key = MakePairKey(a, b);
+    auto it = std::lower_bound(pairs_.begin(), pairs_.end(), key,
+        [](const Pair &p, std::uint64_t k) { return p.key < k; });
+    if (it != pairs_.end() && it->key == key) {
+        it->isTouching = isTouching;
+        return;
+    }
+
+    const auto pa = proxies_.find(a);
+    const auto pb = proxies_.find(b);
+    if (pa == proxies_.end() || pb == proxies_.end()) return;
+
+    Pair pair;
+    pair.key = key;
+    pair.a = a;
+    pair.b = b;
+    pair.proxyA = pa->second.proxyId;
+    pair.proxyB = pb->second.proxyId;
+    pair.isTouching = isTouching;
+    pairs_.insert(it, pair);
+}
+
+Broadphase2D::Pair *Broadphase2D::FindPair(std::uint64_t key) {
+    auto it = std::lower_bound(pairs_.begin(), pairs_.end(), key,
+        [](const Pair &p, std::uint64_t k) { return p.key < k; });
+    return (it != pairs_.end() && it->key == key) ? &*it : nullptr;
+}
+
+void Broadphase2D::Clear() {
+    tree_.Clear();
+    proxies_.clear();
+    movedProxies_.clear();
+    pairs_.clear();
+    addedPairs_.clear();
+    removedPairs_.clear();
+}
+
+float Broadphase2D::ComputeMargin(const Aabb2D &aabb) const {
+    const float extent = std::max(aabb.maxX - aabb.minX, aabb.maxY - aabb.minY);
+    return std::max(minMargin_, extent * marginRatio_);
+}
+
+void Broadphase2D::CollectOverlappingPairs(
+    const std::vector<std::pair<ColliderID, Aabb2D>> &boxes,
+    std::vector<std::pair<std::size_t, std::size_t>> &outPairs) {
+    std::vector<std::size_t> order(boxes.size());
+    for (std::size_t i = 0; i < order.size(); ++i) order[i] = i;
+    std::sort(order.begin(), order.end(), [&](std::size_t l, std::size_t r) {
+        return boxes[l].second.minX < boxes[r].second.minX;
+    });
+
+    // X軸でソートし、minXが現在のmaxXを越えるまでの範囲だけをY軸で判定する
+    for (std::size_t i = 0; i < order.size(); ++i) {
+        const Aabb2D &a = boxes[order[i]].second;
+        for (std::size_t j = i + 1; j < order.size(); ++j) {
+            const Aabb2D &b = boxes[order[j]].second;
+            if (b.minX > a.maxX) break;
+            if (a.minY <= b.maxY && b.minY <= a.maxY) {
+                outPairs.emplace_back(std::min(order[i], order[j]), std::max(order[i], order[j]));
+            }
+        }
+    }
+}
+
+} // namespace KashipanEngine
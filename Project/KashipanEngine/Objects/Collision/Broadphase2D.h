@@ -0,0 +1,245 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Math/Vector2.h"
+
+namespace KashipanEngine {
+
+/// @brief 2D用の軸平行バウンディングボックス
+struct Aabb2D final {
+    float minX = 0.0f;
+    float minY = 0.0f;
+    float maxX = 0.0f;
+    float maxY = 0.0f;
+
+    /// @brief 境界上で接している場合も重なりとみなす
+    bool Overlaps(const Aabb2D &o) const noexcept {
+        return minX <= o.maxX && o.minX <= maxX && minY <= o.maxY && o.minY <= maxY;
+    }
+    bool Contains(const Aabb2D &o) const noexcept {
+        return minX <= o.minX && minY <= o.minY && o.maxX <= maxX && o.maxY <= maxY;
+    }
+    /// @brief 周長（木の挿入コストの評価に使用する。2Dでは面積より周長の方が形状の偏りに強い）
+    float Perimeter() const noexcept { return 2.0f * ((maxX - minX) + (maxY - minY)); }
+
+    static Aabb2D Combine(const Aabb2D &a, const Aabb2D &b) noexcept {
+        return Aabb2D{
+            a.minX < b.minX ? a.minX : b.minX,
+            a.minY < b.minY ? a.minY : b.minY,
+            a.maxX > b.maxX ? a.maxX : b.maxX,
+            a.maxY > b.maxY ? a.maxY : b.maxY};
+    }
+};
+
+/// @brief fat AABB（実際のAABBに余白を持たせたもの）を葉に持つ動的AABB木
+/// @details 葉のfat AABBから実際のAABBがはみ出した場合のみ葉を抜き差しするため、
+///          少しずつ動くオブジェクトでは毎フレームの木の更新がほぼ発生しない。
+///          挿入位置は周長ベースのコストで選び、回転によって木の高さを平衡に保つ。
+class DynamicAabbTree2D final {
+public:
+    static constexpr std::int32_t kNullNode = -1;
+
+    DynamicAabbTree2D() = default;
+
+    /// @brief プロキシ（葉）を生成する
+    /// @param aabb 実際のAABB
+    /// @param margin fat AABBとして四方に持たせる余白
+    /// @param userData プロキシに紐づける値（Broadphase2DではコライダーID）
+    /// @return プロキシID
+    std::int32_t CreateProxy(const Aabb2D &aabb, float margin, std::uint32_t userData);
+    void DestroyProxy(std::int32_t proxyId);
+    /// @brief プロキシのAABBを更新する
+    /// @param displacement 前回からの移動量（移動方向へfat AABBを先読みで広げるのに使用する）
+    /// @return fat AABBからはみ出して葉を入れ直した場合はtrue
+    bool MoveProxy(std::int32_t proxyId, const Aabb2D &aabb, const Vector2 &displacement, float margin);
+
+    const Aabb2D &GetFatAabb(std::int32_t proxyId) const { return nodes_[proxyId].aabb; }
+    std::uint32_t GetUserData(std::int32_t proxyId) const { return nodes_[proxyId].userData; }
+    /// @brief 有効な葉で、かつ指定したユーザーデータを持つか（破棄済みノードの再利用の検出に使用する）
+    bool IsProxyAlive(std::int32_t proxyId, std::uint32_t userData) const {
+        return proxyId >= 0 && static_cast<std::size_t>(proxyId) < nodes_.size() &&
+            nodes_[proxyId].height == 0 && nodes_[proxyId].userData == userData;
+    }
+
+    /// @brief AABBと重なる全ての葉についてcallback(proxyId)を呼ぶ（callbackがfalseを返すと打ち切る）
+    template<typename Callback>
+    void Query(const Aabb2D &aabb, Callback &&callback) const {
+        Query(aabb, queryStack_, std::forward<Callback>(callback));
+    }
+    /// @brief 走査用のスタックを呼び出し側が用意するQuery
+    /// @details 木を変更しない間は複数スレッドから同時に呼んでよい（スタックはスレッドごとに用意すること）
+    template<typename Callback>
+    void Query(const Aabb2D &aabb, std::vector<std::int32_t> &stack, Callback &&callback) const {
+        if (root_ == kNullNode) return;
+        stack.clear();
+        stack.push_back(root_);
+        while (!stack.empty()) {
+            const std::int32_t nodeId = stack.back();
+            stack.pop_back();
+            const Node &node = nodes_[nodeId];
+            if (!node.aabb.Overlaps(aabb)) continue;
+            if (node.IsLeaf()) {
+                if (!callback(nodeId)) return;
+            } else {
+                stack.push_back(node.child1);
+                stack.push_back(node.child2);
+            }
+        }
+    }
+
+    /// @brief 線分（origin + direction * t, 0 <= t <= maxDistance）と重なる葉についてcallback(proxyId, maxDistance)を呼ぶ
+    /// @details callbackは新しい最大距離を返す。それより遠いノードは以降の走査から外れる（0以下を返すと打ち切る）。
+    ///          directionは正規化されている前提。スタックの扱いはQueryと同じ
+    template<typename Callback>
+    void RayCast(const Vector2 &origin, const Vector2 &direction, float maxDistance, std::vector<std::int32_t> &stack, Callback &&callback) const {
+        if (root_ == kNullNode) return;
+        stack.clear();
+        stack.push_back(root_);
+        while (!stack.empty()) {
+            const std::int32_t nodeId = stack.back();
+            stack.pop_back();
+            const Node &node = nodes_[nodeId];
+            if (!RayOverlaps(node.aabb, origin, direction, maxDistance)) continue;
+            if (node.IsLeaf()) {
+                maxDistance = callback(nodeId, maxDistance);
+                if (maxDistance <= 0.0f) return;
+            } else {
+                stack.push_back(node.child1);
+                stack.push_back(node.child2);
+            }
+        }
+    }
+
+    /// @brief 木の高さ（葉のみの場合は0、空の場合は-1）
+    std::int32_t GetHeight() const { return root_ == kNullNode ? -1 : nodes_[root_].height; }
+    std::size_t GetProxyCount() const noexcept { return proxyCount_; }
+    void Clear();
+
+private:
+    struct Node {
+        Aabb2D aabb{};
+        /// @brief 親ノード（未使用ノードの場合はフリーリストの次のノード）
+        std::int32_t parent = kNullNode;
+        std::int32_t child1 = kNullNode;
+        std::int32_t child2 = kNullNode;
+        /// @brief 葉は0、未使用ノードは-1
+        std::int32_t height = -1;
+        std::uint32_t userData = 0;
+
+        bool IsLeaf() const noexcept { return child1 == kNullNode; }
+    };
+
+    static Aabb2D MakeFatAabb(const Aabb2D &aabb, const Vector2 &displacement, float margin);
+    /// @brief 線分とAABBのスラブ判定
+    static bool RayOverlaps(const Aabb2D &aabb, const Vector2 &origin, const Vector2 &direction, float maxDistance);
+
+    std::int32_t AllocateNode();
+    void FreeNode(std::int32_t nodeId);
+    void InsertLeaf(std::int32_t leaf);
+    void RemoveLeaf(std::int32_t leaf);
+    /// @brief ノードiAの左右の高さの差が2以上の場合に回転を行い、部分木の新しい根を返す
+    std::int32_t Balance(std::int32_t iA);
+    /// @brief 指定ノードから根まで、高さとAABBを再計算しながら平衡を取る
+    void RefitAncestors(std::int32_t nodeId);
+
+    std::vector<Node> nodes_;
+    std::int32_t root_ = kNullNode;
+    std::int32_t freeList_ = kNullNode;
+    std::size_t proxyCount_ = 0;
+    mutable std::vector<std::int32_t> queryStack_;
+};
+
+/// @brief 2Dコライダー用の永続的なブロードフェーズ
+/// @details コライダーIDごとにDynamicAabbTree2Dのプロキシを持ち、fat AABBからはみ出したものだけを
+///          木へ入れ直す。fat AABB同士が重なっているペアはペアキャッシュとして保持され、
+///          UpdatePairsのたびに「新しく重なったペア」「離れた（またはプロキシが破棄された）ペア」が報告される。
+///          ペアキャッシュはペアキー（ID昇順）でソートされた連続配列で、各ペアの接触状態（isTouching）は
+///          呼び出し側（Collider::Update2D）がEnter/Stay/Exitの判定に使う。
+class Broadphase2D final {
+public:
+    using ColliderID = std::uint32_t;
+
+    struct Pair {
+        std::uint64_t key = 0;
+        /// @brief ID昇順（a < b）
+        ColliderID a = 0;
+        ColliderID b = 0;
+        std::int32_t proxyA = DynamicAabbTree2D::kNullNode;
+        std::int32_t proxyB = DynamicAabbTree2D::kNullNode;
+        /// @brief 前回の狭域判定で接触していたか（呼び出し側が更新する）
+        bool isTouching = false;
+    };
+
+    static std::uint64_t MakePairKey(ColliderID a, ColliderID b) {
+        if (a > b) std::swap(a, b);
+        return (static_cast<std::uint64_t>(a) << 32) | static_cast<std::uint64_t>(b);
+    }
+
+    /// @brief コライダーのAABBを登録・更新する（未登録の場合はプロキシを生成する）
+    void UpdateProxy(ColliderID id, const Aabb2D &aabb);
+    /// @brief コライダーのプロキシを破棄する（関連するペアは次のUpdatePairsでRemovedとして報告される）
+    void RemoveProxy(ColliderID id);
+    bool HasProxy(ColliderID id) const { return proxies_.contains(id); }
+
+    /// @brief 移動したプロキシの新しいペアを検出し、fat AABBが離れたペアを除去する
+    void UpdatePairs();
+
+    /// @brief fat AABBが重なっている全ペア（ペアキー昇順）
+    std::vector<Pair> &GetPairs() noexcept { return pairs_; }
+    const std::vector<Pair> &GetPairs() const noexcept { return pairs_; }
+    /// @brief 直前のUpdatePairsで追加されたペア
+    const std::vector<Pair> &GetAddedPairs() const noexcept { return addedPairs_; }
+    /// @brief 直前のUpdatePairsで除去されたペア（除去時点のisTouchingを保持する）
+    const std::vector<Pair> &GetRemovedPairs() const noexcept { return removedPairs_; }
+
+    /// @brief fat AABBが重なっていないペアを明示的にキャッシュへ追加する
+    /// @details 連続衝突判定（スイープ）でのみ検出された接触を次フレームへ持ち越すために使う。
+    ///          fat AABBが重なっていなければ次のUpdatePairsでRemovedとして報告される
+    void AddPair(ColliderID a, ColliderID b, bool isTouching);
+    /// @brief キャッシュ内のペアを検索する（見つからない場合はnullptr）
+    Pair *FindPair(std::uint64_t key);
+
+    void Clear();
+
+    const DynamicAabbTree2D &GetTree() const noexcept { return tree_; }
+
+    /// @brief fat AABBの余白（形状サイズに対する割合）
+    void SetMarginRatio(float ratio) noexcept { marginRatio_ = ratio; }
+    /// @brief fat AABBの余白の下限
+    void SetMinMargin(float margin) noexcept { minMargin_ = margin; }
+
+    /// @brief 永続状態を持たずに、AABB同士が重なるペアを一括で求める（sort-and-sweep）
+    /// @param boxes (コライダーID, AABB) の配列
+    /// @param outPairs 重なっているペアのインデックス（boxes内の位置）の格納先
+    static void CollectOverlappingPairs(
+        const std::vector<std::pair<ColliderID, Aabb2D>> &boxes,
+        std::vector<std::pair<std::size_t, std::size_t>> &outPairs);
+
+private:
+    struct Proxy {
+        std::int32_t proxyId = DynamicAabbTree2D::kNullNode;
+        /// @brief 前回登録した実際のAABBの中心（移動量の算出用）
+        Vector2 center{ 0.0f, 0.0f };
+    };
+
+    float ComputeMargin(const Aabb2D &aabb) const;
+
+    DynamicAabbTree2D tree_;
+    std::unordered_map<ColliderID, Proxy> proxies_;
+    /// @brief 前回のUpdatePairs以降に木へ入れ直された（または新規の）プロキシ
+    std::vector<std::int32_t> movedProxies_;
+
+    std::vector<Pair> pairs_;
+    std::vector<Pair> addedPairs_;
+    std::vector<Pair> removedPairs_;
+
+    float marginRatio_ = 0.25f;
+    float minMargin_ = 0.05f;
+};
+
+} // namespace KashipanEngine
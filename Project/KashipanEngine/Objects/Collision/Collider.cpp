@@ -1,26 +1,22 @@
 #include "Collider.h"
 
-#include "Objects/EmptyObject.h"
 #include "Objects/Collision/CollisionAlgorithms2D.h"
-#include "Objects/Components/Transform.h"
-#include "Objects/Components/Collider/RigidBody3D.h"
+#include "Objects/Collision/CollisionAlgorithms3D.h"
+#include "Math/Quaternion.h"
+#include "Utilities/Plugin/Plugins.h"
 #include "Utilities/TimeUtils.h"
 #include <algorithm>
 #include <cmath>
 #include <limits>
 #include <optional>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 
 namespace KashipanEngine {
 
 namespace {
-struct Bounds2D {
-    float minX = 0.0f;
-    float minY = 0.0f;
-    float maxX = 0.0f;
-    float maxY = 0.0f;
-};
+using Bounds2D = Aabb2D;
 
 struct Bounds3D {
     Vector3 min{0.0f, 0.0f, 0.0f};
@@ -179,72 +175,11 @@ std::optional<Bounds3D> ComputeBounds3D(const ColliderInfo3D::ShapeVariant &shap
         shape);
 }
 
-template<typename TColliders>
-std::vector<IndexPair> BuildCandidatePairs2D(const TColliders &colliders) {
-    constexpr float kCellSize = 10.0f;
-    constexpr int kMaxCellsPerShape = 256;
-
-    std::unordered_map<std::uint64_t, std::vector<std::size_t>> grid;
-    std::vector<std::size_t> active;
-    std::vector<std::size_t> global;
-
-    active.reserve(colliders.size());
-    global.reserve(colliders.size());
-
-    for (std::size_t i = 0; i < colliders.size(); ++i) {
-        const auto &c = colliders[i];
-        if (!c.info.enabled) continue;
-        active.push_back(i);
-
-        const auto bounds = ComputeBounds2D(c.info.shape);
-        if (!bounds.has_value()) {
-            global.push_back(i);
-            continue;
-        }
-
-        const int minX = ToCell(bounds->minX, kCellSize);
-        const int minY = ToCell(bounds->minY, kCellSize);
-        const int maxX = ToCell(bounds->maxX, kCellSize);
-        const int maxY = ToCell(bounds->maxY, kCellSize);
-
-        const int cellsX = (maxX - minX + 1);
-        const int cellsY = (maxY - minY + 1);
-        if (cellsX <= 0 || cellsY <= 0 || cellsX > kMaxCellsPerShape || cellsY > kMaxCellsPerShape || (cellsX * cellsY) > kMaxCellsPerShape) {
-            global.push_back(i);
-            continue;
-        }
-
-        for (int y = minY; y <= maxY; ++y) {
-            for (int x = minX; x <= maxX; ++x) {
-                const std::uint64_t key = (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32)
-                                        | static_cast<std::uint32_t>(y);
-                grid[key].push_back(i);
-            }
-        }
-    }
-
-    std::unordered_set<IndexPair, IndexPairHash> uniquePairs;
-
-    for (const auto &[_, indices] : grid) {
-        for (std::size_t i = 0; i < indices.size(); ++i) {
-            for (std::size_t j = i + 1; j < indices.size(); ++j) {
-                uniquePairs.insert(MakeIndexPair(indices[i], indices[j]));
-            }
-        }
-    }
-
-    for (std::size_t gi = 0; gi < global.size(); ++gi) {
-        const std::size_t g = global[gi];
-        for (std::size_t a : active) {
-            if (a == g) continue;
-            uniquePairs.insert(MakeIndexPair(g, a));
-        }
-    }
-
-    std::vector<IndexPair> out;
-    out.reserve(uniquePairs.size());
-    for (const auto &p : uniquePairs) out.push_back(p);
-    return out;
+/// @brief ブロードフェーズへ登録するAABBを求める（境界を求められない形状は全てと重なる扱いにする）
+Aabb2D ComputeBroadphaseAabb2D(const ColliderInfo2D::ShapeVariant &shape) {
+    constexpr float kUnboundedExtent = 1.0e18f;
+    if (const auto bounds = ComputeBounds2D(shape)) return *bounds;
+    return Aabb2D{-kUnboundedExtent, -kUnboundedExtent, kUnboundedExtent, kUnboundedExtent};
 }
 
 template<typename TColliders>
@@ -353,12 +288,6 @@ inline bool Intersects2D(const ColliderInfo2D::ShapeVariant &a, const ColliderIn
         a, b);
 }
 
-inline bool Intersects3D(const ColliderInfo3D::ShapeVariant &a, const ColliderInfo3D::ShapeVariant &b) {
-    (void)a;
-    (void)b;
-    return false;
-}
-
 inline HitInfo2D ComputeHit2D(const ColliderInfo2D::ShapeVariant &a, const ColliderInfo2D::ShapeVariant &b) {
     return std::visit(
         [](const auto &lhs, const auto &rhs) -> HitInfo2D {
@@ -380,12 +309,6 @@ inline HitInfo2D ComputeHit2D(const ColliderInfo2D::ShapeVariant &a, const Colli
         a, b);
 }
 
-inline HitInfo3D ComputeHit3D(const ColliderInfo3D::ShapeVariant &a, const ColliderInfo3D::ShapeVariant &b) {
-    (void)a;
-    (void)b;
-    return HitInfo3D{};
-}
-
 //==================================================
 // 連続衝突判定（CCD）用ヘルパー
 //==================================================
@@ -405,10 +328,12 @@ float ComputeMinHalfExtent2D(const ColliderInfo2D::ShapeVariant &shape) {
 }
 
 /// @brief 3D形状の最小半径を求める
-float ComputeMinHalfExtent3D(const ColliderInfo3D::ShapeVariant &shape) {
-    const auto bounds = ComputeBounds3D(shape);
-    if (!bounds) return kMinSweepStep;
-    const Vector3 size = bounds->max - bounds->min;
+/// @details メッシュ系の形状は頂点を形状情報に持たない（共有メッシュキャッシュを参照する）場合があるため、
+///          生成済みのRP3D形状のローカルAABB（スケール適用済み）から求める
+float ComputeMinHalfExtent3D(const reactphysics3d::CollisionShape *shape) {
+    if (!shape) return kMinSweepStep;
+    const auto bounds = shape->getLocalBounds();
+    const auto size = bounds.getMax() - bounds.getMin();
     return std::max(kMinSweepStep, std::min({ size.x, size.y, size.z }) * 0.5f);
 }
 
@@ -436,6 +361,470 @@ ColliderInfo2D::ShapeVariant TranslateShape2D(const ColliderInfo2D::ShapeVariant
     return result;
 }
 
+//==================================================
+// ネイティブ判定（3Dトリガー）用ヘルパー
+//==================================================
+
+using PrimitiveShape3D = std::variant<Math::Sphere, Math::OBB, Math::Capsule3D>;
+
+/// @brief プリミティブ形状の情報と姿勢から、ワールド座標の形状を求める（プリミティブ以外はnullopt）
+std::optional<PrimitiveShape3D> MakePrimitiveShape3D(const ColliderInfo3D::ShapeVariant &shape, const reactphysics3d::Transform &transform) {
+    const auto &p = transform.getPosition();
+    const auto &q = transform.getOrientation();
+    const Vector3 position{p.x, p.y, p.z};
+    const Quaternion rotation(q.x, q.y, q.z, q.w);
+
+    return std::visit(
+        [&](const auto &s) -> std::optional<PrimitiveShape3D> {
+            using S = std::decay_t<decltype(s)>;
+            if constexpr (std::is_same_v<S, ColliderInfo3D::SphereShape3D>) {
+                return Math::Sphere{position, s.radius};
+            } else if constexpr (std::is_same_v<S, ColliderInfo3D::BoxShape3D>) {
+                Math::OBB obb;
+                obb.center = position;
+                obb.halfSize = s.halfExtents;
+                obb.orientation = rotation.MakeRotateMatrix();
+                return obb;
+            } else if constexpr (std::is_same_v<S, ColliderInfo3D::CapsuleShape3D>) {
+                // RP3Dのカプセルと同じく、ローカルY軸方向に球の中心間距離heightを持つ
+                const Vector3 axis = rotation.RotateVector(Vector3{0.0f, 0.5f * s.height, 0.0f});
+                return Math::Capsule3D{position - axis, position + axis, s.radius};
+            } else {
+                return std::nullopt;
+            }
+        },
+        shape);
+}
+
+Math::AABB ComputePrimitiveBounds3D(const PrimitiveShape3D &shape) {
+    return std::visit(
+        [](const auto &s) -> Math::AABB {
+            using S = std::decay_t<decltype(s)>;
+            if constexpr (std::is_same_v<S, Math::Sphere>) {
+                const Vector3 r{s.radius, s.radius, s.radius};
+                return Math::AABB{s.center - r, s.center + r};
+            } else if constexpr (std::is_same_v<S, Math::OBB>) {
+                // 各軸方向の広がりは、OBBの3軸の成分の絶対値とサイズの積の和になる
+                Vector3 ext{0.0f, 0.0f, 0.0f};
+                const float half[3] = {s.halfSize.x, s.halfSize.y, s.halfSize.z};
+                for (int i = 0; i < 3; ++i) {
+                    ext.x += std::abs(s.orientation.m[i][0]) * half[i];
+                    ext.y += std::abs(s.orientation.m[i][1]) * half[i];
+                    ext.z += std::abs(s.orientation.m[i][2]) * half[i];
+                }
+                return Math::AABB{s.center - ext, s.center + ext};
+            } else {
+                const Vector3 r{s.radius, s.radius, s.radius};
+                const Vector3 minV{std::min(s.start.x, s.end.x), std::min(s.start.y, s.end.y), std::min(s.start.z, s.end.z)};
+                const Vector3 maxV{std::max(s.start.x, s.end.x), std::max(s.start.y, s.end.y), std::max(s.start.z, s.end.z)};
+                return Math::AABB{minV - r, maxV + r};
+            }
+        },
+        shape);
+}
+
+/// @brief プリミティブ形状の最小半径（この距離以下の移動ならすり抜けは起きないとみなせる量）を求める
+float ComputeMinHalfExtentPrimitive3D(const PrimitiveShape3D &shape) {
+    return std::visit(
+        [](const auto &s) -> float {
+            using S = std::decay_t<decltype(s)>;
+            if constexpr (std::is_same_v<S, Math::OBB>) {
+                return std::max(kMinSweepStep, std::min({s.halfSize.x, s.halfSize.y, s.halfSize.z}));
+            } else {
+                return std::max(kMinSweepStep, s.radius);
+            }
+        },
+        shape);
+}
+
+PrimitiveShape3D TranslatePrimitive3D(const PrimitiveShape3D &shape, const Vector3 &offset) {
+    PrimitiveShape3D result = shape;
+    std::visit(
+        [&](auto &s) {
+            using S = std::decay_t<decltype(s)>;
+            if constexpr (std::is_same_v<S, Math::Capsule3D>) {
+                s.start += offset;
+                s.end += offset;
+            } else {
+                s.center += offset;
+            }
+        },
+        result);
+    return result;
+}
+
+/// @brief ワールド座標のプリミティブ形状同士の接触情報を求める（法線はaからbへ向かう方向）
+HitInfo ComputePrimitiveHit3D(const PrimitiveShape3D &a, const PrimitiveShape3D &b) {
+    return std::visit(
+        [](const auto &lhs, const auto &rhs) -> HitInfo {
+            if constexpr (requires { KashipanEngine::CollisionAlgorithms3D::ComputeHit(lhs, rhs); }) {
+                return KashipanEngine::CollisionAlgorithms3D::ComputeHit(lhs, rhs);
+            } else {
+                return HitInfo{};
+            }
+        },
+        a, b);
+}
+
+//==================================================
+// 並列実行用ヘルパー
+//==================================================
+
+/// @brief 狭域判定の1タスクあたりの最小ペア数（これより細かく分けるとタスク投入・待機のコストが上回る）
+constexpr std::size_t kMinPairsPerTask2D = 64;
+/// @brief スイープの1タスクあたりの最小コライダー数（1件あたりの判定量が多いため狭域判定より小さくする）
+constexpr std::size_t kMinSweepsPerTask2D = 4;
+
+/// @brief [0, count) をチャンクに分割し、func(begin, end) をジョブシステムで並列実行して完了を待つ
+/// @details 件数が少ない場合や、ジョブシステムが未初期化の場合は呼び出し元スレッドでそのまま実行する。
+///          funcは複数のワーカースレッドから並列に呼ばれるため、担当範囲以外へ書き込まないこと
+template<typename Func>
+void ParallelForChunks(std::size_t count, std::size_t minPerTask, const Func &func) {
+    if (count == 0) return;
+    const std::size_t maxTasks = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+    const std::size_t taskCount = std::min(maxTasks, (count + minPerTask - 1) / minPerTask);
+    if (taskCount <= 1 || !Plugin::jobSystem) {
+        func(std::size_t{0}, count);
+        return;
+    }
+
+    const std::size_t chunkSize = (count + taskCount - 1) / taskCount;
+    Plugin::ParallelFor(count, chunkSize, [&func](std::size_t begin, std::size_t end) { func(begin, end); });
+}
+
+//==================================================
+// シーンクエリ用ヘルパー
+//==================================================
+
+/// @brief シーンクエリの1タスクあたりの最小クエリ数
+constexpr std::size_t kMinQueriesPerTask = 16;
+/// @brief スイープクエリの最大分割数（CCDより長い移動を扱うため多めに取る）
+constexpr int kMaxQuerySweepSubsteps = 64;
+/// @brief スイープクエリで最初に当たった区間を二分探索で詰める回数
+constexpr int kSweepRefineIterations = 8;
+constexpr float kQueryEpsilon = 1.0e-6f;
+
+bool PassesQueryFilter(const QueryFilter &filter, const std::bitset<ColliderInfo3D::kMaxAttributes> &attribute, bool isTrigger, const EmptyObject *owner) {
+    if (!filter.includeTriggers && isTrigger) return false;
+    if (filter.ignoreObject && filter.ignoreObject == owner) return false;
+    return (filter.ignoreAttribute & attribute).none();
+}
+
+/// @brief クエリをSerialなら呼び出し元スレッドで、Parallelならチャンクに分けて並列に処理する
+template<typename Func>
+void RunQueries(std::size_t count, QueryExecution execution, const Func &func) {
+    if (execution == QueryExecution::Parallel) {
+        ParallelForChunks(count, kMinQueriesPerTask, func);
+    } else if (count > 0) {
+        func(std::size_t{0}, count);
+    }
+}
+
+/// @brief レイとの交差位置（始点からの距離）と、その位置の面の法線
+struct RayHit final {
+    float distance = 0.0f;
+    Vector3 normal{0.0f, 0.0f, 0.0f};
+};
+
+/// @brief 始点が形状の内側にある場合のヒット（距離0、法線はレイと逆向き）
+RayHit MakeInsideRayHit(const Vector3 &direction) {
+    return RayHit{0.0f, -direction};
+}
+
+std::optional<RayHit> RaycastCircle2D(const Vector2 &origin, const Vector2 &direction, float maxDistance, const Vector2 &center, float radius) {
+    const Vector2 m = origin - center;
+    const float c = m.LengthSquared() - radius * radius;
+    if (c <= 0.0f) return MakeInsideRayHit(Vector3(direction));
+    const float b = m.Dot(direction);
+    if (b > 0.0f) return std::nullopt;
+    const float disc = b * b - c;
+    if (disc < 0.0f) return std::nullopt;
+    const float t = -b - std::sqrt(disc);
+    if (t > maxDistance) return std::nullopt;
+    const Vector2 n = (origin + direction * t - center).Normalize();
+    return RayHit{t, Vector3(n)};
+}
+
+std::optional<RayHit> RaycastRect2D(const Vector2 &origin, const Vector2 &direction, float maxDistance, const Math::Rect &rect) {
+    // 矩形のローカル座標（回転を打ち消した座標）でスラブ判定を行う
+    const float cosA = std::cos(rect.rotation);
+    const float sinA = std::sin(rect.rotation);
+    const Vector2 rel = origin - rect.center;
+    const float o[2] = {rel.x * cosA + rel.y * sinA, -rel.x * sinA + rel.y * cosA};
+    const float d[2] = {direction.x * cosA + direction.y * sinA, -direction.x * sinA + direction.y * cosA};
+    const float h[2] = {rect.halfSize.x, rect.halfSize.y};
+
+    float tEnter = -std::numeric_limits<float>::max();
+    float tExit = std::numeric_limits<float>::max();
+    int enterAxis = -1;
+    for (int i = 0; i < 2; ++i) {
+        if (std::abs(d[i]) < kQueryEpsilon) {
+            if (std::abs(o[i]) > h[i]) return std::nullopt;
+            continue;
+        }
+        float t1 = (-h[i] - o[i]) / d[i];
+        float t2 = (h[i] - o[i]) / d[i];
+        if (t1 > t2) std::swap(t1, t2);
+        if (t1 > tEnter) {
+            tEnter = t1;
+            enterAxis = i;
+        }
+        tExit = std::min(tExit, t2);
+        if (tEnter > tExit) return std::nullopt;
+    }
+    if (tExit < 0.0f) return std::nullopt;
+    if (tEnter <= 0.0f || enterAxis < 0) return MakeInsideRayHit(Vector3(direction));
+    if (tEnter > maxDistance) return std::nullopt;
+
+    const float sign = d[enterAxis] > 0.0f ? -1.0f : 1.0f;
+    const Vector2 localNormal = enterAxis == 0 ? Vector2{sign, 0.0f} : Vector2{0.0f, sign};
+    const Vector2 n{localNormal.x * cosA - localNormal.y * sinA, localNormal.x * sinA + localNormal.y * cosA};
+    return RayHit{tEnter, Vector3(n)};
+}
+
+std::optional<RayHit> RaycastSegment2D(const Vector2 &origin, const Vector2 &direction, float maxDistance, const Math::Segment2D &segment) {
+    const Vector2 e = segment.end - segment.start;
+    const float denom = direction.Cross(e);
+    if (std::abs(denom) < kQueryEpsilon) return std::nullopt;
+    const Vector2 w = segment.start - origin;
+    const float t = w.Cross(e) / denom;
+    const float u = w.Cross(direction) / denom;
+    if (t < 0.0f || t > maxDistance || u < 0.0f || u > 1.0f) return std::nullopt;
+    Vector2 n = Vector2{-e.y, e.x}.Normalize();
+    if (n.Dot(direction) > 0.0f) n = -n;
+    return RayHit{t, Vector3(n)};
+}
+
+/// @brief 2D形状とレイの交差を求める（点は面積を持たないため当たらない）
+std::optional<RayHit> RaycastShape2D(const Vector2 &origin, const Vector2 &direction, float maxDistance, const ColliderInfo2D::ShapeVariant &shape) {
+    return std::visit(
+        [&](const auto &s) -> std::optional<RayHit> {
+            using S = std::decay_t<decltype(s)>;
+            if constexpr (std::is_same_v<S, Math::Circle>) {
+                return RaycastCircle2D(origin, direction, maxDistance, s.center, s.radius);
+            } else if constexpr (std::is_same_v<S, Math::Rect>) {
+                return RaycastRect2D(origin, direction, maxDistance, s);
+            } else if constexpr (std::is_same_v<S, Math::Segment2D>) {
+                return RaycastSegment2D(origin, direction, maxDistance, s);
+            } else if constexpr (std::is_same_v<S, Math::Capsule2D>) {
+                // 両端の円と、線分方向に伸ばした矩形（胴体）のうち最も近いもの
+                const Vector2 axis = s.end - s.start;
+                const float length = axis.Length();
+                std::optional<RayHit> best = RaycastCircle2D(origin, direction, maxDistance, s.start, s.radius);
+                const auto consider = [&](const std::optional<RayHit> &hit) {
+                    if (hit && (!best || hit->distance < best->distance)) best = hit;
+                };
+                consider(RaycastCircle2D(origin, direction, maxDistance, s.end, s.radius));
+                if (length > kQueryEpsilon) {
+                    Math::Rect body;
+                    body.center = (s.start + s.end) * 0.5f;
+                    body.halfSize = Vector2{length * 0.5f, s.radius};
+                    body.rotation = std::atan2(axis.y, axis.x);
+                    consider(RaycastRect2D(origin, direction, maxDistance, body));
+                }
+                return best;
+            } else {
+                return std::nullopt;
+            }
+        },
+        shape);
+}
+
+std::optional<RayHit> RaycastSphere3D(const Vector3 &origin, const Vector3 &direction, float maxDistance, const Vector3 &center, float radius) {
+    const Vector3 m = origin - center;
+    const float c = m.LengthSquared() - radius * radius;
+    if (c <= 0.0f) return MakeInsideRayHit(direction);
+    const float b = m.Dot(direction);
+    if (b > 0.0f) return std::nullopt;
+    const float disc = b * b - c;
+    if (disc < 0.0f) return std::nullopt;
+    const float t = -b - std::sqrt(disc);
+    if (t > maxDistance) return std::nullopt;
+    return RayHit{t, (origin + direction * t - center).Normalize()};
+}
+
+std::optional<RayHit> RaycastOBB3D(const Vector3 &origin, const Vector3 &direction, float maxDistance, const Math::OBB &box) {
+    // OBBの姿勢行列の各行が軸になっている
+    const Vector3 axes[3] = {
+        Vector3{box.orientation.m[0][0], box.orientation.m[0][1], box.orientation.m[0][2]},
+        Vector3{box.orientation.m[1][0], box.orientation.m[1][1], box.orientation.m[1][2]},
+        Vector3{box.orientation.m[2][0], box.orientation.m[2][1], box.orientation.m[2][2]}};
+    const float h[3] = {box.halfSize.x, box.halfSize.y, box.halfSize.z};
+    const Vector3 rel = origin - box.center;
+
+    float tEnter = -std::numeric_limits<float>::max();
+    float tExit = std::numeric_limits<float>::max();
+    int enterAxis = -1;
+    float enterSign = 1.0f;
+    for (int i = 0; i < 3; ++i) {
+        const float o = rel.Dot(axes[i]);
+        const float d = direction.Dot(axes[i]);
+        if (std::abs(d) < kQueryEpsilon) {
+            if (std::abs(o) > h[i]) return std::nullopt;
+            continue;
+        }
+        float t1 = (-h[i] - o) / d;
+        float t2 = (h[i] - o) / d;
+        if (t1 > t2) std::swap(t1, t2);
+        if (t1 > tEnter) {
+            tEnter = t1;
+            enterAxis = i;
+            enterSign = d > 0.0f ? -1.0f : 1.0f;
+        }
+        tExit = std::min(tExit, t2);
+        if (tEnter > tExit) return std::nullopt;
+    }
+    if (tExit < 0.0f) return std::nullopt;
+    if (tEnter <= 0.0f || enterAxis < 0) return MakeInsideRayHit(direction);
+    if (tEnter > maxDistance) return std::nullopt;
+    return RayHit{tEnter, axes[enterAxis] * enterSign};
+}
+
+std::optional<RayHit> RaycastCapsule3D(const Vector3 &origin, const Vector3 &direction, float maxDistance, const Math::Capsule3D &capsule) {
+    const Vector3 segment = capsule.end - capsule.start;
+    const float length = segment.Length();
+    const Vector3 closest = CollisionAlgorithms3D::ClosestPointOnSegment(capsule.start, capsule.end, origin);
+    if ((origin - closest).LengthSquared() <= capsule.radius * capsule.radius) return MakeInsideRayHit(direction);
+
+    std::optional<RayHit> best = RaycastSphere3D(origin, direction, maxDistance, capsule.start, capsule.radius);
+    const auto consider = [&](const std::optional<RayHit> &hit) {
+        if (hit && (!best || hit->distance < best->distance)) best = hit;
+    };
+    consider(RaycastSphere3D(origin, direction, maxDistance, capsule.end, capsule.radius));
+    if (length <= kQueryEpsilon) return best;
+
+    // 胴体（無限円柱を線分の範囲で切り取ったもの）との交差
+    const Vector3 axis = segment / length;
+    const Vector3 m = origin - capsule.start;
+    const Vector3 mPerp = m - axis * m.Dot(axis);
+    const Vector3 dPerp = direction - axis * direction.Dot(axis);
+    const float a = dPerp.LengthSquared();
+    const float c = mPerp.LengthSquared() - capsule.radius * capsule.radius;
+    if (a > kQueryEpsilon) {
+        const float b = mPerp.Dot(dPerp);
+        const float disc = b * b - a * c;
+        if (disc >= 0.0f) {
+            const float t = (-b - std::sqrt(disc)) / a;
+            const float along = (m + direction * t).Dot(axis);
+            if (t >= 0.0f && t <= maxDistance && along >= 0.0f && along <= length) {
+                consider(RayHit{t, (mPerp + dPerp * t).Normalize()});
+            }
+        }
+    }
+    return best;
+}
+
+std::optional<RayHit> RaycastPrimitive3D(const Vector3 &origin, const Vector3 &direction, float maxDistance, const PrimitiveShape3D &shape) {
+    return std::visit(
+        [&](const auto &s) -> std::optional<RayHit> {
+            using S = std::decay_t<decltype(s)>;
+            if constexpr (std::is_same_v<S, Math::Sphere>) {
+                return RaycastSphere3D(origin, direction, maxDistance, s.center, s.radius);
+            } else if constexpr (std::is_same_v<S, Math::OBB>) {
+                return RaycastOBB3D(origin, direction, maxDistance, s);
+            } else {
+                return RaycastCapsule3D(origin, direction, maxDistance, s);
+            }
+        },
+        shape);
+}
+
+/// @brief 形状を平行移動させたときに最初に重なる時刻（0〜1）を求める
+/// @param hitAt 時刻tにおける接触情報を返す関数（isHitを持つ型を返す）
+/// @details 形状の最小半径を超えない間隔で区間を分割して走査し、最初に重なった区間を二分探索で詰める
+template<typename HitAt>
+auto FindTimeOfImpact(float distance, float maxStep, const HitAt &hitAt) -> std::optional<std::pair<float, decltype(hitAt(0.0f))>> {
+    auto hit = hitAt(0.0f);
+    if (hit.isHit) return std::make_pair(0.0f, hit);
+
+    const int steps = std::clamp(static_cast<int>(std::ceil(distance / maxStep)), 1, kMaxQuerySweepSubsteps);
+    for (int i = 1; i <= steps; ++i) {
+        float hi = static_cast<float>(i) / static_cast<float>(steps);
+        hit = hitAt(hi);
+        if (!hit.isHit) continue;
+
+        float lo = static_cast<float>(i - 1) / static_cast<float>(steps);
+        for (int k = 0; k < kSweepRefineIterations; ++k) {
+            const float mid = 0.5f * (lo + hi);
+            auto midHit = hitAt(mid);
+            if (midHit.isHit) {
+                hi = mid;
+                hit = midHit;
+            } else {
+                lo = mid;
+            }
+        }
+        return std::make_pair(hi, hit);
+    }
+    return std::nullopt;
+}
+
+/// @brief 3Dのスイープ・オーバーラップで判定する対象（クエリ呼び出し時点のワールド形状）
+struct QueryTarget3D {
+    std::uint32_t id = 0;
+    const ColliderInfo3D *info = nullptr;
+    PrimitiveShape3D shape;
+    Math::AABB bounds{};
+};
+
+/// @brief bounds.min.xの昇順に並べた判定対象から、X方向の範囲が重なりうるものの先頭を求める
+/// @param maxWidth 判定対象のX方向の幅の最大値
+std::size_t LowerBoundTargets3D(const std::vector<QueryTarget3D> &targets, float minX, float maxWidth) {
+    const float key = minX - maxWidth;
+    return static_cast<std::size_t>(std::lower_bound(targets.begin(), targets.end(), key,
+        [](const QueryTarget3D &t, float v) { return t.bounds.min.x < v; }) - targets.begin());
+}
+
+bool OverlapsAabb3D(const Math::AABB &a, const Math::AABB &b) {
+    return a.min.x <= b.max.x && b.min.x <= a.max.x &&
+        a.min.y <= b.max.y && b.min.y <= a.max.y &&
+        a.min.z <= b.max.z && b.min.z <= a.max.z;
+}
+
+Math::AABB CombineAabb3D(const Math::AABB &a, const Math::AABB &b) {
+    return Math::AABB{
+        Vector3{std::min(a.min.x, b.min.x), std::min(a.min.y, b.min.y), std::min(a.min.z, b.min.z)},
+        Vector3{std::max(a.max.x, b.max.x), std::max(a.max.y, b.max.y), std::max(a.max.z, b.max.z)}};
+}
+
+Math::AABB TranslateAabb3D(const Math::AABB &aabb, const Vector3 &offset) {
+    return Math::AABB{aabb.min + offset, aabb.max + offset};
+}
+
+template<typename THitInfo, typename TInfo>
+THitInfo MakeQueryHitInfo(const TInfo &info, const Vector3 &normal, float penetration) {
+    THitInfo hitInfo{};
+    hitInfo.isHit = true;
+    hitInfo.normal = normal;
+    hitInfo.penetration = penetration;
+    hitInfo.otherObject = info.ownerObject;
+    hitInfo.otherCollider = info.sourceCollider;
+    return hitInfo;
+}
+
+/// @brief クエリ呼び出し時点の3Dコライダーのワールド形状を集め、bounds.min.xの昇順に並べる
+/// @param makeShape エントリからワールド形状を求める関数（Collider::MakeWorldShape3D）
+/// @param outMaxWidth 判定対象のX方向の幅の最大値
+template<typename TColliders, typename MakeShape>
+std::vector<QueryTarget3D> CollectQueryTargets3D(const TColliders &colliders, const MakeShape &makeShape, float &outMaxWidth) {
+    std::vector<QueryTarget3D> targets;
+    targets.reserve(colliders.size());
+    outMaxWidth = 0.0f;
+    for (const auto &entry : colliders) {
+        if (!entry.info.enabled || (!entry.runtime.isNative && !entry.runtime.collider)) continue;
+        auto shape = makeShape(entry);
+        if (!shape) continue;
+        QueryTarget3D target{entry.id, &entry.info, *shape};
+        target.bounds = ComputePrimitiveBounds3D(target.shape);
+        outMaxWidth = std::max(outMaxWidth, target.bounds.max.x - target.bounds.min.x);
+        targets.push_back(std::move(target));
+    }
+    std::sort(targets.begin(), targets.end(), [](const QueryTarget3D &a, const QueryTarget3D &b) {
+        return a.bounds.min.x < b.bounds.min.x || (a.bounds.min.x == b.bounds.min.x && a.id < b.id);
+    });
+    return targets;
+}
+
 } // namespace
 
 Collider::Collider() {
@@ -443,17 +832,23 @@ Collider::Collider() {
 }
 
 Collider::~Collider() {
+    // 共有メッシュの参照を正しく返却するため、ワールド破棄前に全ランタイムを解放しておく
+    Clear3D();
     ReleaseWorld();
 }
 
 Collider::ColliderID Collider::Add(const ColliderInfo2D &info) {
     const ColliderID id = nextId_++;
+    indexById2D_[id] = colliders2D_.size();
     colliders2D_.push_back({id, info});
+    // 次のUpdate2Dを待たずにシーンクエリの対象にするため、ブロードフェーズへ登録しておく
+    if (info.enabled) broadphase2D_.UpdateProxy(id, ComputeBroadphaseAabb2D(info.shape));
     return id;
 }
 
 Collider::ColliderID Collider::Add(const ColliderInfo3D &info) {
     const ColliderID id = nextId_++;
+    indexById3D_[id] = colliders3D_.size();
     colliders3D_.push_back({id, info});
     auto &entry = colliders3D_.back();
     BuildRuntime3D(entry);
@@ -461,44 +856,62 @@ Collider::ColliderID Collider::Add(const ColliderInfo3D &info) {
 }
 
 bool Collider::Remove2D(ColliderID id) {
-    return EraseById(colliders2D_, id);
+    auto it = indexById2D_.find(id);
+    if (it == indexById2D_.end()) return false;
+    const std::size_t index = it->second;
+    colliders2D_.erase(colliders2D_.begin() + static_cast<std::ptrdiff_t>(index));
+    indexById2D_.erase(it);
+    for (std::size_t i = index; i < colliders2D_.size(); ++i) {
+        indexById2D_[colliders2D_[i].id] = i;
+    }
+    // ペアは次のUpdate2DでRemovedとして報告されるが、相手が見つからないためExitは発火しない（従来と同じ挙動）
+    broadphase2D_.RemoveProxy(id);
+    return true;
 }
 
 bool Collider::Remove3D(ColliderID id) {
-    for (auto it = colliders3D_.begin(); it != colliders3D_.end(); ++it) {
-        if (it->id == id) {
-            ReleaseRuntime3D(*it);
-            colliders3D_.erase(it);
-            return true;
-        }
+    auto it = indexById3D_.find(id);
+    if (it == indexById3D_.end()) return false;
+    const std::size_t index = it->second;
+    ReleaseRuntime3D(colliders3D_[index]);
+    colliders3D_.erase(colliders3D_.begin() + static_cast<std::ptrdiff_t>(index));
+    indexById3D_.erase(it);
+    for (std::size_t i = index; i < colliders3D_.size(); ++i) {
+        indexById3D_[colliders3D_[i].id] = i;
     }
-    return false;
+    triggerBroadphase3D_.RemoveProxy(id);
+    return true;
 }
 
 bool Collider::UpdateColliderInfo2D(ColliderID id, const ColliderInfo2D &info) {
-    for (auto &e : colliders2D_) {
-        if (e.id == id) {
-            e.info = info;
-            return true;
-        }
+    auto it = indexById2D_.find(id);
+    if (it == indexById2D_.end()) return false;
+    colliders2D_[it->second].info = info;
+    if (info.enabled) {
+        broadphase2D_.UpdateProxy(id, ComputeBroadphaseAabb2D(info.shape));
+    } else {
+        broadphase2D_.RemoveProxy(id);
     }
-    return false;
+    return true;
 }
 
 bool Collider::UpdateColliderInfo3D(ColliderID id, const ColliderInfo3D &info) {
-    for (auto &e : colliders3D_) {
-        if (e.id == id) {
-            UpdateRuntime3D(e, info);
-            e.info = info;
-            return true;
-        }
+    auto *e = Find3D(id);
+    if (!e) return false;
+    if (syncMode3D_ == SyncMode3D::Incremental) {
+        SyncRuntime3D(*e, info);
+    } else {
+        ++syncCounts3D_[static_cast<std::size_t>(ChangeKind3D::Structural)];
+        UpdateRuntime3D(*e, info);
     }
-    return false;
+    e->info = info;
+    return true;
 }
 
 void Collider::Clear2D() {
     colliders2D_.clear();
-    prevPairs2D_.clear();
+    indexById2D_.clear();
+    broadphase2D_.Clear();
 }
 
 void Collider::Clear3D() {
@@ -506,19 +919,45 @@ void Collider::Clear3D() {
         ReleaseRuntime3D(entry);
     }
     colliders3D_.clear();
+    indexById3D_.clear();
     prevPairs3D_.clear();
     frameEvents3D_.clear();
     curPairs3D_.clear();
+    triggerBroadphase3D_.Clear();
+}
+
+void Collider::SetNativeTriggers3D(bool enabled) {
+    if (nativeTriggers3D_ == enabled) return;
+    nativeTriggers3D_ = enabled;
+    // ネイティブ判定とRP3Dの間でランタイムを移し替えるため、全コライダーを作り直す
+    triggerBroadphase3D_.Clear();
+    for (auto &entry : colliders3D_) {
+        BuildRuntime3D(entry);
+    }
 }
 
 std::vector<Collider::HitPair2D> Collider::CheckAll2D() const {
     std::vector<HitPair2D> hits;
-    const auto pairs = BuildCandidatePairs2D(colliders2D_);
+
+    // constのため永続ブロードフェーズは更新せず、現在のAABBからsort-and-sweepで候補を求める
+    std::vector<std::pair<ColliderID, Aabb2D>> boxes;
+    std::vector<std::size_t> entryIndices;
+    boxes.reserve(colliders2D_.size());
+    entryIndices.reserve(colliders2D_.size());
+    for (std::size_t i = 0; i < colliders2D_.size(); ++i) {
+        const auto &c = colliders2D_[i];
+        if (!c.info.enabled) continue;
+        boxes.emplace_back(c.id, ComputeBroadphaseAabb2D(c.info.shape));
+        entryIndices.push_back(i);
+    }
+
+    std::vector<std::pair<std::size_t, std::size_t>> pairs;
+    Broadphase2D::CollectOverlappingPairs(boxes, pairs);
     hits.reserve(pairs.size());
 
-    for (const auto &pair : pairs) {
-        const auto &ai = colliders2D_[pair.a];
-        const auto &bi = colliders2D_[pair.b];
+    for (const auto &[pa, pb] : pairs) {
+        const auto &ai = colliders2D_[entryIndices[pa]];
+        const auto &bi = colliders2D_[entryIndices[pb]];
 
         if (!ai.info.enabled || !bi.info.enabled) continue;
         if (!ShouldTest(ai.info.attribute, ai.info.ignoreAttribute, bi.info.attribute) ||
@@ -596,6 +1035,21 @@ std::vector<Collider::HitPair3D> Collider::CheckAll3D() const {
     Collector collector(colliderIdByHandle, infoById, uniquePairs);
     physicsWorld_->testCollision(collector);
 
+    // ネイティブ判定のトリガーはRP3Dのワールドに無いため、判定相手のボディと個別に判定する
+    for (const auto &trigger : colliders3D_) {
+        if (!trigger.runtime.isNative || !trigger.info.enabled) continue;
+        for (const auto &other : colliders3D_) {
+            if (!IsNativeCounterpart3D(other)) continue;
+            if (!ShouldTest(trigger.info.attribute, trigger.info.ignoreAttribute, other.info.attribute) ||
+                !ShouldTest(other.info.attribute, other.info.ignoreAttribute, trigger.info.attribute)) {
+                continue;
+            }
+            if (ComputeNativeHit3D(trigger, other).isHit) {
+                uniquePairs.insert(MakePairKey(trigger.id, other.id));
+            }
+        }
+    }
+
     hits.reserve(uniquePairs.size());
     for (auto key : uniquePairs) {
         const ColliderID a = static_cast<ColliderID>(key >> 32);
@@ -630,6 +1084,10 @@ bool Collider::Check3D(ColliderID a, ColliderID b) const {
         return false;
     }
 
+    if (pa->runtime.isNative || pb->runtime.isNative) {
+        return ComputeNativeHit3D(*pa, *pb).isHit;
+    }
+
     if (!physicsWorld_ || !pa->runtime.collider || !pb->runtime.collider) return false;
 
     struct Collector final : reactphysics3d::CollisionCallback {
@@ -660,10 +1118,289 @@ bool Collider::Check3D(ColliderID a, ColliderID b) const {
 
 const ColliderInfo3D *Collider::FindInfoByHandle3D(const ColliderHandle *handle) const {
     if (!handle) return nullptr;
+    const auto id = static_cast<ColliderID>(reinterpret_cast<std::uintptr_t>(handle->getUserData()));
+    const auto *entry = Find3D(id);
+    // RigidBody3D側で追加されたコライダー等、ユーザーデータが別物の場合に備えてハンドルも照合する
+    return (entry && entry->runtime.collider == handle) ? &entry->info : nullptr;
+}
+
+void Collider::Raycast2D(std::span<const RaycastQuery2D> queries, std::vector<QueryHit2D> &outHits, QueryExecution execution) const {
+    outHits.assign(queries.size(), QueryHit2D{});
+    const auto &tree = broadphase2D_.GetTree();
+
+    RunQueries(queries.size(), execution, [&](std::size_t begin, std::size_t end) {
+        std::vector<std::int32_t> stack;
+        for (std::size_t i = begin; i < end; ++i) {
+            const auto &query = queries[i];
+            auto &result = outHits[i];
+            result.queryIndex = static_cast<std::uint32_t>(i);
+
+            const float length = query.direction.Length();
+            if (length < kQueryEpsilon || query.maxDistance < 0.0f) continue;
+            const Vector2 direction = query.direction / length;
+
+            // ヒットするたびに最大距離を縮め、それより遠いノードを走査から外す
+            tree.RayCast(query.origin, direction, query.maxDistance, stack, [&](std::int32_t proxyId, float maxDistance) {
+                const auto *entry = Find2D(tree.GetUserData(proxyId));
+                if (!entry || !entry->info.enabled) return maxDistance;
+                if (!PassesQueryFilter(query.filter, entry->info.attribute, entry->info.isTrigger, entry->info.ownerObject)) return maxDistance;
+
+                const auto hit = RaycastShape2D(query.origin, direction, maxDistance, entry->info.shape);
+                if (!hit) return maxDistance;
+                // 同じ距離のヒットは走査順に依らないよう、IDの小さい方を採用する
+                if (result.hitInfo.isHit && hit->distance == result.distance && entry->id > result.collider) return maxDistance;
+
+                result.collider = entry->id;
+                result.distance = hit->distance;
+                result.point = query.origin + direction * hit->distance;
+                result.hitInfo = MakeQueryHitInfo<HitInfo2D>(entry->info, hit->normal, 0.0f);
+                return hit->distance;
+            });
+        }
+    });
+}
+
+void Collider::Sweep2D(std::span<const SweepQuery2D> queries, std::vector<QueryHit2D> &outHits, QueryExecution execution) const {
+    outHits.assign(queries.size(), QueryHit2D{});
+    const auto &tree = broadphase2D_.GetTree();
+
+    RunQueries(queries.size(), execution, [&](std::size_t begin, std::size_t end) {
+        std::vector<std::int32_t> stack;
+        std::vector<ColliderID> candidates;
+        for (std::size_t i = begin; i < end; ++i) {
+            const auto &query = queries[i];
+            auto &result = outHits[i];
+            result.queryIndex = static_cast<std::uint32_t>(i);
+
+            const Aabb2D startBounds = ComputeBroadphaseAabb2D(query.shape);
+            const Aabb2D endBounds{
+                startBounds.minX + query.translation.x, startBounds.minY + query.translation.y,
+                startBounds.maxX + query.translation.x, startBounds.maxY + query.translation.y};
+
+            candidates.clear();
+            tree.Query(Aabb2D::Combine(startBounds, endBounds), stack, [&](std::int32_t proxyId) {
+                candidates.push_back(tree.GetUserData(proxyId));
+                return true;
+            });
+            std::sort(candidates.begin(), candidates.end());
+
+            const float distance = query.translation.Length();
+            const float maxStep = ComputeMinHalfExtent2D(query.shape);
+            float bestTime = std::numeric_limits<float>::max();
+            for (const ColliderID id : candidates) {
+                const auto *entry = Find2D(id);
+                if (!entry || !entry->info.enabled) continue;
+                if (!PassesQueryFilter(query.filter, entry->info.attribute, entry->info.isTrigger, entry->info.ownerObject)) continue;
+
+                const auto toi = FindTimeOfImpact(distance, maxStep, [&](float t) {
+                    return ComputeHit2D(TranslateShape2D(query.shape, query.translation * t), entry->info.shape);
+                });
+                if (!toi || toi->first >= bestTime) continue;
+
+                bestTime = toi->first;
+                result.collider = id;
+                result.distance = toi->first * distance;
+                // ComputeHitの法線はクエリ形状から相手へ向かうため、押し出し方向はその逆になる
+                result.hitInfo = MakeQueryHitInfo<HitInfo2D>(entry->info, -toi->second.normal, toi->second.penetration);
+            }
+        }
+    });
+}
+
+void Collider::Overlap2D(std::span<const OverlapQuery2D> queries, std::vector<QueryHit2D> &outHits, QueryExecution execution) const {
+    outHits.clear();
+    const auto &tree = broadphase2D_.GetTree();
+    std::vector<std::vector<QueryHit2D>> hitsPerQuery(queries.size());
+
+    RunQueries(queries.size(), execution, [&](std::size_t begin, std::size_t end) {
+        std::vector<std::int32_t> stack;
+        std::vector<ColliderID> candidates;
+        for (std::size_t i = begin; i < end; ++i) {
+            const auto &query = queries[i];
+            candidates.clear();
+            tree.Query(ComputeBroadphaseAabb2D(query.shape), stack, [&](std::int32_t proxyId) {
+                candidates.push_back(tree.GetUserData(proxyId));
+                return true;
+            });
+            std::sort(candidates.begin(), candidates.end());
+
+            for (const ColliderID id : candidates) {
+                const auto *entry = Find2D(id);
+                if (!entry || !entry->info.enabled) continue;
+                if (!PassesQueryFilter(query.filter, entry->info.attribute, entry->info.isTrigger, entry->info.ownerObject)) continue;
+
+                const HitInfo2D hit = ComputeHit2D(query.shape, entry->info.shape);
+                if (!hit.isHit) continue;
+                QueryHit2D result;
+                result.queryIndex = static_cast<std::uint32_t>(i);
+                result.collider = id;
+                result.hitInfo = MakeQueryHitInfo<HitInfo2D>(entry->info, -hit.normal, hit.penetration);
+                hitsPerQuery[i].push_back(result);
+            }
+        }
+    });
+
+    for (auto &hits : hitsPerQuery) {
+        outHits.insert(outHits.end(), hits.begin(), hits.end());
+    }
+}
+
+void Collider::Raycast3D(std::span<const RaycastQuery3D> queries, std::vector<QueryHit3D> &outHits, QueryExecution execution) const {
+    outHits.assign(queries.size(), QueryHit3D{});
+    for (std::size_t i = 0; i < queries.size(); ++i) {
+        outHits[i].queryIndex = static_cast<std::uint32_t>(i);
+    }
+
+    const auto normalizedDirection = [](const RaycastQuery3D &query) -> std::optional<Vector3> {
+        const float length = query.direction.Length();
+        if (length < kQueryEpsilon || query.maxDistance < 0.0f) return std::nullopt;
+        return query.direction / length;
+    };
+
+    const auto recordHit = [](QueryHit3D &result, const Entry<ColliderInfo3D> &entry, float distance, const Vector3 &point, const Vector3 &normal) {
+        // 同じ距離のヒットは走査順に依らないよう、IDの小さい方を採用する
+        if (result.hitInfo.isHit && (distance > result.distance || (distance == result.distance && entry.id > result.collider))) return;
+        result.collider = entry.id;
+        result.distance = distance;
+        result.point = point;
+        result.hitInfo = MakeQueryHitInfo<HitInfo3D>(entry.info, normal, 0.0f);
+    };
+
+    // RP3Dのワールドへの問い合わせ（ワールドが内部アロケータを共有するため常に逐次実行する）
+    if (physicsWorld_) {
+        struct Callback final : reactphysics3d::RaycastCallback {
+            const Collider *owner = nullptr;
+            const RaycastQuery3D *query = nullptr;
+            QueryHit3D *result = nullptr;
+            float maxDistance = 0.0f;
+            const decltype(recordHit) *record = nullptr;
+
+            reactphysics3d::decimal notifyRaycastHit(const reactphysics3d::RaycastInfo &info) override {
+                // ユーザーデータのコライダーIDから索引で引く（対象外のコライダーは-1を返して無視する）
+                const auto id = static_cast<ColliderID>(reinterpret_cast<std::uintptr_t>(info.collider->getUserData()));
+                const auto *entry = owner->Find3D(id);
+                if (!entry || entry->runtime.collider != info.collider || !entry->info.enabled) return -1.0f;
+                if (!PassesQueryFilter(query->filter, entry->info.attribute, entry->info.isTrigger, entry->info.ownerObject)) return -1.0f;
+
+                (*record)(*result, *entry, static_cast<float>(info.hitFraction) * maxDistance,
+                    owner->FromRp3d(info.worldPoint), owner->FromRp3d(info.worldNormal));
+                return info.hitFraction;
+            }
+        };
+
+        for (std::size_t i = 0; i < queries.size(); ++i) {
+            const auto direction = normalizedDirection(queries[i]);
+            if (!direction) continue;
+            const Vector3 end = queries[i].origin + *direction * queries[i].maxDistance;
+
+            Callback callback;
+            callback.owner = this;
+            callback.query = &queries[i];
+            callback.result = &outHits[i];
+            callback.maxDistance = queries[i].maxDistance;
+            callback.record = &recordHit;
+            physicsWorld_->raycast(reactphysics3d::Ray(ToRp3d(queries[i].origin), ToRp3d(end)), &callback);
+        }
+    }
+
+    // ネイティブ判定のトリガーはRP3Dのワールドに存在しないため、プリミティブ形状と直接判定する
+    std::vector<std::pair<const Entry<ColliderInfo3D> *, PrimitiveShape3D>> nativeTriggers;
     for (const auto &entry : colliders3D_) {
-        if (entry.runtime.collider == handle) return &entry.info;
+        if (!entry.runtime.isNative || !entry.info.enabled) continue;
+        if (auto shape = MakeWorldShape3D(entry)) nativeTriggers.emplace_back(&entry, *shape);
+    }
+    if (nativeTriggers.empty()) return;
+
+    RunQueries(queries.size(), execution, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            const auto &query = queries[i];
+            if (!query.filter.includeTriggers) continue;
+            const auto direction = normalizedDirection(query);
+            if (!direction) continue;
+
+            auto &result = outHits[i];
+            for (const auto &[entry, shape] : nativeTriggers) {
+                if (!PassesQueryFilter(query.filter, entry->info.attribute, entry->info.isTrigger, entry->info.ownerObject)) continue;
+                const float maxDistance = result.hitInfo.isHit ? result.distance : query.maxDistance;
+                const auto hit = RaycastPrimitive3D(query.origin, *direction, maxDistance, shape);
+                if (!hit) continue;
+                recordHit(result, *entry, hit->distance, query.origin + *direction * hit->distance, hit->normal);
+            }
+        }
+    });
+}
+
+void Collider::Sweep3D(std::span<const SweepQuery3D> queries, std::vector<QueryHit3D> &outHits, QueryExecution execution) const {
+    outHits.assign(queries.size(), QueryHit3D{});
+    float maxWidth = 0.0f;
+    const auto targets = CollectQueryTargets3D(colliders3D_, [this](const auto &entry) { return MakeWorldShape3D(entry); }, maxWidth);
+
+    RunQueries(queries.size(), execution, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            const auto &query = queries[i];
+            auto &result = outHits[i];
+            result.queryIndex = static_cast<std::uint32_t>(i);
+
+            const Math::AABB startBounds = ComputePrimitiveBounds3D(query.shape);
+            const Math::AABB sweptBounds = CombineAabb3D(startBounds, TranslateAabb3D(startBounds, query.translation));
+            const float distance = query.translation.Length();
+            const float maxStep = ComputeMinHalfExtentPrimitive3D(query.shape);
+
+            float bestTime = std::numeric_limits<float>::max();
+            for (std::size_t k = LowerBoundTargets3D(targets, sweptBounds.min.x, maxWidth); k < targets.size(); ++k) {
+                const auto &target = targets[k];
+                if (target.bounds.min.x > sweptBounds.max.x) break;
+                if (!OverlapsAabb3D(target.bounds, sweptBounds)) continue;
+                if (!PassesQueryFilter(query.filter, target.info->attribute, target.info->isTrigger, target.info->ownerObject)) continue;
+
+                const auto toi = FindTimeOfImpact(distance, maxStep, [&](float t) {
+                    return ComputePrimitiveHit3D(TranslatePrimitive3D(query.shape, query.translation * t), target.shape);
+                });
+                if (!toi) continue;
+                if (toi->first > bestTime || (toi->first == bestTime && target.id > result.collider)) continue;
+
+                bestTime = toi->first;
+                result.collider = target.id;
+                result.distance = toi->first * distance;
+                result.hitInfo = MakeQueryHitInfo<HitInfo3D>(*target.info, -toi->second.normal, toi->second.penetration);
+            }
+        }
+    });
+}
+
+void Collider::Overlap3D(std::span<const OverlapQuery3D> queries, std::vector<QueryHit3D> &outHits, QueryExecution execution) const {
+    outHits.clear();
+    float maxWidth = 0.0f;
+    const auto targets = CollectQueryTargets3D(colliders3D_, [this](const auto &entry) { return MakeWorldShape3D(entry); }, maxWidth);
+    std::vector<std::vector<QueryHit3D>> hitsPerQuery(queries.size());
+
+    RunQueries(queries.size(), execution, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            const auto &query = queries[i];
+            const Math::AABB bounds = ComputePrimitiveBounds3D(query.shape);
+            auto &hits = hitsPerQuery[i];
+
+            for (std::size_t k = LowerBoundTargets3D(targets, bounds.min.x, maxWidth); k < targets.size(); ++k) {
+                const auto &target = targets[k];
+                if (target.bounds.min.x > bounds.max.x) break;
+                if (!OverlapsAabb3D(target.bounds, bounds)) continue;
+                if (!PassesQueryFilter(query.filter, target.info->attribute, target.info->isTrigger, target.info->ownerObject)) continue;
+
+                const HitInfo hit = ComputePrimitiveHit3D(query.shape, target.shape);
+                if (!hit.isHit) continue;
+                QueryHit3D result;
+                result.queryIndex = static_cast<std::uint32_t>(i);
+                result.collider = target.id;
+                result.hitInfo = MakeQueryHitInfo<HitInfo3D>(*target.info, -hit.normal, hit.penetration);
+                hits.push_back(result);
+            }
+            std::sort(hits.begin(), hits.end(), [](const QueryHit3D &a, const QueryHit3D &b) { return a.collider < b.collider; });
+        }
+    });
+
+    for (auto &hits : hitsPerQuery) {
+        outHits.insert(outHits.end(), hits.begin(), hits.end());
     }
-    return nullptr;
 }
 
 std::uint64_t Collider::MakePairKey(ColliderID a, ColliderID b) {
@@ -746,78 +1483,116 @@ void Collider::Dispatch3D(ColliderID a, ColliderID b, const HitInfo3D &hitInfoA,
 }
 
 void Collider::Update2D() {
-    std::vector<std::uint64_t> cur;
+    // 有効なコライダーのAABBをブロードフェーズへ反映する（fat AABBからはみ出したものだけが木へ入れ直される）
+    for (const auto &entry : colliders2D_) {
+        if (entry.info.enabled) {
+            broadphase2D_.UpdateProxy(entry.id, ComputeBroadphaseAabb2D(entry.info.shape));
+        } else {
+            // 無効化されたコライダーのペアはRemovedとして報告され、接触中ならExitが発火する
+            broadphase2D_.RemoveProxy(entry.id);
+        }
+    }
+    broadphase2D_.UpdatePairs();
 
     // 連続衝突判定（スイープ）でのみ検出できるヒットを先に収集しておく
     // （現在位置で重なっているペアは通常判定のヒット情報を優先する）
     std::unordered_map<std::uint64_t, HitInfo2D> continuousHits;
     CollectContinuousHits2D(continuousHits);
 
-    const auto pairs = BuildCandidatePairs2D(colliders2D_);
-    cur.reserve(pairs.size());
-
-    // このフレームでDispatch済みのペア（Exitの発火漏れ・二重発火防止用）
-    std::vector<std::uint64_t> processedPairs;
-    processedPairs.reserve(pairs.size());
-
-    for (const auto &pair : pairs) {
-        const auto &ai = colliders2D_[pair.a];
-        const auto &bi = colliders2D_[pair.b];
-
-        if (!ai.info.enabled || !bi.info.enabled) continue;
-        if (!ShouldTest(ai.info.attribute, ai.info.ignoreAttribute, bi.info.attribute) ||
-            !ShouldTest(bi.info.attribute, bi.info.ignoreAttribute, ai.info.attribute)) {
+    // 狭域判定。fat AABBが重なっているペアのみを対象に、コールバックを呼ばない読み取り専用の処理として
+    // 並列に実行し、結果をペアと同じ並びの配列へ書き込む
+    auto &pairs = broadphase2D_.GetPairs();
+    narrowphase2D_.assign(pairs.size(), NarrowphaseResult2D{});
+    ParallelForChunks(pairs.size(), kMinPairsPerTask2D, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            const auto &pair = pairs[i];
+            auto &result = narrowphase2D_[i];
+            const auto *ea = Find2D(pair.a);
+            const auto *eb = Find2D(pair.b);
+            if (!ea || !eb) continue;
+            result.isValid = true;
+
+            if (!ShouldTest(ea->info.attribute, ea->info.ignoreAttribute, eb->info.attribute) ||
+                !ShouldTest(eb->info.attribute, eb->info.ignoreAttribute, ea->info.attribute)) {
+                continue;
+            }
+            result.isTested = true;
+            result.hitInfo = ComputeHit2D(ea->info.shape, eb->info.shape);
+
+            // 現在位置で重なっていなくても、スイープで通過が検出されていればヒット扱いにする
+            // （ペアはID昇順で、スイープのHitInfoも小さいID側を自分として計算されているため法線はそのまま使える）
+            if (!result.hitInfo.isHit) {
+                auto ccdIt = continuousHits.find(pair.key);
+                if (ccdIt != continuousHits.end()) result.hitInfo = ccdIt->second;
+            }
+        }
+    });
+
+    // コールバックの発火は単一スレッドで、ペアキー昇順（ペアキャッシュの並び）に行う
+    for (std::size_t i = 0; i < pairs.size(); ++i) {
+        auto &pair = pairs[i];
+        const auto &result = narrowphase2D_[i];
+        if (!result.isValid) continue;
+        continuousHits.erase(pair.key);
+
+        if (!result.isTested) {
+            // 属性の変更で判定対象外になったペアは、接触中であればExitを発火して状態を戻す
+            if (pair.isTouching) Dispatch2D(pair.a, pair.b, HitInfo2D{}, true);
+            pair.isTouching = false;
             continue;
         }
 
-        HitInfo2D hi = ComputeHit2D(ai.info.shape, bi.info.shape);
-        const std::uint64_t key = MakePairKey(ai.id, bi.id);
+        Dispatch2D(pair.a, pair.b, result.hitInfo, pair.isTouching);
+        pair.isTouching = result.hitInfo.isHit;
+    }
 
-        // 現在位置で重なっていなくても、スイープで通過が検出されていればヒット扱いにする
-        if (!hi.isHit) {
-            auto ccdIt = continuousHits.find(key);
-            if (ccdIt != continuousHits.end()) {
-                hi = ccdIt->second;
-                // スイープのHitInfoは小さいID側を自分として計算されているため、順序が逆なら法線を反転する
-                if (ai.id > bi.id) hi.normal = -hi.normal;
-            }
+    // ブロードフェーズから外れたペア（fat AABBが離れた・無効化・削除）。
+    // 高速に通過した場合はスイープのヒットを優先し、それ以外で接触中だったものはExitを発火する
+    std::vector<std::uint64_t> forcedPairs;
+    for (const auto &pair : broadphase2D_.GetRemovedPairs()) {
+        auto ccdIt = continuousHits.find(pair.key);
+        if (ccdIt != continuousHits.end()) {
+            Dispatch2D(pair.a, pair.b, ccdIt->second, pair.isTouching);
+            continuousHits.erase(ccdIt);
+            forcedPairs.push_back(pair.key);
+        } else if (pair.isTouching) {
+            Dispatch2D(pair.a, pair.b, HitInfo2D{}, true);
         }
-        continuousHits.erase(key);
-
-        const bool wasHit = std::binary_search(prevPairs2D_.begin(), prevPairs2D_.end(), key);
-        Dispatch2D(ai.id, bi.id, hi, wasHit);
-        processedPairs.push_back(key);
-
-        if (hi.isHit) cur.push_back(key);
     }
 
-    // 候補ペアに挙がらなかったスイープヒット（高速移動で現在位置が既に離れている場合）を発火する
-    for (const auto &[key, hi] : continuousHits) {
+    // ペアキャッシュに無いスイープヒット（高速移動で現在のfat AABBが既に離れている場合）を、
+    // 発火順が実行ごとに変わらないようペアキー昇順で発火する
+    std::vector<std::uint64_t> remainingKeys;
+    remainingKeys.reserve(continuousHits.size());
+    for (const auto &[key, hi] : continuousHits) remainingKeys.push_back(key);
+    std::sort(remainingKeys.begin(), remainingKeys.end());
+    for (const auto key : remainingKeys) {
         const ColliderID a = static_cast<ColliderID>(key >> 32);
         const ColliderID b = static_cast<ColliderID>(key & 0xffffffffu);
-        const bool wasHit = std::binary_search(prevPairs2D_.begin(), prevPairs2D_.end(), key);
-        Dispatch2D(a, b, hi, wasHit);
-        processedPairs.push_back(key);
-        cur.push_back(key);
+        Dispatch2D(a, b, continuousHits[key], false);
+        forcedPairs.push_back(key);
     }
 
-    // 前フレームは接触していたが、今フレームの候補に挙がらなかった（高速に離れた）ペアのExitを発火する
-    std::sort(processedPairs.begin(), processedPairs.end());
-    for (const auto key : prevPairs2D_) {
-        if (std::binary_search(processedPairs.begin(), processedPairs.end(), key)) continue;
-        const ColliderID a = static_cast<ColliderID>(key >> 32);
-        const ColliderID b = static_cast<ColliderID>(key & 0xffffffffu);
-        Dispatch2D(a, b, HitInfo2D{}, true);
+    // スイープでのみ接触したペアを次フレームへ持ち越す（離れたままなら次フレームでExitになる）
+    for (const auto key : forcedPairs) {
+        broadphase2D_.AddPair(static_cast<ColliderID>(key >> 32), static_cast<ColliderID>(key & 0xffffffffu), true);
     }
 
-    std::sort(cur.begin(), cur.end());
-    prevPairs2D_ = std::move(cur);
-
     RecordPrevPositions2D();
 }
 
 void Collider::CollectContinuousHits2D(std::unordered_map<std::uint64_t, HitInfo2D> &outHits) {
-    for (auto &entry : colliders2D_) {
+    struct SweepTarget {
+        std::size_t index = 0;
+        Vector2 delta{ 0.0f, 0.0f };
+        int substeps = 0;
+        /// @brief 前フレーム位置から現在位置までの移動経路全体を包むAABB
+        Aabb2D sweptBounds{};
+    };
+
+    std::vector<SweepTarget> targets;
+    for (std::size_t i = 0; i < colliders2D_.size(); ++i) {
+        const auto &entry = colliders2D_[i];
         if (!entry.info.continuousDetection || !entry.info.enabled) continue;
         if (!entry.hasPrevPosition) continue;
 
@@ -832,33 +1607,60 @@ void Collider::CollectContinuousHits2D(std::unordered_map<std::uint64_t, HitInfo
         const float maxStep = ComputeMinHalfExtent2D(entry.info.shape);
         if (distance <= maxStep) continue;
 
-        const int substeps = std::min(kMaxSweepSubsteps, static_cast<int>(std::ceil(distance / maxStep)));
+        SweepTarget target;
+        target.index = i;
+        target.delta = delta;
+        target.substeps = std::min(kMaxSweepSubsteps, static_cast<int>(std::ceil(distance / maxStep)));
+        const Aabb2D prevBounds{bounds->minX - delta.x, bounds->minY - delta.y, bounds->maxX - delta.x, bounds->maxY - delta.y};
+        target.sweptBounds = Aabb2D::Combine(*bounds, prevBounds);
+        targets.push_back(target);
+    }
+    if (targets.empty()) return;
+
+    // 全コライダーとの総当たりではなく、移動経路のAABBとブロードフェーズの木が重なる相手だけをスイープする。
+    // 各スイープは読み取り専用のため並列に実行し、結果はコライダーごとの配列へ書き込む
+    const auto &tree = broadphase2D_.GetTree();
+    std::vector<std::vector<std::pair<std::uint64_t, HitInfo2D>>> targetHits(targets.size());
+    ParallelForChunks(targets.size(), kMinSweepsPerTask2D, [&](std::size_t begin, std::size_t end) {
+        std::vector<std::int32_t> queryStack;
+        for (std::size_t t = begin; t < end; ++t) {
+            const auto &target = targets[t];
+            const auto &entry = colliders2D_[target.index];
+            tree.Query(target.sweptBounds, queryStack, [&](std::int32_t proxyId) {
+                const ColliderID otherId = tree.GetUserData(proxyId);
+                if (otherId == entry.id) return true;
+                const auto *other = Find2D(otherId);
+                if (!other || !other->info.enabled) return true;
+                if (!ShouldTest(entry.info.attribute, entry.info.ignoreAttribute, other->info.attribute) ||
+                    !ShouldTest(other->info.attribute, other->info.ignoreAttribute, entry.info.attribute)) {
+                    return true;
+                }
 
-        for (const auto &other : colliders2D_) {
-            if (other.id == entry.id || !other.info.enabled) continue;
-            if (!ShouldTest(entry.info.attribute, entry.info.ignoreAttribute, other.info.attribute) ||
-                !ShouldTest(other.info.attribute, other.info.ignoreAttribute, entry.info.attribute)) {
-                continue;
-            }
-            const std::uint64_t key = MakePairKey(entry.id, other.id);
-            if (outHits.contains(key)) continue; // 両方CCDの場合の二重スイープを防ぐ
-
-            // 移動経路の中間位置（終端は通常判定が受け持つ）を時刻順に判定し、最初のヒットを採用する
-            for (int i = 1; i < substeps; ++i) {
-                const float t = static_cast<float>(i) / static_cast<float>(substeps);
-                // 中間位置 = prev + delta*t。現在形状からの相対移動量へ変換して平行移動する
-                const Vector2 offset = delta * (t - 1.0f);
-                const auto sweptShape = TranslateShape2D(entry.info.shape, offset);
-                // ComputeHitは(自分, 相手)の順で「相手→自分」向きの法線を返すため、
-                // Dispatch側がID昇順で解釈できるよう小さいID側を自分として計算する
-                const HitInfo2D hit = (entry.id < other.id)
-                    ? ComputeHit2D(sweptShape, other.info.shape)
-                    : ComputeHit2D(other.info.shape, sweptShape);
-                if (hit.isHit) {
-                    outHits.emplace(key, hit);
-                    break;
+                // 移動経路の中間位置（終端は通常判定が受け持つ）を時刻順に判定し、最初のヒットを採用する
+                for (int i = 1; i < target.substeps; ++i) {
+                    const float s = static_cast<float>(i) / static_cast<float>(target.substeps);
+                    // 中間位置 = prev + delta*s。現在形状からの相対移動量へ変換して平行移動する
+                    const Vector2 offset = target.delta * (s - 1.0f);
+                    const auto sweptShape = TranslateShape2D(entry.info.shape, offset);
+                    // ComputeHitは(自分, 相手)の順で「相手→自分」向きの法線を返すため、
+                    // Dispatch側がID昇順で解釈できるよう小さいID側を自分として計算する
+                    const HitInfo2D hit = (entry.id < other->id)
+                        ? ComputeHit2D(sweptShape, other->info.shape)
+                        : ComputeHit2D(other->info.shape, sweptShape);
+                    if (hit.isHit) {
+                        targetHits[t].emplace_back(MakePairKey(entry.id, other->id), hit);
+                        break;
+                    }
                 }
-            }
+                return true;
+            });
+        }
+    });
+
+    // 両方CCDの場合の重複は、並列化前と同じくコライダーの並び順で先にあるもののヒットを優先する
+    for (const auto &hits : targetHits) {
+        for (const auto &[key, hit] : hits) {
+            outHits.emplace(key, hit);
         }
     }
 }
@@ -879,6 +1681,9 @@ void Collider::RecordPrevPositions3D() {
         if (entry.info.continuousDetection && entry.info.enabled && entry.runtime.body) {
             entry.prevPosition = FromRp3d(entry.runtime.body->getTransform().getPosition());
             entry.hasPrevPosition = true;
+        } else if (entry.info.continuousDetection && entry.info.enabled && entry.runtime.isNative) {
+            entry.prevPosition = FromRp3d(MakeTransform3D(entry.info).getPosition());
+            entry.hasPrevPosition = true;
         } else {
             entry.hasPrevPosition = false;
         }
@@ -1012,7 +1817,7 @@ void Collider::Update3D() {
         const float distance = delta.Length();
 
         // 1フレームの移動量が形状の最小半径以下なら、すり抜けは起きない（通常判定で検出できる）
-        const float maxStep = ComputeMinHalfExtent3D(entry.info.shape);
+        const float maxStep = ComputeMinHalfExtent3D(entry.runtime.shape.shape);
         if (distance <= maxStep) continue;
 
         const int substeps = std::min(kMaxSweepSubsteps, static_cast<int>(std::ceil(distance / maxStep)));
@@ -1026,6 +1831,10 @@ void Collider::Update3D() {
         entry.runtime.body->setTransform(currentTransform);
     }
 
+    if (nativeTriggers3D_) {
+        CollectNativeTriggerHits3D();
+    }
+
     std::sort(curPairs3D_.begin(), curPairs3D_.end());
     curPairs3D_.erase(std::unique(curPairs3D_.begin(), curPairs3D_.end()), curPairs3D_.end());
 
@@ -1055,25 +1864,166 @@ void Collider::Update3D() {
     RecordPrevPositions3D();
 }
 
-const Collider::Entry<ColliderInfo2D> *Collider::Find2D(ColliderID id) const {
-    for (const auto &e : colliders2D_) {
-        if (e.id == id) return &e;
+void Collider::CollectNativeTriggerHits3D() {
+    struct NativeProxy3D {
+        const Entry<ColliderInfo3D> *entry = nullptr;
+        PrimitiveShape3D shape;
+        /// @brief 連続衝突判定用の前フレームからの移動量と分割数（分割数0はスイープしない）
+        Vector3 sweepDelta{0.0f, 0.0f, 0.0f};
+        int substeps = 0;
+    };
+
+    std::unordered_map<ColliderID, NativeProxy3D> proxies;
+    proxies.reserve(triggerBroadphase3D_.GetProxyCount());
+
+    for (const auto &entry : colliders3D_) {
+        const bool isTrigger = entry.runtime.isNative && entry.info.enabled;
+        if (!isTrigger && !IsNativeCounterpart3D(entry)) {
+            triggerBroadphase3D_.RemoveProxy(entry.id);
+            continue;
+        }
+        auto shape = MakeWorldShape3D(entry);
+        if (!shape) {
+            triggerBroadphase3D_.RemoveProxy(entry.id);
+            continue;
+        }
+
+        NativeProxy3D proxy{&entry, *shape};
+        Math::AABB bounds = ComputePrimitiveBounds3D(proxy.shape);
+
+        // 1フレームで形状サイズを超えて移動した場合は、移動経路全体をブロードフェーズに登録してスイープする
+        if (entry.info.continuousDetection && entry.hasPrevPosition) {
+            const Vector3 currentPosition = isTrigger
+                ? FromRp3d(MakeTransform3D(entry.info).getPosition())
+                : FromRp3d(entry.runtime.body->getTransform().getPosition());
+            const Vector3 delta = currentPosition - entry.prevPosition;
+            const float distance = delta.Length();
+            const float maxStep = ComputeMinHalfExtentPrimitive3D(proxy.shape);
+            if (distance > maxStep) {
+                proxy.sweepDelta = delta;
+                proxy.substeps = std::min(kMaxSweepSubsteps, static_cast<int>(std::ceil(distance / maxStep)));
+                bounds.min = Vector3{
+                    std::min(bounds.min.x, bounds.min.x - delta.x),
+                    std::min(bounds.min.y, bounds.min.y - delta.y),
+                    std::min(bounds.min.z, bounds.min.z - delta.z)};
+                bounds.max = Vector3{
+                    std::max(bounds.max.x, bounds.max.x - delta.x),
+                    std::max(bounds.max.y, bounds.max.y - delta.y),
+                    std::max(bounds.max.z, bounds.max.z - delta.z)};
+            }
+        }
+
+        triggerBroadphase3D_.SetProxy(
+            entry.id,
+            isTrigger ? TriggerBroadphase3D::ProxyKind::Trigger : TriggerBroadphase3D::ProxyKind::Body,
+            bounds);
+        proxies.emplace(entry.id, std::move(proxy));
+    }
+
+    nativePairs3D_.clear();
+    triggerBroadphase3D_.CollectPairs(nativePairs3D_);
+
+    for (const auto &[idA, idB] : nativePairs3D_) {
+        const auto itA = proxies.find(idA);
+        const auto itB = proxies.find(idB);
+        if (itA == proxies.end() || itB == proxies.end()) continue;
+        const auto &pa = itA->second;
+        const auto &pb = itB->second;
+
+        if (!ShouldTest(pa.entry->info.attribute, pa.entry->info.ignoreAttribute, pb.entry->info.attribute) ||
+            !ShouldTest(pb.entry->info.attribute, pb.entry->info.ignoreAttribute, pa.entry->info.attribute)) {
+            continue;
+        }
+
+        HitInfo hit = ComputePrimitiveHit3D(pa.shape, pb.shape);
+
+        // 現在位置で重なっていなければ、移動した側の経路の中間位置を時刻順に判定する（終端は上で判定済み）
+        if (!hit.isHit && (pa.substeps > 0 || pb.substeps > 0)) {
+            const bool moverIsA = pa.substeps > 0;
+            const auto &mover = moverIsA ? pa : pb;
+            const auto &other = moverIsA ? pb : pa;
+            for (int i = 1; i < mover.substeps; ++i) {
+                const float t = static_cast<float>(i) / static_cast<float>(mover.substeps);
+                const auto swept = TranslatePrimitive3D(mover.shape, mover.sweepDelta * (t - 1.0f));
+                hit = moverIsA ? ComputePrimitiveHit3D(swept, other.shape) : ComputePrimitiveHit3D(other.shape, swept);
+                if (hit.isHit) break;
+            }
+        }
+        if (!hit.isHit) continue;
+
+        // RP3Dの経路と同じく、各コライダーが受け取る法線は「相手から自分へ向かう方向」にする
+        HitInfo3D hitInfoB{};
+        hitInfoB.isHit = true;
+        hitInfoB.normal = hit.normal;
+        hitInfoB.penetration = hit.penetration;
+        HitInfo3D hitInfoA = hitInfoB;
+        hitInfoA.normal = -hit.normal;
+
+        frameEvents3D_.push_back({idA, idB, hitInfoA, hitInfoB});
+        curPairs3D_.push_back(MakePairKey(idA, idB));
     }
-    return nullptr;
 }
 
-const Collider::Entry<ColliderInfo3D> *Collider::Find3D(ColliderID id) const {
-    for (const auto &e : colliders3D_) {
-        if (e.id == id) return &e;
+bool Collider::IsNativeTrigger3D(const ColliderInfo3D &info) const {
+    if (!nativeTriggers3D_ || !info.isTrigger) return false;
+    const bool isPrimitive =
+        std::holds_alternative<ColliderInfo3D::SphereShape3D>(info.shape) ||
+        std::holds_alternative<ColliderInfo3D::BoxShape3D>(info.shape) ||
+        std::holds_alternative<ColliderInfo3D::CapsuleShape3D>(info.shape);
+    // RigidBody3Dに取り付けるコライダーは物理挙動の一部になるためRP3Dで扱う
+    return isPrimitive && ResolveAttachedBody3D(info) == nullptr;
+}
+
+bool Collider::IsNativeCounterpart3D(const Entry<ColliderInfo3D> &entry) const {
+    if (!entry.info.enabled || !entry.runtime.body || !entry.runtime.collider) return false;
+    // RP3Dは静的ボディ同士・スリープ中のボディと静的ボディの組を判定しないため、それに合わせる
+    const auto *body = entry.runtime.body;
+    return body->getType() != reactphysics3d::BodyType::STATIC && body->isActive() && !body->isSleeping();
+}
+
+std::optional<Collider::PrimitiveShape3D> Collider::MakeWorldShape3D(const Entry<ColliderInfo3D> &entry) const {
+    if (entry.runtime.isNative) {
+        return MakePrimitiveShape3D(entry.info.shape, MakeTransform3D(entry.info));
+    }
+    if (!entry.runtime.collider) return std::nullopt;
+
+    if (auto shape = MakePrimitiveShape3D(entry.info.shape, entry.runtime.collider->getLocalToWorldTransform())) {
+        return shape;
     }
-    return nullptr;
+    // メッシュ・ハイトフィールドはRP3Dが管理するワールドAABBを箱として近似する
+    const auto aabb = entry.runtime.collider->getWorldAABB();
+    Math::OBB obb;
+    obb.center = FromRp3d(aabb.getCenter());
+    obb.halfSize = FromRp3d(aabb.getExtent()) * 0.5f;
+    obb.orientation = Matrix4x4::Identity();
+    return obb;
+}
+
+HitInfo Collider::ComputeNativeHit3D(const Entry<ColliderInfo3D> &a, const Entry<ColliderInfo3D> &b) const {
+    const bool isTargetPair =
+        (a.runtime.isNative && a.info.enabled && IsNativeCounterpart3D(b)) ||
+        (b.runtime.isNative && b.info.enabled && IsNativeCounterpart3D(a));
+    if (!isTargetPair) return HitInfo{};
+
+    const auto shapeA = MakeWorldShape3D(a);
+    const auto shapeB = MakeWorldShape3D(b);
+    if (!shapeA || !shapeB) return HitInfo{};
+    return ComputePrimitiveHit3D(*shapeA, *shapeB);
+}
+
+const Collider::Entry<ColliderInfo2D> *Collider::Find2D(ColliderID id) const {
+    auto it = indexById2D_.find(id);
+    return (it != indexById2D_.end()) ? &colliders2D_[it->second] : nullptr;
+}
+
+const Collider::Entry<ColliderInfo3D> *Collider::Find3D(ColliderID id) const {
+    auto it = indexById3D_.find(id);
+    return (it != indexById3D_.end()) ? &colliders3D_[it->second] : nullptr;
 }
 
 Collider::Entry<ColliderInfo3D> *Collider::Find3D(ColliderID id) {
-    for (auto &e : colliders3D_) {
-        if (e.id == id) return &e;
-    }
-    return nullptr;
+    auto it = indexById3D_.find(id);
+    return (it != indexById3D_.end()) ? &colliders3D_[it->second] : nullptr;
 }
 
 void Collider::StepPhysics(float timeStep) {
@@ -1103,20 +2053,20 @@ bool Collider::BuildRuntime3D(Entry<ColliderInfo3D> &entry) {
 
     ReleaseRuntime3D(entry);
 
+    // プリミティブ形状のトリガーはRP3Dのボディを生成せず、Update3Dでネイティブ判定する
+    if (IsNativeTrigger3D(entry.info)) {
+        entry.runtime.isNative = true;
+        return true;
+    }
+    triggerBroadphase3D_.RemoveProxy(entry.id);
+
     auto shapeHandle = CreateShape3D(entry.info);
     if (!shapeHandle.has_value()) return false;
 
     entry.runtime.shape = shapeHandle.value();
     const auto transform = MakeTransform3D(entry.info);
-    // RigidBody3Dが使用コライダーを明示的に選択している場合は、そのコライダーだけを
-    // RigidBodyへ取り付ける（未選択の場合は従来通りどのコライダーでも取り付ける）
-    auto *rb = entry.info.ownerObject->GetComponent<RigidBody3D>();
-    if (rb) {
-        auto *selected = rb->GetSelectedCollider();
-        if (selected && selected != entry.info.sourceCollider) rb = nullptr;
-    }
-    if (rb) {
-        entry.runtime.body = rb->GetRigidBody();
+    if (auto *attachedBody = ResolveAttachedBody3D(entry.info)) {
+        entry.runtime.body = attachedBody;
         entry.runtime.ownsBody = false;
         entry.runtime.body->setTransform(transform);
     } else {
@@ -1164,11 +2114,18 @@ void Collider::ReleaseRuntime3D(Entry<ColliderInfo3D> &entry) {
                     physicsCommon_.destroyCapsuleShape(static_cast<reactphysics3d::CapsuleShape *>(entry.runtime.shape.shape));
                 } else if constexpr (std::is_same_v<S, ColliderInfo3D::ConvexMeshShape3D>) {
                     physicsCommon_.destroyConvexMeshShape(static_cast<reactphysics3d::ConvexMeshShape *>(entry.runtime.shape.shape));
-                    if (entry.runtime.shape.convexMesh) {
+                    if (entry.runtime.shape.isSharedMesh) {
+                        meshCache_.Release(entry.runtime.shape.sharedModelHandle, entry.runtime.shape.sharedModelRevision, true);
+                    } else if (entry.runtime.shape.convexMesh) {
                         physicsCommon_.destroyConvexMesh(entry.runtime.shape.convexMesh);
                     }
                 } else if constexpr (std::is_same_v<S, ColliderInfo3D::ConcaveMeshShape3D>) {
                     physicsCommon_.destroyConcaveMeshShape(static_cast<reactphysics3d::ConcaveMeshShape *>(entry.runtime.shape.shape));
+                    if (entry.runtime.shape.isSharedMesh) {
+                        meshCache_.Release(entry.runtime.shape.sharedModelHandle, entry.runtime.shape.sharedModelRevision, false);
+                    } else if (entry.runtime.shape.triangleMesh) {
+                        physicsCommon_.destroyTriangleMesh(entry.runtime.shape.triangleMesh);
+                    }
                 } else if constexpr (std::is_same_v<S, ColliderInfo3D::HeightFieldShape3D>) {
                     physicsCommon_.destroyHeightFieldShape(static_cast<reactphysics3d::HeightFieldShape *>(entry.runtime.shape.shape));
                     if (entry.runtime.shape.heightField) {
@@ -1198,6 +2155,143 @@ bool Collider::UpdateColliderTransform3D(Entry<ColliderInfo3D> &entry, const Col
     return true;
 }
 
+bool Collider::SyncRuntime3D(Entry<ColliderInfo3D> &entry, const ColliderInfo3D &info) {
+    const SyncState3D target = MakeSyncState3D(info);
+    const ChangeKind3D change = ClassifyChange3D(entry.info, GetSyncState3D(entry), info, target);
+    ++syncCounts3D_[static_cast<std::size_t>(change)];
+    if (change == ChangeKind3D::Structural) {
+        return UpdateRuntime3D(entry, info);
+    }
+
+    // 形状の寸法変更はRP3D側で形状を共有しているコライダーのAABBも更新されるため、
+    // 先に寸法を反映してからTransformを反映する
+    if (change == ChangeKind3D::ShapeParameter) {
+        if (!ApplyShapeParameter3D(entry, info)) {
+            return UpdateRuntime3D(entry, info);
+        }
+    }
+
+    // 同値のsetTransformでもRP3Dはボディを起こしてブロードフェーズを更新してしまうため、
+    // 現在のボディと差分がある場合だけ反映する（寸法変更と同時に動いた場合も含む）
+    if (change != ChangeKind3D::None && entry.runtime.body->getTransform() != target.transform) {
+        entry.runtime.body->setTransform(target.transform);
+    }
+
+    ApplyRuntimeFlags3D(entry, info);
+    return true;
+}
+
+Collider::ChangeKind3D Collider::ClassifyChange3D(
+    const ColliderInfo3D &previous, const SyncState3D &current, const ColliderInfo3D &next, const SyncState3D &target) {
+    // ネイティブ判定とRP3Dの間で移る場合は作り直す。ネイティブ判定のまま変わらない場合は
+    // 反映先のランタイムが無い（Update3Dで毎フレーム情報から形状を求める）
+    if (current.isNative != target.isNative) return ChangeKind3D::Structural;
+    if (current.isNative) return ChangeKind3D::None;
+
+    // 前回の構築に失敗している場合は、差分ではなく作り直しで再試行する
+    if (!current.hasRuntime) return ChangeKind3D::Structural;
+    if (previous.shape.index() != next.shape.index()) return ChangeKind3D::Structural;
+    if (previous.ownerObject != next.ownerObject || previous.sourceCollider != next.sourceCollider) {
+        return ChangeKind3D::Structural;
+    }
+
+    // RigidBody3Dの追加・削除や使用コライダーの選択変更で、取り付け先のボディが変わった場合
+    if (current.attachedBody != target.attachedBody) return ChangeKind3D::Structural;
+
+    const ChangeKind3D shapeChange = std::visit(
+        [&](const auto &after) -> ChangeKind3D {
+            using S = std::decay_t<decltype(after)>;
+            const auto &before = std::get<S>(previous.shape);
+
+            if constexpr (std::is_same_v<S, ColliderInfo3D::SphereShape3D>) {
+                return (before.radius != after.radius) ? ChangeKind3D::ShapeParameter : ChangeKind3D::None;
+            } else if constexpr (std::is_same_v<S, ColliderInfo3D::BoxShape3D>) {
+                return (before.halfExtents != after.halfExtents) ? ChangeKind3D::ShapeParameter : ChangeKind3D::None;
+            } else if constexpr (std::is_same_v<S, ColliderInfo3D::CapsuleShape3D>) {
+                return (before.radius != after.radius || before.height != after.height) ? ChangeKind3D::ShapeParameter : ChangeKind3D::None;
+            } else if constexpr (std::is_same_v<S, ColliderInfo3D::HeightFieldShape3D>) {
+                if (before.width != after.width || before.length != after.length ||
+                    before.minHeight != after.minHeight || before.maxHeight != after.maxHeight ||
+                    before.heights != after.heights) {
+                    return ChangeKind3D::Structural;
+                }
+                // 高さのスケールはHeightField生成時に焼き込まれるため、Y方向のスケール変更は再構築する
+                if (before.scale.y != after.scale.y) return ChangeKind3D::Structural;
+                return (before.scale != after.scale) ? ChangeKind3D::ShapeParameter : ChangeKind3D::None;
+            } else {
+                // ConvexMeshShape3D / ConcaveMeshShape3D（共有メッシュの場合はvertices/indicesは空）
+                // モデルの再登録・ハンドルの再利用で世代が変わった場合は、新しい頂点からメッシュを作り直す
+                if (before.modelHandle != after.modelHandle || before.modelRevision != after.modelRevision) {
+                    return ChangeKind3D::Structural;
+                }
+                if (before.vertices != after.vertices || before.indices != after.indices) return ChangeKind3D::Structural;
+                return (before.scale != after.scale) ? ChangeKind3D::ShapeParameter : ChangeKind3D::None;
+            }
+        },
+        next.shape);
+    if (shapeChange != ChangeKind3D::None) return shapeChange;
+
+    // 位置・回転はメッシュ系の形状では情報側に持たず、MakeTransform3Dが同期元のTransformから求めるため、
+    // 前回の情報同士ではなく実際のボディの状態と比較する
+    if (current.transform != target.transform) return ChangeKind3D::Transform;
+    return ChangeKind3D::None;
+}
+
+Collider::SyncState3D Collider::GetSyncState3D(const Entry<ColliderInfo3D> &entry) const {
+    const auto &runtime = entry.runtime;
+    SyncState3D state;
+    state.isNative = runtime.isNative;
+    state.hasRuntime = runtime.body && runtime.collider && runtime.shape.shape;
+    state.attachedBody = runtime.ownsBody ? nullptr : runtime.body;
+    if (runtime.body) state.transform = runtime.body->getTransform();
+    return state;
+}
+
+Collider::SyncState3D Collider::MakeSyncState3D(const ColliderInfo3D &info) const {
+    SyncState3D state;
+    state.isNative = IsNativeTrigger3D(info);
+    state.attachedBody = ResolveAttachedBody3D(info);
+    state.transform = MakeTransform3D(info);
+    return state;
+}
+
+bool Collider::ApplyShapeParameter3D(Entry<ColliderInfo3D> &entry, const ColliderInfo3D &info) {
+    auto *shape = entry.runtime.shape.shape;
+    if (!shape) return false;
+
+    return std::visit(
+        [&](const auto &next) -> bool {
+            using S = std::decay_t<decltype(next)>;
+            if constexpr (std::is_same_v<S, ColliderInfo3D::SphereShape3D>) {
+                static_cast<reactphysics3d::SphereShape *>(shape)->setRadius(next.radius);
+            } else if constexpr (std::is_same_v<S, ColliderInfo3D::BoxShape3D>) {
+                static_cast<reactphysics3d::BoxShape *>(shape)->setHalfExtents(ToRp3d(next.halfExtents));
+            } else if constexpr (std::is_same_v<S, ColliderInfo3D::CapsuleShape3D>) {
+                auto *capsule = static_cast<reactphysics3d::CapsuleShape *>(shape);
+                capsule->setRadius(next.radius);
+                capsule->setHeight(next.height);
+            } else if constexpr (std::is_same_v<S, ColliderInfo3D::ConvexMeshShape3D>) {
+                static_cast<reactphysics3d::ConvexMeshShape *>(shape)->setScale(ToRp3d(next.scale));
+            } else if constexpr (std::is_same_v<S, ColliderInfo3D::ConcaveMeshShape3D>) {
+                static_cast<reactphysics3d::ConcaveMeshShape *>(shape)->setScale(ToRp3d(next.scale));
+            } else if constexpr (std::is_same_v<S, ColliderInfo3D::HeightFieldShape3D>) {
+                static_cast<reactphysics3d::HeightFieldShape *>(shape)->setScale(ToRp3d(next.scale));
+            }
+            return true;
+        },
+        info.shape);
+}
+
+void Collider::ApplyRuntimeFlags3D(Entry<ColliderInfo3D> &entry, const ColliderInfo3D &info) {
+    if (entry.runtime.collider && entry.info.isTrigger != info.isTrigger) {
+        entry.runtime.collider->setIsSimulationCollider(!info.isTrigger);
+    }
+    // RigidBody3Dのボディの有効状態はRigidBody3D側の管理とし、自前で生成したボディだけを切り替える
+    if (entry.runtime.body && entry.runtime.ownsBody && entry.info.enabled != info.enabled) {
+        entry.runtime.body->setIsActive(info.enabled);
+    }
+}
+
 std::optional<Collider::ShapeHandle3D> Collider::CreateShape3D(const ColliderInfo3D &info) {
     ShapeHandle3D handle{};
 
@@ -1212,54 +2306,37 @@ std::optional<Collider::ShapeHandle3D> Collider::CreateShape3D(const ColliderInf
             } else if constexpr (std::is_same_v<S, ColliderInfo3D::CapsuleShape3D>) {
                 handle.shape = physicsCommon_.createCapsuleShape(shape.radius, shape.height);
             } else if constexpr (std::is_same_v<S, ColliderInfo3D::ConvexMeshShape3D>) {
-                if (shape.vertices.empty() || shape.indices.empty()) return;
-
-                constexpr std::uint32_t kVertexStride = sizeof(Vector3);
-                constexpr std::uint32_t kIndexStride = sizeof(std::uint32_t);
-                const std::uint32_t polygonCount = static_cast<std::uint32_t>(shape.indices.size() / 3);
-
-                std::vector<reactphysics3d::PolygonVertexArray::PolygonFace> faces;
-                faces.resize(polygonCount);
-                for (std::uint32_t i = 0; i < polygonCount; ++i) {
-                    faces[i].indexBase = i * 3;
-                    faces[i].nbVertices = 3;
+                if (shape.modelHandle != 0) {
+                    // 同じモデルを使う全インスタンスで凸包を共有し、インスタンスごとの違いはスケールのみで表す
+                    handle.convexMesh = meshCache_.AcquireConvex(shape.modelHandle, shape.modelRevision);
+                    handle.isSharedMesh = (handle.convexMesh != nullptr);
+                    handle.sharedModelHandle = shape.modelHandle;
+                    handle.sharedModelRevision = shape.modelRevision;
+                } else {
+                    handle.convexMesh = CollisionMeshCache::CreateConvexMesh(
+                        physicsCommon_,
+                        shape.vertices.data(), static_cast<std::uint32_t>(shape.vertices.size()), static_cast<std::uint32_t>(sizeof(Vector3)),
+                        shape.indices.data(), static_cast<std::uint32_t>(shape.indices.size()));
                 }
-
-                reactphysics3d::PolygonVertexArray array(
-                    static_cast<std::uint32_t>(shape.vertices.size()),
-                    reinterpret_cast<const reactphysics3d::Vector3 *>(shape.vertices.data()),
-                    kVertexStride,
-                    shape.indices.data(),
-                    kIndexStride,
-                    polygonCount,
-                    faces.data(),
-                    reactphysics3d::PolygonVertexArray::VertexDataType::VERTEX_FLOAT_TYPE,
-                    reactphysics3d::PolygonVertexArray::IndexDataType::INDEX_INTEGER_TYPE);
-
-                std::vector<reactphysics3d::Message> messages;
-                handle.convexMesh = physicsCommon_.createConvexMesh(array, messages);
                 if (handle.convexMesh) {
                     handle.shape = physicsCommon_.createConvexMeshShape(handle.convexMesh, ToRp3d(shape.scale));
                 }
             } else if constexpr (std::is_same_v<S, ColliderInfo3D::ConcaveMeshShape3D>) {
-                /*if (shape.vertices.empty() || shape.indices.empty()) return;
-                constexpr std::uint32_t kVertexStride = sizeof(Vector3);
-                constexpr std::uint32_t kIndexStride = sizeof(std::uint32_t);
-                reactphysics3d::TriangleVertexArray array(
-                    static_cast<std::uint32_t>(shape.vertices.size() / 3),
-                    shape.vertices.data(),
-                    kVertexStride * 3,
-                    static_cast<std::uint32_t>(shape.indices.size() / 3),
-                    shape.indices.data(),
-                    kIndexStride * 3,
-                    reactphysics3d::TriangleVertexArray::VertexDataType::VERTEX_FLOAT_TYPE,
-                    reactphysics3d::TriangleVertexArray::IndexDataType::INDEX_INTEGER_TYPE);
-                std::vector<reactphysics3d::Message> messages;
-                reactphysics3d::TriangleMesh *mesh = physicsCommon_.createTriangleMesh(array, messages);
-                handle.concaveMesh = physicsCommon_.createConcaveMeshShape(mesh, ToRp3d(shape.scale));
-                if (handle.concaveMesh) {
+                if (shape.modelHandle != 0) {
+                    handle.triangleMesh = meshCache_.AcquireTriangle(shape.modelHandle, shape.modelRevision);
+                    handle.isSharedMesh = (handle.triangleMesh != nullptr);
+                    handle.sharedModelHandle = shape.modelHandle;
+                    handle.sharedModelRevision = shape.modelRevision;
+                } else {
+                    handle.triangleMesh = CollisionMeshCache::CreateTriangleMesh(
+                        physicsCommon_,
+                        shape.vertices.data(), static_cast<std::uint32_t>(shape.vertices.size()), static_cast<std::uint32_t>(sizeof(Vector3)),
+                        shape.indices.data(), static_cast<std::uint32_t>(shape.indices.size()));
+                }
+                if (handle.triangleMesh) {
+                    handle.concaveMesh = physicsCommon_.createConcaveMeshShape(handle.triangleMesh, ToRp3d(shape.scale));
                     handle.shape = handle.concaveMesh;
-                }*/
+                }
             } else if constexpr (std::is_same_v<S, ColliderInfo3D::HeightFieldShape3D>) {
                 if (shape.heights.empty() || shape.width == 0 || shape.length == 0) return;
                 std::vector<reactphysics3d::Message> messages;
@@ -1277,7 +2354,19 @@ std::optional<Collider::ShapeHandle3D> Collider::CreateShape3D(const ColliderInf
         },
         info.shape);
 
-    if (!handle.shape) return std::nullopt;
+    if (!handle.shape) {
+        // 形状の生成に失敗した場合でも、取得済みのメッシュは返却・破棄しておく
+        if (handle.isSharedMesh) {
+            meshCache_.Release(handle.sharedModelHandle, handle.sharedModelRevision, handle.convexMesh != nullptr);
+        } else if (handle.convexMesh) {
+            physicsCommon_.destroyConvexMesh(handle.convexMesh);
+        } else if (handle.triangleMesh) {
+            physicsCommon_.destroyTriangleMesh(handle.triangleMesh);
+        } else if (handle.heightField) {
+            physicsCommon_.destroyHeightField(handle.heightField);
+        }
+        return std::nullopt;
+    }
     return handle;
 }
 
@@ -1298,14 +2387,12 @@ reactphysics3d::Transform Collider::MakeTransform3D(const ColliderInfo3D &info)
 
     // ConvexMeshShape3D/ConcaveMeshShape3D/HeightFieldShape3Dは形状側に位置を持たない
     // （頂点はオブジェクトのローカル座標系のまま）ため、コライダーの同期設定を考慮した位置を使用する
-    if (!hasOwnCenter && info.sourceCollider) {
-        center = info.sourceCollider->GetSyncedOwnerPosition();
-    }
-
     reactphysics3d::Quaternion rotation = reactphysics3d::Quaternion::identity();
-    if (info.sourceCollider) {
-        const auto rot = info.sourceCollider->GetSyncedOwnerRotation();
-        rotation = reactphysics3d::Quaternion(rot.x, rot.y, rot.z, rot.w);
+    Vector3 ownerPosition{0.0f, 0.0f, 0.0f};
+    Quaternion ownerRotation = Quaternion::Identity();
+    if (GetSyncedOwnerPose3D(info, ownerPosition, ownerRotation)) {
+        if (!hasOwnCenter) center = ownerPosition;
+        rotation = reactphysics3d::Quaternion(ownerRotation.x, ownerRotation.y, ownerRotation.z, ownerRotation.w);
     }
     return reactphysics3d::Transform(ToRp3d(center), rotation);
 }
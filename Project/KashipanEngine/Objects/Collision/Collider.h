@@ -1,20 +1,32 @@
 #pragma once
 
+#include <array>
 #include <bitset>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <optional>
+#include <span>
 #include <unordered_map>
+#include <utility>
 #include <variant>
 #include <vector>
 
+#include "Math/Quaternion.h"
+#include "Math/Vector2.h"
 #include "Math/Vector3.h"
 
+#include "Objects/Collision/Broadphase2D.h"
+#include "Objects/Collision/CollisionMeshCache.h"
+#include "Objects/Collision/TriggerBroadphase3D.h"
 #include "Objects/MathObjects/2D/Capsule2D.h"
 #include "Objects/MathObjects/2D/Circle.h"
 #include "Objects/MathObjects/2D/Point2D.h"
 #include "Objects/MathObjects/2D/Rect.h"
 #include "Objects/MathObjects/2D/Segment.h"
+#include "Objects/MathObjects/3D/Capsule3D.h"
+#include "Objects/MathObjects/3D/OBB.h"
+#include "Objects/MathObjects/3D/Sphere.h"
 
 #include <reactphysics3d/reactphysics3d.h>
 
@@ -105,12 +117,22 @@ struct ColliderInfo3D final {
         std::vector<Vector3> vertices{};
         std::vector<std::uint32_t> indices{};
         Vector3 scale{1.0f, 1.0f, 1.0f};
+        /// @brief 共有メッシュキャッシュから取得するモデルのハンドル（0以外の場合はvertices/indicesを使わない）
+        std::uint32_t modelHandle = 0;
+        /// @brief modelHandleに登録されているモデルの世代番号（ModelManager::GetModelRevision）
+        /// @details モデルの再登録やハンドルの再利用を検出し、衝突判定メッシュを作り直すために使う
+        std::uint32_t modelRevision = 0;
     };
 
     struct ConcaveMeshShape3D final {
         std::vector<Vector3> vertices{};
         std::vector<std::uint32_t> indices{};
         Vector3 scale{ 1.0f, 1.0f, 1.0f };
+        /// @brief 共有メッシュキャッシュから取得するモデルのハンドル（0以外の場合はvertices/indicesを使わない）
+        std::uint32_t modelHandle = 0;
+        /// @brief modelHandleに登録されているモデルの世代番号（ModelManager::GetModelRevision）
+        /// @details モデルの再登録やハンドルの再利用を検出し、衝突判定メッシュを作り直すために使う
+        std::uint32_t modelRevision = 0;
     };
 
     struct HeightFieldShape3D final {
@@ -149,6 +171,91 @@ struct ColliderInfo3D final {
     bool continuousDetection = false;
 };
 
+/// @brief シーンクエリ（レイキャスト・スイープ・オーバーラップ）の対象を絞り込む条件
+struct QueryFilter final {
+    /// @brief いずれかの属性を持つコライダーを対象外にする（コライダー同士のignoreAttributeと同じ規則）
+    std::bitset<ColliderInfo3D::kMaxAttributes> ignoreAttribute{};
+    /// @brief トリガーも対象にするか
+    bool includeTriggers = true;
+    /// @brief 対象外にするオブジェクト（撃った本人など。nullptrの場合は除外しない）
+    const EmptyObject* ignoreObject = nullptr;
+};
+
+/// @brief シーンクエリの実行方法
+enum class QueryExecution {
+    /// @brief 呼び出し元スレッドで順に処理する
+    Serial,
+    /// @brief クエリをチャンクに分けてスレッドプールで並列に処理する（結果の並びはSerialと同じ）
+    Parallel,
+};
+
+/// @brief シーンクエリで使う3Dのワールド座標の形状（点は半径0の球で表す）
+using QueryShape3D = std::variant<Math::Sphere, Math::OBB, Math::Capsule3D>;
+
+struct RaycastQuery2D final {
+    Vector2 origin{0.0f, 0.0f};
+    /// @brief レイの方向（内部で正規化する）
+    Vector2 direction{1.0f, 0.0f};
+    float maxDistance = 1.0f;
+    QueryFilter filter{};
+};
+
+struct RaycastQuery3D final {
+    Vector3 origin{0.0f, 0.0f, 0.0f};
+    /// @brief レイの方向（内部で正規化する）
+    Vector3 direction{0.0f, -1.0f, 0.0f};
+    float maxDistance = 1.0f;
+    QueryFilter filter{};
+};
+
+/// @brief 形状をtranslationだけ平行移動させたときに最初に当たるコライダーを求めるクエリ
+struct SweepQuery2D final {
+    ColliderInfo2D::ShapeVariant shape{};
+    Vector2 translation{0.0f, 0.0f};
+    QueryFilter filter{};
+};
+
+struct SweepQuery3D final {
+    QueryShape3D shape{};
+    Vector3 translation{0.0f, 0.0f, 0.0f};
+    QueryFilter filter{};
+};
+
+/// @brief 形状と重なっている全てのコライダーを求めるクエリ（点の判定はPoint2Dを使う）
+struct OverlapQuery2D final {
+    ColliderInfo2D::ShapeVariant shape{};
+    QueryFilter filter{};
+};
+
+struct OverlapQuery3D final {
+    QueryShape3D shape{};
+    QueryFilter filter{};
+};
+
+/// @brief シーンクエリの結果
+/// @details hitInfoのotherObject/otherColliderにヒットしたコライダーの登録情報が入る（selfObject/selfColliderは設定されない）。
+///          normalはクエリ側の押し出し方向（ヒットしたコライダーからクエリ側へ向かう向き）で、
+///          レイキャストではヒットした面の法線になる
+struct QueryHit2D final {
+    /// @brief 対応するクエリの入力配列内の位置
+    std::uint32_t queryIndex = 0;
+    /// @brief ヒットしたコライダーのID（ヒットしなかった場合は0）
+    std::uint32_t collider = 0;
+    HitInfo2D hitInfo{};
+    /// @brief レイキャスト・スイープで最初に当たるまでの距離（オーバーラップでは0）
+    float distance = 0.0f;
+    /// @brief レイキャストのヒット位置（スイープ・オーバーラップでは未設定）
+    Vector2 point{0.0f, 0.0f};
+};
+
+struct QueryHit3D final {
+    std::uint32_t queryIndex = 0;
+    std::uint32_t collider = 0;
+    HitInfo3D hitInfo{};
+    float distance = 0.0f;
+    Vector3 point{0.0f, 0.0f, 0.0f};
+};
+
 class Collider final {
 public:
     using ColliderID = std::uint32_t;
@@ -167,6 +274,39 @@ public:
         ColliderID b = 0;
     };
 
+    /// @brief UpdateColliderInfo3D時のランタイム（RP3Dのボディ・形状・コライダー）の同期方法
+    enum class SyncMode3D {
+        /// @brief 更新のたびにボディ・形状・コライダーを破棄して再生成する（従来の挙動）
+        Rebuild,
+        /// @brief 前回反映した状態との差分を分類し、必要な分だけ既存のボディ・形状へ反映する
+        Incremental,
+    };
+
+    /// @brief 差分同期時の変更内容の分類（下に行くほど反映コストが大きい）
+    enum class ChangeKind3D {
+        /// @brief 変更なし（コールバック・属性・トリガー等の付随情報のみ）
+        None,
+        /// @brief 位置・回転のみの変更（setTransformで反映する）
+        Transform,
+        /// @brief 形状の寸法・スケールの変更（形状を作り直さずに値を書き換える）
+        ShapeParameter,
+        /// @brief 形状の種類・メッシュデータ・取り付け先ボディの変更（再構築が必要）
+        Structural,
+    };
+    static constexpr std::size_t kChangeKind3DCount = 4;
+
+    /// @brief 差分同期で比較するランタイムの状態（反映済みの状態、または新しい情報から求めた反映先の状態）
+    struct SyncState3D {
+        /// @brief RP3Dのランタイムを持たず、ネイティブ判定のトリガーとして扱うか
+        bool isNative = false;
+        /// @brief ボディ・コライダー・形状が揃っているか（反映先の状態では常にtrue）
+        bool hasRuntime = true;
+        /// @brief 取り付け先のRigidBody3Dのボディ（自前の静的ボディを使う場合はnullptr）
+        const RigidBody *attachedBody = nullptr;
+        /// @brief ボディのTransform
+        reactphysics3d::Transform transform = reactphysics3d::Transform::identity();
+    };
+
     Collider();
     ~Collider();
 
@@ -189,26 +329,78 @@ public:
     bool Check3D(ColliderID a, ColliderID b) const;
 
     /// @brief ReactPhysics3DのCollider*から、それを登録した際の情報（ownerObject/sourceCollider）を取得する
-    /// @details RayCollider等、自身は常駐形状を持たないコライダーがレイキャストのヒット結果を
-    ///          衝突相手側のEmptyObject/ICollider（の情報）へ逆引きするために使用する
+    /// @details RP3DのコライダーのユーザーデータにコライダーIDを保持しているため、索引から定数時間で引ける
     /// @return 見つからない場合はnullptr
     const ColliderInfo3D *FindInfoByHandle3D(const ColliderHandle *handle) const;
 
+    //--------------------------------------------------
+    // シーンクエリ
+    //--------------------------------------------------
+    // 複数のクエリをまとめて受け取り、1回の呼び出しで全て処理する。2Dはブロードフェーズの木、
+    // 3DのレイキャストはRP3Dのワールドで候補を絞り込む。3Dのスイープ・オーバーラップは
+    // ネイティブ判定と同じプリミティブ形状で判定する（メッシュ・ハイトフィールドはワールドAABBで近似する）。
+    // RP3Dのワールドは複数スレッドから同時に問い合わせられないため、3DのレイキャストのうちRP3Dへの
+    // 問い合わせはParallel指定時も逐次実行する（ネイティブ判定のトリガーとの判定のみ並列化される）。
+
+    /// @brief クエリごとに最も近いヒットを求める
+    /// @param outHits クエリと同じ数・順に結果を格納する（ヒットしなかったものはhitInfo.isHitがfalse）
+    void Raycast2D(std::span<const RaycastQuery2D> queries, std::vector<QueryHit2D> &outHits, QueryExecution execution = QueryExecution::Serial) const;
+    void Raycast3D(std::span<const RaycastQuery3D> queries, std::vector<QueryHit3D> &outHits, QueryExecution execution = QueryExecution::Serial) const;
+    /// @brief クエリごとに、形状を平行移動させたとき最初に当たるコライダーを求める（開始位置で重なっている場合は距離0）
+    /// @param outHits クエリと同じ数・順に結果を格納する
+    void Sweep2D(std::span<const SweepQuery2D> queries, std::vector<QueryHit2D> &outHits, QueryExecution execution = QueryExecution::Serial) const;
+    void Sweep3D(std::span<const SweepQuery3D> queries, std::vector<QueryHit3D> &outHits, QueryExecution execution = QueryExecution::Serial) const;
+    /// @brief クエリごとに、形状と重なっている全てのコライダーを求める
+    /// @param outHits 重なっていた組だけをクエリ順・コライダーID順に格納する
+    void Overlap2D(std::span<const OverlapQuery2D> queries, std::vector<QueryHit2D> &outHits, QueryExecution execution = QueryExecution::Serial) const;
+    void Overlap3D(std::span<const OverlapQuery3D> queries, std::vector<QueryHit3D> &outHits, QueryExecution execution = QueryExecution::Serial) const;
+
     void Update2D();
     void Update3D();
 
     void StepPhysics(float timeStep);
 
+    /// @brief 3Dコライダー情報更新時の同期方法を設定する（デフォルトはIncremental）
+    void SetSyncMode3D(SyncMode3D mode) noexcept { syncMode3D_ = mode; }
+    SyncMode3D GetSyncMode3D() const noexcept { return syncMode3D_; }
+
+    /// @brief 前回反映した情報・状態と、新しい情報・反映先の状態を比較して変更内容を分類する
+    /// @details UpdateColliderInfo3D（Incremental）はこの結果に応じて、何もしない・setTransformのみ・
+    ///          形状の値の書き換え・ランタイムの再構築のいずれかを行う
+    static ChangeKind3D ClassifyChange3D(const ColliderInfo3D &previous, const SyncState3D &current,
+        const ColliderInfo3D &next, const SyncState3D &target);
+    /// @brief UpdateColliderInfo3Dで行った同期を変更内容ごとに数えた値（Rebuildの同期はStructuralとして数える）
+    std::uint32_t GetSyncCount3D(ChangeKind3D kind) const noexcept { return syncCounts3D_[static_cast<std::size_t>(kind)]; }
+    void ResetSyncCounts3D() noexcept { syncCounts3D_ = {}; }
+
+    /// @brief プリミティブ形状（球・箱・カプセル）のトリガーをRP3Dを介さずに判定するかを設定する（デフォルトはtrue）
+    /// @details 有効な場合、RigidBody3Dに取り付けられないプリミティブ形状のトリガーはRP3Dのボディを生成せず、
+    ///          独自のブロードフェーズとCollisionAlgorithms3Dで、RP3D上の非静的ボディのコライダーとのみ判定する
+    ///          （RP3Dでも静的ボディ同士は判定されないため、通知される組み合わせは従来と同じ）。
+    ///          ネイティブ判定のトリガーはRP3Dのワールドに存在しないため、PhysicsWorldへの直接のレイキャストには
+    ///          当たらない（Raycast3D等のシーンクエリでは判定される）。
+    ///          切り替えると全3Dコライダーのランタイムを作り直す
+    void SetNativeTriggers3D(bool enabled);
+    bool IsNativeTriggers3DEnabled() const noexcept { return nativeTriggers3D_; }
+
     PhysicsWorld *GetPhysicsWorld() { return physicsWorld_; }
     const PhysicsWorld *GetPhysicsWorld() const { return physicsWorld_; }
 
+    /// @brief MeshCollider用の共有衝突判定メッシュのキャッシュを取得する
+    const CollisionMeshCache &GetMeshCache() const { return meshCache_; }
+
 
 private:
     struct ShapeHandle3D {
         reactphysics3d::CollisionShape *shape = nullptr;
         reactphysics3d::ConvexMesh *convexMesh = nullptr;
         reactphysics3d::ConcaveMeshShape *concaveMesh = nullptr;
+        reactphysics3d::TriangleMesh *triangleMesh = nullptr;
         reactphysics3d::HeightField *heightField = nullptr;
+        /// @brief convexMesh/triangleMeshがmeshCache_からの借用か（trueの場合は破棄せず参照を返却する）
+        bool isSharedMesh = false;
+        std::uint32_t sharedModelHandle = 0;
+        std::uint32_t sharedModelRevision = 0;
     };
 
     struct ColliderRuntime3D {
@@ -216,8 +408,13 @@ private:
         ColliderHandle *collider = nullptr;
         ShapeHandle3D shape;
         bool ownsBody = false;
+        /// @brief RP3Dのランタイムを持たず、ネイティブ判定のトリガーとして扱われているか
+        bool isNative = false;
     };
 
+    /// @brief ネイティブ判定用のワールド座標のプリミティブ形状
+    using PrimitiveShape3D = QueryShape3D;
+
     struct CollisionEvent3D {
         ColliderID a = 0;
         ColliderID b = 0;
@@ -231,8 +428,8 @@ private:
         Info info;
         ColliderRuntime3D runtime{};
         /// @brief 連続衝突判定用の前フレーム位置（3Dはボディ位置、2Dは形状のバウンディング中心）
-        /// @details CCDが有効かつ有効状態の間だけ毎フレーム記録される。ランタイムは毎フレーム
-        ///          再構築されるため、フレームを跨ぐ情報はEntry側に保持する
+        /// @details CCDが有効かつ有効状態の間だけ毎フレーム記録される。ランタイムは同期方法や
+        ///          変更内容によって再構築されうるため、フレームを跨ぐ情報はEntry側に保持する
         bool hasPrevPosition = false;
         Vector3 prevPosition{ 0.0f, 0.0f, 0.0f };
     };
@@ -262,6 +459,23 @@ private:
     bool UpdateRuntime3D(Entry<ColliderInfo3D> &entry, const ColliderInfo3D &info);
     bool UpdateColliderShape3D(Entry<ColliderInfo3D> &entry, const ColliderInfo3D &info);
     bool UpdateColliderTransform3D(Entry<ColliderInfo3D> &entry, const ColliderInfo3D &info);
+    /// @brief 既存ランタイムを維持したまま、変更内容に応じた最小限の反映を行う
+    bool SyncRuntime3D(Entry<ColliderInfo3D> &entry, const ColliderInfo3D &info);
+    /// @brief 反映済みのランタイムの状態を求める
+    SyncState3D GetSyncState3D(const Entry<ColliderInfo3D> &entry) const;
+    /// @brief 新しい情報を反映した場合のランタイムの状態を求める
+    SyncState3D MakeSyncState3D(const ColliderInfo3D &info) const;
+    /// @brief 形状の寸法・スケールを生成済みのRP3D形状へ直接書き込む（形状の種類が変わっていない前提）
+    bool ApplyShapeParameter3D(Entry<ColliderInfo3D> &entry, const ColliderInfo3D &info);
+    /// @brief トリガー・有効状態をRP3Dのコライダー/ボディへ反映する
+    void ApplyRuntimeFlags3D(Entry<ColliderInfo3D> &entry, const ColliderInfo3D &info);
+    /// @brief 情報の取り付け先となるRigidBody3Dのボディを解決する（取り付けない場合はnullptr）
+    /// @details 所属オブジェクトのコンポーネントを参照するため、定義は ColliderOwnerBinding.cpp にある
+    RigidBody *ResolveAttachedBody3D(const ColliderInfo3D &info) const;
+    /// @brief 同期元のコライダーの設定を考慮した所属オブジェクトの位置・回転を取得する
+    /// @details 定義は ColliderOwnerBinding.cpp にある
+    /// @return 同期元のコライダー（sourceCollider）が無い場合はfalse
+    bool GetSyncedOwnerPose3D(const ColliderInfo3D &info, Vector3 &outPosition, Quaternion &outRotation) const;
     std::optional<ShapeHandle3D> CreateShape3D(const ColliderInfo3D &info);
     reactphysics3d::Transform MakeTransform3D(const ColliderInfo3D &info) const;
     reactphysics3d::Vector3 ToRp3d(const Vector3 &v) const;
@@ -273,25 +487,61 @@ private:
 
     /// @brief 2Dの連続衝突判定（スイープ）。CCD有効コライダーの移動経路の中間位置で判定し、
     ///        検出したヒットをペアキー（ID昇順。HitInfoは小さいID側を自分として計算）で収集する
+    /// @details 判定相手は移動経路のAABBとブロードフェーズの木から絞り込み、コライダーごとに並列実行する
     void CollectContinuousHits2D(std::unordered_map<std::uint64_t, HitInfo2D> &outHits);
     /// @brief 2Dコライダーの現在位置を次フレームのスイープ用に記録する
     void RecordPrevPositions2D();
     /// @brief 3Dコライダーの現在位置を次フレームのスイープ用に記録する
     void RecordPrevPositions3D();
 
-    std::vector<std::uint64_t> prevPairs2D_;
+    /// @brief RP3Dを介さずに判定するトリガーの条件（プリミティブ形状・トリガー・RigidBody3Dに取り付けない）を満たすか
+    bool IsNativeTrigger3D(const ColliderInfo3D &info) const;
+    /// @brief ネイティブ判定のトリガーと非静的ボディのコライダーを判定し、結果をframeEvents3D_/curPairs3D_へ追加する
+    void CollectNativeTriggerHits3D();
+    /// @brief 3Dコライダーのワールド座標の形状を求める（RP3Dのボディを持つ場合はボディの姿勢を使う）
+    /// @details メッシュ・ハイトフィールドはワールドAABBで近似する。求められない場合はnulloptを返す
+    std::optional<PrimitiveShape3D> MakeWorldShape3D(const Entry<ColliderInfo3D> &entry) const;
+    /// @brief ネイティブ判定のトリガーの判定相手（有効・スリープしていない非静的ボディのコライダー）か
+    bool IsNativeCounterpart3D(const Entry<ColliderInfo3D> &entry) const;
+    /// @brief ネイティブ判定の対象となる組（片方がネイティブ判定のトリガーで、もう片方がその判定相手）を現在位置で判定する
+    /// @return 法線はaからbへ向かう方向。対象外の組の場合は非ヒットを返す
+    HitInfo ComputeNativeHit3D(const Entry<ColliderInfo3D> &a, const Entry<ColliderInfo3D> &b) const;
+
+    /// @brief 2Dの永続ブロードフェーズ（ペアキャッシュの接触状態がEnter/Stay/Exitの前フレーム状態を兼ねる）
+    Broadphase2D broadphase2D_;
+    /// @brief 2Dの狭域判定の結果（ブロードフェーズのペアと同じ並び。並列判定の書き込み先）
+    struct NarrowphaseResult2D {
+        HitInfo2D hitInfo{};
+        /// @brief ペアの両コライダーが存在したか
+        bool isValid = false;
+        /// @brief 属性フィルタを通過して判定を行ったか
+        bool isTested = false;
+    };
+    std::vector<NarrowphaseResult2D> narrowphase2D_;
     std::vector<std::uint64_t> prevPairs3D_;
     std::vector<CollisionEvent3D> frameEvents3D_;
     std::vector<std::uint64_t> curPairs3D_;
 
     reactphysics3d::PhysicsCommon physicsCommon_{};
     reactphysics3d::PhysicsWorld *physicsWorld_ = nullptr;
+    /// @brief physicsCommon_に属するメッシュを保持するため、physicsCommon_より後に宣言する（先に破棄される）
+    CollisionMeshCache meshCache_{ physicsCommon_ };
 
     ColliderID nextId_ = 1;
     std::vector<Entry<ColliderInfo2D>> colliders2D_;
+    /// @brief コライダーIDからcolliders2D_内の位置への索引（Find2Dの線形探索を避ける）
+    std::unordered_map<ColliderID, std::size_t> indexById2D_;
     std::vector<Entry<ColliderInfo3D>> colliders3D_;
+    /// @brief コライダーIDからcolliders3D_内の位置への索引（RP3Dのユーザーデータからの逆引きにも使う）
+    std::unordered_map<ColliderID, std::size_t> indexById3D_;
 
     float accumulatedTime_ = 0.0f;
+    SyncMode3D syncMode3D_ = SyncMode3D::Incremental;
+    std::array<std::uint32_t, kChangeKind3DCount> syncCounts3D_{};
+
+    bool nativeTriggers3D_ = true;
+    TriggerBroadphase3D triggerBroadphase3D_;
+    std::vector<std::pair<ColliderID, ColliderID>> nativePairs3D_;
 };
 
 } // namespace KashipanEngine
@@ -0,0 +1,37 @@
+#include "Collider.h"
+
+// 所属オブジェクトのコンポーネントを参照する処理だけをこのファイルへ分けている。
+// Collider.cpp をエンジン本体（EmptyObject・各コンポーネント）に依存させないことで、
+// テストでは同名の関数を差し替えてCollider単体で検証できる
+#include "Objects/EmptyObject.h"
+#include "Objects/Components/Collider/ICollider.h"
+#include "Objects/Components/Collider/RigidBody3D.h"
+#include "Math/Quaternion.h"
+
+namespace KashipanEngine {
+
+Collider::RigidBody *Collider::ResolveAttachedBody3D(const ColliderInfo3D &info) const {
+    if (!info.ownerObject) return nullptr;
+    // RigidBody3Dが使用コライダーを明示的に選択している場合は、そのコライダーだけを
+    // RigidBodyへ取り付ける（未選択の場合は従来通りどのコライダーでも取り付ける）
+    auto *rb = info.ownerObject->GetComponent<RigidBody3D>();
+    if (!rb) return nullptr;
+    auto *selected = rb->GetSelectedCollider();
+    if (selected && selected != info.sourceCollider) return nullptr;
+    // RP3Dの三角形メッシュ（非凸）形状は静的ボディにしか取り付けられないため、
+    // 動くRigidBodyの場合は取り付けず自前の静的ボディを使う
+    if (std::holds_alternative<ColliderInfo3D::ConcaveMeshShape3D>(info.shape) &&
+        rb->GetBodyType() != reactphysics3d::BodyType::STATIC) {
+        return nullptr;
+    }
+    return rb->GetRigidBody();
+}
+
+bool Collider::GetSyncedOwnerPose3D(const ColliderInfo3D &info, Vector3 &outPosition, Quaternion &outRotation) const {
+    if (!info.sourceCollider) return false;
+    outPosition = info.sourceCollider->GetSyncedOwnerPosition();
+    outRotation = info.sourceCollider->GetSyncedOwnerRotation();
+    return true;
+}
+
+} // namespace KashipanEngine
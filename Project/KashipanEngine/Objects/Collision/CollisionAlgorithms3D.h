@@ -9,6 +9,7 @@
 #include "Objects/MathObjects/3D/AABB.h"
 #include "Objects/MathObjects/3D/Plane.h"
 #include "Objects/MathObjects/3D/OBB.h"
+#include "Objects/MathObjects/3D/Capsule3D.h"
 
 #include <algorithm>
 #include <cmath>
@@ -108,6 +109,72 @@ inline Math::OBB ToOBB(const Math::AABB &b) {
     o.orientation = Matrix4x4::Identity();
     return o;
 }
+
+inline Vector3 ClosestPointOnSegment(const Vector3 &a, const Vector3 &b, const Vector3 &p) {
+    const Vector3 ab = b - a;
+    const float len2 = MathUtils::LengthSquared(ab);
+    if (len2 == 0.0f) return a;
+    const float t = Clamp(MathUtils::Dot(p - a, ab) / len2, 0.0f, 1.0f);
+    return a + ab * t;
+}
+
+/// @brief 2線分間の最近接点を求める（線分が平行・縮退している場合も安定して解く）
+inline void ClosestPointsSegmentSegment(
+    const Vector3 &p1, const Vector3 &q1, const Vector3 &p2, const Vector3 &q2,
+    Vector3 &outC1, Vector3 &outC2) {
+    const Vector3 d1 = q1 - p1;
+    const Vector3 d2 = q2 - p2;
+    const Vector3 r = p1 - p2;
+    const float a = MathUtils::LengthSquared(d1);
+    const float e = MathUtils::LengthSquared(d2);
+    const float f = MathUtils::Dot(d2, r);
+
+    float s = 0.0f;
+    float t = 0.0f;
+    if (a == 0.0f && e == 0.0f) {
+        outC1 = p1;
+        outC2 = p2;
+        return;
+    }
+    if (a == 0.0f) {
+        t = Clamp(f / e, 0.0f, 1.0f);
+    } else {
+        const float c = MathUtils::Dot(d1, r);
+        if (e == 0.0f) {
+            s = Clamp(-c / a, 0.0f, 1.0f);
+        } else {
+            const float b = MathUtils::Dot(d1, d2);
+            const float denom = a * e - b * b;
+            // 平行な場合は任意のsを選び、tから求め直す
+            s = (denom != 0.0f) ? Clamp((b * f - c * e) / denom, 0.0f, 1.0f) : 0.0f;
+            t = (b * s + f) / e;
+            if (t < 0.0f) {
+                t = 0.0f;
+                s = Clamp(-c / a, 0.0f, 1.0f);
+            } else if (t > 1.0f) {
+                t = 1.0f;
+                s = Clamp((b - c) / a, 0.0f, 1.0f);
+            }
+        }
+    }
+    outC1 = p1 + d1 * s;
+    outC2 = p2 + d2 * t;
+}
+
+/// @brief 線分上で、OBBに最も近い点を求める
+/// @details 線分とOBB（どちらも凸）への最近接点を交互に射影して収束させる近似解。
+///          カプセルとOBBの判定では数回の反復で十分な精度が得られる
+inline Vector3 ClosestPointOnSegmentToOBB(const Vector3 &a, const Vector3 &b, const Math::OBB &box) {
+    constexpr int kIterations = 4;
+    Vector3 p = ClosestPointOnSegment(a, b, box.center);
+    for (int i = 0; i < kIterations; ++i) {
+        const Vector3 q = ClosestPointOnOBB(box, p);
+        const Vector3 next = ClosestPointOnSegment(a, b, q);
+        if (DistanceSquared(next, p) == 0.0f) break;
+        p = next;
+    }
+    return p;
+}
 } // namespace
 
 // 既存の真偽値（bool）の衝突判定
@@ -301,6 +368,24 @@ inline HitInfo ComputeHit(const Math::OBB &b, const Math::Sphere &s) {
     const float dist2 = MathUtils::LengthSquared(v);
     if (dist2 > s.radius * s.radius) return MakeNoHit();
 
+    if (dist2 == 0.0f) {
+        // 球の中心がOBBの内側にある場合 -> ローカル座標で面までの距離が最小になる軸を選ぶ
+        const Vector3 axes[3] = {GetOBBAxisX(b), GetOBBAxisY(b), GetOBBAxisZ(b)};
+        const float half[3] = {b.halfSize.x, b.halfSize.y, b.halfSize.z};
+        const Vector3 d = s.center - b.center;
+
+        float minD = std::numeric_limits<float>::infinity();
+        Vector3 n{1.0f, 0.0f, 0.0f};
+        for (int i = 0; i < 3; ++i) {
+            const float local = MathUtils::Dot(d, axes[i]);
+            const float toMax = half[i] - local;
+            const float toMin = half[i] + local;
+            if (toMax < minD) { minD = toMax; n = axes[i]; }
+            if (toMin < minD) { minD = toMin; n = axes[i] * -1.0f; }
+        }
+        return MakeHit(NormalizeSafe(n, Vector3{1.0f, 0.0f, 0.0f}), s.radius + minD);
+    }
+
     const float dist = std::sqrt(std::max(0.0f, dist2));
     const Vector3 n = NormalizeSafe(v, Vector3{1.0f, 0.0f, 0.0f});
     return MakeHit(n, s.radius - dist);
@@ -312,6 +397,43 @@ inline HitInfo ComputeHit(const Math::Sphere &s, const Math::OBB &b) {
     return hi;
 }
 
+//--------------------------------------------------
+// カプセル（線分＋半径）。線分上の最近接点に置いた球として判定する
+//--------------------------------------------------
+
+inline HitInfo ComputeHit(const Math::Capsule3D &c, const Math::Sphere &s) {
+    const Vector3 p = ClosestPointOnSegment(c.start, c.end, s.center);
+    return ComputeHit(Math::Sphere{p, c.radius}, s);
+}
+inline HitInfo ComputeHit(const Math::Sphere &s, const Math::Capsule3D &c) {
+    HitInfo hi = ComputeHit(c, s);
+    if (hi.isHit) hi.normal = hi.normal * -1.0f;
+    return hi;
+}
+
+inline HitInfo ComputeHit(const Math::Capsule3D &a, const Math::Capsule3D &b) {
+    Vector3 ca{};
+    Vector3 cb{};
+    ClosestPointsSegmentSegment(a.start, a.end, b.start, b.end, ca, cb);
+    return ComputeHit(Math::Sphere{ca, a.radius}, Math::Sphere{cb, b.radius});
+}
+
+inline HitInfo ComputeHit(const Math::Capsule3D &c, const Math::OBB &b) {
+    const Vector3 p = ClosestPointOnSegmentToOBB(c.start, c.end, b);
+    return ComputeHit(Math::Sphere{p, c.radius}, b);
+}
+inline HitInfo ComputeHit(const Math::OBB &b, const Math::Capsule3D &c) {
+    HitInfo hi = ComputeHit(c, b);
+    if (hi.isHit) hi.normal = hi.normal * -1.0f;
+    return hi;
+}
+
+inline bool Intersects(const Math::Capsule3D &c, const Math::Sphere &s) { return ComputeHit(c, s).isHit; }
+inline bool Intersects(const Math::Sphere &s, const Math::Capsule3D &c) { return Intersects(c, s); }
+inline bool Intersects(const Math::Capsule3D &a, const Math::Capsule3D &b) { return ComputeHit(a, b).isHit; }
+inline bool Intersects(const Math::Capsule3D &c, const Math::OBB &b) { return ComputeHit(c, b).isHit; }
+inline bool Intersects(const Math::OBB &b, const Math::Capsule3D &c) { return Intersects(c, b); }
+
 inline HitInfo ComputeHit(const Math::Point3D &a, const Math::Point3D &b) {
     return Intersects(a, b) ? MakeHit(Vector3{1.0f, 0.0f, 0.0f}, 0.0f) : MakeNoHit();
 }
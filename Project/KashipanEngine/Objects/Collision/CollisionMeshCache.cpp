@@ -0,0 +1,141 @@
+#include "CollisionMeshCache.h"
+
+#include <vector>
+
+namespace KashipanEngine {
+
+CollisionMeshCache::CollisionMeshCache(reactphysics3d::PhysicsCommon &physicsCommon)
+    : physicsCommon_(physicsCommon) {}
+
+CollisionMeshCache::~CollisionMeshCache() {
+    Clear();
+}
+
+reactphysics3d::ConvexMesh *CollisionMeshCache::AcquireConvex(ModelHandle model, ModelRevision revision) {
+    const Key key{ model, revision, true };
+    if (auto it = entries_.find(key); it != entries_.end()) {
+        ++it->second.refCount;
+        return it->second.convexMesh;
+    }
+
+    // モデルの頂点配列をコピーせず、位置（先頭のfloat3）だけをストライド指定で直接参照して構築する
+    ModelGeometry geometry;
+    if (!GetModelGeometry(model, revision, geometry)) return nullptr;
+    auto *mesh = CreateConvexMesh(
+        physicsCommon_,
+        geometry.vertices, geometry.vertexCount, geometry.vertexStride,
+        geometry.indices, geometry.indexCount);
+    if (!mesh) return nullptr;
+
+    entries_.emplace(key, Entry{ mesh, nullptr, 1 });
+    return mesh;
+}
+
+reactphysics3d::TriangleMesh *CollisionMeshCache::AcquireTriangle(ModelHandle model, ModelRevision revision) {
+    const Key key{ model, revision, false };
+    if (auto it = entries_.find(key); it != entries_.end()) {
+        ++it->second.refCount;
+        return it->second.triangleMesh;
+    }
+
+    ModelGeometry geometry;
+    if (!GetModelGeometry(model, revision, geometry)) return nullptr;
+    auto *mesh = CreateTriangleMesh(
+        physicsCommon_,
+        geometry.vertices, geometry.vertexCount, geometry.vertexStride,
+        geometry.indices, geometry.indexCount);
+    if (!mesh) return nullptr;
+
+    entries_.emplace(key, Entry{ nullptr, mesh, 1 });
+    return mesh;
+}
+
+void CollisionMeshCache::Release(ModelHandle model, ModelRevision revision, bool convex) {
+    auto it = entries_.find(Key{ model, revision, convex });
+    if (it == entries_.end()) return;
+    if (it->second.refCount > 1) {
+        --it->second.refCount;
+        return;
+    }
+    DestroyEntry(it->second);
+    entries_.erase(it);
+}
+
+void CollisionMeshCache::Clear() {
+    for (auto &[key, entry] : entries_) {
+        DestroyEntry(entry);
+    }
+    entries_.clear();
+}
+
+std::uint32_t CollisionMeshCache::GetRefCount(ModelHandle model, ModelRevision revision, bool convex) const {
+    auto it = entries_.find(Key{ model, revision, convex });
+    return (it != entries_.end()) ? it->second.refCount : 0;
+}
+
+reactphysics3d::ConvexMesh *CollisionMeshCache::CreateConvexMesh(
+    reactphysics3d::PhysicsCommon &physicsCommon,
+    const void *vertices, std::uint32_t vertexCount, std::uint32_t vertexStride,
+    const std::uint32_t *indices, std::uint32_t indexCount) {
+    if (!vertices || !indices || vertexCount == 0 || indexCount < 3) return nullptr;
+
+    constexpr std::uint32_t kIndexStride = sizeof(std::uint32_t);
+    const std::uint32_t polygonCount = indexCount / 3;
+
+    std::vector<reactphysics3d::PolygonVertexArray::PolygonFace> faces(polygonCount);
+    for (std::uint32_t i = 0; i < polygonCount; ++i) {
+        faces[i].indexBase = i * 3;
+        faces[i].nbVertices = 3;
+    }
+
+    reactphysics3d::PolygonVertexArray array(
+        vertexCount,
+        vertices,
+        vertexStride,
+        indices,
+        kIndexStride,
+        polygonCount,
+        faces.data(),
+        reactphysics3d::PolygonVertexArray::VertexDataType::VERTEX_FLOAT_TYPE,
+        reactphysics3d::PolygonVertexArray::IndexDataType::INDEX_INTEGER_TYPE);
+
+    std::vector<reactphysics3d::Message> messages;
+    return physicsCommon.createConvexMesh(array, messages);
+}
+
+reactphysics3d::TriangleMesh *CollisionMeshCache::CreateTriangleMesh(
+    reactphysics3d::PhysicsCommon &physicsCommon,
+    const void *vertices, std::uint32_t vertexCount, std::uint32_t vertexStride,
+    const std::uint32_t *indices, std::uint32_t indexCount) {
+    if (!vertices || !indices || vertexCount == 0 || indexCount < 3) return nullptr;
+
+    // インデックスのストライドは「三角形1つ分（インデックス3つ）」のバイト数
+    constexpr std::uint32_t kTriangleStride = sizeof(std::uint32_t) * 3;
+
+    reactphysics3d::TriangleVertexArray array(
+        vertexCount,
+        vertices,
+        vertexStride,
+        indexCount / 3,
+        indices,
+        kTriangleStride,
+        reactphysics3d::TriangleVertexArray::VertexDataType::VERTEX_FLOAT_TYPE,
+        reactphysics3d::TriangleVertexArray::IndexDataType::INDEX_INTEGER_TYPE);
+
+    std::vector<reactphysics3d::Message> messages;
+    return physicsCommon.createTriangleMesh(array, messages);
+}
+
+void CollisionMeshCache::DestroyEntry(Entry &entry) {
+    if (entry.convexMesh) {
+        physicsCommon_.destroyConvexMesh(entry.convexMesh);
+        entry.convexMesh = nullptr;
+    }
+    if (entry.triangleMesh) {
+        physicsCommon_.destroyTriangleMesh(entry.triangleMesh);
+        entry.triangleMesh = nullptr;
+    }
+    entry.refCount = 0;
+}
+
+} // namespace KashipanEngine
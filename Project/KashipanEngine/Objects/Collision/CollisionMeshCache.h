@@ -0,0 +1,109 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+
+#include "Math/Vector3.h"
+
+#include <reactphysics3d/reactphysics3d.h>
+
+namespace KashipanEngine {
+
+/// @brief MeshCollider用の衝突判定メッシュ（RP3DのConvexMesh/TriangleMesh）を共有するキャッシュ
+/// @details (モデルハンドル, モデルの世代番号, 凸包フラグ) をキーに、モデルの頂点・インデックスから衝突判定メッシュを
+///          一度だけ構築し、同じモデルを使う全インスタンスで共有する。世代番号（ModelManager::GetModelRevision）を
+///          キーに含めるため、モデルの再登録やハンドルの再利用で中身が変わったハンドルに古いメッシュを返すことはない
+///          （古い世代のメッシュは、参照していたコライダーが新しい世代へ同期されてReleaseした時点で破棄される）。インスタンスごとの違いは
+///          ConvexMeshShape/ConcaveMeshShape側のスケールのみで表現するため、メッシュ自体は複製しない。
+///          Acquireで参照カウントを加算し、Releaseで0になった時点でRP3D側のメッシュを破棄する。
+///          メッシュはPhysicsCommonに属するため、キャッシュは所有するCollider（PhysicsCommon）より先に破棄すること。
+class CollisionMeshCache final {
+public:
+    /// @brief ModelManager::ModelHandleと同じ型（ModelManagerへの依存を避けるためここで定義する）
+    using ModelHandle = std::uint32_t;
+    /// @brief ModelManager::GetModelRevisionの戻り値と同じ型
+    using ModelRevision = std::uint32_t;
+
+    explicit CollisionMeshCache(reactphysics3d::PhysicsCommon &physicsCommon);
+    ~CollisionMeshCache();
+
+    CollisionMeshCache(const CollisionMeshCache &) = delete;
+    CollisionMeshCache &operator=(const CollisionMeshCache &) = delete;
+
+    /// @brief 凸包メッシュを取得する（未構築の場合はモデルデータから構築する）。参照カウントを1加算する
+    /// @return 構築に失敗した場合はnullptr（参照カウントは加算されない）
+    /// @param revision 呼び出し側が想定しているモデルの世代番号（現在の世代と異なる場合は構築しない）
+    reactphysics3d::ConvexMesh *AcquireConvex(ModelHandle model, ModelRevision revision);
+    /// @brief 三角形メッシュ（非凸）を取得する（未構築の場合はモデルデータから構築する）。参照カウントを1加算する
+    /// @return 構築に失敗した場合はnullptr（参照カウントは加算されない）
+    /// @param revision 呼び出し側が想定しているモデルの世代番号（現在の世代と異なる場合は構築しない）
+    reactphysics3d::TriangleMesh *AcquireTriangle(ModelHandle model, ModelRevision revision);
+    /// @brief Acquireで取得したメッシュの参照を1つ解放する（0になった場合はメッシュを破棄する）
+    void Release(ModelHandle model, ModelRevision revision, bool convex);
+
+    /// @brief 全メッシュを参照カウントに関わらず破棄する（全コライダーのランタイム破棄後に呼ぶこと）
+    void Clear();
+
+    /// @brief キャッシュされているメッシュ数を取得する
+    std::size_t GetEntryCount() const noexcept { return entries_.size(); }
+    /// @brief 指定したメッシュの参照カウントを取得する（未構築の場合は0）
+    std::uint32_t GetRefCount(ModelHandle model, ModelRevision revision, bool convex) const;
+
+    /// @brief 頂点・インデックス配列から凸包メッシュを構築する（キャッシュを介さない形状情報の直接指定用）
+    /// @param vertexStride 頂点1つ分のバイト数（先頭にfloat3の位置を持つ構造体を想定）
+    static reactphysics3d::ConvexMesh *CreateConvexMesh(
+        reactphysics3d::PhysicsCommon &physicsCommon,
+        const void *vertices, std::uint32_t vertexCount, std::uint32_t vertexStride,
+        const std::uint32_t *indices, std::uint32_t indexCount);
+    /// @brief 頂点・インデックス配列から三角形メッシュを構築する（キャッシュを介さない形状情報の直接指定用）
+    /// @param vertexStride 頂点1つ分のバイト数（先頭にfloat3の位置を持つ構造体を想定）
+    static reactphysics3d::TriangleMesh *CreateTriangleMesh(
+        reactphysics3d::PhysicsCommon &physicsCommon,
+        const void *vertices, std::uint32_t vertexCount, std::uint32_t vertexStride,
+        const std::uint32_t *indices, std::uint32_t indexCount);
+
+private:
+    /// @brief 衝突判定メッシュの構築元となるモデルの頂点・インデックス（モデル側の配列を直接参照する）
+    struct ModelGeometry {
+        const void *vertices = nullptr;
+        std::uint32_t vertexCount = 0;
+        std::uint32_t vertexStride = 0;
+        const std::uint32_t *indices = nullptr;
+        std::uint32_t indexCount = 0;
+    };
+
+    /// @brief モデルの頂点・インデックスを取得する
+    /// @details ModelManagerを参照するため、定義は CollisionMeshCacheModels.cpp にある
+    /// @return 無効なハンドル、またはモデルの現在の世代番号がrevisionと異なる場合はfalse
+    static bool GetModelGeometry(ModelHandle model, ModelRevision revision, ModelGeometry &outGeometry);
+
+    struct Entry {
+        reactphysics3d::ConvexMesh *convexMesh = nullptr;
+        reactphysics3d::TriangleMesh *triangleMesh = nullptr;
+        std::uint32_t refCount = 0;
+    };
+
+    struct Key {
+        ModelHandle model = 0;
+        ModelRevision revision = 0;
+        bool convex = false;
+
+        bool operator==(const Key &) const noexcept = default;
+    };
+
+    struct KeyHash {
+        std::size_t operator()(const Key &key) const noexcept {
+            const std::uint64_t packed = (static_cast<std::uint64_t>(key.revision) << 32) | key.model;
+            return std::hash<std::uint64_t>{}(packed) ^ (key.convex ? 1u : 0u);
+        }
+    };
+
+    void DestroyEntry(Entry &entry);
+
+    reactphysics3d::PhysicsCommon &physicsCommon_;
+    std::unordered_map<Key, Entry, KeyHash> entries_;
+};
+
+} // namespace KashipanEngine
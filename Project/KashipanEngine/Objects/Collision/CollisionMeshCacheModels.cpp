@@ -0,0 +1,24 @@
+#include "CollisionMeshCache.h"
+
+// ModelManagerを参照する処理だけをこのファイルへ分けている。
+// CollisionMeshCache.cpp をモデルの読み込み（DirectX・Assimp）に依存させないことで、
+// テストでは同名の関数を差し替えて任意の頂点からメッシュを構築できる
+#include "Assets/ModelManager.h"
+
+namespace KashipanEngine {
+
+bool CollisionMeshCache::GetModelGeometry(ModelHandle model, ModelRevision revision, ModelGeometry &outGeometry) {
+    if (model == ModelManager::kInvalidHandle) return false;
+    // 要求した時点からモデルが再登録されている（ハンドルが別のモデルを指している）場合は構築しない
+    if (ModelManager::GetModelRevision(model) != revision) return false;
+
+    const ModelData &data = ModelManager::GetModelData(model);
+    outGeometry.vertices = data.GetVertices().data();
+    outGeometry.vertexCount = data.GetVertexCount();
+    outGeometry.vertexStride = static_cast<std::uint32_t>(sizeof(ModelData::Vertex));
+    outGeometry.indices = data.GetIndices().data();
+    outGeometry.indexCount = data.GetIndexCount();
+    return true;
+}
+
+} // namespace KashipanEngine
@@ -0,0 +1,73 @@
+#include "TriggerBroadphase3D.h"
+
+#include <algorithm>
+
+namespace KashipanEngine {
+
+void TriggerBroadphase3D::SetProxy(ColliderID id, ProxyKind kind, const Math::AABB &bounds) {
+    if (auto it = slotById_.find(id); it != slotById_.end()) {
+        auto &proxy = proxies_[it->second];
+        proxy.kind = kind;
+        proxy.bounds = bounds;
+        return;
+    }
+
+    std::uint32_t slot = 0;
+    if (!freeSlots_.empty()) {
+        slot = freeSlots_.back();
+        freeSlots_.pop_back();
+    } else {
+        slot = static_cast<std::uint32_t>(proxies_.size());
+        proxies_.emplace_back();
+    }
+    proxies_[slot] = Proxy{id, kind, bounds};
+    slotById_.emplace(id, slot);
+    // 並び順の末尾へ追加し、次のCollectPairsの挿入ソートで正しい位置へ移動させる
+    order_.push_back(slot);
+}
+
+void TriggerBroadphase3D::RemoveProxy(ColliderID id) {
+    auto it = slotById_.find(id);
+    if (it == slotById_.end()) return;
+    const std::uint32_t slot = it->second;
+    slotById_.erase(it);
+    std::erase(order_, slot);
+    freeSlots_.push_back(slot);
+}
+
+void TriggerBroadphase3D::Clear() {
+    proxies_.clear();
+    freeSlots_.clear();
+    slotById_.clear();
+    order_.clear();
+}
+
+void TriggerBroadphase3D::CollectPairs(std::vector<std::pair<ColliderID, ColliderID>> &outPairs) {
+    // 前フレームの並び順をほぼ保っているため、挿入ソートで整える
+    for (std::size_t i = 1; i < order_.size(); ++i) {
+        const std::uint32_t slot = order_[i];
+        const float key = proxies_[slot].bounds.min.x;
+        std::size_t j = i;
+        while (j > 0 && proxies_[order_[j - 1]].bounds.min.x > key) {
+            order_[j] = order_[j - 1];
+            --j;
+        }
+        order_[j] = slot;
+    }
+
+    const std::size_t first = outPairs.size();
+    for (std::size_t i = 0; i < order_.size(); ++i) {
+        const Proxy &a = proxies_[order_[i]];
+        for (std::size_t j = i + 1; j < order_.size(); ++j) {
+            const Proxy &b = proxies_[order_[j]];
+            if (b.bounds.min.x > a.bounds.max.x) break;
+            if (a.kind == b.kind) continue;
+            if (a.bounds.max.y < b.bounds.min.y || b.bounds.max.y < a.bounds.min.y) continue;
+            if (a.bounds.max.z < b.bounds.min.z || b.bounds.max.z < a.bounds.min.z) continue;
+            outPairs.emplace_back(std::min(a.id, b.id), std::max(a.id, b.id));
+        }
+    }
+    std::sort(outPairs.begin() + static_cast<std::ptrdiff_t>(first), outPairs.end());
+}
+
+} // namespace KashipanEngine
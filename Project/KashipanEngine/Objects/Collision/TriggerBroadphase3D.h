@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Objects/MathObjects/3D/AABB.h"
+
+namespace KashipanEngine {
+
+/// @brief RP3Dを介さずに判定する3Dトリガー用のブロードフェーズ（永続的なsort-and-sweep）
+/// @details プロキシはトリガー側（Trigger）と、その判定相手となる物理ボディ側（Body）の2種類を持ち、
+///          異なる種類同士の組のみを候補ペアとして列挙する（同じ種類同士は判定しない）。
+///          X軸の並び順はフレームを跨いで保持し、毎フレーム挿入ソートで整えるため、
+///          ほとんど動かないトリガーが大半を占める場合は並べ替えがほぼ線形時間で済む。
+class TriggerBroadphase3D final {
+public:
+    using ColliderID = std::uint32_t;
+
+    enum class ProxyKind : std::uint8_t {
+        /// @brief ネイティブ判定のトリガー
+        Trigger,
+        /// @brief RP3D上の非静的ボディに取り付けられたコライダー（トリガーの判定相手）
+        Body,
+    };
+
+    /// @brief プロキシを登録・更新する（未登録の場合は追加する）
+    void SetProxy(ColliderID id, ProxyKind kind, const Math::AABB &bounds);
+    void RemoveProxy(ColliderID id);
+    bool HasProxy(ColliderID id) const { return slotById_.contains(id); }
+    std::size_t GetProxyCount() const noexcept { return slotById_.size(); }
+    void Clear();
+
+    /// @brief TriggerとBodyの組のうち、AABBが重なっているものを列挙する
+    /// @param outPairs (小さいID, 大きいID) の組の格納先。ペアキー（ID昇順）でソートされる
+    void CollectPairs(std::vector<std::pair<ColliderID, ColliderID>> &outPairs);
+
+private:
+    struct Proxy {
+        ColliderID id = 0;
+        ProxyKind kind = ProxyKind::Trigger;
+        Math::AABB bounds{};
+    };
+
+    std::vector<Proxy> proxies_;
+    std::vector<std::uint32_t> freeSlots_;
+    std::unordered_map<ColliderID, std::uint32_t> slotById_;
+    /// @brief bounds.min.xの昇順に並べた有効なスロット
+    std::vector<std::uint32_t> order_;
+};
+
+} // namespace KashipanEngine
@@ -0,0 +1,170 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace KashipanEngine {
+
+/// @brief 型ごとの一括更新（バッチ処理）でコンポーネントへ渡す、フレーム内で共通の値
+/// @details コンポーネントごとに GetDeltaTime() 等を呼び直さず、Scene が1フレームに1度だけ取得して配る
+struct ComponentBatchContext final {
+    /// @brief 前フレームからの経過時間（秒。GetDeltaTime() の値）
+    float deltaTime = 0.0f;
+    /// @brief ゲームスピード（GetGameSpeed() の値）
+    float gameSpeed = 1.0f;
+};
+
+/// @brief UpdateBatch で積み、EndBatchUpdate でまとめて処理するコンポーネントの待ち行列
+/// @details 型ごとの ComponentPool<T> が1つずつ持ち、UpdateBatch と EndBatchUpdate の両方へ渡す。
+///          プールは走査の前と EndBatchUpdate を抜けた後（例外で抜けた場合も含む）に空にするため、
+///          別のシーンのプールや次のフレームへ要素が持ち越されることはない
+template <typename T>
+using ComponentBatchQueue = std::vector<T *>;
+
+/// @brief ComponentBatchQueue に積まれたコンポーネント自身が持つ、待ち行列内の位置
+/// @details EndBatchUpdate の実行中に他のコンポーネント（スクリプト等）から削除・無効化された場合に、
+///          Remove で自身の要素を nullptr に置き換えて以降の処理から外すために使う（ScriptComponent）。
+///          待ち行列の要素を並べ替える・取り出す場合は GroupComponentBatchQueue / DrainComponentBatchQueue を使い、位置を保つ
+template <typename T>
+class ComponentBatchQueueSlot final {
+public:
+    /// @brief 待ち行列の末尾へ積み、その位置を覚える
+    void Push(ComponentBatchQueue<T> &queue, T *component) {
+        queue_ = &queue;
+        index_ = queue.size();
+        queue.push_back(component);
+    }
+    /// @brief 待ち行列に入っていれば、自身の要素を nullptr に置き換えて取り除く
+    /// @details 例外で一括更新を抜けてプールが待ち行列を空にした後は、位置が範囲外になるか別の要素を指すため触らない
+    void Remove(const T *component) {
+        if (!queue_) return;
+        if (index_ < queue_->size() && (*queue_)[index_] == component) {
+            (*queue_)[index_] = nullptr;
+        }
+        queue_ = nullptr;
+    }
+    bool IsQueued() const noexcept { return queue_ != nullptr; }
+
+private:
+    template <typename U, typename KeyOf, typename SlotOf>
+    friend void GroupComponentBatchQueue(ComponentBatchQueue<U> &queue, KeyOf &&keyOf, SlotOf &&slotOf);
+    template <typename U, typename SlotOf, typename Run>
+    friend void DrainComponentBatchQueue(ComponentBatchQueue<U> &queue, SlotOf &&slotOf, Run &&run);
+
+    ComponentBatchQueue<T> *queue_ = nullptr;
+    std::size_t index_ = 0;
+};
+
+/// @brief 待ち行列を、keyOf が同じ値を返す要素どうしが連続するよう並べ替える
+/// @details グループの並びは最初に現れた順、グループ内は積まれた順（プールの走査順）のまま保つ
+/// @param keyOf const T & からグループのキー（ハッシュ可能な値）を返す
+/// @param slotOf T & からその要素の ComponentBatchQueueSlot<T> & を返す
+template <typename T, typename KeyOf, typename SlotOf>
+void GroupComponentBatchQueue(ComponentBatchQueue<T> &queue, KeyOf &&keyOf, SlotOf &&slotOf) {
+    using Key = std::decay_t<decltype(keyOf(std::declval<const T &>()))>;
+    std::unordered_map<Key, std::size_t> groupIndices;
+    std::vector<std::pair<std::size_t, T *>> ordered;
+    ordered.reserve(queue.size());
+    for (T *component : queue) {
+        if (!component) continue;
+        const auto [it, inserted] = groupIndices.try_emplace(keyOf(*component), groupIndices.size());
+        ordered.emplace_back(it->second, component);
+    }
+    std::stable_sort(ordered.begin(), ordered.end(),
+        [](const auto &a, const auto &b) { return a.first < b.first; });
+    queue.resize(ordered.size());
+    for (std::size_t i = 0; i < ordered.size(); ++i) {
+        queue[i] = ordered[i].second;
+        slotOf(*queue[i]).index_ = i;
+    }
+}
+
+/// @brief 待ち行列の要素を先頭から順に取り出して run を呼ぶ
+/// @details 取り出した要素は登録を外してから run へ渡すため、run の中で他の要素が削除された場合は
+///          その要素の Remove で nullptr に置き換えられ、飛ばされる。
+///          run が例外を投げた場合、残りの要素はプールが待ち行列ごと空にする
+template <typename T, typename SlotOf, typename Run>
+void DrainComponentBatchQueue(ComponentBatchQueue<T> &queue, SlotOf &&slotOf, Run &&run) {
+    for (std::size_t i = 0; i < queue.size(); ++i) {
+        T *component = queue[i];
+        if (!component) continue;
+        queue[i] = nullptr;
+        slotOf(*component).queue_ = nullptr;
+        run(*component);
+    }
+}
+
+/// @brief コンポーネントが型ごとの一括更新（バッチ処理）対象かどうかを判定するトレイト
+/// @details クラスに public static な constexpr bool IsBatchProcessed() が定義されていればそれを使い、
+///          未定義の場合はバッチ処理対象外（オブジェクト単位で個別にUpdateが呼ばれる、今まで通りの動作）として扱う。
+///          バッチ処理対象とマークされた型は EmptyObject::RegenerateUpdateComponentsList() で
+///          個別Update呼び出しの対象から除外され、代わりに Scene が1フレームに1度、その型の
+///          ComponentPool<T> をチャンク順に走査して public な
+///          void UpdateBatch(Passkey<ComponentPool<T>>, const ComponentBatchContext &) を呼ぶ。
+///          以下は任意で定義でき、未定義の場合は既定値になる。
+///          - static constexpr bool IsBatchParallel():
+///            trueの場合、チャンク単位でジョブシステムへ分散して並列に更新する（既定はfalse）。
+///            自身と所属オブジェクトのTransform以外へ書き込まない型のみtrueにすること
+///          - static constexpr int GetBatchUpdatePriority():
+///            個別Updateの優先度（IObjectComponent::GetUpdatePriority）の並びのどこで一括更新するか（既定は1。
+///            コンポーネントの既定の優先度）。Scene は各オブジェクトのこの値未満の優先度のコンポーネントを更新した後に
+///            一括更新し、その後でこの値以上の優先度のコンポーネントを更新する。バッチ処理対象の型のインスタンスごとの
+///            優先度は使わず、同じ優先度のコンポーネントとの間では常に一括更新が先になる
+///          - static constexpr int GetBatchUpdateOrder():
+///            GetBatchUpdatePriority が同じ型どうしの更新順（小さいほど先。既定は0。同値の場合はプールの生成順）
+///          - static void EndBatchUpdate(Passkey<ComponentPool<T>>, ComponentBatchQueue<T> &, const ComponentBatchContext &):
+///            プールの走査を終えた後に1度だけ呼ばれる。UpdateBatch では更新対象を集めるだけにして、
+///            実際の処理を走査の外でまとめて行う型（ScriptComponent・Animator）が使う。定義した型の UpdateBatch は
+///            void UpdateBatch(Passkey<ComponentPool<T>>, ComponentBatchQueue<T> &, const ComponentBatchContext &) とし、
+///            処理が必要なインスタンスだけをプールの待ち行列へ積む（並列の一括更新とは併用できない）
+///          これらは OBJECT_COMPONENT_CONSTRUCTOR 内の型登録から定数式として参照されるため、
+///          クラス定義内で OBJECT_COMPONENT_CONSTRUCTOR より前に宣言すること
+template <typename T, typename = void>
+struct ComponentBatchTraits {
+    static constexpr bool kIsBatchProcessed = false;
+    static constexpr bool kIsParallel = false;
+    static constexpr int kUpdatePriority = 1;
+    static constexpr int kUpdateOrder = 0;
+};
+template <typename T>
+struct ComponentBatchTraits<T, std::void_t<decltype(T::IsBatchProcessed())>> {
+    static constexpr bool kIsBatchProcessed = T::IsBatchProcessed();
+    static constexpr bool kIsParallel = [] {
+        if constexpr (requires { T::IsBatchParallel(); }) return T::IsBatchParallel();
+        else return false;
+    }();
+    static constexpr int kUpdatePriority = [] {
+        if constexpr (requires { T::GetBatchUpdatePriority(); }) return T::GetBatchUpdatePriority();
+        else return 1;
+    }();
+    static constexpr int kUpdateOrder = [] {
+        if constexpr (requires { T::GetBatchUpdateOrder(); }) return T::GetBatchUpdateOrder();
+        else return 0;
+    }();
+};
+
+/// @brief 一括更新の優先度の区切りごとに、全オブジェクトのその優先度未満のコンポーネントの個別更新 → 一括更新を繰り返し、
+///        残りの個別更新を最後に行う（Scene::UpdateSceneObjects の更新順）
+/// @details 同じ優先度の個別更新との間では常に一括更新が先になる。最小の優先度（INT_MIN）の型は全ての個別更新より先に一括更新される
+/// @param pools 一括更新の優先度順に並んだプール（GetBatchUpdatePriority() を持つ要素へのポインタ）
+/// @param updateObjects (int minPriority, int maxPriority) の範囲の優先度の個別更新を行う
+/// @param updatePool プール1つ分の一括更新を行う
+template <typename PoolList, typename UpdateObjects, typename UpdatePool>
+void RunComponentBatchStages(const PoolList &pools, UpdateObjects &&updateObjects, UpdatePool &&updatePool) {
+    int minPriority = std::numeric_limits<int>::min();
+    for (const auto &pool : pools) {
+        const int priority = pool->GetBatchUpdatePriority();
+        if (priority > minPriority) {
+            updateObjects(minPriority, priority - 1);
+            minPriority = priority;
+        }
+        updatePool(pool);
+    }
+    updateObjects(minPriority, std::numeric_limits<int>::max());
+}
+
+} // namespace KashipanEngine
@@ -1,10 +1,14 @@
 #pragma once
 #include <type_traits>
 #include "Objects/ChunkedPool.h"
+#include "Objects/ComponentBatch.h"
+#include "Utilities/Plugin/Plugins.h"
 
 namespace KashipanEngine {
 
 class IObjectComponent;
+template <typename T>
+class Passkey;
 
 /// @brief コンポーネント型ごとのプールを型消去して扱うための基底インターフェース
 class IComponentPoolBase {
@@ -18,6 +22,15 @@ public:
     virtual bool Remove(const IObjectComponent *component) = 0;
     /// @brief このプールが指定ポインタのコンポーネントを現在所有しているか
     virtual bool Owns(const IObjectComponent *component) const = 0;
+
+    /// @brief 要素の型がバッチ処理対象か（ComponentBatchTraits<T>::kIsBatchProcessed）
+    virtual bool IsBatchProcessed() const { return false; }
+    /// @brief 個別Updateの優先度の並びのどこで一括更新するか（ComponentBatchTraits<T>::kUpdatePriority）
+    virtual int GetBatchUpdatePriority() const { return 1; }
+    /// @brief 一括更新の優先度が同じ型どうしの更新順（ComponentBatchTraits<T>::kUpdateOrder）
+    virtual int GetBatchUpdateOrder() const { return 0; }
+    /// @brief アクティブな全コンポーネントを一括更新する（バッチ処理対象でない型では何もしない）
+    virtual void UpdateBatch(const ComponentBatchContext &context) { (void)context; }
 };
 
 /// @brief 具体的なコンポーネント型 T 専用のプール
@@ -41,8 +54,58 @@ public:
         return pool_.Owns(static_cast<const T *>(component));
     }
 
+    bool IsBatchProcessed() const override { return ComponentBatchTraits<T>::kIsBatchProcessed; }
+    int GetBatchUpdatePriority() const override { return ComponentBatchTraits<T>::kUpdatePriority; }
+    int GetBatchUpdateOrder() const override { return ComponentBatchTraits<T>::kUpdateOrder; }
+
+    /// @details チャンク内のスロットを順に走査し、アクティブなコンポーネントの UpdateBatch を
+    ///          仮想関数を介さずに直接呼ぶ。並列指定の型はチャンク単位でジョブシステムへ分散する。
+    ///          EndBatchUpdate を持つ型は、このプールの待ち行列へ積ませてから EndBatchUpdate へ渡す
+    void UpdateBatch(const ComponentBatchContext &context) override {
+        if constexpr (ComponentBatchTraits<T>::kIsBatchProcessed) {
+            if constexpr (kHasEndBatchUpdate) {
+                static_assert(!ComponentBatchTraits<T>::kIsParallel, "EndBatchUpdate cannot be combined with IsBatchParallel");
+                // 例外で抜けた場合も、破棄されうるコンポーネントへのポインタを次のフレームへ残さない
+                struct QueueReset {
+                    ComponentBatchQueue<T> &queue;
+                    ~QueueReset() { queue.clear(); }
+                } queueReset{ batchQueue_ };
+                batchQueue_.clear();
+                const size_t chunkCount = pool_.ChunkCount();
+                for (size_t chunkIndex = 0; chunkIndex < chunkCount; ++chunkIndex) {
+                    pool_.ForEachInChunk(chunkIndex, [this, &context](T &component) {
+                        if (component.IsActive()) component.UpdateBatch(Passkey<ComponentPool<T>>(), batchQueue_, context);
+                    });
+                }
+                T::EndBatchUpdate(Passkey<ComponentPool<T>>(), batchQueue_, context);
+            } else {
+                auto updateChunk = [this, &context](size_t chunkIndex) {
+                    pool_.ForEachInChunk(chunkIndex, [&context](T &component) {
+                        if (component.IsActive()) component.UpdateBatch(Passkey<ComponentPool<T>>(), context);
+                    });
+                };
+                const size_t chunkCount = pool_.ChunkCount();
+                if constexpr (ComponentBatchTraits<T>::kIsParallel) {
+                    Plugin::ParallelFor(chunkCount, 1, [&updateChunk](size_t begin, size_t end) {
+                        for (size_t chunkIndex = begin; chunkIndex < end; ++chunkIndex) updateChunk(chunkIndex);
+                    });
+                } else {
+                    for (size_t chunkIndex = 0; chunkIndex < chunkCount; ++chunkIndex) updateChunk(chunkIndex);
+                }
+            }
+        } else {
+            (void)context;
+        }
+    }
+
 private:
+    static constexpr bool kHasEndBatchUpdate = requires(ComponentBatchQueue<T> &queue, const ComponentBatchContext &context) {
+        T::EndBatchUpdate(Passkey<ComponentPool<T>>(), queue, context);
+    };
+
     ChunkedPool<T> pool_;
+    /// @brief EndBatchUpdate を持つ型の、このフレームの一括更新で処理するコンポーネント（一括更新中以外は空）
+    ComponentBatchQueue<T> batchQueue_;
 };
 
 } // namespace KashipanEngine
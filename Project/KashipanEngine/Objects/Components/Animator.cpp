@@ -2,12 +2,14 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <unordered_map>
 
 #include "Objects/Components/MeshFilter.h"
+#include "Objects/Components/Render/Camera3D.h"
 #include "Objects/Components/Transform.h"
 #include "Scene/SceneContext.h"
-#include "Utilities/TimeUtils.h"
+#include "Utilities/Plugin/Plugins.h"
 
 #if defined(USE_IMGUI)
 #include <imgui.h>
@@ -18,117 +20,104 @@ namespace KashipanEngine {
 
 namespace {
 
-float SampleFloatTimeline(const KeyframeTimeline &timeline, float time, bool loop) {
-    if (timeline.keys.empty()) return 0.0f;
-    if (timeline.keys.size() == 1) return std::get<float>(timeline.keys.front().value);
+/// @brief 姿勢評価のジョブ1つが受け持つAnimatorの最小数
+constexpr size_t kPoseEvaluationGrainSize = 4;
 
-    const float lastKeyTime = timeline.keys.back().time;
-    const float endTime = timeline.duration > 0.0f ? timeline.duration : lastKeyTime;
-    if (endTime <= 0.0f) return std::get<float>(timeline.keys.back().value);
+} // namespace
 
-    float sampledTime = time;
-    if (loop) {
-        sampledTime = std::fmod(sampledTime, endTime);
-        if (sampledTime < 0.0f) sampledTime += endTime;
-    } else {
-        sampledTime = std::clamp(sampledTime, 0.0f, endTime);
-    }
+void Animator::Initialize() {
+    isPlaying_ = playOnStart_;
+    RebuildSkeletonInstanceIfNeeded();
+}
 
-    auto upper = std::upper_bound(timeline.keys.begin(), timeline.keys.end(), sampledTime,
-        [](float t, const KeyframeNode &key) { return t < key.time; });
-    if (upper == timeline.keys.begin()) return std::get<float>(timeline.keys.front().value);
-    if (upper == timeline.keys.end()) return std::get<float>(timeline.keys.back().value);
+void Animator::UpdateBatch(Passkey<ComponentPool<Animator>>, ComponentBatchQueue<Animator> &queue, const ComponentBatchContext &context) {
+    RebuildSkeletonInstanceIfNeeded();
+    pendingBinding_ = nullptr;
+    isArmatureSyncPending_ = false;
+    if (poseEvaluator_.GetSkeleton().joints.empty()) return;
+
+    // クリップの解決はアセットの参照を伴うためメインスレッドで済ませ、ジョブでは姿勢の計算だけを行う
+    frameTimeStep_ = 0.0f;
+    if (isPlaying_ && !clipName_.empty() && animationHandle_ != AnimationManager::kInvalidHandle) {
+        pendingBinding_ = GetClipBinding();
+    }
+    if (pendingBinding_) {
+        frameTimeStep_ = context.deltaTime * context.gameSpeed * playbackSpeed_;
+        elapsedTime_ += frameTimeStep_;
+        if (!loop_ && elapsedTime_ >= pendingBinding_->endTime) {
+            isPlaying_ = false;
+        }
+    }
 
-    const auto &to = *upper;
-    const auto &from = *(upper - 1);
-    const float span = to.time - from.time;
-    const float n = span > 0.0f ? (sampledTime - from.time) / span : 0.0f;
-    return std::get<float>(from.value) + (std::get<float>(to.value) - std::get<float>(from.value)) * n;
+    const AnimationLod lod = SelectLod();
+    if (lod != currentLod_) {
+        currentLod_ = lod;
+        poseEvaluator_.InvalidatePoseHistory();
+    }
+    if (currentLod_ == AnimationLod::Frozen) pendingBinding_ = nullptr;
+    // 再生を止めている間に古くなった先読みの姿勢へ向かって補間しないよう、再開時は評価し直す
+    if (!pendingBinding_) poseEvaluator_.InvalidatePoseHistory();
+
+    // 姿勢が変わらないフレームは、ジョイント行列の計算が残っている場合だけ評価する
+    if (!pendingBinding_ && !poseEvaluator_.IsJointMatricesDirty()) return;
+    isArmatureSyncPending_ = pendingBinding_ != nullptr;
+    queue.push_back(this);
 }
 
-Quaternion SampleQuaternionTimeline(const KeyframeTimeline &timeline, float time, bool loop) {
-    if (timeline.keys.empty()) return Quaternion::Identity();
-    if (timeline.keys.size() == 1) return std::get<Quaternion>(timeline.keys.front().value);
+void Animator::EndBatchUpdate(Passkey<ComponentPool<Animator>>, ComponentBatchQueue<Animator> &queue, const ComponentBatchContext &) {
+    if (queue.empty()) return;
 
-    const float lastKeyTime = timeline.keys.back().time;
-    const float endTime = timeline.duration > 0.0f ? timeline.duration : lastKeyTime;
-    if (endTime <= 0.0f) return std::get<Quaternion>(timeline.keys.back().value);
+    // 各Animatorが書き込むのは自身のスケルトンインスタンスと姿勢バッファだけなので、インスタンス単位で並列に評価できる
+    Plugin::ParallelFor(queue.size(), kPoseEvaluationGrainSize, [&queue](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) queue[i]->EvaluatePose();
+    });
 
-    float sampledTime = time;
-    if (loop) {
-        sampledTime = std::fmod(sampledTime, endTime);
-        if (sampledTime < 0.0f) sampledTime += endTime;
-    } else {
-        sampledTime = std::clamp(sampledTime, 0.0f, endTime);
+    // アーマチュア用オブジェクトのTransformはシーンの階層表に属するため、メインスレッドで順に書き込む
+    for (Animator *animator : queue) {
+        if (animator->isArmatureSyncPending_) animator->SyncArmatureObjects();
+        animator->pendingBinding_ = nullptr;
     }
-
-    auto upper = std::upper_bound(timeline.keys.begin(), timeline.keys.end(), sampledTime,
-        [](float t, const KeyframeNode &key) { return t < key.time; });
-    if (upper == timeline.keys.begin()) return std::get<Quaternion>(timeline.keys.front().value);
-    if (upper == timeline.keys.end()) return std::get<Quaternion>(timeline.keys.back().value);
-
-    const auto &to = *upper;
-    const auto &from = *(upper - 1);
-    const float span = to.time - from.time;
-    const float n = span > 0.0f ? (sampledTime - from.time) / span : 0.0f;
-    return Quaternion::Slerp(std::get<Quaternion>(from.value), std::get<Quaternion>(to.value), n);
 }
 
-/// @brief アニメーションクリップをスケルトンの各ジョイントのTransformへ適用する
-void ApplyClipToSkeletonJoints(const AnimationClip &clip, const Skeleton &skeleton, float time, bool loop) {
-    for (const auto &joint : skeleton.joints) {
-        auto it = clip.nodeNameToTimelineIndices.find(joint.name);
-        if (it == clip.nodeNameToTimelineIndices.end()) continue;
+AnimationLod Animator::SelectLod() const {
+    if (lod_ != AnimationLod::Auto) return lod_;
 
-        SkeletonTransform *transform = joint.transform.get();
-        if (!transform) continue;
-
-        Vector3 translate = transform->GetTranslate();
-        Vector3 scale = transform->GetScale();
-        Quaternion rotate = transform->GetRotate();
-        bool hasTranslate = false;
-        bool hasScale = false;
-        bool hasRotate = false;
-
-        for (auto timelineIndex : it->second) {
-            if (timelineIndex >= clip.timelines.size()) continue;
-            const auto &timeline = clip.timelines[timelineIndex];
-            if (timeline.valueType == KeyframeValueType::Float) {
-                const float v = SampleFloatTimeline(timeline, time, loop);
-                if (timeline.name.ends_with(".Translate.X")) { translate.x = v; hasTranslate = true; }
-                else if (timeline.name.ends_with(".Translate.Y")) { translate.y = v; hasTranslate = true; }
-                else if (timeline.name.ends_with(".Translate.Z")) { translate.z = v; hasTranslate = true; }
-                else if (timeline.name.ends_with(".Scale.X")) { scale.x = v; hasScale = true; }
-                else if (timeline.name.ends_with(".Scale.Y")) { scale.y = v; hasScale = true; }
-                else if (timeline.name.ends_with(".Scale.Z")) { scale.z = v; hasScale = true; }
-            } else if (timeline.valueType == KeyframeValueType::Quaternion && timeline.name.ends_with(".Rotate")) {
-                rotate = SampleQuaternionTimeline(timeline, time, loop);
-                hasRotate = true;
-            }
-        }
-
-        if (hasTranslate) transform->SetTranslate(translate);
-        if (hasScale) transform->SetScale(scale);
-        if (hasRotate) transform->SetRotate(rotate);
+    auto *sceneContext = GetOwnerSceneContext();
+    auto *objectContext = GetOwnerObjectContext();
+    if (!sceneContext || !objectContext || !lodReferenceObjectID_.IsValid()) return AnimationLod::Full;
+    EmptyObject *referenceObject = sceneContext->GetSceneObject(lodReferenceObjectID_);
+    auto *referenceTransform = referenceObject ? referenceObject->GetComponent<Transform>() : nullptr;
+    auto *ownerTransform = objectContext->GetComponent<Transform>();
+    if (!referenceTransform || !ownerTransform) return AnimationLod::Full;
+
+    const Matrix4x4 &referenceWorld = referenceTransform->GetWorldMatrix();
+    const Vector3 referencePosition(referenceWorld.m[3][0], referenceWorld.m[3][1], referenceWorld.m[3][2]);
+    const Vector3 toOwner = ownerTransform->GetWorldPosition() - referencePosition;
+    const float distance = toOwner.Length();
+    if (distance >= lodFrozenDistance_) return AnimationLod::Frozen;
+
+    // 基準オブジェクトがカメラの場合、視野（対角方向の画角）の外にあるものは近距離を除いて評価を止める
+    // （近距離は影や、振り向いた直後に映ることを考えて距離の段階に従う）
+    if (auto *camera = referenceObject->GetComponent<Camera3D>(); camera && !camera->IsOrthographic() && distance > lodHalfRateDistance_) {
+        const Vector3 forward = Vector3(referenceWorld.m[2][0], referenceWorld.m[2][1], referenceWorld.m[2][2]).Normalize();
+        const float tanHalfFovY = std::tan(camera->GetFovY() * 0.5f);
+        const float tanHalfDiagonal = tanHalfFovY * std::sqrt(1.0f + camera->GetAspectRatio() * camera->GetAspectRatio());
+        const float cosHalfDiagonal = 1.0f / std::sqrt(1.0f + tanHalfDiagonal * tanHalfDiagonal);
+        if (forward.Dot(toOwner) < cosHalfDiagonal * distance) return AnimationLod::Frozen;
     }
-}
 
-} // namespace
+    if (distance >= lodReducedBonesDistance_) return AnimationLod::ReducedBones;
+    if (distance >= lodHalfRateDistance_) return AnimationLod::HalfRate;
+    return AnimationLod::Full;
+}
 
-void Animator::Initialize() {
-    isPlaying_ = playOnStart_;
-    RebuildSkeletonInstanceIfNeeded();
+void Animator::EvaluatePose() {
+    poseEvaluator_.Evaluate(pendingBinding_, currentLod_, elapsedTime_, frameTimeStep_, loop_, reducedBoneDepth_);
 }
 
-void Animator::Update() {
+const std::vector<Matrix4x4> &Animator::GetJointMatrices(Passkey<SkinnedMeshRenderer>) {
     RebuildSkeletonInstanceIfNeeded();
-    if (skeletonInstance_.joints.empty()) return;
-    AdvanceAnimation(GetDeltaTime() * GetGameSpeed());
-
-    // アニメーション再生中は、シーン上のアーマチュア用オブジェクトの位置をジョイント姿勢と紐づけする
-    if (isPlaying_ && !clipName_.empty()) {
-        SyncArmatureObjects();
-    }
+    return poseEvaluator_.GetJointMatrices();
 }
 
 ModelManager::ModelHandle Animator::GetMeshHandle() const {
@@ -154,8 +143,11 @@ void Animator::RebuildSkeletonInstanceIfNeeded() {
         // SkeletonManagerが保持する共有アセット本体ではなく、このコンポーネント専用に複製した
         // スケルトンを使う（同じスケルトンアセットを参照する複数のAnimatorが互いのアニメーション
         // 再生状態に干渉しないようにするため）
-        skeletonInstance_ = SkeletonManager::CloneSkeleton(skeletonHandle_);
+        poseEvaluator_.SetSkeleton(SkeletonManager::CloneSkeleton(skeletonHandle_));
         elapsedTime_ = 0.0f;
+        InvalidateClipBinding();
+        ++skeletonGeneration_;
+        isArmatureCacheDirty_ = true;
     }
 
     if (meshChanged || animationSourceAssetPath_ != lastAnimationSourceAssetPath_) {
@@ -164,35 +156,56 @@ void Animator::RebuildSkeletonInstanceIfNeeded() {
         // そのファイルからアニメーションを取得する（同じボーン名を持つ別ファイルの共有に対応するため）
         const std::string &animAssetPath = animationSourceAssetPath_.empty() ? baseAssetPath_ : animationSourceAssetPath_;
         animationHandle_ = AnimationManager::GetAnimationHandleFromAssetPath(animAssetPath);
+        InvalidateClipBinding();
     }
 }
 
-void Animator::AdvanceAnimation(float deltaTime) {
-    if (!isPlaying_ || clipName_.empty()) return;
-    if (skeletonHandle_ == SkeletonManager::kInvalidHandle || animationHandle_ == AnimationManager::kInvalidHandle) return;
-
-    const auto &animData = AnimationManager::GetAnimationData(animationHandle_);
-    const AnimationClip *clip = animData.FindClipByName(clipName_);
-    if (!clip) return;
+Animator::CompiledClipBinding *Animator::GetClipBinding() {
+    if (isClipBindingDirty_) {
+        isClipBindingDirty_ = false;
+        selectedClip_ = nullptr;
+        if (!clipName_.empty() && animationHandle_ != AnimationManager::kInvalidHandle) {
+            selectedClip_ = AnimationManager::GetAnimationData(animationHandle_).FindClipByName(clipName_);
+        }
+        // 同じクリップを選び直した場合も、取得元の読み直しでキーが変わっている場合があるため作り直す
+        poseEvaluator_.InvalidateClipBinding();
+    }
+    // クリップ・スケルトンのどちらかが前回の解決時と異なる場合は、姿勢評価の側で作り直される
+    return poseEvaluator_.BindClip(selectedClip_);
+}
 
-    elapsedTime_ += deltaTime * playbackSpeed_;
-    ApplyClipToSkeletonJoints(*clip, skeletonInstance_, elapsedTime_, loop_);
+void Animator::SyncArmatureObjects() {
+    const Skeleton &skeleton = poseEvaluator_.GetSkeleton();
+    if (skeleton.joints.empty()) return;
+    auto *sceneContext = GetOwnerSceneContext();
+    if (!sceneContext) return;
+    if (isArmatureCacheDirty_) RebuildArmatureCache();
 
-    if (!loop_) {
-        float clipEndTime = 0.0f;
-        for (const auto &timeline : clip->timelines) {
-            const float endTime = timeline.duration > 0.0f ? timeline.duration
-                : (timeline.keys.empty() ? 0.0f : timeline.keys.back().time);
-            clipEndTime = std::max(clipEndTime, endTime);
-        }
-        if (elapsedTime_ >= clipEndTime) {
-            isPlaying_ = false;
+    // ジョイントのローカルTRSを同名オブジェクトのTransformへ書き込む
+    // （プレハブのアーマチュア階層はモデルのノード階層と同じ構造のため、ローカル値が1:1で対応する）
+    for (size_t jointIndex = 0; jointIndex < armatureObjectIDs_.size(); ++jointIndex) {
+        const UUID128 &objectID = armatureObjectIDs_[jointIndex];
+        if (!objectID.IsValid()) continue;
+        const auto &joint = skeleton.joints[jointIndex];
+        if (!joint.transform) continue;
+        EmptyObject *object = sceneContext->GetSceneObject(objectID);
+        if (!object) {
+            // 削除されたオブジェクトがあれば次のフレームで探し直す
+            isArmatureCacheDirty_ = true;
+            continue;
         }
+        auto *transform = object->GetComponent<Transform>();
+        if (!transform) continue;
+        transform->SetTranslate(joint.transform->GetTranslate());
+        transform->SetRotateQuaternion(joint.transform->GetRotate());
+        transform->SetScale(joint.transform->GetScale());
     }
 }
 
-void Animator::SyncArmatureObjects() {
-    if (skeletonInstance_.joints.empty()) return;
+void Animator::RebuildArmatureCache() {
+    isArmatureCacheDirty_ = false;
+    const Skeleton &skeleton = poseEvaluator_.GetSkeleton();
+    armatureObjectIDs_.assign(skeleton.joints.size(), UUID128());
     auto *sceneContext = GetOwnerSceneContext();
     if (!sceneContext) return;
 
@@ -229,27 +242,15 @@ void Animator::SyncArmatureObjects() {
         if (!isInSubtree) continue;
         nameToObject.emplace(obj->GetName(), obj);
     }
-    if (nameToObject.empty()) return;
 
-    // ジョイントのローカルTRSを同名オブジェクトのTransformへ書き込む
-    // （プレハブのアーマチュア階層はモデルのノード階層と同じ構造のため、ローカル値が1:1で対応する）
-    for (const auto &joint : skeletonInstance_.joints) {
-        if (!joint.transform) continue;
-        auto it = nameToObject.find(joint.name);
-        if (it == nameToObject.end()) continue;
-        auto *transform = it->second->GetComponent<Transform>();
-        if (!transform) continue;
-        transform->SetTranslate(joint.transform->GetTranslate());
-        transform->SetRotateQuaternion(joint.transform->GetRotate());
-        transform->SetScale(joint.transform->GetScale());
+    for (size_t jointIndex = 0; jointIndex < armatureObjectIDs_.size(); ++jointIndex) {
+        auto it = nameToObject.find(skeleton.joints[jointIndex].name);
+        if (it != nameToObject.end()) armatureObjectIDs_[jointIndex] = it->second->GetObjectID();
     }
 }
 
 void Animator::ResetToBindPose() {
-    for (auto &joint : skeletonInstance_.joints) {
-        if (auto *t = joint.transform.get()) t->ResetToBindPose();
-        if (auto *t = joint.skeletonSpaceTransform.get()) t->ResetToBindPose();
-    }
+    poseEvaluator_.ResetToBindPose();
     elapsedTime_ = 0.0f;
 }
 
@@ -271,11 +272,14 @@ std::vector<std::string> Animator::GetAvailableClipNames() const {
 
 #if defined(USE_IMGUI)
 void Animator::ShowImGui() {
-    TargetObjectSelector::ShowSelector(TranslationLabel("component.animator.root_bone"), GetOwnerSceneContext(), rootBoneObjectID_);
+    if (TargetObjectSelector::ShowSelector(TranslationLabel("component.animator.root_bone"), GetOwnerSceneContext(), rootBoneObjectID_)) {
+        isArmatureCacheDirty_ = true;
+    }
 
     const auto clipNames = GetAvailableClipNames();
     if (ImGuiCustom::SelectString(TranslationLabel("component.animator.animation_clip"), clipName_, clipNames, true)) {
         elapsedTime_ = 0.0f;
+        InvalidateClipBinding();
     }
 
     // アニメーション取得元（未指定の場合はメッシュ自身のファイルから取得する）
@@ -297,7 +301,25 @@ void Animator::ShowImGui() {
     if (ImGui::Button(isPlaying_ ? TranslationLabel("component.animator.stop") : TranslationLabel("component.animator.play"))) {
         isPlaying_ = !isPlaying_;
     }
-    ImGui::Text(TranslationC("component.animator.joint_count_d"), static_cast<int>(skeletonInstance_.joints.size()));
+    ImGui::Text(TranslationC("component.animator.joint_count_d"), static_cast<int>(poseEvaluator_.GetSkeleton().joints.size()));
+
+    ImGui::Separator();
+    static const char *kLodNames[] = { "Auto", "Full", "HalfRate", "ReducedBones", "Frozen" };
+    int lodIndex = static_cast<int>(lod_);
+    if (ImGui::Combo(TranslationLabel("component.animator.lod"), &lodIndex, kLodNames, IM_ARRAYSIZE(kLodNames))) {
+        lod_ = static_cast<AnimationLod>(lodIndex);
+    }
+    if (lod_ == AnimationLod::Auto) {
+        TargetObjectSelector::ShowSelector(TranslationLabel("component.animator.lod_reference"), GetOwnerSceneContext(), lodReferenceObjectID_, true, false);
+        if (ImGui::IsItemHovered()) {
+            ImGui::SetTooltip(TranslationC("component.animator.lod_reference_desc"));
+        }
+        ImGui::DragFloat(TranslationLabel("component.animator.lod_half_rate_distance"), &lodHalfRateDistance_, 0.1f, 0.0f, 10000.0f);
+        ImGui::DragFloat(TranslationLabel("component.animator.lod_reduced_bones_distance"), &lodReducedBonesDistance_, 0.1f, 0.0f, 10000.0f);
+        ImGui::DragFloat(TranslationLabel("component.animator.lod_frozen_distance"), &lodFrozenDistance_, 0.1f, 0.0f, 10000.0f);
+    }
+    ImGui::DragInt(TranslationLabel("component.animator.reduced_bone_depth"), &reducedBoneDepth_, 0.1f, 0, 64);
+    ImGui::Text(TranslationC("component.animator.current_lod_s"), kLodNames[static_cast<int>(currentLod_)]);
 }
 #endif
 
@@ -309,6 +331,12 @@ JSON Animator::SaveToJson() const {
     json["playOnStart"] = playOnStart_;
     json["loop"] = loop_;
     json["playbackSpeed"] = playbackSpeed_;
+    json["lod"] = static_cast<int>(lod_);
+    json["lodReferenceObjectID"] = ToJSON(lodReferenceObjectID_);
+    json["lodHalfRateDistance"] = lodHalfRateDistance_;
+    json["lodReducedBonesDistance"] = lodReducedBonesDistance_;
+    json["lodFrozenDistance"] = lodFrozenDistance_;
+    json["reducedBoneDepth"] = reducedBoneDepth_;
     return json;
 }
 
@@ -323,6 +351,18 @@ bool Animator::LoadFromJson(const JSON &json) {
     playOnStart_ = json.value("playOnStart", true);
     loop_ = json.value("loop", true);
     playbackSpeed_ = json.value("playbackSpeed", 1.0f);
+    lod_ = static_cast<AnimationLod>(json.value("lod", static_cast<int>(AnimationLod::Auto)));
+    if (json.contains("lodReferenceObjectID")) {
+        lodReferenceObjectID_ = FromJSON<UUID128>(json["lodReferenceObjectID"]);
+    } else {
+        lodReferenceObjectID_ = UUID128();
+    }
+    lodHalfRateDistance_ = json.value("lodHalfRateDistance", 15.0f);
+    lodReducedBonesDistance_ = json.value("lodReducedBonesDistance", 30.0f);
+    lodFrozenDistance_ = json.value("lodFrozenDistance", 60.0f);
+    reducedBoneDepth_ = json.value("reducedBoneDepth", 4);
+    InvalidateClipBinding();
+    isArmatureCacheDirty_ = true;
     return true;
 }
 
@@ -7,6 +7,7 @@
 #include "Assets/ModelManager.h"
 #include "Assets/SkeletonManager.h"
 #include "Assets/AnimationManager.h"
+#include "Assets/SkeletonPoseEvaluator.h"
 #include "Utilities/Passkeys.h"
 #include "Utilities/UUID128.h"
 #if defined(USE_IMGUI)
@@ -24,16 +25,31 @@ class SkinnedMeshRenderer;
 ///          アニメーションを適用できる（同じスケルトン構造・ボーン名を持つファイル間でのみ有効）。
 ///          SkinnedMeshRendererはこのコンポーネントが保持する姿勢（ボーンのワールド行列）を
 ///          読み取ってGPUスキニングを行うのみで、アニメーションの再生状態そのものは持たない。
+///          姿勢の評価は型ごとの一括更新で行い、シーン内の全Animatorをジョブシステムで並列に評価する。
 class Animator final : public IObjectComponent {
 public:
+    /// @brief 姿勢の評価は型ごとの一括更新で行う
+    /// @details UpdateBatch ではスケルトン・クリップの解決、再生時間とLODの更新だけを行って待ち行列へ積み、
+    ///          EndBatchUpdate で積まれた全Animatorの姿勢とジョイント行列をまとめて並列に計算する
+    static constexpr bool IsBatchProcessed() { return true; }
+    /// @brief ScriptComponent が同じフレームで変更したクリップ・再生状態をそのフレームのうちに反映する
+    static constexpr int GetBatchUpdateOrder() { return 100; }
+
     // clipName_の直接書き込み時は、セッターと同様に再生位置を先頭へ戻す
-    OBJECT_COMPONENT_CONSTRUCTOR(Animator, 1,
-        SetUpdatePriority(500);
-        ADD_MEMBER_VARIABLE_WITH_CALLBACK(clipName_, [this] { elapsedTime_ = 0.0f; });
+    OBJECT_COMPONENT_CONSTRUCTOR(Animator, 1, )
+    OBJECT_COMPONENT_MEMBER_VARIABLES(Animator,
+        ADD_MEMBER_VARIABLE_WITH_CALLBACK(clipName_, [](auto &self) {
+            self.elapsedTime_ = 0.0f;
+            self.InvalidateClipBinding();
+        });
         ADD_MEMBER_VARIABLE(animationSourceAssetPath_);
         ADD_MEMBER_VARIABLE(playOnStart_);
         ADD_MEMBER_VARIABLE(loop_);
         ADD_MEMBER_VARIABLE(playbackSpeed_);
+        ADD_MEMBER_VARIABLE(lodHalfRateDistance_);
+        ADD_MEMBER_VARIABLE(lodReducedBonesDistance_);
+        ADD_MEMBER_VARIABLE(lodFrozenDistance_);
+        ADD_MEMBER_VARIABLE(reducedBoneDepth_);
     )
     COMPONENT_CATEGORY("Animation")
     ~Animator() override = default;
@@ -46,6 +62,12 @@ public:
         ptr->playOnStart_ = playOnStart_;
         ptr->loop_ = loop_;
         ptr->playbackSpeed_ = playbackSpeed_;
+        ptr->lod_ = lod_;
+        ptr->lodReferenceObjectID_ = lodReferenceObjectID_;
+        ptr->lodHalfRateDistance_ = lodHalfRateDistance_;
+        ptr->lodReducedBonesDistance_ = lodReducedBonesDistance_;
+        ptr->lodFrozenDistance_ = lodFrozenDistance_;
+        ptr->reducedBoneDepth_ = reducedBoneDepth_;
         return ptr;
     }
 
@@ -55,7 +77,7 @@ public:
 
     /// @brief 再生するアニメーションクリップ名を設定（アニメーション取得元アセットの中から選択する。
     ///        空文字の場合はバインドポーズのまま静止する）
-    void SetClipName(const std::string &clipName) { clipName_ = clipName; elapsedTime_ = 0.0f; }
+    void SetClipName(const std::string &clipName) { clipName_ = clipName; elapsedTime_ = 0.0f; InvalidateClipBinding(); }
     const std::string &GetClipName() const noexcept { return clipName_; }
 
     /// @brief アニメーション取得元のアセットパスを設定する
@@ -80,9 +102,9 @@ public:
     ///        このオブジェクトのTransformに沿って動き、アーマチュア同期の探索起点にもなる）
     /// @details 未設定（無効なUUID）の場合は所有オブジェクト自身の最上位の祖先を起点に使う
     void SetRootBoneObject(const EmptyObject *rootBoneObject) {
-        rootBoneObjectID_ = rootBoneObject ? rootBoneObject->GetObjectID() : UUID128();
+        SetRootBoneObject(rootBoneObject ? rootBoneObject->GetObjectID() : UUID128());
     }
-    void SetRootBoneObject(const UUID128 &rootBoneObjectID) { rootBoneObjectID_ = rootBoneObjectID; }
+    void SetRootBoneObject(const UUID128 &rootBoneObjectID) { rootBoneObjectID_ = rootBoneObjectID; isArmatureCacheDirty_ = true; }
     const UUID128 &GetRootBoneObjectID() const noexcept { return rootBoneObjectID_; }
     EmptyObject *GetRootBoneObject() const {
         auto *sceneContext = GetOwnerSceneContext();
@@ -90,6 +112,37 @@ public:
         return sceneContext->GetSceneObject(rootBoneObjectID_);
     }
 
+    //==================================================
+    // アニメーションLOD
+    //==================================================
+
+    void SetLod(AnimationLod lod) { lod_ = lod; }
+    AnimationLod GetLod() const noexcept { return lod_; }
+    /// @brief 直近のフレームで実際に使われたLOD（Auto の場合は距離・視野から選ばれた段階）
+    AnimationLod GetCurrentLod() const noexcept { return currentLod_; }
+
+    /// @brief Auto のLOD判定で距離の基準にするオブジェクト（通常はカメラ）を設定する
+    /// @details Camera3D を持つ場合は視野外の判定にも使う。未設定の場合、Auto は常に Full になる
+    void SetLodReferenceObject(const EmptyObject *referenceObject) {
+        lodReferenceObjectID_ = referenceObject ? referenceObject->GetObjectID() : UUID128();
+    }
+    void SetLodReferenceObject(const UUID128 &referenceObjectID) { lodReferenceObjectID_ = referenceObjectID; }
+    const UUID128 &GetLodReferenceObjectID() const noexcept { return lodReferenceObjectID_; }
+
+    /// @brief Auto のLOD判定で各段階へ切り替える距離を設定する
+    void SetLodDistances(float halfRate, float reducedBones, float frozen) {
+        lodHalfRateDistance_ = halfRate;
+        lodReducedBonesDistance_ = reducedBones;
+        lodFrozenDistance_ = frozen;
+    }
+    float GetLodHalfRateDistance() const noexcept { return lodHalfRateDistance_; }
+    float GetLodReducedBonesDistance() const noexcept { return lodReducedBonesDistance_; }
+    float GetLodFrozenDistance() const noexcept { return lodFrozenDistance_; }
+
+    /// @brief ReducedBones で評価を続けるジョイント階層の深さ（ルートジョイントが0）
+    void SetReducedBoneDepth(int depth) { reducedBoneDepth_ = depth; }
+    int GetReducedBoneDepth() const noexcept { return reducedBoneDepth_; }
+
     /// @brief アニメーション取得元アセットに含まれるアニメーションクリップ名の一覧を取得
     std::vector<std::string> GetAvailableClipNames() const;
 
@@ -106,12 +159,28 @@ public:
     ///          から毎フレーム呼ばれる想定
     const Skeleton &GetSkeletonInstance(Passkey<SkinnedMeshRenderer>) {
         RebuildSkeletonInstanceIfNeeded();
-        return skeletonInstance_;
+        return poseEvaluator_.GetSkeleton();
     }
 
+    /// @brief 各ジョイントのスケルトン空間行列（スケルトンインスタンスのジョイントと同じ並び）を取得する
+    /// @details 通常は一括更新の姿勢評価と同じジョブ内で計算済みの値を返すだけで済む。
+    ///          バインドポーズへ戻した直後など、まだ計算されていない姿勢の場合はその場で計算する
+    const std::vector<Matrix4x4> &GetJointMatrices(Passkey<SkinnedMeshRenderer>);
+
+    /// @brief スケルトンインスタンスを作り直すたびに増える値（ジョイントのインデックスを覚えておく側の再解決判定用）
+    uint32_t GetSkeletonGeneration() const noexcept { return skeletonGeneration_; }
+
+    //==================================================
+    // ComponentPool専用: 一括更新
+    //==================================================
+
+    /// @brief スケルトン・クリップを解決して再生時間とLODを進め、姿勢を評価する場合はプールの待ち行列へ積む
+    void UpdateBatch(Passkey<ComponentPool<Animator>>, ComponentBatchQueue<Animator> &queue, const ComponentBatchContext &context);
+    /// @brief 待ち行列のAnimatorの姿勢を並列に評価し、アーマチュア用オブジェクトへ順に同期する
+    static void EndBatchUpdate(Passkey<ComponentPool<Animator>>, ComponentBatchQueue<Animator> &queue, const ComponentBatchContext &context);
+
 protected:
     void Initialize() override;
-    void Update() override;
 
 #if defined(USE_IMGUI)
     void ShowImGui() override;
@@ -121,14 +190,28 @@ protected:
     bool LoadFromJson(const JSON &json) override;
 
 private:
+    /// @brief （クリップ, スケルトン）の組ごとに一度だけ解決したバインディング
+    /// @details 姿勢評価（SkeletonPoseEvaluator::BindClip）が保持し、クリップ・スケルトンが変わると作り直される
+    using CompiledClipBinding = SkeletonPoseEvaluator::ClipBinding;
+
     ModelManager::ModelHandle GetMeshHandle() const;
     /// @brief 現在のメッシュハンドル・アニメーション取得元に応じてスケルトン・アニメーションの
     ///        解決を（再）行う。メッシュ・取得元のどちらも変わっていない場合は何もしない
     void RebuildSkeletonInstanceIfNeeded();
-    /// @brief 選択中アニメーションを進行させ、スケルトンのジョイントへ反映する
-    void AdvanceAnimation(float deltaTime);
+    /// @brief Auto の場合にLOD基準オブジェクトからの距離・視野で段階を選ぶ
+    AnimationLod SelectLod() const;
+    /// @brief UpdateBatch で決めたLODに従ってスケルトンの姿勢とジョイント行列を更新する（ワーカースレッドから呼ばれる）
+    /// @details 書き込むのはこのAnimatorの姿勢評価（poseEvaluator_）のみ
+    void EvaluatePose();
     /// @brief シーン上のアーマチュア用オブジェクトへ現在のジョイント姿勢を同期する
     void SyncArmatureObjects();
+    /// @brief ジョイント名と同名のアーマチュア用オブジェクトを探し直す
+    void RebuildArmatureCache();
+    /// @brief 選択中クリップとスケルトンインスタンスのバインディングを（必要なら）解決する
+    /// @details クリップ名の検索は InvalidateClipBinding の後の最初の呼び出しでだけ行う
+    /// @return 適用できるクリップが無い場合は nullptr
+    CompiledClipBinding *GetClipBinding();
+    void InvalidateClipBinding() noexcept { isClipBindingDirty_ = true; poseEvaluator_.InvalidatePoseHistory(); }
 
     UUID128 rootBoneObjectID_{};
     std::string clipName_;
@@ -136,11 +219,25 @@ private:
     bool playOnStart_ = true;
     bool loop_ = true;
     float playbackSpeed_ = 1.0f;
+    AnimationLod lod_ = AnimationLod::Auto;
+    UUID128 lodReferenceObjectID_{};
+    float lodHalfRateDistance_ = 15.0f;
+    float lodReducedBonesDistance_ = 30.0f;
+    float lodFrozenDistance_ = 60.0f;
+    int reducedBoneDepth_ = 4;
 
     // 再生状態（非シリアライズ）
     bool isPlaying_ = false;
     float elapsedTime_ = 0.0f;
 
+    // 一括更新で UpdateBatch から EndBatchUpdate へ渡す状態（非シリアライズ）
+    AnimationLod currentLod_ = AnimationLod::Full;
+    /// @brief このフレームで進めた再生時間
+    float frameTimeStep_ = 0.0f;
+    /// @brief このフレームで評価するクリップ（評価しない場合は nullptr）
+    CompiledClipBinding *pendingBinding_ = nullptr;
+    bool isArmatureSyncPending_ = false;
+
     // メッシュ・スケルトン・アニメーションの解決結果（非シリアライズ、キャッシュ用）
     ModelManager::ModelHandle lastMeshHandle_ = ModelManager::kInvalidHandle;
     std::string lastAnimationSourceAssetPath_;
@@ -148,9 +245,18 @@ private:
     SkeletonManager::SkeletonHandle skeletonHandle_ = SkeletonManager::kInvalidHandle;
     AnimationManager::AnimationHandle animationHandle_ = AnimationManager::kInvalidHandle;
     /// @brief このコンポーネント専用のスケルトンインスタンス（SkeletonManagerが保持する
-    ///        アセット本体とは独立した複製）。同じスケルトンアセットを参照する複数のAnimatorが
-    ///        互いのアニメーション再生状態に干渉しないよう、メッシュ解決時にCloneSkeletonで複製して保持する
-    Skeleton skeletonInstance_;
+    ///        アセット本体とは独立した複製）とその姿勢評価。同じスケルトンアセットを参照する複数のAnimatorが
+    ///        互いのアニメーション再生状態に干渉しないよう、メッシュ解決時にCloneSkeletonで複製して保持する。
+    ///        ジョイント行列はSkinnedMeshRendererがボーン行列パレットの計算に使う
+    SkeletonPoseEvaluator poseEvaluator_;
+    /// @brief clipName_ で選ばれているクリップ（見つからない場合は nullptr）
+    const AnimationClip *selectedClip_ = nullptr;
+    /// @brief selectedClip_ を検索し直す必要があるか
+    bool isClipBindingDirty_ = true;
+    uint32_t skeletonGeneration_ = 0;
+    /// @brief ジョイントごとの同名アーマチュア用オブジェクト（見つからないジョイントは無効なUUID）
+    std::vector<UUID128> armatureObjectIDs_;
+    bool isArmatureCacheDirty_ = true;
 };
 
 REGISTER_COMPONENT_OBJECT(Animator)
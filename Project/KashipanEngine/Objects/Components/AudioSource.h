@@ -56,30 +56,35 @@ public:
     };
 
     // 直接書き込み時もセッター/ImGui編集時と同じ副作用（クランプ・再生中音声への反映）がかかるようにする
-    OBJECT_COMPONENT_CONSTRUCTOR(AudioSource, 0xFF,
-        ADD_MEMBER_VARIABLE_WITH_CALLBACK(soundName_, [this] { soundHandle_ = AudioManager::kInvalidSoundHandle; });
-        ADD_MEMBER_VARIABLE_WITH_CALLBACK(volume_, [this] { volume_ = std::clamp(volume_, 0.0f, 1.0f); });
-        ADD_MEMBER_VARIABLE_WITH_CALLBACK(pitch_, [this] { SetPitch(pitch_); });
+    OBJECT_COMPONENT_CONSTRUCTOR(AudioSource, 0xFF, )
+    OBJECT_COMPONENT_MEMBER_VARIABLES(AudioSource,
+        ADD_MEMBER_VARIABLE_WITH_CALLBACK(soundName_, [](auto &self) { self.soundHandle_ = AudioManager::kInvalidSoundHandle; });
+        ADD_MEMBER_VARIABLE_WITH_CALLBACK(volume_, [](auto &self) { self.volume_ = std::clamp(self.volume_, 0.0f, 1.0f); });
+        ADD_MEMBER_VARIABLE_WITH_CALLBACK(pitch_, [](auto &self) { self.SetPitch(self.pitch_); });
         ADD_MEMBER_VARIABLE(loop_);
         ADD_MEMBER_VARIABLE(minDistance_);
         ADD_MEMBER_VARIABLE(maxDistance_);
         ADD_MEMBER_VARIABLE(enableSpatialAudio_);
-        ADD_MEMBER_VARIABLE_WITH_CALLBACK(filter_.enabled, [this] { ClampEffectParams(); ReapplyEffects(); });
-        ADD_MEMBER_VARIABLE_WITH_CALLBACK(filter_.frequency, [this] { ClampEffectParams(); ReapplyEffects(); });
-        ADD_MEMBER_VARIABLE_WITH_CALLBACK(filter_.q, [this] { ClampEffectParams(); ReapplyEffects(); });
-        ADD_MEMBER_VARIABLE_WITH_CALLBACK(reverb_.enabled, [this] { ClampEffectParams(); ReapplyEffects(); });
-        ADD_MEMBER_VARIABLE_WITH_CALLBACK(reverb_.mix, [this] { ClampEffectParams(); ReapplyEffects(); });
-        ADD_MEMBER_VARIABLE_WITH_CALLBACK(echo_.enabled, [this] { ClampEffectParams(); ReapplyEffects(); });
-        ADD_MEMBER_VARIABLE_WITH_CALLBACK(echo_.params.wetDryMix, [this] { ClampEffectParams(); ReapplyEffects(); });
-        ADD_MEMBER_VARIABLE_WITH_CALLBACK(echo_.params.feedback, [this] { ClampEffectParams(); ReapplyEffects(); });
-        ADD_MEMBER_VARIABLE_WITH_CALLBACK(echo_.params.delayMs, [this] { ClampEffectParams(); ReapplyEffects(); });
-        ADD_MEMBER_VARIABLE_WITH_CALLBACK(eq_.enabled, [this] { ClampEffectParams(); ReapplyEffects(); });
-        for (int band = 0; band < 4; ++band) {
-            AddMemberVariable("eq_.frequencyCenter[" + std::to_string(band) + "]", &eq_.params.frequencyCenter[band],
-                [this] { ClampEffectParams(); ReapplyEffects(); });
-            AddMemberVariable("eq_.gain[" + std::to_string(band) + "]", &eq_.params.gain[band],
-                [this] { ClampEffectParams(); ReapplyEffects(); });
-        }
+        ADD_MEMBER_VARIABLE_WITH_CALLBACK(filter_.enabled, [](auto &self) { self.ClampEffectParams(); self.ReapplyEffects(); });
+        ADD_MEMBER_VARIABLE_WITH_CALLBACK(filter_.frequency, [](auto &self) { self.ClampEffectParams(); self.ReapplyEffects(); });
+        ADD_MEMBER_VARIABLE_WITH_CALLBACK(filter_.q, [](auto &self) { self.ClampEffectParams(); self.ReapplyEffects(); });
+        ADD_MEMBER_VARIABLE_WITH_CALLBACK(reverb_.enabled, [](auto &self) { self.ClampEffectParams(); self.ReapplyEffects(); });
+        ADD_MEMBER_VARIABLE_WITH_CALLBACK(reverb_.mix, [](auto &self) { self.ClampEffectParams(); self.ReapplyEffects(); });
+        ADD_MEMBER_VARIABLE_WITH_CALLBACK(echo_.enabled, [](auto &self) { self.ClampEffectParams(); self.ReapplyEffects(); });
+        ADD_MEMBER_VARIABLE_WITH_CALLBACK(echo_.params.wetDryMix, [](auto &self) { self.ClampEffectParams(); self.ReapplyEffects(); });
+        ADD_MEMBER_VARIABLE_WITH_CALLBACK(echo_.params.feedback, [](auto &self) { self.ClampEffectParams(); self.ReapplyEffects(); });
+        ADD_MEMBER_VARIABLE_WITH_CALLBACK(echo_.params.delayMs, [](auto &self) { self.ClampEffectParams(); self.ReapplyEffects(); });
+        ADD_MEMBER_VARIABLE_WITH_CALLBACK(eq_.enabled, [](auto &self) { self.ClampEffectParams(); self.ReapplyEffects(); });
+        // イコライザーの各バンドは配列要素ごとに登録する（キーは従来どおり eq_.frequencyCenter[n] / eq_.gain[n]）
+        auto reapplyEffects = [](auto &self) { self.ClampEffectParams(); self.ReapplyEffects(); };
+        ADD_NAMED_MEMBER_VARIABLE_WITH_CALLBACK("eq_.frequencyCenter[0]", eq_.params.frequencyCenter[0], reapplyEffects);
+        ADD_NAMED_MEMBER_VARIABLE_WITH_CALLBACK("eq_.gain[0]", eq_.params.gain[0], reapplyEffects);
+        ADD_NAMED_MEMBER_VARIABLE_WITH_CALLBACK("eq_.frequencyCenter[1]", eq_.params.frequencyCenter[1], reapplyEffects);
+        ADD_NAMED_MEMBER_VARIABLE_WITH_CALLBACK("eq_.gain[1]", eq_.params.gain[1], reapplyEffects);
+        ADD_NAMED_MEMBER_VARIABLE_WITH_CALLBACK("eq_.frequencyCenter[2]", eq_.params.frequencyCenter[2], reapplyEffects);
+        ADD_NAMED_MEMBER_VARIABLE_WITH_CALLBACK("eq_.gain[2]", eq_.params.gain[2], reapplyEffects);
+        ADD_NAMED_MEMBER_VARIABLE_WITH_CALLBACK("eq_.frequencyCenter[3]", eq_.params.frequencyCenter[3], reapplyEffects);
+        ADD_NAMED_MEMBER_VARIABLE_WITH_CALLBACK("eq_.gain[3]", eq_.params.gain[3], reapplyEffects);
     )
     COMPONENT_CATEGORY("Audio")
     ~AudioSource() override { Stop(); }
@@ -8,10 +8,12 @@ namespace KashipanEngine {
 /// @brief 2D用の矩形コライダー
 class Box2DCollider final : public ICollider {
 public:
-    Box2DCollider() : ICollider("Box2DCollider", Shape::Box2D, true, GetComponentTypeID<Box2DCollider>()) {
+    Box2DCollider() : ICollider("Box2DCollider", Shape::Box2D, true, GetComponentTypeID<Box2DCollider>()) {}
+    OBJECT_COMPONENT_MEMBER_VARIABLES(Box2DCollider,
+        ICollider::RegisterMemberVariables(builder);
         ADD_MEMBER_VARIABLE(size_);
         ADD_MEMBER_VARIABLE(center_);
-    }
+    )
     ~Box2DCollider() override = default;
 
     std::unique_ptr<IObjectComponent> Clone() const override {
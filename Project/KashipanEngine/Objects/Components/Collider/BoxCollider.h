@@ -7,10 +7,12 @@ namespace KashipanEngine {
 
 class BoxCollider final : public ICollider {
 public:
-    BoxCollider() : ICollider("BoxCollider", Shape::Box, false, GetComponentTypeID<BoxCollider>()) {
+    BoxCollider() : ICollider("BoxCollider", Shape::Box, false, GetComponentTypeID<BoxCollider>()) {}
+    OBJECT_COMPONENT_MEMBER_VARIABLES(BoxCollider,
+        ICollider::RegisterMemberVariables(builder);
         ADD_MEMBER_VARIABLE(size_);
         ADD_MEMBER_VARIABLE(center_);
-    }
+    )
     ~BoxCollider() override = default;
 
     std::unique_ptr<IObjectComponent> Clone() const override {
@@ -9,11 +9,13 @@ namespace KashipanEngine {
 /// @brief 2D用のカプセルコライダー
 class Capsule2DCollider final : public ICollider {
 public:
-    Capsule2DCollider() : ICollider("Capsule2DCollider", Shape::Capsule2D, true, GetComponentTypeID<Capsule2DCollider>()) {
+    Capsule2DCollider() : ICollider("Capsule2DCollider", Shape::Capsule2D, true, GetComponentTypeID<Capsule2DCollider>()) {}
+    OBJECT_COMPONENT_MEMBER_VARIABLES(Capsule2DCollider,
+        ICollider::RegisterMemberVariables(builder);
         ADD_MEMBER_VARIABLE(start_);
         ADD_MEMBER_VARIABLE(end_);
         ADD_MEMBER_VARIABLE(radius_);
-    }
+    )
     ~Capsule2DCollider() override = default;
 
     std::unique_ptr<IObjectComponent> Clone() const override {
@@ -8,11 +8,13 @@ namespace KashipanEngine {
 
 class CapsuleCollider final : public ICollider {
 public:
-    CapsuleCollider() : ICollider("CapsuleCollider", Shape::Capsule, false, GetComponentTypeID<CapsuleCollider>()) {
+    CapsuleCollider() : ICollider("CapsuleCollider", Shape::Capsule, false, GetComponentTypeID<CapsuleCollider>()) {}
+    OBJECT_COMPONENT_MEMBER_VARIABLES(CapsuleCollider,
+        ICollider::RegisterMemberVariables(builder);
         ADD_MEMBER_VARIABLE(radius_);
         ADD_MEMBER_VARIABLE(height_);
         ADD_MEMBER_VARIABLE(center_);
-    }
+    )
     ~CapsuleCollider() override = default;
 
     std::unique_ptr<IObjectComponent> Clone() const override {
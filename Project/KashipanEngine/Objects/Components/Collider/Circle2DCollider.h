@@ -9,10 +9,12 @@ namespace KashipanEngine {
 /// @brief 2D用の円コライダー
 class Circle2DCollider final : public ICollider {
 public:
-    Circle2DCollider() : ICollider("Circle2DCollider", Shape::Circle2D, true, GetComponentTypeID<Circle2DCollider>()) {
+    Circle2DCollider() : ICollider("Circle2DCollider", Shape::Circle2D, true, GetComponentTypeID<Circle2DCollider>()) {}
+    OBJECT_COMPONENT_MEMBER_VARIABLES(Circle2DCollider,
+        ICollider::RegisterMemberVariables(builder);
         ADD_MEMBER_VARIABLE(radius_);
         ADD_MEMBER_VARIABLE(center_);
-    }
+    )
     ~Circle2DCollider() override = default;
 
     std::unique_ptr<IObjectComponent> Clone() const override {
@@ -123,14 +123,18 @@ public:
         return Vector2(localOffset.x * c - localOffset.y * s, localOffset.x * s + localOffset.y * c);
     }
 
-protected:
-    ICollider(const std::string &typeName, Shape shape, bool is2D, size_t componentTypeID)
-        : IObjectComponent(typeName, 0xFF, componentTypeID), shape_(shape), is2D_(is2D) {
+    /// @brief 共通のメンバー変数を登録する（派生クラスの登録関数から最初に呼ぶ）
+    template <typename Self>
+    static void RegisterMemberVariables(MemberVariableTableBuilder<Self> &builder) {
         // 共通のImGui編集パラメータを外部アクセス用に登録する（形状パラメータは各派生クラスで登録）
         ADD_MEMBER_VARIABLE(isTrigger_);
         ADD_MEMBER_VARIABLE(continuousDetection_);
     }
 
+protected:
+    ICollider(const std::string &typeName, Shape shape, bool is2D, size_t componentTypeID)
+        : IObjectComponent(typeName, 0xFF, componentTypeID), shape_(shape), is2D_(is2D) {}
+
     /// @brief SceneObjectColliderへ自身を登録する（定義はEmptyObject/SceneObjectColliderの完全な型が必要なためICollider.cppにある）
     void Initialize() override;
     /// @brief SceneObjectColliderから自身の登録を解除する（定義はICollider.cppにある）
@@ -16,9 +16,11 @@ namespace KashipanEngine {
 ///          メッシュを明示的に指定しない場合は、同オブジェクトのMeshFilterコンポーネントのメッシュを参照する。
 class MeshCollider final : public ICollider {
 public:
-    MeshCollider() : ICollider("MeshCollider", Shape::Mesh, false, GetComponentTypeID<MeshCollider>()) {
+    MeshCollider() : ICollider("MeshCollider", Shape::Mesh, false, GetComponentTypeID<MeshCollider>()) {}
+    OBJECT_COMPONENT_MEMBER_VARIABLES(MeshCollider,
+        ICollider::RegisterMemberVariables(builder);
         ADD_MEMBER_VARIABLE(convex_);
-    }
+    )
     ~MeshCollider() override = default;
 
     std::unique_ptr<IObjectComponent> Clone() const override {
@@ -54,24 +56,21 @@ public:
         const ModelData &data = ModelManager::GetModelData(meshHandle);
         if (data.GetVertexCount() == 0 || data.GetIndexCount() == 0) return std::nullopt;
 
-        std::vector<Vector3> vertices;
-        vertices.reserve(data.GetVertexCount());
-        for (const auto &v : data.GetVertices()) {
-            vertices.emplace_back(v.px, v.py, v.pz);
-        }
-
+        // 頂点・インデックスはコピーせず、モデルハンドルと世代番号だけを渡す。衝突判定メッシュは
+        // Collider側の共有キャッシュで (モデル, 世代, Convex) ごとに一度だけ構築され、全インスタンスで共有される
         ColliderInfo3D info;
         const Vector3 scale = GetSyncedOwnerScale();
+        const auto revision = ModelManager::GetModelRevision(meshHandle);
         if (convex_) {
             ColliderInfo3D::ConvexMeshShape3D meshShape;
-            meshShape.vertices = std::move(vertices);
-            meshShape.indices = data.GetIndices();
+            meshShape.modelHandle = meshHandle;
+            meshShape.modelRevision = revision;
             meshShape.scale = scale;
             info.shape = std::move(meshShape);
         } else {
             ColliderInfo3D::ConcaveMeshShape3D meshShape;
-            meshShape.vertices = std::move(vertices);
-            meshShape.indices = data.GetIndices();
+            meshShape.modelHandle = meshHandle;
+            meshShape.modelRevision = revision;
             meshShape.scale = scale;
             info.shape = std::move(meshShape);
         }
@@ -17,10 +17,12 @@ namespace KashipanEngine {
 ///          CastRay()で任意のタイミングの単発レイキャストも行える（この自動判定とは独立して動作する）。
 class RayCollider final : public ICollider {
 public:
-    RayCollider() : ICollider("RayCollider", Shape::Ray, false, GetComponentTypeID<RayCollider>()) {
+    RayCollider() : ICollider("RayCollider", Shape::Ray, false, GetComponentTypeID<RayCollider>()) {}
+    OBJECT_COMPONENT_MEMBER_VARIABLES(RayCollider,
+        ICollider::RegisterMemberVariables(builder);
         ADD_MEMBER_VARIABLE(direction_);
         ADD_MEMBER_VARIABLE(maxDistance_);
-    }
+    )
     ~RayCollider() override = default;
 
     std::unique_ptr<IObjectComponent> Clone() const override {
@@ -105,43 +107,22 @@ private:
         auto *sceneContext = GetOwnerSceneContext();
         auto *sceneObjectCollider = sceneContext ? sceneContext->GetComponent<SceneObjectCollider>() : nullptr;
         auto *colliderSystem = sceneObjectCollider ? sceneObjectCollider->GetCollider() : nullptr;
-        auto *world = colliderSystem ? colliderSystem->GetPhysicsWorld() : nullptr;
-        if (!world) return false;
-
-        const Vector3 origin = GetSyncedOwnerPosition();
-        const Vector3 dir = GetSyncedOwnerRotation().RotateVector(direction_).Normalize();
-        const Vector3 end = origin + dir * maxDistance_;
-
-        const reactphysics3d::Ray ray(
-            reactphysics3d::Vector3(origin.x, origin.y, origin.z),
-            reactphysics3d::Vector3(end.x, end.y, end.z));
-
-        struct Callback final : reactphysics3d::RaycastCallback {
-            const Collider *colliderSystem = nullptr;
-            bool hit = false;
-            HitInfo3D info{};
-            reactphysics3d::decimal notifyRaycastHit(const reactphysics3d::RaycastInfo &raycastInfo) override {
-                hit = true;
-                info.isHit = true;
-                info.normal = Vector3{raycastInfo.worldNormal.x, raycastInfo.worldNormal.y, raycastInfo.worldNormal.z};
-                info.penetration = 0.0f;
-                // ヒットしたRP3D Collider*から、登録元のEmptyObject/ICollider（衝突相手）を逆引きする
-                if (const auto *hitInfo = colliderSystem ? colliderSystem->FindInfoByHandle3D(raycastInfo.collider) : nullptr) {
-                    info.otherObject = hitInfo->ownerObject;
-                    info.otherCollider = hitInfo->sourceCollider;
-                }
-                return raycastInfo.hitFraction;
-            }
-        } callback;
-        callback.colliderSystem = colliderSystem;
-
-        world->raycast(ray, &callback);
-        if (callback.hit) {
-            outHit = callback.info;
-            outHit.selfObject = const_cast<EmptyObject *>(GetOwnerObject());
-            outHit.selfCollider = const_cast<RayCollider *>(this);
-        }
-        return callback.hit;
+        if (!colliderSystem) return false;
+
+        RaycastQuery3D query;
+        query.origin = GetSyncedOwnerPosition();
+        query.direction = GetSyncedOwnerRotation().RotateVector(direction_);
+        query.maxDistance = maxDistance_;
+
+        // ヒットした相手（EmptyObject/ICollider）の逆引きはCollider側でRP3Dのユーザーデータから行われる
+        std::vector<QueryHit3D> hits;
+        colliderSystem->Raycast3D(std::span<const RaycastQuery3D>(&query, 1), hits);
+        if (hits.empty() || !hits.front().hitInfo.isHit) return false;
+
+        outHit = hits.front().hitInfo;
+        outHit.selfObject = const_cast<EmptyObject *>(GetOwnerObject());
+        outHit.selfCollider = const_cast<RayCollider *>(this);
+        return true;
     }
 
     /// @brief 保持中のヒット状態に基づいてOnCollisionExit3Dを発火し、状態をリセットする
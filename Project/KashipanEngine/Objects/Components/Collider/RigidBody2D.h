@@ -10,7 +10,8 @@ namespace KashipanEngine {
 
 class RigidBody2D final : public IObjectComponent {
 public:
-    OBJECT_COMPONENT_CONSTRUCTOR(RigidBody2D, 1,
+    OBJECT_COMPONENT_CONSTRUCTOR(RigidBody2D, 1, )
+    OBJECT_COMPONENT_MEMBER_VARIABLES(RigidBody2D,
         ADD_MEMBER_VARIABLE(velocity_);
         ADD_MEMBER_VARIABLE(mass_);
         ADD_MEMBER_VARIABLE(useGravity_);
@@ -15,10 +15,11 @@ namespace KashipanEngine {
 class RigidBody3D final : public IObjectComponent {
 public:
     // 直接書き込み時は、セッターと同様に生成済みの物理ボディへも反映する
-    OBJECT_COMPONENT_CONSTRUCTOR(RigidBody3D, 1,
-        ADD_MEMBER_VARIABLE_WITH_CALLBACK(mass_, [this] { SetMass(mass_); });
-        ADD_MEMBER_VARIABLE_WITH_CALLBACK(useGravity_, [this] { SetUseGravity(useGravity_); });
-        ADD_MEMBER_VARIABLE_WITH_CALLBACK(interpolate_, [this] { SetInterpolate(interpolate_); });
+    OBJECT_COMPONENT_CONSTRUCTOR(RigidBody3D, 1, )
+    OBJECT_COMPONENT_MEMBER_VARIABLES(RigidBody3D,
+        ADD_MEMBER_VARIABLE_WITH_CALLBACK(mass_, [](auto &self) { self.SetMass(self.mass_); });
+        ADD_MEMBER_VARIABLE_WITH_CALLBACK(useGravity_, [](auto &self) { self.SetUseGravity(self.useGravity_); });
+        ADD_MEMBER_VARIABLE_WITH_CALLBACK(interpolate_, [](auto &self) { self.SetInterpolate(self.interpolate_); });
     )
     COMPONENT_CATEGORY("Collision")
     ~RigidBody3D() override = default;
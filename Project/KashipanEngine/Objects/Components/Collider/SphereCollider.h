@@ -8,10 +8,12 @@ namespace KashipanEngine {
 
 class SphereCollider final : public ICollider {
 public:
-    SphereCollider() : ICollider("SphereCollider", Shape::Sphere, false, GetComponentTypeID<SphereCollider>()) {
+    SphereCollider() : ICollider("SphereCollider", Shape::Sphere, false, GetComponentTypeID<SphereCollider>()) {}
+    OBJECT_COMPONENT_MEMBER_VARIABLES(SphereCollider,
+        ICollider::RegisterMemberVariables(builder);
         ADD_MEMBER_VARIABLE(radius_);
         ADD_MEMBER_VARIABLE(center_);
-    }
+    )
     ~SphereCollider() override = default;
 
     std::unique_ptr<IObjectComponent> Clone() const override {
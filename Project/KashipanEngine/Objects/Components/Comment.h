@@ -11,39 +11,27 @@ namespace KashipanEngine {
 ///          オブジェクトヒエラルキーで対象オブジェクトにカーソルを合わせた際にツールチップとして表示される
 class Comment final : public IObjectComponent {
 public:
-    OBJECT_COMPONENT_CONSTRUCTOR(Comment, 1,
-        ADD_MEMBER_VARIABLE(comment_);
+    OBJECT_COMPONENT_CONSTRUCTOR(Comment, 1, )
+    OBJECT_COMPONENT_MEMBER_VARIABLES(Comment,
+        ADD_SERIALIZED_MEMBER_VARIABLE(comment_, { .serializedKey = "comment" });
+        MEMBER_VARIABLES_COVER_ALL_STATE();
     )
     COMPONENT_CATEGORY("Debug")
     ~Comment() override = default;
 
-    std::unique_ptr<IObjectComponent> Clone() const override {
-        auto ptr = std::make_unique<Comment>();
-        ptr->comment_ = comment_;
-        return ptr;
-    }
+    std::unique_ptr<IObjectComponent> Clone() const override { return CloneByMemberVariables<Comment>(); }
 
     void SetComment(const std::string &comment) { comment_ = comment; }
     const std::string &GetComment() const noexcept { return comment_; }
 
 protected:
+    // 複数行で編集するため表示だけは個別に書く（保存・読み込みはメンバー変数表から行う）
 #if defined(USE_IMGUI)
     void ShowImGui() override {
         ImGui::InputTextMultiline(TranslationLabel("component.comment.comment"), &comment_);
     }
 #endif
 
-    JSON SaveToJson() const override {
-        JSON json = JSON::object();
-        json["comment"] = comment_;
-        return json;
-    }
-
-    bool LoadFromJson(const JSON &json) override {
-        comment_ = json.value("comment", std::string{});
-        return true;
-    }
-
 private:
     std::string comment_;
 };
@@ -37,6 +37,8 @@ public:
 
     OBJECT_COMPONENT_CONSTRUCTOR(ComputeShaderProcessing, 0xFF,
         SetUpdatePriority(100);
+    )
+    OBJECT_COMPONENT_MEMBER_VARIABLES(ComputeShaderProcessing,
         ADD_MEMBER_VARIABLE(pipelineName_);
         ADD_MEMBER_VARIABLE(groupCountX_);
         ADD_MEMBER_VARIABLE(groupCountY_);
@@ -99,12 +99,10 @@ const InputCommandApplier::CommandEntry *InputCommandApplier::FindCommand(const
     return nullptr;
 }
 
-void InputCommandApplier::ApplyValue(const CommandEntry &entry, float value) {
+void InputCommandApplier::ApplyValue(CommandEntry &entry, float value) {
     auto *objectContext = GetOwnerObjectContext();
     if (!objectContext) return;
-    for (const auto &binding : entry.bindings) {
-        ApplyParameterBinding(objectContext, binding, value, this);
-    }
+    entry.bindingTable.Apply(objectContext, entry.bindings, value, this);
 }
 
 #if defined(USE_IMGUI)
@@ -204,7 +202,9 @@ void InputCommandApplier::ShowCommandImGui(CommandEntry &entry, const std::vecto
     }
 
     ImGui::Separator();
-    ShowParameterBindingListImGui(entry.bindings, candidates);
+    if (ShowParameterBindingListImGui(entry.bindings, candidates)) {
+        entry.bindingTable.Invalidate();
+    }
     ImGui::Separator();
 }
 
@@ -55,6 +55,8 @@ public:
         // --- 実行時状態（保存されない） ---
         bool wasApplied = false;
         float lastValue = 0.0f;
+        /// @brief bindings を解決済みの書き込み先
+        ParameterBindingTable bindingTable;
     };
 
     std::unique_ptr<IObjectComponent> Clone() const override;
@@ -78,7 +80,7 @@ private:
     CommandEntry *FindCommand(const std::string &name);
     const CommandEntry *FindCommand(const std::string &name) const;
     /// @brief 評価値をエントリの全バインド先へ書き込む
-    void ApplyValue(const CommandEntry &entry, float value);
+    void ApplyValue(CommandEntry &entry, float value);
 
 #if defined(USE_IMGUI)
     void ShowCommandImGui(CommandEntry &entry, const std::vector<ParameterBindingCandidate> &candidates);
@@ -36,6 +36,7 @@ public:
         float valueOffset = 0.0f;     ///< 評価値へ加算するデフォルト値オフセット
         bool loop = true;             ///< ループ再生するか（無効の場合は末端に到達すると自動停止する）
         bool playOnStart = false;     ///< ゲームループ開始時に自動で再生を開始するか
+        bool useBakedEasing = false;  ///< イージングを焼き込み表で近似するか（Sine/Expo/Elastic系のみ。誤差は0.001以下）
         std::vector<TargetBinding> bindings; ///< 評価値の適用先（複数可）
 
         // --- 実行時状態（保存されない） ---
@@ -45,6 +46,10 @@ public:
         bool playing = false;
         float currentTime = 0.0f;
         float lastValue = 0.0f;
+        /// @brief 前回評価したキー区間（前方再生時の二分探索を省く）
+        KeyframeAnimation::Cursor cursor;
+        /// @brief bindings を解決済みの書き込み先（bindings の編集時は Invalidate する）
+        ParameterBindingTable bindingTable;
     };
 
     std::unique_ptr<IObjectComponent> Clone() const override;
@@ -84,7 +89,7 @@ private:
     /// @brief jsonPathからキーフレームを読み込む（未読み込みかつ失敗履歴なしの場合のみ）
     void EnsureLoaded(AnimationEntry &entry);
     /// @brief 評価値をエントリの全バインド先へ書き込む
-    void ApplyValue(const AnimationEntry &entry, float value);
+    void ApplyValue(AnimationEntry &entry, float value);
 
 #if defined(USE_IMGUI)
     void ShowAnimationImGui(AnimationEntry &entry, const std::vector<ParameterBindingCandidate> &candidates);
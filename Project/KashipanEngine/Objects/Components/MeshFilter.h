@@ -11,8 +11,9 @@ namespace KashipanEngine {
 class MeshFilter final : public IObjectComponent {
 public:
     // meshHandle_の直接書き込み時は、セッターと同様にSceneRendererの描画リスト再構築を促す
-    OBJECT_COMPONENT_CONSTRUCTOR(MeshFilter, 1,
-        ADD_MEMBER_VARIABLE_WITH_CALLBACK(meshHandle_, [this] { SetMeshHandle(meshHandle_); });
+    OBJECT_COMPONENT_CONSTRUCTOR(MeshFilter, 1, )
+    OBJECT_COMPONENT_MEMBER_VARIABLES(MeshFilter,
+        ADD_MEMBER_VARIABLE_WITH_CALLBACK(meshHandle_, [](auto &self) { self.SetMeshHandle(self.meshHandle_); });
     )
     COMPONENT_CATEGORY("Render")
     explicit MeshFilter(ModelManager::ModelHandle meshHandle)
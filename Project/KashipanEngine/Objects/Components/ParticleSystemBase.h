@@ -18,6 +18,7 @@
 #include "Objects/Components/Transform.h"
 #include "Objects/Components/Velocity.h"
 #include "Objects/EmptyObject.h"
+#include "Objects/ParticleSimulation.h"
 #include "Scene/SceneContext.h"
 #include "Scene/Components/Render/SceneRenderer.h"
 #include "Assets/MaterialManager.h"
@@ -31,6 +32,7 @@
 #include "Math/Vector3.h"
 #include "Utilities/MathUtils.h"
 #include "Utilities/Passkeys.h"
+#include "Utilities/Plugin/Plugins.h"
 #include "Utilities/RandomizableValue.h"
 #include "Utilities/RandomValue.h"
 #include "Utilities/UUID128.h"
@@ -182,6 +184,11 @@ struct FromJSONImpl<SpawnShapeEntry> {
 ///          派生クラスごとに異なるため、生成直後のパーティクルへ描画コンポーネントを
 ///          追加するコールバック（setupVisual）だけを派生クラスから受け取る。
 ///
+///          ただしパーティクルごとのオブジェクトが必要になるのは付属コンポーネント
+///          （extraComponentTemplates_）を設定した場合だけで、それ以外のCPU Simulationでは
+///          オブジェクトを生成せず ParticleSimulation（SoA）で計算し、ワールド行列を
+///          GPU Simulation と同じ描画パスへ渡してインスタンス描画する。
+///
 ///          パーティクルオブジェクトは事前に Max Particles 分だけプールとして生成しておき、
 ///          発生・消滅は SetActive の有効/無効切り替えで管理する（生成・削除の繰り返しを避けるため）。
 ///          GPU Simulation を有効にした場合は、このオブジェクトプールを一切使わず、
@@ -220,6 +227,8 @@ public:
             if (i < pool_.size() && pool_[i]) pool_[i]->SetActive(false);
             freeIndices_.push_back(static_cast<int>(i));
         }
+        cpuSimulation_.Clear();
+        cpuInstanceCount_ = 0;
         spawnTimer_ = 0.0f;
         totalEmittedCount_ = 0;
     }
@@ -262,10 +271,10 @@ public:
     TargetLookAt::RotationMode GetBillboardRotationMode() const noexcept { return billboardRotationMode_; }
 
     /// @brief シャドウマッピングのシャドウキャスターとして扱うかを設定する
-    /// @details CPUモード（3D）では生成する各パーティクルのMeshRendererへそのまま伝播する
+    /// @details 付属コンポーネントを使うCPUモード（3D）では生成する各パーティクルのMeshRendererへそのまま伝播する
     ///          （プール生成時に一度だけ適用されるため、生存中のパーティクルには反映されない。
     ///          Pipeline/Material等、他のMeshRenderer設定と同じ挙動）。
-    ///          GPUモードではRendererのシャドウ描画パスがこのフラグを見て対象に含めるかを判断する。
+    ///          GPUモード・オブジェクトを使わないCPUモードではRendererのシャドウ描画パスがこのフラグを見て対象に含めるかを判断する。
     ///          2D（SpriteRenderer）はそもそもシャドウを落とせないため実質的に影響しない
     void SetCastShadows(bool enabled) noexcept { castShadows_ = enabled; }
     bool GetCastShadows() const noexcept { return castShadows_; }
@@ -342,6 +351,18 @@ public:
     std::uint32_t GetGpuParticleCapacity(Passkey<Renderer>) const noexcept {
         return gpuParticleBuffer_ ? static_cast<std::uint32_t>(gpuParticleBuffer_->GetElementCount()) : 0;
     }
+    /// @brief インスタンス描画に使うワールド行列バッファ（GPU Simulation: gpuInstanceMatrixBuffer_、
+    ///        オブジェクトを使わないCPU Simulation: cpuInstanceMatrixBuffer_）
+    IGraphicsResource *GetInstanceMatrixBuffer(Passkey<Renderer>) const noexcept {
+        if (gpuSimulation_) return gpuInstanceMatrixBuffer_.get();
+        return cpuInstanceMatrixBuffer_.get();
+    }
+    /// @brief インスタンス描画する件数
+    /// @details GPU Simulationは容量分（死んだスロットはスケール0の行列）、CPU Simulationは
+    ///          生存中のパーティクルが先頭に詰まっているため生存数だけを描画する
+    std::uint32_t GetInstanceCount(Passkey<Renderer> key) const noexcept {
+        return gpuSimulation_ ? GetGpuParticleCapacity(key) : cpuInstanceCount_;
+    }
     /// @brief ビルボードの向き先（明示指定がなければシーン内のカメラを自動解決）をRendererから取得する
     EmptyObject *ResolveBillboardCameraObject(Passkey<Renderer>) const {
         EmptyObject *target = GetBillboardTarget();
@@ -360,16 +381,9 @@ public:
         return parent;
     }
 
-protected:
-    /// @brief ビルボード化（常にカメラの方を向かせる）に使うカメラオブジェクトを解決する
-    /// @details 2D/3Dでどのカメラコンポーネント（Camera2D/Camera3D）を探すかが異なるため、
-    ///          派生クラスで実装する。見つからない場合は nullptr を返せばよい
-    ///          （その場合パーティクルは向きを変えない）
-    virtual EmptyObject *ResolveBillboardCameraObject() const = 0;
-
-    /// @param is2D trueの場合、スポーン形状の選択肢がBox/Sphere+CapsuleではなくRect/Circle（Capsuleなし）になる
-    ParticleSystemBase(const std::string &typeName, size_t maxCount, size_t componentTypeID, bool is2D)
-        : IObjectComponent(typeName, maxCount, componentTypeID), is2D_(is2D) {
+    /// @brief 共通のメンバー変数を登録する（派生クラスがメンバー変数を追加する場合は、その登録関数から最初に呼ぶ）
+    template <typename Self>
+    static void RegisterMemberVariables(MemberVariableTableBuilder<Self> &builder) {
         ADD_MEMBER_VARIABLE(emissionRate_);
         ADD_MEMBER_VARIABLE(maxParticles_);
         ADD_MEMBER_VARIABLE(totalSpawnCount_);
@@ -423,6 +437,17 @@ protected:
         ADD_MEMBER_VARIABLE(rotationAcceleration_.max);
     }
 
+protected:
+    /// @brief ビルボード化（常にカメラの方を向かせる）に使うカメラオブジェクトを解決する
+    /// @details 2D/3Dでどのカメラコンポーネント（Camera2D/Camera3D）を探すかが異なるため、
+    ///          派生クラスで実装する。見つからない場合は nullptr を返せばよい
+    ///          （その場合パーティクルは向きを変えない）
+    virtual EmptyObject *ResolveBillboardCameraObject() const = 0;
+
+    /// @param is2D trueの場合、スポーン形状の選択肢がBox/Sphere+CapsuleではなくRect/Circle（Capsuleなし）になる
+    ParticleSystemBase(const std::string &typeName, size_t maxCount, size_t componentTypeID, bool is2D)
+        : IObjectComponent(typeName, maxCount, componentTypeID), is2D_(is2D) {}
+
     /// @brief 派生クラスのInitializeから呼ぶ
     void InitializeBase() {
         if (playOnStart_) isPlaying_ = true;
@@ -449,6 +474,7 @@ protected:
         auto *sceneRenderer = sceneContext ? sceneContext->GetComponent<SceneRenderer>() : nullptr;
         if (sceneRenderer) sceneRenderer->UnregisterGpuParticleEmitter(this);
         DestroyGpuResources();
+        cpuInstanceMatrixBuffer_.reset();
 #if defined(USE_IMGUI)
         DestroyExtraComponentsTemplateObject();
 #endif
@@ -457,7 +483,15 @@ protected:
     /// @brief 派生クラスのUpdateから呼ぶ。新規生成した子オブジェクトへ描画コンポーネントを
     ///        追加してもらうため、プール生成時に一度だけ setupVisual(生成したEmptyObject*) を呼び出す
     ///        （GPU Simulation有効時はこちらは呼ばず、代わりにUpdateParticlesGPUを呼ぶこと）
+    /// @details 付属コンポーネントが無い場合はオブジェクトプールを使わずUpdateParticlesSimulatedで処理するため、
+    ///          setupVisualは呼ばれない
     void UpdateParticles(const std::function<void(EmptyObject *)> &setupVisual) {
+        if (extraComponentTemplates_.empty()) {
+            if (!pool_.empty()) DestroyCpuPool();
+            UpdateParticlesSimulated();
+            return;
+        }
+        ReleaseCpuInstanceResources();
         EnsurePoolSize(maxParticles_, setupVisual);
 
         const float dt = GetDeltaTime();
@@ -548,19 +582,17 @@ protected:
 
                     // 書き込み先スロットはここでは決めない（ParticleSpawnCSがgFreeListから
                     // 空きスロットをpopして決定する。空きが無ければそのリクエストは破棄される）
+                    const ParticleSimulation::SpawnParams params = DrawSpawnParams(basePosition);
                     GPUParticleSpawnRequest request;
-                    request.position = basePosition + ComputeSpawnOffset();
-                    request.velocity = initialVelocity_.Get();
-                    request.acceleration = acceleration_.Get();
-                    request.lifetime = std::max(0.01f, lifetime_.Get());
-                    const Vector3 rotationDegrees = initialRotation_.Get();
-                    request.rotation = Vector3(ToRadians(rotationDegrees.x), ToRadians(rotationDegrees.y), ToRadians(rotationDegrees.z));
-                    const Vector3 rotationSpeedDegrees = initialRotationSpeed_.Get();
-                    request.angularVelocity = Vector3(ToRadians(rotationSpeedDegrees.x), ToRadians(rotationSpeedDegrees.y), ToRadians(rotationSpeedDegrees.z));
-                    const Vector3 rotationAccelDegrees = rotationAcceleration_.Get();
-                    request.angularAcceleration = Vector3(ToRadians(rotationAccelDegrees.x), ToRadians(rotationAccelDegrees.y), ToRadians(rotationAccelDegrees.z));
-                    request.startScale = startScale_.Get();
-                    request.endScale = endScale_.Get();
+                    request.position = params.position;
+                    request.velocity = params.velocity;
+                    request.acceleration = params.acceleration;
+                    request.lifetime = params.lifetime;
+                    request.rotation = params.rotation;
+                    request.angularVelocity = params.angularVelocity;
+                    request.angularAcceleration = params.angularAcceleration;
+                    request.startScale = params.startScale;
+                    request.endScale = params.endScale;
                     requests.push_back(request);
                     ++totalEmittedCount_;
                 }
@@ -571,6 +603,71 @@ protected:
         UploadGpuSpawnRequests(requests);
     }
 
+    /// @brief オブジェクトを使わないCPU Simulation。発生はUpdateParticlesGPUと同じ手順で行い、
+    ///        移動・寿命はcpuSimulation_で計算して、ワールド行列をcpuInstanceMatrixBuffer_へ書き出す
+    void UpdateParticlesSimulated() {
+        const std::uint32_t capacity = static_cast<std::uint32_t>(std::max(0, maxParticles_));
+        cpuSimulation_.SetCapacity(capacity);
+        EnsureCpuInstanceResources();
+
+        const float dt = GetDeltaTime();
+        auto *owner = ResolveMutableOwner();
+        // GPU Simulationと同じく、親がある場合は親のローカル空間で計算し、行列の書き出し時に親のワールド行列を掛ける
+        EmptyObject *parentObject = nullptr;
+        Vector3 basePosition{ 0.0f, 0.0f, 0.0f };
+        if (owner) ResolveSpawnAnchor(owner, parentObject, basePosition);
+
+        // --- 発生 ---
+        if (isPlaying_ && emissionRate_ > 0.0f && owner) {
+            const float interval = 1.0f / emissionRate_;
+            spawnTimer_ += dt;
+            while (spawnTimer_ >= interval) {
+                spawnTimer_ -= interval;
+                const int count = std::max(1, spawnCount_.Get());
+                for (int i = 0; i < count; ++i) {
+                    if (!loop_ && totalEmittedCount_ >= totalSpawnCount_) {
+                        isPlaying_ = false;
+                        break;
+                    }
+                    if (cpuSimulation_.GetAliveCount() >= capacity) continue;
+                    cpuSimulation_.Spawn(DrawSpawnParams(basePosition));
+                    ++totalEmittedCount_;
+                }
+                if (!isPlaying_) break;
+            }
+        }
+
+        // --- 移動・寿命管理 ---
+        cpuSimulation_.Simulate(dt);
+        cpuInstanceCount_ = cpuSimulation_.GetAliveCount();
+        if (cpuInstanceCount_ == 0 || !cpuInstanceMatrixBuffer_) return;
+
+        auto *mapped = static_cast<Matrix4x4 *>(cpuInstanceMatrixBuffer_->Map());
+        if (!mapped) {
+            cpuInstanceCount_ = 0;
+            return;
+        }
+
+        ParticleSimulation::InstanceParams instanceParams;
+        auto *parentTransform = parentObject ? parentObject->GetComponent<Transform>() : nullptr;
+        if (parentTransform) {
+            instanceParams.parentWorldMatrix = parentTransform->GetWorldMatrix();
+            instanceParams.hasParent = true;
+        }
+        if (billboard_) {
+            instanceParams.billboard = true;
+            instanceParams.billboardLookAt = billboardRotationMode_ == TargetLookAt::RotationMode::LookAt;
+            EmptyObject *cameraObject = GetBillboardTarget();
+            if (!cameraObject) cameraObject = ResolveBillboardCameraObject();
+            auto *cameraTransform = cameraObject ? cameraObject->GetComponent<Transform>() : nullptr;
+            if (cameraTransform) instanceParams.cameraWorldMatrix = cameraTransform->GetWorldMatrix();
+        }
+
+        Plugin::ParallelFor(cpuInstanceCount_, kCpuInstanceWriteGrainSize, [this, &instanceParams, mapped](size_t begin, size_t end) {
+            cpuSimulation_.WriteInstanceMatrices(instanceParams, mapped, static_cast<std::uint32_t>(begin), static_cast<std::uint32_t>(end));
+        });
+    }
+
     /// @brief SerializeField相当の値を他インスタンスからコピーする（Cloneで使用。実行時状態はコピーしない）
     void CopyBaseFieldsFrom(const ParticleSystemBase &other) {
         playOnStart_ = other.playOnStart_;
@@ -936,7 +1033,8 @@ protected:
         if (gpuSimulation_) {
             ImGui::Text(TranslationC("component.particlesystembase.gpu_simulation_capacity_d"), maxParticles_);
         } else {
-            ImGui::Text(TranslationC("component.particlesystembase.live_particles_d"), maxParticles_ - static_cast<int>(freeIndices_.size()));
+            const int liveCount = pool_.empty() ? static_cast<int>(cpuSimulation_.GetAliveCount()) : static_cast<int>(pool_.size() - freeIndices_.size());
+            ImGui::Text(TranslationC("component.particlesystembase.live_particles_d"), liveCount);
         }
         ImGui::Text(TranslationC("component.particlesystembase.total_emitted_d"), totalEmittedCount_);
 
@@ -1230,6 +1328,38 @@ private:
     std::vector<ParticleSlot> slots_;
     std::vector<int> freeIndices_;
 
+    //==================================================
+    // オブジェクトを使わないCPUシミュレーション
+    //==================================================
+
+    /// @brief 行列の書き出しを1ジョブあたりに任せる件数（これ未満なら呼び出し元スレッドだけで書き出す）
+    static constexpr size_t kCpuInstanceWriteGrainSize = 1024;
+
+    ParticleSimulation cpuSimulation_;
+    /// @brief 生存中のパーティクルのワールド行列（先頭cpuInstanceCount_件が有効。アップロードヒープのため毎フレーム直接書き込む）
+    std::unique_ptr<StructuredBufferResource> cpuInstanceMatrixBuffer_;
+    std::uint32_t cpuInstanceCount_ = 0;
+
+    /// @brief cpuInstanceMatrixBuffer_をMax Particlesに合わせて（再）生成し、描画対象としてSceneRendererへ登録する
+    void EnsureCpuInstanceResources() {
+        const size_t desired = static_cast<size_t>(std::max(1, maxParticles_));
+        if (cpuInstanceMatrixBuffer_ && cpuInstanceMatrixBuffer_->GetElementCount() == desired) return;
+        cpuInstanceMatrixBuffer_ = std::make_unique<StructuredBufferResource>(sizeof(Matrix4x4), desired);
+        cpuInstanceCount_ = 0;
+        if (auto *sceneRenderer = GetOrAddSceneRenderer()) sceneRenderer->RegisterGpuParticleEmitter(this);
+    }
+
+    /// @brief オブジェクトプール方式へ切り替わった際に、インスタンス描画用の状態を破棄する
+    void ReleaseCpuInstanceResources() {
+        cpuSimulation_.Clear();
+        cpuInstanceCount_ = 0;
+        if (!cpuInstanceMatrixBuffer_) return;
+        cpuInstanceMatrixBuffer_.reset();
+        auto *sceneContext = GetOwnerSceneContext();
+        auto *sceneRenderer = sceneContext ? sceneContext->GetComponent<SceneRenderer>() : nullptr;
+        if (sceneRenderer && !gpuSimulation_) sceneRenderer->UnregisterGpuParticleEmitter(this);
+    }
+
 #if defined(USE_IMGUI)
     /// @brief 「付属コンポーネント」編集UI専用の使い捨てオブジェクト（extraComponentTemplates_の
     ///        内容を実際のコンポーネントとして保持し、通常のインスペクターと同じUIで編集できるようにする）。
@@ -1361,6 +1491,7 @@ private:
         if (gpuSimulation_) {
             Clear();
             DestroyCpuPool();
+            ReleaseCpuInstanceResources();
             InitializeGpuResources();
             if (!sceneRenderer) sceneRenderer = GetOrAddSceneRenderer();
             if (sceneRenderer) {
@@ -1376,7 +1507,7 @@ private:
         } else {
             if (sceneRenderer) sceneRenderer->UnregisterGpuParticleEmitter(this);
             DestroyGpuResources();
-            // CPUプールは次回UpdateParticles呼び出し時にEnsurePoolSizeで再構築される
+            // CPUプール（またはインスタンス描画用バッファ）は次回UpdateParticles呼び出し時に再構築される
         }
     }
 
@@ -1618,6 +1749,24 @@ private:
         }
     }
 
+    /// @brief 1パーティクル分の初期値を抽選する（回転系は度からラジアンへ変換する。CPU/GPU Simulation共通）
+    ParticleSimulation::SpawnParams DrawSpawnParams(const Vector3 &basePosition) {
+        ParticleSimulation::SpawnParams params;
+        params.position = basePosition + ComputeSpawnOffset();
+        params.velocity = initialVelocity_.Get();
+        params.acceleration = acceleration_.Get();
+        params.lifetime = std::max(0.01f, lifetime_.Get());
+        const Vector3 rotationDegrees = initialRotation_.Get();
+        params.rotation = Vector3(ToRadians(rotationDegrees.x), ToRadians(rotationDegrees.y), ToRadians(rotationDegrees.z));
+        const Vector3 rotationSpeedDegrees = initialRotationSpeed_.Get();
+        params.angularVelocity = Vector3(ToRadians(rotationSpeedDegrees.x), ToRadians(rotationSpeedDegrees.y), ToRadians(rotationSpeedDegrees.z));
+        const Vector3 rotationAccelDegrees = rotationAcceleration_.Get();
+        params.angularAcceleration = Vector3(ToRadians(rotationAccelDegrees.x), ToRadians(rotationAccelDegrees.y), ToRadians(rotationAccelDegrees.z));
+        params.startScale = startScale_.Get();
+        params.endScale = endScale_.Get();
+        return params;
+    }
+
     void SpawnParticle() {
         if (freeIndices_.empty()) return;
         auto *owner = ResolveMutableOwner();
@@ -37,7 +37,8 @@ public:
         float depthThreshold = 0.5f; // ブラー時、これを超える線形深度差のサンプルは除外する
     };
 
-    AmbientOcclusionEffect() : IPostProcessComponent("AmbientOcclusionEffect", GetComponentTypeID<AmbientOcclusionEffect>()) {
+    AmbientOcclusionEffect() : IPostProcessComponent("AmbientOcclusionEffect", GetComponentTypeID<AmbientOcclusionEffect>()) {}
+    OBJECT_COMPONENT_MEMBER_VARIABLES(AmbientOcclusionEffect,
         ADD_MEMBER_VARIABLE(params_.radius);
         ADD_MEMBER_VARIABLE(params_.intensity);
         ADD_MEMBER_VARIABLE(params_.power);
@@ -45,7 +46,7 @@ public:
         ADD_MEMBER_VARIABLE(params_.sampleCount);
         ADD_MEMBER_VARIABLE(params_.blurRadius);
         ADD_MEMBER_VARIABLE(params_.depthThreshold);
-    }
+    )
     ~AmbientOcclusionEffect() override = default;
 
     std::unique_ptr<IObjectComponent> Clone() const override {
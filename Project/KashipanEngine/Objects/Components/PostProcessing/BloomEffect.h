@@ -32,13 +32,14 @@ public:
         std::uint32_t iterations = 4; // ダウンサンプル段数 (1..16)
     };
 
-    BloomEffect() : IPostProcessComponent("BloomEffect", GetComponentTypeID<BloomEffect>()) {
+    BloomEffect() : IPostProcessComponent("BloomEffect", GetComponentTypeID<BloomEffect>()) {}
+    OBJECT_COMPONENT_MEMBER_VARIABLES(BloomEffect,
         ADD_MEMBER_VARIABLE(params_.threshold);
         ADD_MEMBER_VARIABLE(params_.softKnee);
         ADD_MEMBER_VARIABLE(params_.intensity);
         ADD_MEMBER_VARIABLE(params_.blurRadius);
         ADD_MEMBER_VARIABLE(params_.iterations);
-    }
+    )
     ~BloomEffect() override = default;
 
     std::unique_ptr<IObjectComponent> Clone() const override {
@@ -13,11 +13,12 @@ public:
         int halfSize[2] = { 2, 2 };
     };
 
-    BoxFilterEffect() : IPostProcessComponent("BoxFilterEffect", GetComponentTypeID<BoxFilterEffect>()) {
+    BoxFilterEffect() : IPostProcessComponent("BoxFilterEffect", GetComponentTypeID<BoxFilterEffect>()) {}
+    OBJECT_COMPONENT_MEMBER_VARIABLES(BoxFilterEffect,
         ADD_MEMBER_VARIABLE(params_.intensity);
-        AddMemberVariable("params_.halfSize[0]", &params_.halfSize[0]);
-        AddMemberVariable("params_.halfSize[1]", &params_.halfSize[1]);
-    }
+        ADD_MEMBER_VARIABLE(params_.halfSize[0]);
+        ADD_MEMBER_VARIABLE(params_.halfSize[1]);
+    )
     ~BoxFilterEffect() override = default;
 
     std::unique_ptr<IObjectComponent> Clone() const override {
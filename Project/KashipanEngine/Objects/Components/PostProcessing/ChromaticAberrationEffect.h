@@ -14,11 +14,12 @@ public:
         float strength = 0.0025f;
     };
 
-    ChromaticAberrationEffect() : IPostProcessComponent("ChromaticAberrationEffect", GetComponentTypeID<ChromaticAberrationEffect>()) {
+    ChromaticAberrationEffect() : IPostProcessComponent("ChromaticAberrationEffect", GetComponentTypeID<ChromaticAberrationEffect>()) {}
+    OBJECT_COMPONENT_MEMBER_VARIABLES(ChromaticAberrationEffect,
         ADD_MEMBER_VARIABLE(params_.directionX);
         ADD_MEMBER_VARIABLE(params_.directionY);
         ADD_MEMBER_VARIABLE(params_.strength);
-    }
+    )
     ~ChromaticAberrationEffect() override = default;
 
     std::unique_ptr<IObjectComponent> Clone() const override {
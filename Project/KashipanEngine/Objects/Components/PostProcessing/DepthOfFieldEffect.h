@@ -38,7 +38,8 @@ public:
         int dilateRadius = 4;            // 近景CoCダイレーションのサンプル半径（ピクセル）
     };
 
-    DepthOfFieldEffect() : IPostProcessComponent("DepthOfFieldEffect", GetComponentTypeID<DepthOfFieldEffect>()) {
+    DepthOfFieldEffect() : IPostProcessComponent("DepthOfFieldEffect", GetComponentTypeID<DepthOfFieldEffect>()) {}
+    OBJECT_COMPONENT_MEMBER_VARIABLES(DepthOfFieldEffect,
         ADD_MEMBER_VARIABLE(params_.focusDistance);
         ADD_MEMBER_VARIABLE(params_.focusRange);
         ADD_MEMBER_VARIABLE(params_.nearBlurDistance);
@@ -46,7 +47,7 @@ public:
         ADD_MEMBER_VARIABLE(params_.maxBlurRadiusPixels);
         ADD_MEMBER_VARIABLE(params_.sampleCount);
         ADD_MEMBER_VARIABLE(params_.dilateRadius);
-    }
+    )
     ~DepthOfFieldEffect() override = default;
 
     std::unique_ptr<IObjectComponent> Clone() const override {
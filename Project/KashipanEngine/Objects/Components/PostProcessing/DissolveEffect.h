@@ -18,18 +18,19 @@ public:
         float edgeColor[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
     };
 
-    DissolveEffect() : IPostProcessComponent("DissolveEffect", GetComponentTypeID<DissolveEffect>()) {
+    DissolveEffect() : IPostProcessComponent("DissolveEffect", GetComponentTypeID<DissolveEffect>()) {}
+    OBJECT_COMPONENT_MEMBER_VARIABLES(DissolveEffect,
         ADD_MEMBER_VARIABLE(params_.maskThreshold);
         ADD_MEMBER_VARIABLE(params_.edgeThickness);
-        AddMemberVariable("params_.baseTextureColor[0]", &params_.baseTextureColor[0]);
-        AddMemberVariable("params_.baseTextureColor[1]", &params_.baseTextureColor[1]);
-        AddMemberVariable("params_.baseTextureColor[2]", &params_.baseTextureColor[2]);
-        AddMemberVariable("params_.baseTextureColor[3]", &params_.baseTextureColor[3]);
-        AddMemberVariable("params_.edgeColor[0]", &params_.edgeColor[0]);
-        AddMemberVariable("params_.edgeColor[1]", &params_.edgeColor[1]);
-        AddMemberVariable("params_.edgeColor[2]", &params_.edgeColor[2]);
-        AddMemberVariable("params_.edgeColor[3]", &params_.edgeColor[3]);
-    }
+        ADD_MEMBER_VARIABLE(params_.baseTextureColor[0]);
+        ADD_MEMBER_VARIABLE(params_.baseTextureColor[1]);
+        ADD_MEMBER_VARIABLE(params_.baseTextureColor[2]);
+        ADD_MEMBER_VARIABLE(params_.baseTextureColor[3]);
+        ADD_MEMBER_VARIABLE(params_.edgeColor[0]);
+        ADD_MEMBER_VARIABLE(params_.edgeColor[1]);
+        ADD_MEMBER_VARIABLE(params_.edgeColor[2]);
+        ADD_MEMBER_VARIABLE(params_.edgeColor[3]);
+    )
     ~DissolveEffect() override = default;
 
     std::unique_ptr<IObjectComponent> Clone() const override {
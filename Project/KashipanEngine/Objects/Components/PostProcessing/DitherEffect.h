@@ -13,10 +13,11 @@ public:
         bool color = true;
     };
 
-    DitherEffect() : IPostProcessComponent("DitherEffect", GetComponentTypeID<DitherEffect>()) {
+    DitherEffect() : IPostProcessComponent("DitherEffect", GetComponentTypeID<DitherEffect>()) {}
+    OBJECT_COMPONENT_MEMBER_VARIABLES(DitherEffect,
         ADD_MEMBER_VARIABLE(params_.intensity);
         ADD_MEMBER_VARIABLE(params_.color);
-    }
+    )
     ~DitherEffect() override = default;
 
     std::unique_ptr<IObjectComponent> Clone() const override {
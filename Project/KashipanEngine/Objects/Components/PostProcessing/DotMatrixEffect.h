@@ -16,13 +16,14 @@ public:
         bool monochrome = false;
     };
 
-    DotMatrixEffect() : IPostProcessComponent("DotMatrixEffect", GetComponentTypeID<DotMatrixEffect>()) {
+    DotMatrixEffect() : IPostProcessComponent("DotMatrixEffect", GetComponentTypeID<DotMatrixEffect>()) {}
+    OBJECT_COMPONENT_MEMBER_VARIABLES(DotMatrixEffect,
         ADD_MEMBER_VARIABLE(params_.dotSpacing);
         ADD_MEMBER_VARIABLE(params_.dotRadius);
         ADD_MEMBER_VARIABLE(params_.threshold);
         ADD_MEMBER_VARIABLE(params_.intensity);
         ADD_MEMBER_VARIABLE(params_.monochrome);
-    }
+    )
     ~DotMatrixEffect() override = default;
 
     std::unique_ptr<IObjectComponent> Clone() const override {
@@ -15,12 +15,13 @@ public:
         float subpixelBlend = 0.75f;
     };
 
-    FXAAEffect() : IPostProcessComponent("FXAAEffect", GetComponentTypeID<FXAAEffect>()) {
+    FXAAEffect() : IPostProcessComponent("FXAAEffect", GetComponentTypeID<FXAAEffect>()) {}
+    OBJECT_COMPONENT_MEMBER_VARIABLES(FXAAEffect,
         ADD_MEMBER_VARIABLE(params_.threshold);
         ADD_MEMBER_VARIABLE(params_.thresholdMin);
         ADD_MEMBER_VARIABLE(params_.strength);
         ADD_MEMBER_VARIABLE(params_.subpixelBlend);
-    }
+    )
     ~FXAAEffect() override = default;
 
     std::unique_ptr<IObjectComponent> Clone() const override {
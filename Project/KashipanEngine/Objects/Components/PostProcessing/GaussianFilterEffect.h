@@ -13,10 +13,11 @@ public:
         float sigma = 1.0f;
     };
 
-    GaussianFilterEffect() : IPostProcessComponent("GaussianFilterEffect", GetComponentTypeID<GaussianFilterEffect>()) {
+    GaussianFilterEffect() : IPostProcessComponent("GaussianFilterEffect", GetComponentTypeID<GaussianFilterEffect>()) {}
+    OBJECT_COMPONENT_MEMBER_VARIABLES(GaussianFilterEffect,
         ADD_MEMBER_VARIABLE(params_.radius);
         ADD_MEMBER_VARIABLE(params_.sigma);
-    }
+    )
     ~GaussianFilterEffect() override = default;
 
     std::unique_ptr<IObjectComponent> Clone() const override {
@@ -12,9 +12,10 @@ public:
         float intensity = 1.0f;
     };
 
-    GrayscaleEffect() : IPostProcessComponent("GrayscaleEffect", GetComponentTypeID<GrayscaleEffect>()) {
+    GrayscaleEffect() : IPostProcessComponent("GrayscaleEffect", GetComponentTypeID<GrayscaleEffect>()) {}
+    OBJECT_COMPONENT_MEMBER_VARIABLES(GrayscaleEffect,
         ADD_MEMBER_VARIABLE(params_.intensity);
-    }
+    )
     ~GrayscaleEffect() override = default;
 
     std::unique_ptr<IObjectComponent> Clone() const override {
@@ -33,12 +33,13 @@ public:
         std::uint32_t samples = 8;     // ブラーのサンプル数
     };
 
-    MotionBlurEffect() : IPostProcessComponent("MotionBlurEffect", GetComponentTypeID<MotionBlurEffect>()) {
+    MotionBlurEffect() : IPostProcessComponent("MotionBlurEffect", GetComponentTypeID<MotionBlurEffect>()) {}
+    OBJECT_COMPONENT_MEMBER_VARIABLES(MotionBlurEffect,
         ADD_MEMBER_VARIABLE(params_.intensity);
         ADD_MEMBER_VARIABLE(params_.velocityScale);
         ADD_MEMBER_VARIABLE(params_.maxBlurPixels);
         ADD_MEMBER_VARIABLE(params_.samples);
-    }
+    )
     ~MotionBlurEffect() override = default;
 
     std::unique_ptr<IObjectComponent> Clone() const override {
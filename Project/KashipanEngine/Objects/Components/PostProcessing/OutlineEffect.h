@@ -14,14 +14,15 @@ public:
         float color[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
     };
 
-    OutlineEffect() : IPostProcessComponent("OutlineEffect", GetComponentTypeID<OutlineEffect>()) {
+    OutlineEffect() : IPostProcessComponent("OutlineEffect", GetComponentTypeID<OutlineEffect>()) {}
+    OBJECT_COMPONENT_MEMBER_VARIABLES(OutlineEffect,
         ADD_MEMBER_VARIABLE(params_.threshold);
         ADD_MEMBER_VARIABLE(params_.thickness);
-        AddMemberVariable("params_.color[0]", &params_.color[0]);
-        AddMemberVariable("params_.color[1]", &params_.color[1]);
-        AddMemberVariable("params_.color[2]", &params_.color[2]);
-        AddMemberVariable("params_.color[3]", &params_.color[3]);
-    }
+        ADD_MEMBER_VARIABLE(params_.color[0]);
+        ADD_MEMBER_VARIABLE(params_.color[1]);
+        ADD_MEMBER_VARIABLE(params_.color[2]);
+        ADD_MEMBER_VARIABLE(params_.color[3]);
+    )
     ~OutlineEffect() override = default;
 
     std::unique_ptr<IObjectComponent> Clone() const override {
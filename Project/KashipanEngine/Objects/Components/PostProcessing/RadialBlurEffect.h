@@ -16,13 +16,14 @@ public:
         float startRadius = 0.0f;
     };
 
-    RadialBlurEffect() : IPostProcessComponent("RadialBlurEffect", GetComponentTypeID<RadialBlurEffect>()) {
+    RadialBlurEffect() : IPostProcessComponent("RadialBlurEffect", GetComponentTypeID<RadialBlurEffect>()) {}
+    OBJECT_COMPONENT_MEMBER_VARIABLES(RadialBlurEffect,
         ADD_MEMBER_VARIABLE(params_.intensity);
         ADD_MEMBER_VARIABLE(params_.sampleCount);
-        AddMemberVariable("params_.radialCenter[0]", &params_.radialCenter[0]);
-        AddMemberVariable("params_.radialCenter[1]", &params_.radialCenter[1]);
+        ADD_MEMBER_VARIABLE(params_.radialCenter[0]);
+        ADD_MEMBER_VARIABLE(params_.radialCenter[1]);
         ADD_MEMBER_VARIABLE(params_.startRadius);
-    }
+    )
     ~RadialBlurEffect() override = default;
 
     std::unique_ptr<IObjectComponent> Clone() const override {
@@ -17,14 +17,15 @@ public:
         float smoothness = 0.3f;
     };
 
-    VignetteEffect() : IPostProcessComponent("VignetteEffect", GetComponentTypeID<VignetteEffect>()) {
-        AddMemberVariable("params_.center[0]", &params_.center[0]);
-        AddMemberVariable("params_.center[1]", &params_.center[1]);
+    VignetteEffect() : IPostProcessComponent("VignetteEffect", GetComponentTypeID<VignetteEffect>()) {}
+    OBJECT_COMPONENT_MEMBER_VARIABLES(VignetteEffect,
+        ADD_MEMBER_VARIABLE(params_.center[0]);
+        ADD_MEMBER_VARIABLE(params_.center[1]);
         ADD_MEMBER_VARIABLE(params_.color);
         ADD_MEMBER_VARIABLE(params_.intensity);
         ADD_MEMBER_VARIABLE(params_.innerRadius);
         ADD_MEMBER_VARIABLE(params_.smoothness);
-    }
+    )
     ~VignetteEffect() override = default;
 
     std::unique_ptr<IObjectComponent> Clone() const override {
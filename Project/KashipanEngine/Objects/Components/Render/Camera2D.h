@@ -7,7 +7,8 @@ namespace KashipanEngine {
 /// @brief 2Dカメラ情報コンポーネント（射影パラメータの保持のみを行う）
 class Camera2D final : public IObjectComponent {
 public:
-    OBJECT_COMPONENT_CONSTRUCTOR(Camera2D, 1,
+    OBJECT_COMPONENT_CONSTRUCTOR(Camera2D, 1, )
+    OBJECT_COMPONENT_MEMBER_VARIABLES(Camera2D,
         ADD_MEMBER_VARIABLE(width_);
         ADD_MEMBER_VARIABLE(height_);
         ADD_MEMBER_VARIABLE(nearClip_);
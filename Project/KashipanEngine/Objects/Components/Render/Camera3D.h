@@ -7,7 +7,8 @@ namespace KashipanEngine {
 /// @brief 3Dカメラ情報コンポーネント（射影パラメータの保持のみを行う）
 class Camera3D final : public IObjectComponent {
 public:
-    OBJECT_COMPONENT_CONSTRUCTOR(Camera3D, 1,
+    OBJECT_COMPONENT_CONSTRUCTOR(Camera3D, 1, )
+    OBJECT_COMPONENT_MEMBER_VARIABLES(Camera3D,
         ADD_MEMBER_VARIABLE(fovY_);
         ADD_MEMBER_VARIABLE(nearClip_);
         ADD_MEMBER_VARIABLE(farClip_);
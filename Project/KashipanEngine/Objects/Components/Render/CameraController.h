@@ -24,7 +24,8 @@ namespace KashipanEngine {
 ///          オブジェクト自身のTransformを追従先として扱う。
 class CameraController final : public IObjectComponent {
 public:
-    OBJECT_COMPONENT_CONSTRUCTOR(CameraController, 1,
+    OBJECT_COMPONENT_CONSTRUCTOR(CameraController, 1, )
+    OBJECT_COMPONENT_MEMBER_VARIABLES(CameraController,
         ADD_MEMBER_VARIABLE(positionOffset_);
         ADD_MEMBER_VARIABLE(rotationOffset_);
         ADD_MEMBER_VARIABLE(targetFovY_);
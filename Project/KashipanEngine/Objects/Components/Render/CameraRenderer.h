@@ -214,7 +214,7 @@ private:
         if (!objectContext) return;
 
         const Matrix4x4 world = GetRenderWorldMatrix();
-        const Matrix4x4 view = world.Inverse();
+        const Matrix4x4 view = world.InverseAffine();
 
         void *mapped = constantBuffer_->Map();
         if (!mapped) return;
@@ -85,16 +85,20 @@ public:
         if (window_ && Window::IsExist(window_)) window_->DestroyNotify();
     }
 
-protected:
-    IWindowObjectComponent(const std::string &typeName, size_t maxCount, size_t componentTypeID, std::string defaultTitle)
-        : IObjectComponent(typeName, maxCount, componentTypeID), title_(std::move(defaultTitle)) {
+    /// @brief 共通のメンバー変数を登録する（派生クラスがメンバー変数を追加する場合は、その登録関数から最初に呼ぶ）
+    template <typename Self>
+    static void RegisterMemberVariables(MemberVariableTableBuilder<Self> &builder) {
         // title_の直接書き込み時は、セッターと同様に生成済みウィンドウのタイトルへも反映する
-        ADD_MEMBER_VARIABLE_WITH_CALLBACK(title_, [this] { SetTitle(title_); });
+        ADD_MEMBER_VARIABLE_WITH_CALLBACK(title_, [](auto &self) { self.SetTitle(self.title_); });
         ADD_MEMBER_VARIABLE(width_);
         ADD_MEMBER_VARIABLE(height_);
         ADD_MEMBER_VARIABLE(syncWithTransform_);
     }
 
+protected:
+    IWindowObjectComponent(const std::string &typeName, size_t maxCount, size_t componentTypeID, std::string defaultTitle)
+        : IObjectComponent(typeName, maxCount, componentTypeID), title_(std::move(defaultTitle)) {}
+
     /// @brief 横取り設定を所有ウィンドウへ適用する（派生クラスのInitializeでウィンドウ生成後に呼ぶ）
     void ApplyInterceptedMessages() {
         if (!window_ || !Window::IsExist(window_)) return;
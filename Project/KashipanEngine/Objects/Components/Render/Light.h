@@ -15,7 +15,8 @@ public:
     /// @details Boxは全方位（体積）発光。ボックス表面上の最近接点を代表点として使い、Tubeと同じ扱いで
     ///          拡散・鏡面・減衰を求める。影もPoint/Sphere/Tubeと同じキューブ6面で近似する
     enum class Type { Directional, Point, Spot, Rect, Sphere, Disc, Tube, Box };
-    OBJECT_COMPONENT_CONSTRUCTOR(Light, 0xFF,
+    OBJECT_COMPONENT_CONSTRUCTOR(Light, 0xFF, )
+    OBJECT_COMPONENT_MEMBER_VARIABLES(Light,
         ADD_MEMBER_VARIABLE(color_);
         ADD_MEMBER_VARIABLE(intensity_);
         ADD_MEMBER_VARIABLE(radius_);
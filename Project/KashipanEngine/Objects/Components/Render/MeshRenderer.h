@@ -41,7 +41,9 @@ public:
     // （マテリアルはスロット制のvector管理のため、要素アドレスが変わり得ずメンバ変数登録できない）
     OBJECT_COMPONENT_CONSTRUCTOR(MeshRenderer, 0xFF,
         SetUpdatePriority(900);
-        ADD_MEMBER_VARIABLE_WITH_CALLBACK(pipelineName_, [this] { MarkDrawListDirty(); });
+    )
+    OBJECT_COMPONENT_MEMBER_VARIABLES(MeshRenderer,
+        ADD_MEMBER_VARIABLE_WITH_CALLBACK(pipelineName_, [](auto &self) { self.MarkDrawListDirty(); });
         ADD_MEMBER_VARIABLE(castShadows_);
         ADD_MEMBER_VARIABLE(instanceColor_);
     )
@@ -10,7 +10,8 @@ namespace KashipanEngine {
 ///          このコンポーネントを付与して保持する（SceneEditorView::EnsureSceneViewObject参照）
 class SceneViewOrbitState final : public IObjectComponent {
 public:
-    OBJECT_COMPONENT_CONSTRUCTOR(SceneViewOrbitState, 1,
+    OBJECT_COMPONENT_CONSTRUCTOR(SceneViewOrbitState, 1, )
+    OBJECT_COMPONENT_MEMBER_VARIABLES(SceneViewOrbitState,
         ADD_MEMBER_VARIABLE(distance_);
     )
     COMPONENT_CATEGORY("Render")
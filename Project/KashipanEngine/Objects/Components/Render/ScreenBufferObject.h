@@ -18,10 +18,11 @@ namespace KashipanEngine {
 class ScreenBufferObject final : public IObjectComponent {
 public:
     // 直接書き込み時は、セッターと同様に生成済みバッファへの反映（名前変更・リサイズ）も行う
-    OBJECT_COMPONENT_CONSTRUCTOR(ScreenBufferObject, 0xFF,
-        ADD_MEMBER_VARIABLE_WITH_CALLBACK(name_, [this] { SetName(name_); });
-        ADD_MEMBER_VARIABLE_WITH_CALLBACK(width_, [this] { SetSize(width_, height_); });
-        ADD_MEMBER_VARIABLE_WITH_CALLBACK(height_, [this] { SetSize(width_, height_); });
+    OBJECT_COMPONENT_CONSTRUCTOR(ScreenBufferObject, 0xFF, )
+    OBJECT_COMPONENT_MEMBER_VARIABLES(ScreenBufferObject,
+        ADD_MEMBER_VARIABLE_WITH_CALLBACK(name_, [](auto &self) { self.SetName(self.name_); });
+        ADD_MEMBER_VARIABLE_WITH_CALLBACK(width_, [](auto &self) { self.SetSize(self.width_, self.height_); });
+        ADD_MEMBER_VARIABLE_WITH_CALLBACK(height_, [](auto &self) { self.SetSize(self.width_, self.height_); });
     )
     COMPONENT_CATEGORY("Render", "RenderTarget")
         ~ScreenBufferObject() override = default;
@@ -15,10 +15,11 @@ namespace KashipanEngine {
 class ShadowMapObject final : public IObjectComponent {
 public:
     // 直接書き込み時は、セッターと同様に生成済みバッファへの反映（名前変更・リサイズ）も行う
-    OBJECT_COMPONENT_CONSTRUCTOR(ShadowMapObject, 0xFF,
-        ADD_MEMBER_VARIABLE_WITH_CALLBACK(name_, [this] { SetName(name_); });
-        ADD_MEMBER_VARIABLE_WITH_CALLBACK(width_, [this] { SetSize(width_, height_); });
-        ADD_MEMBER_VARIABLE_WITH_CALLBACK(height_, [this] { SetSize(width_, height_); });
+    OBJECT_COMPONENT_CONSTRUCTOR(ShadowMapObject, 0xFF, )
+    OBJECT_COMPONENT_MEMBER_VARIABLES(ShadowMapObject,
+        ADD_MEMBER_VARIABLE_WITH_CALLBACK(name_, [](auto &self) { self.SetName(self.name_); });
+        ADD_MEMBER_VARIABLE_WITH_CALLBACK(width_, [](auto &self) { self.SetSize(self.width_, self.height_); });
+        ADD_MEMBER_VARIABLE_WITH_CALLBACK(height_, [](auto &self) { self.SetSize(self.width_, self.height_); });
     )
     COMPONENT_CATEGORY("Render", "RenderTarget")
     ~ShadowMapObject() override = default;
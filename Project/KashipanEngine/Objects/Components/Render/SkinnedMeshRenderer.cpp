@@ -109,6 +109,7 @@ void SkinnedMeshRenderer::RebuildSkinningResourcesIfNeeded() {
     // ジョイント一覧・逆バインドポーズ行列を確定し、頂点ごとの上位4ボーンを抽出する
     jointNames_.clear();
     inverseBindPoses_.clear();
+    skeletonJointIndicesSource_ = nullptr;
     std::vector<std::vector<std::pair<float, std::uint32_t>>> perVertex(vertexCount_);
     for (const auto &cluster : modelData.GetSkinClusters()) {
         const std::uint32_t jointIndex = static_cast<std::uint32_t>(jointNames_.size());
@@ -200,27 +201,37 @@ void SkinnedMeshRenderer::UpdateSkinningBuffers() {
 
     // jointNames_が空（ボーンを持たないメッシュ）の場合でも、gVertexCount等の定数と
     // BlendShapeウェイトは毎フレーム正しくアップロードする必要がある
-    std::vector<Matrix4x4> boneMatrices(std::max<std::size_t>(1, jointNames_.size()), Matrix4x4::Identity());
-
-    // Animatorが保持するスケルトンインスタンスから現在の姿勢を読み取る（Animatorが無い場合、
-    // またはジョイント名が一致しない場合はバインドポーズ相当のIdentityのままになる）
-    if (!jointNames_.empty()) {
-        if (auto *animator = GetAnimator()) {
-            const Skeleton &skeleton = animator->GetSkeletonInstance(Passkey<SkinnedMeshRenderer>{});
+    if (auto *mapped = static_cast<Matrix4x4 *>(boneMatricesBuffer_->Map())) {
+        // Animatorが姿勢評価と一緒に計算済みのジョイント行列から現在の姿勢を読み取る（Animatorが無い場合、
+        // またはジョイント名が一致しない場合はバインドポーズ相当のIdentityのままになる）
+        auto *animator = jointNames_.empty() ? nullptr : GetAnimator();
+        if (animator) {
+            const std::vector<Matrix4x4> &jointMatrices = animator->GetJointMatrices(Passkey<SkinnedMeshRenderer>{});
+            // ジョイント名からスケルトン上のインデックスへの対応は、Animatorかそのスケルトンが変わった時だけ引き直す
+            if (skeletonJointIndicesSource_ != animator || skeletonJointIndicesGeneration_ != animator->GetSkeletonGeneration()) {
+                const Skeleton &skeleton = animator->GetSkeletonInstance(Passkey<SkinnedMeshRenderer>{});
+                skeletonJointIndices_.assign(jointNames_.size(), -1);
+                for (std::size_t i = 0; i < jointNames_.size(); ++i) {
+                    auto it = skeleton.jointNameToIndexMap.find(jointNames_[i]);
+                    if (it == skeleton.jointNameToIndexMap.end()) continue;
+                    if (!skeleton.joints[static_cast<std::size_t>(it->second)].transform) continue;
+                    skeletonJointIndices_[i] = it->second;
+                }
+                skeletonJointIndicesSource_ = animator;
+                skeletonJointIndicesGeneration_ = animator->GetSkeletonGeneration();
+            }
             for (std::size_t i = 0; i < jointNames_.size(); ++i) {
-                auto it = skeleton.jointNameToIndexMap.find(jointNames_[i]);
-                if (it == skeleton.jointNameToIndexMap.end()) continue;
-                SkeletonTransform *transform = skeleton.joints[static_cast<std::size_t>(it->second)].transform.get();
-                if (!transform) continue;
-                boneMatrices[i] = inverseBindPoses_[i] * transform->GetWorldMatrix();
+                const std::int32_t jointIndex = skeletonJointIndices_[i];
+                mapped[i] = jointIndex >= 0 && static_cast<std::size_t>(jointIndex) < jointMatrices.size()
+                    ? inverseBindPoses_[i] * jointMatrices[static_cast<std::size_t>(jointIndex)]
+                    : Matrix4x4::Identity();
             }
+        } else {
+            const std::size_t boneCount = std::max<std::size_t>(1, jointNames_.size());
+            for (std::size_t i = 0; i < boneCount; ++i) mapped[i] = Matrix4x4::Identity();
         }
     }
 
-    if (auto *mapped = static_cast<Matrix4x4 *>(boneMatricesBuffer_->Map())) {
-        std::memcpy(mapped, boneMatrices.data(), sizeof(Matrix4x4) * boneMatrices.size());
-    }
-
     SkinningConstantsCPU constants{};
     constants.vertexCount = vertexCount_;
     switch (quality_) {
@@ -281,15 +292,17 @@ std::vector<SkinnedMeshRenderer::DebugJointInfo> SkinnedMeshRenderer::GetDebugJo
     if (!animator) return result;
     const Skeleton &skeleton = animator->GetSkeletonInstance(Passkey<SkinnedMeshRenderer>{});
     if (skeleton.joints.empty()) return result;
+    const std::vector<Matrix4x4> &jointMatrices = animator->GetJointMatrices(Passkey<SkinnedMeshRenderer>{});
 
     // ジョイントのスケルトン空間行列に、描画に使うワールド行列（Root Bone考慮済み）を掛けて
     // シーン上のワールド座標を得る
     const Matrix4x4 world = GetWorldMatrix();
     result.reserve(skeleton.joints.size());
-    for (auto &joint : skeleton.joints) {
+    for (std::size_t i = 0; i < skeleton.joints.size(); ++i) {
+        const auto &joint = skeleton.joints[i];
         DebugJointInfo info;
-        if (joint.transform) {
-            const Matrix4x4 m = joint.transform->GetWorldMatrix() * world;
+        if (joint.transform && i < jointMatrices.size()) {
+            const Matrix4x4 m = jointMatrices[i] * world;
             info.position = Vector3(m.m[3][0], m.m[3][1], m.m[3][2]);
         }
         info.parentIndex = joint.parentIndex.value_or(-1);
@@ -75,6 +75,8 @@ public:
 
     OBJECT_COMPONENT_CONSTRUCTOR(SkinnedMeshRenderer, 0xFF,
         SetUpdatePriority(900);
+    )
+    OBJECT_COMPONENT_MEMBER_VARIABLES(SkinnedMeshRenderer,
         ADD_MEMBER_VARIABLE(pipelineName_);
         ADD_MEMBER_VARIABLE(castShadows_);
         ADD_MEMBER_VARIABLE(instanceColor_);
@@ -332,6 +334,11 @@ private:
     std::vector<std::string> jointNames_;
     /// @brief jointNames_と対応するバインドポーズ逆行列
     std::vector<Matrix4x4> inverseBindPoses_;
+    /// @brief jointNames_と対応する、Animatorのスケルトン上のジョイントインデックス（見つからない場合は -1）
+    std::vector<std::int32_t> skeletonJointIndices_;
+    /// @brief skeletonJointIndices_ を解決したAnimatorとそのスケルトンの世代（どちらかが変わったら解決し直す）
+    const Animator *skeletonJointIndicesSource_ = nullptr;
+    std::uint32_t skeletonJointIndicesGeneration_ = 0;
     /// @brief BlendShape名からModelData::GetBlendShapes()上のインデックス（=GPUバッファ上の
     ///        shapeIndex）への対応表。blendShapes_はInspector上で自由に並べ替えられるため、
     ///        ウェイトアップロード時にこの表で名前引きしてGPU側の正しいスロットへ書き込む
@@ -31,10 +31,12 @@ public:
     // （materialName_はハンドルの再解決も）を促す
     OBJECT_COMPONENT_CONSTRUCTOR(SpriteRenderer, 0xFF,
         SetUpdatePriority(900);
-        ADD_MEMBER_VARIABLE_WITH_CALLBACK(pipelineName_, [this] { MarkDrawListDirty(); });
-        ADD_MEMBER_VARIABLE_WITH_CALLBACK(materialName_, [this] {
-            materialHandle_ = MaterialManager::kInvalidHandle;
-            MarkDrawListDirty();
+    )
+    OBJECT_COMPONENT_MEMBER_VARIABLES(SpriteRenderer,
+        ADD_MEMBER_VARIABLE_WITH_CALLBACK(pipelineName_, [](auto &self) { self.MarkDrawListDirty(); });
+        ADD_MEMBER_VARIABLE_WITH_CALLBACK(materialName_, [](auto &self) {
+            self.materialHandle_ = MaterialManager::kInvalidHandle;
+            self.MarkDrawListDirty();
         });
         ADD_MEMBER_VARIABLE(anchor_);
         ADD_MEMBER_VARIABLE(pivot_);
@@ -59,19 +59,21 @@ public:
     // 直接書き込み時もセッターと同様に形状/インスタンスの再構築を促す
     OBJECT_COMPONENT_CONSTRUCTOR(TextRenderer, 0xFF,
         SetUpdatePriority(900);
+    )
+    OBJECT_COMPONENT_MEMBER_VARIABLES(TextRenderer,
         ADD_MEMBER_VARIABLE(pipelineName_);
-        ADD_MEMBER_VARIABLE_WITH_CALLBACK(text_, [this] { MarkShapeDirty(); });
-        ADD_MEMBER_VARIABLE_WITH_CALLBACK(fontName_, [this] {
-            fontHandle_ = FontManager::kInvalidHandle;
-            MarkShapeDirty();
+        ADD_MEMBER_VARIABLE_WITH_CALLBACK(text_, [](auto &self) { self.MarkShapeDirty(); });
+        ADD_MEMBER_VARIABLE_WITH_CALLBACK(fontName_, [](auto &self) {
+            self.fontHandle_ = FontManager::kInvalidHandle;
+            self.MarkShapeDirty();
         });
-        ADD_MEMBER_VARIABLE_WITH_CALLBACK(fontSize_, [this] {
-            fontSize_ = std::max(0.01f, fontSize_);
-            MarkShapeDirty();
+        ADD_MEMBER_VARIABLE_WITH_CALLBACK(fontSize_, [](auto &self) {
+            self.fontSize_ = std::max(0.01f, self.fontSize_);
+            self.MarkShapeDirty();
         });
-        ADD_MEMBER_VARIABLE_WITH_CALLBACK(color_, [this] { MarkShapeDirty(); });
-        ADD_MEMBER_VARIABLE_WITH_CALLBACK(defaultCharacterAnchor_, [this] { MarkInstancesDirty(); });
-        ADD_MEMBER_VARIABLE_WITH_CALLBACK(defaultCharacterPivot_, [this] { MarkInstancesDirty(); });
+        ADD_MEMBER_VARIABLE_WITH_CALLBACK(color_, [](auto &self) { self.MarkShapeDirty(); });
+        ADD_MEMBER_VARIABLE_WITH_CALLBACK(defaultCharacterAnchor_, [](auto &self) { self.MarkInstancesDirty(); });
+        ADD_MEMBER_VARIABLE_WITH_CALLBACK(defaultCharacterPivot_, [](auto &self) { self.MarkInstancesDirty(); });
     )
     COMPONENT_CATEGORY("Render")
     ~TextRenderer() override = default;
@@ -2,7 +2,6 @@
 #include "Objects/ObjectComponentHeader.h"
 #include "Objects/Components/Transform.h"
 #include "Math/Vector3.h"
-#include "Utilities/TimeUtils.h"
 #include "Utilities/Translation.h"
 
 namespace KashipanEngine {
@@ -11,19 +10,21 @@ namespace KashipanEngine {
 /// @details 毎フレーム、角加速度を角速度へ、角速度を Transform の回転（オイラー角、ラジアン）へ適用する。
 class Rotation final : public IObjectComponent {
 public:
-    OBJECT_COMPONENT_CONSTRUCTOR(Rotation, 1,
-        ADD_MEMBER_VARIABLE(angularVelocity_);
-        ADD_MEMBER_VARIABLE(angularAcceleration_);
+    /// @brief Sceneが型ごとにプールを走査して一括更新する（個別のUpdateは呼ばれない）
+    static constexpr bool IsBatchProcessed() { return true; }
+    /// @brief 自身と所属オブジェクトのTransformにしか書き込まないため、チャンク単位で並列に更新する
+    static constexpr bool IsBatchParallel() { return true; }
+
+    OBJECT_COMPONENT_CONSTRUCTOR(Rotation, 1, )
+    OBJECT_COMPONENT_MEMBER_VARIABLES(Rotation,
+        ADD_SERIALIZED_MEMBER_VARIABLE(angularVelocity_, { .serializedKey = "angularVelocity", .labelKey = "component.rotation.angular_velocity", .dragSpeed = 0.01f });
+        ADD_SERIALIZED_MEMBER_VARIABLE(angularAcceleration_, { .serializedKey = "angularAcceleration", .labelKey = "component.rotation.angular_acceleration", .dragSpeed = 0.01f });
+        MEMBER_VARIABLES_COVER_ALL_STATE();
     )
     COMPONENT_CATEGORY("Physics")
     ~Rotation() override = default;
 
-    std::unique_ptr<IObjectComponent> Clone() const override {
-        auto ptr = std::make_unique<Rotation>();
-        ptr->angularVelocity_ = angularVelocity_;
-        ptr->angularAcceleration_ = angularAcceleration_;
-        return ptr;
-    }
+    std::unique_ptr<IObjectComponent> Clone() const override { return CloneByMemberVariables<Rotation>(); }
 
     void SetAngularVelocity(const Vector3 &angularVelocity) { angularVelocity_ = angularVelocity; }
     const Vector3 &GetAngularVelocity() const noexcept { return angularVelocity_; }
@@ -33,38 +34,18 @@ public:
     /// @brief 角速度に加算する
     void AddAngularVelocity(const Vector3 &angularVelocity) { angularVelocity_ = angularVelocity_ + angularVelocity; }
 
-protected:
-    void Update() override {
+    /// @brief 一括更新（ComponentPool<Rotation> から1フレームに1度呼ばれる）
+    void UpdateBatch(Passkey<ComponentPool<Rotation>>, const ComponentBatchContext &context) {
         auto *objectContext = GetOwnerObjectContext();
         if (!objectContext) return;
         auto *transform = objectContext->GetComponent<Transform>();
         if (!transform) return;
 
-        const float deltaTime = GetDeltaTime();
+        const float deltaTime = context.deltaTime;
         angularVelocity_ = angularVelocity_ + angularAcceleration_ * deltaTime;
         transform->SetRotate(transform->GetRotate() + angularVelocity_ * deltaTime);
     }
 
-#if defined(USE_IMGUI)
-    void ShowImGui() override {
-        ImGui::DragFloat3(TranslationLabel("component.rotation.angular_velocity"), &angularVelocity_.x, 0.01f);
-        ImGui::DragFloat3(TranslationLabel("component.rotation.angular_acceleration"), &angularAcceleration_.x, 0.01f);
-    }
-#endif
-
-    JSON SaveToJson() const override {
-        JSON json = JSON::object();
-        json["angularVelocity"] = ToJSON(angularVelocity_);
-        json["angularAcceleration"] = ToJSON(angularAcceleration_);
-        return json;
-    }
-
-    bool LoadFromJson(const JSON &json) override {
-        if (json.contains("angularVelocity")) angularVelocity_ = FromJSON<Vector3>(json["angularVelocity"]);
-        if (json.contains("angularAcceleration")) angularAcceleration_ = FromJSON<Vector3>(json["angularAcceleration"]);
-        return true;
-    }
-
 private:
     /// @brief 角速度（ラジアン/秒）
     Vector3 angularVelocity_{ 0.0f, 0.0f, 0.0f };
@@ -25,14 +25,7 @@ void SceneVariableApplier::Update() {
         : sceneContext->GetSceneVariable(variableName_);
     if (!variable || variable->IsEmpty()) return;
 
-    auto *objectContext = GetOwnerObjectContext();
-    bool anyApplied = false;
-    for (const auto &binding : bindings_) {
-        if (ApplyParameterBindingValue(objectContext, binding, *variable, this)) {
-            anyApplied = true;
-        }
-    }
-    wasApplied_ = anyApplied;
+    wasApplied_ = bindingTable_.ApplyValue(GetOwnerObjectContext(), bindings_, *variable, this) > 0;
 }
 
 #if defined(USE_IMGUI)
@@ -72,7 +65,9 @@ void SceneVariableApplier::ShowImGui() {
     // 変数が見つからない間はfloat扱いの候補（既定）を出しておく
     const TypeInfo sourceType = variable ? variable->GetTypeInfo() : TypeInfo(ValueType::Float);
     const auto candidates = CollectParameterBindingCandidatesForType(GetOwnerObjectContext(), this, sourceType);
-    ShowParameterBindingListImGui(bindings_, candidates);
+    if (ShowParameterBindingListImGui(bindings_, candidates)) {
+        bindingTable_.Invalidate();
+    }
 }
 
 #endif // USE_IMGUI
@@ -91,6 +86,7 @@ JSON SceneVariableApplier::SaveToJson() const {
 
 bool SceneVariableApplier::LoadFromJson(const JSON &json) {
     bindings_.clear();
+    bindingTable_.Invalidate();
     variableName_ = json.value("variableName", std::string{});
     variableScope_ = static_cast<VariableScope>(json.value("variableScope", 0));
     if (json.contains("bindings") && json["bindings"].is_array()) {
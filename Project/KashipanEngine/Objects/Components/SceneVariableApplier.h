@@ -49,6 +49,8 @@ private:
 
     // --- 実行時状態（保存されない） ---
     bool wasApplied_ = false;
+    /// @brief bindings_ を解決済みの書き込み先
+    ParameterBindingTable bindingTable_;
 };
 
 REGISTER_COMPONENT_OBJECT(SceneVariableApplier)
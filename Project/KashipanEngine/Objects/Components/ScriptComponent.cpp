@@ -7,7 +7,6 @@
 
 #include <angelscript.h>
 #include <add_on/scriptarray/scriptarray.h>
-#include <add_on/scriptbuilder/scriptbuilder.h>
 #include <add_on/scripthelper/scripthelper.h>
 
 #include "Core/ProjectPaths.h"
@@ -19,8 +18,10 @@
 #include "Objects/Components/Collider/ICollider.h"
 #include "Objects/Components/Render/IWindowObjectComponent.h"
 #include "Objects/EmptyObject.h"
+#include "Objects/ParameterBinding.h"
 #include "Scene/Components/Script/SceneScriptEngine.h"
 #include "Scene/Components/Script/ScriptBindings.h"
+#include "Scene/Components/Script/ScriptContextPool.h"
 #include "Scene/SceneContext.h"
 #include "Utilities/FileIO/Directory.h"
 #include "Utilities/UUID128.h"
@@ -36,6 +37,65 @@ namespace {
 constexpr const char *kSerializeFieldMetadata = "SerializeField";
 constexpr const char *kBehaviorInterfaceName = "ScriptComponentBehavior";
 
+/// @brief モジュールから引いたBehaviorクラスと各メソッド（モジュールのユーザーデータとして1モジュールに1つ保持する）
+/// @details 共有モジュールでは全インスタンスが同じものを使うため、宣言文字列による検索はモジュールごとに1回で済む
+struct BehaviorBinding {
+    asITypeInfo *type = nullptr;
+    asIScriptFunction *factory = nullptr;
+    asIScriptFunction *awake = nullptr;
+    asIScriptFunction *start = nullptr;
+    asIScriptFunction *update = nullptr;
+    asIScriptFunction *end = nullptr;
+    asIScriptFunction *onCollisionEnter = nullptr;
+    asIScriptFunction *onCollisionStay = nullptr;
+    asIScriptFunction *onCollisionExit = nullptr;
+    asIScriptFunction *onWindowMessage = nullptr;
+};
+
+/// @brief asIScriptModule::SetUserData で BehaviorBinding を保持する際の種別
+constexpr asPWORD kBehaviorBindingUserDataType = 0x4B534243u; // "KSBC"
+
+void CleanupBehaviorBinding(asIScriptModule *module) {
+    delete static_cast<BehaviorBinding *>(module->GetUserData(kBehaviorBindingUserDataType));
+}
+
+/// @brief モジュールのBehaviorBindingを取得する（未解決の場合はここで解決してモジュールへ保持させる）
+const BehaviorBinding *GetBehaviorBinding(asIScriptEngine *engine, asIScriptModule *module) {
+    if (auto *cached = static_cast<BehaviorBinding *>(module->GetUserData(kBehaviorBindingUserDataType))) {
+        return cached;
+    }
+    asITypeInfo *interfaceType = engine->GetTypeInfoByDecl(kBehaviorInterfaceName);
+    if (!interfaceType) return nullptr;
+
+    auto binding = std::make_unique<BehaviorBinding>();
+    // ScriptComponentBehaviorを実装した最初のクラスを探す
+    const asUINT typeCount = module->GetObjectTypeCount();
+    for (asUINT i = 0; i < typeCount; ++i) {
+        asITypeInfo *type = module->GetObjectTypeByIndex(i);
+        if (type && type->Implements(interfaceType)) {
+            binding->type = type;
+            break;
+        }
+    }
+    if (asITypeInfo *type = binding->type) {
+        const std::string factoryDecl = std::string(type->GetName()) + " @" + type->GetName() + "()";
+        binding->factory = type->GetFactoryByDecl(factoryDecl.c_str());
+        binding->awake = type->GetMethodByDecl("void Awake()");
+        binding->start = type->GetMethodByDecl("void Start()");
+        binding->update = type->GetMethodByDecl("void Update()");
+        binding->end = type->GetMethodByDecl("void End()");
+        binding->onCollisionEnter = type->GetMethodByDecl("void OnCollisionEnter(const HitInfo &in)");
+        binding->onCollisionStay = type->GetMethodByDecl("void OnCollisionStay(const HitInfo &in)");
+        binding->onCollisionExit = type->GetMethodByDecl("void OnCollisionExit(const HitInfo &in)");
+        binding->onWindowMessage = type->GetMethodByDecl("void OnWindowMessage(const WindowMessageInfo &in)");
+    }
+
+    // モジュールの破棄時に一緒に解放されるようにする（同じ種別に対する再設定は上書きになるだけ）
+    engine->SetModuleUserDataCleanupCallback(CleanupBehaviorBinding, kBehaviorBindingUserDataType);
+    module->SetUserData(binding.get(), kBehaviorBindingUserDataType);
+    return binding.release();
+}
+
 /// @brief メタデータ文字列の前後空白を取り除く
 std::string TrimMetadata(const std::string &metadata) {
     const auto first = metadata.find_first_not_of(" \t");
@@ -191,26 +251,6 @@ bool HasSerializableMetadata(const std::vector<std::string> &metadataList) {
     return false;
 }
 
-/// @brief `#include "path.as"` を解決するコールバック
-/// @details includeで指定されたパスが相対パスの場合、includeディレクティブを書いたファイル（from）
-///          と同じディレクトリからの相対パスとして解決する。絶対パス指定の場合はそのまま使用する
-int ResolveIncludePath(const char *include, const char *from, CScriptBuilder *builder, void *) {
-    if (!include || !builder) return -1;
-
-    std::string includePath = include;
-    const bool isAbsolute = includePath.size() >= 2 &&
-        (includePath[1] == ':' || includePath[0] == '/' || includePath[0] == '\\');
-
-    if (!isAbsolute && from) {
-        const std::string fromPath = from;
-        const auto slashPos = fromPath.find_last_of("/\\");
-        if (slashPos != std::string::npos) {
-            includePath = fromPath.substr(0, slashPos + 1) + includePath;
-        }
-    }
-    return builder->AddSectionFromFile(includePath.c_str());
-}
-
 #if defined(USE_IMGUI)
 /// @brief Assetsフォルダ以下に存在する全ての .as ファイルの一覧（キャッシュ）
 /// @details ファイルシステムを毎フレーム走査しないよう、一度取得した結果を保持し、
@@ -258,6 +298,7 @@ struct ScriptComponent::WindowObjectHooks {
 
 ScriptComponent::~ScriptComponent() {
     // コライダー側のコールバックはaliveToken_の失効により無効化されるため、ここでの解除は不要
+    RemoveFromBatchQueue();
     ReleaseScript();
 }
 
@@ -297,19 +338,17 @@ void ScriptComponent::ReleaseScript() {
     onCollisionExitMethod_ = nullptr;
     onWindowMessageMethod_ = nullptr;
     serializedFields_.clear();
+    ++fieldsGeneration_;
 
-    if (context_) {
-        context_->Release();
-        context_ = nullptr;
-    }
-
-    if (!moduleName_.empty()) {
+    if (moduleLease_.entry) {
         auto *scriptEngine = GetSceneScriptEngine();
-        asIScriptEngine *engine = scriptEngine ? scriptEngine->GetEngine() : nullptr;
-        if (engine) {
-            engine->DiscardModule(moduleName_.c_str());
+        auto *moduleCache = scriptEngine ? scriptEngine->GetModuleCache() : nullptr;
+        if (moduleCache) {
+            moduleCache->Release(moduleLease_);
+        } else {
+            // エンジンごと終了済みの場合はモジュールも破棄済みのため、参照を手放すだけでよい
+            moduleLease_ = ScriptModuleCache::Lease{};
         }
-        moduleName_.clear();
     }
 }
 
@@ -331,37 +370,26 @@ bool ScriptComponent::Reload() {
 
     auto *scriptEngine = GetOrAddSceneScriptEngine();
     asIScriptEngine *engine = scriptEngine ? scriptEngine->GetEngine() : nullptr;
-    if (!engine) {
+    auto *moduleCache = scriptEngine ? scriptEngine->GetModuleCache() : nullptr;
+    if (!engine || !moduleCache) {
         lastError_ = "スクリプトエンジンが初期化されていません";
         return false;
     }
 
-    const std::string moduleName = "ScriptComponent_" + std::to_string(reinterpret_cast<uintptr_t>(this));
+    // グローバル変数を持つスクリプトの場合のみ、この名前でインスタンス専用のモジュールが作られる
+    const std::string instanceModuleName = "ScriptComponent_" + std::to_string(reinterpret_cast<uintptr_t>(this));
+    moduleLease_ = moduleCache->Acquire(scriptPath_, {}, instanceModuleName);
+    const auto &moduleEntry = *moduleLease_.entry;
 
-    CScriptBuilder builder;
-    if (builder.StartNewModule(engine, moduleName.c_str()) < 0) {
-        lastError_ = "モジュールの作成に失敗しました";
-        return false;
-    }
-    moduleName_ = moduleName;
-    builder.SetIncludeCallback(ResolveIncludePath, nullptr);
-
-    // ビルド中のコンパイルメッセージを収集し、失敗時にインスペクターへ表示できるようにする
-    scriptEngine->BeginMessageCapture();
-    // scriptPath_ は "Assets/..." 形式の論理パスで保持しているため、ここで物理パスへ変換する
-    // （以降のincludeはこの物理パスからの相対で解決される）
-    const std::string resolvedScriptPath = ProjectPaths::ToPhysical(scriptPath_);
-    const bool isSectionLoaded = builder.AddSectionFromFile(resolvedScriptPath.c_str()) >= 0;
-    const bool isBuilt = isSectionLoaded && builder.BuildModule() >= 0;
-    auto buildMessages = scriptEngine->EndMessageCapture();
-
-    if (!isBuilt) {
-        lastError_ = isSectionLoaded
+    if (!moduleEntry.IsBuilt()) {
+        lastError_ = moduleEntry.IsSectionLoaded()
             ? "スクリプトのビルドに失敗しました: " + scriptPath_
             : "スクリプトファイルの読み込みに失敗しました: " + scriptPath_;
-        buildErrorMessages_ = std::move(buildMessages);
-        engine->DiscardModule(moduleName_.c_str());
-        moduleName_.clear();
+        buildErrorMessages_ = moduleEntry.GetBuildMessages();
+        return false;
+    }
+    if (!moduleLease_.module) {
+        lastError_ = "モジュールの作成に失敗しました";
         return false;
     }
 
@@ -372,104 +400,96 @@ bool ScriptComponent::Reload() {
     quaternionTypeId_ = engine->GetTypeIdByDecl("Quaternion");
     objectTypeId_ = engine->GetTypeIdByDecl("Object");
 
-    context_ = engine->CreateContext();
-    scriptEngine->AttachDebugger(context_);
-
-    if (!CreateBehaviorInstance(engine, builder)) {
+    if (!CreateBehaviorInstance(engine, moduleLease_.module)) {
         ReleaseScript();
         return false;
     }
 
-    CollectSerializedFields(builder);
+    CollectSerializedFields(moduleLease_.module, moduleLease_.entry->GetMetadata());
     ApplyFieldValuesFromJson(pendingFieldValues_);
     return true;
 }
 
-bool ScriptComponent::CreateBehaviorInstance(asIScriptEngine *engine, CScriptBuilder &builder) {
-    asIScriptModule *module = builder.GetModule();
-    asITypeInfo *interfaceType = engine->GetTypeInfoByDecl(kBehaviorInterfaceName);
-    if (!module || !interfaceType) {
+bool ScriptComponent::CreateBehaviorInstance(asIScriptEngine *engine, asIScriptModule *module) {
+    const BehaviorBinding *binding = module ? GetBehaviorBinding(engine, module) : nullptr;
+    if (!binding) {
         lastError_ = "スクリプトモジュールの取得に失敗しました";
         return false;
     }
-
-    // ScriptComponentBehaviorを実装した最初のクラスを探す
-    behaviorType_ = nullptr;
-    const asUINT typeCount = module->GetObjectTypeCount();
-    for (asUINT i = 0; i < typeCount; ++i) {
-        asITypeInfo *type = module->GetObjectTypeByIndex(i);
-        if (type && type->Implements(interfaceType)) {
-            behaviorType_ = type;
-            break;
-        }
-    }
+    behaviorType_ = binding->type;
     if (!behaviorType_) {
         lastError_ = std::string(kBehaviorInterfaceName) + " を実装したクラスが見つかりません: " + scriptPath_;
         return false;
     }
-
-    const std::string factoryDecl = std::string(behaviorType_->GetName()) + " @" + behaviorType_->GetName() + "()";
-    asIScriptFunction *factory = behaviorType_->GetFactoryByDecl(factoryDecl.c_str());
-    if (!factory) {
+    if (!binding->factory) {
         lastError_ = std::string("クラス ") + behaviorType_->GetName() + " のデフォルトコンストラクタが見つかりません";
         return false;
     }
 
-    if (context_->Prepare(factory) < 0) {
+    ScriptCall call(*GetSceneScriptEngine(), binding->factory);
+    if (!call.IsPrepared()) {
         lastError_ = "コンストラクタの準備に失敗しました";
         return false;
     }
     int r;
     {
         ScriptExecutionScope scope(GetOwnerObjectContext(), GetOwnerSceneContext());
-        r = context_->Execute();
+        r = call.Execute();
     }
     if (r != asEXECUTION_FINISHED) {
-        lastError_ = GetExceptionInfo(context_);
+        lastError_ = GetExceptionInfo(call.GetContext());
         Log(Translation("engine.script.error") + lastError_, LogSeverity::Error);
         return false;
     }
 
-    behaviorObject_ = *static_cast<asIScriptObject **>(context_->GetAddressOfReturnValue());
+    behaviorObject_ = *static_cast<asIScriptObject **>(call.GetContext()->GetAddressOfReturnValue());
     if (!behaviorObject_) {
         lastError_ = "Behaviorクラスのインスタンス生成に失敗しました";
         return false;
     }
     behaviorObject_->AddRef();
 
-    awakeMethod_ = behaviorType_->GetMethodByDecl("void Awake()");
-    startMethod_ = behaviorType_->GetMethodByDecl("void Start()");
-    updateMethod_ = behaviorType_->GetMethodByDecl("void Update()");
-    endMethod_ = behaviorType_->GetMethodByDecl("void End()");
-    onCollisionEnterMethod_ = behaviorType_->GetMethodByDecl("void OnCollisionEnter(const HitInfo &in)");
-    onCollisionStayMethod_ = behaviorType_->GetMethodByDecl("void OnCollisionStay(const HitInfo &in)");
-    onCollisionExitMethod_ = behaviorType_->GetMethodByDecl("void OnCollisionExit(const HitInfo &in)");
-    onWindowMessageMethod_ = behaviorType_->GetMethodByDecl("void OnWindowMessage(const WindowMessageInfo &in)");
+    awakeMethod_ = binding->awake;
+    startMethod_ = binding->start;
+    updateMethod_ = binding->update;
+    endMethod_ = binding->end;
+    onCollisionEnterMethod_ = binding->onCollisionEnter;
+    onCollisionStayMethod_ = binding->onCollisionStay;
+    onCollisionExitMethod_ = binding->onCollisionExit;
+    onWindowMessageMethod_ = binding->onWindowMessage;
     // 新しいインスタンスなので、Start()は次回のUpdate()で改めて一度だけ呼ぶ
     startCalled_ = false;
     return true;
 }
 
-void ScriptComponent::CallMethod(asIScriptFunction *method) {
-    if (!method || !context_ || !behaviorObject_) return;
-
-    if (context_->Prepare(method) < 0) {
+void ScriptComponent::ExecuteBehaviorCall(ScriptCall &call) {
+    if (!call.IsPrepared()) {
         lastError_ = "関数の準備に失敗しました";
         return;
     }
-    context_->SetObject(behaviorObject_);
     ScriptExecutionScope scope(GetOwnerObjectContext(), GetOwnerSceneContext());
-    const int r = context_->Execute();
+    const int r = call.Execute();
     if (r != asEXECUTION_FINISHED) {
-        lastError_ = GetExceptionInfo(context_);
+        lastError_ = GetExceptionInfo(call.GetContext());
         Log(Translation("engine.script.error") + lastError_, LogSeverity::Error);
     }
 }
 
+void ScriptComponent::CallMethod(asIScriptFunction *method) {
+    if (!method || !behaviorObject_) return;
+    auto *scriptEngine = GetSceneScriptEngine();
+    if (!scriptEngine) return;
+
+    ScriptCall call(*scriptEngine, method, behaviorObject_);
+    ExecuteBehaviorCall(call);
+}
+
 void ScriptComponent::CallCollisionMethod(asIScriptFunction *method, const Vector3 &normal, float penetration,
     EmptyObject *selfObject, EmptyObject *otherObject,
     ICollider *selfCollider, ICollider *otherCollider) {
-    if (!method || !context_ || !behaviorObject_) return;
+    if (!method || !behaviorObject_) return;
+    auto *scriptEngine = GetSceneScriptEngine();
+    if (!scriptEngine) return;
 
     ScriptHitInfo hitInfo;
     hitInfo.normal = normal;
@@ -479,20 +499,16 @@ void ScriptComponent::CallCollisionMethod(asIScriptFunction *method, const Vecto
     hitInfo.selfCollider = selfCollider;
     hitInfo.otherCollider = otherCollider;
 
-    if (context_->Prepare(method) < 0) return;
-    context_->SetObject(behaviorObject_);
-    context_->SetArgObject(0, &hitInfo);
-    ScriptExecutionScope scope(GetOwnerObjectContext(), GetOwnerSceneContext());
-    const int r = context_->Execute();
-    if (r != asEXECUTION_FINISHED) {
-        lastError_ = GetExceptionInfo(context_);
-        Log(Translation("engine.script.error") + lastError_, LogSeverity::Error);
-    }
+    ScriptCall call(*scriptEngine, method, behaviorObject_);
+    if (call.IsPrepared()) call.GetContext()->SetArgObject(0, &hitInfo);
+    ExecuteBehaviorCall(call);
 }
 
 void ScriptComponent::CallWindowMessageMethod(asIScriptFunction *method, IWindowObjectComponent *sourceComponent,
     std::uint32_t message, std::uint64_t wparam, std::int64_t lparam) {
-    if (!method || !context_ || !behaviorObject_) return;
+    if (!method || !behaviorObject_) return;
+    auto *scriptEngine = GetSceneScriptEngine();
+    if (!scriptEngine) return;
 
     ScriptWindowMessageInfo messageInfo;
     messageInfo.sourceComponent = sourceComponent;
@@ -500,15 +516,9 @@ void ScriptComponent::CallWindowMessageMethod(asIScriptFunction *method, IWindow
     messageInfo.wparam = wparam;
     messageInfo.lparam = lparam;
 
-    if (context_->Prepare(method) < 0) return;
-    context_->SetObject(behaviorObject_);
-    context_->SetArgObject(0, &messageInfo);
-    ScriptExecutionScope scope(GetOwnerObjectContext(), GetOwnerSceneContext());
-    const int r = context_->Execute();
-    if (r != asEXECUTION_FINISHED) {
-        lastError_ = GetExceptionInfo(context_);
-        Log(Translation("engine.script.error") + lastError_, LogSeverity::Error);
-    }
+    ScriptCall call(*scriptEngine, method, behaviorObject_);
+    if (call.IsPrepared()) call.GetContext()->SetArgObject(0, &messageInfo);
+    ExecuteBehaviorCall(call);
 }
 
 size_t ScriptComponent::CountColliders() const {
@@ -655,13 +665,45 @@ void ScriptComponent::Initialize() {
 }
 
 void ScriptComponent::Finalize() {
+    RemoveFromBatchQueue();
     CallMethod(endMethod_);
     UnhookColliders();
     UnhookWindowObjects();
     ReleaseScript();
 }
 
-void ScriptComponent::Update() {
+void ScriptComponent::UpdateBatch(Passkey<ComponentPool<ScriptComponent>>, ComponentBatchQueue<ScriptComponent> &queue, const ComponentBatchContext &) {
+    batchQueueSlot_.Push(queue, this);
+}
+
+void ScriptComponent::EndBatchUpdate(Passkey<ComponentPool<ScriptComponent>>, ComponentBatchQueue<ScriptComponent> &queue, const ComponentBatchContext &) {
+    const auto slotOf = [](ScriptComponent &component) -> ComponentBatchQueueSlot<ScriptComponent> & { return component.batchQueueSlot_; };
+
+    // 同じモジュールのインスタンスを連続させ、関数・コンテキストの準備済み状態を使い回せるようにする
+    GroupComponentBatchQueue(queue,
+        [](const ScriptComponent &component) { return component.moduleLease_.entry.get(); }, slotOf);
+
+    // スクリプトから他のオブジェクトが削除されることがあるため、実行前に要素を取り出して登録を外す
+    // （削除されたインスタンスは RemoveFromBatchQueue で nullptr に置き換えられる）
+    DrainComponentBatchQueue(queue, slotOf, [](ScriptComponent &component) {
+        if (component.IsActive()) component.UpdateFrame();
+    });
+}
+
+void ScriptComponent::RemoveFromBatchQueue() {
+    batchQueueSlot_.Remove(this);
+}
+
+void ScriptComponent::UpdateFrame() {
+    // 同じスクリプトを使う他のインスタンスのReloadでソースが再コンパイルされた場合は、こちらも新しいモジュールへ載せ替える
+    if (moduleLease_.entry && moduleLease_.entry->IsSuperseded()) {
+        if (Reload()) {
+            HookColliders();
+            HookWindowObjects();
+            CallMethod(awakeMethod_);
+        }
+    }
+
     // このインスタンスにとって最初のUpdate()である場合、Start()を一度だけ先に呼ぶ
     if (behaviorObject_ && !startCalled_) {
         startCalled_ = true;
@@ -694,9 +736,9 @@ bool ScriptComponent::IsObjectFieldType(int typeId) const {
     return objectTypeId_ != 0 && (typeId & ~(asTYPEID_OBJHANDLE | asTYPEID_HANDLETOCONST)) == objectTypeId_;
 }
 
-void ScriptComponent::CollectSerializedFields(CScriptBuilder &builder) {
+void ScriptComponent::CollectSerializedFields(asIScriptModule *module, const ScriptMetadataTable &metadata) {
     serializedFields_.clear();
-    asIScriptModule *module = builder.GetModule();
+    ++fieldsGeneration_;
     if (!module) return;
     asIScriptEngine *engine = module->GetEngine();
 
@@ -717,12 +759,13 @@ void ScriptComponent::CollectSerializedFields(CScriptBuilder &builder) {
     // グローバル変数
     const asUINT varCount = module->GetGlobalVarCount();
     for (asUINT i = 0; i < varCount; ++i) {
-        FieldAttributes attrs = ParseFieldAttributes(builder.GetMetadataForVar(static_cast<int>(i)));
-        if (!attrs.serializeField) continue;
-
         const char *name = nullptr;
+        const char *nameSpace = nullptr;
         int typeId = 0;
-        if (module->GetGlobalVar(i, &name, nullptr, &typeId) < 0 || !name) continue;
+        if (module->GetGlobalVar(i, &name, &nameSpace, &typeId) < 0 || !name) continue;
+
+        FieldAttributes attrs = ParseFieldAttributes(metadata.ForGlobalVar(nameSpace, name));
+        if (!attrs.serializeField) continue;
 
         void *address = module->GetAddressOfGlobalVar(i);
         if (!address) continue;
@@ -732,18 +775,17 @@ void ScriptComponent::CollectSerializedFields(CScriptBuilder &builder) {
         field.typeId = typeId;
         field.address = address;
         field.attributes = std::move(attrs);
-        SetupArrayField(field, builder, engine, 0);
+        SetupArrayField(field, metadata, engine, 0);
         if (field.isArray) ensureValidArrayHandle(field, address);
-        if (!field.isArray) CollectSerializableChildren(field, builder, engine, 0);
+        if (!field.isArray) CollectSerializableChildren(field, metadata, engine, 0);
         serializedFields_.push_back(std::move(field));
     }
 
     // Behaviorクラスのメンバ変数
     if (behaviorType_ && behaviorObject_) {
-        const int behaviorTypeId = behaviorType_->GetTypeId();
         const asUINT propertyCount = behaviorType_->GetPropertyCount();
         for (asUINT i = 0; i < propertyCount; ++i) {
-            FieldAttributes attrs = ParseFieldAttributes(builder.GetMetadataForTypeProperty(behaviorTypeId, static_cast<int>(i)));
+            FieldAttributes attrs = ParseFieldAttributes(metadata.ForTypeProperty(behaviorType_, i));
             if (!attrs.serializeField) continue;
 
             const char *name = nullptr;
@@ -758,15 +800,15 @@ void ScriptComponent::CollectSerializedFields(CScriptBuilder &builder) {
             field.typeId = typeId;
             field.address = address;
             field.attributes = std::move(attrs);
-            SetupArrayField(field, builder, engine, 0);
+            SetupArrayField(field, metadata, engine, 0);
             if (field.isArray) ensureValidArrayHandle(field, address);
-            if (!field.isArray) CollectSerializableChildren(field, builder, engine, 0);
+            if (!field.isArray) CollectSerializableChildren(field, metadata, engine, 0);
             serializedFields_.push_back(std::move(field));
         }
     }
 }
 
-void ScriptComponent::CollectSerializableChildren(SerializedField &field, CScriptBuilder &builder, asIScriptEngine *engine, int depth) {
+void ScriptComponent::CollectSerializableChildren(SerializedField &field, const ScriptMetadataTable &metadata, asIScriptEngine *engine, int depth) {
     // 自己参照型（Serializableクラスが自身の型のメンバを持つ場合など）による無限再帰を防ぐ
     constexpr int kMaxSerializableDepth = 8;
     if (!engine || depth >= kMaxSerializableDepth) return;
@@ -776,8 +818,7 @@ void ScriptComponent::CollectSerializableChildren(SerializedField &field, CScrip
     if (!type || !(type->GetFlags() & asOBJ_SCRIPT_OBJECT)) return;
 
     // [System.Serializable] が付いたスクリプトクラスのみ展開の対象にする
-    const int classTypeId = type->GetTypeId();
-    if (!HasSerializableMetadata(builder.GetMetadataForType(classTypeId))) return;
+    if (!HasSerializableMetadata(metadata.ForType(type))) return;
 
     field.isScriptObject = true;
     const asUINT propertyCount = type->GetPropertyCount();
@@ -788,7 +829,7 @@ void ScriptComponent::CollectSerializableChildren(SerializedField &field, CScrip
         bool isProtected = false;
         if (type->GetProperty(i, &name, &propTypeId, &isPrivate, &isProtected) < 0 || !name) continue;
 
-        FieldAttributes attrs = ParseFieldAttributes(builder.GetMetadataForTypeProperty(classTypeId, static_cast<int>(i)));
+        FieldAttributes attrs = ParseFieldAttributes(metadata.ForTypeProperty(type, i));
         // Unityと同様、publicメンバは自動で対象になり、private/protectedは [SerializeField] が必要
         if ((isPrivate || isProtected) && !attrs.serializeField) continue;
 
@@ -797,14 +838,14 @@ void ScriptComponent::CollectSerializableChildren(SerializedField &field, CScrip
         child.typeId = propTypeId;
         child.propertyIndex = i;
         child.attributes = std::move(attrs);
-        SetupArrayField(child, builder, engine, depth + 1);
-        if (!child.isArray) CollectSerializableChildren(child, builder, engine, depth + 1);
+        SetupArrayField(child, metadata, engine, depth + 1);
+        if (!child.isArray) CollectSerializableChildren(child, metadata, engine, depth + 1);
         if (!child.isArray && !child.isScriptObject && !IsSupportedFieldType(child.typeId)) continue;
         field.children.push_back(std::move(child));
     }
 }
 
-void ScriptComponent::SetupArrayField(SerializedField &field, CScriptBuilder &builder, asIScriptEngine *engine, int depth) {
+void ScriptComponent::SetupArrayField(SerializedField &field, const ScriptMetadataTable &metadata, asIScriptEngine *engine, int depth) {
     // Serializableクラスと同じ深度制限を共有する（array<array<...>>やクラス配列の無限展開を防ぐ）
     constexpr int kMaxSerializableDepth = 8;
     if (!engine || depth >= kMaxSerializableDepth) return;
@@ -823,8 +864,8 @@ void ScriptComponent::SetupArrayField(SerializedField &field, CScriptBuilder &bu
     element.attributes.hasSpace = false;
     element.attributes.tooltip.clear();
 
-    SetupArrayField(element, builder, engine, depth + 1);
-    if (!element.isArray) CollectSerializableChildren(element, builder, engine, depth + 1);
+    SetupArrayField(element, metadata, engine, depth + 1);
+    if (!element.isArray) CollectSerializableChildren(element, metadata, engine, depth + 1);
 
     // 要素型が未対応の場合は配列自体をシリアライズ対象にしない
     if (!element.isArray && !element.isScriptObject && !IsSupportedFieldType(element.typeId)) return;
@@ -836,7 +877,7 @@ void ScriptComponent::SetupArrayField(SerializedField &field, CScriptBuilder &bu
 
 bool ScriptComponent::IsArrayHandleValid(CScriptArray *array, int fieldTypeId) const {
     if (!array) return false;
-    asIScriptEngine *engine = context_ ? context_->GetEngine() : nullptr;
+    asIScriptEngine *engine = moduleLease_.module ? moduleLease_.module->GetEngine() : nullptr;
     if (!engine) return false;
     asITypeInfo *expectedType = engine->GetTypeInfoById(fieldTypeId & ~(asTYPEID_OBJHANDLE | asTYPEID_HANDLETOCONST));
     asITypeInfo *actualType = array->GetArrayObjectType();
@@ -912,7 +953,7 @@ void ScriptComponent::ApplyField(const SerializedField &field, void *address, co
     if (field.isArray) {
         if (!value.is_array() || field.children.empty()) return;
         auto **arraySlot = static_cast<CScriptArray **>(address);
-        asIScriptEngine *engine = context_ ? context_->GetEngine() : nullptr;
+        asIScriptEngine *engine = moduleLease_.module ? moduleLease_.module->GetEngine() : nullptr;
         if (!*arraySlot || !IsArrayHandleValid(*arraySlot, field.typeId)) {
             // array<T>@ で宣言されたnullハンドル、または不正なハンドルの場合は
             // 新しく配列を生成してから書き込む（不正な値は実体が特定できないため解放しない）
@@ -1072,6 +1113,25 @@ bool ScriptComponent::SetFloatVariable(const std::string &name, float value) {
     return SetVariable(name, &value, asTYPEID_FLOAT);
 }
 
+float *ScriptComponent::GetFloatVariableAddress(const std::string &name) {
+    for (auto &field : serializedFields_) {
+        if (field.name != name || field.typeId != asTYPEID_FLOAT) continue;
+        if (field.isArray || field.isScriptObject || !field.address) return nullptr;
+        return static_cast<float *>(field.address);
+    }
+    return nullptr;
+}
+
+float *FindScriptFloatVariable(IObjectComponent &component, const std::string &name, bool &outIsScript) {
+    auto *script = dynamic_cast<ScriptComponent *>(&component);
+    outIsScript = script != nullptr;
+    return script ? script->GetFloatVariableAddress(name) : nullptr;
+}
+
+std::uint32_t GetScriptFieldsGeneration(const IObjectComponent &script) {
+    return static_cast<const ScriptComponent &>(script).GetFieldsGeneration();
+}
+
 #if defined(USE_IMGUI)
 void ScriptComponent::ShowImGui() {
     ImGuiCustom::SelectString(TranslationLabel("component.scriptcomponent.script_path"), scriptPath_, GetAvailableScriptPaths(), true);
@@ -1159,7 +1219,7 @@ void ScriptComponent::DrawFieldImGui(SerializedField &field, void *address) {
         SerializedField &element = field.children[0];
         const int subTypeId = array->GetElementTypeId();
         const bool wrapElement = (element.isArray || element.isScriptObject) && !(subTypeId & asTYPEID_OBJHANDLE);
-        asIScriptEngine *engine = context_ ? context_->GetEngine() : nullptr;
+        asIScriptEngine *engine = moduleLease_.module ? moduleLease_.module->GetEngine() : nullptr;
 
         // array<T@> 宣言の配列はリサイズ直後の要素がnullで編集できないため、その場で生成する
         const auto createHandleElements = [&]() {
@@ -1,23 +1,25 @@
 #pragma once
 #include <cstdint>
+#include <limits>
 #include <memory>
 #include <string>
 #include <vector>
 
 #include "Objects/ObjectComponentHeader.h"
+#include "Scene/Components/Script/ScriptModuleCache.h"
 
-class asIScriptContext;
 class asIScriptEngine;
 class asIScriptFunction;
+class asIScriptModule;
 class asIScriptObject;
 class asITypeInfo;
-class CScriptBuilder;
 class CScriptArray;
 struct Vector3;
 
 namespace KashipanEngine {
 
 class SceneScriptEngine;
+class ScriptCall;
 class ICollider;
 class IWindowObjectComponent;
 class EmptyObject;
@@ -27,7 +29,7 @@ class EmptyObject;
 ///          そのクラスがインスタンス化され、以下のメソッドが呼び出される。
 ///          - void Awake()  : インスタンス生成時（コンポーネントとしてアタッチされた時。Reload成功時も含む）に一度だけ
 ///          - void Start()  : ゲームループ中、そのインスタンスに対して最初にUpdate()が呼ばれる直前に一度だけ
-///          - void Update() : 毎フレーム
+///          - void Update() : 毎フレーム（全オブジェクトのUpdate後、同じスクリプトのインスタンスをまとめて続けて呼ぶ）
 ///          - void End()    : 終了時（コンポーネント削除・非アクティブ化・リロード時）
 ///          - void OnCollisionEnter/Stay/Exit(const HitInfo &in) : 同オブジェクトのコライダーの衝突時
 ///          - void OnWindowMessage(const WindowMessageInfo &in) : 同オブジェクトのWindowObject系
@@ -49,6 +51,16 @@ class EmptyObject;
 ///          `[SerializeField, Range(1, 10)]` のように1つのブロックへカンマ区切りでまとめて記述できる
 class ScriptComponent final : public IObjectComponent {
 public:
+    /// @brief Sceneが型ごとにプールを走査して一括更新する（個別のUpdateは呼ばれない）
+    /// @details UpdateBatch では更新対象を集めるだけで、スクリプトは EndBatchUpdate でスクリプトごとにまとめて実行する
+    static constexpr bool IsBatchProcessed() { return true; }
+    /// @brief 全オブジェクトの個別Updateより先に実行する（一括更新にする前の、他のコンポーネントより先に
+    ///        スクリプトのUpdateが呼ばれる順序を保つ。優先度1の一括更新の位置では、優先度1より大きい
+    ///        コンポーネントの個別Updateがスクリプトより先に走ってしまう）
+    static constexpr int GetBatchUpdatePriority() { return std::numeric_limits<int>::min(); }
+    /// @brief スクリプトが設定した速度・回転等をそのフレームのうちに反映させるため、他のバッチ処理対象より先に更新する
+    static constexpr int GetBatchUpdateOrder() { return -100; }
+
     OBJECT_COMPONENT_CONSTRUCTOR(ScriptComponent, 0xFF, )
     COMPONENT_CATEGORY("Script")
     ~ScriptComponent() override;
@@ -59,8 +71,11 @@ public:
     void SetScriptPath(const std::string &scriptPath) { scriptPath_ = scriptPath; }
     const std::string &GetScriptPath() const noexcept { return scriptPath_; }
 
-    /// @brief スクリプトを（再）コンパイルする。既にビルド済みの場合は End() を呼んでから再構築する
-    /// @details [SerializeField] 付き変数の現在値はリロード後も維持される
+    /// @brief スクリプトを（再）構築する。既にビルド済みの場合は End() を呼んでから再構築する
+    /// @details コンパイル結果はSceneScriptEngineのScriptModuleCacheで同じスクリプトを使う全インスタンスと共有され、
+    ///          ソースが変わっていない限り再コンパイルは行わない（Behaviorインスタンスのみ作り直す）。
+    ///          他のインスタンスのReloadでソースが再コンパイルされた場合は、次のUpdate()で自動的にリロードされる。
+    ///          [SerializeField] 付き変数の現在値はリロード後も維持される
     /// @return コンパイルに成功した場合は true
     bool Reload();
 
@@ -86,6 +101,17 @@ public:
     /// @brief float型の [SerializeField] 変数へ名前で値を設定する（AngelScriptの型ID指定が不要な簡易版）
     /// @return 名前が一致するfloat型変数が見つかった場合は true
     bool SetFloatVariable(const std::string &name, float value);
+    /// @brief float型の [SerializeField] 変数の格納先を取得する（ParameterBindingHandle の解決用）
+    /// @details 返したアドレスは GetFieldsGeneration() が変わるまで（リロード・破棄まで）有効
+    /// @return 名前が一致するfloat型変数が無い場合は nullptr
+    float *GetFloatVariableAddress(const std::string &name);
+    /// @brief [SerializeField] 変数の一覧の世代（スクリプトのリロード・破棄のたびに進む）
+    std::uint32_t GetFieldsGeneration() const noexcept { return fieldsGeneration_; }
+
+    /// @brief プールの待ち行列へ一括更新の対象として積む（ComponentPool<ScriptComponent> から1フレームに1度呼ばれる）
+    void UpdateBatch(Passkey<ComponentPool<ScriptComponent>>, ComponentBatchQueue<ScriptComponent> &queue, const ComponentBatchContext &context);
+    /// @brief 積まれたインスタンスのUpdateを、同じスクリプトどうしが連続するよう並べ替えてから実行する
+    static void EndBatchUpdate(Passkey<ComponentPool<ScriptComponent>>, ComponentBatchQueue<ScriptComponent> &queue, const ComponentBatchContext &context);
 
     /// @brief スクリプト変数に付与された属性（Unity互換メタデータ）
     struct FieldAttributes {
@@ -106,7 +132,6 @@ public:
 protected:
     void Initialize() override;
     void Finalize() override;
-    void Update() override;
 
 #if defined(USE_IMGUI)
     void ShowImGui() override;
@@ -142,9 +167,16 @@ private:
     SceneScriptEngine *GetOrAddSceneScriptEngine() const;
     void ReleaseScript();
 
+    /// @brief 1フレーム分の更新（リロード追従・Start・コールバックの再設定・Update呼び出し）
+    void UpdateFrame();
+    /// @brief 一括更新の待ち行列に入っていれば取り除く（実行中に破棄・無効化された場合用）
+    void RemoveFromBatchQueue();
+
     /// @brief モジュール内から ScriptComponentBehavior を実装したクラスを探してインスタンス化する
     /// @return 成功した場合は true（失敗時は lastError_ にエラー内容を格納する）
-    bool CreateBehaviorInstance(asIScriptEngine *engine, CScriptBuilder &builder);
+    bool CreateBehaviorInstance(asIScriptEngine *engine, asIScriptModule *module);
+    /// @brief Behaviorインスタンスの関数呼び出しを実行し、失敗時はエラーを記録する
+    void ExecuteBehaviorCall(ScriptCall &call);
     /// @brief Behaviorインスタンスのメソッドを引数無しで実行する
     void CallMethod(asIScriptFunction *method);
     /// @brief Behaviorインスタンスの衝突メソッドを HitInfo 引数付きで実行する
@@ -176,11 +208,11 @@ private:
     /// @brief 単純な値型（プリミティブ/数学型/Object@）のフィールド値を型IDに応じてコピーする
     void CopyLeafFieldValue(int typeId, void *dst, const void *src) const;
     /// @brief [SerializeField] 付き変数（グローバル変数とBehaviorクラスのメンバ変数）を収集する
-    void CollectSerializedFields(CScriptBuilder &builder);
+    void CollectSerializedFields(asIScriptModule *module, const ScriptMetadataTable &metadata);
     /// @brief フィールドが [System.Serializable] クラス型の場合に子フィールドを再帰的に収集する
-    void CollectSerializableChildren(SerializedField &field, CScriptBuilder &builder, asIScriptEngine *engine, int depth);
+    void CollectSerializableChildren(SerializedField &field, const ScriptMetadataTable &metadata, asIScriptEngine *engine, int depth);
     /// @brief フィールドが array<T> 型の場合に要素のフィールド情報を構築する（要素型が未対応なら何もしない）
-    void SetupArrayField(SerializedField &field, CScriptBuilder &builder, asIScriptEngine *engine, int depth);
+    void SetupArrayField(SerializedField &field, const ScriptMetadataTable &metadata, asIScriptEngine *engine, int depth);
     /// @brief array<T> ハンドルが実際にそのフィールドの型として妥当かを検証する
     /// @details 何らかの理由でハンドルスロットの内容が壊れている場合、GetSize()等の呼び出しが
     ///          不正なメモリアクセスでクラッシュするため、呼び出し前に必ずこれで確認する
@@ -199,8 +231,10 @@ private:
 #endif
 
     std::string scriptPath_;
-    std::string moduleName_;
-    asIScriptContext *context_ = nullptr;
+    /// @brief ScriptModuleCacheから借りているモジュール（共有モジュール、またはグローバル変数を持つ場合は専用の複製）
+    ScriptModuleCache::Lease moduleLease_;
+    /// @brief 積まれている一括更新の待ち行列（所属するプールが持つ）と、その中での位置
+    ComponentBatchQueueSlot<ScriptComponent> batchQueueSlot_;
 
     /// @brief ScriptComponentBehaviorを実装したスクリプトクラスのインスタンス
     asIScriptObject *behaviorObject_ = nullptr;
@@ -221,6 +255,7 @@ private:
     std::vector<std::string> buildErrorMessages_;
 
     std::vector<SerializedField> serializedFields_;
+    std::uint32_t fieldsGeneration_ = 0;
     /// @brief 次回ビルド時に適用する [SerializeField] の値（読込済み・リロード退避用）
     JSON pendingFieldValues_ = JSON::object();
     /// @brief 登録済み型のタイプID（ビルド時にキャッシュ）
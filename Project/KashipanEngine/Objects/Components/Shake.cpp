@@ -10,7 +10,6 @@
 #include "Scene/Components/SceneShakeApplier.h"
 #include "Scene/SceneContext.h"
 #include "Utilities/RandomValue.h"
-#include "Utilities/TimeUtils.h"
 #include "Utilities/Translation.h"
 
 namespace KashipanEngine {
@@ -74,8 +73,8 @@ void Shake::Finalize() {
     if (applier) applier->UnregisterShake(this);
 }
 
-void Shake::Update() {
-    const float dt = GetDeltaTime();
+void Shake::UpdateBatch(Passkey<ComponentPool<Shake>>, const ComponentBatchContext &context) {
+    const float dt = context.deltaTime;
 
     if (isPlaying_ && playDuration_ > 0.0f) {
         elapsedPlayTime_ += dt;
@@ -15,7 +15,7 @@ namespace KashipanEngine {
 ///          イージング種類を設定できる。各軸は独立して「ランダムな目標値」を選び直し、
 ///          指定した速度とイージングでその目標値へ向かって遷移し続けることで揺れを表現する。
 ///          - 処理タイミング（ProcessTiming）:
-///            Immediate  = 自身のUpdate内でその場処理する
+///            Immediate  = 自身の更新（型ごとの一括更新）内でその場処理する
 ///            DeferredEnd= SceneShakeApplierへ登録し、全オブジェクトのUpdate/衝突解決が
 ///                         終わった後にまとめて処理する（既定。他のスクリプトの
 ///                         Transform操作と競合しない）
@@ -36,7 +36,14 @@ public:
         RenderOnly = 1,
     };
 
-    OBJECT_COMPONENT_CONSTRUCTOR(Shake, 0xFF,
+    /// @brief Sceneが型ごとにプールを走査して一括更新する（個別のUpdateは呼ばれない）
+    /// @details 乱数（GetRandomFloat）の共有状態を使うため並列には更新しない
+    static constexpr bool IsBatchProcessed() { return true; }
+    /// @brief 移動・回転系のコンポーネントの後に揺れを計算する
+    static constexpr int GetBatchUpdateOrder() { return 20; }
+
+    OBJECT_COMPONENT_CONSTRUCTOR(Shake, 0xFF, )
+    OBJECT_COMPONENT_MEMBER_VARIABLES(Shake,
         ADD_MEMBER_VARIABLE(positionEnableX_);
         ADD_MEMBER_VARIABLE(positionEnableY_);
         ADD_MEMBER_VARIABLE(positionEnableZ_);
@@ -111,10 +118,12 @@ public:
     /// @brief SceneShakeApplierから呼ばれる、DeferredEnd+ToTransform時のTransform適用処理
     void ApplyToTransformInterface(Passkey<class SceneShakeApplier>) { ApplyToTransform(); }
 
+    /// @brief 一括更新（ComponentPool<Shake> から1フレームに1度呼ばれる）
+    void UpdateBatch(Passkey<ComponentPool<Shake>>, const ComponentBatchContext &context);
+
 protected:
     void Initialize() override;
     void Finalize() override;
-    void Update() override;
 #if defined(USE_IMGUI)
     void ShowImGui() override;
 #endif
@@ -7,7 +7,6 @@
 #include "Math/Quaternion.h"
 #include "Math/Vector3.h"
 #include "Utilities/MathUtils.h"
-#include "Utilities/TimeUtils.h"
 #include "Utilities/UUID128.h"
 #if defined(USE_IMGUI)
 #include "Objects/Components/Render/TargetObjectSelector.h"
@@ -26,7 +25,14 @@ namespace KashipanEngine {
 ///          （CameraControllerの追従の強さと同じく、1フレーム(60fps換算)あたりの補間割合）。
 class TargetLookAt final : public IObjectComponent {
 public:
-    OBJECT_COMPONENT_CONSTRUCTOR(TargetLookAt, 1,
+    /// @brief Sceneが型ごとにプールを走査して一括更新する（個別のUpdateは呼ばれない）
+    /// @details ターゲットや親のワールド行列（遅延計算のキャッシュ）を読むため並列には更新しない
+    static constexpr bool IsBatchProcessed() { return true; }
+    /// @brief ターゲットの移動・回転（Velocity/Rotation）が反映された後に向きを決める
+    static constexpr int GetBatchUpdateOrder() { return 10; }
+
+    OBJECT_COMPONENT_CONSTRUCTOR(TargetLookAt, 1, )
+    OBJECT_COMPONENT_MEMBER_VARIABLES(TargetLookAt,
         ADD_MEMBER_VARIABLE(rotationOffset_);
         ADD_MEMBER_VARIABLE(followStrength_);
     )
@@ -87,8 +93,8 @@ public:
     void SetFollowStrength(float strength) noexcept { followStrength_ = strength; }
     float GetFollowStrength() const noexcept { return followStrength_; }
 
-protected:
-    void Update() override {
+    /// @brief 一括更新（ComponentPool<TargetLookAt> から1フレームに1度呼ばれる）
+    void UpdateBatch(Passkey<ComponentPool<TargetLookAt>>, const ComponentBatchContext &context) {
         auto *objectContext = GetOwnerObjectContext();
         if (!objectContext) return;
         auto *transform = objectContext->GetComponent<Transform>();
@@ -128,7 +134,7 @@ protected:
         // 追従の強さに応じて現在の回転から目標の回転へ補間する。
         // 1.0以上は「毎フレーム即座に目標の回転になる」ものとして扱い、フレームレートに
         // 依らず確実に即時追従させる（dt*60の補正だけだと高フレームレート時に届かなくなるため）
-        const float t = ComputeFollowLerpT();
+        const float t = ComputeFollowLerpT(context);
         if (t >= 1.0f) {
             transform->SetRotateQuaternion(desiredLocal);
         } else {
@@ -136,6 +142,7 @@ protected:
         }
     }
 
+protected:
 #if defined(USE_IMGUI)
     void ShowImGui() override {
         TargetObjectSelector::ShowSelector("Target", GetOwnerSceneContext(), targetObjectID_, true, false);
@@ -184,9 +191,9 @@ protected:
 
 private:
     /// @brief 追従の強さから、このフレームの補間係数（0〜1）を求める
-    float ComputeFollowLerpT() const {
+    float ComputeFollowLerpT(const ComponentBatchContext &context) const {
         if (followStrength_ >= 1.0f) return 1.0f;
-        const float dt = std::max(0.0f, GetDeltaTime() * GetGameSpeed());
+        const float dt = std::max(0.0f, context.deltaTime * context.gameSpeed);
         return std::clamp(followStrength_ * dt * 60.0f, 0.0f, 1.0f);
     }
 
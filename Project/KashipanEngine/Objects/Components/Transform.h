@@ -1,6 +1,8 @@
 #pragma once
 #include "Objects/ObjectComponentHeader.h"
+#include "Objects/TransformHierarchy.h"
 #include "Scene/Scene.h"
+#include "Utilities/MathUtils/Matrix4x4.h"
 #include "Utilities/Translation.h"
 
 namespace KashipanEngine {
@@ -10,16 +12,44 @@ public:
     // translate_/rotate_/scale_は外部（KeyFrameAnimator等）からポインタ経由で直接書き込まれると
     // セッターを迂回するため、書き込み後コールバックでワールド行列キャッシュの無効化
     // （rotate_はクォータニオンとの同期も）を行う
-    OBJECT_COMPONENT_CONSTRUCTOR(Transform, 1,
-        ADD_MEMBER_VARIABLE_WITH_CALLBACK(translate_, [this] { isWorldMatrixCalculated_ = false; });
-        ADD_MEMBER_VARIABLE_WITH_CALLBACK(rotate_, [this] {
-            rotateQuat_ = Quaternion::MakeRotateEuler(rotate_);
-            isWorldMatrixCalculated_ = false;
+    OBJECT_COMPONENT_CONSTRUCTOR(Transform, 1, )
+    OBJECT_COMPONENT_MEMBER_VARIABLES(Transform,
+        ADD_MEMBER_VARIABLE_WITH_CALLBACK(translate_, [](auto &self) { self.MarkWorldMatrixDirty(); });
+        ADD_MEMBER_VARIABLE_WITH_CALLBACK(rotate_, [](auto &self) {
+            self.rotateQuat_ = Quaternion::MakeRotateEuler(self.rotate_);
+            self.MarkWorldMatrixDirty();
         });
-        ADD_MEMBER_VARIABLE_WITH_CALLBACK(scale_, [this] { isWorldMatrixCalculated_ = false; });
+        ADD_MEMBER_VARIABLE_WITH_CALLBACK(scale_, [](auto &self) { self.MarkWorldMatrixDirty(); });
         ADD_MEMBER_VARIABLE(worldMatrix_);
     )
-    ~Transform() override = default;
+    ~Transform() override {
+        if (hierarchy_) hierarchy_->RemoveNode(hierarchyIndex_);
+    }
+
+    /// @brief シーンのTransform階層表へ登録する（オブジェクトへの追加時にEmptyObjectから呼ばれる）
+    void AttachHierarchy(Passkey<EmptyObject>, TransformHierarchy *hierarchy) {
+        if (hierarchy_ || !hierarchy) return;
+        hierarchy_ = hierarchy;
+        hierarchy_->AddNode(this);
+    }
+    /// @brief 階層表内での並べ替えに合わせてインデックスを更新する
+    void SetHierarchyIndex(Passkey<TransformHierarchy>, std::uint32_t index) noexcept { hierarchyIndex_ = index; }
+    /// @brief 所属する階層表（未登録の場合は nullptr）
+    TransformHierarchy *GetHierarchy() const noexcept { return hierarchy_; }
+    /// @brief 階層表内でのインデックス（構造の再構築で変わるため保持しないこと）
+    std::uint32_t GetHierarchyIndex() const noexcept { return hierarchyIndex_; }
+    /// @brief バイナリシーンの行から読み込んだ値を設定する（LoadFromJson と同じ値になる）
+    /// @details 所属オブジェクトへ登録する前（シーンから親を引けない時点）に呼ばれるため、親はUUIDだけを保持し、
+    ///          階層表の再構築時に TryGetParentObject で解決させる（見つからない親・循環は根として扱われる）
+    void LoadSceneBinaryValues(Passkey<SceneBinaryComponentLoader>, const Vector3 &translate, const Quaternion &rotate, const Vector3 &scale, const UUID128 &parentObjectID) {
+        SetTranslate(translate);
+        SetRotateQuaternion(rotate);
+        SetScale(scale);
+        parentObjectID_ = parentObjectID;
+        MarkStructureDirty();
+    }
+    /// @brief 階層表が計算したワールド行列を、リフレクション用のメンバへ書き戻す
+    void SetWorldMatrix(Passkey<TransformHierarchy>, const Matrix4x4 &worldMatrix) noexcept { worldMatrix_ = worldMatrix; }
 
     /// @brief コンポーネントのクローンを作成
     std::unique_ptr<IObjectComponent> Clone() const override {
@@ -28,10 +58,6 @@ public:
         ptr->rotate_ = rotate_;
         ptr->rotateQuat_ = rotateQuat_;
         ptr->scale_ = scale_;
-        ptr->isWorldMatrixCalculated_ = false;
-        ptr->worldMatrix_ = Matrix4x4::Identity();
-        ptr->worldMatrixVersion_ = 0;
-        ptr->cachedParentVersion_ = 0;
         return ptr;
     }
 
@@ -41,8 +67,7 @@ public:
     bool SetParentObject(EmptyObject *parent) {
         if (!parent) {
             parentObjectID_ = UUID128();
-            isWorldMatrixCalculated_ = false;
-            cachedParentVersion_ = 0;
+            MarkStructureDirty();
             return true;
         }
         // 親にTransformを持たないオブジェクトは親にできない
@@ -55,9 +80,8 @@ public:
             if (p == ownerObject) return false;
         }
         parentObjectID_ = parent->GetObjectID();
-        // 親が変わったのでキャッシュは無効
-        isWorldMatrixCalculated_ = false;
-        cachedParentVersion_ = 0;
+        // 親が変わったので階層表の並び順（とワールド行列のキャッシュ）は無効
+        MarkStructureDirty();
         return true;
     }
     /// @brief 親オブジェクトをUUIDから設定する
@@ -66,8 +90,7 @@ public:
     bool SetParentObject(const UUID128 &parentUUID) {
         if (!parentUUID.IsValid()) {
             parentObjectID_ = UUID128();
-            isWorldMatrixCalculated_ = false;
-            cachedParentVersion_ = 0;
+            MarkStructureDirty();
             return true;
         }
         auto *sceneCtx = GetOwnerSceneContext();
@@ -82,13 +105,13 @@ public:
     void SetTranslate(const Vector3 &translate) {
         if (translate_ == translate) return;
         translate_ = translate;
-        isWorldMatrixCalculated_ = false;
+        MarkWorldMatrixDirty();
     }
 
     void SetTranslateY(const float &translateY) {
         if (translate_.y == translateY) return;
         translate_.y = translateY;
-        isWorldMatrixCalculated_ = false;
+        MarkWorldMatrixDirty();
     }
 
     /// @brief オイラー角で回転を設定する（互換用）
@@ -97,7 +120,7 @@ public:
         if (rotate_ == rotate) return;
         rotate_ = rotate;
         rotateQuat_ = Quaternion::MakeRotateEuler(rotate);
-        isWorldMatrixCalculated_ = false;
+        MarkWorldMatrixDirty();
     }
 
     /// @brief クォータニオンで回転を設定する
@@ -105,13 +128,13 @@ public:
     void SetRotateQuaternion(const Quaternion &quat) {
         rotateQuat_ = quat.Normalize();
         rotate_ = rotateQuat_.MakeEuler();
-        isWorldMatrixCalculated_ = false;
+        MarkWorldMatrixDirty();
     }
 
     void SetScale(const Vector3 &scale) {
         if (scale_ == scale) return;
         scale_ = scale;
-        isWorldMatrixCalculated_ = false;
+        MarkWorldMatrixDirty();
     }
 
     const Vector3 &GetTranslate() const { return translate_; }
@@ -128,12 +151,12 @@ public:
     /// @details 親のローカル回転を再帰的に合成する近似値（スケールの歪みは無視する）。
     ///          コライダー等、真のワールド回転が必要な箇所から使用する
     Quaternion GetWorldRotateQuaternion() const {
-        auto *parentObj = TryGetParentObject();
-        auto *parentTransform = parentObj ? parentObj->GetComponent<Transform>() : nullptr;
-        if (parentTransform) {
-            return (rotateQuat_ * parentTransform->GetWorldRotateQuaternion()).Normalize();
+        if (!hierarchy_) return rotateQuat_;
+        Quaternion result = rotateQuat_;
+        for (const Transform *parent = hierarchy_->GetParentTransform(*this); parent; parent = hierarchy_->GetParentTransform(*parent)) {
+            result = (result * parent->rotateQuat_).Normalize();
         }
-        return rotateQuat_;
+        return result;
     }
 
     /// @brief 親を合成したワールド回転を取得する（オイラー角、ラジアン）
@@ -159,50 +182,37 @@ public:
         return Vector3(axisX.Length(), axisY.Length(), axisZ.Length());
     }
 
-    const Matrix4x4 &GetWorldMatrix() {
-        if (IsWorldMatrixDirty()) {
-            // クォータニオンから回転行列を生成してワールド行列を構築
-            Matrix4x4 scaleMat;
-            scaleMat.MakeScale(scale_);
-
-            Matrix4x4 rotateMat = rotateQuat_.MakeRotateMatrix();
-
-            Matrix4x4 translateMat;
-            translateMat.MakeTranslate(translate_);
-
-            Matrix4x4 local = scaleMat * rotateMat * translateMat;
-
-            auto *parentObj = TryGetParentObject();
-            auto *parentTransform = parentObj ? parentObj->GetComponent<Transform>() : nullptr;
-            if (parentTransform) {
-                // 親のワールド行列を取得（必要なら親が再計算される）
-                const Matrix4x4 &pw = parentTransform->GetWorldMatrix();
-                worldMatrix_ = local * pw;
-                // 親のバージョンをキャッシュ
-                cachedParentVersion_ = parentTransform->GetWorldMatrixVersion();
-            } else {
-                worldMatrix_ = local;
-                cachedParentVersion_ = 0;
-            }
-            isWorldMatrixCalculated_ = true;
-            // 自身のワールド行列が更新されたことを示すバージョンを進める
-            ++worldMatrixVersion_;
+    /// @brief ワールド行列を取得する
+    /// @details シーンのTransform階層表が保持する値を返す（毎フレームの一括更新後は計算済みの値を返すだけ）。
+    ///          フレームの途中でローカル値を変更した場合は、祖先を含めて必要な分だけその場で計算される
+    ///          （階層表へは書き込まないため、並列ジョブから呼んでもよい。計算した値は呼び出したスレッドの控えに残り、
+    ///          ローカル値が変わるまでは同じフレームで読み直しても計算し直さない）。
+    ///          並列ジョブから呼ぶ間は、自身と祖先のローカル値を別のジョブで変更しないこと。
+    ///          オブジェクトの生成・削除・親の変更の直後は、メインスレッド以外からは前回の一括更新の値が返る
+    Matrix4x4 GetWorldMatrix() {
+        if (hierarchy_) return hierarchy_->GetWorldMatrix(*this);
+        // シーンに属さない一時的なインスタンスは親を持たないため、ローカル行列をそのまま使う
+        if (!isStandaloneWorldMatrixCalculated_) {
+            worldMatrix_ = ComputeLocalMatrix();
+            standaloneWorldMatrixVersion_ = ++sStandaloneWorldMatrixVersion;
+            isStandaloneWorldMatrixCalculated_ = true;
         }
         return worldMatrix_;
     }
 
-    // ワールド行列の現在バージョンを取得（外からは const にして参照可能）
-    std::uint64_t GetWorldMatrixVersion() const { return worldMatrixVersion_; }
+    /// @brief スケール・回転・平行移動を合成したローカル行列を計算する
+    Matrix4x4 ComputeLocalMatrix() const {
+        return MathUtils::Matrix4x4ComposeTRS(scale_, rotateQuat_, translate_);
+    }
+
+    // ワールド行列の現在バージョンを取得（再計算のたびに変わる）
+    std::uint64_t GetWorldMatrixVersion() const {
+        return hierarchy_ ? hierarchy_->GetWorldMatrixVersion(*this) : standaloneWorldMatrixVersion_;
+    }
 
+    /// @brief ワールド行列が計算済みで、祖先を含めて最新かどうか
     bool IsWorldMatrixCalculated() const {
-        // 自分のキャッシュがあること、かつ親がいる場合は親が計算済みで
-        // 親のバージョンが子がキャッシュしたものと一致していることを要求する
-        if (!isWorldMatrixCalculated_) return false;
-        auto *parentObj = TryGetParentObject();
-        auto *parentTransform = parentObj ? parentObj->GetComponent<Transform>() : nullptr;
-        if (!parentTransform) return true;
-        if (!parentTransform->IsWorldMatrixCalculated()) return false;
-        return (cachedParentVersion_ == parentTransform->GetWorldMatrixVersion());
+        return hierarchy_ ? hierarchy_->IsWorldMatrixCalculated(*this) : isStandaloneWorldMatrixCalculated_;
     }
     bool IsWorldMatrixDirty() const { return !IsWorldMatrixCalculated(); }
 
@@ -240,10 +250,9 @@ public:
         json["translate"] = ToJSON(translate_);
         json["rotate"] = ToJSON(rotateQuat_);
         json["scale"] = ToJSON(scale_);
+        // 親が無い場合も空文字で書き出し、全てのTransformのキーを揃える（バイナリシーンで列形式になり、直接読み込める）
         auto *parentObj = TryGetParentObject();
-        if (parentObj) {
-            json["parent"] = ToJSON(parentObj->GetObjectID());
-        }
+        json["parent"] = parentObj ? ToJSON(parentObj->GetObjectID()) : JSON(std::string());
         return json;
     }
 
@@ -279,15 +288,27 @@ private:
     Quaternion rotateQuat_ = Quaternion::Identity();
     Vector3 scale_{ 1.0f, 1.0f, 1.0f };
 
-    /// @brief 親オブジェクトのUUID（生ポインタではなくUUIDで保持し、使う直前に毎回 TryGetParentObject() で引き直す）
+    void MarkWorldMatrixDirty() noexcept {
+        if (hierarchy_) hierarchy_->MarkLocalDirty(hierarchyIndex_);
+        else isStandaloneWorldMatrixCalculated_ = false;
+    }
+    void MarkStructureDirty() noexcept {
+        if (hierarchy_) hierarchy_->MarkStructureDirty();
+    }
+
+    /// @brief 親オブジェクトのUUID（生ポインタではなくUUIDで保持し、階層表の再構築時に TryGetParentObject() で引き直す）
     UUID128 parentObjectID_;
-    Matrix4x4 worldMatrix_ = Matrix4x4::Identity();
-    bool isWorldMatrixCalculated_ = false;
 
-    // ワールド行列のバージョン（再計算ごとに++）
-    std::uint64_t worldMatrixVersion_ = 0;
-    // この Transform が最後に計算したときの親のバージョン
-    std::uint64_t cachedParentVersion_ = 0;
+    /// @brief ワールド行列を保持するシーンのTransform階層表（シーンに属さない一時的なインスタンスでは nullptr）
+    TransformHierarchy *hierarchy_ = nullptr;
+    std::uint32_t hierarchyIndex_ = TransformHierarchy::kInvalidIndex;
+    /// @brief 最後に計算したワールド行列（リフレクション用。階層表に属する場合は UpdateWorldMatrices で書き戻される）
+    Matrix4x4 worldMatrix_ = Matrix4x4::Identity();
+    /// @brief 階層表に属さない場合に、worldMatrix_ が現在のローカル値から計算済みか
+    bool isStandaloneWorldMatrixCalculated_ = false;
+    std::uint64_t standaloneWorldMatrixVersion_ = 0;
+    /// @brief 階層表に属さないインスタンスのワールド行列のバージョン（階層表と同じく再計算のたびに変わる値）
+    static inline std::atomic<std::uint64_t> sStandaloneWorldMatrixVersion{ 0 };
 };
 
 REGISTER_COMPONENT_OBJECT(Transform);
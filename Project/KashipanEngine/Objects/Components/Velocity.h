@@ -2,7 +2,6 @@
 #include "Objects/ObjectComponentHeader.h"
 #include "Objects/Components/Transform.h"
 #include "Math/Vector3.h"
-#include "Utilities/TimeUtils.h"
 #include "Utilities/Translation.h"
 
 namespace KashipanEngine {
@@ -11,19 +10,21 @@ namespace KashipanEngine {
 /// @details 毎フレーム、加速度を速度へ、速度を Transform の座標へ適用する。
 class Velocity final : public IObjectComponent {
 public:
-    OBJECT_COMPONENT_CONSTRUCTOR(Velocity, 1,
-        ADD_MEMBER_VARIABLE(velocity_);
-        ADD_MEMBER_VARIABLE(acceleration_);
+    /// @brief Sceneが型ごとにプールを走査して一括更新する（個別のUpdateは呼ばれない）
+    static constexpr bool IsBatchProcessed() { return true; }
+    /// @brief 自身と所属オブジェクトのTransformにしか書き込まないため、チャンク単位で並列に更新する
+    static constexpr bool IsBatchParallel() { return true; }
+
+    OBJECT_COMPONENT_CONSTRUCTOR(Velocity, 1, )
+    OBJECT_COMPONENT_MEMBER_VARIABLES(Velocity,
+        ADD_SERIALIZED_MEMBER_VARIABLE(velocity_, { .serializedKey = "velocity", .labelKey = "component.velocity.velocity", .dragSpeed = 0.01f });
+        ADD_SERIALIZED_MEMBER_VARIABLE(acceleration_, { .serializedKey = "acceleration", .labelKey = "component.velocity.acceleration", .dragSpeed = 0.01f });
+        MEMBER_VARIABLES_COVER_ALL_STATE();
     )
     COMPONENT_CATEGORY("Physics")
     ~Velocity() override = default;
 
-    std::unique_ptr<IObjectComponent> Clone() const override {
-        auto ptr = std::make_unique<Velocity>();
-        ptr->velocity_ = velocity_;
-        ptr->acceleration_ = acceleration_;
-        return ptr;
-    }
+    std::unique_ptr<IObjectComponent> Clone() const override { return CloneByMemberVariables<Velocity>(); }
 
     void SetVelocity(const Vector3 &velocity) { velocity_ = velocity; }
     const Vector3 &GetVelocity() const noexcept { return velocity_; }
@@ -33,38 +34,18 @@ public:
     /// @brief 速度に加算する
     void AddVelocity(const Vector3 &velocity) { velocity_ = velocity_ + velocity; }
 
-protected:
-    void Update() override {
+    /// @brief 一括更新（ComponentPool<Velocity> から1フレームに1度呼ばれる）
+    void UpdateBatch(Passkey<ComponentPool<Velocity>>, const ComponentBatchContext &context) {
         auto *objectContext = GetOwnerObjectContext();
         if (!objectContext) return;
         auto *transform = objectContext->GetComponent<Transform>();
         if (!transform) return;
 
-        const float deltaTime = GetDeltaTime();
+        const float deltaTime = context.deltaTime;
         velocity_ = velocity_ + acceleration_ * deltaTime;
         transform->SetTranslate(transform->GetTranslate() + velocity_ * deltaTime);
     }
 
-#if defined(USE_IMGUI)
-    void ShowImGui() override {
-        ImGui::DragFloat3(TranslationLabel("component.velocity.velocity"), &velocity_.x, 0.01f);
-        ImGui::DragFloat3(TranslationLabel("component.velocity.acceleration"), &acceleration_.x, 0.01f);
-    }
-#endif
-
-    JSON SaveToJson() const override {
-        JSON json = JSON::object();
-        json["velocity"] = ToJSON(velocity_);
-        json["acceleration"] = ToJSON(acceleration_);
-        return json;
-    }
-
-    bool LoadFromJson(const JSON &json) override {
-        if (json.contains("velocity")) velocity_ = FromJSON<Vector3>(json["velocity"]);
-        if (json.contains("acceleration")) acceleration_ = FromJSON<Vector3>(json["acceleration"]);
-        return true;
-    }
-
 private:
     /// @brief 速度（単位/秒）
     Vector3 velocity_{ 0.0f, 0.0f, 0.0f };
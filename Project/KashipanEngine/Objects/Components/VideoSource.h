@@ -23,10 +23,11 @@ namespace KashipanEngine {
 ///          可能性のある元のマテリアルアセット自体を書き換えないため）。停止時は元のマテリアルへ戻す。
 class VideoSource final : public IObjectComponent {
 public:
-    OBJECT_COMPONENT_CONSTRUCTOR(VideoSource, 0xFF,
-        ADD_MEMBER_VARIABLE_WITH_CALLBACK(videoAssetPath_, [this] { videoHandle_ = VideoManager::kInvalidHandle; });
+    OBJECT_COMPONENT_CONSTRUCTOR(VideoSource, 0xFF, )
+    OBJECT_COMPONENT_MEMBER_VARIABLES(VideoSource,
+        ADD_MEMBER_VARIABLE_WITH_CALLBACK(videoAssetPath_, [](auto &self) { self.videoHandle_ = VideoManager::kInvalidHandle; });
         ADD_MEMBER_VARIABLE(loop_);
-        ADD_MEMBER_VARIABLE_WITH_CALLBACK(volume_, [this] { volume_ = std::clamp(volume_, 0.0f, 1.0f); });
+        ADD_MEMBER_VARIABLE_WITH_CALLBACK(volume_, [](auto &self) { self.volume_ = std::clamp(self.volume_, 0.0f, 1.0f); });
         ADD_MEMBER_VARIABLE(playOnAwake_);
     )
     COMPONENT_CATEGORY("Video")
@@ -1,7 +1,10 @@
 #include "EmptyObject.h"
 #include "Objects/Components/Transform.h"
+#include "Scene/SceneBinaryComponentLoader.h"
 #include "Scene/SceneContext.h"
 
+#include <limits>
+
 namespace KashipanEngine {
 
 EmptyObject::EmptyObject(SceneContext *ownerSceneContext, const std::string &name) {
@@ -19,6 +22,11 @@ void EmptyObject::CopyStateFrom(Passkey<Scene>, const EmptyObject &source) {
     SetTag(source.tagName_);
     for (const auto &comp : source.components_) {
         if (!comp.first) continue;
+        // 状態が全てメンバー変数表にある型は、一時インスタンスとJSONを経由せずにプール上へ直接コピーする
+        if (comp.first->IsStateCoveredByMemberVariables()) {
+            AddComponentCopy(*comp.first);
+            continue;
+        }
         auto clonedComp = comp.first->Clone();
         if (!clonedComp) continue;
         // 派生クラスのCloneは基底クラスのタグを複製しないため、ここで引き継ぐ
@@ -64,6 +72,11 @@ size_t EmptyObject::HasComponent(const IObjectComponent *component) const {
 }
 
 IObjectComponent *EmptyObject::RegisterPlacedComponent(IObjectComponent *placed, size_t typeIndex) {
+    // Transformはワールド行列をシーンの階層表で管理するため、初期化より前に登録しておく
+    if (ownerSceneContext_ && typeIndex == IObjectComponent::GetComponentTypeID<Transform>()) {
+        static_cast<Transform *>(placed)->AttachHierarchy(Passkey<EmptyObject>(), &ownerSceneContext_->GetTransformHierarchy());
+    }
+    ++componentsGeneration_;
     if (componentsFreeIndices_.size() > 0) {
         size_t freeIndex = componentsFreeIndices_.back();
         componentsFreeIndices_.pop_back();
@@ -95,9 +108,9 @@ IObjectComponent *EmptyObject::AddComponent(std::unique_ptr<IObjectComponent> co
         return nullptr; // 同じ型のコンポーネントが最大数に達している場合は追加できない
     }
     // comp（渡された一時インスタンス）をそのままプールへムーブすることはしない。
-    // ADD_MEMBER_VARIABLE_WITH_CALLBACK等、コンストラクタで自分自身(this)への生ポインタを
-    // 登録するリフレクション機構があるため、ムーブするとそれらが古いアドレスを指したまま
-    // 破損する。代わりにプールの最終スロットへ直接デフォルト構築し、状態はJSON経由で転送する。
+    // メンバー変数の表は型ごとのオフセットで持つためムーブの影響を受けないが、コンポーネントには
+    // コンストラクタで自分自身(this)を捕まえるものがあり（ハンドラ登録等）、ムーブすると古いアドレスを
+    // 指したまま破損する。代わりにプールの最終スロットへ直接デフォルト構築し、状態はJSON経由で転送する。
     IComponentPoolBase *pool = ownerSceneContext_ ? ownerSceneContext_->GetOrCreateComponentPool(typeIndex) : nullptr;
     if (!pool) return nullptr;
     IObjectComponent *placed = pool->EmplaceDefault();
@@ -123,6 +136,42 @@ IObjectComponent *EmptyObject::AddComponentByTypeID(size_t typeIndex) {
     return RegisterPlacedComponent(placed, typeIndex);
 }
 
+IObjectComponent *EmptyObject::AddComponentCopy(const IObjectComponent &source) {
+    const size_t typeIndex = source.GetComponentTypeID();
+    if (typeIndex >= componentsIndexByType_.size()) {
+        componentsIndexByType_.resize(typeIndex + 1);
+    }
+    if (componentsIndexByType_[typeIndex].size() >= source.GetMaxComponentCountPerObject()) {
+        return nullptr; // 同じ型のコンポーネントが最大数に達している場合は追加できない
+    }
+    IComponentPoolBase *pool = ownerSceneContext_ ? ownerSceneContext_->GetOrCreateComponentPool(typeIndex) : nullptr;
+    if (!pool) return nullptr;
+    IObjectComponent *placed = pool->EmplaceDefault();
+    if (!placed) return nullptr;
+    placed->CopyStateFromInterface(Passkey<EmptyObject>(), source);
+    return RegisterPlacedComponent(placed, typeIndex);
+}
+
+bool EmptyObject::AddComponentFromSceneBinary(const SceneBinaryComponentLoader &loader, std::uint32_t componentIndex, size_t typeIndex) {
+    if (typeIndex >= componentsIndexByType_.size()) {
+        componentsIndexByType_.resize(typeIndex + 1);
+    }
+    IComponentPoolBase *pool = ownerSceneContext_ ? ownerSceneContext_->GetOrCreateComponentPool(typeIndex) : nullptr;
+    if (!pool) return false;
+    IObjectComponent *placed = pool->EmplaceDefault();
+    if (!placed) return false;
+    // 同じ型のコンポーネントが最大数に達している場合は、LoadFromJson と同じく追加せずに読み飛ばす
+    if (componentsIndexByType_[typeIndex].size() >= placed->GetMaxComponentCountPerObject()) {
+        pool->Remove(placed);
+        return true;
+    }
+    if (!loader.LoadDirect(componentIndex, *placed)) {
+        pool->Remove(placed);
+        return false;
+    }
+    return RegisterPlacedComponent(placed, typeIndex) != nullptr;
+}
+
 bool EmptyObject::RemoveComponent(const IObjectComponent *component) {
     if (component == nullptr) return false;
     auto it = componentsIndexByPointer_.find(component);
@@ -138,6 +187,7 @@ bool EmptyObject::RemoveComponent(const IObjectComponent *component) {
     componentsIndexByPointer_.erase(placed);
     componentsFreeIndices_.push_back(index);
     components_[index].first = nullptr;
+    ++componentsGeneration_;
     if (ownerSceneContext_) {
         if (IComponentPoolBase *pool = ownerSceneContext_->GetOrCreateComponentPool(typeIndex)) {
             pool->Remove(placed);
@@ -162,6 +212,7 @@ void EmptyObject::ClearComponents() {
     componentsIndexByPointer_.clear();
     componentsFreeIndices_.clear();
     nextAddedID_ = 0;
+    ++componentsGeneration_;
 }
 
 bool EmptyObject::IsActive() const {
@@ -258,26 +309,35 @@ JSON EmptyObject::SaveToJson(Passkey<Scene>) {
     return json;
 }
 
-bool EmptyObject::LoadFromJson(Passkey<Scene>, const JSON &json) {
-    ClearComponents();
+void EmptyObject::LoadObjectValuesFromJson(const JSON &json) {
     name_ = json.value("name", "EmptyObject");
     SetTag(json.value("tag", std::string{}));
     isActive_ = json.value("isActive", true);
     isEditorOnly_ = json.value("editorOnly", false);
     objectID_ = UUID128(json.value("objectID", ""));
     prefabNodeID_ = UUID128(json.value("prefabNodeID", ""));
+}
+
+IObjectComponent *EmptyObject::AddComponentBeforeLoad(const JSON &componentJson) {
+    std::string typeName = componentJson.value("type", "");
+    if (typeName.empty()) return nullptr;
+    auto comp = CreateObjectComponentByType(typeName);
+    // 追加時の初期化前にアクティブ状態を反映し、無効なコンポーネントの初期化を防ぐ
+    if (comp && componentJson.contains("data")) {
+        comp->SetActive(componentJson["data"].value("isActive", true));
+    }
+    return AddComponent(std::move(comp));
+}
+
+bool EmptyObject::LoadFromJson(Passkey<Scene>, const JSON &json) {
+    ClearComponents();
+    LoadObjectValuesFromJson(json);
     const auto &componentsJson = json.value("components", JSON::array());
     std::vector<std::pair<IObjectComponent *, JSON>> loadedComponents;
     // 先にコンポーネントを全て登録してからロードする
     for (const auto &compJson : componentsJson) {
-        std::string typeName = compJson.value("type", "");
-        if (typeName.empty()) continue;
-        auto comp = CreateObjectComponentByType(typeName);
-        // 追加時の初期化前にアクティブ状態を反映し、無効なコンポーネントの初期化を防ぐ
-        if (comp && compJson.contains("data")) {
-            comp->SetActive(compJson["data"].value("isActive", true));
-        }
-        loadedComponents.emplace_back(AddComponent(std::move(comp)), compJson["data"]);
+        if (compJson.value("type", "").empty()) continue;
+        loadedComponents.emplace_back(AddComponentBeforeLoad(compJson), compJson["data"]);
     }
     // 各コンポーネントにJSONデータをロードさせる
     for (const auto &compPair : loadedComponents) {
@@ -289,9 +349,35 @@ bool EmptyObject::LoadFromJson(Passkey<Scene>, const JSON &json) {
     return true;
 }
 
+bool EmptyObject::LoadFromSceneBinary(Passkey<Scene>, const JSON &objectValues, const SceneBinaryComponentLoader &loader, std::uint32_t objectIndex) {
+    ClearComponents();
+    LoadObjectValuesFromJson(objectValues);
+    const SceneBinaryReader &reader = loader.GetReader();
+    std::vector<std::pair<IObjectComponent *, JSON>> loadedComponents;
+    for (std::uint32_t slot = 0, count = reader.GetObjectComponentCount(objectIndex); slot < count; ++slot) {
+        const auto componentIndex = reader.GetObjectComponentIndex(objectIndex, slot);
+        if (!componentIndex) return false;
+        // 直接読み込める種別は値を書き込んでから登録するため、後からロードする必要がない
+        if (const auto typeID = loader.FindDirectTypeID(*componentIndex)) {
+            if (!AddComponentFromSceneBinary(loader, *componentIndex, *typeID)) return false;
+            continue;
+        }
+        JSON compJson = reader.DecodeComponent(*componentIndex);
+        if (!compJson.is_object()) return false;
+        if (compJson.value("type", "").empty()) continue;
+        IObjectComponent *comp = AddComponentBeforeLoad(compJson);
+        loadedComponents.emplace_back(comp, std::move(compJson["data"]));
+    }
+    // JSONを経由する種別は LoadFromJson と同じく、全コンポーネントの登録後にロードする
+    for (const auto &[comp, compJson] : loadedComponents) {
+        if (comp) comp->LoadFromJsonInterface(Passkey<EmptyObject>(), compJson);
+    }
+    return true;
+}
+
 void EmptyObject::Initialize() {
-    // アクティブなコンポーネントを優先度順に初期化する
-    RegenerateUpdateComponentsList();
+    // アクティブなコンポーネントを優先度順に初期化する（バッチ処理対象の型もUpdate以外は個別に呼ぶ）
+    RegenerateUpdateComponentsList(true);
     for (auto &compPair : updateComponents_) {
         if (compPair.component) {
             compPair.component->InitializeInterface(Passkey<EmptyObject>(), objectContext_.get(), ownerSceneContext_);
@@ -306,7 +392,7 @@ void EmptyObject::Initialize() {
 }
 
 void EmptyObject::Finalize() {
-    RegenerateUpdateComponentsList();
+    RegenerateUpdateComponentsList(true);
     for (auto &compPair : updateComponents_) {
         if (compPair.component) {
             compPair.component->FinalizeInterface(Passkey<EmptyObject>());
@@ -315,8 +401,16 @@ void EmptyObject::Finalize() {
 }
 
 void EmptyObject::Update() {
-    RegenerateUpdateComponentsList();
-    for (const auto &info : updateComponents_) {
+    Update(std::numeric_limits<int>::min(), std::numeric_limits<int>::max());
+}
+
+void EmptyObject::Update(int minPriority, int maxPriority) {
+    if (minPriority == std::numeric_limits<int>::min()) RegenerateUpdateComponentsList();
+    // updateComponents_ は優先度順に並んでいるため、区間の先頭から末尾までだけを走査する
+    auto first = std::lower_bound(updateComponents_.begin(), updateComponents_.end(), minPriority,
+        [](const UpdateComponentInfo &info, int priority) { return info.priority < priority; });
+    for (auto itInfo = first; itInfo != updateComponents_.end() && itInfo->priority <= maxPriority; ++itInfo) {
+        const auto &info = *itInfo;
         // 先に更新されたコンポーネントが後続コンポーネントを削除する場合があるため、
         // 呼び出し直前に所有状態・追加時ID・アクティブ状態を再確認する。
         const auto it = componentsIndexByPointer_.find(info.component);
@@ -330,17 +424,15 @@ void EmptyObject::Update() {
     }
 }
 
-void EmptyObject::RegenerateUpdateComponentsList() {
+void EmptyObject::RegenerateUpdateComponentsList(bool includeBatchProcessed) {
     updateComponents_.clear();
     updateComponents_.reserve(components_.size());
     // バッチ処理対象の型が1つも登録されていなければ、型ごとのハッシュ検索そのものを省略する
-    // （現時点ではどの型もマークされていないため、毎フレーム・全コンポーネントに対する
-    //   無駄なハッシュ検索を避けるための早期リターン）
-    const bool hasBatchProcessedTypes = HasAnyBatchProcessedObjectComponentType();
+    const bool skipBatchProcessed = !includeBatchProcessed && HasAnyBatchProcessedObjectComponentType();
     for (const auto &comp : components_) {
         if (!comp.first || !comp.first->IsActive()) continue;
-        // バッチ処理対象としてマークされた型は、個別Updateの対象から除外する
-        if (hasBatchProcessedTypes && IsObjectComponentTypeIDBatchProcessed(comp.first->GetComponentTypeID())) continue;
+        // バッチ処理対象としてマークされた型は、Scene側で型ごとに一括更新されるため個別Updateの対象から除外する
+        if (skipBatchProcessed && IsObjectComponentTypeIDBatchProcessed(comp.first->GetComponentTypeID())) continue;
         updateComponents_.push_back({ comp.second, comp.first->GetUpdatePriority(), comp.first });
     }
     // 優先度->追加順の昇順でソート
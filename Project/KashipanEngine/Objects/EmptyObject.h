@@ -1,5 +1,6 @@
 #pragma once
 #include <algorithm>
+#include <cstdint>
 #include "Objects/IObjectComponent.h"
 #include "Objects/ComponentPool.h"
 #include "Math/Matrix4x4.h"
@@ -12,6 +13,7 @@ namespace KashipanEngine {
 class ObjectContext;
 class SceneContext;
 class Scene;
+class SceneBinaryComponentLoader;
 
 /// @brief 空オブジェクトクラス
 class EmptyObject final {
@@ -35,6 +37,10 @@ public:
     void InitializeInterface(Passkey<Scene>) { Initialize(); }
     void FinalizeInterface(Passkey<Scene>) { Finalize(); }
     void UpdateInterface(Passkey<Scene>) { Update(); }
+    /// @brief 優先度が [minPriority, maxPriority] のコンポーネントだけを更新する
+    /// @details Scene がバッチ処理対象の型の一括更新を優先度の並びの途中に挟むため、1フレームの更新を優先度で分割して呼ぶ。
+    ///          更新対象のリストは minPriority が INT_MIN の呼び出し（そのフレームの最初の区間）でだけ作り直す
+    void UpdateInterface(Passkey<Scene>, int minPriority, int maxPriority) { Update(minPriority, maxPriority); }
 
     void SetName(const std::string &name) { name_ = name; }
     const std::string &GetName() const { return name_; }
@@ -129,6 +135,8 @@ public:
 
     /// @brief 全コンポーネントの取得（コンポーネント本体と追加順のペアのリスト。本体はSceneのプールが所有する非所有ポインタ）
     const std::vector<std::pair<IObjectComponent *, size_t>> &GetAllComponents() const { return components_; }
+    /// @brief コンポーネント構成の世代（追加・削除のたびに進む。解決済みのコンポーネント参照の失効判定に使う）
+    std::uint32_t GetComponentsGeneration() const noexcept { return componentsGeneration_; }
 
     //==================================================
     // コンポーネント追加系メソッド
@@ -254,6 +262,12 @@ public:
     JSON SaveToJson(Passkey<Scene>);
     /// @brief オブジェクト情報をjsonから読み込み
     bool LoadFromJson(Passkey<Scene>, const JSON &json);
+    /// @brief オブジェクト情報をバイナリシーンから読み込み
+    /// @details 直接読み込める種別（SceneBinaryComponentLoader::FindDirectTypeID）のコンポーネントは、
+    ///          プールへ配置した後に行の値を書き込んでから登録する。それ以外は LoadFromJson と同じくJSONから読み込む
+    /// @return コンポーネントの番号・行・JSONのいずれかが壊れている場合は false（途中まで追加したコンポーネントは残る）
+    /// @param objectValues components を除いたオブジェクトの値（SceneBinaryReader::DecodeObjectValues）
+    bool LoadFromSceneBinary(Passkey<Scene>, const JSON &objectValues, const SceneBinaryComponentLoader &loader, std::uint32_t objectIndex);
 
     //==================================================
     // コンポーネント単体のJSONスナップショット（エディターのUndo/Redo用）
@@ -312,11 +326,24 @@ private:
     void Initialize();
     void Finalize();
     void Update();
-    void RegenerateUpdateComponentsList();
+    void Update(int minPriority, int maxPriority);
+    /// @brief 更新対象（アクティブなコンポーネント）を優先度->追加順に並べ直す
+    /// @param includeBatchProcessed バッチ処理対象の型も含めるか（Initialize/Finalize用。Updateでは除外する）
+    void RegenerateUpdateComponentsList(bool includeBatchProcessed = false);
     /// @brief シーン内から自身の子孫オブジェクトを探し、変更前の実効アクティブ状態を記録する（SetActive用）
     void CollectDescendantsActiveState(std::vector<std::pair<EmptyObject *, bool>> &out) const;
     /// @brief プールへ配置済みのコンポーネントを、このオブジェクトのローカルな管理台帳（空きスロット再利用含む）へ登録する
     IObjectComponent *RegisterPlacedComponent(IObjectComponent *placed, size_t typeIndex);
+    /// @brief 同じ型のコンポーネントをプールへ直接デフォルト構築し、メンバー変数表で状態をコピーしてから登録する
+    /// @details 状態が全てメンバー変数表に登録されている型（IsStateCoveredByMemberVariables）の複製用
+    IObjectComponent *AddComponentCopy(const IObjectComponent &source);
+    /// @brief 型のコンポーネントをプールへ直接デフォルト構築し、バイナリシーンの行の値を書き込んでから登録する
+    /// @return 行が壊れている場合は false（同じ型が最大数に達していて追加しなかった場合は true）
+    bool AddComponentFromSceneBinary(const SceneBinaryComponentLoader &loader, std::uint32_t componentIndex, size_t typeIndex);
+    /// @brief 名前・タグ・アクティブ状態・ID等、コンポーネント以外の情報をjsonから読み込む
+    void LoadObjectValuesFromJson(const JSON &json);
+    /// @brief 保存されたコンポーネント（type と data）を追加する（data の読み込みは全コンポーネントの追加後に行う）
+    IObjectComponent *AddComponentBeforeLoad(const JSON &componentJson);
 
     std::string name_ = "EmptyObject";
     /// @brief タグ（比較用ハッシュ）と表示・保存用のタグ文字列
@@ -329,6 +356,7 @@ private:
     std::unordered_map<const IObjectComponent *, size_t> componentsIndexByPointer_;
     std::vector<size_t> componentsFreeIndices_;
     size_t nextAddedID_ = 0;
+    std::uint32_t componentsGeneration_ = 0;
 
     struct UpdateComponentInfo {
         size_t addedID;
@@ -1,12 +1,20 @@
 #pragma once
 #include <string>
 #include <memory>
+#include <atomic>
 #include <cassert>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <span>
+#include <string_view>
 #include <type_traits>
+#include <unordered_map>
+#include <vector>
 #include "Utilities/FileIO.h"
 #include "ComponentSerialize/ComponentRegistry.h"
+#include "ComponentSerialize/SerializedLayout.h"
+#include "Objects/ComponentBatch.h"
 #include "Objects/ComponentRef.h"
 #include "Utilities/MyAny.h"
 #include "Utilities/Tag.h"
@@ -20,21 +28,9 @@ namespace KashipanEngine {
 class EmptyObject;
 class ObjectContext;
 class SceneContext;
-
-/// @brief コンポーネントが型ごとの一括更新（バッチ処理）対象かどうかを判定するトレイト
-/// @details クラスに public static な constexpr bool IsBatchProcessed() が定義されていればそれを使い、
-///          未定義の場合はバッチ処理対象外（オブジェクト単位で個別にUpdateが呼ばれる、今まで通りの動作）として扱う。
-///          バッチ処理対象とマークされた型は EmptyObject::RegenerateUpdateComponentsList() で
-///          個別Update呼び出しの対象から除外される。ただし現時点ではこの仕組みの土台のみで、
-///          Scene側で型ごとに一括更新を回す実装は存在しない（どの型もまだこのフラグをtrueにしていない）。
-template <typename T, typename = void>
-struct ComponentBatchTraits {
-    static constexpr bool kIsBatchProcessed = false;
-};
-template <typename T>
-struct ComponentBatchTraits<T, std::void_t<decltype(T::IsBatchProcessed())>> {
-    static constexpr bool kIsBatchProcessed = T::IsBatchProcessed();
-};
+class SceneBinaryComponentLoader;
+template <typename Self>
+class MemberVariableTableBuilder;
 
 /// @brief オブジェクトコンポーネントインターフェースクラス
 /// @details 派生クラスは COMPONENT_CATEGORY マクロ（または public static な
@@ -42,25 +38,70 @@ struct ComponentBatchTraits<T, std::void_t<decltype(T::IsBatchProcessed())>> {
 ///          カテゴリは階層構造（例: {"Collision", "Collider"}）で、
 ///          Add Component メニューにてカテゴリごとのツリーで表示される。
 class IObjectComponent {
-    /// @brief コンポーネントの型ID設定用
-    static inline size_t sComponentTypeID = 0;
+    /// @brief コンポーネントの型ID設定用（コンストラクター内の登録で、実行中に別々のスレッドから採番される場合がある）
+    static inline std::atomic<size_t> sComponentTypeID = 0;
 public:
-    /// @brief メンバー変数の情報（ImGuiやKeyFrameAnimator等の外部からのアクセス用）
+    /// @brief メンバー変数への書き込み後に呼ぶコールバック（対象のコンポーネントを受け取る）
+    using MemberModifiedCallback = void (*)(IObjectComponent &component);
+
+    /// @brief メンバー変数の実体のアドレスを、対象のコンポーネントから求める関数
+    using MemberAccessor = void *(*)(IObjectComponent &component);
+
+    /// @brief メンバー変数の保存キーとインスペクターでの表示（ADD_SERIALIZED_MEMBER_VARIABLE で指定する）
+    /// @details 指定したメンバー変数は、SaveToJson/LoadFromJson/ShowImGui を上書きしない型では
+    ///          メンバー変数表から保存・読み込み・表示される
+    struct MemberAttributes {
+        /// @brief 保存時のJSONのキー（空の場合は保存・読み込みしない）
+        std::string serializedKey;
+        /// @brief インスペクターに表示する名前の翻訳キー（空の場合は表示しない）
+        std::string labelKey;
+        /// @brief インスペクターでの変化速度・範囲・書式（ImGuiCustom::UiOptions と同じ意味。範囲が両方0なら制限なし）
+        float dragSpeed = 1.0f;
+        float minValue = 0.0f;
+        float maxValue = 0.0f;
+        const char *format = nullptr;
+    };
+
+    /// @brief メンバー変数の情報（ParameterBinding等の外部からのアクセス用）
+    /// @details コンポーネントの型ごとに1つの表（登録順）として共有され、インスタンスは何も持たない。
+    ///          実体のアドレスは GetAddress() で、型ごとに生成されたアクセス関数を使って求める
     struct MemberVariable {
-        void *ptr = nullptr;
+        std::string name;
         TypeInfo typeInfo;
-        /// @brief 外部からptr経由で値を書き込んだ後に呼ぶコールバック（未設定の場合はnullptr）
+        /// @brief 対象のコンポーネントからメンバー変数のアドレスを求める関数
+        MemberAccessor accessor = nullptr;
+        /// @brief 外部から値を直接書き込んだ後に呼ぶコールバック（未設定の場合はnullptr）
         /// @details セッターを迂回した直接書き込みで必要になる副作用（Transformのワールド行列
         ///          キャッシュ無効化など）を、コンポーネント側がここに登録しておく。
-        ///          外部から値を書き込んだ側は、書き込み後に必ずこれを呼ぶこと
-        std::function<void()> onModified;
+        ///          外部から値を書き込んだ側は、書き込み後に必ず NotifyModified() を呼ぶこと
+        MemberModifiedCallback onModified = nullptr;
+        MemberAttributes attributes;
+        /// @brief 値をJSONへ保存・JSONから読み込む関数（保存キーが無い場合は nullptr）
+        JSON (*saveValue)(const void *address) = nullptr;
+        void (*loadValue)(void *address, const JSON &json) = nullptr;
+        /// @brief 保存した値のメモリ上の並び（バイナリシーンから直接書き込む際に使う。保存キーが無い場合は None）
+        SerializedLayout serializedLayout;
+        /// @brief 同じ型のコンポーネントのメンバー変数どうしで値をコピーする関数
+        void (*copyValue)(void *destination, const void *source) = nullptr;
+#if defined(USE_IMGUI)
+        /// @brief インスペクターで値を編集する関数（表示名が無い場合は nullptr）
+        /// @return 値が変更された場合は true
+        bool (*editValue)(const char *label, void *address, const MemberAttributes &attributes) = nullptr;
+#endif
+
+        void *GetAddress(IObjectComponent &component) const {
+            return accessor(component);
+        }
+        void NotifyModified(IObjectComponent &component) const {
+            if (onModified) onModified(component);
+        }
     };
     /// @brief コンポーネントの型IDを取得
     /// @tparam T コンポーネントの型
     /// @return コンポーネントの型ID
     template<typename T>
     static size_t GetComponentTypeID() {
-        static size_t typeID = sComponentTypeID++;
+        static const size_t typeID = sComponentTypeID.fetch_add(1, std::memory_order_relaxed);
         return typeID;
     }
 
@@ -152,28 +193,67 @@ public:
         return true;
     }
 
-    /// @brief メンバ変数の取得（外部からの汎用アクセス用。ptr経由で書き込んだ後は必ずonModifiedを呼ぶこと）
+    /// @brief メンバ変数の取得（外部からの汎用アクセス用。GetAddress経由で書き込んだ後は必ずNotifyModifiedを呼ぶこと）
     /// @param key 変数のキー
     /// @return メンバー変数の情報（存在しない場合は nullptr）
-    MemberVariable *GetMemberVariable(const std::string &key) {
-        auto it = memberVariables_.find(key);
-        if (it != memberVariables_.end()) {
-            return &it->second;
-        }
-        return nullptr;
-    }
+    const MemberVariable *GetMemberVariable(const std::string &key) const;
     /// @brief 全てのメンバー変数の取得
-    /// @return メンバー変数のマップ
-    const std::unordered_map<std::string, MemberVariable> &GetAllMemberVariables() const {
-        return memberVariables_;
+    /// @return メンバー変数の一覧（登録順。同じ型のコンポーネントで共有される）
+    std::span<const MemberVariable> GetAllMemberVariables() const;
+    /// @brief コンポーネントの状態が全てメンバー変数表に登録されているか（MEMBER_VARIABLES_COVER_ALL_STATE）
+    /// @details true の型は、オブジェクトの複製で Clone とJSONを経由せず、表からプール上へ直接コピーされる。
+    ///          バイナリシーンからの読み込みでも、保存キーを指定した変数へ列の値が直接書き込まれる
+    bool IsStateCoveredByMemberVariables() const;
+    /// @brief 同じ型のコンポーネントから、優先度・アクティブ状態・タグとメンバー変数表の全変数をコピーする
+    /// @details 所属オブジェクトへ登録する前（初期化前）に呼ぶこと
+    void CopyStateFromInterface(Passkey<EmptyObject>, const IObjectComponent &source);
+    /// @brief 優先度・アクティブ状態・タグを設定する（LoadFromJsonInterface と同じく、初期化・終了処理は走らせない）
+    /// @details バイナリシーンからメンバー変数表へ直接読み込む際に、所属オブジェクトへ登録する前に呼ばれる
+    void LoadBaseStateInterface(Passkey<SceneBinaryComponentLoader>, int priority, bool isActive, const std::string &tagName) {
+        updatePriority_ = priority;
+        isActive_ = isActive;
+        SetTag(tagName);
     }
 
+    /// @brief 型Tのメンバー変数表を作って登録する（REGISTER_COMPONENT_OBJECT から型ごとに1回だけ呼ばれる）
+    /// @details T::RegisterMemberVariables に表の組み立て役を渡して登録内容を集める。
+    ///          名前空間スコープの REGISTER_COMPONENT_OBJECT では静的初期化の間に、コンストラクター内
+    ///          （OBJECT_COMPONENT_CONSTRUCTOR）だけで登録される型では最初の生成時に実行中のスレッドから呼ばれる。
+    ///          表は型IDごとの固定の位置に一度だけ書き込まれ、書き終わるまで GetMemberVariable 等からは見えないため、
+    ///          他の型の表を読んでいるスレッドと並行して登録しても構わない
+    template <typename T>
+    static void RegisterMemberVariableTable();
+
+    /// @brief メンバー変数を登録する（登録するメンバーを持つ派生クラスは OBJECT_COMPONENT_MEMBER_VARIABLES で隠す）
+    template <typename Self>
+    static void RegisterMemberVariables(MemberVariableTableBuilder<Self> &builder) { (void)builder; }
+
 protected:
     IObjectComponent(const std::string &typeName, size_t maxCount, size_t componentTypeID)
         : kComponentType_(typeName), kMaxComponentCountPerObject_(maxCount), kComponentTypeID_(componentTypeID), updatePriority_(1) {}
 #define OBJECT_COMPONENT_CONSTRUCTOR(typeName, maxCount, initializeCode) \
     typeName() : IObjectComponent(#typeName, maxCount, GetComponentTypeID<typeName>()) { REGISTER_COMPONENT_OBJECT(typeName); initializeCode }
 
+    /// @brief 保存キーを指定したメンバー変数をJSONへ保存する（SaveToJson の既定の動作）
+    JSON SaveMemberVariablesToJson() const;
+    /// @brief 保存キーを指定したメンバー変数をJSONから読み込む（LoadFromJson の既定の動作）
+    /// @details JSONに含まれないキーの変数は変更しない。読み込んだ変数の書き込み後コールバックを呼ぶ
+    void LoadMemberVariablesFromJson(const JSON &json);
+    /// @brief 同じ型のコンポーネントからメンバー変数表の全変数をコピーし、書き込み後コールバックを呼ぶ
+    void CopyMemberVariablesFrom(const IObjectComponent &source);
+#if defined(USE_IMGUI)
+    /// @brief 表示名を指定したメンバー変数をインスペクターに表示する（ShowImGui の既定の動作）
+    /// @return 表示したメンバー変数が1つも無い場合は false
+    bool ShowMemberVariablesImGui();
+#endif
+    /// @brief メンバー変数表を使って複製する（MEMBER_VARIABLES_COVER_ALL_STATE を指定した型の Clone 用）
+    template <typename T>
+    std::unique_ptr<IObjectComponent> CloneByMemberVariables() const {
+        auto ptr = std::make_unique<T>();
+        ptr->CopyMemberVariablesFrom(*this);
+        return ptr;
+    }
+
     /// @brief 初期化処理
     virtual void Initialize() {}
     /// @brief 終了処理
@@ -184,7 +264,9 @@ protected:
 #if defined(USE_IMGUI)
     /// @brief ImGui 表示（ウィンドウの Begin/End は呼ばない）
     virtual void ShowImGui() {
-        ImGui::Text("%s", TranslationC("component.iobjectcomponent.none"));
+        if (!ShowMemberVariablesImGui()) {
+            ImGui::Text("%s", TranslationC("component.iobjectcomponent.none"));
+        }
     }
     /// @brief 常時ImGui表示（ビューアウィンドウ等、ポーズ中も表示し続けたいものに使う）
     virtual void ShowPersistentImGui() {}
@@ -192,35 +274,17 @@ protected:
 
     /// @brief コンポーネント情報をjsonへ保存
     /// @return コンポーネント情報を含むjsonオブジェクトを返す。保存する情報がない場合は空のjsonオブジェクトを返す
-    virtual JSON SaveToJson() const { return JSON::object(); }
+    virtual JSON SaveToJson() const { return SaveMemberVariablesToJson(); }
     /// @brief jsonからコンポーネント情報を読み込み
     /// @param json コンポーネント情報を含むjsonオブジェクト
     /// @return 成功した場合はtrue、失敗した場合はfalseを返す。読み込む情報がない場合は true を返す
-    virtual bool LoadFromJson(const JSON &json) { (void)json; return true; }
+    virtual bool LoadFromJson(const JSON &json) { LoadMemberVariablesFromJson(json); return true; }
 
     /// @brief 所属オブジェクトのコンテキストを取得
     ObjectContext *GetOwnerObjectContext() const { return objectContext_; }
     /// @brief 所属オブジェクトのシーンのコンテキストを取得
     SceneContext *GetOwnerSceneContext() const { return sceneContext_; }
 
-    /// @brief メンバー変数を追加する
-    /// @param key 変数のキー
-    /// @param variable メンバー変数の情報
-    void AddMemberVariable(const std::string &key, const MemberVariable &variable) {
-        memberVariables_.insert_or_assign(key, variable);
-    }
-    /// @brief メンバー変数を追加する
-    /// @tparam T 変数の型
-    /// @param key 変数のキー
-    /// @param variable 変数のポインタ
-    /// @param onModified 外部からptr経由で値を書き込まれた後に呼ばれるコールバック
-    ///                   （セッター迂回時に必要な副作用がある場合のみ指定する）
-    template <typename T>
-    void AddMemberVariable(const std::string &key, T *variable, std::function<void()> onModified = nullptr) {
-        memberVariables_.insert_or_assign(key, MemberVariable{ static_cast<void *>(variable), GetValueType<T>(), std::move(onModified) });
-    }
-#define ADD_MEMBER_VARIABLE(var) AddMemberVariable(#var, &var)
-#define ADD_MEMBER_VARIABLE_WITH_CALLBACK(var, ...) AddMemberVariable(#var, &var, __VA_ARGS__)
 
 private:
     /// @brief コンポーネントの種類名
@@ -243,8 +307,141 @@ private:
     Tag tag_;
     std::string tagName_;
 
-    /// @brief メンバー変数のマップ（ImGuiなどからアクセスするための汎用的な変数格納用）
-    std::unordered_map<std::string, MemberVariable> memberVariables_;
+    /// @brief 型IDのメンバー変数表を設定する（RegisterMemberVariableTableから呼ばれる）
+    static void SetMemberVariableTable(size_t componentTypeID, std::vector<MemberVariable> variables, bool coversAllState);
+};
+
+/// @brief コンポーネント型1つ分のメンバー変数表を組み立てる（RegisterMemberVariables へ渡される）
+/// @tparam Self 表を作る対象のコンポーネントの型（基底クラスの登録関数へ渡しても、具体的な型のまま）
+template <typename Self>
+class MemberVariableTableBuilder final {
+public:
+    /// @brief メンバー変数を追加する
+    /// @param key 変数のキー（同じキーを再登録した場合は上書きされる）
+    /// @param accessor 対象のコンポーネントを受け取り、変数のアドレスを返すキャプチャを持たないラムダ
+    ///                 （例: [](auto &self) { return &self.value_; }）
+    template <typename Accessor>
+    void Add(std::string_view key, Accessor accessor) {
+        AddImpl<Accessor>(key, nullptr);
+        (void)accessor;
+    }
+    /// @brief 書き込み後コールバック付きでメンバー変数を追加する
+    /// @param onModified 外部から値を直接書き込まれた後に呼ばれるコールバック。型ごとに共有されるため
+    ///                   キャプチャを持たないラムダで、対象を引数で受け取る（例: [](auto &self) { self.MarkDirty(); }）
+    template <typename Accessor, typename Callback>
+    void Add(std::string_view key, Accessor accessor, Callback onModified) {
+        static_assert(std::is_empty_v<Callback> && std::is_default_constructible_v<Callback>,
+            "onModified must be a captureless lambda that takes the component, e.g. [](auto &self) { ... }");
+        AddImpl<Accessor>(key, [](IObjectComponent &component) { Callback{}(static_cast<Self &>(component)); });
+        (void)accessor;
+        (void)onModified;
+    }
+    /// @brief 保存キー・インスペクターでの表示を指定してメンバー変数を追加する
+    template <typename Accessor>
+    void AddSerialized(std::string_view key, Accessor accessor, IObjectComponent::MemberAttributes attributes) {
+        AddImpl<Accessor, true>(key, nullptr, std::move(attributes));
+        (void)accessor;
+    }
+    /// @brief 保存キー・インスペクターでの表示と書き込み後コールバックを指定してメンバー変数を追加する
+    /// @details コールバックは読み込み・複製・インスペクターでの変更の後にも呼ばれる
+    template <typename Accessor, typename Callback>
+    void AddSerialized(std::string_view key, Accessor accessor, IObjectComponent::MemberAttributes attributes, Callback onModified) {
+        static_assert(std::is_empty_v<Callback> && std::is_default_constructible_v<Callback>,
+            "onModified must be a captureless lambda that takes the component, e.g. [](auto &self) { ... }");
+        AddImpl<Accessor, true>(key, [](IObjectComponent &component) { Callback{}(static_cast<Self &>(component)); }, std::move(attributes));
+        (void)accessor;
+        (void)onModified;
+    }
+    /// @brief 登録したメンバー変数がコンポーネントの状態の全てであることを示す（MEMBER_VARIABLES_COVER_ALL_STATE）
+    void MarkCoversAllState() { coversAllState_ = true; }
+
+    /// @brief 組み立てた表を取り出す
+    std::vector<IObjectComponent::MemberVariable> TakeVariables() { return std::move(variables_); }
+    bool CoversAllState() const noexcept { return coversAllState_; }
+
+private:
+    /// @tparam kHasAttributes 保存・表示用の関数を作るか（AddSerialized の場合だけ、値の型にJSON変換・編集UIを求める）
+    template <typename Accessor, bool kHasAttributes = false>
+    void AddImpl(std::string_view key, IObjectComponent::MemberModifiedCallback onModified, IObjectComponent::MemberAttributes attributes = {}) {
+        static_assert(std::is_empty_v<Accessor> && std::is_default_constructible_v<Accessor>,
+            "accessor must be a captureless lambda that returns the member address, e.g. [](auto &self) { return &self.value_; }");
+        using Pointer = decltype(Accessor{}(std::declval<Self &>()));
+        static_assert(std::is_pointer_v<Pointer>, "accessor must return a pointer to the member variable");
+        using T = std::remove_cv_t<std::remove_pointer_t<Pointer>>;
+
+        IObjectComponent::MemberVariable member{
+            std::string(key),
+            GetValueType<T>(),
+            [](IObjectComponent &component) -> void * {
+                return const_cast<T *>(Accessor{}(static_cast<Self &>(component)));
+            },
+            onModified,
+            std::move(attributes),
+        };
+        static_assert(std::is_copy_assignable_v<T>, "member variables must be copy assignable");
+        member.copyValue = [](void *destination, const void *source) {
+            *static_cast<T *>(destination) = *static_cast<const T *>(source);
+        };
+        if constexpr (kHasAttributes) {
+            if (!member.attributes.serializedKey.empty()) {
+                member.saveValue = [](const void *address) -> JSON { return ToJSON(*static_cast<const T *>(address)); };
+                member.loadValue = [](void *address, const JSON &json) { *static_cast<T *>(address) = FromJSON<T>(json); };
+                member.serializedLayout = GetSerializedLayout<T>();
+            }
+#if defined(USE_IMGUI)
+            if (!member.attributes.labelKey.empty()) {
+                member.editValue = [](const char *label, void *address, const IObjectComponent::MemberAttributes &attributes) {
+                    ImGuiCustom::UiOptions options;
+                    options.vSpeed = attributes.dragSpeed;
+                    options.vMin = attributes.minValue;
+                    options.vMax = attributes.maxValue;
+                    options.format = attributes.format;
+                    return ImGuiCustom::EditValue(label, *static_cast<T *>(address), options);
+                };
+            }
+#endif
+        }
+        // 同じキーの再登録は上書き（従来のinsert_or_assignと同じ）
+        for (auto &registered : variables_) {
+            if (registered.name == member.name) {
+                registered = std::move(member);
+                return;
+            }
+        }
+        variables_.push_back(std::move(member));
+    }
+
+    std::vector<IObjectComponent::MemberVariable> variables_;
+    bool coversAllState_ = false;
 };
 
+template <typename T>
+void IObjectComponent::RegisterMemberVariableTable() {
+    MemberVariableTableBuilder<T> builder;
+    T::RegisterMemberVariables(builder);
+    const bool coversAllState = builder.CoversAllState();
+    SetMemberVariableTable(GetComponentTypeID<T>(), builder.TakeVariables(), coversAllState);
+}
+
+/// @brief メンバー変数の登録関数を定義する（クラス定義内の public 部に書く）
+/// @details 中では ADD_MEMBER_VARIABLE 系のマクロで自身のメンバー変数を登録する。
+///          登録関数は型ごとに1回だけ、REGISTER_COMPONENT_OBJECT から呼ばれる
+#define OBJECT_COMPONENT_MEMBER_VARIABLES(typeName, registrationCode) \
+    static void RegisterMemberVariables(::KashipanEngine::MemberVariableTableBuilder<typeName> &builder) { registrationCode }
+/// @brief メンバー変数を登録する（RegisterMemberVariables の中で使う）
+#define ADD_MEMBER_VARIABLE(var) builder.Add(#var, [](auto &self) { return &self.var; })
+/// @brief 書き込み後コールバック付きでメンバー変数を登録する（RegisterMemberVariables の中で使う）
+#define ADD_MEMBER_VARIABLE_WITH_CALLBACK(var, ...) builder.Add(#var, [](auto &self) { return &self.var; }, __VA_ARGS__)
+/// @brief キーを指定してメンバー変数を登録する（変数の式とキーを変えたい場合に使う）
+#define ADD_NAMED_MEMBER_VARIABLE_WITH_CALLBACK(key, var, ...) builder.Add(key, [](auto &self) { return &self.var; }, __VA_ARGS__)
+/// @brief 保存キー・インスペクターでの表示（IObjectComponent::MemberAttributes）を指定してメンバー変数を登録する
+/// @details 例: ADD_SERIALIZED_MEMBER_VARIABLE(speed_, { .serializedKey = "speed", .labelKey = "component.xxx.speed", .dragSpeed = 0.01f });
+///          続けて書き込み後コールバックも渡せる
+#define ADD_SERIALIZED_MEMBER_VARIABLE(var, ...) builder.AddSerialized(#var, [](auto &self) { return &self.var; }, __VA_ARGS__)
+/// @brief 登録したメンバー変数がコンポーネントの状態の全てであることを示す（RegisterMemberVariables の中で使う）
+/// @details 指定した型はオブジェクトの複製で Clone を使わず、表の変数だけをコピーする。
+///          バイナリシーン（.kscene）からは、SaveToJson/LoadFromJson を経由せず保存キーを指定した変数へ直接読み込む。
+///          表に無い状態（キャッシュ以外）を持つ型や、保存・読み込みを独自に実装する型には指定しないこと
+#define MEMBER_VARIABLES_COVER_ALL_STATE() builder.MarkCoversAllState()
+
 } // namespace KashipanEngine
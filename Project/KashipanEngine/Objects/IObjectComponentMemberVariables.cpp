@@ -0,0 +1,135 @@
+// IObjectComponent のメンバー変数表（型ごとのリフレクション情報）の実装
+// EmptyObject/ObjectContext に依存しないよう、IObjectComponent.cpp から分けている
+#include "IObjectComponent.h"
+
+#include <array>
+#include <atomic>
+
+namespace KashipanEngine {
+
+namespace {
+
+/// @brief メンバー変数表を持てるコンポーネント型の数の上限
+constexpr size_t kMaxComponentTypeCount = 1024;
+
+/// @brief コンポーネント型1つ分のメンバー変数表
+struct MemberVariableTable {
+    /// @brief 表の状態（未登録 → 書き込み中 → 登録済み）
+    enum class State : uint8_t {
+        Empty,
+        Writing,
+        Ready,
+    };
+
+    std::vector<IObjectComponent::MemberVariable> variables;
+    std::unordered_map<std::string, size_t> indexByName;
+    /// @brief 登録した変数がコンポーネントの状態の全てか（MEMBER_VARIABLES_COVER_ALL_STATE）
+    bool coversAllState = false;
+    /// @brief Ready になった後は表を書き換えないため、読み取り側は Ready を確かめた後はロック無しで読める
+    std::atomic<State> state{ State::Empty };
+};
+
+/// @brief コンポーネントの型IDごとのメンバー変数表
+/// @details REGISTER_COMPONENT_OBJECT はコンストラクター内の静的変数としても展開されるため、名前空間スコープで
+///          登録されない型は最初の生成時（他のスレッドが別の型の表を読んでいる最中）に登録される。
+///          そのため配列は固定長で確保して要素を動かさず、型ごとに一度だけ書き込んでから Ready にする
+std::array<MemberVariableTable, kMaxComponentTypeCount> &GetMemberVariableTables() {
+    static std::array<MemberVariableTable, kMaxComponentTypeCount> tables;
+    return tables;
+}
+
+const MemberVariableTable *FindMemberVariableTable(size_t componentTypeID) {
+    if (componentTypeID >= kMaxComponentTypeCount) return nullptr;
+    const MemberVariableTable &table = GetMemberVariableTables()[componentTypeID];
+    return table.state.load(std::memory_order_acquire) == MemberVariableTable::State::Ready ? &table : nullptr;
+}
+
+} // namespace
+
+void IObjectComponent::SetMemberVariableTable(size_t componentTypeID, std::vector<MemberVariable> variables, bool coversAllState) {
+    assert(componentTypeID < kMaxComponentTypeCount && "Too many object component types for the member variable tables.");
+    if (componentTypeID >= kMaxComponentTypeCount) return;
+    MemberVariableTable &table = GetMemberVariableTables()[componentTypeID];
+    // 読み取り中の表を書き換えないよう、型ごとに最初の登録だけを受け付ける
+    auto expected = MemberVariableTable::State::Empty;
+    if (!table.state.compare_exchange_strong(expected, MemberVariableTable::State::Writing, std::memory_order_acquire)) return;
+    table.variables = std::move(variables);
+    table.coversAllState = coversAllState;
+    table.indexByName.reserve(table.variables.size());
+    for (size_t i = 0; i < table.variables.size(); ++i) {
+        table.indexByName.emplace(table.variables[i].name, i);
+    }
+    table.state.store(MemberVariableTable::State::Ready, std::memory_order_release);
+}
+
+const IObjectComponent::MemberVariable *IObjectComponent::GetMemberVariable(const std::string &key) const {
+    const MemberVariableTable *table = FindMemberVariableTable(kComponentTypeID_);
+    if (!table) return nullptr;
+    auto it = table->indexByName.find(key);
+    return (it != table->indexByName.end()) ? &table->variables[it->second] : nullptr;
+}
+
+std::span<const IObjectComponent::MemberVariable> IObjectComponent::GetAllMemberVariables() const {
+    const MemberVariableTable *table = FindMemberVariableTable(kComponentTypeID_);
+    if (!table) return {};
+    return table->variables;
+}
+
+bool IObjectComponent::IsStateCoveredByMemberVariables() const {
+    const MemberVariableTable *table = FindMemberVariableTable(kComponentTypeID_);
+    return table && table->coversAllState;
+}
+
+void IObjectComponent::CopyStateFromInterface(Passkey<EmptyObject>, const IObjectComponent &source) {
+    updatePriority_ = source.updatePriority_;
+    isActive_ = source.isActive_;
+    SetTag(source.tagName_);
+    CopyMemberVariablesFrom(source);
+}
+
+JSON IObjectComponent::SaveMemberVariablesToJson() const {
+    JSON json = JSON::object();
+    auto &self = const_cast<IObjectComponent &>(*this);
+    for (const auto &member : GetAllMemberVariables()) {
+        if (!member.saveValue) continue;
+        json[member.attributes.serializedKey] = member.saveValue(member.GetAddress(self));
+    }
+    return json;
+}
+
+void IObjectComponent::LoadMemberVariablesFromJson(const JSON &json) {
+    if (!json.is_object()) return;
+    for (const auto &member : GetAllMemberVariables()) {
+        if (!member.loadValue) continue;
+        auto it = json.find(member.attributes.serializedKey);
+        if (it == json.end()) continue;
+        member.loadValue(member.GetAddress(*this), *it);
+        member.NotifyModified(*this);
+    }
+}
+
+void IObjectComponent::CopyMemberVariablesFrom(const IObjectComponent &source) {
+    // 表は型ごとのため、異なる型どうしではコピーしない
+    if (source.kComponentTypeID_ != kComponentTypeID_ || &source == this) return;
+    auto &sourceComponent = const_cast<IObjectComponent &>(source);
+    for (const auto &member : GetAllMemberVariables()) {
+        member.copyValue(member.GetAddress(*this), member.GetAddress(sourceComponent));
+        member.NotifyModified(*this);
+    }
+}
+
+#if defined(USE_IMGUI)
+bool IObjectComponent::ShowMemberVariablesImGui() {
+    bool shown = false;
+    for (const auto &member : GetAllMemberVariables()) {
+        if (!member.editValue) continue;
+        shown = true;
+        if (member.editValue(TranslationLabel(member.attributes.labelKey), member.GetAddress(*this), member.attributes)) {
+            member.NotifyModified(*this);
+        }
+    }
+    return shown;
+}
+#endif
+
+} // namespace KashipanEngine
@@ -56,6 +56,8 @@ public:
     size_t HasComponent(const IObjectComponent *component) const { return owner_->HasComponent(component); }
     /// @brief 全コンポーネントの取得（コンポーネント本体と追加順のペアのリスト）
     const std::vector<std::pair<IObjectComponent *, size_t>> &GetAllComponents() const { return owner_->GetAllComponents(); }
+    /// @brief コンポーネント構成の世代（追加・削除のたびに進む）
+    std::uint32_t GetComponentsGeneration() const noexcept { return owner_->GetComponentsGeneration(); }
 
     //==================================================
     // コンポーネント追加系メソッド
@@ -3,11 +3,14 @@
 #include <algorithm>
 #include <unordered_map>
 
-#include "Objects/Components/ScriptComponent.h"
 #include "Objects/IObjectComponent.h"
 #include "Objects/ObjectContext.h"
 #include "Utilities/Translation.h"
 
+#if defined(USE_IMGUI)
+#include "Objects/Components/ScriptComponent.h"
+#endif
+
 namespace KashipanEngine {
 
 namespace {
@@ -43,137 +46,259 @@ bool IsNumericValueType(ValueType type) {
 
 } // namespace
 
-bool ApplyParameterBinding(ObjectContext *objectContext, const ParameterBinding &binding, float value, const IObjectComponent *self) {
+bool ParameterBindingHandle::IsCurrent() const {
+    if (!objectContext || objectContext->GetComponentsGeneration() != componentsGeneration) return false;
+    return !script || GetScriptFieldsGeneration(*script) == fieldsGeneration;
+}
+
+bool BindParameterBinding(ObjectContext *objectContext, const ParameterBinding &binding, const IObjectComponent *self, ParameterBindingHandle &outHandle) {
+    outHandle = ParameterBindingHandle{};
+    if (!objectContext) return false;
+    outHandle.objectContext = objectContext;
+    outHandle.componentsGeneration = objectContext->GetComponentsGeneration();
+
     IObjectComponent *target = FindParameterBindingTarget(objectContext, binding, self);
     if (!target) return false;
 
-    // ScriptComponentの[SerializeField]変数への適用
+    // ScriptComponentの[SerializeField]変数への適用（変数が見つからなくても、リロードで現れる場合に備えて世代は記録する）
     if (binding.isScriptVariable) {
-        auto *script = dynamic_cast<ScriptComponent *>(target);
-        return script && script->SetFloatVariable(binding.parameterName, value);
+        bool isScript = false;
+        float *address = FindScriptFloatVariable(*target, binding.parameterName, isScript);
+        if (!isScript) return false;
+        outHandle.script = target;
+        outHandle.fieldsGeneration = GetScriptFieldsGeneration(*target);
+        outHandle.address = address;
+        if (!outHandle.address) return false;
+        outHandle.kind = ParameterBindingHandle::Kind::ScriptFloat;
+        return true;
     }
 
     // メンバ変数（ADD_MEMBER_VARIABLE登録済み）への適用
     auto *member = target->GetMemberVariable(binding.parameterName);
-    if (!member || !member->ptr) return false;
-    bool written = false;
+    if (!member) return false;
+    using Kind = ParameterBindingHandle::Kind;
+    Kind kind = Kind::Unbound;
+    void *address = member->GetAddress(*target);
     switch (member->typeInfo.GetBaseType()) {
-    case ValueType::Float:
-        *static_cast<float *>(member->ptr) = value;
-        written = true;
-        break;
-    case ValueType::Double:
-        *static_cast<double *>(member->ptr) = static_cast<double>(value);
-        written = true;
-        break;
+    case ValueType::Float: kind = Kind::Float; break;
+    case ValueType::Double: kind = Kind::Double; break;
+    case ValueType::Bool: kind = Kind::Bool; break;
+    case ValueType::Int32: kind = Kind::Int32; break;
     case ValueType::Vector2:
     case ValueType::Vector3:
     case ValueType::Vector4: {
         const ValueType baseType = member->typeInfo.GetBaseType();
-        const int channelCount = (baseType == ValueType::Vector2) ? 2 : (baseType == ValueType::Vector3) ? 3 : 4;
-        const int channel = std::clamp(binding.channel, 0, channelCount - 1);
-        static_cast<float *>(member->ptr)[channel] = value;
-        written = true;
-        break;
-    }
-    default:
+        if (binding.channel < 0) {
+            kind = (baseType == ValueType::Vector2) ? Kind::Vector2 : (baseType == ValueType::Vector3) ? Kind::Vector3 : Kind::Vector4;
+        } else {
+            const int channelCount = (baseType == ValueType::Vector2) ? 2 : (baseType == ValueType::Vector3) ? 3 : 4;
+            kind = Kind::FloatChannel;
+            address = static_cast<float *>(address) + std::clamp(binding.channel, 0, channelCount - 1);
+        }
         break;
     }
-    // 書き込み後コールバック（Transformのワールド行列キャッシュ無効化など）
-    if (written && member->onModified) {
-        member->onModified();
+    case ValueType::String: kind = Kind::String; break;
+    case ValueType::Quaternion: kind = Kind::Quaternion; break;
+    case ValueType::Matrix4x4: kind = Kind::Matrix4x4; break;
+    default: break;
     }
-    return written;
+    if (kind == Kind::Unbound) return false;
+    outHandle.kind = kind;
+    outHandle.address = address;
+    outHandle.onModified = member->onModified;
+    outHandle.target = target;
+    return true;
 }
 
-bool ApplyParameterBindingValue(ObjectContext *objectContext, const ParameterBinding &binding, const MyAny &value, const IObjectComponent *self) {
-    IObjectComponent *target = FindParameterBindingTarget(objectContext, binding, self);
-    if (!target) return false;
+namespace {
 
-    // ScriptComponentの[SerializeField]は現状float変数のみ対応のため、数値系のみ書き込める
-    if (binding.isScriptVariable) {
-        float floatValue = 0.0f;
-        if (!TryAnyToFloat(value, floatValue)) return false;
-        auto *script = dynamic_cast<ScriptComponent *>(target);
-        return script && script->SetFloatVariable(binding.parameterName, floatValue);
+/// @brief float値をハンドルの書き込み先へ格納する（onModifiedは呼ばない）
+bool StoreFloat(const ParameterBindingHandle &handle, float value) {
+    using Kind = ParameterBindingHandle::Kind;
+    switch (handle.kind) {
+    case Kind::Float:
+    case Kind::FloatChannel:
+    case Kind::ScriptFloat:
+        *static_cast<float *>(handle.address) = value;
+        return true;
+    case Kind::Double:
+        *static_cast<double *>(handle.address) = static_cast<double>(value);
+        return true;
+    case Kind::Vector2:
+    case Kind::Vector3:
+    case Kind::Vector4:
+        // 値全体を指すバインドへのfloat適用は、従来どおり先頭成分へ書き込む
+        static_cast<float *>(handle.address)[0] = value;
+        return true;
+    default:
+        return false;
     }
+}
 
-    auto *member = target->GetMemberVariable(binding.parameterName);
-    if (!member || !member->ptr) return false;
+} // namespace
+
+bool WriteParameterBindingHandle(const ParameterBindingHandle &handle, float value) {
+    if (!StoreFloat(handle, value)) return false;
+    // 書き込み後コールバック（Transformのワールド行列キャッシュ無効化など）
+    if (handle.onModified) handle.onModified(*handle.target);
+    return true;
+}
+
+bool WriteParameterBindingHandleValue(const ParameterBindingHandle &handle, const MyAny &value) {
+    using Kind = ParameterBindingHandle::Kind;
     bool written = false;
-    switch (member->typeInfo.GetBaseType()) {
-    case ValueType::Float: {
-        float v;
-        if (TryAnyToFloat(value, v)) { *static_cast<float *>(member->ptr) = v; written = true; }
-        break;
-    }
-    case ValueType::Double: {
+    switch (handle.kind) {
+    case Kind::Float:
+    case Kind::FloatChannel:
+    case Kind::ScriptFloat:
+    case Kind::Double: {
+        // ScriptComponentの[SerializeField]は現状float変数のみ対応のため、数値系のみ書き込める
         float v;
-        if (TryAnyToFloat(value, v)) { *static_cast<double *>(member->ptr) = static_cast<double>(v); written = true; }
+        if (TryAnyToFloat(value, v)) written = StoreFloat(handle, v);
         break;
     }
-    case ValueType::Bool:
+    case Kind::Bool:
         if (value.IsType<bool>()) {
-            *static_cast<bool *>(member->ptr) = value.AnyCast<bool>();
+            *static_cast<bool *>(handle.address) = value.AnyCast<bool>();
             written = true;
         } else if (float v; TryAnyToFloat(value, v)) {
-            *static_cast<bool *>(member->ptr) = (v != 0.0f);
+            *static_cast<bool *>(handle.address) = (v != 0.0f);
             written = true;
         }
         break;
-    case ValueType::Int32:
+    case Kind::Int32:
         if (value.IsType<int>()) {
-            *static_cast<int *>(member->ptr) = value.AnyCast<int>();
+            *static_cast<int *>(handle.address) = value.AnyCast<int>();
             written = true;
         } else if (float v; TryAnyToFloat(value, v)) {
-            *static_cast<int *>(member->ptr) = static_cast<int>(v);
+            *static_cast<int *>(handle.address) = static_cast<int>(v);
             written = true;
         }
         break;
-    case ValueType::Vector2:
-    case ValueType::Vector3:
-    case ValueType::Vector4: {
-        const ValueType baseType = member->typeInfo.GetBaseType();
-        if (binding.channel < 0) {
-            // 値全体（Vector2/3/4）をそのまま書き込む。値の型が一致する場合のみ
-            if (baseType == ValueType::Vector2 && value.IsType<Vector2>()) { *static_cast<Vector2 *>(member->ptr) = value.AnyCast<Vector2>(); written = true; }
-            else if (baseType == ValueType::Vector3 && value.IsType<Vector3>()) { *static_cast<Vector3 *>(member->ptr) = value.AnyCast<Vector3>(); written = true; }
-            else if (baseType == ValueType::Vector4 && value.IsType<Vector4>()) { *static_cast<Vector4 *>(member->ptr) = value.AnyCast<Vector4>(); written = true; }
-        } else if (float v; TryAnyToFloat(value, v)) {
-            const int channelCount = (baseType == ValueType::Vector2) ? 2 : (baseType == ValueType::Vector3) ? 3 : 4;
-            const int channel = std::clamp(binding.channel, 0, channelCount - 1);
-            static_cast<float *>(member->ptr)[channel] = v;
-            written = true;
-        }
+    // 値全体（Vector2/3/4）をそのまま書き込む。値の型が一致する場合のみ
+    case Kind::Vector2:
+        if (value.IsType<Vector2>()) { *static_cast<Vector2 *>(handle.address) = value.AnyCast<Vector2>(); written = true; }
         break;
-    }
-    case ValueType::String:
+    case Kind::Vector3:
+        if (value.IsType<Vector3>()) { *static_cast<Vector3 *>(handle.address) = value.AnyCast<Vector3>(); written = true; }
+        break;
+    case Kind::Vector4:
+        if (value.IsType<Vector4>()) { *static_cast<Vector4 *>(handle.address) = value.AnyCast<Vector4>(); written = true; }
+        break;
+    case Kind::String:
         if (value.IsType<std::string>()) {
-            *static_cast<std::string *>(member->ptr) = value.AnyCast<std::string>();
+            *static_cast<std::string *>(handle.address) = value.AnyCast<std::string>();
             written = true;
         }
         break;
-    case ValueType::Quaternion:
+    case Kind::Quaternion:
         if (value.IsType<Quaternion>()) {
-            *static_cast<Quaternion *>(member->ptr) = value.AnyCast<Quaternion>();
+            *static_cast<Quaternion *>(handle.address) = value.AnyCast<Quaternion>();
             written = true;
         }
         break;
-    case ValueType::Matrix4x4:
+    case Kind::Matrix4x4:
         if (value.IsType<Matrix4x4>()) {
-            *static_cast<Matrix4x4 *>(member->ptr) = value.AnyCast<Matrix4x4>();
+            *static_cast<Matrix4x4 *>(handle.address) = value.AnyCast<Matrix4x4>();
             written = true;
         }
         break;
     default:
         break;
     }
-    if (written && member->onModified) {
-        member->onModified();
-    }
+    if (written && handle.onModified) handle.onModified(*handle.target);
     return written;
 }
 
+namespace {
+
+/// @brief 一括書き込みの本体（valueAt(i) で i 番目の値を得る）
+template <typename ValueAt>
+size_t WriteHandles(std::span<const ParameterBindingHandle> handles, ValueAt valueAt) {
+    size_t writtenCount = 0;
+    const ParameterBindingHandle *pending = nullptr;
+    for (size_t i = 0; i < handles.size(); ++i) {
+        const ParameterBindingHandle &handle = handles[i];
+        if (!StoreFloat(handle, valueAt(i))) continue;
+        ++writtenCount;
+        // 同じ対象の同じコールバックが続く間は呼び出しをまとめ、切り替わる時点で1回だけ呼ぶ
+        if (pending && (pending->onModified != handle.onModified || pending->target != handle.target)) {
+            pending->onModified(*pending->target);
+            pending = nullptr;
+        }
+        if (!pending && handle.onModified) pending = &handle;
+    }
+    if (pending) pending->onModified(*pending->target);
+    return writtenCount;
+}
+
+} // namespace
+
+size_t WriteParameterBindingHandles(std::span<const ParameterBindingHandle> handles, std::span<const float> values) {
+    const size_t count = std::min(handles.size(), values.size());
+    return WriteHandles(handles.first(count), [values](size_t i) { return values[i]; });
+}
+
+size_t WriteParameterBindingHandles(std::span<const ParameterBindingHandle> handles, float value) {
+    return WriteHandles(handles, [value](size_t) { return value; });
+}
+
+bool ApplyParameterBinding(ObjectContext *objectContext, const ParameterBinding &binding, float value, const IObjectComponent *self) {
+    ParameterBindingHandle handle;
+    return BindParameterBinding(objectContext, binding, self, handle) && WriteParameterBindingHandle(handle, value);
+}
+
+bool ApplyParameterBindingValue(ObjectContext *objectContext, const ParameterBinding &binding, const MyAny &value, const IObjectComponent *self) {
+    ParameterBindingHandle handle;
+    return BindParameterBinding(objectContext, binding, self, handle) && WriteParameterBindingHandleValue(handle, value);
+}
+
+//==================================================
+// ParameterBindingTable
+//==================================================
+
+void ParameterBindingTable::Update(ObjectContext *objectContext, const std::vector<ParameterBinding> &bindings, const IObjectComponent *self) {
+    bool isCurrent = isCompiled_ && objectContext_ == objectContext && handles_.size() == bindings.size() &&
+        objectContext && objectContext->GetComponentsGeneration() == componentsGeneration_;
+    if (isCurrent) {
+        // スクリプト変数は ScriptComponent のリロードでも失効するため、個別に世代を確認する
+        for (const auto &handle : handles_) {
+            if (handle.script && GetScriptFieldsGeneration(*handle.script) != handle.fieldsGeneration) {
+                isCurrent = false;
+                break;
+            }
+        }
+    }
+    if (isCurrent) return;
+
+    handles_.resize(bindings.size());
+    for (size_t i = 0; i < bindings.size(); ++i) {
+        BindParameterBinding(objectContext, bindings[i], self, handles_[i]);
+    }
+    objectContext_ = objectContext;
+    componentsGeneration_ = objectContext ? objectContext->GetComponentsGeneration() : 0;
+    isCompiled_ = true;
+}
+
+size_t ParameterBindingTable::Apply(ObjectContext *objectContext, const std::vector<ParameterBinding> &bindings, float value, const IObjectComponent *self) {
+    Update(objectContext, bindings, self);
+    return WriteParameterBindingHandles(handles_, value);
+}
+
+size_t ParameterBindingTable::ApplyValue(ObjectContext *objectContext, const std::vector<ParameterBinding> &bindings, const MyAny &value, const IObjectComponent *self) {
+    Update(objectContext, bindings, self);
+    size_t writtenCount = 0;
+    for (const auto &handle : handles_) {
+        if (WriteParameterBindingHandleValue(handle, value)) ++writtenCount;
+    }
+    return writtenCount;
+}
+
+size_t ParameterBindingTable::ApplyEach(ObjectContext *objectContext, const std::vector<ParameterBinding> &bindings, std::span<const float> values, const IObjectComponent *self) {
+    Update(objectContext, bindings, self);
+    return WriteParameterBindingHandles(handles_, values);
+}
+
 JSON SaveParameterBindingToJson(const ParameterBinding &binding) {
     return JSON{
         { "componentType", binding.componentType },
@@ -226,7 +351,8 @@ std::vector<ParameterBindingCandidate> CollectParameterBindingCandidates(ObjectC
         }
 
         // 他コンポーネントはADD_MEMBER_VARIABLE登録済みのfloat系メンバ変数を候補にする
-        for (const auto &[variableName, member] : component->GetAllMemberVariables()) {
+        for (const auto &member : component->GetAllMemberVariables()) {
+            const std::string &variableName = member.name;
             const ValueType baseType = member.typeInfo.GetBaseType();
             int channelCount = 0;
             if (baseType == ValueType::Float || baseType == ValueType::Double) channelCount = 1;
@@ -288,7 +414,8 @@ std::vector<ParameterBindingCandidate> CollectParameterBindingCandidatesForType(
             }
         }
 
-        for (const auto &[variableName, member] : component->GetAllMemberVariables()) {
+        for (const auto &member : component->GetAllMemberVariables()) {
+            const std::string &variableName = member.name;
             const ValueType baseType = member.typeInfo.GetBaseType();
 
             if (sourceIsNumeric) {
@@ -331,11 +458,13 @@ std::vector<ParameterBindingCandidate> CollectParameterBindingCandidatesForType(
     return candidates;
 }
 
-void ShowParameterBindingListImGui(std::vector<ParameterBinding> &bindings, const std::vector<ParameterBindingCandidate> &candidates) {
+bool ShowParameterBindingListImGui(std::vector<ParameterBinding> &bindings, const std::vector<ParameterBindingCandidate> &candidates) {
+    bool changed = false;
     ImGui::Text(TranslationC("component.parameterbinding.bindings_d"), static_cast<int>(bindings.size()));
     ImGui::SameLine();
     if (ImGui::SmallButton(TranslationLabel("component.parameterbinding.add_binding"))) {
         bindings.push_back(candidates.empty() ? ParameterBinding{} : candidates.front().binding);
+        changed = true;
     }
     if (ImGui::IsItemHovered()) {
         ImGui::SetTooltip("%s", "値の適用先を追加する。候補は同オブジェクトのコンポーネントのfloat系パラメータと\nScriptComponentの[SerializeField]付きfloat変数");
@@ -375,6 +504,7 @@ void ShowParameterBindingListImGui(std::vector<ParameterBinding> &bindings, cons
                 const bool selected = (c == currentCandidate);
                 if (ImGui::Selectable(candidates[c].label.c_str(), selected)) {
                     binding = candidates[c].binding;
+                    changed = true;
                 }
                 if (selected) ImGui::SetItemDefaultFocus();
             }
@@ -388,7 +518,9 @@ void ShowParameterBindingListImGui(std::vector<ParameterBinding> &bindings, cons
     }
     if (removeBindingIndex >= 0) {
         bindings.erase(bindings.begin() + removeBindingIndex);
+        changed = true;
     }
+    return changed;
 }
 
 #endif // USE_IMGUI
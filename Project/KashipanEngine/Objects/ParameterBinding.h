@@ -1,4 +1,6 @@
 #pragma once
+#include <cstdint>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -49,6 +51,104 @@ bool ApplyParameterBinding(ObjectContext *objectContext, const ParameterBinding
 /// @return 書き込みに成功した場合は true
 bool ApplyParameterBindingValue(ObjectContext *objectContext, const ParameterBinding &binding, const MyAny &value, const IObjectComponent *self);
 
+/// @brief ParameterBinding を解決済みの書き込み先（バインド時に1度だけ検索し、以降は直接書き込む）
+/// @details ApplyParameterBinding は適用のたびに型名・メンバ名の文字列検索を行うため、毎フレーム大量に
+///          適用する用途（KeyFrameAnimator 等）では BindParameterBinding で解決したハンドルを保持して使う。
+///          所属オブジェクトのコンポーネント構成（と、スクリプト変数の場合は ScriptComponent の変数一覧）の
+///          世代を記録しておき、IsCurrent() が false になったら解決し直すこと。
+///          ハンドルは解決元のオブジェクトより長く保持しないこと（同オブジェクトのコンポーネントが持つ前提）
+struct ParameterBindingHandle {
+    /// @brief 書き込み先の型
+    enum class Kind : std::uint8_t {
+        Unbound,      ///< 未解決（解決に失敗した場合も含む）
+        Float,
+        Double,
+        Bool,
+        Int32,
+        FloatChannel, ///< Vector2/3/4 の1成分（address は成分の位置を指す）
+        Vector2,      ///< 値全体（channel = -1）
+        Vector3,
+        Vector4,
+        String,
+        Quaternion,
+        Matrix4x4,
+        ScriptFloat,  ///< ScriptComponent の [SerializeField] float 変数
+    };
+
+    Kind kind = Kind::Unbound;
+    void *address = nullptr;
+    /// @brief 書き込み後に target を渡して呼ぶコールバック（MemberVariable::onModified。無い場合は nullptr）
+    void (*onModified)(IObjectComponent &component) = nullptr;
+    /// @brief 書き込み先のコンポーネント
+    IObjectComponent *target = nullptr;
+    ObjectContext *objectContext = nullptr;
+    /// @brief スクリプト変数の場合の ScriptComponent（変数一覧の世代確認用）
+    const IObjectComponent *script = nullptr;
+    std::uint32_t componentsGeneration = 0;
+    std::uint32_t fieldsGeneration = 0;
+
+    bool IsBound() const noexcept { return kind != Kind::Unbound; }
+    /// @brief 解決後にバインド先のコンポーネント構成・スクリプト変数が変わっていないか（一度も解決していない場合は false）
+    bool IsCurrent() const;
+};
+
+/// @brief component が ScriptComponent の場合に、float型の [SerializeField] 変数の格納先を返す（ScriptComponent.cpp で定義）
+/// @details ParameterBinding.cpp から ScriptComponent の定義を参照しないための窓口（テストでは差し替える）
+/// @param outIsScript component が ScriptComponent かどうか（変数が見つからない場合も設定する）
+/// @return 名前が一致するfloat型変数が無い場合は nullptr
+float *FindScriptFloatVariable(IObjectComponent &component, const std::string &name, bool &outIsScript);
+/// @brief ScriptComponent の [SerializeField] 変数の一覧の世代（ScriptComponent.cpp で定義）
+/// @param script FindScriptFloatVariable で ScriptComponent と判定されたコンポーネント
+std::uint32_t GetScriptFieldsGeneration(const IObjectComponent &script);
+
+/// @brief バインド先を解決してハンドルを作る
+/// @details 解決に失敗した場合も、その時点の世代を記録した未解決のハンドルになる（構成が変わるまで再検索しない）
+/// @param self 呼び出し元コンポーネント（自分自身への適用を防ぐ。nullptr可）
+/// @return 解決に成功した場合は true
+bool BindParameterBinding(ObjectContext *objectContext, const ParameterBinding &binding, const IObjectComponent *self, ParameterBindingHandle &outHandle);
+
+/// @brief 解決済みのハンドルへfloat値を書き込む（ApplyParameterBinding と同じ規則。onModified も呼ぶ）
+bool WriteParameterBindingHandle(const ParameterBindingHandle &handle, float value);
+/// @brief 解決済みのハンドルへ任意型の値を書き込む（ApplyParameterBindingValue と同じ規則。onModified も呼ぶ）
+bool WriteParameterBindingHandleValue(const ParameterBindingHandle &handle, const MyAny &value);
+
+/// @brief 解決済みのハンドル群へ値を一括で書き込む（handles[i] へ values[i]）
+/// @details 値の書き込みを先に行い、onModified は同じコールバックが連続する区間ごとに1回だけ呼ぶ
+///          （Transformのtranslate_.x/y/zへの適用など、同じメンバへのバインドは並べておくと呼び出しがまとまる）。
+///          失効の確認は行わないため、呼び出し側で IsCurrent() を確認しておくこと
+/// @return 書き込んだ件数
+size_t WriteParameterBindingHandles(std::span<const ParameterBindingHandle> handles, std::span<const float> values);
+/// @brief 解決済みのハンドル群へ同じ値を一括で書き込む
+size_t WriteParameterBindingHandles(std::span<const ParameterBindingHandle> handles, float value);
+
+/// @brief バインド先一覧（std::vector<ParameterBinding>）を解決済みのハンドルとして保持し、まとめて適用する
+/// @details 一覧を編集・再読込した場合は Invalidate() を呼ぶ。コンポーネント構成やスクリプト変数の変化は
+///          適用時に世代で検出し、自動で解決し直す
+class ParameterBindingTable {
+public:
+    /// @brief 解決結果を破棄する（次の適用時に解決し直す）
+    void Invalidate() noexcept { isCompiled_ = false; }
+    /// @brief 必要な場合のみ一覧を解決し直す
+    void Update(ObjectContext *objectContext, const std::vector<ParameterBinding> &bindings, const IObjectComponent *self);
+
+    /// @brief 全バインド先へ同じfloat値を書き込む
+    /// @return 書き込んだ件数
+    size_t Apply(ObjectContext *objectContext, const std::vector<ParameterBinding> &bindings, float value, const IObjectComponent *self);
+    /// @brief 全バインド先へ同じ任意型の値を書き込む
+    size_t ApplyValue(ObjectContext *objectContext, const std::vector<ParameterBinding> &bindings, const MyAny &value, const IObjectComponent *self);
+    /// @brief 一覧のi番目のバインド先へ values[i] を書き込む（values の要素数は一覧と同じにすること）
+    size_t ApplyEach(ObjectContext *objectContext, const std::vector<ParameterBinding> &bindings, std::span<const float> values, const IObjectComponent *self);
+
+    /// @brief 解決済みのハンドル（一覧と同じ並び）
+    const std::vector<ParameterBindingHandle> &GetHandles() const noexcept { return handles_; }
+
+private:
+    std::vector<ParameterBindingHandle> handles_;
+    ObjectContext *objectContext_ = nullptr;
+    std::uint32_t componentsGeneration_ = 0;
+    bool isCompiled_ = false;
+};
+
 JSON SaveParameterBindingToJson(const ParameterBinding &binding);
 ParameterBinding LoadParameterBindingFromJson(const JSON &json);
 
@@ -75,7 +175,8 @@ std::vector<ParameterBindingCandidate> CollectParameterBindingCandidates(ObjectC
 std::vector<ParameterBindingCandidate> CollectParameterBindingCandidatesForType(ObjectContext *objectContext, const IObjectComponent *self, const TypeInfo &sourceType);
 
 /// @brief バインド一覧の編集UI（見出し・追加ボタン・対象選択コンボ・削除ボタン）を表示する
-void ShowParameterBindingListImGui(std::vector<ParameterBinding> &bindings, const std::vector<ParameterBindingCandidate> &candidates);
+/// @return 一覧を変更した場合は true（ParameterBindingTable を使う場合は Invalidate() すること）
+bool ShowParameterBindingListImGui(std::vector<ParameterBinding> &bindings, const std::vector<ParameterBindingCandidate> &candidates);
 
 #endif // USE_IMGUI
 
@@ -0,0 +1,213 @@
+#include "Objects/ParticleSimulation.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Math/MathSimd.h"
+
+namespace KashipanEngine {
+
+namespace {
+
+/// @brief 1軸分の速度・位置の積分（v += a * dt; p += v * dt）
+void IntegrateAxis(float *position, float *velocity, const float *acceleration, std::uint32_t count, float deltaTime) {
+    std::uint32_t i = 0;
+#if defined(KASHIPAN_MATH_SIMD_SSE)
+    const __m128 dt = _mm_set1_ps(deltaTime);
+    for (; i + 4 <= count; i += 4) {
+        const __m128 v = MathSimd::MulAdd(_mm_loadu_ps(acceleration + i), dt, _mm_loadu_ps(velocity + i));
+        _mm_storeu_ps(velocity + i, v);
+        _mm_storeu_ps(position + i, MathSimd::MulAdd(v, dt, _mm_loadu_ps(position + i)));
+    }
+#endif
+    for (; i < count; ++i) {
+        velocity[i] += acceleration[i] * deltaTime;
+        position[i] += velocity[i] * deltaTime;
+    }
+}
+
+/// @brief 1軸分の回転の積分（等角加速度運動。rot += (w + 0.5 * α * dt) * dt; w += α * dt）
+void IntegrateRotationAxis(float *rotation, float *angularVelocity, const float *angularAcceleration, std::uint32_t count, float deltaTime) {
+    std::uint32_t i = 0;
+#if defined(KASHIPAN_MATH_SIMD_SSE)
+    const __m128 dt = _mm_set1_ps(deltaTime);
+    const __m128 halfDt = _mm_set1_ps(0.5f * deltaTime);
+    for (; i + 4 <= count; i += 4) {
+        const __m128 w = _mm_loadu_ps(angularVelocity + i);
+        const __m128 alpha = _mm_loadu_ps(angularAcceleration + i);
+        const __m128 step = MathSimd::MulAdd(alpha, halfDt, w);
+        _mm_storeu_ps(rotation + i, MathSimd::MulAdd(step, dt, _mm_loadu_ps(rotation + i)));
+        _mm_storeu_ps(angularVelocity + i, MathSimd::MulAdd(alpha, dt, w));
+    }
+#endif
+    for (; i < count; ++i) {
+        rotation[i] += (angularVelocity[i] + 0.5f * angularAcceleration[i] * deltaTime) * deltaTime;
+        angularVelocity[i] += angularAcceleration[i] * deltaTime;
+    }
+}
+
+/// @brief 自身の+Z軸が forward を向く回転（TargetLookAt::MakeLookRotation・ParticleUpdateCS と同じ式）
+void MakeLookRotationRows(const Vector3 &forward, float (&rows)[3][3]) {
+    const Vector3 up = (std::fabs(forward.y) > 0.999f) ? Vector3(0.0f, 0.0f, 1.0f) : Vector3(0.0f, 1.0f, 0.0f);
+    const Vector3 right = up.Cross(forward).Normalize();
+    const Vector3 realUp = forward.Cross(right);
+    rows[0][0] = right.x;   rows[0][1] = right.y;   rows[0][2] = right.z;
+    rows[1][0] = realUp.x;  rows[1][1] = realUp.y;  rows[1][2] = realUp.z;
+    rows[2][0] = forward.x; rows[2][1] = forward.y; rows[2][2] = forward.z;
+}
+
+/// @brief RotateX * RotateY * RotateZ（Matrix4x4MakeRotate と同じ回転）を行列積なしで求める
+void MakeEulerRotationRows(float rx, float ry, float rz, float (&rows)[3][3]) {
+    const float sx = std::sin(rx), cx = std::cos(rx);
+    const float sy = std::sin(ry), cy = std::cos(ry);
+    const float sz = std::sin(rz), cz = std::cos(rz);
+    rows[0][0] = cy * cz;                rows[0][1] = cy * sz;                rows[0][2] = -sy;
+    rows[1][0] = sx * sy * cz - cx * sz; rows[1][1] = sx * sy * sz + cx * cz; rows[1][2] = sx * cy;
+    rows[2][0] = cx * sy * cz + sx * sz; rows[2][1] = cx * sy * sz - sx * cz; rows[2][2] = cx * cy;
+}
+
+} // namespace
+
+void ParticleSimulation::SetCapacity(std::uint32_t capacity) {
+    if (capacity == capacity_) return;
+    for (auto &stream : streams_) {
+        stream.resize(capacity);
+    }
+    capacity_ = capacity;
+    aliveCount_ = std::min(aliveCount_, capacity_);
+}
+
+bool ParticleSimulation::Spawn(const SpawnParams &params) {
+    if (aliveCount_ >= capacity_) return false;
+    const std::uint32_t i = aliveCount_++;
+    const auto write3 = [this, i](Stream x, const Vector3 &value) {
+        streams_[x][i] = value.x;
+        streams_[x + 1][i] = value.y;
+        streams_[x + 2][i] = value.z;
+    };
+    write3(kPositionX, params.position);
+    write3(kVelocityX, params.velocity);
+    write3(kAccelerationX, params.acceleration);
+    write3(kRotationX, params.rotation);
+    write3(kAngularVelocityX, params.angularVelocity);
+    write3(kAngularAccelerationX, params.angularAcceleration);
+    write3(kStartScaleX, params.startScale);
+    write3(kEndScaleX, params.endScale);
+    streams_[kAge][i] = 0.0f;
+    streams_[kLifetime][i] = params.lifetime;
+    return true;
+}
+
+void ParticleSimulation::RemoveAt(std::uint32_t index) noexcept {
+    const std::uint32_t last = --aliveCount_;
+    if (index == last) return;
+    for (auto &stream : streams_) {
+        stream[index] = stream[last];
+    }
+}
+
+void ParticleSimulation::Simulate(float deltaTime) {
+    const std::uint32_t count = aliveCount_;
+    if (count == 0) return;
+
+    // --- 加齢と寿命判定 ---
+    // 先に全要素の年齢を進め、寿命を迎えたものを末尾と入れ替えて取り除く（以降の積分は生存分だけ行う）
+    float *age = Data(kAge);
+    const float *lifetime = Data(kLifetime);
+    std::uint32_t i = 0;
+#if defined(KASHIPAN_MATH_SIMD_SSE)
+    const __m128 dt = _mm_set1_ps(deltaTime);
+    for (; i + 4 <= count; i += 4) {
+        _mm_storeu_ps(age + i, _mm_add_ps(_mm_loadu_ps(age + i), dt));
+    }
+#endif
+    for (; i < count; ++i) {
+        age[i] += deltaTime;
+    }
+
+    i = 0;
+#if defined(KASHIPAN_MATH_SIMD_SSE)
+    // 4要素とも生存している区間は比較1回で読み飛ばす（大半のフレームでは死亡はごく一部）
+    while (i + 4 <= aliveCount_) {
+        const int expired = _mm_movemask_ps(_mm_cmpge_ps(_mm_loadu_ps(age + i), _mm_loadu_ps(lifetime + i)));
+        if (expired == 0) {
+            i += 4;
+            continue;
+        }
+        break;
+    }
+#endif
+    while (i < aliveCount_) {
+        if (age[i] >= lifetime[i]) {
+            // 末尾の要素（加齢済み）が入ってくるため、同じ位置をもう一度判定する
+            RemoveAt(i);
+            continue;
+        }
+        ++i;
+    }
+
+    // --- 移動・回転 ---
+    const std::uint32_t alive = aliveCount_;
+    for (std::uint32_t axis = 0; axis < 3; ++axis) {
+        IntegrateAxis(Data(static_cast<Stream>(kPositionX + axis)), Data(static_cast<Stream>(kVelocityX + axis)),
+            Data(static_cast<Stream>(kAccelerationX + axis)), alive, deltaTime);
+        IntegrateRotationAxis(Data(static_cast<Stream>(kRotationX + axis)), Data(static_cast<Stream>(kAngularVelocityX + axis)),
+            Data(static_cast<Stream>(kAngularAccelerationX + axis)), alive, deltaTime);
+    }
+}
+
+void ParticleSimulation::WriteInstanceMatrices(const InstanceParams &params, Matrix4x4 *out, std::uint32_t begin, std::uint32_t end) const {
+    end = std::min(end, aliveCount_);
+    const float *px = Data(kPositionX), *py = Data(kPositionY), *pz = Data(kPositionZ);
+    const float *rx = Data(kRotationX), *ry = Data(kRotationY), *rz = Data(kRotationZ);
+    const float *ssx = Data(kStartScaleX), *ssy = Data(kStartScaleY), *ssz = Data(kStartScaleZ);
+    const float *esx = Data(kEndScaleX), *esy = Data(kEndScaleY), *esz = Data(kEndScaleZ);
+    const float *age = Data(kAge), *lifetime = Data(kLifetime);
+    const auto &parent = params.parentWorldMatrix.m;
+    const auto &camera = params.cameraWorldMatrix.m;
+    const Vector3 cameraPosition(camera[3][0], camera[3][1], camera[3][2]);
+
+    for (std::uint32_t i = begin; i < end; ++i) {
+        const float t = lifetime[i] > 0.0f ? std::clamp(age[i] / lifetime[i], 0.0f, 1.0f) : 1.0f;
+        const float scale[3] = {
+            ssx[i] + (esx[i] - ssx[i]) * t,
+            ssy[i] + (esy[i] - ssy[i]) * t,
+            ssz[i] + (esz[i] - ssz[i]) * t,
+        };
+
+        float rows[3][3];
+        Vector3 translate(px[i], py[i], pz[i]);
+        bool applyParent = params.hasParent;
+        if (params.billboard) {
+            // ビルボードは親の平行移動だけを追従させ、回転はカメラから決める
+            if (params.hasParent) {
+                translate = Vector3(
+                    translate.x * parent[0][0] + translate.y * parent[1][0] + translate.z * parent[2][0] + parent[3][0],
+                    translate.x * parent[0][1] + translate.y * parent[1][1] + translate.z * parent[2][1] + parent[3][1],
+                    translate.x * parent[0][2] + translate.y * parent[1][2] + translate.z * parent[2][2] + parent[3][2]);
+            }
+            applyParent = false;
+            const Vector3 direction = cameraPosition - translate;
+            if (!params.billboardLookAt) {
+                for (int r = 0; r < 3; ++r) {
+                    for (int c = 0; c < 3; ++c) rows[r][c] = camera[r][c];
+                }
+            } else if (direction.Dot(direction) > 1.0e-12f) {
+                MakeLookRotationRows(direction.Normalize(), rows);
+            } else {
+                MakeEulerRotationRows(rx[i], ry[i], rz[i], rows);
+            }
+        } else {
+            MakeEulerRotationRows(rx[i], ry[i], rz[i], rows);
+        }
+
+        Matrix4x4 local(
+            rows[0][0] * scale[0], rows[0][1] * scale[0], rows[0][2] * scale[0], 0.0f,
+            rows[1][0] * scale[1], rows[1][1] * scale[1], rows[1][2] * scale[1], 0.0f,
+            rows[2][0] * scale[2], rows[2][1] * scale[2], rows[2][2] * scale[2], 0.0f,
+            translate.x, translate.y, translate.z, 1.0f);
+        out[i] = applyParent ? local * params.parentWorldMatrix : local;
+    }
+}
+
+} // namespace KashipanEngine
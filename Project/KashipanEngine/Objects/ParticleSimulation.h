@@ -0,0 +1,88 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "Math/Matrix4x4.h"
+#include "Math/Vector3.h"
+
+namespace KashipanEngine {
+
+/// @brief オブジェクトを介さないCPUパーティクルのシミュレーション本体
+/// @details 位置・速度・回転・スケール・寿命を成分ごとの float 配列（SoA）で持ち、生存中のパーティクルを
+///          常に先頭 [0, GetAliveCount()) へ詰めて保持する（死亡時は末尾と入れ替える）。
+///          移動・回転・寿命の計算は ParticleUpdateCS.hlsl（GPU Simulation）と同じ式で、4要素ずつSIMDで進める。
+///          シーン・EmptyObject・描画APIに依存しないため、単体で生成して動かせる
+class ParticleSimulation final {
+public:
+    /// @brief 1パーティクル分の初期値（回転系はラジアン）
+    struct SpawnParams final {
+        Vector3 position{ 0.0f, 0.0f, 0.0f };
+        Vector3 velocity{ 0.0f, 0.0f, 0.0f };
+        Vector3 acceleration{ 0.0f, 0.0f, 0.0f };
+        Vector3 rotation{ 0.0f, 0.0f, 0.0f };
+        Vector3 angularVelocity{ 0.0f, 0.0f, 0.0f };
+        Vector3 angularAcceleration{ 0.0f, 0.0f, 0.0f };
+        Vector3 startScale{ 1.0f, 1.0f, 1.0f };
+        Vector3 endScale{ 0.0f, 0.0f, 0.0f };
+        float lifetime = 1.0f;
+    };
+
+    /// @brief インスタンス行列の書き出し時に全パーティクルで共通の値
+    struct InstanceParams final {
+        /// @brief パーティクルの位置等を親のローカル空間として扱う場合の親のワールド行列
+        Matrix4x4 parentWorldMatrix = Matrix4x4::Identity();
+        /// @brief parentWorldMatrix を掛けるか（false の場合は恒等行列として扱い、行列積を省く）
+        bool hasParent = false;
+        /// @brief ビルボード化するか（親の回転・スケールは適用せず、平行移動のみ追従する）
+        bool billboard = false;
+        /// @brief true: +Z軸をカメラへ向ける（LookAt）、false: カメラの回転をコピーする（SyncRotation）
+        bool billboardLookAt = false;
+        Matrix4x4 cameraWorldMatrix = Matrix4x4::Identity();
+    };
+
+    /// @brief 同時に生存できる最大数を設定する（縮めた場合、入りきらない生存中のパーティクルは破棄する）
+    void SetCapacity(std::uint32_t capacity);
+    std::uint32_t GetCapacity() const noexcept { return capacity_; }
+    std::uint32_t GetAliveCount() const noexcept { return aliveCount_; }
+
+    /// @brief パーティクルを1つ追加する
+    /// @return 空きが無く追加できなかった場合は false
+    bool Spawn(const SpawnParams &params);
+    /// @brief 生存中の全パーティクルを破棄する
+    void Clear() noexcept { aliveCount_ = 0; }
+
+    /// @brief 経過時間を進め、寿命を迎えたパーティクルを取り除く
+    void Simulate(float deltaTime);
+
+    /// @brief 生存中のパーティクル [begin, end) のワールド行列を out[begin, end) へ書き出す
+    /// @details 異なる範囲であれば複数スレッドから同時に呼んでよい
+    void WriteInstanceMatrices(const InstanceParams &params, Matrix4x4 *out, std::uint32_t begin, std::uint32_t end) const;
+
+private:
+    enum Stream : std::uint32_t {
+        kPositionX, kPositionY, kPositionZ,
+        kVelocityX, kVelocityY, kVelocityZ,
+        kAccelerationX, kAccelerationY, kAccelerationZ,
+        kRotationX, kRotationY, kRotationZ,
+        kAngularVelocityX, kAngularVelocityY, kAngularVelocityZ,
+        kAngularAccelerationX, kAngularAccelerationY, kAngularAccelerationZ,
+        kStartScaleX, kStartScaleY, kStartScaleZ,
+        kEndScaleX, kEndScaleY, kEndScaleZ,
+        kAge,
+        kLifetime,
+        kStreamCount
+    };
+
+    float *Data(Stream stream) noexcept { return streams_[stream].data(); }
+    const float *Data(Stream stream) const noexcept { return streams_[stream].data(); }
+    /// @brief 末尾の生存パーティクルを index へ移して1つ減らす
+    void RemoveAt(std::uint32_t index) noexcept;
+
+    std::array<std::vector<float>, kStreamCount> streams_;
+    std::uint32_t capacity_ = 0;
+    std::uint32_t aliveCount_ = 0;
+};
+
+} // namespace KashipanEngine
@@ -0,0 +1,291 @@
+#include "Objects/TransformHierarchy.h"
+
+#include "Objects/Components/Transform.h"
+
+#include <atomic>
+#include <cassert>
+
+namespace KashipanEngine {
+
+namespace {
+
+/// @brief 遅延計算時に祖先をたどるための作業領域（読み取りは複数スレッドから同時に行われるためスレッドごとに持つ）
+thread_local std::vector<std::uint32_t> tlsPathScratch;
+
+/// @brief フレームの途中の読み取りで計算したワールド行列の控え1つ分
+struct MidFrameWorldMatrix {
+    /// @brief 計算したときの表の構造の世代（0 の場合は空）
+    std::uint64_t structureGeneration = 0;
+    /// @brief 計算したときの、根から自身までのローカルのTRSの変更回数の合計
+    std::uint64_t pathRevision = 0;
+    std::uint32_t index = 0;
+    Matrix4x4 world;
+};
+
+/// @brief フレームの途中の読み取りの控えの数（ノードのインデックスの下位ビットで直接引くため2のべき乗）
+constexpr std::size_t kMidFrameWorldMatrixCacheSize = 1024;
+
+/// @brief フレームの途中の読み取りの控え（表へは書き込まないため、スレッドごとに持つ。読み取ったスレッドだけが確保する）
+thread_local std::vector<MidFrameWorldMatrix> tlsMidFrameWorldMatrices;
+
+/// @brief ノードのインデックスに対応する控えの位置
+MidFrameWorldMatrix &GetMidFrameWorldMatrixSlot(std::uint32_t index) {
+    auto &cache = tlsMidFrameWorldMatrices;
+    if (cache.empty()) cache.resize(kMidFrameWorldMatrixCacheSize);
+    return cache[index & (kMidFrameWorldMatrixCacheSize - 1)];
+}
+
+/// @brief フレームの途中の読み取りの控えを探す（構造・根からの変更回数のどちらかが異なる場合は nullptr）
+const Matrix4x4 *FindMidFrameWorldMatrix(std::uint64_t structureGeneration, std::uint32_t index, std::uint64_t pathRevision) {
+    const auto &cached = GetMidFrameWorldMatrixSlot(index);
+    if (cached.structureGeneration != structureGeneration || cached.index != index || cached.pathRevision != pathRevision) return nullptr;
+    return &cached.world;
+}
+
+/// @brief 次に再構築した表へ割り当てる構造の世代（同じアドレスに作り直された表と控えを取り違えないよう、全ての表で共有する）
+std::atomic<std::uint64_t> sNextStructureGeneration{ 1 };
+
+} // namespace
+
+void TransformHierarchy::AddNode(Transform *owner) {
+    const std::uint32_t index = static_cast<std::uint32_t>(owners_.size());
+    owners_.push_back(owner);
+    parents_.push_back(-1);
+    worldMatrices_.push_back(Matrix4x4::Identity());
+    worldVersions_.push_back(0);
+    parentVersions_.push_back(0);
+    dirty_.push_back(0);
+    localRevisions_.push_back(0);
+    owner->SetHierarchyIndex(Passkey<TransformHierarchy>(), index);
+    MarkLocalDirty(index);
+    MarkStructureDirty();
+}
+
+void TransformHierarchy::RemoveNode(std::uint32_t index) {
+    // 末尾のノードを空いた位置へ移す（並び順は崩れるが、次の参照時に再構築される）
+    const std::uint32_t last = static_cast<std::uint32_t>(owners_.size() - 1);
+    if (index != last) {
+        owners_[index] = owners_[last];
+        parents_[index] = parents_[last];
+        worldMatrices_[index] = worldMatrices_[last];
+        worldVersions_[index] = worldVersions_[last];
+        parentVersions_[index] = parentVersions_[last];
+        dirty_[index] = dirty_[last];
+        localRevisions_[index] = localRevisions_[last];
+        owners_[index]->SetHierarchyIndex(Passkey<TransformHierarchy>(), index);
+    }
+    owners_.pop_back();
+    parents_.pop_back();
+    worldMatrices_.pop_back();
+    worldVersions_.pop_back();
+    parentVersions_.pop_back();
+    dirty_.pop_back();
+    localRevisions_.pop_back();
+    MarkStructureDirty();
+}
+
+void TransformHierarchy::PrepareParallelReads() {
+    assert(IsOwnerThread() && "TransformHierarchy::PrepareParallelReads must be called on the owner thread.");
+    EnsureStructure();
+}
+
+Matrix4x4 TransformHierarchy::GetWorldMatrix(const Transform &transform) {
+    // 毎フレームの一括更新後は全ノードが最新のため、そのまま返す
+    if (!isStructureDirty_ && !hasDirtyNodes_.load(std::memory_order_relaxed)) {
+        return worldMatrices_[transform.GetHierarchyIndex()];
+    }
+    // 再構築前の親のインデックスは削除で範囲外を指している場合があるため、祖先はたどらない
+    if (!EnsureStructure()) return worldMatrices_[transform.GetHierarchyIndex()];
+
+    // 根から自身までを上から順にたどり、最初に再計算が必要になったノードから下だけを計算する。
+    // 祖先を再計算した場合は、その子孫は親のバージョンが一致していても古いため続けて計算する。
+    // 計算が必要なノードは、根からのローカルのTRSの変更回数の合計が控えと同じであれば控えの値を使う
+    const std::uint32_t index = transform.GetHierarchyIndex();
+    auto &path = tlsPathScratch;
+    path.clear();
+    std::uint64_t pathRevision = 0;
+    for (std::int32_t node = static_cast<std::int32_t>(index); node >= 0; node = parents_[node]) {
+        path.push_back(static_cast<std::uint32_t>(node));
+        pathRevision += localRevisions_[node];
+    }
+    // 同じフレームで読み直した場合は、祖先の行列をたどらずに自身の控えを返す
+    if (const Matrix4x4 *cached = FindMidFrameWorldMatrix(structureGeneration_, index, pathRevision)) {
+        return *cached;
+    }
+
+    const Matrix4x4 *parentWorld = nullptr;
+    Matrix4x4 world;
+    bool isRecomputing = false;
+    pathRevision = 0;
+    for (auto it = path.rbegin(); it != path.rend(); ++it) {
+        const std::uint32_t node = *it;
+        pathRevision += localRevisions_[node];
+        if (!isRecomputing && !NeedsUpdate(node)) {
+            parentWorld = &worldMatrices_[node];
+            continue;
+        }
+        isRecomputing = true;
+        if (const Matrix4x4 *cached = FindMidFrameWorldMatrix(structureGeneration_, node, pathRevision)) {
+            world = *cached;
+        } else {
+            const Matrix4x4 local = owners_[node]->ComputeLocalMatrix();
+            world = parentWorld ? local * *parentWorld : local;
+            GetMidFrameWorldMatrixSlot(node) = { structureGeneration_, pathRevision, node, world };
+        }
+        parentWorld = &world;
+    }
+    return isRecomputing ? world : worldMatrices_[index];
+}
+
+bool TransformHierarchy::IsWorldMatrixCalculated(const Transform &transform) {
+    if (isStructureDirty_) return false;
+    if (!hasDirtyNodes_.load(std::memory_order_relaxed)) return true;
+    for (std::int32_t node = static_cast<std::int32_t>(transform.GetHierarchyIndex()); node >= 0; node = parents_[node]) {
+        if (NeedsUpdate(static_cast<std::uint32_t>(node))) return false;
+    }
+    return true;
+}
+
+std::uint64_t TransformHierarchy::GetWorldMatrixVersion(const Transform &transform) {
+    EnsureStructure();
+    return worldVersions_[transform.GetHierarchyIndex()];
+}
+
+Transform *TransformHierarchy::GetParentTransform(const Transform &transform) {
+    if (!EnsureStructure()) {
+        // 再構築できない場合は、表の親のインデックスを使わずにUUIDから解決する
+        EmptyObject *parentObject = transform.GetParentObject();
+        Transform *parentTransform = parentObject ? parentObject->GetComponent<Transform>() : nullptr;
+        if (!parentTransform || parentTransform == &transform || parentTransform->GetHierarchy() != this) return nullptr;
+        return parentTransform;
+    }
+    const std::int32_t parent = parents_[transform.GetHierarchyIndex()];
+    return parent >= 0 ? owners_[parent] : nullptr;
+}
+
+void TransformHierarchy::UpdateWorldMatrices() {
+    assert(IsOwnerThread() && "TransformHierarchy::UpdateWorldMatrices must be called on the owner thread.");
+    EnsureStructure();
+    if (!hasDirtyNodes_.load(std::memory_order_relaxed)) return;
+    const std::uint32_t count = static_cast<std::uint32_t>(owners_.size());
+    for (std::uint32_t i = 0; i < count; ++i) {
+        UpdateNode(i);
+    }
+    hasDirtyNodes_.store(false, std::memory_order_relaxed);
+}
+
+void TransformHierarchy::RebuildOrder() {
+    assert(IsOwnerThread() && "TransformHierarchy structure must be rebuilt on the owner thread.");
+    isStructureDirty_ = false;
+    // インデックスが変わるため、これまでのフレームの途中の読み取りの控えは全て使えなくなる
+    structureGeneration_ = sNextStructureGeneration.fetch_add(1, std::memory_order_relaxed);
+    const std::uint32_t count = static_cast<std::uint32_t>(owners_.size());
+    if (count == 0) return;
+
+    // 親をUUIDから解決し直す（この表に属さないTransformや自分自身は親として扱わない）
+    std::vector<std::int32_t> resolvedParents(count, -1);
+    for (std::uint32_t i = 0; i < count; ++i) {
+        EmptyObject *parentObject = owners_[i]->GetParentObject();
+        Transform *parentTransform = parentObject ? parentObject->GetComponent<Transform>() : nullptr;
+        if (!parentTransform || parentTransform == owners_[i] || parentTransform->GetHierarchy() != this) continue;
+        resolvedParents[i] = static_cast<std::int32_t>(parentTransform->GetHierarchyIndex());
+    }
+
+    // 子の一覧をCSR形式で作り、根から深さ優先の前順で並べる（部分木が連続した範囲に収まる）
+    std::vector<std::uint32_t> childOffsets(count + 1, 0);
+    for (std::uint32_t i = 0; i < count; ++i) {
+        if (resolvedParents[i] >= 0) ++childOffsets[resolvedParents[i] + 1];
+    }
+    for (std::uint32_t i = 0; i < count; ++i) {
+        childOffsets[i + 1] += childOffsets[i];
+    }
+    std::vector<std::uint32_t> children(childOffsets[count]);
+    {
+        std::vector<std::uint32_t> cursor(childOffsets.begin(), childOffsets.end() - 1);
+        for (std::uint32_t i = 0; i < count; ++i) {
+            if (resolvedParents[i] >= 0) children[cursor[resolvedParents[i]]++] = i;
+        }
+    }
+
+    std::vector<std::uint32_t> order;
+    order.reserve(count);
+    std::vector<std::uint8_t> visited(count, 0);
+    std::vector<std::uint32_t> stack;
+    auto visitFrom = [&](std::uint32_t root) {
+        stack.push_back(root);
+        while (!stack.empty()) {
+            const std::uint32_t node = stack.back();
+            stack.pop_back();
+            if (visited[node]) continue;
+            visited[node] = 1;
+            order.push_back(node);
+            // 追加順を保つため、後ろの子から積む
+            for (std::uint32_t c = childOffsets[node + 1]; c > childOffsets[node]; --c) {
+                stack.push_back(children[c - 1]);
+            }
+        }
+    };
+    for (std::uint32_t i = 0; i < count; ++i) {
+        if (resolvedParents[i] < 0) visitFrom(i);
+    }
+    // 根から到達できないノード（UUIDの付け替え等で親子が循環した場合）は根として扱う
+    for (std::uint32_t i = 0; i < count; ++i) {
+        if (!visited[i]) {
+            resolvedParents[i] = -1;
+            visitFrom(i);
+        }
+    }
+
+    // 新しい順へ全配列を並べ替える
+    std::vector<std::int32_t> newIndexOf(count);
+    for (std::uint32_t n = 0; n < count; ++n) {
+        newIndexOf[order[n]] = static_cast<std::int32_t>(n);
+    }
+    std::vector<Transform *> owners(count);
+    std::vector<std::int32_t> parents(count);
+    std::vector<Matrix4x4> worldMatrices(count);
+    std::vector<std::uint64_t> worldVersions(count);
+    std::vector<std::uint64_t> parentVersions(count);
+    std::vector<std::uint8_t> dirty(count);
+    std::vector<std::uint64_t> localRevisions(count);
+    for (std::uint32_t n = 0; n < count; ++n) {
+        const std::uint32_t old = order[n];
+        owners[n] = owners_[old];
+        parents[n] = resolvedParents[old] >= 0 ? newIndexOf[resolvedParents[old]] : -1;
+        worldMatrices[n] = worldMatrices_[old];
+        worldVersions[n] = worldVersions_[old];
+        parentVersions[n] = parentVersions_[old];
+        dirty[n] = dirty_[old];
+        localRevisions[n] = localRevisions_[old];
+        owners[n]->SetHierarchyIndex(Passkey<TransformHierarchy>(), n);
+    }
+    owners_.swap(owners);
+    parents_.swap(parents);
+    worldMatrices_.swap(worldMatrices);
+    worldVersions_.swap(worldVersions);
+    parentVersions_.swap(parentVersions);
+    dirty_.swap(dirty);
+    localRevisions_.swap(localRevisions);
+
+    // 親が変わったノードはダーティフラグが立っていなくても親のバージョンの不一致で再計算されるため、
+    // 次の一括更新で必ず走査されるようにしておく
+    hasDirtyNodes_.store(true, std::memory_order_relaxed);
+}
+
+void TransformHierarchy::UpdateNode(std::uint32_t index) {
+    if (!NeedsUpdate(index)) return;
+    const Matrix4x4 local = owners_[index]->ComputeLocalMatrix();
+    const std::int32_t parent = parents_[index];
+    if (parent >= 0) {
+        worldMatrices_[index] = local * worldMatrices_[parent];
+        parentVersions_[index] = worldVersions_[parent];
+    } else {
+        worldMatrices_[index] = local;
+        parentVersions_[index] = 0;
+    }
+    worldVersions_[index] = nextVersion_++;
+    dirty_[index] = 0;
+    owners_[index]->SetWorldMatrix(Passkey<TransformHierarchy>(), worldMatrices_[index]);
+}
+
+} // namespace KashipanEngine
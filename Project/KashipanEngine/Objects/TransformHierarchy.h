@@ -0,0 +1,127 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "Math/Matrix4x4.h"
+
+namespace KashipanEngine {
+
+class Transform;
+
+/// @brief シーン内の全Transformの親子関係とワールド行列を保持する平坦な表
+/// @details 親のインデックス・ワールド行列・ダーティフラグ等を配列ごとに持ち（SoA）、
+///          構造が変わるたびに「親が必ず子より前に並ぶ」順へ並べ直す。
+///          UpdateWorldMatrices は先頭から1度走査するだけで、ローカル値が変わったノードと
+///          その子孫だけを再計算する。フレームの途中でワールド行列を読んだ場合も、
+///          祖先をインデックスでたどって必要な分だけを計算するため、UUIDの検索や再帰は発生しない。
+///          表へ書き込むのは UpdateWorldMatrices と構造の再構築だけで、どちらも表を所有するスレッド（メインスレッド）で行う。
+///          フレームの途中の読み取り（GetWorldMatrix）は表へ書き込まないため、構造の再構築が済んでいれば並列ジョブから同時に呼んでよい
+///          （Scene はコンポーネントの一括更新の各段の前に PrepareParallelReads で再構築を済ませる）。
+///          ただし、読み取るノードと祖先のローカル値を別のスレッドが同時に変更してはならない。
+///          その場で計算した値はスレッドごとの控えに残し、祖先を含めてローカル値が変わるまでは同じ計算を繰り返さない。
+///          ローカルのTRSはTransform側が保持する（リフレクションでメンバへの生ポインタを公開しているため）。
+///          親の解決（Transform::GetParentObject によるUUIDの検索）は構造の再構築時にのみ行い、
+///          オブジェクトの生成・削除・親の変更のたびに MarkStructureDirty で再構築を予約する
+class TransformHierarchy final {
+public:
+    static constexpr std::uint32_t kInvalidIndex = ~std::uint32_t{ 0 };
+
+    TransformHierarchy() = default;
+    ~TransformHierarchy() = default;
+    TransformHierarchy(const TransformHierarchy &) = delete;
+    TransformHierarchy &operator=(const TransformHierarchy &) = delete;
+    TransformHierarchy(TransformHierarchy &&) = delete;
+    TransformHierarchy &operator=(TransformHierarchy &&) = delete;
+
+    /// @brief Transformをノードとして登録する（インデックスは並べ直しで変わるため、Transform側へ都度書き戻す）
+    void AddNode(Transform *owner);
+    /// @brief ノードを取り除く（Transformの破棄時に呼ばれる）
+    void RemoveNode(std::uint32_t index);
+
+    /// @brief ローカルのTRSが変わったことを記録する
+    /// @details 他のノードには触れないため、異なるノードに対してであれば複数スレッドから同時に呼んでよい。
+    ///          変更回数とダーティフラグはフレームの途中の読み取りでも参照するため、このノードか子孫のワールド行列を
+    ///          別のスレッドが読んでいる間は呼ばないこと（ローカル値の変更そのものも読み取りと競合する）
+    void MarkLocalDirty(std::uint32_t index) noexcept {
+        // ダーティフラグが立った後の変更も、フレームの途中の読み取りの控えを無効にするため数える
+        ++localRevisions_[index];
+        if (dirty_[index]) return;
+        dirty_[index] = 1;
+        hasDirtyNodes_.store(true, std::memory_order_relaxed);
+    }
+    /// @brief 親子関係の再構築を予約する（親の変更、オブジェクトの生成・削除時）
+    void MarkStructureDirty() noexcept { isStructureDirty_ = true; }
+    /// @brief 予約された構造の再構築を済ませる（並列ジョブからワールド行列を読む前に、表を所有するスレッドで呼ぶ）
+    void PrepareParallelReads();
+
+    // 以下の取得系は構造の再構築（インデックスの変更）を伴う場合があるため、インデックスではなくTransformを受け取る
+
+    /// @brief ワールド行列を取得する（未計算の場合は祖先を含めて必要な分だけ計算する）
+    /// @details 計算した値は表へ書き戻さない（次の UpdateWorldMatrices で表へ反映される）。
+    ///          代わりに呼び出したスレッドの控えへ祖先の分も含めて残し、根から自身までのローカル値と構造が
+    ///          変わっていなければ次の呼び出しでは控えを返す（同じ祖先を持つ兄弟の読み取りでも祖先を計算し直さない）。
+    ///          控えを確かめるために祖先をたどる分（深さに比例する変更回数の合計）は毎回かかる。
+    ///          構造の再構築が予約されている場合、表を所有するスレッドからは再構築してから計算する。
+    ///          他のスレッドからは再構築せず、前回の一括更新の値を返す（並列ジョブの前に PrepareParallelReads を呼んでおくこと）
+    Matrix4x4 GetWorldMatrix(const Transform &transform);
+    /// @brief ワールド行列が計算済みで、祖先を含めて最新かどうか
+    bool IsWorldMatrixCalculated(const Transform &transform);
+    /// @brief ワールド行列を計算するたびに更新される値（表全体で一意）
+    std::uint64_t GetWorldMatrixVersion(const Transform &transform);
+    /// @brief 親のTransform（親が無い、または解決できない場合は nullptr）
+    Transform *GetParentTransform(const Transform &transform);
+
+    /// @brief 変更のあったノードとその子孫のワールド行列を、親から子の順に1度の走査で再計算する
+    /// @details 計算した値は各Transformのリフレクション用のワールド行列へも書き込む。表を所有するスレッドからのみ呼ぶこと
+    void UpdateWorldMatrices();
+
+    std::size_t GetNodeCount() const noexcept { return owners_.size(); }
+
+private:
+    /// @brief 親を解決し直し、親が子より前に並ぶ順へ全配列を並べ直す
+    void RebuildOrder();
+    /// @brief 予約された構造の再構築を行う（表を所有するスレッドからのみ。他のスレッドからは再構築せず false を返す）
+    bool EnsureStructure() {
+        if (!isStructureDirty_) return true;
+        if (!IsOwnerThread()) return false;
+        RebuildOrder();
+        return true;
+    }
+    /// @brief 親が最新であることを前提に、1ノード分のワールド行列を再計算が必要な場合のみ計算する
+    void UpdateNode(std::uint32_t index);
+    /// @brief 表を所有するスレッドからの呼び出しか（書き込みを伴う処理のアサート用）
+    bool IsOwnerThread() const noexcept { return std::this_thread::get_id() == ownerThreadID_; }
+    bool NeedsUpdate(std::uint32_t index) const {
+        if (dirty_[index]) return true;
+        // 親が外れて根になったノードは、前回の計算時の親のバージョン（0以外）が残っているため再計算する
+        const std::int32_t parent = parents_[index];
+        return parentVersions_[index] != (parent >= 0 ? worldVersions_[parent] : 0);
+    }
+
+    std::vector<Transform *> owners_;
+    /// @brief 親ノードのインデックス（親が無い場合は-1。常に自身より小さい）
+    std::vector<std::int32_t> parents_;
+    std::vector<Matrix4x4> worldMatrices_;
+    std::vector<std::uint64_t> worldVersions_;
+    /// @brief 最後に計算したときの親のworldVersions_（根として計算した場合は0）
+    std::vector<std::uint64_t> parentVersions_;
+    /// @brief ローカルのTRSが前回の計算以降に変わったか（並列書き込みに備えvector<bool>は使わない）
+    std::vector<std::uint8_t> dirty_;
+    /// @brief ローカルのTRSを変更した回数（増えるだけのため、根からの合計でフレームの途中の読み取りの控えを確かめられる）
+    std::vector<std::uint64_t> localRevisions_;
+
+    std::uint64_t nextVersion_ = 1;
+    /// @brief 構造を再構築するたびに全ての表を通して一意な値へ変わる（フレームの途中の読み取りの控えの照合用）
+    std::uint64_t structureGeneration_ = 0;
+    std::atomic<bool> hasDirtyNodes_{ false };
+    bool isStructureDirty_ = false;
+
+    /// @brief 表を所有する（生成した）スレッド
+    std::thread::id ownerThreadID_ = std::this_thread::get_id();
+};
+
+} // namespace KashipanEngine
@@ -15,7 +15,31 @@
 namespace KashipanEngine {
 
 namespace {
-float EvaluateTimelineFloat(const KeyframeTimeline &timeline, float time) {
+/// @brief sampledTime より後の最初のキーを探す（keyCursor は前回の区間の先頭キー）
+/// @details 前回の区間から数キー以内に見つかれば二分探索を省き、巻き戻し・シーク時のみ upper_bound に戻る
+std::vector<KeyframeNode>::const_iterator FindUpperKey(const KeyframeTimeline &timeline, float sampledTime, uint32_t &keyCursor) {
+    constexpr uint32_t kLinearSteps = 4;
+    const auto &keys = timeline.keys;
+    if (keyCursor < keys.size() && keys[keyCursor].time <= sampledTime) {
+        for (size_t index = keyCursor + 1; index < keys.size() && index <= keyCursor + kLinearSteps; ++index) {
+            if (sampledTime < keys[index].time) {
+                keyCursor = static_cast<uint32_t>(index - 1);
+                return keys.begin() + index;
+            }
+        }
+    }
+
+    const auto upper = std::upper_bound(keys.begin(), keys.end(), sampledTime,
+        [](float t, const KeyframeNode &key) {
+            return t < key.time;
+        });
+    if (upper != keys.begin() && upper != keys.end()) {
+        keyCursor = static_cast<uint32_t>(upper - keys.begin() - 1);
+    }
+    return upper;
+}
+
+float EvaluateTimelineFloat(const KeyframeTimeline &timeline, float time, uint32_t &keyCursor) {
     if (timeline.keys.empty()) return 0.0f;
     if (timeline.keys.size() == 1) return std::get<float>(timeline.keys.front().value);
 
@@ -31,10 +55,7 @@ float EvaluateTimelineFloat(const KeyframeTimeline &timeline, float time) {
         sampledTime = std::clamp(sampledTime, 0.0f, endTime);
     }
 
-    auto upper = std::upper_bound(timeline.keys.begin(), timeline.keys.end(), sampledTime,
-        [](float t, const KeyframeNode &key) {
-            return t < key.time;
-        });
+    const auto upper = FindUpperKey(timeline, sampledTime, keyCursor);
 
     if (upper == timeline.keys.begin()) return std::get<float>(timeline.keys.front().value);
     if (upper == timeline.keys.end()) return std::get<float>(timeline.keys.back().value);
@@ -45,7 +66,7 @@ float EvaluateTimelineFloat(const KeyframeTimeline &timeline, float time) {
     return Eased(std::get<float>(from.value), std::get<float>(to.value), normalized, from.easeType);
 }
 
-Vector3 EvaluateTimelineVector3(const KeyframeTimeline &timeline, float time) {
+Vector3 EvaluateTimelineVector3(const KeyframeTimeline &timeline, float time, uint32_t &keyCursor) {
     if (timeline.keys.empty()) return Vector3();
     if (timeline.keys.size() == 1) return std::get<Vector3>(timeline.keys.front().value);
 
@@ -61,10 +82,7 @@ Vector3 EvaluateTimelineVector3(const KeyframeTimeline &timeline, float time) {
         sampledTime = std::clamp(sampledTime, 0.0f, endTime);
     }
 
-    auto upper = std::upper_bound(timeline.keys.begin(), timeline.keys.end(), sampledTime,
-        [](float t, const KeyframeNode &key) {
-            return t < key.time;
-        });
+    const auto upper = FindUpperKey(timeline, sampledTime, keyCursor);
 
     if (upper == timeline.keys.begin()) return std::get<Vector3>(timeline.keys.front().value);
     if (upper == timeline.keys.end()) return std::get<Vector3>(timeline.keys.back().value);
@@ -82,7 +100,7 @@ Vector3 EvaluateTimelineVector3(const KeyframeTimeline &timeline, float time) {
     };
 }
 
-Quaternion EvaluateTimelineQuaternion(const KeyframeTimeline &timeline, float time) {
+Quaternion EvaluateTimelineQuaternion(const KeyframeTimeline &timeline, float time, uint32_t &keyCursor) {
     if (timeline.keys.empty()) return Quaternion::Identity();
     if (timeline.keys.size() == 1) return std::get<Quaternion>(timeline.keys.front().value);
 
@@ -98,10 +116,7 @@ Quaternion EvaluateTimelineQuaternion(const KeyframeTimeline &timeline, float ti
         sampledTime = std::clamp(sampledTime, 0.0f, endTime);
     }
 
-    auto upper = std::upper_bound(timeline.keys.begin(), timeline.keys.end(), sampledTime,
-        [](float t, const KeyframeNode &key) {
-            return t < key.time;
-        });
+    const auto upper = FindUpperKey(timeline, sampledTime, keyCursor);
 
     if (upper == timeline.keys.begin()) return std::get<Quaternion>(timeline.keys.front().value);
     if (upper == timeline.keys.end()) return std::get<Quaternion>(timeline.keys.back().value);
@@ -112,15 +127,15 @@ Quaternion EvaluateTimelineQuaternion(const KeyframeTimeline &timeline, float ti
     return Quaternion::Slerp(std::get<Quaternion>(from.value), std::get<Quaternion>(to.value), normalized);
 }
 
-KeyframeValue EvaluateTimeline(const KeyframeTimeline &timeline, float time) {
+KeyframeValue EvaluateTimeline(const KeyframeTimeline &timeline, float time, uint32_t &keyCursor) {
     switch (timeline.valueType) {
     case KeyframeValueType::Vector3:
-        return EvaluateTimelineVector3(timeline, time);
+        return EvaluateTimelineVector3(timeline, time, keyCursor);
     case KeyframeValueType::Quaternion:
-        return EvaluateTimelineQuaternion(timeline, time);
+        return EvaluateTimelineQuaternion(timeline, time, keyCursor);
     case KeyframeValueType::Float:
     default:
-        return EvaluateTimelineFloat(timeline, time);
+        return EvaluateTimelineFloat(timeline, time, keyCursor);
     }
 }
 
@@ -175,12 +190,13 @@ bool KeyframeAnimator::PlayFromAnimationHandle(uint32_t handle, const std::strin
     timelines_.clear();
     playbackStates_.clear();
 
-    for (const auto &src : clip->timelines) {
+    for (uint32_t timelineIndex = 0; timelineIndex < clip->timelines.size(); ++timelineIndex) {
+        const auto &src = clip->timelines[timelineIndex];
         KeyframeTimeline timeline;
         timeline.name = src.name;
         timeline.duration = src.duration;
         timeline.valueType = src.valueType;
-        timeline.keys = src.keys;
+        timeline.keys = clip->GetTimelineKeys(timelineIndex);
         timeline.loop = loop;
 
         if (transform) {
@@ -297,7 +313,7 @@ bool KeyframeAnimator::PlayFromAnimationAndSkeletonHandle(uint32_t animationHand
             timeline.name = src.name;
             timeline.duration = src.duration;
             timeline.valueType = src.valueType;
-            timeline.keys = src.keys;
+            timeline.keys = clip->GetTimelineKeys(timelineIndex);
             timeline.loop = loop;
 
             auto *transform = joint.transform.get();
@@ -416,7 +432,7 @@ void KeyframeAnimator::Update() {
         state.elapsedTime += dt;
 
         const auto &timeline = timelineIt->second;
-        const auto value = EvaluateTimeline(timeline, state.elapsedTime);
+        const auto value = EvaluateTimeline(timeline, state.elapsedTime, state.keyCursor);
         for (const auto &apply : timeline.applyFunctions) {
             if (const auto fn = std::get_if<std::function<void(float)>>(&apply)) {
                 if (const auto v = std::get_if<float>(&value)) {
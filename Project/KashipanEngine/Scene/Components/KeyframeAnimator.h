@@ -1,8 +1,8 @@
 #pragma once
 #include <cstdint>
-#include <variant>
 
 #include "Scene/Components/SceneComponentHeader.h"
+#include "Scene/Components/KeyframeTimeline.h"
 #include "Math/Quaternion.h"
 #include "Math/Vector3.h"
 #include "Utilities/FileIO/JSON.h"
@@ -10,44 +10,6 @@
 
 namespace KashipanEngine {
 
-enum class KeyframeValueType {
-    Float,
-    Vector3,
-    Quaternion
-};
-
-using KeyframeValue = std::variant<float, Vector3, Quaternion>;
-using KeyframeApplyFunction = std::variant<
-    std::function<void(float)>,
-    std::function<void(const Vector3 &)>,
-    std::function<void(const Quaternion &)>>;
-
-/// @brief キーフレームのノード
-struct KeyframeNode {
-    /// @brief キーフレームの時間（秒）
-    float time = 0.0f;
-    /// @brief キーフレームの値
-    KeyframeValue value = 0.0f;
-    /// @brief このキーから次のキーまでのイージング種別
-    EaseType easeType = EaseType::Linear;
-};
-
-/// @brief キーフレームタイムライン
-struct KeyframeTimeline {
-    /// @brief タイムライン名
-    std::string name;
-    /// @brief タイムラインの総時間（秒）
-    float duration = 0.0f;
-    /// @brief タイムラインの値型
-    KeyframeValueType valueType = KeyframeValueType::Float;
-    /// @brief タイムラインのキーフレームノードリスト（バラバラであってもKeyframeAnimatorクラス側で自動ソートされる）
-    std::vector<KeyframeNode> keys;
-    /// @brief タイムラインの適用関数リスト
-    std::vector<KeyframeApplyFunction> applyFunctions;
-    /// @brief タイムラインがループするかどうか
-    bool loop = false;
-};
-
 /// @brief キーフレームの再生状態
 struct KeyframePlaybackState {
     /// @brief 再生中のタイムライン名
@@ -60,6 +22,8 @@ struct KeyframePlaybackState {
     bool paused = false;
     /// @brief 再生中のスケルトンハンドル（スケルトンアニメーションの場合）
     uint32_t skeletonHandle = 0;
+    /// @brief 前回評価したキー区間の先頭インデックス（前方再生時の二分探索を省く）
+    uint32_t keyCursor = 0;
 };
 
 /// @brief キーフレームアニメーターシーンコンポーネント
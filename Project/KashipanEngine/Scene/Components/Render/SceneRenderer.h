@@ -98,7 +98,9 @@ public:
     void UnregisterCameraRenderer(const CameraRenderer *renderer);
     void RegisterLightRenderer(LightRenderer *renderer);
     void UnregisterLightRenderer(const LightRenderer *renderer);
-    /// @brief GPU Simulation有効なParticleSystem2D/3Dを登録する（ParticleSystemBase::Initialize/SwitchSimulationModeから呼ばれる）
+    /// @brief インスタンス描画するParticleSystem2D/3Dを登録する（ParticleSystemBaseから呼ばれる）
+    /// @details GPU Simulation有効なものに加え、オブジェクトを使わないCPU Simulationのものも含む
+    ///          （コンピュート処理の対象かはIsGPUSimulationで判別する）
     void RegisterGpuParticleEmitter(ParticleSystemBase *emitter);
     void UnregisterGpuParticleEmitter(const ParticleSystemBase *emitter);
     /// @brief ポストエフェクトコンポーネントを登録する（IPostProcessComponent::Initialize/Finalizeから呼ばれる）
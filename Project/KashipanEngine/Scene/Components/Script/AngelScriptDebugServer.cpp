@@ -1048,6 +1048,10 @@ void AngelScriptDebugServer::AttachContext(asIScriptContext *context) const {
     impl_->AttachContext(context);
 }
 
+void AngelScriptDebugServer::OnLine(asIScriptContext *context) const {
+    Impl::DebugLineCallback(context, impl_.get());
+}
+
 AngelScriptDebugServer &GetProcessAngelScriptDebugServer() {
     static AngelScriptDebugServer server;
     return server;
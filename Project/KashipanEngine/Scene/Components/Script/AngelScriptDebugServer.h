@@ -30,6 +30,10 @@ public:
     /// @brief AngelScriptコンテキストへデバッグ用ラインコールバックを設定する
     void AttachContext(asIScriptContext *context) const;
 
+    /// @brief 1行分のデバッグ処理（ブレークポイント・ステップ判定）を行う
+    /// @details 他の用途と共有するラインコールバック（ScriptContextPool）から転送する場合に使う
+    void OnLine(asIScriptContext *context) const;
+
 private:
     struct Impl;
     std::unique_ptr<Impl> impl_;
@@ -1,5 +1,7 @@
 #include "Scene/Components/Script/SceneScriptEngine.h"
 
+#include <algorithm>
+
 #include <angelscript.h>
 #include <add_on/scriptarray/scriptarray.h>
 #include <add_on/scriptstdstring/scriptstdstring.h>
@@ -55,6 +57,7 @@ void SceneScriptEngine::Initialize() {
     RegisterScriptDictionary(engine_);
     RegisterExceptionRoutines(engine_);
     RegisterEngineScriptBindings(engine_);
+    moduleCache_ = std::make_unique<ScriptModuleCache>(this, engine_);
 
 #if !defined(RELEASE_BUILD)
     auto &debugServer = GetProcessAngelScriptDebugServer();
@@ -62,6 +65,8 @@ void SceneScriptEngine::Initialize() {
         debugServer_ = &debugServer;
     }
 #endif
+    profiler_ = std::make_unique<ScriptProfiler>();
+    contextPool_ = std::make_unique<ScriptContextPool>(engine_, debugServer_, profiler_.get());
 
 #if !defined(RELEASE_BUILD)
     // VSCodeのAngelScript Language Server用の型定義ファイルを生成する（Releaseビルドでは生成しない）
@@ -73,12 +78,6 @@ void SceneScriptEngine::Initialize() {
 #endif
 }
 
-void SceneScriptEngine::AttachDebugger(asIScriptContext *context) const {
-    if (debugServer_) {
-        debugServer_->AttachContext(context);
-    }
-}
-
 void SceneScriptEngine::BeginMessageCapture() {
     messageCaptureBuffer_.clear();
     gActiveMessageCapture = &messageCaptureBuffer_;
@@ -94,6 +93,10 @@ void SceneScriptEngine::Finalize() {
         gActiveMessageCapture = nullptr;
     }
     debugServer_ = nullptr;
+    // コンテキストが参照している関数を先に手放してから、キャッシュ中のモジュールをエンジンの終了前に破棄する
+    contextPool_.reset();
+    profiler_.reset();
+    moduleCache_.reset();
     if (engine_) {
         engine_->ShutDownAndRelease();
         engine_ = nullptr;
@@ -108,6 +111,79 @@ void SceneScriptEngine::ShowImGui() {
     if (engine_) {
         ImGui::Text("%s%d", TranslationC("editor.scriptengine.modules"), static_cast<int>(engine_->GetModuleCount()));
     }
+    if (moduleCache_) {
+        ImGui::Text(TranslationC("editor.scriptengine.modulecache_d_d_d"), static_cast<int>(moduleCache_->GetEntryCount()),
+            static_cast<int>(moduleCache_->GetCompileCount()), static_cast<int>(moduleCache_->GetHitCount()));
+        ImGui::Text(TranslationC("editor.scriptengine.bytecodecache_d"), static_cast<int>(moduleCache_->GetDiskLoadCount()));
+    }
+    if (contextPool_) {
+        ImGui::Text(TranslationC("editor.scriptengine.contextpool_d_d"), static_cast<int>(contextPool_->GetCreatedCount()),
+            static_cast<int>(contextPool_->GetIdleCount()));
+    }
+
+    if (!profiler_ || !ImGui::CollapsingHeader(TranslationLabel("editor.scriptengine.profiler"))) return;
+    bool isInstrumentationEnabled = profiler_->IsInstrumentationEnabled();
+    if (ImGui::Checkbox(TranslationLabel("editor.scriptengine.profiler.instrumentation"), &isInstrumentationEnabled)) {
+        profiler_->SetInstrumentationEnabled(isInstrumentationEnabled);
+    }
+    bool isSamplingEnabled = profiler_->IsSamplingEnabled();
+    if (ImGui::Checkbox(TranslationLabel("editor.scriptengine.profiler.sampling"), &isSamplingEnabled)) {
+        profiler_->SetSamplingEnabled(isSamplingEnabled);
+        if (contextPool_) contextPool_->RefreshLineCallbacks();
+    }
+    int intervalUs = static_cast<int>(profiler_->GetSamplingIntervalMicroseconds());
+    if (ImGui::DragInt(TranslationLabel("editor.scriptengine.profiler.interval"), &intervalUs, 10.0f, 50, 100000)) {
+        profiler_->SetSamplingIntervalMicroseconds(static_cast<std::uint32_t>(std::max(intervalUs, 50)));
+    }
+    if (ImGui::Button(TranslationLabel("editor.scriptengine.profiler.reset"))) {
+        profiler_->Reset();
+    }
+    ImGui::SameLine();
+    if (ImGui::Button(TranslationLabel("editor.scriptengine.profiler.export"))) {
+        const std::string path = ProjectPaths::InProjectRoot("ScriptProfile.json");
+        if (profiler_->ExportToJsonFile(path)) {
+            Log(Translation("editor.scriptengine.profiler.exported") + path, LogSeverity::Info);
+        }
+    }
+    ImGui::Text(TranslationC("editor.scriptengine.profiler.summary_1f_d"), profiler_->GetElapsedMs(),
+        static_cast<int>(profiler_->GetSampleCount()));
+
+    // 自己時間（サンプリングのみの場合は自己サンプル数）の多い順に上位を表示する
+    const auto &stats = profiler_->GetStats();
+    std::vector<size_t> order(stats.size());
+    for (size_t i = 0; i < order.size(); ++i) order[i] = i;
+    std::sort(order.begin(), order.end(), [&stats](size_t a, size_t b) {
+        if (stats[a].selfMs != stats[b].selfMs) return stats[a].selfMs > stats[b].selfMs;
+        return stats[a].selfSamples > stats[b].selfSamples;
+    });
+    constexpr size_t kMaxRows = 32;
+    if (ImGui::BeginTable("##ScriptProfiler", 6, ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders)) {
+        ImGui::TableSetupColumn(TranslationC("editor.scriptengine.profiler.function"), ImGuiTableColumnFlags_WidthStretch);
+        ImGui::TableSetupColumn(TranslationC("editor.scriptengine.profiler.calls"));
+        ImGui::TableSetupColumn(TranslationC("editor.scriptengine.profiler.totalms"));
+        ImGui::TableSetupColumn(TranslationC("editor.scriptengine.profiler.selfms"));
+        ImGui::TableSetupColumn(TranslationC("editor.scriptengine.profiler.selfsamples"));
+        ImGui::TableSetupColumn(TranslationC("editor.scriptengine.profiler.totalsamples"));
+        ImGui::TableHeadersRow();
+        for (size_t row = 0; row < std::min(order.size(), kMaxRows); ++row) {
+            const auto &entry = stats[order[row]];
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(entry.declaration.c_str());
+            if (!entry.section.empty()) ImGui::SetItemTooltip("%s", entry.section.c_str());
+            ImGui::TableNextColumn();
+            ImGui::Text("%llu", static_cast<unsigned long long>(entry.callCount));
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", entry.totalMs);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", entry.selfMs);
+            ImGui::TableNextColumn();
+            ImGui::Text("%llu", static_cast<unsigned long long>(entry.selfSamples));
+            ImGui::TableNextColumn();
+            ImGui::Text("%llu", static_cast<unsigned long long>(entry.totalSamples));
+        }
+        ImGui::EndTable();
+    }
 }
 #endif
 
@@ -3,6 +3,9 @@
 #include <vector>
 
 #include "Scene/Components/SceneComponentHeader.h"
+#include "Scene/Components/Script/ScriptContextPool.h"
+#include "Scene/Components/Script/ScriptModuleCache.h"
+#include "Scene/Components/Script/ScriptProfiler.h"
 
 class asIScriptEngine;
 class asIScriptContext;
@@ -27,10 +30,15 @@ public:
 
     /// @brief 共有スクリプトエンジンを取得（未初期化の場合は nullptr）
     asIScriptEngine *GetEngine() const noexcept { return engine_; }
+    /// @brief スクリプトのコンパイル結果を共有するキャッシュを取得（未初期化・終了後は nullptr）
+    ScriptModuleCache *GetModuleCache() const noexcept { return moduleCache_.get(); }
 
-    /// @brief コンテキストをVS Code用DAPデバッガーへ接続する
-    /// @details Releaseビルドまたはデバッグサーバーを開始できなかった場合は何もしない
-    void AttachDebugger(asIScriptContext *context) const;
+    /// @brief スクリプト実行用コンテキストのプールを取得（未初期化・終了後は nullptr）
+    /// @details プールのコンテキストはVS Code用DAPデバッガーへ接続済み（Releaseビルド等でサーバーが無い場合を除く）。
+    ///          関数の呼び出しには通常 ScriptCall を使う
+    ScriptContextPool *GetContextPool() const noexcept { return contextPool_.get(); }
+    /// @brief スクリプト関数のプロファイラーを取得（未初期化・終了後は nullptr）
+    ScriptProfiler *GetProfiler() const noexcept { return profiler_.get(); }
 
     /// @brief スクリプトビルド時のコンパイルメッセージの収集を開始する
     /// @details 収集中もログへの出力は行われる。ScriptComponentがビルドエラーの詳細表示に使用する
@@ -48,6 +56,9 @@ protected:
 
 private:
     asIScriptEngine *engine_ = nullptr;
+    std::unique_ptr<ScriptModuleCache> moduleCache_;
+    std::unique_ptr<ScriptProfiler> profiler_;
+    std::unique_ptr<ScriptContextPool> contextPool_;
     /// @brief プロセス共通DAPサーバーへの非所有ポインター
     AngelScriptDebugServer *debugServer_ = nullptr;
     /// @brief メッセージ収集用バッファ（BeginMessageCapture～EndMessageCaptureの間だけ使用）
@@ -2,11 +2,10 @@
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <cmath>
 #include <cstdint>
 #include <cstdlib>
-#include <fstream>
-#include <map>
 #include <string_view>
 #include <unordered_map>
 
@@ -32,6 +31,7 @@
 #include "Objects/ObjectContext.h"
 #include "Scene/Scene.h"
 #include "Scene/SceneContext.h"
+#include "Scene/SceneFileIO.h"
 #if defined(USE_IMGUI)
 #include "Scene/Components/Script/EditorToolManager.h"
 #endif
@@ -40,10 +40,12 @@
 #include "Utilities/MyAny.h"
 #include "Utilities/RandomValue.h"
 #include "Utilities/StageGraphGenerator.h"
+#include "Utilities/StageGenerationService.h"
 #include "Utilities/StageGridBuilder.h"
 #include "Utilities/TimeUtils.h"
 #include "Utilities/ValueType.h"
 #include "Utilities/WaveFunctionCollapse.h"
+#include "Utilities/ChunkedWaveFunctionCollapse.h"
 
 // オブジェクトコンポーネント（全種類をスクリプトへ登録する）
 #include "Objects/Components/Animator.h"
@@ -521,7 +523,7 @@ void RegisterTransformType(asIScriptEngine *engine) {
         .method("const Quaternion &GetRotateQuaternion() const", &Transform::GetRotateQuaternion)
         .method("void SetScale(const Vector3 &in)", &Transform::SetScale)
         .method("const Vector3 &GetScale() const", &Transform::GetScale)
-        .method("const Matrix4x4 &GetWorldMatrix()", &Transform::GetWorldMatrix)
+        .method("Matrix4x4 GetWorldMatrix()", &Transform::GetWorldMatrix)
         .method("Vector3 GetWorldPosition()", &Transform::GetWorldPosition)
         .method("Vector3 GetWorldRotate() const", &Transform::GetWorldRotate)
         .method("Quaternion GetWorldRotateQuaternion() const", &Transform::GetWorldRotateQuaternion)
@@ -2165,6 +2167,18 @@ void RegisterWaveFunctionCollapseBindings(asIScriptEngine *engine) {
                 z = (*position)[2];
                 return true;
             })
+        .method("void SetMaxBacktracks(uint maxBacktracks)", [](ScriptWaveFunctionCollapse &self, std::uint32_t maxBacktracks) {
+            self.data.SetMaxBacktracks(maxBacktracks);
+        })
+        .method("uint GetMaxBacktracks() const", [](const ScriptWaveFunctionCollapse &self) -> std::uint32_t {
+            return self.data.GetMaxBacktracks();
+        })
+        .method("void SetMaxRestarts(uint maxRestarts)", [](ScriptWaveFunctionCollapse &self, std::uint32_t maxRestarts) {
+            self.data.SetMaxRestarts(maxRestarts);
+        })
+        .method("uint GetMaxRestarts() const", [](const ScriptWaveFunctionCollapse &self) -> std::uint32_t {
+            return self.data.GetMaxRestarts();
+        })
         .method("bool Solve()", [](ScriptWaveFunctionCollapse &self) -> bool { return self.data.Solve(); })
         .method("bool TryGetResolvedTile(uint x, uint y, uint z, string &out tileName) const",
             [](const ScriptWaveFunctionCollapse &self, std::uint32_t x, std::uint32_t y, std::uint32_t z, std::string &tileName) -> bool {
@@ -2181,6 +2195,95 @@ void RegisterWaveFunctionCollapseBindings(asIScriptEngine *engine) {
         });
 }
 
+/// @brief スクリプト用のChunkedWaveFunctionCollapseラッパー（参照カウント式の参照型）
+class ScriptChunkedWaveFunctionCollapse final {
+public:
+    ScriptChunkedWaveFunctionCollapse() = default;
+
+    void AddRef() { refCount_.fetch_add(1, std::memory_order_relaxed); }
+    void Release() {
+        if (refCount_.fetch_sub(1, std::memory_order_acq_rel) == 1) delete this;
+    }
+
+    ChunkedWaveFunctionCollapse data;
+
+private:
+    ~ScriptChunkedWaveFunctionCollapse() = default;
+    std::atomic<int> refCount_{1};
+};
+
+/// @brief ChunkedWaveFunctionCollapse型（参照型）を登録する
+/// @details チャンク座標はスクリプトに構造体を増やさず、int3つで受け渡す
+void RegisterChunkedWaveFunctionCollapseBindings(asIScriptEngine *engine) {
+    asbind20::ref_class<ScriptChunkedWaveFunctionCollapse>(engine, "ChunkedWaveFunctionCollapse")
+        .default_factory()
+        .addref(&ScriptChunkedWaveFunctionCollapse::AddRef)
+        .release(&ScriptChunkedWaveFunctionCollapse::Release)
+        .method("bool Setup(WaveFunctionCollapse@ wfc, bool bounded = true)",
+            [](ScriptChunkedWaveFunctionCollapse &self, ScriptWaveFunctionCollapse *wfc, bool bounded) -> bool {
+                if (!wfc) return false;
+                return self.data.Setup(wfc->data, bounded);
+            })
+        .method("void SetChunkSize(uint sizeX, uint sizeY, uint sizeZ)",
+            [](ScriptChunkedWaveFunctionCollapse &self, std::uint32_t sizeX, std::uint32_t sizeY, std::uint32_t sizeZ) {
+                self.data.SetChunkSize(sizeX, sizeY, sizeZ);
+            })
+        .method("uint GetChunkSizeX() const", [](const ScriptChunkedWaveFunctionCollapse &self) -> std::uint32_t {
+            return self.data.GetChunkSizeX();
+        })
+        .method("uint GetChunkSizeY() const", [](const ScriptChunkedWaveFunctionCollapse &self) -> std::uint32_t {
+            return self.data.GetChunkSizeY();
+        })
+        .method("uint GetChunkSizeZ() const", [](const ScriptChunkedWaveFunctionCollapse &self) -> std::uint32_t {
+            return self.data.GetChunkSizeZ();
+        })
+        .method("void SetWorldSeed(uint seed)", [](ScriptChunkedWaveFunctionCollapse &self, std::uint32_t seed) {
+            self.data.SetWorldSeed(seed);
+        })
+        .method("uint GetWorldSeed() const", [](const ScriptChunkedWaveFunctionCollapse &self) -> std::uint32_t {
+            return self.data.GetWorldSeed();
+        })
+        .method("bool GenerateChunk(int chunkX, int chunkY, int chunkZ)",
+            [](ScriptChunkedWaveFunctionCollapse &self, std::int32_t chunkX, std::int32_t chunkY, std::int32_t chunkZ) -> bool {
+                return self.data.GenerateChunk(WfcChunkCoord{ chunkX, chunkY, chunkZ });
+            })
+        .method("bool GenerateAround(int x, int y, int z, uint radius)",
+            [](ScriptChunkedWaveFunctionCollapse &self, std::int32_t x, std::int32_t y, std::int32_t z, std::uint32_t radius) -> bool {
+                return self.data.GenerateAround(x, y, z, radius);
+            })
+        .method("bool IsChunkGenerated(int chunkX, int chunkY, int chunkZ) const",
+            [](const ScriptChunkedWaveFunctionCollapse &self, std::int32_t chunkX, std::int32_t chunkY, std::int32_t chunkZ) -> bool {
+                return self.data.IsChunkGenerated(WfcChunkCoord{ chunkX, chunkY, chunkZ });
+            })
+        .method("void GetChunkCoordOfTile(int x, int y, int z, int &out chunkX, int &out chunkY, int &out chunkZ) const",
+            [](const ScriptChunkedWaveFunctionCollapse &self, std::int32_t x, std::int32_t y, std::int32_t z,
+                std::int32_t &chunkX, std::int32_t &chunkY, std::int32_t &chunkZ) {
+                const WfcChunkCoord coord = self.data.GetChunkCoordOfTile(x, y, z);
+                chunkX = coord.x;
+                chunkY = coord.y;
+                chunkZ = coord.z;
+            })
+        .method("void ReleaseChunk(int chunkX, int chunkY, int chunkZ)",
+            [](ScriptChunkedWaveFunctionCollapse &self, std::int32_t chunkX, std::int32_t chunkY, std::int32_t chunkZ) {
+                self.data.ReleaseChunk(WfcChunkCoord{ chunkX, chunkY, chunkZ });
+            })
+        .method("void ReleaseChunksOutside(int x, int y, int z, uint radius)",
+            [](ScriptChunkedWaveFunctionCollapse &self, std::int32_t x, std::int32_t y, std::int32_t z, std::uint32_t radius) {
+                self.data.ReleaseChunksOutside(x, y, z, radius);
+            })
+        .method("void ClearChunks()", [](ScriptChunkedWaveFunctionCollapse &self) { self.data.ClearChunks(); })
+        .method("uint GetGeneratedChunkCount() const", [](const ScriptChunkedWaveFunctionCollapse &self) -> std::uint32_t {
+            return static_cast<std::uint32_t>(self.data.GetGeneratedChunkCount());
+        })
+        .method("bool TryGetTile(int x, int y, int z, string &out tileName) const",
+            [](const ScriptChunkedWaveFunctionCollapse &self, std::int32_t x, std::int32_t y, std::int32_t z, std::string &tileName) -> bool {
+                auto tile = self.data.GetTile(x, y, z);
+                if (!tile) return false;
+                tileName = *tile;
+                return true;
+            });
+}
+
 //==================================================
 // ステージ生成（Utilities/StageGraphGenerator.h, Utilities/StageGridBuilder.h）
 //==================================================
@@ -2219,7 +2322,24 @@ private:
     std::atomic<int> refCount_{1};
 };
 
-/// @brief RoomType列挙、StageGraphGenerator型、StageGridBuilder型を登録する
+/// @brief スクリプト用のStageGenerationTaskラッパー（参照カウント式の参照型。StageGeneration::Requestでのみ生成する）
+class ScriptStageGenerationTask final {
+public:
+    explicit ScriptStageGenerationTask(std::shared_ptr<StageGenerationTask> task) : data(std::move(task)) {}
+
+    void AddRef() { refCount_.fetch_add(1, std::memory_order_relaxed); }
+    void Release() {
+        if (refCount_.fetch_sub(1, std::memory_order_acq_rel) == 1) delete this;
+    }
+
+    std::shared_ptr<StageGenerationTask> data;
+
+private:
+    ~ScriptStageGenerationTask() = default;
+    std::atomic<int> refCount_{1};
+};
+
+/// @brief RoomType列挙、StageGraphGenerator型、StageGridBuilder型、非同期生成（StageGeneration::Request）を登録する
 /// @details WaveFunctionCollapseと同じ理由（列挙のサイズ差）で、RoomType引数を取るメソッドは
 ///          ラムダ側でuintとして受け取り、内部でRoomTypeへキャストする
 void RegisterStageGenerationBindings(asIScriptEngine *engine) {
@@ -2324,6 +2444,9 @@ void RegisterStageGenerationBindings(asIScriptEngine *engine) {
         .method("void SetTileWorldSize(float size)", [](ScriptStageGridBuilder &self, float size) {
             self.data.SetTileWorldSize(size);
         })
+        .method("float GetTileWorldSize() const", [](const ScriptStageGridBuilder &self) -> float {
+            return self.data.GetTileWorldSize();
+        })
         .method("void SetRoomTileName(RoomType type, const string &in tileName)",
             [](ScriptStageGridBuilder &self, std::uint32_t type, const std::string &tileName) {
                 self.data.SetRoomTileName(static_cast<RoomType>(type), tileName);
@@ -2348,11 +2471,110 @@ void RegisterStageGenerationBindings(asIScriptEngine *engine) {
             [](const ScriptStageGridBuilder &self, const ScriptStageGraphGenerator &graph, std::uint32_t roomID, Vector3 &position) -> bool {
                 return self.data.GetRoomWorldCenter(graph.data, roomID, position);
             })
+        .method("void WorldToGrid(const Vector3 &in position, int &out x, int &out y, int &out z) const",
+            [](const ScriptStageGridBuilder &self, const Vector3 &position, std::int32_t &x, std::int32_t &y, std::int32_t &z) {
+                self.data.WorldToGrid(position, x, y, z);
+            })
         .method("void GetRequiredGridSize(const StageGraphGenerator &in graph, uint &out width, uint &out height, uint &out depth) const",
             [](const ScriptStageGridBuilder &self, const ScriptStageGraphGenerator &graph,
                 std::uint32_t &width, std::uint32_t &height, std::uint32_t &depth) {
                 self.data.GetRequiredGridSize(graph.data, width, height, depth);
             });
+
+    using TaskState = StageGenerationTask::State;
+    using TaskPhase = StageGenerationTask::Phase;
+    engine->RegisterEnum("StageGenerationState");
+    engine->RegisterEnumValue("StageGenerationState", "Pending", static_cast<int>(TaskState::Pending));
+    engine->RegisterEnumValue("StageGenerationState", "Running", static_cast<int>(TaskState::Running));
+    engine->RegisterEnumValue("StageGenerationState", "Completed", static_cast<int>(TaskState::Completed));
+    engine->RegisterEnumValue("StageGenerationState", "Failed", static_cast<int>(TaskState::Failed));
+    engine->RegisterEnumValue("StageGenerationState", "Cancelled", static_cast<int>(TaskState::Cancelled));
+    engine->RegisterEnum("StageGenerationPhase");
+    engine->RegisterEnumValue("StageGenerationPhase", "Queued", static_cast<int>(TaskPhase::Queued));
+    engine->RegisterEnumValue("StageGenerationPhase", "Cache", static_cast<int>(TaskPhase::Cache));
+    engine->RegisterEnumValue("StageGenerationPhase", "Graph", static_cast<int>(TaskPhase::Graph));
+    engine->RegisterEnumValue("StageGenerationPhase", "Grid", static_cast<int>(TaskPhase::Grid));
+    engine->RegisterEnumValue("StageGenerationPhase", "Tiles", static_cast<int>(TaskPhase::Tiles));
+    engine->RegisterEnumValue("StageGenerationPhase", "Done", static_cast<int>(TaskPhase::Done));
+
+    asbind20::ref_class<ScriptStageGenerationTask>(engine, "StageGenerationTask")
+        .addref(&ScriptStageGenerationTask::AddRef)
+        .release(&ScriptStageGenerationTask::Release)
+        .method("StageGenerationState GetState() const", [](const ScriptStageGenerationTask &self) -> std::uint32_t {
+            return static_cast<std::uint32_t>(self.data->GetState());
+        })
+        .method("StageGenerationPhase GetPhase() const", [](const ScriptStageGenerationTask &self) -> std::uint32_t {
+            return static_cast<std::uint32_t>(self.data->GetPhase());
+        })
+        .method("bool IsDone() const", [](const ScriptStageGenerationTask &self) -> bool { return self.data->IsDone(); })
+        .method("float GetProgress() const", [](const ScriptStageGenerationTask &self) -> float { return self.data->GetProgress(); })
+        .method("bool IsCacheHit() const", [](const ScriptStageGenerationTask &self) -> bool { return self.data->IsCacheHit(); })
+        .method("void Cancel()", [](ScriptStageGenerationTask &self) { self.data->Cancel(); })
+        .method("StageGraphGenerator@ GetGraph() const", [](const ScriptStageGenerationTask &self) -> ScriptStageGraphGenerator * {
+            auto result = self.data->GetResult();
+            if (!result) return nullptr;
+            auto *graph = new ScriptStageGraphGenerator();
+            graph->data = result->graph;
+            return graph;
+        })
+        .method("uint GetGridWidth() const", [](const ScriptStageGenerationTask &self) -> std::uint32_t {
+            auto result = self.data->GetResult();
+            return result ? result->gridWidth : 0;
+        })
+        .method("uint GetGridHeight() const", [](const ScriptStageGenerationTask &self) -> std::uint32_t {
+            auto result = self.data->GetResult();
+            return result ? result->gridHeight : 0;
+        })
+        .method("uint GetGridDepth() const", [](const ScriptStageGenerationTask &self) -> std::uint32_t {
+            auto result = self.data->GetResult();
+            return result ? result->gridDepth : 0;
+        })
+        .method("bool TryGetTile(uint x, uint y, uint z, string &out tileName) const",
+            [](const ScriptStageGenerationTask &self, std::uint32_t x, std::uint32_t y, std::uint32_t z, std::string &tileName) -> bool {
+                auto result = self.data->GetResult();
+                const std::string *tile = result ? result->GetTile(x, y, z) : nullptr;
+                if (!tile) return false;
+                tileName = *tile;
+                return true;
+            });
+
+    asbind20::namespace_ stageGenerationNamespace(engine, "StageGeneration");
+    asbind20::global(engine)
+        .function("StageGenerationTask@ Request(uint seed, const StageGraphGenerator &in graph, const StageGridBuilder &in builder, "
+            "WaveFunctionCollapse@ tileSet, uint chunkSize = 32, bool useDiskCache = true)",
+            [](std::uint32_t seed, const ScriptStageGraphGenerator &graph, const ScriptStageGridBuilder &builder,
+                ScriptWaveFunctionCollapse *tileSet, std::uint32_t chunkSize, bool useDiskCache) -> ScriptStageGenerationTask * {
+                if (!tileSet) return nullptr;
+                StageGenerationOptions options;
+                options.chunkSize = chunkSize;
+                options.useDiskCache = useDiskCache;
+                return new ScriptStageGenerationTask(
+                    StageGenerationService::Request(seed, graph.data, builder.data, tileSet->data, options));
+            })
+        .function("void ClearMemoryCache()", [] { StageGenerationService::ClearMemoryCache(); });
+}
+
+//==================================================
+// シーンファイル（Scene/SceneFileIO.h）
+//==================================================
+
+/// @brief SceneFile:: 名前空間へシーンファイルの形式変換・読み込み計測を登録する
+void RegisterSceneFileBindings(asIScriptEngine *engine) {
+    asbind20::namespace_ sceneFileNamespace(engine, "SceneFile");
+    asbind20::global(engine)
+        // compress は変換先が .kscene の場合だけ使う（既定は非圧縮。読み込み時にメモリマップを直接参照できる）
+        .function("bool Convert(const string &in sourcePath, const string &in destinationPath, bool compress = false)",
+            [](const std::string &sourcePath, const std::string &destinationPath, bool compress) -> bool {
+                return ConvertSceneFile(sourcePath, destinationPath, compress);
+            })
+        // シーンの構築は含めず、ファイルからシーンJSONを得るまでの時間を計る（失敗した場合は負の値）
+        .function("double MeasureLoadMilliseconds(const string &in path)", [](const std::string &path) -> double {
+            const auto start = std::chrono::steady_clock::now();
+            const JSON sceneJson = LoadSceneFromPath(path);
+            const auto end = std::chrono::steady_clock::now();
+            if (!sceneJson.is_object()) return -1.0;
+            return std::chrono::duration<double, std::milli>(end - start).count();
+        });
 }
 
 //==================================================
@@ -2471,177 +2693,8 @@ void RegisterGlobalFunctions(asIScriptEngine *engine) {
         });
 }
 
-//==================================================
-// as.predefined 生成
-//==================================================
-
-/// @brief 型名を取得する（テンプレート型は "array<T>" のようにサブタイプ付きで返す）
-std::string GetScriptTypeName(const asITypeInfo *typeInfo) {
-    std::string name = typeInfo->GetName();
-    if (typeInfo->GetFlags() & asOBJ_TEMPLATE) {
-        name += "<";
-        const asUINT subTypeCount = typeInfo->GetSubTypeCount();
-        for (asUINT i = 0; i < subTypeCount; ++i) {
-            if (i > 0) name += ", ";
-            const asITypeInfo *subType = typeInfo->GetSubType(i);
-            name += subType ? subType->GetName() : "T";
-        }
-        name += ">";
-    }
-    return name;
-}
-
-/// @brief コンストラクタ/ファクトリのビヘイビア宣言を "TypeName(params)" 形式へ変換する
-/// @details テンプレート型のファクトリ先頭に入る隠し引数(int&in)は取り除く
-std::string MakeConstructorDeclaration(const std::string &typeName, const asIScriptFunction *function, bool isTemplate) {
-    std::string decl = function->GetDeclaration(false, false, true);
-    const auto parenPos = decl.find('(');
-    if (parenPos == std::string::npos) return {};
-    std::string params = decl.substr(parenPos);
-    if (isTemplate) {
-        // "(int&in)" または "(int&in, ..." の隠し引数を除去する
-        if (params.rfind("(int&in)", 0) == 0) {
-            params = "()" + params.substr(8);
-        } else if (params.rfind("(int&in, ", 0) == 0) {
-            params = "(" + params.substr(9);
-        }
-    }
-    return typeName + params;
-}
-
 } // namespace
 
-bool GenerateScriptPredefinedFile(asIScriptEngine *engine, const std::string &filePath) {
-    if (!engine) return false;
-
-    std::string out;
-    out += "// このファイルはKashipanEngineが起動時に自動生成したものです。直接編集しないでください。\n";
-    out += "// VSCodeのAngelScript Language Serverがコード補完に使用する型定義ファイルです。\n\n";
-
-    // 列挙型
-    const asUINT enumCount = engine->GetEnumCount();
-    for (asUINT i = 0; i < enumCount; ++i) {
-        const asITypeInfo *enumType = engine->GetEnumByIndex(i);
-        if (!enumType) continue;
-        out += "enum " + std::string(enumType->GetName()) + " {\n";
-        const asUINT valueCount = enumType->GetEnumValueCount();
-        for (asUINT v = 0; v < valueCount; ++v) {
-            int value = 0;
-            const char *valueName = enumType->GetEnumValueByIndex(v, &value);
-            out += "\t" + std::string(valueName ? valueName : "") + " = " + std::to_string(value);
-            out += (v + 1 < valueCount) ? ",\n" : "\n";
-        }
-        out += "}\n\n";
-    }
-
-    // funcdef
-    const asUINT funcdefCount = engine->GetFuncdefCount();
-    for (asUINT i = 0; i < funcdefCount; ++i) {
-        const asITypeInfo *funcdefType = engine->GetFuncdefByIndex(i);
-        const asIScriptFunction *signature = funcdefType ? funcdefType->GetFuncdefSignature() : nullptr;
-        if (!signature) continue;
-        out += "funcdef " + std::string(signature->GetDeclaration(false, false, true)) + ";\n";
-    }
-    if (funcdefCount > 0) out += "\n";
-
-    // オブジェクト型（インターフェース・クラス）
-    const asUINT typeCount = engine->GetObjectTypeCount();
-    for (asUINT i = 0; i < typeCount; ++i) {
-        const asITypeInfo *typeInfo = engine->GetObjectTypeByIndex(i);
-        if (!typeInfo) continue;
-        const asQWORD flags = typeInfo->GetFlags();
-        const std::string typeName = GetScriptTypeName(typeInfo);
-
-        // RegisterInterfaceで登録されたインターフェース
-        if (flags & asOBJ_SCRIPT_OBJECT) {
-            out += "interface " + typeName + " {\n}\n\n";
-            continue;
-        }
-
-        out += "class " + typeName + " {\n";
-
-        // コンストラクタ/ファクトリ（値型のコンストラクタはビヘイビア、参照型のファクトリは別途列挙する）
-        const asUINT behaviourCount = typeInfo->GetBehaviourCount();
-        for (asUINT b = 0; b < behaviourCount; ++b) {
-            asEBehaviours behaviour = asBEHAVE_CONSTRUCT;
-            const asIScriptFunction *function = typeInfo->GetBehaviourByIndex(b, &behaviour);
-            if (!function) continue;
-            if (behaviour != asBEHAVE_CONSTRUCT && behaviour != asBEHAVE_FACTORY) continue;
-            const std::string decl = MakeConstructorDeclaration(typeInfo->GetName(), function, (flags & asOBJ_TEMPLATE) != 0);
-            if (!decl.empty()) out += "\t" + decl + ";\n";
-        }
-        const asUINT factoryCount = typeInfo->GetFactoryCount();
-        for (asUINT f = 0; f < factoryCount; ++f) {
-            const asIScriptFunction *function = typeInfo->GetFactoryByIndex(f);
-            if (!function) continue;
-            const std::string decl = MakeConstructorDeclaration(typeInfo->GetName(), function, (flags & asOBJ_TEMPLATE) != 0);
-            if (!decl.empty()) out += "\t" + decl + ";\n";
-        }
-
-        // プロパティ
-        const asUINT propertyCount = typeInfo->GetPropertyCount();
-        for (asUINT p = 0; p < propertyCount; ++p) {
-            const char *decl = typeInfo->GetPropertyDeclaration(p);
-            if (decl) out += "\t" + std::string(decl) + ";\n";
-        }
-
-        // メソッド
-        const asUINT methodCount = typeInfo->GetMethodCount();
-        for (asUINT m = 0; m < methodCount; ++m) {
-            const asIScriptFunction *method = typeInfo->GetMethodByIndex(m);
-            if (!method) continue;
-            out += "\t" + std::string(method->GetDeclaration(false, false, true)) + ";\n";
-        }
-
-        out += "}\n\n";
-    }
-
-    // グローバルプロパティ
-    const asUINT globalPropertyCount = engine->GetGlobalPropertyCount();
-    for (asUINT i = 0; i < globalPropertyCount; ++i) {
-        const char *name = nullptr;
-        const char *nameSpace = nullptr;
-        int typeId = 0;
-        bool isConst = false;
-        if (engine->GetGlobalPropertyByIndex(i, &name, &nameSpace, &typeId, &isConst) < 0 || !name) continue;
-        const char *typeDecl = engine->GetTypeDeclaration(typeId);
-        if (!typeDecl) continue;
-        std::string decl = std::string(isConst ? "const " : "") + typeDecl + " " + name + ";";
-        if (nameSpace && nameSpace[0] != '\0') {
-            out += "namespace " + std::string(nameSpace) + " { " + decl + " }\n";
-        } else {
-            out += decl + "\n";
-        }
-    }
-    if (globalPropertyCount > 0) out += "\n";
-
-    // グローバル関数（名前空間ごとにまとめる）
-    std::map<std::string, std::vector<std::string>> functionsByNamespace;
-    const asUINT globalFunctionCount = engine->GetGlobalFunctionCount();
-    for (asUINT i = 0; i < globalFunctionCount; ++i) {
-        const asIScriptFunction *function = engine->GetGlobalFunctionByIndex(i);
-        if (!function) continue;
-        const char *nameSpace = function->GetNamespace();
-        functionsByNamespace[nameSpace ? nameSpace : ""].push_back(
-            std::string(function->GetDeclaration(false, false, true)) + ";");
-    }
-    for (const auto &[nameSpace, declarations] : functionsByNamespace) {
-        if (nameSpace.empty()) {
-            for (const auto &decl : declarations) out += decl + "\n";
-            out += "\n";
-        } else {
-            out += "namespace " + nameSpace + " {\n";
-            for (const auto &decl : declarations) out += "\t" + decl + "\n";
-            out += "}\n\n";
-        }
-    }
-
-    std::ofstream file(filePath, std::ios::binary);
-    if (!file) return false;
-    file.write(out.data(), static_cast<std::streamsize>(out.size()));
-    return file.good();
-}
-
 void RegisterEngineScriptBindings(asIScriptEngine *engine) {
     if (!engine) return;
     RegisterMathTypes(engine);
@@ -2666,8 +2719,10 @@ void RegisterEngineScriptBindings(asIScriptEngine *engine) {
     RegisterMathFunctionBindings(engine);
     // WaveFunctionCollapseはJson型（SaveToJson/LoadFromJson）を参照するため、Json登録より後に呼ぶ
     RegisterWaveFunctionCollapseBindings(engine);
+    RegisterChunkedWaveFunctionCollapseBindings(engine);
     // StageGridBuilderはWaveFunctionCollapse型・Vector3型を参照するため、それらの登録より後に呼ぶ
     RegisterStageGenerationBindings(engine);
+    RegisterSceneFileBindings(engine);
     RegisterRandomBindings(engine);
     RegisterGlobalFunctions(engine);
 }
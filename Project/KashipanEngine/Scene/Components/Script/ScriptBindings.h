@@ -49,6 +49,12 @@ void RegisterEngineScriptBindings(asIScriptEngine *engine);
 /// @return 生成に成功した場合は true
 bool GenerateScriptPredefinedFile(asIScriptEngine *engine, const std::string &filePath);
 
+/// @brief エンジンに登録済みの型・関数・プロパティの宣言全体から求めたハッシュ
+/// @details 保存済みのバイトコードは登録APIを宣言で参照するため、バインディングの追加・変更で値が変わる。
+///          ディスク上のバイトコードキャッシュ（ScriptModuleCache）のキーに使う。RegisterEngineScriptBindings の後に呼ぶこと。
+/// @param engine 登録済みのスクリプトエンジン
+std::uint64_t ComputeScriptApiSignatureHash(asIScriptEngine *engine);
+
 /// @brief スクリプト実行中のオーナーコンテキストを設定するRAIIスコープ
 /// @details スクリプト側の GetOwnerObject()/GetTransform()/GetScene()/FindObject()/GetComponent() は
 ///          このスコープで設定されたコンテキストを参照する。関数呼び出しの間だけ生存させること。
@@ -0,0 +1,110 @@
+#include "Scene/Components/Script/ScriptByteCodeCacheFile.h"
+
+#include <utility>
+
+#include "Utilities/FileIO/BinaryStream.h"
+
+namespace KashipanEngine {
+
+namespace {
+
+/// @brief バイトコードキャッシュファイルの識別子とフォーマットのバージョン
+constexpr std::uint32_t kDiskCacheMagic = 0x4342534Bu; // "KSBC"
+constexpr std::uint32_t kDiskCacheFormatVersion = 1;
+
+} // namespace
+
+bool ScriptByteCodeCacheFile::Save(const std::string &filePath) const {
+    std::vector<std::uint8_t> data;
+    BinaryWriter writer(data);
+    writer.U32(kDiskCacheMagic);
+    writer.U32(kDiskCacheFormatVersion);
+    writer.String(key.runtimeSignature);
+    writer.U64(key.apiSignatureHash);
+    writer.String(key.scriptPath);
+    writer.String(key.defineKey);
+    writer.U32(static_cast<std::uint32_t>(sources.size()));
+    for (const auto &source : sources) {
+        writer.String(source.path);
+        writer.U64(source.contentHash);
+    }
+    writer.U8(hasGlobalState ? 1 : 0);
+    writer.Strings(buildMessages);
+
+    writer.U32(static_cast<std::uint32_t>(metadata.globalVars_.size()));
+    for (const auto &[name, values] : metadata.globalVars_) {
+        writer.String(name);
+        writer.Strings(values);
+    }
+    writer.U32(static_cast<std::uint32_t>(metadata.types_.size()));
+    for (const auto &[name, values] : metadata.types_) {
+        writer.String(name);
+        writer.Strings(values);
+    }
+    writer.U32(static_cast<std::uint32_t>(metadata.typeProperties_.size()));
+    for (const auto &[name, properties] : metadata.typeProperties_) {
+        writer.String(name);
+        writer.U32(static_cast<std::uint32_t>(properties.size()));
+        for (const auto &values : properties) writer.Strings(values);
+    }
+    writer.U32(static_cast<std::uint32_t>(byteCode.size()));
+    writer.Bytes(byteCode.data(), byteCode.size());
+    return SaveChecksummedBinaryFile(filePath, std::move(data));
+}
+
+bool ScriptByteCodeCacheFile::Load(const std::string &filePath, const Key &expectedKey, ScriptByteCodeCacheFile &out) {
+    // 末尾のチェックサムで書き込み途中・破損したファイルを弾く
+    std::vector<std::uint8_t> data;
+    if (!LoadChecksummedBinaryFile(filePath, data)) return false;
+
+    BinaryReader reader(data.data(), data.size());
+    if (reader.U32() != kDiskCacheMagic || reader.U32() != kDiskCacheFormatVersion) return false;
+    ScriptByteCodeCacheFile file;
+    file.key.runtimeSignature = reader.String();
+    file.key.apiSignatureHash = reader.U64();
+    file.key.scriptPath = reader.String();
+    file.key.defineKey = reader.String();
+    if (!reader.IsValid() || file.key.runtimeSignature != expectedKey.runtimeSignature ||
+        file.key.apiSignatureHash != expectedKey.apiSignatureHash ||
+        file.key.scriptPath != expectedKey.scriptPath || file.key.defineKey != expectedKey.defineKey) {
+        return false;
+    }
+
+    // include先を含む全ソースの内容ハッシュが保存時と一致する場合だけ使う
+    const std::uint32_t sourceCount = reader.U32();
+    for (std::uint32_t i = 0; i < sourceCount && reader.IsValid(); ++i) {
+        Source source;
+        source.path = reader.String();
+        source.contentHash = reader.U64();
+        if (!reader.IsValid() || HashFileContentFnv1a(source.path) != source.contentHash) return false;
+        file.sources.push_back(std::move(source));
+    }
+
+    file.hasGlobalState = reader.U8() != 0;
+    file.buildMessages = reader.Strings();
+    for (std::uint32_t i = 0, count = reader.U32(); i < count && reader.IsValid(); ++i) {
+        std::string name = reader.String();
+        file.metadata.globalVars_[std::move(name)] = reader.Strings();
+    }
+    for (std::uint32_t i = 0, count = reader.U32(); i < count && reader.IsValid(); ++i) {
+        std::string name = reader.String();
+        file.metadata.types_[std::move(name)] = reader.Strings();
+    }
+    for (std::uint32_t i = 0, count = reader.U32(); i < count && reader.IsValid(); ++i) {
+        std::string name = reader.String();
+        // 要素数が壊れていても巨大な確保をしないよう、読めた分だけ追加する
+        std::vector<std::vector<std::string>> properties;
+        for (std::uint32_t p = 0, propertyCount = reader.U32(); p < propertyCount && reader.IsValid(); ++p) {
+            properties.push_back(reader.Strings());
+        }
+        file.metadata.typeProperties_[std::move(name)] = std::move(properties);
+    }
+    file.byteCode = reader.Blob();
+    // 末尾に余分なデータが残る場合も、保存したものと異なるとみなす
+    if (!reader.IsValid() || !reader.IsAtEnd()) return false;
+
+    out = std::move(file);
+    return true;
+}
+
+} // namespace KashipanEngine
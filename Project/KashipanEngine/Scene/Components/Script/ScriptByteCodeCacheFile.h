@@ -0,0 +1,49 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Scene/Components/Script/ScriptModuleCache.h"
+
+namespace KashipanEngine {
+
+/// @brief バイトコードキャッシュファイル（Cache/ScriptByteCode/*.kbc）1つ分の中身
+/// @details ファイルの読み書きと、キャッシュを使ってよいか（キー・ソースの内容ハッシュが一致するか、
+///          ファイルが壊れていないか）の判定を受け持つ。AngelScriptには依存せず、バイトコードを
+///          モジュールへ読み込めるかは ScriptModuleCache が確かめる
+struct ScriptByteCodeCacheFile final {
+    /// @brief キャッシュを使う条件（全て一致した場合だけ読み込む）
+    struct Key final {
+        /// @brief AngelScriptのバージョン・ビルドオプション・ポインタ幅
+        std::string runtimeSignature;
+        /// @brief 登録APIの宣言から求めたハッシュ
+        std::uint64_t apiSignatureHash = 0;
+        std::string scriptPath;
+        std::string defineKey;
+    };
+
+    /// @brief ビルドに使ったソースファイル（include先を含む）
+    struct Source final {
+        std::string path;
+        std::uint64_t contentHash = 0;
+    };
+
+    Key key;
+    std::vector<Source> sources;
+    bool hasGlobalState = false;
+    std::vector<std::string> buildMessages;
+    ScriptMetadataTable metadata;
+    std::vector<std::uint8_t> byteCode;
+
+    /// @brief 末尾にチェックサムを付けて書き出す（一時ファイルへ書いてから置き換える）
+    /// @return 書き込みに成功した場合は true
+    bool Save(const std::string &filePath) const;
+
+    /// @brief ファイルを読み込み、キャッシュを使えるか確かめる
+    /// @param expectedKey 現在の実行環境・スクリプトのキー
+    /// @return ファイルが無い・書き込み途中・破損している・フォーマットやキーが異なる・
+    ///         いずれかのソースの内容が保存時から変わっている場合は false（out は変更しない）
+    static bool Load(const std::string &filePath, const Key &expectedKey, ScriptByteCodeCacheFile &out);
+};
+
+} // namespace KashipanEngine
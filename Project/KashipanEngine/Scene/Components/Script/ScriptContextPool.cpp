@@ -0,0 +1,129 @@
+#include "Scene/Components/Script/ScriptContextPool.h"
+
+#include <angelscript.h>
+
+#include "Scene/Components/Script/AngelScriptDebugServer.h"
+#include "Scene/Components/Script/SceneScriptEngine.h"
+#include "Scene/Components/Script/ScriptProfiler.h"
+
+namespace KashipanEngine {
+
+namespace {
+
+asIScriptContext *RequestContextCallback(asIScriptEngine *, void *param) {
+    return static_cast<ScriptContextPool *>(param)->Acquire();
+}
+
+void ReturnContextCallback(asIScriptEngine *, asIScriptContext *context, void *param) {
+    static_cast<ScriptContextPool *>(param)->Return(context);
+}
+
+} // namespace
+
+//==================================================
+// ScriptContextPool
+//==================================================
+
+ScriptContextPool::ScriptContextPool(asIScriptEngine *engine, AngelScriptDebugServer *debugServer, ScriptProfiler *profiler)
+    : engine_(engine), debugServer_(debugServer), profiler_(profiler) {
+    if (engine_) {
+        engine_->SetContextCallbacks(RequestContextCallback, ReturnContextCallback, this);
+    }
+}
+
+ScriptContextPool::~ScriptContextPool() {
+    if (engine_) {
+        engine_->SetContextCallbacks(nullptr, nullptr, nullptr);
+    }
+    for (asIScriptContext *context : contexts_) {
+        context->Release();
+    }
+}
+
+asIScriptContext *ScriptContextPool::Acquire() {
+    if (!idleContexts_.empty()) {
+        asIScriptContext *context = idleContexts_.back();
+        idleContexts_.pop_back();
+        return context;
+    }
+    if (!engine_) return nullptr;
+    asIScriptContext *context = engine_->CreateContext();
+    if (!context) return nullptr;
+    ApplyLineCallback(context);
+    contexts_.push_back(context);
+    return context;
+}
+
+void ScriptContextPool::Return(asIScriptContext *context) {
+    if (!context) return;
+    // 中断されたままのコンテキストは Prepare できないため、ここで打ち切っておく
+    // （Unprepare はしない。次に同じ関数を Prepare する際の準備を省略できるようにするため）
+    if (context->GetState() == asEXECUTION_SUSPENDED) {
+        context->Abort();
+    }
+    idleContexts_.push_back(context);
+}
+
+void ScriptContextPool::RefreshLineCallbacks() {
+    for (asIScriptContext *context : contexts_) {
+        ApplyLineCallback(context);
+    }
+}
+
+void ScriptContextPool::ApplyLineCallback(asIScriptContext *context) const {
+    const bool isSampling = profiler_ && profiler_->IsSamplingEnabled();
+    if (debugServer_ || isSampling) {
+        context->SetLineCallback(asFUNCTION(LineCallback), const_cast<ScriptContextPool *>(this), asCALL_CDECL);
+    } else {
+        context->ClearLineCallback();
+    }
+}
+
+void ScriptContextPool::LineCallback(asIScriptContext *context, void *userData) {
+    auto *pool = static_cast<ScriptContextPool *>(userData);
+    // デバッガーはブレークポイントで停止するため、先にサンプリングを済ませる
+    if (pool->profiler_) pool->profiler_->OnLine(context);
+    if (pool->debugServer_) pool->debugServer_->OnLine(context);
+}
+
+//==================================================
+// ScriptCall
+//==================================================
+
+ScriptCall::ScriptCall(SceneScriptEngine &scriptEngine, asIScriptFunction *function, void *object)
+    : pool_(scriptEngine.GetContextPool()), profiler_(scriptEngine.GetProfiler()), function_(function) {
+    if (!pool_ || !function_) return;
+
+    asIScriptContext *activeContext = asGetActiveContext();
+    if (activeContext && activeContext->GetEngine() == pool_->GetEngine() &&
+        activeContext->GetState() == asEXECUTION_ACTIVE && activeContext->PushState() >= 0) {
+        context_ = activeContext;
+        isNested_ = true;
+    } else {
+        context_ = pool_->Acquire();
+    }
+    if (!context_) return;
+
+    if (context_->Prepare(function_) < 0) return;
+    if (object && context_->SetObject(object) < 0) return;
+    isPrepared_ = true;
+}
+
+ScriptCall::~ScriptCall() {
+    if (!context_) return;
+    if (isNested_) {
+        context_->PopState();
+    } else {
+        pool_->Return(context_);
+    }
+}
+
+int ScriptCall::Execute() {
+    if (!isPrepared_) return asEXECUTION_ERROR;
+    const bool isProfiled = profiler_ && profiler_->BeginCall(function_);
+    const int result = context_->Execute();
+    if (isProfiled) profiler_->EndCall();
+    return result;
+}
+
+} // namespace KashipanEngine
@@ -0,0 +1,89 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+
+class asIScriptContext;
+class asIScriptEngine;
+class asIScriptFunction;
+
+namespace KashipanEngine {
+
+class AngelScriptDebugServer;
+class SceneScriptEngine;
+class ScriptProfiler;
+
+/// @brief スクリプト実行用コンテキスト（asIScriptContext）の再利用プール
+/// @details 空きコンテキストは最後に返されたものから順に貸し出す（LIFO）ため、同じスクリプトの関数を
+///          続けて呼ぶ場合は直前と同じ準備済みのコンテキストが使われ、Prepare の大半の処理が省略される。
+///          asIScriptEngine::SetContextCallbacks にも登録するため、アドオン（array の sort 等）が
+///          内部で要求するコンテキストもこのプールから貸し出される。
+///          作成したコンテキストには、デバッグサーバー・プロファイラーへ転送するラインコールバックを設定する。
+class ScriptContextPool final {
+public:
+    ScriptContextPool(asIScriptEngine *engine, AngelScriptDebugServer *debugServer, ScriptProfiler *profiler);
+    ~ScriptContextPool();
+
+    ScriptContextPool(const ScriptContextPool &) = delete;
+    ScriptContextPool &operator=(const ScriptContextPool &) = delete;
+
+    /// @brief コンテキストを借りる（空きが無い場合は作成する）
+    asIScriptContext *Acquire();
+    /// @brief 借りたコンテキストを返す
+    void Return(asIScriptContext *context);
+
+    /// @brief デバッグサーバー・プロファイラーの状態に合わせて、全コンテキストのラインコールバックを設定し直す
+    /// @details ラインコールバックは1行ごとに呼ばれて実行速度に影響するため、どちらも不要な場合は外す
+    void RefreshLineCallbacks();
+
+    asIScriptEngine *GetEngine() const noexcept { return engine_; }
+    std::size_t GetCreatedCount() const noexcept { return contexts_.size(); }
+    std::size_t GetIdleCount() const noexcept { return idleContexts_.size(); }
+
+private:
+    void ApplyLineCallback(asIScriptContext *context) const;
+    static void LineCallback(asIScriptContext *context, void *userData);
+
+    asIScriptEngine *engine_ = nullptr;
+    AngelScriptDebugServer *debugServer_ = nullptr;
+    ScriptProfiler *profiler_ = nullptr;
+    /// @brief 作成した全コンテキスト（貸出中を含む）
+    std::vector<asIScriptContext *> contexts_;
+    /// @brief 空きコンテキスト（末尾が最後に返されたもの）
+    std::vector<asIScriptContext *> idleContexts_;
+};
+
+/// @brief スクリプト関数1回分の呼び出し（コンテキストの確保・Prepare・実行・返却をまとめたRAII）
+/// @details スクリプトの実行中（Update から呼んだエンジン関数が別のスクリプトのコールバックを呼ぶ等）に
+///          作られた場合は、新しいコンテキストを確保せず実行中のコンテキストを PushState して再利用し、
+///          破棄時に PopState で元の実行状態へ戻す。プロファイラーの計測が有効な場合は Execute の時間を記録する。
+///          引数は IsPrepared() の確認後、GetContext() から SetArg* で設定する。
+class ScriptCall final {
+public:
+    /// @param scriptEngine 実行に使うシーンのスクリプトエンジン
+    /// @param function 呼び出す関数
+    /// @param object メソッドの場合の呼び出し対象（グローバル関数の場合は nullptr）
+    ScriptCall(SceneScriptEngine &scriptEngine, asIScriptFunction *function, void *object = nullptr);
+    ~ScriptCall();
+
+    ScriptCall(const ScriptCall &) = delete;
+    ScriptCall &operator=(const ScriptCall &) = delete;
+
+    /// @brief コンテキストの確保と Prepare に成功したか
+    bool IsPrepared() const noexcept { return isPrepared_; }
+    /// @brief 実行に使うコンテキスト（戻り値・例外情報の取得用。このオブジェクトの破棄後は使わないこと）
+    asIScriptContext *GetContext() const noexcept { return context_; }
+    /// @brief 関数を実行する
+    /// @return asIScriptContext::Execute の戻り値（未準備の場合は asEXECUTION_ERROR）
+    int Execute();
+
+private:
+    ScriptContextPool *pool_ = nullptr;
+    ScriptProfiler *profiler_ = nullptr;
+    asIScriptFunction *function_ = nullptr;
+    asIScriptContext *context_ = nullptr;
+    /// @brief 実行中のコンテキストを PushState して使っているか
+    bool isNested_ = false;
+    bool isPrepared_ = false;
+};
+
+} // namespace KashipanEngine
@@ -0,0 +1,454 @@
+#include "Scene/Components/Script/ScriptModuleCache.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <system_error>
+
+#include <angelscript.h>
+#include <add_on/scriptbuilder/scriptbuilder.h>
+
+#include "Core/ProjectPaths.h"
+#include "Utilities/FileIO/BinaryStream.h"
+#include "Scene/Components/Script/SceneScriptEngine.h"
+#include "Scene/Components/Script/ScriptByteCodeCacheFile.h"
+#include "Scene/Components/Script/ScriptBindings.h"
+
+namespace KashipanEngine {
+
+namespace {
+
+const std::vector<std::string> kEmptyMetadata;
+
+/// @brief バイトコードキャッシュの保存先（プロジェクトルート基準）
+constexpr const char *kDiskCacheFolderName = "Cache/ScriptByteCode";
+constexpr const char *kDiskCacheExtension = ".kbc";
+
+/// @brief 名前空間付きの名前（"ns::name"。グローバル名前空間の場合は "name"）
+std::string MakeQualifiedName(const char *nameSpace, const char *name) {
+    std::string qualified;
+    if (nameSpace && nameSpace[0] != '\0') {
+        qualified = nameSpace;
+        qualified += "::";
+    }
+    if (name) qualified += name;
+    return qualified;
+}
+
+std::string MakeQualifiedTypeName(const asITypeInfo *type) {
+    return type ? MakeQualifiedName(type->GetNamespace(), type->GetName()) : std::string{};
+}
+
+/// @brief 各ソースファイルのパスと内容ハッシュを順に混ぜた、エントリ全体の内容ハッシュ
+template <typename SourceList>
+std::uint64_t CombineSourceHashes(const SourceList &sources) {
+    std::uint64_t hash = kFnv1aOffsetBasis;
+    for (const auto &source : sources) {
+        hash = HashFnv1a(hash, source.path.data(), source.path.size() + 1);
+        hash = HashFnv1a(hash, reinterpret_cast<const char *>(&source.contentHash), sizeof(source.contentHash));
+    }
+    return hash;
+}
+
+/// @brief ソースファイルの更新日時・サイズを取得し直す
+template <typename SourceFile>
+void RefreshSourceStat(SourceFile &source) {
+    std::error_code ec;
+    source.writeTime = std::filesystem::last_write_time(source.path, ec);
+    source.size = ec ? 0 : std::filesystem::file_size(source.path, ec);
+}
+
+/// @brief キャッシュの互換性を決める実行環境の識別文字列（AngelScriptのバージョン・ビルドオプション・ポインタ幅）
+std::string MakeRuntimeSignature() {
+    return std::string(ANGELSCRIPT_VERSION_STRING) + "|" + asGetLibraryOptions() + "|" + std::to_string(sizeof(void *));
+}
+
+/// @brief バイトコードキャッシュを使う条件（実行環境・登録API・キャッシュキー）
+ScriptByteCodeCacheFile::Key MakeDiskCacheKey(std::uint64_t apiSignatureHash, const std::string &scriptPath, const std::string &defineKey) {
+    return { MakeRuntimeSignature(), apiSignatureHash, scriptPath, defineKey };
+}
+
+/// @brief SaveByteCodeの書き込み先（メモリ上のバッファへ追記する）
+class ByteCodeWriter final : public asIBinaryStream {
+public:
+    explicit ByteCodeWriter(std::vector<std::uint8_t> &buffer) : buffer_(buffer) {}
+    int Write(const void *ptr, asUINT size) override {
+        if (size == 0) return 0;
+        const auto *bytes = static_cast<const std::uint8_t *>(ptr);
+        buffer_.insert(buffer_.end(), bytes, bytes + size);
+        return 0;
+    }
+    int Read(void *, asUINT) override { return -1; }
+
+private:
+    std::vector<std::uint8_t> &buffer_;
+};
+
+/// @brief LoadByteCodeの読み込み元（メモリ上のバッファを先頭から読む）
+class ByteCodeReader final : public asIBinaryStream {
+public:
+    explicit ByteCodeReader(const std::vector<std::uint8_t> &buffer) : buffer_(buffer) {}
+    int Read(void *ptr, asUINT size) override {
+        if (size == 0) return 0;
+        if (position_ + size > buffer_.size()) return -1;
+        std::memcpy(ptr, buffer_.data() + position_, size);
+        position_ += size;
+        return 0;
+    }
+    int Write(const void *, asUINT) override { return -1; }
+
+private:
+    const std::vector<std::uint8_t> &buffer_;
+    std::size_t position_ = 0;
+};
+
+/// @brief `#include "path.as"` を解決するコールバック
+/// @details includeで指定されたパスが相対パスの場合、includeディレクティブを書いたファイル（from）
+///          と同じディレクトリからの相対パスとして解決する。絶対パス指定の場合はそのまま使用する
+int ResolveIncludePath(const char *include, const char *from, CScriptBuilder *builder, void *) {
+    if (!include || !builder) return -1;
+
+    std::string includePath = include;
+    const bool isAbsolute = includePath.size() >= 2 &&
+        (includePath[1] == ':' || includePath[0] == '/' || includePath[0] == '\\');
+
+    if (!isAbsolute && from) {
+        const std::string fromPath = from;
+        const auto slashPos = fromPath.find_last_of("/\\");
+        if (slashPos != std::string::npos) {
+            includePath = fromPath.substr(0, slashPos + 1) + includePath;
+        }
+    }
+    return builder->AddSectionFromFile(includePath.c_str());
+}
+
+} // namespace
+
+//==================================================
+// ScriptMetadataTable
+//==================================================
+
+void ScriptMetadataTable::Capture(CScriptBuilder &builder, asIScriptModule *module) {
+    Clear();
+    if (!module) return;
+
+    const asUINT varCount = module->GetGlobalVarCount();
+    for (asUINT i = 0; i < varCount; ++i) {
+        const char *name = nullptr;
+        const char *nameSpace = nullptr;
+        if (module->GetGlobalVar(i, &name, &nameSpace) < 0 || !name) continue;
+        auto metadata = builder.GetMetadataForVar(static_cast<int>(i));
+        if (!metadata.empty()) globalVars_[MakeQualifiedName(nameSpace, name)] = std::move(metadata);
+    }
+
+    const asUINT typeCount = module->GetObjectTypeCount();
+    for (asUINT i = 0; i < typeCount; ++i) {
+        asITypeInfo *type = module->GetObjectTypeByIndex(i);
+        if (!type) continue;
+        const std::string typeName = MakeQualifiedTypeName(type);
+        const int typeId = type->GetTypeId();
+        auto typeMetadata = builder.GetMetadataForType(typeId);
+        if (!typeMetadata.empty()) types_[typeName] = std::move(typeMetadata);
+
+        std::vector<std::vector<std::string>> properties(type->GetPropertyCount());
+        bool hasPropertyMetadata = false;
+        for (asUINT p = 0; p < type->GetPropertyCount(); ++p) {
+            properties[p] = builder.GetMetadataForTypeProperty(typeId, static_cast<int>(p));
+            hasPropertyMetadata = hasPropertyMetadata || !properties[p].empty();
+        }
+        if (hasPropertyMetadata) typeProperties_[typeName] = std::move(properties);
+    }
+}
+
+void ScriptMetadataTable::Clear() {
+    globalVars_.clear();
+    types_.clear();
+    typeProperties_.clear();
+}
+
+const std::vector<std::string> &ScriptMetadataTable::ForGlobalVar(const char *nameSpace, const char *name) const {
+    auto it = globalVars_.find(MakeQualifiedName(nameSpace, name));
+    return it != globalVars_.end() ? it->second : kEmptyMetadata;
+}
+
+const std::vector<std::string> &ScriptMetadataTable::ForType(const asITypeInfo *type) const {
+    auto it = types_.find(MakeQualifiedTypeName(type));
+    return it != types_.end() ? it->second : kEmptyMetadata;
+}
+
+const std::vector<std::string> &ScriptMetadataTable::ForTypeProperty(const asITypeInfo *type, std::uint32_t propertyIndex) const {
+    auto it = typeProperties_.find(MakeQualifiedTypeName(type));
+    if (it == typeProperties_.end() || propertyIndex >= it->second.size()) return kEmptyMetadata;
+    return it->second[propertyIndex];
+}
+
+//==================================================
+// ScriptModuleCache
+//==================================================
+
+ScriptModuleCache::ScriptModuleCache(SceneScriptEngine *owner, asIScriptEngine *engine)
+    : owner_(owner), engine_(engine), apiSignatureHash_(ComputeScriptApiSignatureHash(engine)) {}
+
+ScriptModuleCache::~ScriptModuleCache() {
+    Clear();
+}
+
+ScriptModuleCache::Lease ScriptModuleCache::Acquire(const std::string &scriptPath, const std::vector<std::string> &defines, const std::string &instanceModuleName) {
+    std::vector<std::string> sortedDefines = defines;
+    std::sort(sortedDefines.begin(), sortedDefines.end());
+    sortedDefines.erase(std::unique(sortedDefines.begin(), sortedDefines.end()), sortedDefines.end());
+    std::string defineKey;
+    for (const auto &define : sortedDefines) {
+        defineKey += define;
+        defineKey += ';';
+    }
+    const std::string key = scriptPath + '|' + defineKey;
+
+    std::shared_ptr<Entry> entry;
+    auto it = entries_.find(key);
+    if (it != entries_.end() && IsUpToDate(*it->second)) {
+        entry = it->second;
+        ++hitCount_;
+    } else {
+        entry = Compile(scriptPath, sortedDefines, defineKey);
+        if (it != entries_.end()) {
+            // 使用中のインスタンスは古いモジュールを参照したままなので、手放されるまで破棄を遅らせる
+            std::shared_ptr<Entry> previous = std::move(it->second);
+            previous->isSuperseded_ = true;
+            if (previous->userCount_ == 0) {
+                DiscardEntryModule(*previous);
+            } else {
+                retiredEntries_.push_back(std::move(previous));
+            }
+            it->second = entry;
+        } else {
+            entries_.emplace(key, entry);
+        }
+    }
+
+    Lease lease;
+    lease.entry = entry;
+    ++entry->userCount_;
+    if (!entry->IsBuilt()) return lease;
+    if (!entry->hasGlobalState_) {
+        lease.module = entry->module_;
+        return lease;
+    }
+
+    // グローバル変数をインスタンスごとに持たせるため、バイトコードから専用のモジュールを作る
+    asIScriptModule *module = engine_ ? engine_->GetModule(instanceModuleName.c_str(), asGM_ALWAYS_CREATE) : nullptr;
+    if (!module) return lease;
+    ByteCodeReader reader(entry->byteCode_);
+    if (module->LoadByteCode(&reader) < 0) {
+        module->Discard();
+        return lease;
+    }
+    lease.module = module;
+    lease.instanceModuleName = instanceModuleName;
+    return lease;
+}
+
+void ScriptModuleCache::Release(Lease &lease) {
+    if (!lease.instanceModuleName.empty() && lease.module) {
+        lease.module->Discard();
+    }
+    if (lease.entry) {
+        Entry &entry = *lease.entry;
+        if (entry.userCount_ > 0) --entry.userCount_;
+        if (entry.isSuperseded_ && entry.userCount_ == 0) {
+            DiscardEntryModule(entry);
+            std::erase(retiredEntries_, lease.entry);
+        }
+    }
+    lease = Lease{};
+}
+
+void ScriptModuleCache::Clear() {
+    for (auto &[key, entry] : entries_) {
+        DiscardEntryModule(*entry);
+    }
+    for (auto &entry : retiredEntries_) {
+        DiscardEntryModule(*entry);
+    }
+    entries_.clear();
+    retiredEntries_.clear();
+}
+
+std::shared_ptr<ScriptModuleCache::Entry> ScriptModuleCache::Compile(const std::string &scriptPath, const std::vector<std::string> &defines, const std::string &defineKey) {
+    auto entry = std::make_shared<Entry>();
+    entry->scriptPath_ = scriptPath;
+    entry->defineKey_ = defineKey;
+    entry->moduleName_ = "ScriptModule_" + std::to_string(nextModuleId_++);
+
+    if (LoadFromDiskCache(*entry)) {
+        ++diskLoadCount_;
+        return entry;
+    }
+    ++compileCount_;
+
+    // scriptPath は "Assets/..." 形式の論理パスで保持しているため、ここで物理パスへ変換する
+    // （以降のincludeはこの物理パスからの相対で解決される）
+    const std::string resolvedScriptPath = ProjectPaths::ToPhysical(scriptPath);
+
+    CScriptBuilder builder;
+    bool isBuilt = false;
+    if (engine_ && builder.StartNewModule(engine_, entry->moduleName_.c_str()) >= 0) {
+        builder.SetIncludeCallback(ResolveIncludePath, nullptr);
+        for (const auto &define : defines) {
+            builder.DefineWord(define.c_str());
+        }
+        // ビルド中のコンパイルメッセージを収集し、失敗時にインスペクターへ表示できるようにする
+        if (owner_) owner_->BeginMessageCapture();
+        entry->isSectionLoaded_ = builder.AddSectionFromFile(resolvedScriptPath.c_str()) >= 0;
+        isBuilt = entry->isSectionLoaded_ && builder.BuildModule() >= 0;
+        if (owner_) entry->buildMessages_ = owner_->EndMessageCapture();
+    }
+
+    // include先を含む全ソースを記録する（読み込みに失敗した場合も、ファイルが作られたら検出できるよう本体は記録する）
+    std::vector<std::string> sourcePaths;
+    for (unsigned int i = 0; i < builder.GetSectionCount(); ++i) {
+        sourcePaths.push_back(builder.GetSectionName(i));
+    }
+    if (std::find(sourcePaths.begin(), sourcePaths.end(), resolvedScriptPath) == sourcePaths.end()) {
+        sourcePaths.insert(sourcePaths.begin(), resolvedScriptPath);
+    }
+    for (auto &path : sourcePaths) {
+        Entry::SourceFile source;
+        source.path = std::move(path);
+        RefreshSourceStat(source);
+        source.contentHash = HashFileContentFnv1a(source.path);
+        entry->sources_.push_back(std::move(source));
+    }
+    entry->contentHash_ = CombineSourceHashes(entry->sources_);
+
+    asIScriptModule *module = builder.GetModule();
+    if (!isBuilt) {
+        if (module) module->Discard();
+        return entry;
+    }
+
+    entry->metadata_.Capture(builder, module);
+    const asUINT varCount = module->GetGlobalVarCount();
+    for (asUINT i = 0; i < varCount; ++i) {
+        bool isConst = false;
+        if (module->GetGlobalVar(i, nullptr, nullptr, nullptr, &isConst) >= 0 && !isConst) {
+            entry->hasGlobalState_ = true;
+            break;
+        }
+    }
+
+    std::vector<std::uint8_t> byteCode;
+    ByteCodeWriter writer(byteCode);
+    const bool isSaved = module->SaveByteCode(&writer) >= 0;
+    if (entry->hasGlobalState_) {
+        // 複製元のバイトコードだけを残し、ビルドしたモジュール自体は破棄する
+        module->Discard();
+        if (!isSaved) {
+            entry->buildMessages_.push_back("[Error] " + scriptPath + ": failed to save bytecode for per-instance modules");
+            return entry;
+        }
+        entry->byteCode_ = byteCode;
+    } else {
+        entry->module_ = module;
+    }
+    entry->isBuilt_ = true;
+    if (isSaved) SaveToDiskCache(*entry, byteCode);
+    return entry;
+}
+
+bool ScriptModuleCache::IsUpToDate(Entry &entry) const {
+    bool isStatMatched = true;
+    for (const auto &source : entry.sources_) {
+        std::error_code ec;
+        const auto writeTime = std::filesystem::last_write_time(source.path, ec);
+        const std::uintmax_t size = ec ? 0 : std::filesystem::file_size(source.path, ec);
+        if (writeTime != source.writeTime || size != source.size) {
+            isStatMatched = false;
+            break;
+        }
+    }
+    if (isStatMatched) return true;
+
+    // 保存し直しただけ（内容は同じ）の場合は、更新日時だけを取り直して使い続ける
+    for (const auto &source : entry.sources_) {
+        if (HashFileContentFnv1a(source.path) != source.contentHash) return false;
+    }
+    for (auto &source : entry.sources_) {
+        RefreshSourceStat(source);
+    }
+    return true;
+}
+
+void ScriptModuleCache::DiscardEntryModule(Entry &entry) {
+    if (entry.module_) {
+        entry.module_->Discard();
+        entry.module_ = nullptr;
+    }
+    entry.byteCode_.clear();
+    entry.byteCode_.shrink_to_fit();
+    entry.isBuilt_ = false;
+}
+
+std::string ScriptModuleCache::GetDiskCachePath(const std::string &scriptPath, const std::string &defineKey) const {
+    // ファイル名はキーのハッシュ。衝突やキー違いはファイル内に保存したキーとの比較で弾く
+    const std::string key = scriptPath + '|' + defineKey;
+    const std::uint64_t keyHash = HashFnv1a(kFnv1aOffsetBasis, key.data(), key.size());
+    char fileName[32] = {};
+    std::snprintf(fileName, sizeof(fileName), "%016llx", static_cast<unsigned long long>(keyHash));
+    return ProjectPaths::InProjectRoot(std::string(kDiskCacheFolderName) + "/" + fileName + kDiskCacheExtension);
+}
+
+bool ScriptModuleCache::LoadFromDiskCache(Entry &entry) {
+    if (!isDiskCacheEnabled_ || !engine_) return false;
+
+    ScriptByteCodeCacheFile file;
+    if (!ScriptByteCodeCacheFile::Load(GetDiskCachePath(entry.scriptPath_, entry.defineKey_), MakeDiskCacheKey(apiSignatureHash_, entry.scriptPath_, entry.defineKey_), file)) return false;
+
+    // バイトコードが読めない場合（登録APIのハッシュでは検出できない不整合）もソースからのコンパイルへ戻る
+    asIScriptModule *module = engine_->GetModule(entry.moduleName_.c_str(), asGM_ALWAYS_CREATE);
+    if (!module) return false;
+    ByteCodeReader byteCodeReader(file.byteCode);
+    if (module->LoadByteCode(&byteCodeReader) < 0) {
+        module->Discard();
+        return false;
+    }
+
+    entry.sources_.clear();
+    for (auto &cachedSource : file.sources) {
+        Entry::SourceFile source;
+        source.path = std::move(cachedSource.path);
+        source.contentHash = cachedSource.contentHash;
+        RefreshSourceStat(source);
+        entry.sources_.push_back(std::move(source));
+    }
+    entry.contentHash_ = CombineSourceHashes(entry.sources_);
+    entry.hasGlobalState_ = file.hasGlobalState;
+    entry.buildMessages_ = std::move(file.buildMessages);
+    entry.metadata_ = std::move(file.metadata);
+    if (entry.hasGlobalState_) {
+        module->Discard();
+        entry.byteCode_ = std::move(file.byteCode);
+    } else {
+        entry.module_ = module;
+    }
+    entry.isSectionLoaded_ = true;
+    entry.isBuilt_ = true;
+    return true;
+}
+
+void ScriptModuleCache::SaveToDiskCache(const Entry &entry, const std::vector<std::uint8_t> &byteCode) const {
+    if (!isDiskCacheEnabled_) return;
+
+    ScriptByteCodeCacheFile file;
+    file.key = MakeDiskCacheKey(apiSignatureHash_, entry.scriptPath_, entry.defineKey_);
+    for (const auto &source : entry.sources_) {
+        file.sources.push_back({ source.path, source.contentHash });
+    }
+    file.hasGlobalState = entry.hasGlobalState_;
+    file.buildMessages = entry.buildMessages_;
+    file.metadata = entry.metadata_;
+    file.byteCode = byteCode;
+    file.Save(GetDiskCachePath(entry.scriptPath_, entry.defineKey_));
+}
+
+} // namespace KashipanEngine
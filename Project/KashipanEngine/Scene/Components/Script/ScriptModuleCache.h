@@ -0,0 +1,163 @@
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class asIScriptEngine;
+class asIScriptModule;
+class asITypeInfo;
+class CScriptBuilder;
+
+namespace KashipanEngine {
+
+class SceneScriptEngine;
+struct ScriptByteCodeCacheFile;
+
+/// @brief CScriptBuilderが収集したメタデータを、型名・変数名をキーにして保持し直したもの
+/// @details CScriptBuilderのメタデータは型ID・グローバル変数のインデックスをキーにしており、
+///          ビルドしたモジュールでしか引けない。バイトコードから複製したモジュールでも同じ
+///          メタデータを使えるよう、名前（名前空間付き）とプロパティのインデックスで引けるようにする
+class ScriptMetadataTable final {
+public:
+    /// @brief ビルド直後のbuilderから、moduleに含まれる型・グローバル変数のメタデータを取り込む
+    void Capture(CScriptBuilder &builder, asIScriptModule *module);
+    void Clear();
+
+    const std::vector<std::string> &ForGlobalVar(const char *nameSpace, const char *name) const;
+    const std::vector<std::string> &ForType(const asITypeInfo *type) const;
+    const std::vector<std::string> &ForTypeProperty(const asITypeInfo *type, std::uint32_t propertyIndex) const;
+
+private:
+    /// @brief ディスクキャッシュへの書き出し・読み込み用
+    friend struct ScriptByteCodeCacheFile;
+
+    std::unordered_map<std::string, std::vector<std::string>> globalVars_;
+    std::unordered_map<std::string, std::vector<std::string>> types_;
+    std::unordered_map<std::string, std::vector<std::vector<std::string>>> typeProperties_;
+};
+
+/// @brief スクリプトファイルのコンパイル結果を、同じスクリプトを使う全ScriptComponentで共有するキャッシュ
+/// @details キーは「スクリプトの論理パス + define集合」で、各エントリはinclude先を含む全ソースの
+///          内容ハッシュを持つ。取得時にソースの更新日時・サイズが変わっていれば内容ハッシュを取り直し、
+///          異なればそのパスだけを再コンパイルして古いエントリを置き換える（古いエントリは
+///          IsSuperseded() が true になり、使用中のインスタンスが手放した時点で破棄される）。
+///          - 変更可能なグローバル変数を持たないスクリプトは、1つのモジュールを全インスタンスで共有する
+///          - 持つスクリプトはグローバル変数をインスタンスごとに分けるため、コンパイル済みのバイトコードから
+///            インスタンス専用のモジュールを複製する（ソースからの再コンパイルは行わない）
+///          コンパイル結果はプロジェクトの Cache/ScriptByteCode/ にも保存し、次回起動時はソースの内容ハッシュ・
+///          登録APIのハッシュ・AngelScriptのバージョンが一致すればコンパイルせずに読み込む。
+///          キャッシュが古い・壊れている場合は通常どおりソースからコンパイルし直す。
+class ScriptModuleCache final {
+public:
+    /// @brief 1つのスクリプト（パス・define集合・内容の組）のコンパイル結果
+    class Entry final {
+    public:
+        const std::string &GetScriptPath() const noexcept { return scriptPath_; }
+        std::uint64_t GetContentHash() const noexcept { return contentHash_; }
+        /// @brief ビルドに成功したか（失敗時もエラー内容を返すためにエントリ自体はキャッシュされる）
+        bool IsBuilt() const noexcept { return isBuilt_; }
+        /// @brief ソースファイル自体を読み込めたか（false の場合はファイルが存在しない等）
+        bool IsSectionLoaded() const noexcept { return isSectionLoaded_; }
+        const std::vector<std::string> &GetBuildMessages() const noexcept { return buildMessages_; }
+        /// @brief 変更可能なグローバル変数を持つか（true の場合はインスタンスごとにモジュールを複製する）
+        bool HasGlobalState() const noexcept { return hasGlobalState_; }
+        const ScriptMetadataTable &GetMetadata() const noexcept { return metadata_; }
+        /// @brief ソースの変更により再コンパイルされ、新しいエントリへ置き換えられたか
+        bool IsSuperseded() const noexcept { return isSuperseded_; }
+
+    private:
+        friend class ScriptModuleCache;
+
+        struct SourceFile {
+            std::string path;
+            std::filesystem::file_time_type writeTime{};
+            std::uintmax_t size = 0;
+            std::uint64_t contentHash = 0;
+        };
+
+        std::string scriptPath_;
+        std::string defineKey_;
+        std::uint64_t contentHash_ = 0;
+        std::vector<SourceFile> sources_;
+        asIScriptModule *module_ = nullptr;
+        std::string moduleName_;
+        bool isSectionLoaded_ = false;
+        bool isBuilt_ = false;
+        bool hasGlobalState_ = false;
+        bool isSuperseded_ = false;
+        std::vector<std::string> buildMessages_;
+        /// @brief インスタンス専用モジュールの複製元（HasGlobalState()の場合のみ保持する）
+        std::vector<std::uint8_t> byteCode_;
+        ScriptMetadataTable metadata_;
+        std::uint32_t userCount_ = 0;
+    };
+
+    /// @brief Acquireで得た、1インスタンス分のモジュールの利用権
+    struct Lease {
+        std::shared_ptr<Entry> entry;
+        /// @brief インスタンスが使うモジュール（共有モジュール、またはインスタンス専用に複製したモジュール）
+        asIScriptModule *module = nullptr;
+        /// @brief インスタンス専用に複製したモジュールの名前（共有の場合は空）
+        std::string instanceModuleName;
+    };
+
+    ScriptModuleCache(SceneScriptEngine *owner, asIScriptEngine *engine);
+    ~ScriptModuleCache();
+
+    ScriptModuleCache(const ScriptModuleCache &) = delete;
+    ScriptModuleCache &operator=(const ScriptModuleCache &) = delete;
+
+    /// @brief スクリプトのモジュールを取得する（キャッシュに無い・ソースが変わった場合のみコンパイルする）
+    /// @param scriptPath "Assets/..." 形式の論理パス
+    /// @param defines プリプロセッサのdefine（順不同。キーの一部になる）
+    /// @param instanceModuleName インスタンス専用モジュールが必要になった場合に使うモジュール名
+    /// @return Lease::entry は常に非nullptr（ビルド失敗時は Lease::module が nullptr）
+    Lease Acquire(const std::string &scriptPath, const std::vector<std::string> &defines, const std::string &instanceModuleName);
+    /// @brief Acquireで得た利用権を返す（インスタンス専用モジュールはここで破棄する）
+    void Release(Lease &lease);
+
+    /// @brief キャッシュ中の全モジュールを破棄する（スクリプトエンジンの終了前に呼ぶ）
+    void Clear();
+
+    std::size_t GetEntryCount() const noexcept { return entries_.size(); }
+    /// @brief 起動からのコンパイル回数・キャッシュヒット回数（インスペクター表示用）
+    std::uint32_t GetCompileCount() const noexcept { return compileCount_; }
+    std::uint32_t GetHitCount() const noexcept { return hitCount_; }
+    /// @brief 起動からディスク上のバイトコードキャッシュを読み込んだ回数（インスペクター表示用）
+    std::uint32_t GetDiskLoadCount() const noexcept { return diskLoadCount_; }
+
+    /// @brief ディスク上のバイトコードキャッシュを使うか（既定は有効。無効にしても既存ファイルは消さない）
+    void SetDiskCacheEnabled(bool enabled) noexcept { isDiskCacheEnabled_ = enabled; }
+    bool IsDiskCacheEnabled() const noexcept { return isDiskCacheEnabled_; }
+
+private:
+    std::shared_ptr<Entry> Compile(const std::string &scriptPath, const std::vector<std::string> &defines, const std::string &defineKey);
+    /// @brief エントリのソースが変わっていないか（更新日時・サイズが同じなら内容は読まない）
+    bool IsUpToDate(Entry &entry) const;
+    void DiscardEntryModule(Entry &entry);
+
+    /// @brief キャッシュキーに対応するバイトコードキャッシュファイルの物理パス
+    std::string GetDiskCachePath(const std::string &scriptPath, const std::string &defineKey) const;
+    /// @brief ディスク上のバイトコードキャッシュからentryを復元する（古い・壊れている場合は false）
+    bool LoadFromDiskCache(Entry &entry);
+    /// @brief ビルドに成功したentryをバイトコードキャッシュへ書き出す
+    void SaveToDiskCache(const Entry &entry, const std::vector<std::uint8_t> &byteCode) const;
+
+    SceneScriptEngine *owner_ = nullptr;
+    asIScriptEngine *engine_ = nullptr;
+    std::unordered_map<std::string, std::shared_ptr<Entry>> entries_;
+    /// @brief 置き換えられたがまだ使用中のインスタンスがあるエントリ
+    std::vector<std::shared_ptr<Entry>> retiredEntries_;
+    std::uint32_t nextModuleId_ = 0;
+    std::uint32_t compileCount_ = 0;
+    std::uint32_t hitCount_ = 0;
+    std::uint32_t diskLoadCount_ = 0;
+    bool isDiskCacheEnabled_ = true;
+    /// @brief 登録APIの宣言から求めたハッシュ（バイトコードキャッシュのキーの一部）
+    std::uint64_t apiSignatureHash_ = 0;
+};
+
+} // namespace KashipanEngine
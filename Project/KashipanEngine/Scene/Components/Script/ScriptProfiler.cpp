@@ -0,0 +1,146 @@
+#include "Scene/Components/Script/ScriptProfiler.h"
+
+#include <algorithm>
+#include <numeric>
+
+#include <angelscript.h>
+
+namespace KashipanEngine {
+
+namespace {
+
+/// @brief asIScriptFunction::SetUserData で集計行の位置を保持する際の種別
+constexpr asPWORD kProfilerUserDataType = 0x4B53504Bu; // "KSPK"
+
+double ToMilliseconds(std::chrono::steady_clock::duration duration) {
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+} // namespace
+
+std::size_t ScriptProfiler::GetStatsIndex(asIScriptFunction *function) {
+    // ユーザーデータには「世代 << 32 | (行番号 + 1)」を入れる（Reset前に付けた値は世代違いで無視される）
+    const auto cached = reinterpret_cast<std::uintptr_t>(function->GetUserData(kProfilerUserDataType));
+    if (cached != 0 && static_cast<std::uint32_t>(static_cast<std::uint64_t>(cached) >> 32) == generation_) {
+        return static_cast<std::size_t>((cached & 0xFFFFFFFFu) - 1);
+    }
+
+    const char *section = nullptr;
+    function->GetDeclaredAt(&section, nullptr, nullptr);
+    const std::string declaration = function->GetDeclaration(true, true, false);
+    const std::string sectionName = section ? section : "";
+    std::string key = sectionName;
+    key += '|';
+    key += declaration;
+
+    auto [it, inserted] = statsIndexByKey_.try_emplace(std::move(key), stats_.size());
+    if (inserted) {
+        FunctionStats stats;
+        stats.declaration = declaration;
+        stats.section = sectionName;
+        stats_.push_back(std::move(stats));
+    }
+    const std::uint64_t encoded = (static_cast<std::uint64_t>(generation_) << 32) | static_cast<std::uint64_t>(it->second + 1);
+    function->SetUserData(reinterpret_cast<void *>(static_cast<std::uintptr_t>(encoded)), kProfilerUserDataType);
+    return it->second;
+}
+
+bool ScriptProfiler::BeginCall(asIScriptFunction *function) {
+    if (!isInstrumentationEnabled_ || !function) return false;
+    ActiveCall call;
+    call.statsIndex = GetStatsIndex(function);
+    call.start = Clock::now();
+    callStack_.push_back(call);
+    return true;
+}
+
+void ScriptProfiler::EndCall() {
+    if (callStack_.empty()) return;
+    const ActiveCall call = callStack_.back();
+    callStack_.pop_back();
+
+    const Clock::duration total = Clock::now() - call.start;
+    FunctionStats &stats = stats_[call.statsIndex];
+    ++stats.callCount;
+    stats.totalMs += ToMilliseconds(total);
+    stats.selfMs += ToMilliseconds(total - call.childTime);
+    if (!callStack_.empty()) {
+        callStack_.back().childTime += total;
+    }
+}
+
+void ScriptProfiler::OnLine(asIScriptContext *context) {
+    if (!isSamplingEnabled_ || !context) return;
+    const Clock::time_point now = Clock::now();
+    if (now - lastSampleTime_ < samplingInterval_) return;
+    lastSampleTime_ = now;
+    ++sampleCount_;
+
+    // 再帰している関数の総サンプル数を1サンプルにつき1回だけ数えるため、記録済みの行を覚えておく
+    std::vector<std::size_t> countedIndices;
+    const asUINT callstackSize = context->GetCallstackSize();
+    bool isTopFunction = true;
+    for (asUINT level = 0; level < callstackSize; ++level) {
+        // 入れ子の呼び出し（PushState）の境界では関数が nullptr になる
+        asIScriptFunction *function = context->GetFunction(level);
+        if (!function) continue;
+        const std::size_t index = GetStatsIndex(function);
+        if (isTopFunction) {
+            ++stats_[index].selfSamples;
+            isTopFunction = false;
+        }
+        if (std::find(countedIndices.begin(), countedIndices.end(), index) == countedIndices.end()) {
+            ++stats_[index].totalSamples;
+            countedIndices.push_back(index);
+        }
+    }
+}
+
+void ScriptProfiler::Reset() {
+    stats_.clear();
+    statsIndexByKey_.clear();
+    sampleCount_ = 0;
+    startTime_ = Clock::now();
+    ++generation_;
+    callStack_.clear();
+}
+
+double ScriptProfiler::GetElapsedMs() const {
+    return ToMilliseconds(Clock::now() - startTime_);
+}
+
+JSON ScriptProfiler::ToJson() const {
+    std::vector<std::size_t> order(stats_.size());
+    std::iota(order.begin(), order.end(), std::size_t{ 0 });
+    std::sort(order.begin(), order.end(), [this](std::size_t a, std::size_t b) {
+        if (stats_[a].selfMs != stats_[b].selfMs) return stats_[a].selfMs > stats_[b].selfMs;
+        return stats_[a].selfSamples > stats_[b].selfSamples;
+    });
+
+    JSON functions = JSON::array();
+    for (const std::size_t index : order) {
+        const FunctionStats &stats = stats_[index];
+        functions.push_back({
+            { "declaration", stats.declaration },
+            { "section", stats.section },
+            { "callCount", stats.callCount },
+            { "totalMs", stats.totalMs },
+            { "selfMs", stats.selfMs },
+            { "selfSamples", stats.selfSamples },
+            { "totalSamples", stats.totalSamples },
+        });
+    }
+
+    JSON json = JSON::object();
+    json["elapsedMs"] = GetElapsedMs();
+    json["sampleCount"] = sampleCount_;
+    json["samplingIntervalUs"] = GetSamplingIntervalMicroseconds();
+    json["functions"] = std::move(functions);
+    return json;
+}
+
+bool ScriptProfiler::ExportToJsonFile(const std::string &filePath) const {
+    return SaveJSON(ToJson(), filePath);
+}
+
+} // namespace KashipanEngine
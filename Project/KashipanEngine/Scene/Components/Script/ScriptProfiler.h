@@ -0,0 +1,91 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Utilities/FileIO/JSON.h"
+
+class asIScriptContext;
+class asIScriptFunction;
+
+namespace KashipanEngine {
+
+/// @brief スクリプト関数ごとの実行時間・呼び出し回数を集計するプロファイラー
+/// @details 2種類の計測を独立して有効にできる。
+///          - 計測（インストルメント）: ScriptCall でエンジンから呼び出した関数（Update・OnCollisionEnter 等）
+///            ごとに、呼び出し回数・総時間（入れ子の呼び出しを含む）・自己時間（含まない）を記録する
+///          - サンプリング: ラインコールバックで一定間隔ごとにコールスタックを記録し、スクリプト内部の関数まで
+///            含めて、スタック最上位にいた回数（自己）・スタック上にいた回数（総）を数える
+///          関数は「スクリプトファイル + 宣言」で識別するため、モジュールの複製やリロードをまたいでも同じ行に集計される。
+class ScriptProfiler final {
+public:
+    /// @brief 1関数分の集計結果
+    struct FunctionStats {
+        std::string declaration;
+        std::string section;
+        std::uint64_t callCount = 0;
+        double totalMs = 0.0;
+        double selfMs = 0.0;
+        std::uint64_t selfSamples = 0;
+        std::uint64_t totalSamples = 0;
+    };
+
+    void SetInstrumentationEnabled(bool enabled) noexcept { isInstrumentationEnabled_ = enabled; }
+    bool IsInstrumentationEnabled() const noexcept { return isInstrumentationEnabled_; }
+    /// @brief サンプリングの有効・無効（切り替え後は ScriptContextPool::RefreshLineCallbacks() を呼ぶこと）
+    void SetSamplingEnabled(bool enabled) noexcept { isSamplingEnabled_ = enabled; }
+    bool IsSamplingEnabled() const noexcept { return isSamplingEnabled_; }
+    /// @brief サンプリング間隔（マイクロ秒）
+    void SetSamplingIntervalMicroseconds(std::uint32_t microseconds) noexcept { samplingInterval_ = std::chrono::microseconds(microseconds); }
+    std::uint32_t GetSamplingIntervalMicroseconds() const noexcept { return static_cast<std::uint32_t>(samplingInterval_.count()); }
+
+    /// @brief エンジンからの関数呼び出しの開始（入れ子可）
+    /// @return 計測を開始した場合は true（この場合のみ EndCall を対にして呼ぶ）
+    bool BeginCall(asIScriptFunction *function);
+    void EndCall();
+    /// @brief ラインコールバックから呼ばれ、サンプリング間隔が経過していればコールスタックを記録する
+    void OnLine(asIScriptContext *context);
+
+    /// @brief 集計結果を全て破棄する（スクリプトの実行中には呼ばないこと）
+    void Reset();
+
+    const std::vector<FunctionStats> &GetStats() const noexcept { return stats_; }
+    std::uint64_t GetSampleCount() const noexcept { return sampleCount_; }
+    /// @brief 集計を開始（または Reset）してからの経過時間（ミリ秒）
+    double GetElapsedMs() const;
+
+    /// @brief 集計結果をJSONへ変換する（自己時間の降順）
+    JSON ToJson() const;
+    /// @brief 集計結果をJSONファイルへ書き出す
+    bool ExportToJsonFile(const std::string &filePath) const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    /// @brief 計測中の呼び出し1段分
+    struct ActiveCall {
+        std::size_t statsIndex = 0;
+        Clock::time_point start{};
+        Clock::duration childTime{};
+    };
+
+    /// @brief 関数に対応する集計行の位置（初回のみ宣言文字列を作り、以降は関数のユーザーデータから引く）
+    std::size_t GetStatsIndex(asIScriptFunction *function);
+
+    bool isInstrumentationEnabled_ = false;
+    bool isSamplingEnabled_ = false;
+    Clock::duration samplingInterval_ = std::chrono::microseconds(1000);
+    Clock::time_point lastSampleTime_{};
+    Clock::time_point startTime_ = Clock::now();
+
+    std::vector<FunctionStats> stats_;
+    std::unordered_map<std::string, std::size_t> statsIndexByKey_;
+    std::vector<ActiveCall> callStack_;
+    std::uint64_t sampleCount_ = 0;
+    /// @brief Reset のたびに進め、関数のユーザーデータに残った古い行番号を無効にする
+    std::uint32_t generation_ = 1;
+};
+
+} // namespace KashipanEngine
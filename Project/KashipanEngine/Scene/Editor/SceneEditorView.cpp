@@ -173,7 +173,7 @@ void SceneEditorView::UpdateCameraBuffer() {
         orbitState->SetDistance(distance_);
     }
 
-    view_ = transform->GetWorldMatrix().Inverse();
+    view_ = transform->GetWorldMatrix().InverseAffine();
     const float width = static_cast<float>(screenBuffer_->GetWidth());
     const float height = static_cast<float>(screenBuffer_->GetHeight());
     const float aspect = (height > 0.0f) ? (width / height) : (16.0f / 9.0f);
@@ -584,7 +584,7 @@ void SceneEditorView::HandleObjectPicking(SceneObjectHierarchy *hierarchy, const
 
             // レイをオブジェクトのローカル空間へ変換して三角形と判定する
             // （アフィン変換では線分上のパラメータtが保存されるため、tはワールド空間の奥行き比較にそのまま使える）
-            const Matrix4x4 invWorld = world.Inverse();
+            const Matrix4x4 invWorld = world.InverseAffine();
             const Vector3 localStart = TransformPoint(rayStart, invWorld);
             const Vector3 localDir = TransformPoint(rayEnd, invWorld) - localStart;
 
@@ -982,7 +982,7 @@ void SceneEditorView::ApplyWorldMatrixToTransform(Transform *transform, const Ma
     Matrix4x4 local = worldMatrix;
     if (auto *parentObject = transform->GetParentObject()) {
         if (auto *parentTransform = parentObject->GetComponent<Transform>()) {
-            local = worldMatrix * parentTransform->GetWorldMatrix().Inverse();
+            local = worldMatrix * parentTransform->GetWorldMatrix().InverseAffine();
         }
     }
 
@@ -4,6 +4,7 @@
 #include <filesystem>
 #include "Core/ProjectPaths.h"
 #include "Scene/SceneBackupPath.h"
+#include "Scene/SceneBinaryFormat.h"
 #include "Scene/SceneFileIO.h"
 #include "Utilities/Conversion/ConvertString.h"
 #include "Utilities/FileIO.h"
@@ -69,13 +70,15 @@ void SceneLoader::RefreshFileList() {
         if (!std::filesystem::exists(physicalFolder, ec)) continue;
         for (const auto &entry : std::filesystem::directory_iterator(
                 physicalFolder, std::filesystem::directory_options::skip_permission_denied, ec)) {
-            // 単一ファイル形式（.json）とフォルダ形式（.scene）の両方を一覧に含める
+            // 単一ファイル形式（.json）・フォルダ形式（.scene）・バイナリ形式（.kscene）を一覧に含める
             std::error_code statusError;
             const auto status = entry.status(statusError);
             if (statusError) continue;
-            const bool isJsonFile = std::filesystem::is_regular_file(status) && entry.path().extension() == ".json";
+            const bool isRegularFile = std::filesystem::is_regular_file(status);
+            const bool isJsonFile = isRegularFile && entry.path().extension() == ".json";
+            const bool isBinaryFile = isRegularFile && entry.path().extension() == kSceneBinaryExtension;
             const bool isSceneFolder = std::filesystem::is_directory(status) && entry.path().extension() == ".scene";
-            if (!isJsonFile && !isSceneFolder) continue;
+            if (!isJsonFile && !isBinaryFile && !isSceneFolder) continue;
             // 一覧はシーンの読み込みにそのまま渡すため、論理パスへ戻して保持する
             sceneFiles_.push_back(ProjectPaths::ToLogical(entry.path().generic_string()));
         }
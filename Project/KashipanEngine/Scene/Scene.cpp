@@ -1,5 +1,6 @@
 #include "Scene/Scene.h"
 #include "Scene/SceneBackupPath.h"
+#include "Scene/SceneBinaryComponentLoader.h"
 #include "Core/GameEngine.h"
 #include "Scene/SceneManager.h"
 #include "Scene/SceneContext.h"
@@ -7,6 +8,7 @@
 #include "Assets/SkeletonManager.h"
 #include "Objects/Components/Transform.h"
 #include "Objects/Components/Collider/RigidBody3D.h"
+#include "Utilities/TimeUtils.h"
 #ifdef USE_IMGUI
 #include "Scene/SceneEditor.h"
 #include "Scene/SceneEditorContext.h"
@@ -56,6 +58,10 @@ Scene::Scene(const JSON &sceneData) : Scene(std::string("Unnamed Scene")) {
     LoadFromJSON(sceneData);
 }
 
+Scene::Scene(const SceneBinaryReader &sceneData) : Scene(std::string("Unnamed Scene")) {
+    LoadFromSceneBinary(sceneData);
+}
+
 Scene::~Scene() {
 #if !defined(RELEASE_BUILD)
     // Releaseビルドではデバッグ用のバックアップ書き出しを行わない
@@ -157,24 +163,7 @@ bool Scene::LoadFromJSON(const JSON &json) {
     if (json.empty()) return false;
     name_ = json.value("sceneName", "");
     sceneID_ = UUID128(json.value("sceneID", ""));
-    // シーンコンポーネントを追加
-    std::vector<std::pair<ISceneComponent *, JSON>> loadedComponents;
-    // 先にコンポーネントを全て登録してからロードする
-    for (const auto &compData : json.value("sceneComponents", std::vector<JSON>())) {
-        std::string compType = compData.value("type", "");
-        if (compType.empty()) continue;
-        auto comp = CreateSceneComponentByType(compType);
-        if (!comp) continue;
-        auto compJson = compData.value("data", JSON());
-        // 追加時の初期化前にアクティブ状態を反映し、無効なコンポーネントの初期化を防ぐ
-        comp->SetActive(compJson.value("isActive", true));
-        loadedComponents.emplace_back(AddComponent(std::move(comp)), compJson);
-    }
-    for (const auto &[comp, compJson] : loadedComponents) {
-        if (comp) {
-            comp->LoadFromJsonInterface(Passkey<Scene>{}, compJson);
-        }
-    }
+    LoadSceneComponentsFromJSON(json);
     // オブジェクトを全て追加してからオブジェクトにコンポーネントを追加する
     std::vector<EmptyObject *> createdObjects;
     const auto &objects = json.value("sceneObjects", std::vector<JSON>());
@@ -194,7 +183,67 @@ bool Scene::LoadFromJSON(const JSON &json) {
     // （エディターありの場合は再生開始時（PlayStart）に削除される）
     DeleteEditorOnlyObjects();
 #endif
-    // シーン変数を追加
+    LoadSceneVariablesFromJSON(json);
+    return true;
+}
+
+bool Scene::LoadFromSceneBinary(const SceneBinaryReader &reader) {
+    // sceneObjects 以外（シーン名・シーンコンポーネント・シーン変数）は小さいため、JSONへ戻して読み込む
+    const JSON sceneValues = reader.DecodeSceneValues();
+    if (!sceneValues.is_object() || sceneValues.empty()) return false;
+    // オブジェクトを作り始める前に、壊れたオブジェクトが無いか確かめる
+    std::vector<JSON> objectValues(reader.GetObjectCount());
+    for (std::uint32_t i = 0; i < objectValues.size(); ++i) {
+        objectValues[i] = reader.DecodeObjectValues(i);
+        if (!objectValues[i].is_object()) return false;
+    }
+
+    name_ = sceneValues.value("sceneName", "");
+    sceneID_ = UUID128(sceneValues.value("sceneID", ""));
+    LoadSceneComponentsFromJSON(sceneValues);
+    // LoadFromJSON と同じく、オブジェクトを全て追加してからオブジェクトにコンポーネントを追加する
+    std::vector<EmptyObject *> createdObjects;
+    createdObjects.reserve(objectValues.size());
+    for (const auto &objData : objectValues) {
+        createdObjects.push_back(CreateEmptyObject(objData.value("name", "Empty Object"), UUID128(objData.value("objectID", ""))));
+    }
+    const SceneBinaryComponentLoader loader(reader);
+    for (std::uint32_t i = 0; i < objectValues.size(); ++i) {
+        if (createdObjects[i]->LoadFromSceneBinary(Passkey<Scene>{}, objectValues[i], loader, i)) continue;
+        // 行やコンポーネントが壊れている場合は、読み込み途中のシーンを残さずに空へ戻す
+        // （呼び出し側は LoadFromJSON での読み込みへ切り替える）
+        ClearSceneObjects();
+        ClearSceneComponents();
+        return false;
+    }
+#if !defined(USE_IMGUI)
+    DeleteEditorOnlyObjects();
+#endif
+    LoadSceneVariablesFromJSON(sceneValues);
+    return true;
+}
+
+void Scene::LoadSceneComponentsFromJSON(const JSON &json) {
+    std::vector<std::pair<ISceneComponent *, JSON>> loadedComponents;
+    // 先にコンポーネントを全て登録してからロードする
+    for (const auto &compData : json.value("sceneComponents", std::vector<JSON>())) {
+        std::string compType = compData.value("type", "");
+        if (compType.empty()) continue;
+        auto comp = CreateSceneComponentByType(compType);
+        if (!comp) continue;
+        auto compJson = compData.value("data", JSON());
+        // 追加時の初期化前にアクティブ状態を反映し、無効なコンポーネントの初期化を防ぐ
+        comp->SetActive(compJson.value("isActive", true));
+        loadedComponents.emplace_back(AddComponent(std::move(comp)), compJson);
+    }
+    for (const auto &[comp, compJson] : loadedComponents) {
+        if (comp) {
+            comp->LoadFromJsonInterface(Passkey<Scene>{}, compJson);
+        }
+    }
+}
+
+void Scene::LoadSceneVariablesFromJSON(const JSON &json) {
     for (const auto &varData : json.value("sceneVariables", std::vector<JSON>())) {
         std::string key = varData.value("key", "");
         if (key.empty()) continue;
@@ -209,7 +258,6 @@ bool Scene::LoadFromJSON(const JSON &json) {
         // reinterpret し、値が破損して見える（未定義動作）。
         sceneVariables_[key] = LoadAnyFromJson(varData.value("value", JSON()), typeInfo);
     }
-    return true;
 }
 
 bool Scene::RemoveSceneVariable(const std::string &key) {
@@ -260,6 +308,8 @@ EmptyObject *Scene::CreateEmptyObject(const std::string &name, const UUID128 &ob
     objectsByUUID_[newObjPtr->GetObjectID()] = newObjPtr;
     objectsExistingSet_.insert(newObjPtr);
     objectsByName_[name].insert(newObjPtr);
+    // 未解決だった親のUUIDがこのオブジェクトを指している場合があるため、親子関係を解決し直す
+    transformHierarchy_.MarkStructureDirty();
     return newObjPtr;
 }
 
@@ -371,6 +421,7 @@ void Scene::RemoveObjectFromMaps(EmptyObject *obj) {
     if (!obj) return;
     objectsByUUID_.erase(obj->GetObjectID());
     objectsExistingSet_.erase(obj);
+    transformHierarchy_.MarkStructureDirty();
     auto nameIt = objectsByName_.find(obj->GetName());
     if (nameIt != objectsByName_.end()) {
         nameIt->second.erase(obj);
@@ -489,13 +540,48 @@ void Scene::UpdateSceneObjects() {
         if (obj) snapshot.push_back(obj);
     }
 
-    for (EmptyObject *obj : snapshot) {
-        // このフレーム中に別のオブジェクトのUpdateから削除されていたらスキップする
-        if (!GetSceneObject(obj)) continue;
-        if (obj->IsActive()) {
-            obj->UpdateInterface(Passkey<Scene>());
+    auto updateObjects = [this, &snapshot](int minPriority, int maxPriority) {
+        for (EmptyObject *obj : snapshot) {
+            // このフレーム中に別のオブジェクトのUpdateから削除されていたらスキップする
+            if (!GetSceneObject(obj)) continue;
+            if (obj->IsActive()) {
+                obj->UpdateInterface(Passkey<Scene>(), minPriority, maxPriority);
+            }
         }
-    }
+    };
+
+    // 経過時間等はコンポーネントごとに取得し直さず、ここで1度だけ取得して全コンポーネントへ配る
+    ComponentBatchContext context;
+    context.deltaTime = GetDeltaTime();
+    context.gameSpeed = GetGameSpeed();
+
+    // Update中に新しい型のコンポーネントが追加されると batchProcessedPools_ の途中へプールが挿入され、
+    // 走査位置がずれる（同じプールを2度更新する等）ため、オブジェクトと同じくフレームの始めの状態を使う。
+    // 途中で作られたプールのコンポーネントは、途中で生成されたオブジェクトと同じく次のフレームから更新される
+    // （プールはシーンの破棄まで解放されないため、ポインタは有効なまま）
+    batchProcessedPoolsSnapshot_.assign(batchProcessedPools_.begin(), batchProcessedPools_.end());
+
+    // batchProcessedPools_ は一括更新の優先度順に並んでいるため、優先度の区切りごとに
+    // 「その優先度未満のコンポーネントの個別更新 → 一括更新」を繰り返し、残りを最後に個別更新する
+    // 個別更新でのオブジェクトの生成・親の変更による階層表の再構築は、並列ジョブから読まれる前にここで済ませる
+    RunComponentBatchStages(batchProcessedPoolsSnapshot_, updateObjects,
+        [this, &context](IComponentPoolBase *pool) {
+            transformHierarchy_.PrepareParallelReads();
+            pool->UpdateBatch(context);
+        });
+}
+
+void Scene::RegisterBatchProcessedPool(IComponentPoolBase *pool) {
+    if (!pool || !pool->IsBatchProcessed()) return;
+    // 一括更新の優先度->更新順に並べ、同じ更新順の型どうしはプールの生成順を保つ
+    auto it = std::upper_bound(batchProcessedPools_.begin(), batchProcessedPools_.end(), pool,
+        [](const IComponentPoolBase *a, const IComponentPoolBase *b) {
+            if (a->GetBatchUpdatePriority() != b->GetBatchUpdatePriority()) {
+                return a->GetBatchUpdatePriority() < b->GetBatchUpdatePriority();
+            }
+            return a->GetBatchUpdateOrder() < b->GetBatchUpdateOrder();
+        });
+    batchProcessedPools_.insert(it, pool);
 }
 
 void Scene::UpdateComponents() {
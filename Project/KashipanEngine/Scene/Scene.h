@@ -14,6 +14,7 @@
 #include "Objects/Collision/Collider.h"
 #include "Objects/ChunkedPool.h"
 #include "Objects/ComponentPool.h"
+#include "Objects/TransformHierarchy.h"
 #include "ComponentSerialize/ComponentRegistry.h"
 #include "Scene/Components/ISceneComponent.h"
 #include "Utilities/Passkeys.h"
@@ -30,6 +31,7 @@ class SceneEditorContext;
 
 class SceneManager;
 class GameEngine;
+class SceneBinaryReader;
 
 class AudioManager;
 class ModelManager;
@@ -50,6 +52,7 @@ class Scene final {
 public:
     explicit Scene(const std::string &sceneName);
     explicit Scene(const JSON &sceneData);
+    explicit Scene(const SceneBinaryReader &sceneData);
 
     Scene() = delete;
     virtual ~Scene();
@@ -68,12 +71,18 @@ public:
     void UpdateInterface(Passkey<SceneManager>) {
 #if defined(USE_IMGUI)
         // エディター実行時はPlay中（かつ一時停止していないか、1フレーム進める要求がある）場合のみ更新する
-        if (!isPlaying_ || (isPaused_ && !isStepFrameRequested_)) return;
+        if (!isPlaying_ || (isPaused_ && !isStepFrameRequested_)) {
+            // 停止中もエディターからの編集は反映させる
+            transformHierarchy_.UpdateWorldMatrices();
+            return;
+        }
         isStepFrameRequested_ = false;
 #endif
         UpdateSceneObjects();
         UpdateComponents();
         OnUpdate();
+        // 描画前に、このフレームで変更のあったTransformのワールド行列をまとめて計算しておく
+        transformHierarchy_.UpdateWorldMatrices();
     }
 
 #if defined(USE_IMGUI)
@@ -119,6 +128,12 @@ public:
     /// @param json シーンのJSONデータ
     /// @return 読み込みに成功した場合は true、失敗した場合は false を返す
     bool LoadFromJSON(const JSON &json);
+    /// @brief バイナリシーン（.kscene）の読み込み
+    /// @details シーン全体をJSONへ戻さず、オブジェクトごとに EmptyObject::LoadFromSceneBinary で読み込む。
+    ///          結果は DecodeScene の結果を LoadFromJSON に渡した場合と同じになる。
+    ///          コンポーネントの読み込みに1つでも失敗した場合は、作成したオブジェクトとシーンコンポーネントを全て破棄して false を返す
+    /// @return 読み込みに成功した場合は true、失敗した場合は false を返す（失敗時、シーンは空のまま）
+    bool LoadFromSceneBinary(const SceneBinaryReader &reader);
 
     void SetSceneManager(Passkey<SceneManager>, SceneManager *sceneManager) { sceneManager_ = sceneManager; }
 
@@ -425,6 +440,7 @@ protected:
         }
         if (!objectComponentPoolsByType_[typeID]) {
             objectComponentPoolsByType_[typeID] = CreateObjectComponentPoolByTypeID(typeID);
+            RegisterBatchProcessedPool(objectComponentPoolsByType_[typeID].get());
         }
         return objectComponentPoolsByType_[typeID].get();
     }
@@ -438,6 +454,7 @@ protected:
         }
         if (!objectComponentPoolsByType_[typeID]) {
             objectComponentPoolsByType_[typeID] = std::make_unique<ComponentPool<T>>();
+            RegisterBatchProcessedPool(objectComponentPoolsByType_[typeID].get());
         }
         return static_cast<ComponentPool<T> &>(*objectComponentPoolsByType_[typeID]);
     }
@@ -473,6 +490,11 @@ protected:
     static InputCommand *GetInputCommand() { return sInputCommand; }
 
 private:
+    /// @brief シーンコンポーネントをjsonの sceneComponents から追加・読み込みする
+    void LoadSceneComponentsFromJSON(const JSON &json);
+    /// @brief シーン変数をjsonの sceneVariables から追加する
+    void LoadSceneVariablesFromJSON(const JSON &json);
+
     static inline AudioManager *sAudioManager = nullptr;
     static inline ModelManager *sModelManager = nullptr;
     static inline SkeletonManager *sSkeletonManager = nullptr;
@@ -483,8 +505,15 @@ private:
     static inline Input *sInput = nullptr;
     static inline InputCommand *sInputCommand = nullptr;
 
+    /// @brief オブジェクトのコンポーネントを更新する
+    /// @details バッチ処理対象の型は、一括更新の優先度（ComponentBatchTraits::kUpdatePriority）ごとに
+    ///          全オブジェクトのそれ未満の優先度のコンポーネントを更新した後で一括更新する。
+    ///          オブジェクト単位で更新していた頃と同じく、優先度の低いコンポーネントの結果を見てから動き、
+    ///          優先度の高いコンポーネント（描画等）は一括更新の結果を同じフレームのうちに参照できる
     void UpdateSceneObjects();
     void UpdateComponents();
+    /// @brief 生成したプールの型がバッチ処理対象であれば、一括更新の対象へ更新順を保って追加する
+    void RegisterBatchProcessedPool(IComponentPoolBase *pool);
     void RegenerateUpdateComponentsList();
     void RemoveObjectFromMaps(EmptyObject *obj);
 
@@ -494,6 +523,10 @@ private:
     // オブジェクト
     //==================================================
 
+    /// @brief 全Transformの親子関係とワールド行列の表
+    /// @details Transformの破棄時に参照されるため、オブジェクトやコンポーネントのプールより先に宣言する（後に破棄される）
+    TransformHierarchy transformHierarchy_;
+
     /// @brief オブジェクトの実体を所有するチャンク方式プール（要素は絶対に再配置されない）
     ChunkedPool<EmptyObject> objectPool_;
     /// @brief シーン内での表示・保存順を保持する非所有ポインタのリスト（実体は objectPool_ が所有）
@@ -508,6 +541,10 @@ private:
 
     /// @brief 型IDでインデックスされたコンポーネントプール（実体はここが所有する）
     std::vector<std::unique_ptr<IComponentPoolBase>> objectComponentPoolsByType_;
+    /// @brief バッチ処理対象の型のプール（更新順に並ぶ。実体は objectComponentPoolsByType_ が所有）
+    std::vector<IComponentPoolBase *> batchProcessedPools_;
+    /// @brief UpdateSceneObjects の間に走査する batchProcessedPools_ の写し（毎フレーム確保し直さないよう保持する）
+    std::vector<IComponentPoolBase *> batchProcessedPoolsSnapshot_;
 
     //==================================================
     // シーンコンポーネント
@@ -0,0 +1,288 @@
+#include "Scene/SceneBinaryComponentLoader.h"
+#include "Objects/Components/Transform.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+namespace KashipanEngine {
+
+namespace {
+
+bool IsNumericColumn(SceneBinaryColumnKind kind) {
+    switch (kind) {
+    case SceneBinaryColumnKind::Int32:
+    case SceneBinaryColumnKind::Int64:
+    case SceneBinaryColumnKind::UInt32:
+    case SceneBinaryColumnKind::UInt64:
+    case SceneBinaryColumnKind::Float32:
+    case SceneBinaryColumnKind::Double:
+    case SceneBinaryColumnKind::MixedInteger:
+        return true;
+    default:
+        return false;
+    }
+}
+
+/// @brief 列の値をメンバー変数へ書き込めるか（FromJSON が例外を投げずに読める組み合わせ）
+bool IsColumnCompatible(SerializedLayout::Scalar scalar, SceneBinaryColumnKind kind) {
+    switch (scalar) {
+    case SerializedLayout::Scalar::Bool: return kind == SceneBinaryColumnKind::Bool;
+    case SerializedLayout::Scalar::Int32:
+    case SerializedLayout::Scalar::UInt32:
+    case SerializedLayout::Scalar::Float: return IsNumericColumn(kind);
+    case SerializedLayout::Scalar::String: return kind == SceneBinaryColumnKind::String;
+    default: return false;
+    }
+}
+
+template <typename Stored>
+Stored ReadStored(const std::uint8_t *field) {
+    Stored value;
+    std::memcpy(&value, field, sizeof(value));
+    return value;
+}
+
+/// @brief 数値の列の値を T へ変換して読む（JSONの get<T> と同じ変換）
+template <typename T>
+T ReadNumber(SceneBinaryColumnKind kind, const std::uint8_t *field) {
+    switch (kind) {
+    case SceneBinaryColumnKind::Int32: return static_cast<T>(ReadStored<std::int32_t>(field));
+    case SceneBinaryColumnKind::Int64: return static_cast<T>(ReadStored<std::int64_t>(field));
+    case SceneBinaryColumnKind::UInt32: return static_cast<T>(ReadStored<std::uint32_t>(field));
+    case SceneBinaryColumnKind::UInt64: return static_cast<T>(ReadStored<std::uint64_t>(field));
+    case SceneBinaryColumnKind::Float32: return static_cast<T>(ReadStored<float>(field));
+    case SceneBinaryColumnKind::Double: return static_cast<T>(ReadStored<double>(field));
+    case SceneBinaryColumnKind::MixedInteger: {
+        const auto number = ReadStored<std::uint64_t>(field + 1);
+        return *field != 0 ? static_cast<T>(number) : static_cast<T>(static_cast<std::int64_t>(number));
+    }
+    default: return T{};
+    }
+}
+
+} // namespace
+
+SceneBinaryComponentLoader::SceneBinaryComponentLoader(const SceneBinaryReader &reader) : reader_(reader) {
+    types_.resize(reader_.GetComponentTypeCount());
+    for (std::uint32_t typeIndex = 0; typeIndex < types_.size(); ++typeIndex) {
+        if (!reader_.IsColumnarType(typeIndex)) continue;
+        // メンバー変数表は型ごとに共有されるため、一時インスタンスから引いておく
+        const auto prototype = CreateObjectComponentByType(std::string(reader_.GetComponentTypeName(typeIndex)));
+        if (!prototype) continue;
+        auto &binding = types_[typeIndex];
+        binding.typeID = prototype->GetComponentTypeID();
+        if (binding.typeID == IObjectComponent::GetComponentTypeID<Transform>()) {
+            if (BindTransformColumns(reader_.GetColumns(typeIndex), binding)) binding.kind = DirectKind::Transform;
+            continue;
+        }
+        if (!prototype->IsStateCoveredByMemberVariables()) continue;
+        binding.members = prototype->GetAllMemberVariables();
+        if (BindColumns(reader_.GetColumns(typeIndex), binding)) binding.kind = DirectKind::MemberVariables;
+    }
+}
+
+bool SceneBinaryComponentLoader::BindBaseColumn(const SceneBinaryColumn &column, TypeBinding &binding, bool &isCompatible) {
+    const auto &path = column.path;
+    if (path.size() != 1) return false;
+    const ColumnBinding columnBinding{ 0, 0, column.rowOffset, column.kind };
+    if (path[0] == "priority") {
+        isCompatible = IsNumericColumn(column.kind);
+        binding.priority = columnBinding;
+        return true;
+    }
+    if (path[0] == "isActive") {
+        isCompatible = column.kind == SceneBinaryColumnKind::Bool;
+        binding.isActive = columnBinding;
+        return true;
+    }
+    if (path[0] == "tag") {
+        isCompatible = column.kind == SceneBinaryColumnKind::String;
+        binding.tag = columnBinding;
+        return true;
+    }
+    return false;
+}
+
+bool SceneBinaryComponentLoader::BindColumns(std::span<const SceneBinaryColumn> columns, TypeBinding &binding) {
+    for (const auto &column : columns) {
+        const auto &path = column.path;
+        bool isCompatible = true;
+        if (BindBaseColumn(column, binding, isCompatible)) {
+            if (!isCompatible) return false;
+            continue;
+        }
+        // LoadFromJsonInterface・LoadMemberVariablesFromJson が読まない値（customData がオブジェクトでない等）は無視する
+        if (path[0] != "customData" || path.size() == 1) continue;
+
+        for (std::uint32_t memberIndex = 0; memberIndex < binding.members.size(); ++memberIndex) {
+            const auto &member = binding.members[memberIndex];
+            if (!member.loadValue || member.attributes.serializedKey != path[1]) continue;
+            const SerializedLayout &layout = member.serializedLayout;
+            if (layout.scalar == SerializedLayout::Scalar::None) return false;
+            if (layout.fieldCount == 0) {
+                if (path.size() != 2 || !IsColumnCompatible(layout.scalar, column.kind)) return false;
+                binding.memberColumns.push_back({ memberIndex, 0, column.rowOffset, column.kind });
+                continue;
+            }
+            if (path.size() != 3) return false;
+            // FromJSON が読まない余分な要素は無視する
+            const auto field = std::find_if(layout.fieldKeys.begin(), layout.fieldKeys.begin() + layout.fieldCount,
+                [&](const char *key) { return path[2] == key; });
+            if (field == layout.fieldKeys.begin() + layout.fieldCount) continue;
+            if (!IsColumnCompatible(layout.scalar, column.kind)) return false;
+            const auto fieldIndex = static_cast<std::uint32_t>(field - layout.fieldKeys.begin());
+            binding.memberColumns.push_back({ memberIndex, fieldIndex, column.rowOffset, column.kind });
+        }
+    }
+
+    // LoadMemberVariablesFromJson と同じく、メンバー変数表の順に書き込んで変数ごとにコールバックを呼ぶ
+    auto &memberColumns = binding.memberColumns;
+    std::sort(memberColumns.begin(), memberColumns.end(), [](const ColumnBinding &a, const ColumnBinding &b) {
+        return a.memberIndex != b.memberIndex ? a.memberIndex < b.memberIndex : a.fieldIndex < b.fieldIndex;
+    });
+    // 要素を持つ変数は全要素が揃っていること（欠けていると FromJSON は例外になるため、JSONを経由させる）
+    for (std::size_t i = 0; i < memberColumns.size();) {
+        const std::uint32_t memberIndex = memberColumns[i].memberIndex;
+        std::size_t end = i;
+        while (end < memberColumns.size() && memberColumns[end].memberIndex == memberIndex) ++end;
+        const std::uint8_t fieldCount = binding.members[memberIndex].serializedLayout.fieldCount;
+        if (fieldCount > 0 && end - i != fieldCount) return false;
+        i = end;
+    }
+    return true;
+}
+
+bool SceneBinaryComponentLoader::BindTransformColumns(std::span<const SceneBinaryColumn> columns, TypeBinding &binding) {
+    // Transform::SaveToJson が書き出す値（translate・scale は Vector3、rotate は Quaternion）
+    static constexpr std::array<std::string_view, 3> kValueKeys = { "translate", "rotate", "scale" };
+    static constexpr std::array<std::size_t, 3> kValueFieldOffsets = { 0, 3, 7 };
+    static constexpr std::array<std::string_view, 4> kFieldKeys = { "x", "y", "z", "w" };
+
+    std::array<bool, kTransformFieldCount> isBound{};
+    for (const auto &column : columns) {
+        const auto &path = column.path;
+        bool isCompatible = true;
+        if (BindBaseColumn(column, binding, isCompatible)) {
+            if (!isCompatible) return false;
+            continue;
+        }
+        if (path[0] != "customData" || path.size() == 1) continue;
+        if (path[1] == "parent") {
+            if (path.size() != 2 || column.kind != SceneBinaryColumnKind::String) return false;
+            binding.transformParent = ColumnBinding{ 0, 0, column.rowOffset, column.kind };
+            continue;
+        }
+        const auto value = std::find(kValueKeys.begin(), kValueKeys.end(), path[1]);
+        // LoadFromJson が読まない値は無視する
+        if (value == kValueKeys.end()) continue;
+        if (path.size() != 3) return false;
+        const auto valueIndex = static_cast<std::size_t>(value - kValueKeys.begin());
+        const std::size_t fieldCount = valueIndex == 1 ? 4 : 3;
+        const auto field = std::find(kFieldKeys.begin(), kFieldKeys.begin() + fieldCount, path[2]);
+        // FromJSON が読まない余分な要素は無視する
+        if (field == kFieldKeys.begin() + fieldCount) continue;
+        if (!IsNumericColumn(column.kind)) return false;
+        const std::size_t slot = kValueFieldOffsets[valueIndex] + static_cast<std::size_t>(field - kFieldKeys.begin());
+        binding.transformFields[slot] = ColumnBinding{ 0, 0, column.rowOffset, column.kind };
+        isBound[slot] = true;
+    }
+    // translate・rotate・scale の要素が1つでも欠けていると LoadFromJson は失敗・例外になるため、JSONを経由させる
+    return std::all_of(isBound.begin(), isBound.end(), [](bool bound) { return bound; });
+}
+
+std::optional<size_t> SceneBinaryComponentLoader::FindDirectTypeID(std::uint32_t componentIndex) const {
+    const auto typeIndex = reader_.GetComponentTypeIndex(componentIndex);
+    if (!typeIndex || *typeIndex >= types_.size() || types_[*typeIndex].kind == DirectKind::None) return std::nullopt;
+    return types_[*typeIndex].typeID;
+}
+
+bool SceneBinaryComponentLoader::LoadDirect(std::uint32_t componentIndex, IObjectComponent &component) const {
+    const auto typeIndex = reader_.GetComponentTypeIndex(componentIndex);
+    if (!typeIndex || *typeIndex >= types_.size()) return false;
+    const TypeBinding &binding = types_[*typeIndex];
+    if (binding.kind == DirectKind::None || component.GetComponentTypeID() != binding.typeID) return false;
+    const std::uint8_t *row = reader_.GetComponentRow(componentIndex);
+    if (!row || !LoadBaseState(binding, row, component)) return false;
+    return binding.kind == DirectKind::Transform
+        ? LoadTransform(binding, row, component)
+        : LoadMemberVariables(binding, row, component);
+}
+
+bool SceneBinaryComponentLoader::LoadBaseState(const TypeBinding &binding, const std::uint8_t *row, IObjectComponent &component) const {
+    // ファイルに無い値は LoadFromJsonInterface と同じ既定値にする
+    const int priority = binding.priority ? ReadNumber<int>(binding.priority->kind, row + binding.priority->rowOffset) : 1;
+    const bool isActive = binding.isActive ? row[binding.isActive->rowOffset] != 0 : true;
+    std::string_view tagName;
+    if (binding.tag) {
+        const auto text = reader_.GetString(ReadStored<std::uint32_t>(row + binding.tag->rowOffset));
+        if (!text) return false;
+        tagName = *text;
+    }
+    component.LoadBaseStateInterface(Passkey<SceneBinaryComponentLoader>{}, priority, isActive, std::string(tagName));
+    return true;
+}
+
+bool SceneBinaryComponentLoader::LoadTransform(const TypeBinding &binding, const std::uint8_t *row, IObjectComponent &component) const {
+    std::array<float, kTransformFieldCount> values{};
+    for (std::size_t i = 0; i < kTransformFieldCount; ++i) {
+        const ColumnBinding &column = binding.transformFields[i];
+        values[i] = ReadNumber<float>(column.kind, row + column.rowOffset);
+    }
+    UUID128 parentObjectID;
+    if (binding.transformParent) {
+        const auto text = reader_.GetString(ReadStored<std::uint32_t>(row + binding.transformParent->rowOffset));
+        if (!text) return false;
+        if (!text->empty()) parentObjectID = UUID128(std::string(*text));
+    }
+    static_cast<Transform &>(component).LoadSceneBinaryValues(Passkey<SceneBinaryComponentLoader>{},
+        Vector3(values[0], values[1], values[2]),
+        Quaternion(values[3], values[4], values[5], values[6]),
+        Vector3(values[7], values[8], values[9]),
+        parentObjectID);
+    return true;
+}
+
+bool SceneBinaryComponentLoader::LoadMemberVariables(const TypeBinding &binding, const std::uint8_t *row, IObjectComponent &component) const {
+    auto readString = [&](const ColumnBinding &column) {
+        return reader_.GetString(ReadStored<std::uint32_t>(row + column.rowOffset));
+    };
+
+    const auto &memberColumns = binding.memberColumns;
+    for (std::size_t i = 0; i < memberColumns.size();) {
+        const std::uint32_t memberIndex = memberColumns[i].memberIndex;
+        const auto &member = binding.members[memberIndex];
+        void *address = member.GetAddress(component);
+        for (; i < memberColumns.size() && memberColumns[i].memberIndex == memberIndex; ++i) {
+            const ColumnBinding &column = memberColumns[i];
+            const std::uint8_t *field = row + column.rowOffset;
+            switch (member.serializedLayout.scalar) {
+            case SerializedLayout::Scalar::Bool:
+                *static_cast<bool *>(address) = *field != 0;
+                break;
+            case SerializedLayout::Scalar::Int32:
+                *static_cast<std::int32_t *>(address) = ReadNumber<std::int32_t>(column.kind, field);
+                break;
+            case SerializedLayout::Scalar::UInt32:
+                *static_cast<std::uint32_t *>(address) = ReadNumber<std::uint32_t>(column.kind, field);
+                break;
+            case SerializedLayout::Scalar::Float:
+                // Vector3 等は fieldKeys の順に float が並ぶ（GetSerializedLayout で大きさを確かめている）
+                static_cast<float *>(address)[column.fieldIndex] = ReadNumber<float>(column.kind, field);
+                break;
+            case SerializedLayout::Scalar::String: {
+                const auto text = readString(column);
+                if (!text) return false;
+                static_cast<std::string *>(address)->assign(text->data(), text->size());
+                break;
+            }
+            default:
+                return false;
+            }
+        }
+        member.NotifyModified(component);
+    }
+    return true;
+}
+
+} // namespace KashipanEngine
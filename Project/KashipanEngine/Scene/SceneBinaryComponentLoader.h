@@ -0,0 +1,94 @@
+#pragma once
+#include "Scene/SceneBinaryFormat.h"
+#include "Objects/IObjectComponent.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace KashipanEngine {
+
+/// @brief バイナリシーンの列形式の行を、JSONを経由せずにコンポーネントへ書き込む
+/// @details 状態が全てメンバー変数表に登録されている型（MEMBER_VARIABLES_COVER_ALL_STATE）のうち、
+///          ファイルの列が全て「優先度・アクティブ状態・タグ」か「保存キーを指定したメンバー変数（Vector3 等は要素ごと）」に
+///          対応する種別を直接読み込む。全てのオブジェクトが持つ Transform は保存・読み込みを独自に実装しているため、
+///          列（translate・rotate・scale の要素と parent）を専用の対応で読み込む。
+///          それ以外の種別（保存・読み込みを独自に実装する型や、列の種類がメンバー変数の型と合わない種別）は
+///          SceneBinaryReader::DecodeComponent でJSONへ戻して読み込むこと。
+///          直接読み込みは LoadFromJsonInterface と同じ結果になる（ファイルに無いメンバー変数は変更しない）
+class SceneBinaryComponentLoader final {
+public:
+    /// @brief ファイル内の種別ごとに、列とメンバー変数の対応を作る
+    /// @param reader 開いたバイナリシーン（本クラスより長く生存させること）
+    explicit SceneBinaryComponentLoader(const SceneBinaryReader &reader);
+
+    const SceneBinaryReader &GetReader() const noexcept { return reader_; }
+
+    /// @brief コンポーネントを直接読み込める場合は、その型ID（IObjectComponent::GetComponentTypeID）を返す
+    std::optional<size_t> FindDirectTypeID(std::uint32_t componentIndex) const;
+    /// @brief 行の値を、プールへ配置した（所属オブジェクトへ登録する前の）コンポーネントへ書き込む
+    /// @param component FindDirectTypeID が返した型のコンポーネント
+    /// @return 行が壊れている場合は false（書き込み途中の component は破棄すること）
+    bool LoadDirect(std::uint32_t componentIndex, IObjectComponent &component) const;
+
+private:
+    /// @brief 1列分の書き込み先
+    struct ColumnBinding {
+        /// @brief メンバー変数表の番号
+        std::uint32_t memberIndex = 0;
+        /// @brief 要素の番号（SerializedLayout::fieldKeys。単体の値の場合は0）
+        std::uint32_t fieldIndex = 0;
+        std::uint32_t rowOffset = 0;
+        SceneBinaryColumnKind kind = SceneBinaryColumnKind::Null;
+    };
+
+    /// @brief 直接読み込む方法
+    enum class DirectKind : std::uint8_t {
+        /// @brief 直接読み込めない（JSONを経由する）
+        None,
+        /// @brief メンバー変数表の変数へ書き込む
+        MemberVariables,
+        /// @brief Transform の値として読み込む
+        Transform,
+    };
+
+    /// @brief Transform の列の並び（translate.xyz・rotate.xyzw・scale.xyz）
+    static constexpr std::size_t kTransformFieldCount = 10;
+
+    /// @brief ファイル内の1種別分の対応
+    struct TypeBinding {
+        DirectKind kind = DirectKind::None;
+        size_t typeID = 0;
+        std::span<const IObjectComponent::MemberVariable> members;
+        std::optional<ColumnBinding> priority;
+        std::optional<ColumnBinding> isActive;
+        std::optional<ColumnBinding> tag;
+        /// @brief メンバー変数表の順・要素順に並べた列
+        std::vector<ColumnBinding> memberColumns;
+        /// @brief Transform の translate・rotate・scale の要素の列（kTransformFieldCount 個）と parent の列
+        std::array<ColumnBinding, kTransformFieldCount> transformFields{};
+        std::optional<ColumnBinding> transformParent;
+    };
+
+    /// @brief 優先度・アクティブ状態・タグの列であれば対応付ける
+    /// @return 対応付けた場合は true。それらの列で種類が合わない場合は isCompatible を false にする
+    static bool BindBaseColumn(const SceneBinaryColumn &column, TypeBinding &binding, bool &isCompatible);
+    /// @brief 種別の列をメンバー変数へ対応付ける
+    /// @return 直接読み込めない列がある場合は false
+    static bool BindColumns(std::span<const SceneBinaryColumn> columns, TypeBinding &binding);
+    /// @brief Transform の列を対応付ける
+    /// @return 値の列が欠けている・種類が合わない場合は false
+    static bool BindTransformColumns(std::span<const SceneBinaryColumn> columns, TypeBinding &binding);
+    /// @brief 優先度・アクティブ状態・タグを書き込む
+    bool LoadBaseState(const TypeBinding &binding, const std::uint8_t *row, IObjectComponent &component) const;
+    bool LoadMemberVariables(const TypeBinding &binding, const std::uint8_t *row, IObjectComponent &component) const;
+    bool LoadTransform(const TypeBinding &binding, const std::uint8_t *row, IObjectComponent &component) const;
+
+    const SceneBinaryReader &reader_;
+    std::vector<TypeBinding> types_;
+};
+
+} // namespace KashipanEngine
@@ -0,0 +1,1176 @@
+#include "SceneBinaryFormat.h"
+#include "Utilities/FileIO/BinaryStream.h"
+#include "Utilities/FileIO/LzBlockCompression.h"
+#include "Utilities/Plugin/Plugins.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <unordered_map>
+
+namespace KashipanEngine {
+
+namespace {
+
+constexpr std::uint32_t kSceneBinaryMagic = 0x5342534B; // "KSBS"
+constexpr std::uint32_t kSceneBinaryVersion = 2;
+constexpr std::uint32_t kNoString = 0xFFFFFFFFu;
+/// @brief 圧縮ブロックの大きさ。ブロック単位で並列に展開する
+constexpr std::size_t kCompressionBlockSize = 256 * 1024;
+/// @brief 展開後の本体の上限（セクションのオフセットを32bitで持つため）
+constexpr std::uint64_t kMaxBodySize = 0xFFFFFFFFull;
+/// @brief 入れ子の深さの上限（壊れたデータで再帰が止まらないのを防ぐ）
+constexpr int kMaxValueDepth = 256;
+/// @brief 並列にデコードする際、1ジョブが受け持つオブジェクト数
+constexpr std::size_t kObjectsPerDecodeJob = 64;
+
+/// @brief 値の種別タグ。JSONの数値型（符号付き/なし整数・浮動小数）を区別して保持する
+enum class ValueTag : std::uint8_t {
+    Null = 0,
+    False,
+    True,
+    Int64,
+    UInt64,
+    Double,
+    String,
+    Array,
+    Object,
+    UInt32,
+    Int32,
+    /// @brief float に丸めても値が変わらない浮動小数
+    Float32,
+};
+
+struct BlockEntry {
+    std::uint32_t rawSize;
+    /// @brief rawSize と同じ場合は圧縮せずに格納している
+    std::uint32_t storedSize;
+};
+
+struct ObjectRecord {
+    std::uint32_t objectID;
+    /// @brief "components" を除いたオブジェクトの値
+    std::uint32_t valueOffset;
+    std::uint32_t firstComponentSlot;
+    std::uint32_t componentCount;
+    std::uint32_t flags;
+};
+constexpr std::uint32_t kObjectHasComponents = 1u << 0;
+
+struct ComponentTypeRecord {
+    std::uint32_t name;
+    std::uint32_t firstComponent;
+    std::uint32_t componentCount;
+    /// @brief この種別のコンポーネントデータが連続して並ぶ範囲（値セクション内）
+    std::uint32_t dataOffset;
+    std::uint32_t dataSize;
+    /// @brief 列形式の場合の列（列表内の範囲）と1行の大きさ
+    std::uint32_t firstColumn;
+    std::uint32_t columnCount;
+    std::uint32_t rowStride;
+    std::uint32_t flags;
+    std::uint32_t reserved;
+};
+/// @brief 種別の全コンポーネントを列形式で格納している
+constexpr std::uint32_t kTypeColumnar = 1u << 0;
+
+struct ComponentRecord {
+    std::uint32_t objectIndex;
+    std::uint32_t typeIndex;
+    std::uint32_t valueOffset;
+    std::uint32_t flags;
+};
+/// @brief コンポーネントが {type, data} だけで構成されており、値には data のみを格納している
+constexpr std::uint32_t kComponentDataOnly = 1u << 0;
+/// @brief data を列形式の行として格納している（valueOffset は行の位置）
+constexpr std::uint32_t kComponentColumnar = 1u << 1;
+
+struct ColumnRecord {
+    /// @brief 列のキーの並び（列キー表内の範囲）
+    std::uint32_t firstPathKey;
+    std::uint32_t pathKeyCount;
+    std::uint32_t rowOffset;
+    std::uint32_t kind;
+};
+
+struct ObjectIndexEntry {
+    std::uint64_t hash;
+    std::uint32_t objectIndex;
+    std::uint32_t reserved;
+};
+
+static_assert(std::is_trivially_copyable_v<SceneBinaryHeader>);
+
+/// @brief 列の値1つ分の大きさ
+std::uint32_t GetColumnValueSize(SceneBinaryColumnKind kind) {
+    switch (kind) {
+    case SceneBinaryColumnKind::Bool: return 1;
+    case SceneBinaryColumnKind::Int32:
+    case SceneBinaryColumnKind::UInt32:
+    case SceneBinaryColumnKind::Float32:
+    case SceneBinaryColumnKind::String: return 4;
+    case SceneBinaryColumnKind::Int64:
+    case SceneBinaryColumnKind::UInt64:
+    case SceneBinaryColumnKind::Double: return 8;
+    case SceneBinaryColumnKind::MixedInteger: return 9;
+    default: return 0;
+    }
+}
+
+bool IsSignedIntegerColumn(SceneBinaryColumnKind kind) {
+    return kind == SceneBinaryColumnKind::Int32 || kind == SceneBinaryColumnKind::Int64;
+}
+
+bool IsUnsignedIntegerColumn(SceneBinaryColumnKind kind) {
+    return kind == SceneBinaryColumnKind::UInt32 || kind == SceneBinaryColumnKind::UInt64;
+}
+
+/// @brief 同じ列に並ぶ2つの値の種類を、両方を失わずに格納できる種類へまとめる
+/// @return まとめられない（数値と文字列等）場合は std::nullopt
+std::optional<SceneBinaryColumnKind> MergeColumnKinds(SceneBinaryColumnKind a, SceneBinaryColumnKind b) {
+    if (a == b) return a;
+    if (IsSignedIntegerColumn(a) && IsSignedIntegerColumn(b)) return SceneBinaryColumnKind::Int64;
+    if (IsUnsignedIntegerColumn(a) && IsUnsignedIntegerColumn(b)) return SceneBinaryColumnKind::UInt64;
+    // テキストから読んだJSONでは、0以上の整数は符号なし、負の整数は符号付きになる
+    const auto isInteger = [](SceneBinaryColumnKind kind) {
+        return IsSignedIntegerColumn(kind) || IsUnsignedIntegerColumn(kind) || kind == SceneBinaryColumnKind::MixedInteger;
+    };
+    if (isInteger(a) && isInteger(b)) return SceneBinaryColumnKind::MixedInteger;
+    const auto isFloat = [](SceneBinaryColumnKind kind) {
+        return kind == SceneBinaryColumnKind::Float32 || kind == SceneBinaryColumnKind::Double;
+    };
+    if (isFloat(a) && isFloat(b)) return SceneBinaryColumnKind::Double;
+    return std::nullopt;
+}
+
+std::uint64_t HashObjectID(std::string_view objectID) {
+    return HashFnv1a(kFnv1aOffsetBasis, objectID.data(), objectID.size());
+}
+
+void AlignTo(BinaryWriter &writer, std::size_t alignment) {
+    static constexpr std::uint8_t kZero[8] = {};
+    const std::size_t padding = (alignment - writer.GetSize() % alignment) % alignment;
+    writer.Bytes(kZero, padding);
+}
+
+/// @brief シーンJSONを各セクションへ分解して書き出す
+class SceneBinaryEncoder final {
+public:
+    std::vector<std::uint8_t> Encode(const JSON &sceneJson, std::uint32_t &outFlags) {
+        outFlags = 0;
+        const JSON *sceneObjects = nullptr;
+        if (sceneJson.is_object()) {
+            auto it = sceneJson.find("sceneObjects");
+            if (it != sceneJson.end()) {
+                sceneObjects = &*it;
+                outFlags |= SceneBinaryHeader::kHasSceneObjects;
+            }
+        }
+        // sceneObjects が配列でない場合は分解せず、シーンの値としてそのまま持つ
+        if (sceneObjects && !sceneObjects->is_array()) {
+            sceneObjects = nullptr;
+            outFlags &= ~SceneBinaryHeader::kHasSceneObjects;
+        }
+
+        header_.sceneValueOffset = sceneObjects ? WriteObjectExcept(sceneJson, "sceneObjects") : WriteValue(sceneJson);
+        if (sceneObjects) EncodeObjects(*sceneObjects);
+        return BuildBody();
+    }
+
+    const SceneBinaryHeader &GetHeader() const noexcept { return header_; }
+
+private:
+    struct PendingComponent {
+        std::uint32_t objectIndex;
+        std::uint32_t slot;
+        const JSON *json;
+        bool dataOnly;
+    };
+
+    /// @brief data の中の、オブジェクトでない値（または空のオブジェクト）1つ
+    struct Leaf {
+        /// @brief キーの並び（leafKeys_ 内の範囲）
+        std::uint32_t firstPathKey;
+        std::uint32_t pathKeyCount;
+        SceneBinaryColumnKind kind;
+        const JSON *value;
+    };
+
+    std::uint32_t Intern(const std::string &text) {
+        auto [it, inserted] = stringIndices_.try_emplace(text, static_cast<std::uint32_t>(strings_.size()));
+        if (inserted) strings_.push_back(&it->first);
+        return it->second;
+    }
+
+    std::uint32_t WriteValue(const JSON &value) {
+        const auto offset = static_cast<std::uint32_t>(values_.GetSize());
+        EncodeValue(value);
+        return offset;
+    }
+
+    /// @brief オブジェクトの値を、指定したキーだけ除いて書き出す
+    std::uint32_t WriteObjectExcept(const JSON &object, const char *excludedKey) {
+        const auto offset = static_cast<std::uint32_t>(values_.GetSize());
+        const bool hasExcluded = object.contains(excludedKey);
+        values_.U8(static_cast<std::uint8_t>(ValueTag::Object));
+        values_.U32(static_cast<std::uint32_t>(object.size() - (hasExcluded ? 1 : 0)));
+        for (auto it = object.begin(); it != object.end(); ++it) {
+            if (it.key() == excludedKey) continue;
+            values_.U32(Intern(it.key()));
+            EncodeValue(it.value());
+        }
+        return offset;
+    }
+
+    void EncodeValue(const JSON &value) {
+        switch (value.type()) {
+        case JSON::value_t::boolean:
+            values_.U8(static_cast<std::uint8_t>(value.get<bool>() ? ValueTag::True : ValueTag::False));
+            return;
+        case JSON::value_t::number_unsigned: {
+            const auto number = value.get<std::uint64_t>();
+            if (number <= std::numeric_limits<std::uint32_t>::max()) {
+                values_.U8(static_cast<std::uint8_t>(ValueTag::UInt32));
+                values_.U32(static_cast<std::uint32_t>(number));
+            } else {
+                values_.U8(static_cast<std::uint8_t>(ValueTag::UInt64));
+                values_.U64(number);
+            }
+            return;
+        }
+        case JSON::value_t::number_integer: {
+            const auto number = value.get<std::int64_t>();
+            if (number >= std::numeric_limits<std::int32_t>::min() && number <= std::numeric_limits<std::int32_t>::max()) {
+                values_.U8(static_cast<std::uint8_t>(ValueTag::Int32));
+                values_.U32(static_cast<std::uint32_t>(static_cast<std::int32_t>(number)));
+            } else {
+                values_.U8(static_cast<std::uint8_t>(ValueTag::Int64));
+                values_.U64(static_cast<std::uint64_t>(number));
+            }
+            return;
+        }
+        case JSON::value_t::number_float: {
+            const double number = value.get<double>();
+            const float narrowed = static_cast<float>(number);
+            // NaN は比較が成り立たないため double のまま持つ
+            if (static_cast<double>(narrowed) == number) {
+                values_.U8(static_cast<std::uint8_t>(ValueTag::Float32));
+                values_.F32(narrowed);
+            } else {
+                values_.U8(static_cast<std::uint8_t>(ValueTag::Double));
+                values_.Bytes(&number, sizeof(number));
+            }
+            return;
+        }
+        case JSON::value_t::string:
+            values_.U8(static_cast<std::uint8_t>(ValueTag::String));
+            values_.U32(Intern(value.get_ref<const std::string &>()));
+            return;
+        case JSON::value_t::array:
+            values_.U8(static_cast<std::uint8_t>(ValueTag::Array));
+            values_.U32(static_cast<std::uint32_t>(value.size()));
+            for (const auto &element : value) EncodeValue(element);
+            return;
+        case JSON::value_t::object:
+            values_.U8(static_cast<std::uint8_t>(ValueTag::Object));
+            values_.U32(static_cast<std::uint32_t>(value.size()));
+            for (auto it = value.begin(); it != value.end(); ++it) {
+                values_.U32(Intern(it.key()));
+                EncodeValue(it.value());
+            }
+            return;
+        default:
+            // null・（テキストのシーンファイルには現れない）binary は null として持つ
+            values_.U8(static_cast<std::uint8_t>(ValueTag::Null));
+            return;
+        }
+    }
+
+    /// @brief 列に格納する値の種類（配列等、列にできない値は std::nullopt）
+    static std::optional<SceneBinaryColumnKind> GetLeafKind(const JSON &value) {
+        switch (value.type()) {
+        case JSON::value_t::null: return SceneBinaryColumnKind::Null;
+        case JSON::value_t::object: return SceneBinaryColumnKind::EmptyObject;
+        case JSON::value_t::boolean: return SceneBinaryColumnKind::Bool;
+        case JSON::value_t::number_integer: {
+            const auto number = value.get<std::int64_t>();
+            const bool fits = number >= std::numeric_limits<std::int32_t>::min() && number <= std::numeric_limits<std::int32_t>::max();
+            return fits ? SceneBinaryColumnKind::Int32 : SceneBinaryColumnKind::Int64;
+        }
+        case JSON::value_t::number_unsigned:
+            return value.get<std::uint64_t>() <= std::numeric_limits<std::uint32_t>::max() ? SceneBinaryColumnKind::UInt32 : SceneBinaryColumnKind::UInt64;
+        case JSON::value_t::number_float: {
+            const double number = value.get<double>();
+            return static_cast<double>(static_cast<float>(number)) == number ? SceneBinaryColumnKind::Float32 : SceneBinaryColumnKind::Double;
+        }
+        case JSON::value_t::string: return SceneBinaryColumnKind::String;
+        default: return std::nullopt;
+        }
+    }
+
+    /// @brief data をキー順の深さ優先で葉へ分解する（結果は leafKeys_・leaves_）
+    /// @return 列にできない値（配列等）を含む場合は false
+    bool FlattenLeaves(const JSON &object) {
+        leafKeys_.clear();
+        leaves_.clear();
+        leafPath_.clear();
+        return FlattenLeavesRecursive(object);
+    }
+
+    bool FlattenLeavesRecursive(const JSON &object) {
+        if (leafPath_.size() >= static_cast<std::size_t>(kMaxValueDepth)) return false;
+        for (auto it = object.begin(); it != object.end(); ++it) {
+            leafPath_.push_back(Intern(it.key()));
+            const JSON &value = it.value();
+            if (value.is_object() && !value.empty()) {
+                if (!FlattenLeavesRecursive(value)) return false;
+            } else {
+                const auto kind = GetLeafKind(value);
+                if (!kind) return false;
+                leaves_.push_back({ static_cast<std::uint32_t>(leafKeys_.size()), static_cast<std::uint32_t>(leafPath_.size()), *kind, &value });
+                leafKeys_.insert(leafKeys_.end(), leafPath_.begin(), leafPath_.end());
+            }
+            leafPath_.pop_back();
+        }
+        return true;
+    }
+
+    void WriteColumnValue(SceneBinaryColumnKind kind, const JSON &value) {
+        switch (kind) {
+        case SceneBinaryColumnKind::Bool: values_.U8(value.get<bool>() ? 1 : 0); return;
+        case SceneBinaryColumnKind::Int32: values_.U32(static_cast<std::uint32_t>(static_cast<std::int32_t>(value.get<std::int64_t>()))); return;
+        case SceneBinaryColumnKind::Int64: values_.U64(static_cast<std::uint64_t>(value.get<std::int64_t>())); return;
+        case SceneBinaryColumnKind::UInt32: values_.U32(static_cast<std::uint32_t>(value.get<std::uint64_t>())); return;
+        case SceneBinaryColumnKind::UInt64: values_.U64(value.get<std::uint64_t>()); return;
+        case SceneBinaryColumnKind::Float32: values_.F32(static_cast<float>(value.get<double>())); return;
+        case SceneBinaryColumnKind::Double: {
+            const double number = value.get<double>();
+            values_.Bytes(&number, sizeof(number));
+            return;
+        }
+        case SceneBinaryColumnKind::String: values_.U32(Intern(value.get_ref<const std::string &>())); return;
+        case SceneBinaryColumnKind::MixedInteger:
+            if (value.is_number_unsigned()) {
+                values_.U8(1);
+                values_.U64(value.get<std::uint64_t>());
+            } else {
+                values_.U8(0);
+                values_.U64(static_cast<std::uint64_t>(value.get<std::int64_t>()));
+            }
+            return;
+        default:
+            return;
+        }
+    }
+
+    /// @brief 種別の全コンポーネントの data が同じキー・同じ種類の値を持つ場合に、列形式で書き出す
+    /// @return 列形式にできない場合は何も書き出さずに false
+    bool TryEncodeColumnar(std::uint32_t typeIndex, ComponentTypeRecord &typeRecord) {
+        const auto &pendings = componentsByType_[typeIndex];
+        std::vector<std::uint32_t> columnKeys;
+        std::vector<Leaf> columns;
+        for (const auto &pending : pendings) {
+            if (!pending.dataOnly) return false;
+            const JSON &data = pending.json->find("data").value();
+            if (!data.is_object() || !FlattenLeaves(data)) return false;
+            if (&pending == &pendings.front()) {
+                columnKeys = leafKeys_;
+                columns = leaves_;
+                continue;
+            }
+            if (leaves_.size() != columns.size()) return false;
+            for (std::size_t i = 0; i < columns.size(); ++i) {
+                auto &column = columns[i];
+                const auto &leaf = leaves_[i];
+                // キーは文字列表の番号で比べる（同じ文字列は同じ番号になる）
+                if (leaf.pathKeyCount != column.pathKeyCount ||
+                    !std::equal(leafKeys_.begin() + leaf.firstPathKey, leafKeys_.begin() + leaf.firstPathKey + leaf.pathKeyCount,
+                        columnKeys.begin() + column.firstPathKey)) {
+                    return false;
+                }
+                const auto kind = MergeColumnKinds(column.kind, leaf.kind);
+                if (!kind) return false;
+                column.kind = *kind;
+            }
+        }
+
+        typeRecord.flags |= kTypeColumnar;
+        typeRecord.firstColumn = static_cast<std::uint32_t>(columnRecords_.size());
+        typeRecord.columnCount = static_cast<std::uint32_t>(columns.size());
+        std::uint32_t rowOffset = 0;
+        for (const auto &column : columns) {
+            columnRecords_.push_back({ static_cast<std::uint32_t>(columnPathKeys_.size()), column.pathKeyCount, rowOffset, static_cast<std::uint32_t>(column.kind) });
+            columnPathKeys_.insert(columnPathKeys_.end(), columnKeys.begin() + column.firstPathKey, columnKeys.begin() + column.firstPathKey + column.pathKeyCount);
+            rowOffset += GetColumnValueSize(column.kind);
+        }
+        typeRecord.rowStride = rowOffset;
+
+        for (const auto &pending : pendings) {
+            FlattenLeaves(pending.json->find("data").value());
+            objectComponentList_[pending.slot] = static_cast<std::uint32_t>(components_.size());
+            const auto rowOffsetInValues = static_cast<std::uint32_t>(values_.GetSize());
+            for (std::size_t i = 0; i < columns.size(); ++i) WriteColumnValue(columns[i].kind, *leaves_[i].value);
+            components_.push_back({ pending.objectIndex, typeIndex, rowOffsetInValues, kComponentDataOnly | kComponentColumnar });
+        }
+        return true;
+    }
+
+    std::uint32_t ComponentTypeIndex(const std::string &typeName) {
+        auto [it, inserted] = typeIndices_.try_emplace(typeName, static_cast<std::uint32_t>(componentsByType_.size()));
+        if (inserted) {
+            componentsByType_.emplace_back();
+            typeNames_.push_back(Intern(typeName));
+        }
+        return it->second;
+    }
+
+    void EncodeObjects(const JSON &sceneObjects) {
+        std::uint32_t slotCount = 0;
+        for (const auto &objectJson : sceneObjects) {
+            const auto objectIndex = static_cast<std::uint32_t>(objects_.size());
+            ObjectRecord record{ kNoString, 0, slotCount, 0, 0 };
+
+            const JSON *components = nullptr;
+            if (objectJson.is_object()) {
+                auto idIt = objectJson.find("objectID");
+                if (idIt != objectJson.end() && idIt->is_string()) {
+                    record.objectID = Intern(idIt->get_ref<const std::string &>());
+                }
+                auto compIt = objectJson.find("components");
+                if (compIt != objectJson.end() && compIt->is_array()) components = &*compIt;
+            }
+
+            if (components) {
+                record.valueOffset = WriteObjectExcept(objectJson, "components");
+                record.flags |= kObjectHasComponents;
+                record.componentCount = static_cast<std::uint32_t>(components->size());
+                std::uint32_t slot = 0;
+                for (const auto &compJson : *components) {
+                    std::string typeName;
+                    bool dataOnly = false;
+                    if (compJson.is_object()) {
+                        auto typeIt = compJson.find("type");
+                        if (typeIt != compJson.end() && typeIt->is_string()) {
+                            typeName = typeIt->get<std::string>();
+                            dataOnly = compJson.size() == 2 && compJson.contains("data");
+                        }
+                    }
+                    componentsByType_[ComponentTypeIndex(typeName)].push_back({ objectIndex, slotCount + slot, &compJson, dataOnly });
+                    ++slot;
+                }
+                slotCount += record.componentCount;
+            } else {
+                record.valueOffset = WriteValue(objectJson);
+            }
+            objects_.push_back(record);
+        }
+
+        // コンポーネントは種別ごとにまとめて並べ、値も種別ごとに連続させる
+        objectComponentList_.resize(slotCount);
+        for (std::uint32_t typeIndex = 0; typeIndex < componentsByType_.size(); ++typeIndex) {
+            ComponentTypeRecord typeRecord{};
+            typeRecord.name = typeNames_[typeIndex];
+            typeRecord.firstComponent = static_cast<std::uint32_t>(components_.size());
+            typeRecord.componentCount = static_cast<std::uint32_t>(componentsByType_[typeIndex].size());
+            typeRecord.dataOffset = static_cast<std::uint32_t>(values_.GetSize());
+            if (!TryEncodeColumnar(typeIndex, typeRecord)) {
+                for (const auto &pending : componentsByType_[typeIndex]) {
+                    objectComponentList_[pending.slot] = static_cast<std::uint32_t>(components_.size());
+                    const std::uint32_t valueOffset = pending.dataOnly ? WriteValue((*pending.json)["data"]) : WriteValue(*pending.json);
+                    components_.push_back({ pending.objectIndex, typeIndex, valueOffset, pending.dataOnly ? kComponentDataOnly : 0u });
+                }
+            }
+            typeRecord.dataSize = static_cast<std::uint32_t>(values_.GetSize()) - typeRecord.dataOffset;
+            componentTypes_.push_back(typeRecord);
+        }
+
+        for (std::uint32_t i = 0; i < objects_.size(); ++i) {
+            if (objects_[i].objectID == kNoString) continue;
+            objectIndex_.push_back({ HashObjectID(*strings_[objects_[i].objectID]), i, 0 });
+        }
+        std::sort(objectIndex_.begin(), objectIndex_.end(), [](const ObjectIndexEntry &a, const ObjectIndexEntry &b) {
+            return a.hash != b.hash ? a.hash < b.hash : a.objectIndex < b.objectIndex;
+        });
+    }
+
+    template <typename T>
+    std::uint32_t WriteSection(BinaryWriter &body, const std::vector<T> &records) {
+        AlignTo(body, 8);
+        const auto offset = static_cast<std::uint32_t>(body.GetSize());
+        body.Bytes(records.data(), records.size() * sizeof(T));
+        return offset;
+    }
+
+    std::vector<std::uint8_t> BuildBody() {
+        std::vector<std::uint8_t> bodyBuffer;
+        BinaryWriter body(bodyBuffer);
+
+        // 文字列表: オフセット（count + 1 個）に続けて文字列を連結したもの
+        std::vector<std::uint32_t> stringOffsets;
+        stringOffsets.reserve(strings_.size() + 1);
+        std::uint32_t position = 0;
+        for (const std::string *text : strings_) {
+            stringOffsets.push_back(position);
+            position += static_cast<std::uint32_t>(text->size());
+        }
+        stringOffsets.push_back(position);
+        header_.stringTableOffset = WriteSection(body, stringOffsets);
+        header_.stringCount = static_cast<std::uint32_t>(strings_.size());
+        for (const std::string *text : strings_) body.Bytes(text->data(), text->size());
+
+        header_.objectTableOffset = WriteSection(body, objects_);
+        header_.objectCount = static_cast<std::uint32_t>(objects_.size());
+        header_.componentTypeTableOffset = WriteSection(body, componentTypes_);
+        header_.componentTypeCount = static_cast<std::uint32_t>(componentTypes_.size());
+        header_.componentTableOffset = WriteSection(body, components_);
+        header_.componentCount = static_cast<std::uint32_t>(components_.size());
+        header_.objectComponentListOffset = WriteSection(body, objectComponentList_);
+        header_.objectIndexOffset = WriteSection(body, objectIndex_);
+        header_.objectIndexCount = static_cast<std::uint32_t>(objectIndex_.size());
+        header_.columnTableOffset = WriteSection(body, columnRecords_);
+        header_.columnCount = static_cast<std::uint32_t>(columnRecords_.size());
+        header_.columnPathKeyOffset = WriteSection(body, columnPathKeys_);
+        header_.columnPathKeyCount = static_cast<std::uint32_t>(columnPathKeys_.size());
+
+        AlignTo(body, 8);
+        header_.valuesOffset = static_cast<std::uint32_t>(body.GetSize());
+        header_.valuesSize = static_cast<std::uint32_t>(valuesBuffer_.size());
+        body.Bytes(valuesBuffer_.data(), valuesBuffer_.size());
+        return bodyBuffer;
+    }
+
+    SceneBinaryHeader header_{};
+    std::vector<std::uint8_t> valuesBuffer_;
+    BinaryWriter values_{ valuesBuffer_ };
+    std::unordered_map<std::string, std::uint32_t> stringIndices_;
+    std::vector<const std::string *> strings_;
+    std::vector<ObjectRecord> objects_;
+    std::unordered_map<std::string, std::uint32_t> typeIndices_;
+    std::vector<std::uint32_t> typeNames_;
+    std::vector<std::vector<PendingComponent>> componentsByType_;
+    std::vector<ComponentTypeRecord> componentTypes_;
+    std::vector<ComponentRecord> components_;
+    std::vector<std::uint32_t> objectComponentList_;
+    std::vector<ObjectIndexEntry> objectIndex_;
+    std::vector<ColumnRecord> columnRecords_;
+    std::vector<std::uint32_t> columnPathKeys_;
+    /// @brief FlattenLeaves の作業用
+    std::vector<std::uint32_t> leafPath_;
+    std::vector<std::uint32_t> leafKeys_;
+    std::vector<Leaf> leaves_;
+};
+
+/// @brief 値セクションを読み進めながらJSONへ戻す
+class ValueDecoder final {
+public:
+    ValueDecoder(const std::uint8_t *data, std::size_t size, const std::vector<std::string_view> &strings)
+        : data_(data), size_(size), strings_(strings) {}
+
+    bool Decode(std::size_t offset, JSON &out) {
+        position_ = offset;
+        return DecodeValue(out, 0);
+    }
+
+private:
+    template <typename T>
+    bool Read(T &value) {
+        if (size_ - position_ < sizeof(T)) return false;
+        std::memcpy(&value, data_ + position_, sizeof(T));
+        position_ += sizeof(T);
+        return true;
+    }
+
+    bool ReadString(std::string_view &text) {
+        std::uint32_t index = 0;
+        if (!Read(index) || index >= strings_.size()) return false;
+        text = strings_[index];
+        return true;
+    }
+
+    bool DecodeValue(JSON &out, int depth) {
+        if (depth > kMaxValueDepth) return false;
+        std::uint8_t tag = 0;
+        if (position_ > size_ || !Read(tag)) return false;
+
+        switch (static_cast<ValueTag>(tag)) {
+        case ValueTag::Null: out = nullptr; return true;
+        case ValueTag::False: out = false; return true;
+        case ValueTag::True: out = true; return true;
+        case ValueTag::Int64: {
+            std::int64_t number = 0;
+            if (!Read(number)) return false;
+            out = number;
+            return true;
+        }
+        case ValueTag::UInt64: {
+            std::uint64_t number = 0;
+            if (!Read(number)) return false;
+            out = number;
+            return true;
+        }
+        case ValueTag::Double: {
+            double number = 0.0;
+            if (!Read(number)) return false;
+            out = number;
+            return true;
+        }
+        case ValueTag::UInt32: {
+            std::uint32_t number = 0;
+            if (!Read(number)) return false;
+            out = static_cast<std::uint64_t>(number);
+            return true;
+        }
+        case ValueTag::Int32: {
+            std::int32_t number = 0;
+            if (!Read(number)) return false;
+            out = static_cast<std::int64_t>(number);
+            return true;
+        }
+        case ValueTag::Float32: {
+            float number = 0.0f;
+            if (!Read(number)) return false;
+            out = static_cast<double>(number);
+            return true;
+        }
+        case ValueTag::String: {
+            std::string_view text;
+            if (!ReadString(text)) return false;
+            out = std::string(text);
+            return true;
+        }
+        case ValueTag::Array: {
+            std::uint32_t count = 0;
+            // 要素は最低1バイトなので、残りより多い要素数は壊れている
+            if (!Read(count) || count > size_ - position_) return false;
+            out = JSON::array();
+            auto &array = out.get_ref<JSON::array_t &>();
+            array.resize(count);
+            for (auto &element : array) {
+                if (!DecodeValue(element, depth + 1)) return false;
+            }
+            return true;
+        }
+        case ValueTag::Object: {
+            std::uint32_t count = 0;
+            if (!Read(count) || count > size_ - position_) return false;
+            out = JSON::object();
+            auto &object = out.get_ref<JSON::object_t &>();
+            for (std::uint32_t i = 0; i < count; ++i) {
+                std::string_view key;
+                if (!ReadString(key)) return false;
+                // 保存時にキー順で書き出しているため、末尾への挿入で済む
+                auto it = object.emplace_hint(object.end(), std::string(key), nullptr);
+                if (!DecodeValue(it->second, depth + 1)) return false;
+            }
+            return true;
+        }
+        default:
+            return false;
+        }
+    }
+
+    const std::uint8_t *data_;
+    std::size_t size_;
+    const std::vector<std::string_view> &strings_;
+    std::size_t position_ = 0;
+};
+
+bool SectionFits(std::uint64_t offset, std::uint64_t count, std::uint64_t recordSize, std::uint64_t bodySize) {
+    return offset <= bodySize && count <= (bodySize - offset) / recordSize;
+}
+
+} // namespace
+
+std::vector<std::uint8_t> EncodeSceneBinary(const JSON &sceneJson, bool compress) {
+    SceneBinaryEncoder encoder;
+    std::uint32_t flags = 0;
+    const std::vector<std::uint8_t> body = encoder.Encode(sceneJson, flags);
+
+    SceneBinaryHeader header = encoder.GetHeader();
+    header.magic = kSceneBinaryMagic;
+    header.version = kSceneBinaryVersion;
+    header.flags = flags;
+    header.bodySize = body.size();
+
+    std::vector<std::uint8_t> payloadBytes;
+    BinaryWriter payload(payloadBytes);
+    if (compress) {
+        header.flags |= SceneBinaryHeader::kCompressed;
+        std::vector<BlockEntry> blocks;
+        std::vector<std::vector<std::uint8_t>> storedBlocks;
+        for (std::size_t begin = 0; begin < body.size(); begin += kCompressionBlockSize) {
+            const std::size_t rawSize = std::min(kCompressionBlockSize, body.size() - begin);
+            std::vector<std::uint8_t> compressed = CompressLzBlock(body.data() + begin, rawSize);
+            // 縮まないブロックはそのまま格納する
+            if (compressed.size() >= rawSize) compressed.assign(body.begin() + begin, body.begin() + begin + rawSize);
+            blocks.push_back({ static_cast<std::uint32_t>(rawSize), static_cast<std::uint32_t>(compressed.size()) });
+            storedBlocks.push_back(std::move(compressed));
+        }
+        header.blockCount = static_cast<std::uint32_t>(blocks.size());
+        payload.Bytes(blocks.data(), blocks.size() * sizeof(BlockEntry));
+        for (const auto &stored : storedBlocks) payload.Bytes(stored.data(), stored.size());
+    } else {
+        payload.Bytes(body.data(), body.size());
+    }
+
+    header.checksum = HashFnv1a(kFnv1aOffsetBasis, payloadBytes.data(), payloadBytes.size());
+
+    std::vector<std::uint8_t> file(sizeof(SceneBinaryHeader) + payloadBytes.size());
+    std::memcpy(file.data(), &header, sizeof(header));
+    if (!payloadBytes.empty()) std::memcpy(file.data() + sizeof(header), payloadBytes.data(), payloadBytes.size());
+    return file;
+}
+
+bool SceneBinaryReader::OpenFile(const std::string &filePath) {
+    body_ = nullptr;
+    if (!file_.Open(filePath)) return false;
+    if (Open(file_.GetData(), file_.GetSize())) {
+        // 展開した場合はマップを保持し続ける必要がない
+        if (!decompressedBody_.empty()) file_.Close();
+        return true;
+    }
+    file_.Close();
+    return false;
+}
+
+bool SceneBinaryReader::Open(const std::uint8_t *data, std::size_t size) {
+    body_ = nullptr;
+    bodySize_ = 0;
+    strings_.clear();
+    typeLayouts_.clear();
+    columns_.clear();
+    decompressedBody_.clear();
+
+    if (!data || size < sizeof(SceneBinaryHeader)) return false;
+    std::memcpy(&header_, data, sizeof(header_));
+    if (header_.magic != kSceneBinaryMagic || header_.version != kSceneBinaryVersion) return false;
+    if (header_.bodySize > kMaxBodySize) return false;
+
+    const std::uint8_t *payload = data + sizeof(SceneBinaryHeader);
+    const std::size_t payloadSize = size - sizeof(SceneBinaryHeader);
+    if (HashFnv1a(kFnv1aOffsetBasis, payload, payloadSize) != header_.checksum) return false;
+
+    if ((header_.flags & SceneBinaryHeader::kCompressed) == 0) {
+        if (payloadSize != header_.bodySize) return false;
+        body_ = payload;
+        bodySize_ = payloadSize;
+        if (!ValidateBody()) {
+            body_ = nullptr;
+            return false;
+        }
+        return true;
+    }
+
+    if (!SectionFits(0, header_.blockCount, sizeof(BlockEntry), payloadSize)) return false;
+    std::vector<BlockEntry> blocks(header_.blockCount);
+    if (!blocks.empty()) std::memcpy(blocks.data(), payload, blocks.size() * sizeof(BlockEntry));
+
+    // 各ブロックの格納位置と展開先を先に求めておき、ブロックごとに並列に展開する
+    std::vector<std::size_t> storedOffsets(blocks.size());
+    std::vector<std::size_t> rawOffsets(blocks.size());
+    std::uint64_t storedOffset = blocks.size() * sizeof(BlockEntry);
+    std::uint64_t rawOffset = 0;
+    for (std::size_t i = 0; i < blocks.size(); ++i) {
+        if (blocks[i].storedSize > blocks[i].rawSize) return false;
+        storedOffsets[i] = static_cast<std::size_t>(storedOffset);
+        rawOffsets[i] = static_cast<std::size_t>(rawOffset);
+        storedOffset += blocks[i].storedSize;
+        rawOffset += blocks[i].rawSize;
+    }
+    if (storedOffset != payloadSize || rawOffset != header_.bodySize) return false;
+
+    decompressedBody_.resize(static_cast<std::size_t>(header_.bodySize));
+    std::atomic<bool> failed{ false };
+    Plugin::ParallelFor(blocks.size(), 1, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            const std::uint8_t *stored = payload + storedOffsets[i];
+            std::uint8_t *raw = decompressedBody_.data() + rawOffsets[i];
+            if (blocks[i].storedSize == blocks[i].rawSize) {
+                std::memcpy(raw, stored, blocks[i].rawSize);
+            } else if (!DecompressLzBlock(stored, blocks[i].storedSize, raw, blocks[i].rawSize)) {
+                failed.store(true, std::memory_order_relaxed);
+            }
+        }
+    });
+    if (failed.load()) {
+        decompressedBody_.clear();
+        return false;
+    }
+
+    body_ = decompressedBody_.data();
+    bodySize_ = decompressedBody_.size();
+    if (!ValidateBody()) {
+        body_ = nullptr;
+        decompressedBody_.clear();
+        return false;
+    }
+    return true;
+}
+
+bool SceneBinaryReader::ValidateBody() {
+    const std::uint64_t bodySize = bodySize_;
+    const SceneBinaryHeader &h = header_;
+    if (!SectionFits(h.stringTableOffset, std::uint64_t{ h.stringCount } + 1, sizeof(std::uint32_t), bodySize)) return false;
+    if (!SectionFits(h.objectTableOffset, h.objectCount, sizeof(ObjectRecord), bodySize)) return false;
+    if (!SectionFits(h.componentTypeTableOffset, h.componentTypeCount, sizeof(ComponentTypeRecord), bodySize)) return false;
+    if (!SectionFits(h.componentTableOffset, h.componentCount, sizeof(ComponentRecord), bodySize)) return false;
+    if (!SectionFits(h.objectComponentListOffset, h.componentCount, sizeof(std::uint32_t), bodySize)) return false;
+    if (!SectionFits(h.objectIndexOffset, h.objectIndexCount, sizeof(ObjectIndexEntry), bodySize)) return false;
+    if (!SectionFits(h.valuesOffset, h.valuesSize, 1, bodySize)) return false;
+
+    // 文字列の参照を作る（文字列自体は本体を直接参照する）
+    const std::size_t charactersOffset = h.stringTableOffset + (std::size_t{ h.stringCount } + 1) * sizeof(std::uint32_t);
+    const char *characters = reinterpret_cast<const char *>(body_ + charactersOffset);
+    const std::size_t charactersCapacity = bodySize_ - charactersOffset;
+    strings_.resize(h.stringCount);
+    std::uint32_t begin = ReadRecord<std::uint32_t>(h.stringTableOffset, 0);
+    for (std::uint32_t i = 0; i < h.stringCount; ++i) {
+        const std::uint32_t end = ReadRecord<std::uint32_t>(h.stringTableOffset, i + 1);
+        if (end < begin || end > charactersCapacity) {
+            strings_.clear();
+            return false;
+        }
+        strings_[i] = std::string_view(characters + begin, end - begin);
+        begin = end;
+    }
+    if (!ValidateColumns()) {
+        strings_.clear();
+        typeLayouts_.clear();
+        columns_.clear();
+        return false;
+    }
+    return true;
+}
+
+bool SceneBinaryReader::ValidateColumns() {
+    const std::uint64_t bodySize = bodySize_;
+    const SceneBinaryHeader &h = header_;
+    if (!SectionFits(h.columnTableOffset, h.columnCount, sizeof(ColumnRecord), bodySize)) return false;
+    if (!SectionFits(h.columnPathKeyOffset, h.columnPathKeyCount, sizeof(std::uint32_t), bodySize)) return false;
+
+    columns_.resize(h.columnCount);
+    for (std::uint32_t i = 0; i < h.columnCount; ++i) {
+        const auto record = ReadRecord<ColumnRecord>(h.columnTableOffset, i);
+        if (record.pathKeyCount == 0 || record.pathKeyCount > static_cast<std::uint32_t>(kMaxValueDepth) ||
+            record.firstPathKey > h.columnPathKeyCount || record.pathKeyCount > h.columnPathKeyCount - record.firstPathKey) {
+            return false;
+        }
+        if (record.kind > static_cast<std::uint32_t>(SceneBinaryColumnKind::MixedInteger)) return false;
+        auto &column = columns_[i];
+        column.kind = static_cast<SceneBinaryColumnKind>(record.kind);
+        column.rowOffset = record.rowOffset;
+        column.path.resize(record.pathKeyCount);
+        for (std::uint32_t k = 0; k < record.pathKeyCount; ++k) {
+            const auto key = ReadRecord<std::uint32_t>(h.columnPathKeyOffset, record.firstPathKey + k);
+            if (key >= strings_.size()) return false;
+            column.path[k] = strings_[key];
+        }
+    }
+
+    typeLayouts_.resize(h.componentTypeCount);
+    for (std::uint32_t typeIndex = 0; typeIndex < h.componentTypeCount; ++typeIndex) {
+        const auto record = ReadRecord<ComponentTypeRecord>(h.componentTypeTableOffset, typeIndex);
+        if ((record.flags & kTypeColumnar) == 0) continue;
+        if (record.firstColumn > h.columnCount || record.columnCount > h.columnCount - record.firstColumn) return false;
+        for (std::uint32_t i = record.firstColumn; i < record.firstColumn + record.columnCount; ++i) {
+            const auto &column = columns_[i];
+            if (column.rowOffset > record.rowStride || GetColumnValueSize(column.kind) > record.rowStride - column.rowOffset) return false;
+        }
+        typeLayouts_[typeIndex] = { record.firstColumn, record.columnCount, record.rowStride, true };
+    }
+    return true;
+}
+
+template <typename T>
+T SceneBinaryReader::ReadRecord(std::uint32_t sectionOffset, std::uint32_t index) const {
+    T record;
+    std::memcpy(&record, body_ + sectionOffset + static_cast<std::size_t>(index) * sizeof(T), sizeof(T));
+    return record;
+}
+
+bool SceneBinaryReader::DecodeValue(std::uint32_t valueOffset, JSON &out) const {
+    if (valueOffset >= header_.valuesSize) return false;
+    ValueDecoder decoder(body_ + header_.valuesOffset, header_.valuesSize, strings_);
+    return decoder.Decode(valueOffset, out);
+}
+
+bool SceneBinaryReader::DecodeRow(const TypeLayout &layout, const std::uint8_t *row, JSON &out) const {
+    out = JSON::object();
+    for (std::uint32_t i = layout.firstColumn; i < layout.firstColumn + layout.columnCount; ++i) {
+        const auto &column = columns_[i];
+        // 列はキー順の深さ優先で並んでいるため、途中のオブジェクトは直前に作ったもの（末尾の要素）を使い回せる
+        auto *object = &out.get_ref<JSON::object_t &>();
+        for (std::size_t k = 0; k + 1 < column.path.size(); ++k) {
+            const std::string_view key = column.path[k];
+            if (object->empty() || std::prev(object->end())->first != key) {
+                object->emplace_hint(object->end(), std::string(key), JSON::object());
+            }
+            auto &child = std::prev(object->end())->second;
+            if (!child.is_object()) return false;
+            object = &child.get_ref<JSON::object_t &>();
+        }
+        auto &value = object->emplace_hint(object->end(), std::string(column.path.back()), nullptr)->second;
+
+        const std::uint8_t *field = row + column.rowOffset;
+        switch (column.kind) {
+        case SceneBinaryColumnKind::Null: break;
+        case SceneBinaryColumnKind::EmptyObject: value = JSON::object(); break;
+        case SceneBinaryColumnKind::Bool: value = *field != 0; break;
+        case SceneBinaryColumnKind::Int32: {
+            std::int32_t number = 0;
+            std::memcpy(&number, field, sizeof(number));
+            value = static_cast<std::int64_t>(number);
+            break;
+        }
+        case SceneBinaryColumnKind::Int64: {
+            std::int64_t number = 0;
+            std::memcpy(&number, field, sizeof(number));
+            value = number;
+            break;
+        }
+        case SceneBinaryColumnKind::UInt32: {
+            std::uint32_t number = 0;
+            std::memcpy(&number, field, sizeof(number));
+            value = static_cast<std::uint64_t>(number);
+            break;
+        }
+        case SceneBinaryColumnKind::UInt64: {
+            std::uint64_t number = 0;
+            std::memcpy(&number, field, sizeof(number));
+            value = number;
+            break;
+        }
+        case SceneBinaryColumnKind::Float32: {
+            float number = 0.0f;
+            std::memcpy(&number, field, sizeof(number));
+            value = static_cast<double>(number);
+            break;
+        }
+        case SceneBinaryColumnKind::Double: {
+            double number = 0.0;
+            std::memcpy(&number, field, sizeof(number));
+            value = number;
+            break;
+        }
+        case SceneBinaryColumnKind::String: {
+            std::uint32_t index = 0;
+            std::memcpy(&index, field, sizeof(index));
+            if (index >= strings_.size()) return false;
+            value = std::string(strings_[index]);
+            break;
+        }
+        case SceneBinaryColumnKind::MixedInteger: {
+            std::uint64_t number = 0;
+            std::memcpy(&number, field + 1, sizeof(number));
+            if (*field != 0) {
+                value = number;
+            } else {
+                value = static_cast<std::int64_t>(number);
+            }
+            break;
+        }
+        }
+    }
+    return true;
+}
+
+bool SceneBinaryReader::DecodeComponentTo(std::uint32_t componentIndex, JSON &out) const {
+    if (componentIndex >= header_.componentCount) return false;
+    const auto record = ReadRecord<ComponentRecord>(header_.componentTableOffset, componentIndex);
+    if ((record.flags & kComponentDataOnly) == 0) return DecodeValue(record.valueOffset, out);
+
+    if (record.typeIndex >= header_.componentTypeCount) return false;
+    const auto typeRecord = ReadRecord<ComponentTypeRecord>(header_.componentTypeTableOffset, record.typeIndex);
+    if (typeRecord.name >= strings_.size()) return false;
+    out = JSON::object();
+    auto &object = out.get_ref<JSON::object_t &>();
+    auto dataIt = object.emplace_hint(object.end(), "data", nullptr);
+    if ((record.flags & kComponentColumnar) != 0) {
+        const std::uint8_t *row = GetComponentRow(componentIndex);
+        if (!row || !DecodeRow(typeLayouts_[record.typeIndex], row, dataIt->second)) return false;
+    } else if (!DecodeValue(record.valueOffset, dataIt->second)) {
+        return false;
+    }
+    object.emplace_hint(object.end(), "type", std::string(strings_[typeRecord.name]));
+    return true;
+}
+
+bool SceneBinaryReader::DecodeObjectValuesTo(std::uint32_t objectIndex, JSON &out) const {
+    if (objectIndex >= header_.objectCount) return false;
+    return DecodeValue(ReadRecord<ObjectRecord>(header_.objectTableOffset, objectIndex).valueOffset, out);
+}
+
+bool SceneBinaryReader::DecodeObjectTo(std::uint32_t objectIndex, JSON &out) const {
+    if (objectIndex >= header_.objectCount) return false;
+    const auto record = ReadRecord<ObjectRecord>(header_.objectTableOffset, objectIndex);
+    if (!DecodeValue(record.valueOffset, out)) return false;
+    if ((record.flags & kObjectHasComponents) == 0) return true;
+    if (!out.is_object()) return false;
+    if (record.firstComponentSlot > header_.componentCount || record.componentCount > header_.componentCount - record.firstComponentSlot) return false;
+
+    JSON components = JSON::array();
+    auto &array = components.get_ref<JSON::array_t &>();
+    array.resize(record.componentCount);
+    for (std::uint32_t slot = 0; slot < record.componentCount; ++slot) {
+        const auto componentIndex = ReadRecord<std::uint32_t>(header_.objectComponentListOffset, record.firstComponentSlot + slot);
+        if (!DecodeComponentTo(componentIndex, array[slot])) return false;
+    }
+    out["components"] = std::move(components);
+    return true;
+}
+
+JSON SceneBinaryReader::DecodeScene() const {
+    if (!IsOpen()) return JSON();
+
+    JSON scene;
+    if (!DecodeValue(header_.sceneValueOffset, scene)) return JSON();
+    if ((header_.flags & SceneBinaryHeader::kHasSceneObjects) == 0) return scene;
+    if (!scene.is_object()) return JSON();
+
+    // オブジェクト同士は独立しているため並列にデコードする
+    JSON sceneObjects = JSON::array();
+    auto &objects = sceneObjects.get_ref<JSON::array_t &>();
+    objects.resize(header_.objectCount);
+    std::atomic<bool> failed{ false };
+    Plugin::ParallelFor(objects.size(), kObjectsPerDecodeJob, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            if (!DecodeObjectTo(static_cast<std::uint32_t>(i), objects[i])) {
+                failed.store(true, std::memory_order_relaxed);
+                return;
+            }
+        }
+    });
+    if (failed.load()) return JSON();
+
+    scene["sceneObjects"] = std::move(sceneObjects);
+    return scene;
+}
+
+std::uint32_t SceneBinaryReader::GetObjectCount() const noexcept {
+    return IsOpen() ? header_.objectCount : 0;
+}
+
+std::optional<std::uint32_t> SceneBinaryReader::FindObjectIndex(std::string_view objectID) const {
+    if (!IsOpen()) return std::nullopt;
+    const std::uint64_t hash = HashObjectID(objectID);
+
+    // ハッシュ順に並んだ索引を二分探索し、衝突した場合は文字列も比較する
+    std::uint32_t low = 0;
+    std::uint32_t high = header_.objectIndexCount;
+    while (low < high) {
+        const std::uint32_t mid = low + (high - low) / 2;
+        if (ReadRecord<ObjectIndexEntry>(header_.objectIndexOffset, mid).hash < hash) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    for (std::uint32_t i = low; i < header_.objectIndexCount; ++i) {
+        const auto entry = ReadRecord<ObjectIndexEntry>(header_.objectIndexOffset, i);
+        if (entry.hash != hash) break;
+        if (entry.objectIndex >= header_.objectCount) continue;
+        const auto record = ReadRecord<ObjectRecord>(header_.objectTableOffset, entry.objectIndex);
+        if (record.objectID < strings_.size() && strings_[record.objectID] == objectID) return entry.objectIndex;
+    }
+    return std::nullopt;
+}
+
+JSON SceneBinaryReader::DecodeObject(std::uint32_t objectIndex) const {
+    if (!IsOpen()) return JSON();
+    JSON object;
+    if (!DecodeObjectTo(objectIndex, object)) return JSON();
+    return object;
+}
+
+std::uint32_t SceneBinaryReader::GetComponentTypeCount() const noexcept {
+    return IsOpen() ? header_.componentTypeCount : 0;
+}
+
+std::string_view SceneBinaryReader::GetComponentTypeName(std::uint32_t typeIndex) const {
+    if (!IsOpen() || typeIndex >= header_.componentTypeCount) return std::string_view();
+    const auto record = ReadRecord<ComponentTypeRecord>(header_.componentTypeTableOffset, typeIndex);
+    return record.name < strings_.size() ? strings_[record.name] : std::string_view();
+}
+
+std::uint32_t SceneBinaryReader::GetComponentCountOfType(std::uint32_t typeIndex) const {
+    if (!IsOpen() || typeIndex >= header_.componentTypeCount) return 0;
+    return ReadRecord<ComponentTypeRecord>(header_.componentTypeTableOffset, typeIndex).componentCount;
+}
+
+bool SceneBinaryReader::IsColumnarType(std::uint32_t typeIndex) const {
+    return IsOpen() && typeIndex < typeLayouts_.size() && typeLayouts_[typeIndex].isColumnar;
+}
+
+std::span<const SceneBinaryColumn> SceneBinaryReader::GetColumns(std::uint32_t typeIndex) const {
+    if (!IsColumnarType(typeIndex)) return {};
+    const auto &layout = typeLayouts_[typeIndex];
+    return std::span<const SceneBinaryColumn>(columns_).subspan(layout.firstColumn, layout.columnCount);
+}
+
+JSON SceneBinaryReader::DecodeSceneValues() const {
+    if (!IsOpen()) return JSON();
+    JSON scene;
+    if (!DecodeValue(header_.sceneValueOffset, scene)) return JSON();
+    return scene;
+}
+
+JSON SceneBinaryReader::DecodeObjectValues(std::uint32_t objectIndex) const {
+    if (!IsOpen()) return JSON();
+    JSON object;
+    if (!DecodeObjectValuesTo(objectIndex, object)) return JSON();
+    return object;
+}
+
+std::uint32_t SceneBinaryReader::GetObjectComponentCount(std::uint32_t objectIndex) const {
+    if (!IsOpen() || objectIndex >= header_.objectCount) return 0;
+    const auto record = ReadRecord<ObjectRecord>(header_.objectTableOffset, objectIndex);
+    if ((record.flags & kObjectHasComponents) == 0) return 0;
+    if (record.firstComponentSlot > header_.componentCount || record.componentCount > header_.componentCount - record.firstComponentSlot) return 0;
+    return record.componentCount;
+}
+
+std::optional<std::uint32_t> SceneBinaryReader::GetObjectComponentIndex(std::uint32_t objectIndex, std::uint32_t slot) const {
+    if (slot >= GetObjectComponentCount(objectIndex)) return std::nullopt;
+    const auto record = ReadRecord<ObjectRecord>(header_.objectTableOffset, objectIndex);
+    const auto componentIndex = ReadRecord<std::uint32_t>(header_.objectComponentListOffset, record.firstComponentSlot + slot);
+    if (componentIndex >= header_.componentCount) return std::nullopt;
+    return componentIndex;
+}
+
+std::uint32_t SceneBinaryReader::GetComponentCount() const noexcept {
+    return IsOpen() ? header_.componentCount : 0;
+}
+
+std::optional<std::uint32_t> SceneBinaryReader::GetComponentTypeIndex(std::uint32_t componentIndex) const {
+    if (!IsOpen() || componentIndex >= header_.componentCount) return std::nullopt;
+    const auto typeIndex = ReadRecord<ComponentRecord>(header_.componentTableOffset, componentIndex).typeIndex;
+    if (typeIndex >= header_.componentTypeCount) return std::nullopt;
+    return typeIndex;
+}
+
+JSON SceneBinaryReader::DecodeComponent(std::uint32_t componentIndex) const {
+    if (!IsOpen()) return JSON();
+    JSON component;
+    if (!DecodeComponentTo(componentIndex, component)) return JSON();
+    return component;
+}
+
+const std::uint8_t *SceneBinaryReader::GetComponentRow(std::uint32_t componentIndex) const {
+    if (!IsOpen() || componentIndex >= header_.componentCount) return nullptr;
+    const auto record = ReadRecord<ComponentRecord>(header_.componentTableOffset, componentIndex);
+    if ((record.flags & kComponentColumnar) == 0 || !IsColumnarType(record.typeIndex)) return nullptr;
+    const std::uint32_t rowStride = typeLayouts_[record.typeIndex].rowStride;
+    if (record.valueOffset > header_.valuesSize || rowStride > header_.valuesSize - record.valueOffset) return nullptr;
+    return body_ + header_.valuesOffset + record.valueOffset;
+}
+
+std::optional<std::string_view> SceneBinaryReader::GetString(std::uint32_t stringIndex) const {
+    if (!IsOpen() || stringIndex >= strings_.size()) return std::nullopt;
+    return strings_[stringIndex];
+}
+
+} // namespace KashipanEngine
@@ -0,0 +1,191 @@
+#pragma once
+#include "Utilities/FileIO/JSON.h"
+#include "Utilities/FileIO/MappedFile.h"
+
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace KashipanEngine {
+
+/// @brief バイナリシーン（.kscene）の拡張子
+inline constexpr const char *kSceneBinaryExtension = ".kscene";
+
+/// @brief バイナリシーンのファイル先頭に置くヘッダー
+/// @details ヘッダーの後ろに本体（圧縮時はブロック表と圧縮ブロック）が続く。
+///          各セクションの位置は（展開後の）本体の先頭からのオフセット
+struct SceneBinaryHeader {
+    std::uint32_t magic = 0;
+    std::uint32_t version = 0;
+    /// @brief kCompressed: 本体がブロック圧縮されている / kHasSceneObjects: 元のJSONに sceneObjects があった
+    std::uint32_t flags = 0;
+    /// @brief 圧縮ブロックの数（非圧縮の場合は0）
+    std::uint32_t blockCount = 0;
+    std::uint64_t bodySize = 0;
+    /// @brief ヘッダーより後ろ（ブロック表・圧縮ブロックを含む）のFNV-1a
+    std::uint64_t checksum = 0;
+
+    std::uint32_t stringTableOffset = 0;
+    std::uint32_t stringCount = 0;
+    /// @brief sceneObjects 以外のシーンレベルの値（sceneName・sceneComponents 等）
+    std::uint32_t sceneValueOffset = 0;
+    std::uint32_t objectTableOffset = 0;
+    std::uint32_t objectCount = 0;
+    std::uint32_t componentTypeTableOffset = 0;
+    std::uint32_t componentTypeCount = 0;
+    std::uint32_t componentTableOffset = 0;
+    std::uint32_t componentCount = 0;
+    /// @brief オブジェクトごとのコンポーネント番号の並び（保存時のコンポーネント順）
+    std::uint32_t objectComponentListOffset = 0;
+    /// @brief オブジェクトIDのハッシュ順に並べた索引
+    std::uint32_t objectIndexOffset = 0;
+    std::uint32_t objectIndexCount = 0;
+    /// @brief 列形式のコンポーネント種別の列と、列のキーの並び（文字列番号）
+    std::uint32_t columnTableOffset = 0;
+    std::uint32_t columnCount = 0;
+    std::uint32_t columnPathKeyOffset = 0;
+    std::uint32_t columnPathKeyCount = 0;
+    std::uint32_t valuesOffset = 0;
+    std::uint32_t valuesSize = 0;
+
+    static constexpr std::uint32_t kCompressed = 1u << 0;
+    static constexpr std::uint32_t kHasSceneObjects = 1u << 1;
+};
+
+/// @brief 列形式のコンポーネント種別の、1列分の値の種類
+enum class SceneBinaryColumnKind : std::uint8_t {
+    /// @brief 値を持たない（null・空のオブジェクト）
+    Null,
+    EmptyObject,
+    /// @brief 1バイト
+    Bool,
+    Int32,
+    Int64,
+    UInt32,
+    UInt64,
+    Float32,
+    Double,
+    /// @brief 文字列表の番号（4バイト）
+    String,
+    /// @brief 符号付き/なし整数が混在する列（符号なしなら1の1バイトと、8バイトの値）
+    MixedInteger,
+};
+
+/// @brief 列形式のコンポーネント種別の1列（コンポーネントの data の中の1つの値）
+struct SceneBinaryColumn {
+    /// @brief data からのキーの並び（例: {"customData", "velocity", "x"}）
+    std::vector<std::string_view> path;
+    SceneBinaryColumnKind kind = SceneBinaryColumnKind::Null;
+    /// @brief 行（GetComponentRow）の先頭からの位置
+    std::uint32_t rowOffset = 0;
+};
+
+/// @brief シーンJSON（Scene::SaveToJSON の出力）をバイナリシーン形式へ変換する
+/// @details 形式はヘッダー・文字列表（キー・文字列値を重複なく1回だけ持つ）・オブジェクト表・
+///          コンポーネント種別ごとに連続したコンポーネントデータ・オブジェクトIDの索引からなる。
+///          種別の全コンポーネントの data が同じキーと同じ種類の値を持つ場合は、その種別を列形式
+///          （値を固定の位置に並べた行をコンポーネントの数だけ並べたもの）で格納し、
+///          それ以外の種別はコンポーネントごとに値を格納する。
+///          値はJSONの型（符号付き/なし整数・浮動小数・文字列等）を保ったまま格納するため、
+///          DecodeScene で元と同じJSONに戻る
+/// @param compress true の場合は本体を LZ ブロック圧縮する（ブロックごとに展開できる）。
+///                 false（既定）の場合は本体をそのまま格納し、読み込み時はメモリマップした内容を直接参照する。
+///                 圧縮するとファイルは小さくなるが、読み込み時に展開先の確保とコピーが増える
+std::vector<std::uint8_t> EncodeSceneBinary(const JSON &sceneJson, bool compress = false);
+
+/// @brief バイナリシーンの読み込み
+/// @details 非圧縮のファイルはメモリマップした内容をそのまま参照し、圧縮されたファイルは
+///          ブロックを並列に展開してから参照する。シーン全体をJSONへ戻すほか、オブジェクトIDの
+///          索引から1オブジェクトだけを取り出すこともできる。
+///          Scene::LoadFromSceneBinary はシーン全体をJSONへ戻さず、列形式の種別の行を
+///          SceneBinaryComponentLoader でコンポーネントのメンバー変数へ直接書き込む
+class SceneBinaryReader final {
+public:
+    SceneBinaryReader() = default;
+    SceneBinaryReader(const SceneBinaryReader &) = delete;
+    SceneBinaryReader &operator=(const SceneBinaryReader &) = delete;
+
+    /// @brief ファイルをメモリマップして開く
+    /// @return 形式・バージョン・チェックサムが一致しない場合は false
+    bool OpenFile(const std::string &filePath);
+    /// @brief メモリ上のバイト列を開く（非圧縮の場合は data を参照し続けるため、本クラスより長く生存させること）
+    bool Open(const std::uint8_t *data, std::size_t size);
+
+    bool IsOpen() const noexcept { return body_ != nullptr; }
+    /// @brief メモリマップしたファイルを展開せずに直接参照しているか（非圧縮のファイルを OpenFile で開いた場合）
+    bool IsMapped() const noexcept { return IsOpen() && file_.IsOpen(); }
+
+    /// @brief シーン全体を Scene::LoadFromJSON に渡せるJSONへ戻す
+    JSON DecodeScene() const;
+
+    std::uint32_t GetObjectCount() const noexcept;
+    /// @brief オブジェクトIDからオブジェクトのインデックスを引く（索引の二分探索）
+    std::optional<std::uint32_t> FindObjectIndex(std::string_view objectID) const;
+    /// @brief 1オブジェクト分のJSON（EmptyObject::SaveToJson の出力と同じ形）を取り出す
+    JSON DecodeObject(std::uint32_t objectIndex) const;
+
+    /// @brief sceneObjects を除いたシーンレベルの値（sceneName・sceneComponents 等）を取り出す
+    JSON DecodeSceneValues() const;
+    /// @brief 1オブジェクト分の、components を除いた値（name・objectID 等）を取り出す
+    JSON DecodeObjectValues(std::uint32_t objectIndex) const;
+    /// @brief オブジェクトのコンポーネント数
+    std::uint32_t GetObjectComponentCount(std::uint32_t objectIndex) const;
+    /// @brief オブジェクトの slot 番目（保存時の順）のコンポーネントの番号
+    std::optional<std::uint32_t> GetObjectComponentIndex(std::uint32_t objectIndex, std::uint32_t slot) const;
+
+    /// @brief コンポーネント種別の数・種別名・その種別のコンポーネント数
+    std::uint32_t GetComponentTypeCount() const noexcept;
+    std::string_view GetComponentTypeName(std::uint32_t typeIndex) const;
+    std::uint32_t GetComponentCountOfType(std::uint32_t typeIndex) const;
+    /// @brief 種別が列形式で格納されているか
+    bool IsColumnarType(std::uint32_t typeIndex) const;
+    /// @brief 列形式の種別の列（列形式でない場合は空）
+    std::span<const SceneBinaryColumn> GetColumns(std::uint32_t typeIndex) const;
+
+    std::uint32_t GetComponentCount() const noexcept;
+    std::optional<std::uint32_t> GetComponentTypeIndex(std::uint32_t componentIndex) const;
+    /// @brief 1コンポーネント分のJSON（{type, data}。EmptyObject::SaveToJson の components の要素と同じ形）を取り出す
+    JSON DecodeComponent(std::uint32_t componentIndex) const;
+    /// @brief 列形式の種別のコンポーネントの行（各列の値が SceneBinaryColumn::rowOffset の位置に並ぶ）
+    /// @return 列形式でない場合は nullptr
+    const std::uint8_t *GetComponentRow(std::uint32_t componentIndex) const;
+    /// @brief 文字列表の文字列（String の列の値は文字列表の番号）
+    std::optional<std::string_view> GetString(std::uint32_t stringIndex) const;
+
+private:
+    /// @brief 列形式の種別の列の範囲と1行の大きさ（ValidateBody で検証済み）
+    struct TypeLayout {
+        std::uint32_t firstColumn = 0;
+        std::uint32_t columnCount = 0;
+        std::uint32_t rowStride = 0;
+        bool isColumnar = false;
+    };
+
+    template <typename T>
+    T ReadRecord(std::uint32_t sectionOffset, std::uint32_t index) const;
+    /// @return 壊れたデータの場合は false
+    bool DecodeValue(std::uint32_t valueOffset, JSON &out) const;
+    bool DecodeObjectValuesTo(std::uint32_t objectIndex, JSON &out) const;
+    bool DecodeObjectTo(std::uint32_t objectIndex, JSON &out) const;
+    bool DecodeComponentTo(std::uint32_t componentIndex, JSON &out) const;
+    /// @brief 列形式の行から data を組み立てる
+    bool DecodeRow(const TypeLayout &layout, const std::uint8_t *row, JSON &out) const;
+    /// @brief セクションの範囲・文字列表・列を検証し、文字列と列の参照を作る
+    bool ValidateBody();
+    bool ValidateColumns();
+
+    MappedFile file_;
+    SceneBinaryHeader header_{};
+    /// @brief 圧縮されていた場合の展開先
+    std::vector<std::uint8_t> decompressedBody_;
+    const std::uint8_t *body_ = nullptr;
+    std::size_t bodySize_ = 0;
+    std::vector<std::string_view> strings_;
+    std::vector<TypeLayout> typeLayouts_;
+    std::vector<SceneBinaryColumn> columns_;
+};
+
+} // namespace KashipanEngine
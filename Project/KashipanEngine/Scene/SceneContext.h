@@ -168,6 +168,8 @@ public:
     /// @brief 型Tのオブジェクトコンポーネント用プールを取得する（未作成の場合は生成）
     template <typename T>
     ComponentPool<T> &GetOrCreateComponentPool() { return owner_->GetOrCreateComponentPool<T>(); }
+    /// @brief シーン内の全Transformの親子関係とワールド行列の表を取得する
+    TransformHierarchy &GetTransformHierarchy() { return owner_->transformHierarchy_; }
     /// @brief ComponentRef からコンポーネントの生ポインタへ解決する（使う直前に毎回呼ぶこと。結果をフレームをまたいで保持しない）
     /// @return 解決に成功した場合はコンポーネントへのポインタ、対象オブジェクト・コンポーネントが既に存在しない場合は nullptr
     IObjectComponent *ResolveComponent(const ComponentRef &ref) const {
@@ -1,9 +1,12 @@
 #include "SceneFileIO.h"
+#include "Scene/SceneBinaryFormat.h"
 #include "Core/ProjectPaths.h"
 #include "Utilities/Conversion/ConvertString.h"
+#include "Utilities/FileIO/Directory.h"
 
 #include <algorithm>
 #include <filesystem>
+#include <fstream>
 #include <functional>
 #include <optional>
 #include <unordered_map>
@@ -26,6 +29,25 @@ bool IsFolderFormatPath(const std::string &path) {
     return path.ends_with(kSceneFolderSuffix);
 }
 
+bool IsBinaryFormatPath(const std::string &path) {
+    return path.ends_with(kSceneBinaryExtension);
+}
+
+bool SaveSceneBinary(const std::string &path, const JSON &sceneJson, bool compress) {
+    const std::vector<std::uint8_t> bytes = EncodeSceneBinary(sceneJson, compress);
+    if (!EnsureParentDirectoryExists(path)) return false;
+    std::ofstream ofs(Utf8StringToPath(path), std::ios::binary | std::ios::trunc);
+    if (!ofs) return false;
+    ofs.write(reinterpret_cast<const char *>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    return static_cast<bool>(ofs);
+}
+
+JSON LoadSceneBinary(const std::string &path) {
+    SceneBinaryReader reader;
+    if (!reader.OpenFile(path)) return JSON();
+    return reader.DecodeScene();
+}
+
 /// @brief オブジェクトJSON（EmptyObject::SaveToJsonの出力）からTransformコンポーネントの
 ///        親オブジェクトのUUID文字列を取得する（見つからない場合は空文字＝ルート扱い）
 /// @details PrefabUtility.cppのEraseTransformParentと同じ探索経路（components→Transform→
@@ -288,18 +310,31 @@ JSON LoadSceneFolder(const std::string &path) {
 
 } // namespace
 
-bool SaveSceneToPath(const JSON &sceneJson, const std::string &path) {
+bool SaveSceneToPath(const JSON &sceneJson, const std::string &path, bool compressBinary) {
     // 呼び出し元は "Assets/Scenes/..." や "SceneBackups/..." といった論理パスを渡してくるため、
     // ここで開いているプロジェクト基準の物理パスへ変換する
     const std::string resolvedPath = ProjectPaths::ToPhysical(path);
     if (IsFolderFormatPath(resolvedPath)) return SaveSceneFolder(resolvedPath, sceneJson);
+    if (IsBinaryFormatPath(resolvedPath)) return SaveSceneBinary(resolvedPath, sceneJson, compressBinary);
     return SaveJSON(sceneJson, resolvedPath);
 }
 
 JSON LoadSceneFromPath(const std::string &path) {
     const std::string resolvedPath = ProjectPaths::ToPhysical(path);
     if (IsFolderFormatPath(resolvedPath)) return LoadSceneFolder(resolvedPath);
+    if (IsBinaryFormatPath(resolvedPath)) return LoadSceneBinary(resolvedPath);
     return LoadJSON(resolvedPath);
 }
 
+bool OpenSceneBinaryFromPath(const std::string &path, SceneBinaryReader &reader) {
+    const std::string resolvedPath = ProjectPaths::ToPhysical(path);
+    return IsBinaryFormatPath(resolvedPath) && reader.OpenFile(resolvedPath);
+}
+
+bool ConvertSceneFile(const std::string &sourcePath, const std::string &destinationPath, bool compressBinary) {
+    const JSON sceneJson = LoadSceneFromPath(sourcePath);
+    if (!sceneJson.is_object()) return false;
+    return SaveSceneToPath(sceneJson, destinationPath, compressBinary);
+}
+
 } // namespace KashipanEngine
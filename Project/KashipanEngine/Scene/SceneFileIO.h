@@ -5,15 +5,30 @@
 
 namespace KashipanEngine {
 
+class SceneBinaryReader;
+
 /// @brief シーンJSONをパスへ保存する
 /// @details パスが ".json" で終わる場合は単一ファイル形式（既存互換）、
-///          ".scene" で終わる場合はフォルダ形式（1オブジェクト1フォルダ）で保存する。
+///          ".scene" で終わる場合はフォルダ形式（1オブジェクト1フォルダ）、
+///          ".kscene" で終わる場合はバイナリ形式（SceneBinaryFormat.h）で保存する。
 ///          どちらの形式でも `Scene::SaveToJSON()` の出力をそのまま渡せる。
-bool SaveSceneToPath(const JSON &sceneJson, const std::string &path);
+/// @param compressBinary バイナリ形式の場合に本体を圧縮するか（既定は非圧縮。読み込み時にメモリマップを直接参照できる）
+bool SaveSceneToPath(const JSON &sceneJson, const std::string &path, bool compressBinary = false);
 
 /// @brief パスからシーンJSONを読み込む
-/// @details パスの末尾（".json"/".scene"）で形式を自動判別する。
+/// @details パスの末尾（".json"/".scene"/".kscene"）で形式を自動判別する。
 ///          戻り値は `Scene::LoadFromJSON()` にそのまま渡せる形状。読み込みに失敗した場合は空のJSONを返す
 JSON LoadSceneFromPath(const std::string &path);
 
+/// @brief パスがバイナリ形式（".kscene"）であれば開く
+/// @details 開いた reader を `Scene(const SceneBinaryReader &)` に渡すと、シーン全体をJSONへ戻さずに読み込める
+/// @return バイナリ形式のパスでない場合・開けなかった場合は false（LoadSceneFromPath で読み込むこと）
+bool OpenSceneBinaryFromPath(const std::string &path, SceneBinaryReader &reader);
+
+/// @brief シーンファイルを別の形式へ変換する（例: "Stage.json" → "Stage.kscene"）
+/// @details 形式はそれぞれのパスの末尾で判別する。どの形式の組み合わせでもJSONの内容は失われない
+/// @param compressBinary 変換先がバイナリ形式の場合に本体を圧縮するか（SaveSceneToPath と同じ）
+/// @return 読み込み・保存のどちらかに失敗した場合は false
+bool ConvertSceneFile(const std::string &sourcePath, const std::string &destinationPath, bool compressBinary = false);
+
 } // namespace KashipanEngine
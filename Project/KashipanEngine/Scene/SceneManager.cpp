@@ -2,6 +2,7 @@
 #include "Core/ProjectPaths.h"
 #include "Debug/Logger.h"
 #include "Scene/RenderTargetCarryOverRegistry.h"
+#include "Scene/SceneBinaryFormat.h"
 #include "Scene/SceneFileIO.h"
 #include "Utilities/FileIO/JSON.h"
 
@@ -148,8 +149,19 @@ bool SceneManager::CommitPendingSceneChange(Passkey<GameEngine>) {
     // 新しいシーンを作成する
     if (!entry->filePath.empty()) {
         // ファイルパス登録の場合は切り替えのたびに最新のファイル内容を読み込む
-        JSON sceneData = LoadSceneFromPath(entry->filePath);
-        if (!sceneData.empty()) {
+        // （バイナリシーンはJSONへ戻さず、列形式のコンポーネントを直接読み込む）
+        SceneBinaryReader binaryScene;
+        if (OpenSceneBinaryFromPath(entry->filePath, binaryScene)) {
+            currentScene_ = std::make_unique<Scene>(pendingSceneName_);
+            // 直接の読み込みに失敗した場合（シーンは空に戻る）は、同じシーンへJSONを経由して読み込み直す
+            if (!currentScene_->LoadFromSceneBinary(binaryScene)) {
+                LogScope scope;
+                Log(Translation("engine.scenemanager.scene.binary.load.fallback") + entry->filePath, LogSeverity::Warning);
+                if (!currentScene_->LoadFromJSON(LoadSceneFromPath(entry->filePath))) {
+                    Log(Translation("engine.scenemanager.scene.load.failed") + entry->filePath, LogSeverity::Warning);
+                }
+            }
+        } else if (JSON sceneData = LoadSceneFromPath(entry->filePath); !sceneData.empty()) {
             currentScene_ = std::make_unique<Scene>(sceneData);
         } else {
             LogScope scope;
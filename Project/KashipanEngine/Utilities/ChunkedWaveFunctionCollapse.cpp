@@ -0,0 +1,360 @@
+#include "Utilities/ChunkedWaveFunctionCollapse.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <tuple>
+#include <unordered_set>
+
+#include "Utilities/FileIO/BinaryStream.h"
+#include "Utilities/Plugin/Plugins.h"
+#include "Utilities/WaveFunctionCollapse.h"
+
+namespace KashipanEngine {
+
+namespace {
+
+/// @brief 方向ごとのチャンク座標オフセット（WfcSolver と同じ Up, Down, Left, Right, Front, Back の並び）
+constexpr std::array<std::array<std::int32_t, 3>, kWfcDirectionCount> kChunkOffsets = { {
+    { 0, 1, 0 },
+    { 0, -1, 0 },
+    { -1, 0, 0 },
+    { 1, 0, 0 },
+    { 0, 0, 1 },
+    { 0, 0, -1 },
+} };
+
+WfcChunkCoord OffsetChunk(const WfcChunkCoord &coord, std::size_t direction) noexcept {
+    return { coord.x + kChunkOffsets[direction][0], coord.y + kChunkOffsets[direction][1], coord.z + kChunkOffsets[direction][2] };
+}
+
+/// @brief 座標の偶奇から決まる段（面で隣接するチャンク同士は必ず1ビットだけ異なる）
+std::uint32_t PhaseOf(const WfcChunkCoord &coord) noexcept {
+    return (static_cast<std::uint32_t>(coord.x) & 1u)
+        | ((static_cast<std::uint32_t>(coord.y) & 1u) << 1)
+        | ((static_cast<std::uint32_t>(coord.z) & 1u) << 2);
+}
+
+std::int32_t FloorDiv(std::int32_t value, std::uint32_t divisor) noexcept {
+    const std::int64_t d = static_cast<std::int64_t>(divisor);
+    const std::int64_t q = value / d;
+    return static_cast<std::int32_t>((value % d != 0 && value < 0) ? q - 1 : q);
+}
+
+std::uint32_t ChunkSeedOf(std::uint32_t worldSeed, const WfcChunkCoord &coord) noexcept {
+    const std::array<std::int32_t, 4> key = { static_cast<std::int32_t>(worldSeed), coord.x, coord.y, coord.z };
+    const std::uint64_t hash = HashFnv1a(kFnv1aOffsetBasis, key.data(), sizeof(key));
+    return static_cast<std::uint32_t>(hash ^ (hash >> 32));
+}
+
+} // namespace
+
+std::size_t WfcChunkCoordHash::operator()(const WfcChunkCoord &coord) const noexcept {
+    return static_cast<std::size_t>(HashFnv1a(kFnv1aOffsetBasis, &coord, sizeof(coord)));
+}
+
+bool ChunkedWaveFunctionCollapse::Setup(WaveFunctionCollapse &wfc, bool bounded) {
+    chunks_.clear();
+    fixedTiles_.clear();
+    ruleSet_.reset();
+    tileNames_.clear();
+    if (wfc.GetTiles().empty()) {
+        return false;
+    }
+
+    worldSize_ = { wfc.GetGridWidth(), wfc.GetGridHeight(), wfc.GetGridDepth() };
+    const bool hasGrid = worldSize_[0] > 0 && worldSize_[1] > 0 && worldSize_[2] > 0;
+    if (bounded && !hasGrid) {
+        return false;
+    }
+    bounded_ = bounded;
+    worldSeed_ = wfc.GetSeed();
+    solveSettings_.maxBacktracks = wfc.GetMaxBacktracks();
+    solveSettings_.maxRestarts = wfc.GetMaxRestarts();
+    ruleSet_ = wfc.GetRuleSet();
+    tileNames_ = wfc.GetRuleTileNames();
+
+    if (hasGrid) {
+        std::unordered_map<std::string, std::uint32_t> nameToIndex;
+        for (std::uint32_t t = 0; t < tileNames_.size(); ++t) {
+            nameToIndex.emplace(tileNames_[t], t);
+        }
+        fixedTiles_.assign(static_cast<std::size_t>(worldSize_[0]) * worldSize_[1] * worldSize_[2], WfcSolver::kUnresolvedTile);
+        std::size_t index = 0;
+        for (std::uint32_t x = 0; x < worldSize_[0]; ++x) {
+            for (std::uint32_t y = 0; y < worldSize_[1]; ++y) {
+                for (std::uint32_t z = 0; z < worldSize_[2]; ++z, ++index) {
+                    if (const auto fixed = wfc.GetFixedTile(x, y, z)) {
+                        auto it = nameToIndex.find(*fixed);
+                        if (it != nameToIndex.end()) {
+                            fixedTiles_[index] = it->second;
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return true;
+}
+
+void ChunkedWaveFunctionCollapse::SetChunkSize(std::uint32_t sizeX, std::uint32_t sizeY, std::uint32_t sizeZ) {
+    chunkSize_ = { std::max(sizeX, 1u), std::max(sizeY, 1u), std::max(sizeZ, 1u) };
+    chunks_.clear();
+}
+
+void ChunkedWaveFunctionCollapse::SetWorldSeed(std::uint32_t seed) {
+    worldSeed_ = seed;
+    chunks_.clear();
+}
+
+WfcChunkCoord ChunkedWaveFunctionCollapse::GetChunkCoordOfTile(std::int32_t x, std::int32_t y, std::int32_t z) const noexcept {
+    return { FloorDiv(x, chunkSize_[0]), FloorDiv(y, chunkSize_[1]), FloorDiv(z, chunkSize_[2]) };
+}
+
+bool ChunkedWaveFunctionCollapse::GenerateChunks(std::span<const WfcChunkCoord> coords) {
+    return GenerateChunks(coords, WfcChunkGenerateOptions{});
+}
+
+bool ChunkedWaveFunctionCollapse::GenerateChunks(std::span<const WfcChunkCoord> coords, const WfcChunkGenerateOptions &options) {
+    if (!ruleSet_) {
+        return false;
+    }
+
+    // 同じ段のチャンク同士は隣接しないため、段ごとに並列に解ける（前の段はすべて解き終わっている）
+    const auto pendingByPhase = CollectPendingChunks(coords);
+    std::vector<std::uint8_t> isSkipped;
+    for (const auto &pending : pendingByPhase) {
+        if (pending.empty()) continue;
+        std::vector<Chunk *> targets;
+        targets.reserve(pending.size());
+        for (const auto &coord : pending) {
+            targets.push_back(&chunks_[coord]);
+        }
+        // 段の中のチャンクはジョブ間で共有するカウンタで数え、どのジョブもチャンクごとにキャンセルを確かめる
+        isSkipped.assign(pending.size(), 0);
+        std::atomic<std::size_t> skippedCount{ 0 };
+        Plugin::ParallelFor(pending.size(), 1, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                if (options.shouldContinue && !options.shouldContinue()) {
+                    isSkipped[i] = 1;
+                    skippedCount.fetch_add(1, std::memory_order_relaxed);
+                    continue;
+                }
+                SolveChunk(pending[i], *targets[i]);
+                if (options.onChunkFinished) {
+                    options.onChunkFinished(targets[i]->solved);
+                }
+            }
+        }, options.priority);
+
+        if (skippedCount.load(std::memory_order_relaxed) > 0) {
+            // 解かなかったチャンクは未生成に戻す（解けなかったチャンクと区別し、次回の生成で解けるようにする）
+            for (std::size_t i = 0; i < pending.size(); ++i) {
+                if (isSkipped[i]) chunks_.erase(pending[i]);
+            }
+            return false;
+        }
+    }
+
+    for (const auto &coord : coords) {
+        if (IsChunkInBounds(coord) && !IsChunkGenerated(coord)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ChunkedWaveFunctionCollapse::GenerateChunk(const WfcChunkCoord &coord) {
+    return GenerateChunks(std::span<const WfcChunkCoord>(&coord, 1));
+}
+
+bool ChunkedWaveFunctionCollapse::GenerateAround(std::int32_t x, std::int32_t y, std::int32_t z, std::uint32_t radius) {
+    const WfcChunkCoord center = GetChunkCoordOfTile(x, y, z);
+    const std::int32_t r = static_cast<std::int32_t>(radius);
+    std::vector<WfcChunkCoord> coords;
+    for (std::int32_t dx = -r; dx <= r; ++dx) {
+        for (std::int32_t dy = -r; dy <= r; ++dy) {
+            for (std::int32_t dz = -r; dz <= r; ++dz) {
+                const WfcChunkCoord coord{ center.x + dx, center.y + dy, center.z + dz };
+                if (IsChunkInBounds(coord)) {
+                    coords.push_back(coord);
+                }
+            }
+        }
+    }
+    return GenerateChunks(coords);
+}
+
+bool ChunkedWaveFunctionCollapse::IsChunkGenerated(const WfcChunkCoord &coord) const {
+    auto it = chunks_.find(coord);
+    return it != chunks_.end() && it->second.solved;
+}
+
+void ChunkedWaveFunctionCollapse::ReleaseChunk(const WfcChunkCoord &coord) {
+    chunks_.erase(coord);
+}
+
+void ChunkedWaveFunctionCollapse::ReleaseChunksOutside(std::int32_t x, std::int32_t y, std::int32_t z, std::uint32_t radius) {
+    const WfcChunkCoord center = GetChunkCoordOfTile(x, y, z);
+    const std::int64_t r = static_cast<std::int64_t>(radius);
+    std::erase_if(chunks_, [&](const auto &pair) {
+        const WfcChunkCoord &coord = pair.first;
+        return std::abs(static_cast<std::int64_t>(coord.x) - center.x) > r
+            || std::abs(static_cast<std::int64_t>(coord.y) - center.y) > r
+            || std::abs(static_cast<std::int64_t>(coord.z) - center.z) > r;
+    });
+}
+
+void ChunkedWaveFunctionCollapse::ClearChunks() {
+    chunks_.clear();
+}
+
+std::size_t ChunkedWaveFunctionCollapse::GetGeneratedChunkCount() const noexcept {
+    return static_cast<std::size_t>(std::count_if(chunks_.begin(), chunks_.end(), [](const auto &pair) { return pair.second.solved; }));
+}
+
+std::uint32_t ChunkedWaveFunctionCollapse::GetTileIndex(std::int32_t x, std::int32_t y, std::int32_t z) const {
+    const WfcChunkCoord coord = GetChunkCoordOfTile(x, y, z);
+    auto it = chunks_.find(coord);
+    if (it == chunks_.end() || !it->second.solved) {
+        return WfcSolver::kUnresolvedTile;
+    }
+    const Chunk &chunk = it->second;
+    const std::uint32_t lx = static_cast<std::uint32_t>(x - coord.x * static_cast<std::int32_t>(chunkSize_[0]));
+    const std::uint32_t ly = static_cast<std::uint32_t>(y - coord.y * static_cast<std::int32_t>(chunkSize_[1]));
+    const std::uint32_t lz = static_cast<std::uint32_t>(z - coord.z * static_cast<std::int32_t>(chunkSize_[2]));
+    if (lx >= chunk.extent[0] || ly >= chunk.extent[1] || lz >= chunk.extent[2]) {
+        return WfcSolver::kUnresolvedTile; // 範囲の端で切り詰めたチャンクの外側
+    }
+    return chunk.tiles[(static_cast<std::size_t>(lx) * chunk.extent[1] + ly) * chunk.extent[2] + lz];
+}
+
+std::optional<std::string> ChunkedWaveFunctionCollapse::GetTile(std::int32_t x, std::int32_t y, std::int32_t z) const {
+    const std::uint32_t tile = GetTileIndex(x, y, z);
+    if (tile == WfcSolver::kUnresolvedTile) {
+        return std::nullopt;
+    }
+    return tileNames_[tile];
+}
+
+bool ChunkedWaveFunctionCollapse::IsChunkInBounds(const WfcChunkCoord &coord) const noexcept {
+    if (!bounded_) {
+        return true;
+    }
+    const std::array<std::int32_t, 3> c = { coord.x, coord.y, coord.z };
+    for (std::size_t axis = 0; axis < 3; ++axis) {
+        const std::int64_t origin = static_cast<std::int64_t>(c[axis]) * chunkSize_[axis];
+        if (c[axis] < 0 || origin >= worldSize_[axis]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::array<std::uint32_t, 3> ChunkedWaveFunctionCollapse::GetChunkExtent(const WfcChunkCoord &coord) const noexcept {
+    std::array<std::uint32_t, 3> extent = chunkSize_;
+    if (bounded_) {
+        const std::array<std::int32_t, 3> c = { coord.x, coord.y, coord.z };
+        for (std::size_t axis = 0; axis < 3; ++axis) {
+            const std::uint32_t origin = static_cast<std::uint32_t>(c[axis]) * chunkSize_[axis];
+            extent[axis] = std::min(chunkSize_[axis], worldSize_[axis] - origin);
+        }
+    }
+    return extent;
+}
+
+std::array<std::vector<WfcChunkCoord>, 8> ChunkedWaveFunctionCollapse::CollectPendingChunks(std::span<const WfcChunkCoord> coords) const {
+    std::array<std::vector<WfcChunkCoord>, 8> pendingByPhase;
+    std::unordered_set<WfcChunkCoord, WfcChunkCoordHash> visited;
+    std::vector<WfcChunkCoord> stack;
+    for (const auto &coord : coords) {
+        if (IsChunkInBounds(coord) && visited.insert(coord).second) {
+            stack.push_back(coord);
+        }
+    }
+    while (!stack.empty()) {
+        const WfcChunkCoord coord = stack.back();
+        stack.pop_back();
+        // 解けなかったチャンクも結果は変わらないため、生成済みとして扱い再試行しない
+        if (chunks_.contains(coord)) continue;
+        const std::uint32_t phase = PhaseOf(coord);
+        pendingByPhase[phase].push_back(coord);
+        for (std::size_t dir = 0; dir < kWfcDirectionCount; ++dir) {
+            const WfcChunkCoord neighbor = OffsetChunk(coord, dir);
+            if (PhaseOf(neighbor) < phase && IsChunkInBounds(neighbor) && visited.insert(neighbor).second) {
+                stack.push_back(neighbor);
+            }
+        }
+    }
+    // 同じ段の中の並びは結果に影響しないが、ジョブの割り振りを安定させるため揃えておく
+    for (auto &pending : pendingByPhase) {
+        std::sort(pending.begin(), pending.end(), [](const WfcChunkCoord &lhs, const WfcChunkCoord &rhs) {
+            return std::tie(lhs.x, lhs.y, lhs.z) < std::tie(rhs.x, rhs.y, rhs.z);
+        });
+    }
+    return pendingByPhase;
+}
+
+void ChunkedWaveFunctionCollapse::SolveChunk(const WfcChunkCoord &coord, Chunk &chunk) const {
+    chunk.extent = GetChunkExtent(coord);
+    const auto &[ex, ey, ez] = chunk.extent;
+    const std::int64_t ox = static_cast<std::int64_t>(coord.x) * chunkSize_[0];
+    const std::int64_t oy = static_cast<std::int64_t>(coord.y) * chunkSize_[1];
+    const std::int64_t oz = static_cast<std::int64_t>(coord.z) * chunkSize_[2];
+
+    WfcSolver solver(*ruleSet_, ex, ey, ez);
+    for (std::uint32_t x = 0; x < ex; ++x) {
+        for (std::uint32_t y = 0; y < ey; ++y) {
+            for (std::uint32_t z = 0; z < ez; ++z) {
+                const std::uint32_t fixed = GetFixedTile(ox + x, oy + y, oz + z);
+                if (fixed != WfcSolver::kUnresolvedTile) {
+                    solver.FixTile(x, y, z, fixed);
+                }
+            }
+        }
+    }
+
+    // 前の段の隣接チャンクと接する面のセルを、向こう側の確定タイルと接続できるものに絞る
+    const std::uint32_t phase = PhaseOf(coord);
+    for (std::size_t dir = 0; dir < kWfcDirectionCount; ++dir) {
+        const WfcChunkCoord neighborCoord = OffsetChunk(coord, dir);
+        if (PhaseOf(neighborCoord) >= phase) continue;
+        auto it = chunks_.find(neighborCoord);
+        if (it == chunks_.end() || !it->second.solved) continue;
+        const Chunk &neighbor = it->second;
+        const auto &[nx, ny, nz] = neighbor.extent;
+        const auto &offset = kChunkOffsets[dir];
+        const std::size_t axis = offset[0] != 0 ? 0 : (offset[1] != 0 ? 1 : 2);
+        const bool positive = offset[axis] > 0;
+        for (std::uint32_t x = 0; x < ex; ++x) {
+            for (std::uint32_t y = 0; y < ey; ++y) {
+                for (std::uint32_t z = 0; z < ez; ++z) {
+                    std::array<std::uint32_t, 3> local = { x, y, z };
+                    if (local[axis] != (positive ? chunk.extent[axis] - 1 : 0)) continue;
+                    local[axis] = positive ? 0 : neighbor.extent[axis] - 1;
+                    if (local[0] >= nx || local[1] >= ny || local[2] >= nz) continue;
+                    const std::uint32_t neighborTile = neighbor.tiles[(static_cast<std::size_t>(local[0]) * ny + local[1]) * nz + local[2]];
+                    solver.ConstrainToNeighbor(x, y, z, dir, neighborTile);
+                }
+            }
+        }
+    }
+
+    std::mt19937 randomEngine(ChunkSeedOf(worldSeed_, coord));
+    chunk.solved = solver.Solve(randomEngine, solveSettings_);
+    if (chunk.solved) {
+        chunk.tiles = solver.GetResolvedTiles();
+    } else {
+        chunk.tiles.clear();
+    }
+}
+
+std::uint32_t ChunkedWaveFunctionCollapse::GetFixedTile(std::int64_t x, std::int64_t y, std::int64_t z) const noexcept {
+    if (fixedTiles_.empty() || x < 0 || y < 0 || z < 0 ||
+        x >= worldSize_[0] || y >= worldSize_[1] || z >= worldSize_[2]) {
+        return WfcSolver::kUnresolvedTile;
+    }
+    return fixedTiles_[(static_cast<std::size_t>(x) * worldSize_[1] + static_cast<std::size_t>(y)) * worldSize_[2] + static_cast<std::size_t>(z)];
+}
+
+} // namespace KashipanEngine
@@ -0,0 +1,131 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Utilities/WfcSolver.h"
+
+namespace KashipanEngine {
+
+class WaveFunctionCollapse;
+
+/// @brief ChunkedWaveFunctionCollapse のチャンク座標（タイル座標をチャンクサイズで割った値）
+struct WfcChunkCoord final {
+    std::int32_t x = 0;
+    std::int32_t y = 0;
+    std::int32_t z = 0;
+
+    bool operator==(const WfcChunkCoord &) const = default;
+};
+
+struct WfcChunkCoordHash final {
+    std::size_t operator()(const WfcChunkCoord &coord) const noexcept;
+};
+
+/// @brief ChunkedWaveFunctionCollapse::GenerateChunks の実行方法（ジョブの優先度・キャンセル・進捗の通知）
+struct WfcChunkGenerateOptions final {
+    /// @brief 段ごとに並列に解くジョブの優先度（数値が小さいほど高優先度。Plugin::ParallelFor と同じ）
+    int priority = 0;
+    /// @brief 各チャンクを解く前に呼ばれ、false を返すとそのチャンクと以降の段を解かない（複数スレッドから並列に呼ばれる）
+    std::function<bool()> shouldContinue;
+    /// @brief チャンクを1つ解き終えるたびに、解けたかを渡して呼ばれる（複数スレッドから並列に呼ばれる）
+    std::function<void(bool isSolved)> onChunkFinished;
+};
+
+/// @brief 広い（または無限の）タイルグリッドをチャンク単位で波動関数崩壊させるユーティリティクラス
+/// @details タイル・固定タイル・シードは WaveFunctionCollapse から取り込む（StageGridBuilder::Build の
+///          出力をそのまま渡せる）。チャンクは座標の偶奇から決まる段（2D なら4段、3D なら8段）の順に解き、
+///          各チャンクは自分より前の段の隣接チャンクの境界タイルだけを制約として受け取る。同じ段のチャンク
+///          同士は隣接しないため、段ごとにジョブシステムで並列に解く。チャンクの結果は
+///          （シード, チャンク座標, 前の段の隣接チャンク）だけで決まるため、生成順・スレッド数・
+///          解放してからの再生成に関わらず同じになる。
+///          Generate 系の関数は同時に1スレッドからのみ呼び出すこと
+class ChunkedWaveFunctionCollapse final {
+public:
+    ChunkedWaveFunctionCollapse() = default;
+    ~ChunkedWaveFunctionCollapse() = default;
+
+    /// @brief wfc に登録されたタイル・固定タイル・シード・打ち切り設定を取り込む（生成済みのチャンクは破棄される）
+    /// @param bounded true の場合は wfc のグリッドサイズを世界の範囲とし、範囲外のチャンクは生成しない。
+    ///                false の場合は範囲なしで生成し、wfc のグリッド内の固定タイルだけを制約として使う
+    /// @return タイルが1つも登録されていない、または bounded なのにグリッドサイズが0の場合は false
+    bool Setup(WaveFunctionCollapse &wfc, bool bounded = true);
+
+    /// @brief チャンク1つ分のタイル数を設定する（生成済みのチャンクは破棄される）
+    void SetChunkSize(std::uint32_t sizeX, std::uint32_t sizeY, std::uint32_t sizeZ);
+    std::uint32_t GetChunkSizeX() const noexcept { return chunkSize_[0]; }
+    std::uint32_t GetChunkSizeY() const noexcept { return chunkSize_[1]; }
+    std::uint32_t GetChunkSizeZ() const noexcept { return chunkSize_[2]; }
+
+    /// @brief 各チャンクの乱数シードの元になる値（Setup では wfc のシードが設定される。生成済みのチャンクは破棄される）
+    void SetWorldSeed(std::uint32_t seed);
+    std::uint32_t GetWorldSeed() const noexcept { return worldSeed_; }
+
+    /// @brief タイル座標を含むチャンクの座標
+    WfcChunkCoord GetChunkCoordOfTile(std::int32_t x, std::int32_t y, std::int32_t z) const noexcept;
+
+    /// @brief 指定したチャンクを生成する（前の段の隣接チャンクが未生成であれば先に生成する）
+    /// @return 全チャンクを生成できた場合は true（範囲外のチャンクは無視する。解けなかったチャンクがある場合は false）
+    bool GenerateChunks(std::span<const WfcChunkCoord> coords);
+    /// @details shouldContinue で中断した場合、解かなかったチャンクは未生成のまま残る（再度生成できる）
+    bool GenerateChunks(std::span<const WfcChunkCoord> coords, const WfcChunkGenerateOptions &options);
+    bool GenerateChunk(const WfcChunkCoord &coord);
+    /// @brief タイル座標を含むチャンクから radius チャンク以内（各軸）をまとめて生成する
+    /// @details プレイヤーの移動に合わせて周囲を順次生成する用途。ワールド座標からは StageGridBuilder::WorldToGrid で変換する
+    bool GenerateAround(std::int32_t x, std::int32_t y, std::int32_t z, std::uint32_t radius);
+
+    /// @brief チャンクが生成済み（解けたもの）か
+    bool IsChunkGenerated(const WfcChunkCoord &coord) const;
+    /// @brief 生成済みのチャンクを解放する（再度生成した場合も同じ結果になる）
+    void ReleaseChunk(const WfcChunkCoord &coord);
+    /// @brief タイル座標を含むチャンクから radius チャンクより離れたチャンクを解放する
+    void ReleaseChunksOutside(std::int32_t x, std::int32_t y, std::int32_t z, std::uint32_t radius);
+    /// @brief 生成済みのチャンクをすべて解放する
+    void ClearChunks();
+    std::size_t GetGeneratedChunkCount() const noexcept;
+
+    /// @brief 確定したタイル（GetTileNames のインデックス。チャンクが未生成の場合は WfcSolver::kUnresolvedTile）
+    std::uint32_t GetTileIndex(std::int32_t x, std::int32_t y, std::int32_t z) const;
+    /// @brief 確定したタイル名（チャンクが未生成の場合は std::nullopt）
+    std::optional<std::string> GetTile(std::int32_t x, std::int32_t y, std::int32_t z) const;
+    /// @brief タイルインデックスに対応するタイル名（名前順）
+    const std::vector<std::string> &GetTileNames() const noexcept { return tileNames_; }
+
+private:
+    struct Chunk {
+        std::array<std::uint32_t, 3> extent{};
+        /// @brief 確定したタイル（WfcSolver と同じ [x][y][z] の並び。解けなかった場合は空）
+        std::vector<std::uint32_t> tiles;
+        bool solved = false;
+    };
+
+    bool IsChunkInBounds(const WfcChunkCoord &coord) const noexcept;
+    /// @brief 範囲の端で切り詰めたチャンクのタイル数
+    std::array<std::uint32_t, 3> GetChunkExtent(const WfcChunkCoord &coord) const noexcept;
+    /// @brief 前の段の隣接チャンクをたどって、未生成のチャンクを段ごとに集める
+    std::array<std::vector<WfcChunkCoord>, 8> CollectPendingChunks(std::span<const WfcChunkCoord> coords) const;
+    void SolveChunk(const WfcChunkCoord &coord, Chunk &chunk) const;
+    std::uint32_t GetFixedTile(std::int64_t x, std::int64_t y, std::int64_t z) const noexcept;
+
+    std::shared_ptr<const WfcRuleSet> ruleSet_;
+    std::vector<std::string> tileNames_;
+    WfcSolveSettings solveSettings_;
+    std::uint32_t worldSeed_ = 0;
+    std::array<std::uint32_t, 3> chunkSize_{ 16, 16, 16 };
+
+    bool bounded_ = true;
+    /// @brief 取り込んだ wfc のグリッドサイズ（bounded の場合は世界の範囲）
+    std::array<std::uint32_t, 3> worldSize_{};
+    /// @brief 取り込んだ固定タイル（worldSize_ の範囲。未固定は WfcSolver::kUnresolvedTile）
+    std::vector<std::uint32_t> fixedTiles_;
+
+    std::unordered_map<WfcChunkCoord, Chunk, WfcChunkCoordHash> chunks_;
+};
+
+} // namespace KashipanEngine
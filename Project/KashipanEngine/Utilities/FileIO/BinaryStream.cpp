@@ -0,0 +1,66 @@
+#include "BinaryStream.h"
+
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <system_error>
+
+#include "Utilities/Conversion/ConvertString.h"
+
+namespace KashipanEngine {
+
+namespace {
+
+/// @brief 一時ファイル名の連番（同じファイルへ並行して書き込んでも一時ファイルが衝突しないようにする）
+std::atomic<std::uint64_t> sTemporaryFileSerial{ 0 };
+
+} // namespace
+
+std::uint64_t HashFileContentFnv1a(const std::string &filePath) {
+    std::ifstream file(Utf8StringToPath(filePath), std::ios::binary);
+    if (!file) return 0;
+    const std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    return HashFnv1a(kFnv1aOffsetBasis, content.data(), content.size());
+}
+
+bool SaveChecksummedBinaryFile(const std::string &filePath, std::vector<std::uint8_t> data) {
+    const std::uint64_t checksum = HashFnv1a(kFnv1aOffsetBasis, data.data(), data.size());
+    BinaryWriter(data).U64(checksum);
+
+    const std::filesystem::path path = Utf8StringToPath(filePath);
+    std::error_code ec;
+    std::filesystem::create_directories(path.parent_path(), ec);
+    std::filesystem::path temporaryPath = path;
+    temporaryPath += "." + std::to_string(sTemporaryFileSerial.fetch_add(1, std::memory_order_relaxed)) + ".tmp";
+    {
+        std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+        if (!file) return false;
+        file.write(reinterpret_cast<const char *>(data.data()), static_cast<std::streamsize>(data.size()));
+        if (!file.good()) return false;
+    }
+    std::filesystem::rename(temporaryPath, path, ec);
+    if (ec) {
+        std::filesystem::remove(temporaryPath, ec);
+        return false;
+    }
+    return true;
+}
+
+bool LoadChecksummedBinaryFile(const std::string &filePath, std::vector<std::uint8_t> &outPayload) {
+    std::ifstream file(Utf8StringToPath(filePath), std::ios::binary);
+    if (!file) return false;
+    std::vector<std::uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    std::uint64_t checksum = 0;
+    if (data.size() < sizeof(checksum)) return false;
+    const std::size_t payloadSize = data.size() - sizeof(checksum);
+    std::memcpy(&checksum, data.data() + payloadSize, sizeof(checksum));
+    if (HashFnv1a(kFnv1aOffsetBasis, data.data(), payloadSize) != checksum) return false;
+
+    data.resize(payloadSize);
+    outPayload = std::move(data);
+    return true;
+}
+
+} // namespace KashipanEngine
@@ -0,0 +1,129 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace KashipanEngine {
+
+/// @brief FNV-1a（64bit）の初期値
+inline constexpr std::uint64_t kFnv1aOffsetBasis = 14695981039346656037ull;
+
+/// @brief FNV-1a（64bit）へバイト列を追加する
+inline std::uint64_t HashFnv1a(std::uint64_t hash, const void *data, std::size_t length) noexcept {
+    const auto *bytes = static_cast<const unsigned char *>(data);
+    for (std::size_t i = 0; i < length; ++i) {
+        hash ^= static_cast<std::uint64_t>(bytes[i]);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+/// @brief ファイル内容のFNV-1aハッシュ（読めないファイルは 0）
+std::uint64_t HashFileContentFnv1a(const std::string &filePath);
+
+/// @brief キャッシュ等のバイナリファイルの書き出し（リトルエンディアン前提でそのまま並べる）
+class BinaryWriter final {
+public:
+    explicit BinaryWriter(std::vector<std::uint8_t> &buffer) : buffer_(buffer) {}
+
+    void Bytes(const void *data, std::size_t size) {
+        const auto *bytes = static_cast<const std::uint8_t *>(data);
+        buffer_.insert(buffer_.end(), bytes, bytes + size);
+    }
+    void U8(std::uint8_t value) { Bytes(&value, sizeof(value)); }
+    void U32(std::uint32_t value) { Bytes(&value, sizeof(value)); }
+    void U64(std::uint64_t value) { Bytes(&value, sizeof(value)); }
+    void F32(float value) { Bytes(&value, sizeof(value)); }
+    void String(const std::string &value) {
+        U32(static_cast<std::uint32_t>(value.size()));
+        Bytes(value.data(), value.size());
+    }
+    void Strings(const std::vector<std::string> &values) {
+        U32(static_cast<std::uint32_t>(values.size()));
+        for (const auto &value : values) String(value);
+    }
+    /// @brief 要素数と中身をそのまま書き出す（トリビアルコピー可能な型のみ）
+    template <typename T>
+    void Array(const std::vector<T> &values) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        U32(static_cast<std::uint32_t>(values.size()));
+        Bytes(values.data(), values.size() * sizeof(T));
+    }
+
+    std::size_t GetSize() const noexcept { return buffer_.size(); }
+
+private:
+    std::vector<std::uint8_t> &buffer_;
+};
+
+/// @brief キャッシュ等のバイナリファイルの読み込み（範囲外を読もうとした時点で以降は全て失敗する）
+class BinaryReader final {
+public:
+    BinaryReader(const std::uint8_t *data, std::size_t size) : data_(data), size_(size) {}
+
+    bool IsValid() const noexcept { return isValid_; }
+    bool IsAtEnd() const noexcept { return position_ == size_; }
+
+    bool Bytes(void *out, std::size_t size) {
+        if (!isValid_ || size > size_ - position_) return isValid_ = false;
+        std::memcpy(out, data_ + position_, size);
+        position_ += size;
+        return true;
+    }
+    std::uint8_t U8() { std::uint8_t value = 0; Bytes(&value, sizeof(value)); return value; }
+    std::uint32_t U32() { std::uint32_t value = 0; Bytes(&value, sizeof(value)); return value; }
+    std::uint64_t U64() { std::uint64_t value = 0; Bytes(&value, sizeof(value)); return value; }
+    float F32() { float value = 0.0f; Bytes(&value, sizeof(value)); return value; }
+    std::string String() {
+        const std::uint32_t length = U32();
+        if (!isValid_ || length > size_ - position_) { isValid_ = false; return {}; }
+        std::string value(reinterpret_cast<const char *>(data_ + position_), length);
+        position_ += length;
+        return value;
+    }
+    std::vector<std::string> Strings() {
+        const std::uint32_t count = U32();
+        std::vector<std::string> values;
+        for (std::uint32_t i = 0; i < count && isValid_; ++i) values.push_back(String());
+        return values;
+    }
+    std::vector<std::uint8_t> Blob() {
+        const std::uint32_t length = U32();
+        if (!isValid_ || length > size_ - position_) { isValid_ = false; return {}; }
+        std::vector<std::uint8_t> value(data_ + position_, data_ + position_ + length);
+        position_ += length;
+        return value;
+    }
+    /// @brief BinaryWriter::Array で書き出した配列を読む
+    template <typename T>
+    std::vector<T> Array() {
+        static_assert(std::is_trivially_copyable_v<T>);
+        const std::uint32_t count = U32();
+        if (!isValid_ || count > (size_ - position_) / sizeof(T)) { isValid_ = false; return {}; }
+        std::vector<T> values(count);
+        Bytes(values.data(), count * sizeof(T));
+        return values;
+    }
+
+private:
+    const std::uint8_t *data_ = nullptr;
+    std::size_t size_ = 0;
+    std::size_t position_ = 0;
+    bool isValid_ = true;
+};
+
+/// @brief 末尾にFNV-1aのチェックサムを付けてバイナリファイルへ書き出す
+/// @details 書き込み途中のファイルを読まないよう、一時ファイルへ書いてから置き換える。一時ファイル名は呼び出しごとに
+///          異なるため、同じファイルへ並行して書き込んでも壊れない（後に置き換えた方が残る）。保存先のフォルダは必要なら作成する
+/// @return 書き込みに成功した場合は true
+bool SaveChecksummedBinaryFile(const std::string &filePath, std::vector<std::uint8_t> data);
+
+/// @brief SaveChecksummedBinaryFile で書き出したファイルを読み込む
+/// @param outPayload チェックサムを除いた中身
+/// @return ファイルが読めてチェックサムが一致した場合は true（書き込み途中・破損したファイルは false）
+bool LoadChecksummedBinaryFile(const std::string &filePath, std::vector<std::uint8_t> &outPayload);
+
+} // namespace KashipanEngine
@@ -0,0 +1,134 @@
+#include "LzBlockCompression.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace KashipanEngine {
+
+namespace {
+
+constexpr std::size_t kMinMatchLength = 4;
+constexpr std::size_t kMaxOffset = 65535;
+constexpr int kHashBits = 14;
+/// @brief 末尾のこのバイト数は一致を探さずリテラルとして出力する（展開時の境界判定を単純にするため）
+constexpr std::size_t kLastLiterals = 5;
+
+std::uint32_t Read32(const std::uint8_t *p) {
+    std::uint32_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+std::uint32_t HashOf(std::uint32_t sequence) {
+    return (sequence * 2654435761u) >> (32 - kHashBits);
+}
+
+void WriteLength(std::vector<std::uint8_t> &out, std::size_t length) {
+    while (length >= 255) {
+        out.push_back(255);
+        length -= 255;
+    }
+    out.push_back(static_cast<std::uint8_t>(length));
+}
+
+void WriteSequence(std::vector<std::uint8_t> &out, const std::uint8_t *literals, std::size_t literalLength,
+    std::size_t matchLength, std::size_t offset) {
+    const std::size_t matchCode = matchLength >= kMinMatchLength ? matchLength - kMinMatchLength : 0;
+    const std::uint8_t token = static_cast<std::uint8_t>((std::min<std::size_t>(literalLength, 15) << 4) | std::min<std::size_t>(matchCode, 15));
+    out.push_back(token);
+    if (literalLength >= 15) WriteLength(out, literalLength - 15);
+    out.insert(out.end(), literals, literals + literalLength);
+    if (matchLength == 0) return;
+    out.push_back(static_cast<std::uint8_t>(offset & 0xFF));
+    out.push_back(static_cast<std::uint8_t>(offset >> 8));
+    if (matchCode >= 15) WriteLength(out, matchCode - 15);
+}
+
+/// @brief 255単位の追加バイトで表した長さを読み足す
+bool ReadLength(const std::uint8_t *&p, const std::uint8_t *end, std::size_t &length) {
+    std::uint8_t byte;
+    do {
+        if (p >= end) return false;
+        byte = *p++;
+        length += byte;
+    } while (byte == 255);
+    return true;
+}
+
+} // namespace
+
+std::vector<std::uint8_t> CompressLzBlock(const std::uint8_t *data, std::size_t size) {
+    std::vector<std::uint8_t> out;
+    out.reserve(size / 2 + 16);
+
+    std::vector<std::uint32_t> table(std::size_t{ 1 } << kHashBits, 0);
+    std::size_t anchor = 0;
+    std::size_t position = 0;
+    const std::size_t matchLimit = size > kLastLiterals ? size - kLastLiterals : 0;
+
+    while (position + kMinMatchLength <= matchLimit) {
+        const std::uint32_t sequence = Read32(data + position);
+        const std::uint32_t hash = HashOf(sequence);
+        const std::size_t candidate = table[hash];
+        table[hash] = static_cast<std::uint32_t>(position);
+
+        if (candidate >= position || position - candidate > kMaxOffset || Read32(data + candidate) != sequence) {
+            ++position;
+            continue;
+        }
+
+        std::size_t matchLength = kMinMatchLength;
+        while (position + matchLength < matchLimit && data[candidate + matchLength] == data[position + matchLength]) {
+            ++matchLength;
+        }
+        WriteSequence(out, data + anchor, position - anchor, matchLength, position - candidate);
+        position += matchLength;
+        anchor = position;
+    }
+
+    // 残りはリテラルだけのシーケンスとして出力する
+    WriteSequence(out, data + anchor, size - anchor, 0, 0);
+    return out;
+}
+
+bool DecompressLzBlock(const std::uint8_t *data, std::size_t size, std::uint8_t *out, std::size_t outSize) {
+    const std::uint8_t *p = data;
+    const std::uint8_t *end = data + size;
+    std::size_t written = 0;
+
+    while (p < end) {
+        const std::uint8_t token = *p++;
+
+        std::size_t literalLength = token >> 4;
+        if (literalLength == 15 && !ReadLength(p, end, literalLength)) return false;
+        if (literalLength > static_cast<std::size_t>(end - p) || literalLength > outSize - written) return false;
+        std::memcpy(out + written, p, literalLength);
+        p += literalLength;
+        written += literalLength;
+
+        // 最後のシーケンスは一致を持たない
+        if (p == end) break;
+
+        if (end - p < 2) return false;
+        const std::size_t offset = static_cast<std::size_t>(p[0]) | (static_cast<std::size_t>(p[1]) << 8);
+        p += 2;
+        std::size_t matchLength = token & 0x0F;
+        if (matchLength == 15 && !ReadLength(p, end, matchLength)) return false;
+        matchLength += kMinMatchLength;
+        if (offset == 0 || offset > written || matchLength > outSize - written) return false;
+
+        // 一致範囲が出力と重なる（offset < matchLength）場合があるため、前から1バイトずつ複写する
+        const std::uint8_t *source = out + written - offset;
+        if (offset >= matchLength) {
+            std::memcpy(out + written, source, matchLength);
+        } else {
+            for (std::size_t i = 0; i < matchLength; ++i) {
+                out[written + i] = source[i];
+            }
+        }
+        written += matchLength;
+    }
+    return written == outSize;
+}
+
+} // namespace KashipanEngine
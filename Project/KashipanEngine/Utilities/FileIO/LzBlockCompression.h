@@ -0,0 +1,20 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace KashipanEngine {
+
+/// @brief LZ77系の軽量なブロック圧縮（外部ライブラリ不要。展開速度を優先する）
+/// @details 形式は「トークン（上位4bit: リテラル長, 下位4bit: 一致長-4）・リテラル・一致位置（2バイト）」の並びで、
+///          長さが15以上の場合は255単位の追加バイトで表す。一致位置は64KB以内。
+///          ブロックは単独で展開できるため、複数ブロックを並列に展開してよい
+/// @return 圧縮したバイト列（圧縮しても小さくならないデータでは元より少し大きくなる）
+std::vector<std::uint8_t> CompressLzBlock(const std::uint8_t *data, std::size_t size);
+
+/// @brief CompressLzBlock で圧縮したブロックを展開する
+/// @param outSize 展開後のサイズ（圧縮時の size と一致すること）
+/// @return 壊れたデータ・サイズ不一致の場合は false
+bool DecompressLzBlock(const std::uint8_t *data, std::size_t size, std::uint8_t *out, std::size_t outSize);
+
+} // namespace KashipanEngine
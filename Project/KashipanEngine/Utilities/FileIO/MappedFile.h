@@ -0,0 +1,36 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace KashipanEngine {
+
+/// @brief 読み取り専用でメモリマップしたファイル
+/// @details 内容はOSのページキャッシュから必要な分だけ読み込まれるため、大きなファイルでも
+///          開く時点では読み込みを待たない。破棄・Close で割り当てを解除する（コピー不可）
+class MappedFile final {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+    MappedFile(MappedFile &&other) noexcept;
+    MappedFile &operator=(MappedFile &&other) noexcept;
+
+    /// @brief ファイルをメモリマップする（開いていたファイルは閉じる）
+    /// @return ファイルが開けない・空の場合は false
+    bool Open(const std::string &filePath);
+    void Close() noexcept;
+
+    bool IsOpen() const noexcept { return data_ != nullptr; }
+    const std::uint8_t *GetData() const noexcept { return data_; }
+    std::size_t GetSize() const noexcept { return size_; }
+
+private:
+    const std::uint8_t *data_ = nullptr;
+    std::size_t size_ = 0;
+    void *fileHandle_ = nullptr;
+    void *mappingHandle_ = nullptr;
+};
+
+} // namespace KashipanEngine
@@ -2,8 +2,20 @@
 
 #include <algorithm>
 
+#include "Utilities/Plugin/Plugins.h"
+
 namespace KashipanEngine {
 
+namespace {
+
+/// @brief カーソルから二分探索へ切り替えるまでに線形に進めるキー数
+constexpr std::uint32_t kCursorLinearSteps = 4;
+/// @brief EvaluateBatch をジョブシステムへ分散する件数の下限と、ジョブ1つが受け持つ件数
+constexpr size_t kParallelBatchThreshold = 2048;
+constexpr size_t kBatchGrainSize = 512;
+
+} // namespace
+
 void KeyframeAnimation::AddKeyframe(float time, float value, EaseType easeType) {
     Keyframe key;
     key.time = time;
@@ -19,16 +31,64 @@ float KeyframeAnimation::Evaluate(float time) const {
     if (keyframes_.empty()) return 0.0f;
     if (time <= keyframes_.front().time) return keyframes_.front().value;
     if (time >= keyframes_.back().time) return keyframes_.back().value;
+    return EvaluateSegment(FindSegment(time, nullptr), time);
+}
 
-    // timeより後の最初のキーを探し、その1つ前のキーとの間をイージング補間する
+float KeyframeAnimation::Evaluate(float time, Cursor &cursor) const {
+    if (keyframes_.empty()) return 0.0f;
+    if (time <= keyframes_.front().time) return keyframes_.front().value;
+    if (time >= keyframes_.back().time) return keyframes_.back().value;
+    return EvaluateSegment(FindSegment(time, &cursor), time);
+}
+
+void KeyframeAnimation::EvaluateBatch(std::span<const BatchSample> samples, std::span<float> outValues) {
+    const size_t count = std::min(samples.size(), outValues.size());
+    auto evaluateRange = [samples, outValues](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            const BatchSample &sample = samples[i];
+            if (!sample.animation) {
+                outValues[i] = 0.0f;
+            } else if (sample.cursor) {
+                outValues[i] = sample.animation->Evaluate(sample.time, *sample.cursor);
+            } else {
+                outValues[i] = sample.animation->Evaluate(sample.time);
+            }
+        }
+    };
+    if (count < kParallelBatchThreshold) {
+        evaluateRange(0, count);
+        return;
+    }
+    Plugin::ParallelFor(count, kBatchGrainSize, evaluateRange);
+}
+
+size_t KeyframeAnimation::FindSegment(float time, Cursor *cursor) const {
+    // 前回の区間から順に数キーだけ進めて見つかれば、二分探索を省く
+    if (cursor && cursor->keyIndex + 1 < keyframes_.size() && keyframes_[cursor->keyIndex].time <= time) {
+        size_t index = cursor->keyIndex;
+        for (std::uint32_t step = 0; step < kCursorLinearSteps && index + 1 < keyframes_.size(); ++step, ++index) {
+            if (time < keyframes_[index + 1].time) {
+                cursor->keyIndex = static_cast<std::uint32_t>(index);
+                return index;
+            }
+        }
+    }
+
+    // timeより後の最初のキーを探し、その1つ前のキーを区間の先頭にする
     const auto next = std::upper_bound(keyframes_.begin(), keyframes_.end(), time,
         [](float t, const Keyframe &k) { return t < k.time; });
-    const Keyframe &to = *next;
-    const Keyframe &from = *(next - 1);
+    const size_t index = static_cast<size_t>(next - keyframes_.begin()) - 1;
+    if (cursor) cursor->keyIndex = static_cast<std::uint32_t>(index);
+    return index;
+}
+
+float KeyframeAnimation::EvaluateSegment(size_t keyIndex, float time) const {
+    const Keyframe &from = keyframes_[keyIndex];
+    const Keyframe &to = keyframes_[keyIndex + 1];
     const float span = to.time - from.time;
     if (span <= 0.0f) return to.value;
     const float t = (time - from.time) / span;
-    return Lerp(from.value, to.value, Apply(t, from.easeType));
+    return Lerp(from.value, to.value, useBakedEasing_ ? ApplyBaked(t, from.easeType) : Apply(t, from.easeType));
 }
 
 JSON KeyframeAnimation::SaveToJson() const {
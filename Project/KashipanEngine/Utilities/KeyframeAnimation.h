@@ -1,4 +1,6 @@
 #pragma once
+#include <cstdint>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -24,6 +26,20 @@ public:
         EaseType easeType = EaseType::Linear;
     };
 
+    /// @brief 再生位置に対応するキーを覚えておくカーソル（再生ごとに1つ持つ）
+    /// @details 前方へ進む再生では前回のキーから数個進めるだけで済み、巻き戻し・シーク時のみ二分探索に戻る
+    struct Cursor {
+        std::uint32_t keyIndex = 0;
+    };
+
+    /// @brief EvaluateBatch でまとめて評価する1件分の入力
+    struct BatchSample {
+        const KeyframeAnimation *animation = nullptr;
+        float time = 0.0f;
+        /// @brief 評価に使うカーソル（nullptr の場合は毎回二分探索する）。並列に評価されるため、同じバッチ内で共有しないこと
+        Cursor *cursor = nullptr;
+    };
+
     void Clear() { keyframes_.clear(); }
     /// @brief キーを追加する（時刻昇順の位置へ挿入される）
     void AddKeyframe(float time, float value, EaseType easeType = EaseType::Linear);
@@ -32,10 +48,20 @@ public:
     /// @brief 最後のキーの時刻（キーが無い場合は0）
     float GetDuration() const noexcept { return keyframes_.empty() ? 0.0f : keyframes_.back().time; }
 
+    /// @brief イージングを焼き込み表（ApplyBaked）で近似するか（既定は false。誤差は GetBakedEaseMaxError を参照）
+    void SetUseBakedEasing(bool useBakedEasing) noexcept { useBakedEasing_ = useBakedEasing; }
+    bool GetUseBakedEasing() const noexcept { return useBakedEasing_; }
+
     /// @brief 指定時刻の値を評価する
     /// @details 最初のキー以前は最初のキーの値、最後のキー以降は最後のキーの値を返す。
     ///          キーが1つも無い場合は0を返す
     float Evaluate(float time) const;
+    /// @brief カーソルを使って指定時刻の値を評価する（結果はカーソル無しの Evaluate と同じ）
+    float Evaluate(float time, Cursor &cursor) const;
+
+    /// @brief 多数のアニメーションをまとめて評価し、outValues[i] へ samples[i] の結果を書き込む
+    /// @details 件数が多い場合はジョブシステムで並列に評価する（animation が nullptr の要素は 0）
+    static void EvaluateBatch(std::span<const BatchSample> samples, std::span<float> outValues);
 
     /// @brief キーフレーム情報をjsonへ保存する
     JSON SaveToJson() const;
@@ -44,8 +70,14 @@ public:
     bool LoadFromJson(const JSON &json);
 
 private:
+    /// @brief time を含む区間の先頭キーのインデックスを探す（最初のキーより後・最後のキーより前の時刻のみ）
+    size_t FindSegment(float time, Cursor *cursor) const;
+    /// @brief keyIndex から次のキーへの区間を補間する
+    float EvaluateSegment(size_t keyIndex, float time) const;
+
     /// @brief 時刻昇順のキー列
     std::vector<Keyframe> keyframes_;
+    bool useBakedEasing_ = false;
 };
 
 } // namespace KashipanEngine
@@ -1,6 +1,7 @@
 #include "Easings.h"
 #include <cmath>
 #include <algorithm>
+#include <array>
 #include <cassert>
 
 static constexpr float PI = 3.14159265358979323846f;
@@ -627,4 +628,88 @@ EaseType StringToEaseType(const std::string &str) {
 		if (str == name) return value;
 	}
 	return EaseType::Linear;
-}
\ No newline at end of file
+}
+
+namespace {
+
+/// @brief 焼き込み表の区間数（表の要素数は +1）
+constexpr int kBakedEaseSegments = 1024;
+/// @brief 誤差を測る際に1区間を何点に分けて評価するか
+constexpr int kBakedEaseErrorSubdivisions = 8;
+/// @brief 表で近似する誤差の上限（超える種類は表を捨てて常に計算する。EaseOutInElastic は途中で値が跳ぶため該当する）
+constexpr float kBakedEaseTolerance = 0.001f;
+constexpr size_t kEaseTypeCount = static_cast<size_t>(EaseType::EaseOutInBounce) + 1;
+
+struct BakedEaseTable {
+	/// @brief [0, 1] を等間隔に評価した値（表を持たない種類は空）
+	std::vector<float> values;
+	float maxError = 0.0f;
+};
+
+/// @brief 表で置き換える種類か（三角関数・指数関数を使う種類のみ。多項式（Bounce を含む）は計算した方が速く、
+///        Circ は端点の傾きが無限大で線形補間の誤差が大きいため対象外）
+bool IsBakedEaseType(EaseType type) {
+	switch (type) {
+		case EaseType::EaseInSine: case EaseType::EaseOutSine: case EaseType::EaseInOutSine: case EaseType::EaseOutInSine:
+		case EaseType::EaseInExpo: case EaseType::EaseOutExpo: case EaseType::EaseInOutExpo: case EaseType::EaseOutInExpo:
+		case EaseType::EaseInElastic: case EaseType::EaseOutElastic: case EaseType::EaseInOutElastic: case EaseType::EaseOutInElastic:
+			return true;
+		default:
+			return false;
+	}
+}
+
+float SampleBakedEaseTable(const std::vector<float> &values, float t) {
+	const float position = std::clamp(t, 0.0f, 1.0f) * static_cast<float>(kBakedEaseSegments);
+	const int index = std::min(static_cast<int>(position), kBakedEaseSegments - 1);
+	const float fraction = position - static_cast<float>(index);
+	return values[index] + (values[index + 1] - values[index]) * fraction;
+}
+
+const std::array<BakedEaseTable, kEaseTypeCount> &GetBakedEaseTables() {
+	// 全種類をまとめて1度だけ作成する（関数内staticの初期化はスレッドセーフ）
+	static const std::array<BakedEaseTable, kEaseTypeCount> tables = [] {
+		std::array<BakedEaseTable, kEaseTypeCount> result;
+		for (size_t typeIndex = 0; typeIndex < kEaseTypeCount; ++typeIndex) {
+			const EaseType type = static_cast<EaseType>(typeIndex);
+			if (!IsBakedEaseType(type)) continue;
+			BakedEaseTable &table = result[typeIndex];
+			table.values.resize(kBakedEaseSegments + 1);
+			for (int i = 0; i <= kBakedEaseSegments; ++i) {
+				table.values[i] = Apply(static_cast<float>(i) / kBakedEaseSegments, type);
+			}
+			const auto measure = [&table, type](float t) {
+				table.maxError = std::max(table.maxError, std::abs(SampleBakedEaseTable(table.values, t) - Apply(t, type)));
+			};
+			constexpr int kErrorSamples = kBakedEaseSegments * kBakedEaseErrorSubdivisions;
+			for (int i = 0; i <= kErrorSamples; ++i) {
+				measure(static_cast<float>(i) / kErrorSamples);
+			}
+			// Expo・Elastic は t == 0 / 1 で値を特別扱いしており、区間の端のすぐ内側で値が跳ぶため、
+			// 等間隔の点だけでは最大誤差を見落とす。各区間の両端のすぐ内側も測る
+			for (int i = 0; i < kBakedEaseSegments; ++i) {
+				measure(std::nextafter(static_cast<float>(i) / kBakedEaseSegments, 1.0f));
+				measure(std::nextafter(static_cast<float>(i + 1) / kBakedEaseSegments, 0.0f));
+			}
+			if (table.maxError > kBakedEaseTolerance) table = BakedEaseTable{};
+		}
+		return result;
+	}();
+	return tables;
+}
+
+} // namespace
+
+float ApplyBaked(float t, EaseType type) {
+	const size_t typeIndex = static_cast<size_t>(type);
+	if (typeIndex >= kEaseTypeCount || !IsBakedEaseType(type)) return Apply(t, type);
+	const BakedEaseTable &table = GetBakedEaseTables()[typeIndex];
+	if (table.values.empty()) return Apply(t, type);
+	return SampleBakedEaseTable(table.values, t);
+}
+
+float GetBakedEaseMaxError(EaseType type) {
+	const size_t typeIndex = static_cast<size_t>(type);
+	if (typeIndex >= kEaseTypeCount) return 0.0f;
+	return GetBakedEaseTables()[typeIndex].maxError;
+}
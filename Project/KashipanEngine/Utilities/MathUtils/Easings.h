@@ -98,6 +98,14 @@ Vector4 Lerp(const Vector4 &start, const Vector4 &end, const float &t);
 /// @return イージング適用済み値 0.0～1.0
 float Apply(float t, EaseType type);
 
+/// @brief イージング関数を焼き込んだ表（1024区間の線形補間）で近似して適用する
+/// @details 三角関数・指数関数を使う Sine / Expo / Elastic 系のうち、誤差が 0.001 以内に収まる種類のみ表を持ち、
+///          それ以外の種類は Apply と同じ計算になる。表は最初の呼び出し時に全種類まとめて作成する。t は 0.0～1.0 に丸められる
+/// @return Apply との差が GetBakedEaseMaxError(type) 以内の値
+float ApplyBaked(float t, EaseType type);
+/// @brief ApplyBaked と Apply の差の最大値（表の作成時に各区間を細かく評価して測った値。表を持たない種類は 0）
+float GetBakedEaseMaxError(EaseType type);
+
 /// @brief EaseType を文字列へ変換する（"Linear"等、列挙子名そのまま。JSON保存用）
 const char *EaseTypeToString(EaseType type);
 /// @brief 文字列を EaseType へ変換する（不明な文字列の場合は Linear）
@@ -1,8 +1,20 @@
 #include "FractalNoise.h"
+#include <algorithm>
 #include <cmath>
 
+#include "Utilities/Plugin/Plugins.h"
+
 namespace KashipanEngine {
 
+namespace {
+
+/// @brief オクターブをまとめて重ねる点数（作業用の配列がL1キャッシュに収まる大きさ）
+constexpr size_t kOctaveBlockSize = 256;
+/// @brief これ未満の点数はジョブシステムへ分割せず呼び出し元スレッドで計算する
+constexpr size_t kParallelThreshold = 1024;
+
+} // namespace
+
 FractalNoise::FractalNoise(uint32_t seed)
     : pn_(seed) {
 }
@@ -32,4 +44,118 @@ float FractalNoise::GetValue(float x, int octaves, float lacunarity, float persi
     return GetValue(x, 0.0f, 0.0f, octaves, lacunarity, persistence);
 }
 
+void FractalNoise::EvaluateBlock(const float *xs, const float *ys, const float *zs, float *out, size_t count,
+    int octaves, float lacunarity, float persistence) const {
+    float scaledX[kOctaveBlockSize];
+    float scaledY[kOctaveBlockSize];
+    float scaledZ[kOctaveBlockSize];
+    float octaveValues[kOctaveBlockSize];
+    float sums[kOctaveBlockSize];
+
+    for (size_t blockBegin = 0; blockBegin < count; blockBegin += kOctaveBlockSize) {
+        const size_t blockSize = std::min(kOctaveBlockSize, count - blockBegin);
+        std::fill(sums, sums + blockSize, 0.0f);
+
+        // GetValue と同じ順に、振幅・周波数をオクターブごとに更新しながら足し込む
+        float amplitude = 1.0f;
+        float frequency = 1.0f;
+        float maxAmp = 0.0f;
+        for (int octave = 0; octave < octaves; ++octave) {
+            for (size_t i = 0; i < blockSize; ++i) {
+                const size_t index = blockBegin + i;
+                scaledX[i] = xs[index] * frequency;
+                scaledY[i] = (ys ? ys[index] : 0.0f) * frequency;
+                scaledZ[i] = (zs ? zs[index] : 0.0f) * frequency;
+            }
+            pn_.GetValues({ scaledX, blockSize }, { scaledY, blockSize }, { scaledZ, blockSize }, { octaveValues, blockSize });
+            for (size_t i = 0; i < blockSize; ++i) {
+                sums[i] += amplitude * octaveValues[i];
+            }
+            maxAmp += amplitude;
+            amplitude *= persistence;
+            frequency *= lacunarity;
+        }
+
+        for (size_t i = 0; i < blockSize; ++i) {
+            out[blockBegin + i] = (maxAmp == 0.0f) ? 0.0f : sums[i] / maxAmp;
+        }
+    }
+}
+
+void FractalNoise::EvaluateRow(const float *xs, float y, float z, float *out, size_t count,
+    int octaves, float lacunarity, float persistence) const {
+    float scaledX[kOctaveBlockSize];
+    float octaveValues[kOctaveBlockSize];
+    float sums[kOctaveBlockSize];
+
+    for (size_t blockBegin = 0; blockBegin < count; blockBegin += kOctaveBlockSize) {
+        const size_t blockSize = std::min(kOctaveBlockSize, count - blockBegin);
+        std::fill(sums, sums + blockSize, 0.0f);
+
+        // EvaluateBlock と同じ順に重ねる（y・z は行の全点で同じなので、オクターブごとに1度だけ掛ける）
+        float amplitude = 1.0f;
+        float frequency = 1.0f;
+        float maxAmp = 0.0f;
+        for (int octave = 0; octave < octaves; ++octave) {
+            for (size_t i = 0; i < blockSize; ++i) {
+                scaledX[i] = xs[blockBegin + i] * frequency;
+            }
+            pn_.EvaluateRow(scaledX, y * frequency, z * frequency, octaveValues, blockSize);
+            for (size_t i = 0; i < blockSize; ++i) {
+                sums[i] += amplitude * octaveValues[i];
+            }
+            maxAmp += amplitude;
+            amplitude *= persistence;
+            frequency *= lacunarity;
+        }
+
+        for (size_t i = 0; i < blockSize; ++i) {
+            out[blockBegin + i] = (maxAmp == 0.0f) ? 0.0f : sums[i] / maxAmp;
+        }
+    }
+}
+
+void FractalNoise::GetValues(std::span<const float> xs, std::span<const float> ys, std::span<const float> zs, std::span<float> out,
+    int octaves, float lacunarity, float persistence) const {
+    // 空でない入力と出力のうち最も短いものに合わせ、要素数が食い違っていても範囲外を読み書きしない
+    size_t count = std::min(xs.size(), out.size());
+    if (!ys.empty()) count = std::min(count, ys.size());
+    if (!zs.empty()) count = std::min(count, zs.size());
+    const float *y = ys.empty() ? nullptr : ys.data();
+    const float *z = zs.empty() ? nullptr : zs.data();
+    const auto evaluateRange = [&](size_t begin, size_t end) {
+        EvaluateBlock(xs.data() + begin, y ? y + begin : nullptr, z ? z + begin : nullptr, out.data() + begin, end - begin,
+            octaves, lacunarity, persistence);
+    };
+    if (count < kParallelThreshold) {
+        evaluateRange(0, count);
+        return;
+    }
+    Plugin::ParallelFor(count, kOctaveBlockSize, evaluateRange);
+}
+
+void FractalNoise::FillGrid(const NoiseGrid &grid, std::span<float> out, int octaves, float lacunarity, float persistence) const {
+    const size_t rowCount = static_cast<size_t>(grid.sizeY) * grid.sizeZ;
+    if (grid.sizeX == 0 || rowCount == 0 || out.size() < grid.GetCount()) return;
+
+    const auto evaluateRows = [&](size_t beginRow, size_t endRow) {
+        std::vector<float> xs(grid.sizeX);
+        for (uint32_t x = 0; x < grid.sizeX; ++x) {
+            xs[x] = grid.originX + static_cast<float>(x) * grid.stepX;
+        }
+        for (size_t row = beginRow; row < endRow; ++row) {
+            const uint32_t y = static_cast<uint32_t>(row % grid.sizeY);
+            const uint32_t z = static_cast<uint32_t>(row / grid.sizeY);
+            EvaluateRow(xs.data(), grid.originY + static_cast<float>(y) * grid.stepY,
+                grid.originZ + static_cast<float>(z) * grid.stepZ, out.data() + row * grid.sizeX, grid.sizeX,
+                octaves, lacunarity, persistence);
+        }
+    };
+    if (grid.GetCount() < kParallelThreshold) {
+        evaluateRows(0, rowCount);
+        return;
+    }
+    Plugin::ParallelFor(rowCount, std::max<size_t>(1, kOctaveBlockSize / grid.sizeX), evaluateRows);
+}
+
 } // namespace KashipanEngine
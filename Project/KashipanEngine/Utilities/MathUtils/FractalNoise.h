@@ -34,8 +34,28 @@ public:
     /// @param persistence 各オクターブの振幅倍率（デフォルトは0.5f）
     /// @return フラクタルノイズの値（-1.0〜1.0）
     float GetValue(float x, float y, float z, int octaves = 4, float lacunarity = 2.0f, float persistence = 0.5f) const;
-    
+
+    /// @brief 複数の座標のフラクタルノイズ値をまとめて求める（GetValue とビット単位で同じ値になる）
+    /// @details 点をブロックに分け、ブロックごとに全オクターブを PerlinNoise::GetValues で重ねる。
+    ///          点数が多い場合はブロック単位でジョブシステムへ分割する
+    /// @param ys,zs 空の場合は 0 として扱う（1次元・2次元用）。空でなければ xs と同じ要素数であること
+    /// @param out xs と同じ要素数であること（要素数が食い違う場合は、空でない入力と out のうち最も短い要素数だけ計算する）
+    void GetValues(std::span<const float> xs, std::span<const float> ys, std::span<const float> zs, std::span<float> out,
+        int octaves = 4, float lacunarity = 2.0f, float persistence = 0.5f) const;
+
+    /// @brief 格子状に並んだ点のフラクタルノイズ値をまとめて求める（行単位でジョブシステムへ分割する）
+    /// @param out grid.GetCount() 要素以上であること
+    void FillGrid(const NoiseGrid &grid, std::span<float> out,
+        int octaves = 4, float lacunarity = 2.0f, float persistence = 0.5f) const;
+
 private:
+    /// @brief 呼び出し元スレッドで count 点を計算する（ys・zs が nullptr の場合は 0 として扱う）
+    void EvaluateBlock(const float *xs, const float *ys, const float *zs, float *out, size_t count,
+        int octaves, float lacunarity, float persistence) const;
+    /// @brief y・z が一定の count 点（格子の1行）を呼び出し元スレッドで計算する（EvaluateBlock と同じ値）
+    void EvaluateRow(const float *xs, float y, float z, float *out, size_t count,
+        int octaves, float lacunarity, float persistence) const;
+
     PerlinNoise pn_; 
 };
 
@@ -1,6 +1,8 @@
 #include "Matrix4x4.h"
 #include "Math/Matrix4x4.h"
+#include "Math/Quaternion.h"
 #include "Math/Vector3.h"
+#include "Utilities/MathUtils/Vector3.h"
 #include <cmath>
 
 namespace KashipanEngine {
@@ -44,7 +46,51 @@ float Matrix4x4Determinant(const Matrix4x4 &matrix) noexcept {
     return (matrix.m[0][0] * c00) + (matrix.m[0][1] * c01) + (matrix.m[0][2] * c02) + (matrix.m[0][3] * c03);
 }
 
-Matrix4x4 Matrix4x4Inverse(const Matrix4x4 &matrix) {
+namespace {
+
+#if defined(KASHIPAN_MATH_SIMD_SSE)
+using MathSimd::MulAdd;
+using MathSimd::Splat;
+
+// 2x2行列 (m00, m01, m10, m11) を1レジスタに詰めて扱う補助関数（逆行列のブロック分割用）
+
+/// @brief A * B
+inline __m128 Mat2Mul(__m128 a, __m128 b) noexcept {
+    return _mm_add_ps(
+        _mm_mul_ps(a, _mm_shuffle_ps(b, b, KASHIPAN_MATH_SHUFFLE_MASK(0, 3, 0, 3))),
+        _mm_mul_ps(_mm_shuffle_ps(a, a, KASHIPAN_MATH_SHUFFLE_MASK(1, 0, 3, 2)), _mm_shuffle_ps(b, b, KASHIPAN_MATH_SHUFFLE_MASK(2, 1, 2, 1))));
+}
+/// @brief adj(A) * B
+inline __m128 Mat2AdjMul(__m128 a, __m128 b) noexcept {
+    return _mm_sub_ps(
+        _mm_mul_ps(_mm_shuffle_ps(a, a, KASHIPAN_MATH_SHUFFLE_MASK(3, 3, 0, 0)), b),
+        _mm_mul_ps(_mm_shuffle_ps(a, a, KASHIPAN_MATH_SHUFFLE_MASK(1, 1, 2, 2)), _mm_shuffle_ps(b, b, KASHIPAN_MATH_SHUFFLE_MASK(2, 3, 0, 1))));
+}
+/// @brief A * adj(B)
+inline __m128 Mat2MulAdj(__m128 a, __m128 b) noexcept {
+    return _mm_sub_ps(
+        _mm_mul_ps(a, _mm_shuffle_ps(b, b, KASHIPAN_MATH_SHUFFLE_MASK(3, 0, 3, 0))),
+        _mm_mul_ps(_mm_shuffle_ps(a, a, KASHIPAN_MATH_SHUFFLE_MASK(1, 0, 3, 2)), _mm_shuffle_ps(b, b, KASHIPAN_MATH_SHUFFLE_MASK(2, 1, 2, 1))));
+}
+
+/// @brief 4要素の総和を全レーンへ
+inline __m128 HorizontalSum(__m128 v) noexcept {
+    const __m128 swapped = _mm_shuffle_ps(v, v, KASHIPAN_MATH_SHUFFLE_MASK(1, 0, 3, 2));
+    const __m128 pairSum = _mm_add_ps(v, swapped);
+    return _mm_add_ps(pairSum, _mm_shuffle_ps(pairSum, pairSum, KASHIPAN_MATH_SHUFFLE_MASK(2, 3, 0, 1)));
+}
+
+/// @brief a × b（w成分は a.w * b.w - a.w * b.w = 0）
+inline __m128 Cross(__m128 a, __m128 b) noexcept {
+    const __m128 aYZX = _mm_shuffle_ps(a, a, KASHIPAN_MATH_SHUFFLE_MASK(1, 2, 0, 3));
+    const __m128 bYZX = _mm_shuffle_ps(b, b, KASHIPAN_MATH_SHUFFLE_MASK(1, 2, 0, 3));
+    const __m128 c = _mm_sub_ps(_mm_mul_ps(a, bYZX), _mm_mul_ps(aYZX, b));
+    return _mm_shuffle_ps(c, c, KASHIPAN_MATH_SHUFFLE_MASK(1, 2, 0, 3));
+}
+#endif
+
+/// @brief 余因子展開による逆行列（SIMDが使えない環境用）
+Matrix4x4 InverseScalar(const Matrix4x4 &matrix) noexcept {
     float c00 = Matrix4x4::Matrix3x3(
         matrix.m[1][1], matrix.m[1][2], matrix.m[1][3],
         matrix.m[2][1], matrix.m[2][2], matrix.m[2][3],
@@ -123,6 +169,203 @@ Matrix4x4 Matrix4x4Inverse(const Matrix4x4 &matrix) {
     );
 }
 
+} // namespace
+
+Matrix4x4 Matrix4x4Inverse(const Matrix4x4 &matrix) {
+#if defined(KASHIPAN_MATH_SIMD_SSE)
+    // 2x2のブロックに分割して逆行列を求める
+    //   M = | A B |   M^-1 = 1/|M| * | X Y |
+    //       | C D |                  | Z W |
+    const __m128 row0 = _mm_loadu_ps(matrix.m[0]);
+    const __m128 row1 = _mm_loadu_ps(matrix.m[1]);
+    const __m128 row2 = _mm_loadu_ps(matrix.m[2]);
+    const __m128 row3 = _mm_loadu_ps(matrix.m[3]);
+    const __m128 a = _mm_movelh_ps(row0, row1);
+    const __m128 b = _mm_movehl_ps(row1, row0);
+    const __m128 c = _mm_movelh_ps(row2, row3);
+    const __m128 d = _mm_movehl_ps(row3, row2);
+
+    // (|A|, |B|, |C|, |D|)
+    const __m128 detSub = _mm_sub_ps(
+        _mm_mul_ps(_mm_shuffle_ps(row0, row2, KASHIPAN_MATH_SHUFFLE_MASK(0, 2, 0, 2)), _mm_shuffle_ps(row1, row3, KASHIPAN_MATH_SHUFFLE_MASK(1, 3, 1, 3))),
+        _mm_mul_ps(_mm_shuffle_ps(row0, row2, KASHIPAN_MATH_SHUFFLE_MASK(1, 3, 1, 3)), _mm_shuffle_ps(row1, row3, KASHIPAN_MATH_SHUFFLE_MASK(0, 2, 0, 2))));
+    const __m128 detA = Splat<0>(detSub);
+    const __m128 detB = Splat<1>(detSub);
+    const __m128 detC = Splat<2>(detSub);
+    const __m128 detD = Splat<3>(detSub);
+
+    const __m128 dc = Mat2AdjMul(d, c);
+    const __m128 ab = Mat2AdjMul(a, b);
+    __m128 x = _mm_sub_ps(_mm_mul_ps(detD, a), Mat2Mul(b, dc));
+    __m128 w = _mm_sub_ps(_mm_mul_ps(detA, d), Mat2Mul(c, ab));
+    __m128 y = _mm_sub_ps(_mm_mul_ps(detB, c), Mat2MulAdj(d, ab));
+    __m128 z = _mm_sub_ps(_mm_mul_ps(detC, b), Mat2MulAdj(a, dc));
+
+    // |M| = |A||D| + |B||C| - tr(adj(A)B adj(D)C)
+    __m128 detM = _mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC));
+    detM = _mm_sub_ps(detM, HorizontalSum(_mm_mul_ps(ab, _mm_shuffle_ps(dc, dc, KASHIPAN_MATH_SHUFFLE_MASK(0, 2, 1, 3)))));
+
+    // 各ブロックは随伴行列の形で求まっているため、符号と並びを格納時に戻す
+    const __m128 rcpDetM = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), detM);
+    x = _mm_mul_ps(x, rcpDetM);
+    y = _mm_mul_ps(y, rcpDetM);
+    z = _mm_mul_ps(z, rcpDetM);
+    w = _mm_mul_ps(w, rcpDetM);
+
+    Matrix4x4 result;
+    _mm_storeu_ps(result.m[0], _mm_shuffle_ps(x, y, KASHIPAN_MATH_SHUFFLE_MASK(3, 1, 3, 1)));
+    _mm_storeu_ps(result.m[1], _mm_shuffle_ps(x, y, KASHIPAN_MATH_SHUFFLE_MASK(2, 0, 2, 0)));
+    _mm_storeu_ps(result.m[2], _mm_shuffle_ps(z, w, KASHIPAN_MATH_SHUFFLE_MASK(3, 1, 3, 1)));
+    _mm_storeu_ps(result.m[3], _mm_shuffle_ps(z, w, KASHIPAN_MATH_SHUFFLE_MASK(2, 0, 2, 0)));
+    return result;
+#else
+    return InverseScalar(matrix);
+#endif
+}
+
+Matrix4x4 Matrix4x4InverseAffine(const Matrix4x4 &matrix) noexcept {
+    // 行ベクトル規約のアフィン行列 | R 0 | の逆行列は | R^-1       0 |
+    //                               | t 1 |            | -t R^-1    1 |
+    // R^-1 は各行どうしの外積を並べて転置し、行列式で割れば求まる
+#if defined(KASHIPAN_MATH_SIMD_SSE)
+    const __m128 r0 = _mm_loadu_ps(matrix.m[0]);
+    const __m128 r1 = _mm_loadu_ps(matrix.m[1]);
+    const __m128 r2 = _mm_loadu_ps(matrix.m[2]);
+    __m128 c0 = Cross(r1, r2);
+    __m128 c1 = Cross(r2, r0);
+    __m128 c2 = Cross(r0, r1);
+    __m128 c3 = _mm_setzero_ps();
+    const __m128 rcpDet = _mm_div_ps(_mm_set1_ps(1.0f), HorizontalSum(_mm_mul_ps(r0, c0)));
+    _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+    const __m128 inv0 = _mm_mul_ps(c0, rcpDet);
+    const __m128 inv1 = _mm_mul_ps(c1, rcpDet);
+    const __m128 inv2 = _mm_mul_ps(c2, rcpDet);
+
+    const __m128 t = _mm_loadu_ps(matrix.m[3]);
+    __m128 invT = _mm_mul_ps(Splat<0>(t), inv0);
+    invT = MulAdd(Splat<1>(t), inv1, invT);
+    invT = MulAdd(Splat<2>(t), inv2, invT);
+    invT = _mm_sub_ps(_mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f), invT);
+
+    Matrix4x4 result;
+    _mm_storeu_ps(result.m[0], inv0);
+    _mm_storeu_ps(result.m[1], inv1);
+    _mm_storeu_ps(result.m[2], inv2);
+    _mm_storeu_ps(result.m[3], invT);
+    return result;
+#else
+    const auto &m = matrix.m;
+    const float c00 = m[1][1] * m[2][2] - m[1][2] * m[2][1];
+    const float c01 = m[1][2] * m[2][0] - m[1][0] * m[2][2];
+    const float c02 = m[1][0] * m[2][1] - m[1][1] * m[2][0];
+    const float c10 = m[2][1] * m[0][2] - m[2][2] * m[0][1];
+    const float c11 = m[2][2] * m[0][0] - m[2][0] * m[0][2];
+    const float c12 = m[2][0] * m[0][1] - m[2][1] * m[0][0];
+    const float c20 = m[0][1] * m[1][2] - m[0][2] * m[1][1];
+    const float c21 = m[0][2] * m[1][0] - m[0][0] * m[1][2];
+    const float c22 = m[0][0] * m[1][1] - m[0][1] * m[1][0];
+    const float rcpDet = 1.0f / (m[0][0] * c00 + m[0][1] * c01 + m[0][2] * c02);
+    Matrix4x4 result(
+        c00 * rcpDet, c10 * rcpDet, c20 * rcpDet, 0.0f,
+        c01 * rcpDet, c11 * rcpDet, c21 * rcpDet, 0.0f,
+        c02 * rcpDet, c12 * rcpDet, c22 * rcpDet, 0.0f,
+        0.0f, 0.0f, 0.0f, 1.0f);
+    for (int j = 0; j < 3; ++j) {
+        result.m[3][j] = -(m[3][0] * result.m[0][j] + m[3][1] * result.m[1][j] + m[3][2] * result.m[2][j]);
+    }
+    return result;
+#endif
+}
+
+Matrix4x4 Matrix4x4ComposeTRS(const Vector3 &scale, const Quaternion &rotate, const Vector3 &translate) noexcept {
+    // scale * rotate * translate を行列積を使わずに組み立てる（回転行列の各行を拡大率倍し、4行目に平行移動を置く）
+#if defined(KASHIPAN_MATH_SIMD_SSE)
+    __m128 row0, row1, row2;
+    MathSimd::QuaternionToRows(rotate.x, rotate.y, rotate.z, rotate.w, row0, row1, row2);
+    Matrix4x4 result;
+    _mm_storeu_ps(result.m[0], _mm_mul_ps(row0, _mm_set1_ps(scale.x)));
+    _mm_storeu_ps(result.m[1], _mm_mul_ps(row1, _mm_set1_ps(scale.y)));
+    _mm_storeu_ps(result.m[2], _mm_mul_ps(row2, _mm_set1_ps(scale.z)));
+    _mm_storeu_ps(result.m[3], _mm_setr_ps(translate.x, translate.y, translate.z, 1.0f));
+    return result;
+#else
+    Matrix4x4 result = rotate.MakeRotateMatrix();
+    const float scales[3] = { scale.x, scale.y, scale.z };
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            result.m[i][j] *= scales[i];
+        }
+    }
+    result.m[3][0] = translate.x;
+    result.m[3][1] = translate.y;
+    result.m[3][2] = translate.z;
+    return result;
+#endif
+}
+
+void Matrix4x4MultiplyArray(const Matrix4x4 *lhs, const Matrix4x4 *rhs, Matrix4x4 *out, std::size_t count) noexcept {
+    for (std::size_t i = 0; i < count; ++i) {
+        out[i] = lhs[i] * rhs[i];
+    }
+}
+
+void Matrix4x4MultiplyArray(const Matrix4x4 *lhs, const Matrix4x4 &rhs, Matrix4x4 *out, std::size_t count) noexcept {
+#if defined(KASHIPAN_MATH_SIMD_SSE)
+    // 右辺が共通なので、4行をレジスタに載せたまま全要素を処理する
+    const __m128 b0 = _mm_loadu_ps(rhs.m[0]);
+    const __m128 b1 = _mm_loadu_ps(rhs.m[1]);
+    const __m128 b2 = _mm_loadu_ps(rhs.m[2]);
+    const __m128 b3 = _mm_loadu_ps(rhs.m[3]);
+    for (std::size_t i = 0; i < count; ++i) {
+        const __m128 r0 = MathSimd::RowTransform(_mm_loadu_ps(lhs[i].m[0]), b0, b1, b2, b3);
+        const __m128 r1 = MathSimd::RowTransform(_mm_loadu_ps(lhs[i].m[1]), b0, b1, b2, b3);
+        const __m128 r2 = MathSimd::RowTransform(_mm_loadu_ps(lhs[i].m[2]), b0, b1, b2, b3);
+        const __m128 r3 = MathSimd::RowTransform(_mm_loadu_ps(lhs[i].m[3]), b0, b1, b2, b3);
+        _mm_storeu_ps(out[i].m[0], r0);
+        _mm_storeu_ps(out[i].m[1], r1);
+        _mm_storeu_ps(out[i].m[2], r2);
+        _mm_storeu_ps(out[i].m[3], r3);
+    }
+#else
+    const Matrix4x4 shared = rhs;
+    for (std::size_t i = 0; i < count; ++i) {
+        out[i] = lhs[i] * shared;
+    }
+#endif
+}
+
+void Matrix4x4ComposeTRSArray(const Vector3 *scales, const Quaternion *rotates, const Vector3 *translates, Matrix4x4 *out, std::size_t count) noexcept {
+    for (std::size_t i = 0; i < count; ++i) {
+        out[i] = Matrix4x4ComposeTRS(scales[i], rotates[i], translates[i]);
+    }
+}
+
+void Matrix4x4TransformPoints(const Matrix4x4 &matrix, const Vector3 *points, Vector3 *out, std::size_t count) noexcept {
+#if defined(KASHIPAN_MATH_SIMD_SSE)
+    const __m128 m0 = _mm_loadu_ps(matrix.m[0]);
+    const __m128 m1 = _mm_loadu_ps(matrix.m[1]);
+    const __m128 m2 = _mm_loadu_ps(matrix.m[2]);
+    const __m128 m3 = _mm_loadu_ps(matrix.m[3]);
+    for (std::size_t i = 0; i < count; ++i) {
+        __m128 v = MulAdd(_mm_set1_ps(points[i].x), m0, m3);
+        v = MulAdd(_mm_set1_ps(points[i].y), m1, v);
+        v = MulAdd(_mm_set1_ps(points[i].z), m2, v);
+        alignas(16) float result[4];
+        _mm_store_ps(result, v);
+        // Transform() と同じく、w == 0 の場合は原点を返す
+        if (result[3] == 0.0f) {
+            out[i] = Vector3(0.0f);
+            continue;
+        }
+        out[i] = Vector3(result[0] / result[3], result[1] / result[3], result[2] / result[3]);
+    }
+#else
+    for (std::size_t i = 0; i < count; ++i) {
+        out[i] = Transform(points[i], matrix);
+    }
+#endif
+}
+
 Matrix4x4 Matrix4x4MakeTranslate(const Vector3 &translate) noexcept {
     return Matrix4x4(
         1.0f, 0.0f, 0.0f, 0.0f,
@@ -1,7 +1,9 @@
 #pragma once
+#include <cstddef>
 
 struct Matrix4x4;
 struct Vector3;
+struct Quaternion;
 
 namespace KashipanEngine {
 
@@ -26,6 +28,34 @@ float Matrix4x4Determinant(const Matrix4x4 &matrix) noexcept;
 /// @return 逆行列
 Matrix4x4 Matrix4x4Inverse(const Matrix4x4 &matrix);
 
+/// @brief Matrix4x4のアフィン変換行列（4列目が (0, 0, 0, 1)）の逆行列計算
+/// @param matrix 行列
+/// @return 逆行列
+Matrix4x4 Matrix4x4InverseAffine(const Matrix4x4 &matrix) noexcept;
+
+/// @brief 拡大縮小・回転・平行移動からアフィン行列を生成（scale * rotate * translate と同じ結果を行列積なしで求める）
+/// @param scale 拡大縮小ベクトル
+/// @param rotate 回転（単位クォータニオン）
+/// @param translate 平行移動ベクトル
+/// @return アフィン行列
+Matrix4x4 Matrix4x4ComposeTRS(const Vector3 &scale, const Quaternion &rotate, const Vector3 &translate) noexcept;
+
+//==================================================
+// 配列の一括処理
+//==================================================
+
+/// @brief 行列の配列どうしの積 out[i] = lhs[i] * rhs[i]
+void Matrix4x4MultiplyArray(const Matrix4x4 *lhs, const Matrix4x4 *rhs, Matrix4x4 *out, std::size_t count) noexcept;
+
+/// @brief 行列の配列と共通の行列の積 out[i] = lhs[i] * rhs（ワールド行列の配列にビュープロジェクション行列を掛ける等）
+void Matrix4x4MultiplyArray(const Matrix4x4 *lhs, const Matrix4x4 &rhs, Matrix4x4 *out, std::size_t count) noexcept;
+
+/// @brief 拡大縮小・回転・平行移動の配列からアフィン行列を一括生成 out[i] = ComposeTRS(scales[i], rotates[i], translates[i])
+void Matrix4x4ComposeTRSArray(const Vector3 *scales, const Quaternion *rotates, const Vector3 *translates, Matrix4x4 *out, std::size_t count) noexcept;
+
+/// @brief 座標の配列を一括変換する（1要素ごとの結果は Transform(points[i], matrix) と同じ）
+void Matrix4x4TransformPoints(const Matrix4x4 &matrix, const Vector3 *points, Vector3 *out, std::size_t count) noexcept;
+
 /// @brief Matrix4x4の平行移動行列生成
 /// @param translate 平行移動ベクトル
 /// @return 平行移動行列
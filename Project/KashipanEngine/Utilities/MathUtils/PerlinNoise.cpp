@@ -4,8 +4,124 @@
 #include <numeric>
 #include <cmath>
 
+#include "Math/MathSimd.h"
+#include "Utilities/Plugin/Plugins.h"
+
 namespace KashipanEngine {
 
+namespace {
+
+/// @brief これ未満の点数はジョブシステムへ分割せず呼び出し元スレッドで計算する
+constexpr size_t kParallelThreshold = 4096;
+/// @brief GetValues を並列化する際の1ジョブあたりの点数
+constexpr size_t kParallelGrainSize = 1024;
+
+#if defined(KASHIPAN_MATH_SIMD_SSE)
+// スカラー版とビット単位で同じ結果にするため、積和はFMAにせず乗算・加算の順も揃える
+
+inline __m128 Select4(__m128 mask, __m128 a, __m128 b) {
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+/// @brief PerlinNoise::FastFloor の4点版
+inline __m128i FastFloor4(__m128 x) {
+    const __m128i xi = _mm_cvttps_epi32(x);
+    // x < xi のレーンは比較結果が全ビット1（-1）なので、足すと1引いたことになる
+    return _mm_add_epi32(xi, _mm_castps_si128(_mm_cmplt_ps(x, _mm_cvtepi32_ps(xi))));
+}
+
+/// @brief PerlinNoise::Fade の4点版
+inline __m128 Fade4(__m128 t) {
+    const __m128 inner = _mm_add_ps(_mm_mul_ps(t, _mm_sub_ps(_mm_mul_ps(t, _mm_set1_ps(6.0f)), _mm_set1_ps(15.0f))), _mm_set1_ps(10.0f));
+    return _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(t, t), t), inner);
+}
+
+/// @brief PerlinNoise::Lerp の4点版
+inline __m128 Lerp4(__m128 a, __m128 b, __m128 t) {
+    return _mm_add_ps(a, _mm_mul_ps(t, _mm_sub_ps(b, a)));
+}
+
+/// @brief PerlinNoise::Grad の4点版（分岐は比較マスクでの選択、符号反転は符号ビットの反転で行う）
+inline __m128 Grad4(__m128i hash, __m128 x, __m128 y, __m128 z) {
+    const __m128i h = _mm_and_si128(hash, _mm_set1_epi32(15));
+    const __m128 hLess8 = _mm_castsi128_ps(_mm_cmplt_epi32(h, _mm_set1_epi32(8)));
+    const __m128 hLess4 = _mm_castsi128_ps(_mm_cmplt_epi32(h, _mm_set1_epi32(4)));
+    const __m128 h12or14 = _mm_castsi128_ps(_mm_or_si128(
+        _mm_cmpeq_epi32(h, _mm_set1_epi32(12)), _mm_cmpeq_epi32(h, _mm_set1_epi32(14))));
+    const __m128 u = Select4(hLess8, x, y);
+    const __m128 v = Select4(hLess4, y, Select4(h12or14, x, z));
+    const __m128 signU = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(1)), 31));
+    const __m128 signV = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(2)), 30));
+    return _mm_add_ps(_mm_xor_ps(u, signU), _mm_xor_ps(v, signV));
+}
+
+/// @brief 格子のセル（X, Y, Z は 0〜255）の8頂点のハッシュ [AA, BA, AB, BB, AA+1, BA+1, AB+1, BB+1] を求める
+inline void CellHashes(const int *perm, int X, int Y, int Z, int *hashes) {
+    const int A  = perm[X] + Y;
+    const int AA = perm[A] + Z;
+    const int AB = perm[A + 1] + Z;
+    const int B  = perm[X + 1] + Y;
+    const int BA = perm[B] + Z;
+    const int BB = perm[B + 1] + Z;
+    hashes[0] = perm[AA];
+    hashes[1] = perm[BA];
+    hashes[2] = perm[AB];
+    hashes[3] = perm[BB];
+    hashes[4] = perm[AA + 1];
+    hashes[5] = perm[BA + 1];
+    hashes[6] = perm[AB + 1];
+    hashes[7] = perm[BB + 1];
+}
+
+/// @brief セルの8頂点のハッシュとセル内の位置から、4点分の勾配を補間する（PerlinNoise::GetValue の後半）
+inline __m128 Blend4(const __m128i *hashes, __m128 xf, __m128 yf, __m128 zf, __m128 u, __m128 v, __m128 w) {
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 xf1 = _mm_sub_ps(xf, one);
+    const __m128 yf1 = _mm_sub_ps(yf, one);
+    const __m128 zf1 = _mm_sub_ps(zf, one);
+
+    __m128 x1 = Lerp4(Grad4(hashes[0], xf, yf, zf), Grad4(hashes[1], xf1, yf, zf), u);
+    __m128 x2 = Lerp4(Grad4(hashes[2], xf, yf1, zf), Grad4(hashes[3], xf1, yf1, zf), u);
+    const __m128 y1 = Lerp4(x1, x2, v);
+
+    x1 = Lerp4(Grad4(hashes[4], xf, yf, zf1), Grad4(hashes[5], xf1, yf, zf1), u);
+    x2 = Lerp4(Grad4(hashes[6], xf, yf1, zf1), Grad4(hashes[7], xf1, yf1, zf1), u);
+    const __m128 y2 = Lerp4(x1, x2, v);
+
+    return Lerp4(y1, y2, w);
+}
+
+/// @brief PerlinNoise::GetValue(x, y, z) の4点版
+/// @details 順列表の参照だけはレーンごとに行い、勾配・補間は4点まとめて計算する
+inline __m128 Noise4(const int *perm, __m128 x, __m128 y, __m128 z) {
+    const __m128i floorX = FastFloor4(x);
+    const __m128i floorY = FastFloor4(y);
+    const __m128i floorZ = FastFloor4(z);
+    const __m128i mask = _mm_set1_epi32(255);
+
+    alignas(16) int X[4], Y[4], Z[4];
+    _mm_store_si128(reinterpret_cast<__m128i *>(X), _mm_and_si128(floorX, mask));
+    _mm_store_si128(reinterpret_cast<__m128i *>(Y), _mm_and_si128(floorY, mask));
+    _mm_store_si128(reinterpret_cast<__m128i *>(Z), _mm_and_si128(floorZ, mask));
+
+    alignas(16) int laneHashes[4][8];
+    for (int lane = 0; lane < 4; ++lane) {
+        CellHashes(perm, X[lane], Y[lane], Z[lane], laneHashes[lane]);
+    }
+    __m128i hashes[8];
+    for (int i = 0; i < 8; ++i) {
+        hashes[i] = _mm_setr_epi32(laneHashes[0][i], laneHashes[1][i], laneHashes[2][i], laneHashes[3][i]);
+    }
+
+    const __m128 xf = _mm_sub_ps(x, _mm_cvtepi32_ps(floorX));
+    const __m128 yf = _mm_sub_ps(y, _mm_cvtepi32_ps(floorY));
+    const __m128 zf = _mm_sub_ps(z, _mm_cvtepi32_ps(floorZ));
+    return Blend4(hashes, xf, yf, zf, Fade4(xf), Fade4(yf), Fade4(zf));
+}
+#endif
+
+} // namespace
+
 PerlinNoise::PerlinNoise(uint32_t seed) {
     perm_.resize(512);
     std::vector<int> p(256);
@@ -82,4 +198,116 @@ float PerlinNoise::GetValue(float x, float y, float z) const {
     return result;
 }
 
+void PerlinNoise::EvaluateBlock(const float *xs, const float *ys, const float *zs, float *out, size_t count) const {
+    size_t i = 0;
+#if defined(KASHIPAN_MATH_SIMD_SSE)
+    const int *perm = perm_.data();
+    const __m128 zero = _mm_setzero_ps();
+    for (; i + 4 <= count; i += 4) {
+        const __m128 y = ys ? _mm_loadu_ps(ys + i) : zero;
+        const __m128 z = zs ? _mm_loadu_ps(zs + i) : zero;
+        _mm_storeu_ps(out + i, Noise4(perm, _mm_loadu_ps(xs + i), y, z));
+    }
+#endif
+    for (; i < count; ++i) {
+        out[i] = GetValue(xs[i], ys ? ys[i] : 0.0f, zs ? zs[i] : 0.0f);
+    }
+}
+
+void PerlinNoise::EvaluateRow(const float *xs, float y, float z, float *out, size_t count) const {
+    size_t i = 0;
+#if defined(KASHIPAN_MATH_SIMD_SSE)
+    const int *perm = perm_.data();
+    // y・z に関する値は行の全点で同じなので、Noise4 と同じ式で1度だけ求める
+    const int floorY = FastFloor(y);
+    const int floorZ = FastFloor(z);
+    const int Y = floorY & 255;
+    const int Z = floorZ & 255;
+    const __m128 yf = _mm_set1_ps(y - static_cast<float>(floorY));
+    const __m128 zf = _mm_set1_ps(z - static_cast<float>(floorZ));
+    const __m128 v = Fade4(yf);
+    const __m128 w = Fade4(zf);
+    const __m128i mask = _mm_set1_epi32(255);
+
+    // 格子のセル（X）が変わった時だけ順列表を引き、同じセルの点ではハッシュを使い回す
+    int cachedX = -1;
+    alignas(16) int cachedHashes[8];
+    const auto hashesOf = [&](int X) -> const int * {
+        if (X != cachedX) {
+            CellHashes(perm, X, Y, Z, cachedHashes);
+            cachedX = X;
+        }
+        return cachedHashes;
+    };
+
+    for (; i + 4 <= count; i += 4) {
+        const __m128 x = _mm_loadu_ps(xs + i);
+        const __m128i floorX = FastFloor4(x);
+        alignas(16) int X[4];
+        _mm_store_si128(reinterpret_cast<__m128i *>(X), _mm_and_si128(floorX, mask));
+
+        __m128i hashes[8];
+        if (X[0] == X[1] && X[0] == X[2] && X[0] == X[3]) {
+            // 4点とも同じセル（格子の間隔がセルより十分小さい場合のほとんど）
+            const int *cell = hashesOf(X[0]);
+            for (int h = 0; h < 8; ++h) hashes[h] = _mm_set1_epi32(cell[h]);
+        } else {
+            alignas(16) int laneHashes[4][8];
+            for (int lane = 0; lane < 4; ++lane) {
+                std::copy_n(hashesOf(X[lane]), 8, laneHashes[lane]);
+            }
+            for (int h = 0; h < 8; ++h) {
+                hashes[h] = _mm_setr_epi32(laneHashes[0][h], laneHashes[1][h], laneHashes[2][h], laneHashes[3][h]);
+            }
+        }
+
+        const __m128 xf = _mm_sub_ps(x, _mm_cvtepi32_ps(floorX));
+        _mm_storeu_ps(out + i, Blend4(hashes, xf, yf, zf, Fade4(xf), v, w));
+    }
+#endif
+    for (; i < count; ++i) {
+        out[i] = GetValue(xs[i], y, z);
+    }
+}
+
+void PerlinNoise::GetValues(std::span<const float> xs, std::span<const float> ys, std::span<const float> zs, std::span<float> out) const {
+    // 空でない入力と出力のうち最も短いものに合わせ、要素数が食い違っていても範囲外を読み書きしない
+    size_t count = std::min(xs.size(), out.size());
+    if (!ys.empty()) count = std::min(count, ys.size());
+    if (!zs.empty()) count = std::min(count, zs.size());
+    const float *y = ys.empty() ? nullptr : ys.data();
+    const float *z = zs.empty() ? nullptr : zs.data();
+    const auto evaluateRange = [&](size_t begin, size_t end) {
+        EvaluateBlock(xs.data() + begin, y ? y + begin : nullptr, z ? z + begin : nullptr, out.data() + begin, end - begin);
+    };
+    if (count < kParallelThreshold) {
+        evaluateRange(0, count);
+        return;
+    }
+    Plugin::ParallelFor(count, kParallelGrainSize, evaluateRange);
+}
+
+void PerlinNoise::FillGrid(const NoiseGrid &grid, std::span<float> out) const {
+    const size_t rowCount = static_cast<size_t>(grid.sizeY) * grid.sizeZ;
+    if (grid.sizeX == 0 || rowCount == 0 || out.size() < grid.GetCount()) return;
+
+    const auto evaluateRows = [&](size_t beginRow, size_t endRow) {
+        std::vector<float> xs(grid.sizeX);
+        for (uint32_t x = 0; x < grid.sizeX; ++x) {
+            xs[x] = grid.originX + static_cast<float>(x) * grid.stepX;
+        }
+        for (size_t row = beginRow; row < endRow; ++row) {
+            const uint32_t y = static_cast<uint32_t>(row % grid.sizeY);
+            const uint32_t z = static_cast<uint32_t>(row / grid.sizeY);
+            EvaluateRow(xs.data(), grid.originY + static_cast<float>(y) * grid.stepY,
+                grid.originZ + static_cast<float>(z) * grid.stepZ, out.data() + row * grid.sizeX, grid.sizeX);
+        }
+    };
+    if (grid.GetCount() < kParallelThreshold) {
+        evaluateRows(0, rowCount);
+        return;
+    }
+    Plugin::ParallelFor(rowCount, std::max<size_t>(1, kParallelGrainSize / grid.sizeX), evaluateRows);
+}
+
 } // namespace KashipanEngine
@@ -1,39 +1,41 @@
 #pragma once
-#include <atomic>
-#include <chrono>
 #include <cstddef>
-#include <thread>
-#include "Thread/ThreadPool.h"
-#include "Thread/PriorityTaskDispatcher.h"
+#include <functional>
+#include "Thread/JobSystem.h"
 
 namespace Plugin {
+	/// @brief エンジン全体で共有するジョブシステム（エンジンの初期化前・終了後はnullptr）
+	inline JobSystem* jobSystem = nullptr;
+
+	/// @brief 優先度付きの非同期タスクを投入する（数値が小さいほど高優先度。jobSystemへ転送される）
 	inline std::function<void(const std::function<void()>&, int)> addAsyncTask;
+	/// @brief 実行待ちのタスクを1つ呼び出し元スレッドで実行する（ワーカーは自律的に取り出すため、呼ばなくても進む）
 	inline std::function<void()> executeAsyncTasks;
 	inline std::function<bool()> hasAsyncTasks;
 
-	/// @brief count個のタスクをスレッドプールで並列実行し、すべて完了するまで呼び出し元をブロックして待機する
-	/// @details addAsyncTask/executeAsyncTasksはタスクをワーカーに"投入"するだけで実行完了までは
-	///          追跡しないため、完了通知用のカウンタを自前で持って待ち合わせる
+	/// @brief [0, count) をgrainSize件ずつに分けてジョブシステムで並列実行し、すべて完了するまで待機する
+	/// @details 待機中も呼び出し元スレッドがジョブを実行する。jobSystemが無い場合は呼び出し元スレッドで順に実行する
+	/// @param func 担当範囲 [begin, end) を受け取る処理。複数のスレッドから並列に呼ばれるため、スレッドセーフに実装すること
+	/// @param priority タスクの優先度（数値が小さいほど高優先度）
+	inline void ParallelFor(size_t count, size_t grainSize, const std::function<void(size_t, size_t)>& func, int priority = 0) {
+		if (count == 0) return;
+		if (!jobSystem) {
+			func(0, count);
+			return;
+		}
+		jobSystem->ParallelFor(count, grainSize, func, ToJobPriority(priority));
+	}
+
+	/// @brief count個のタスクをジョブシステムで並列実行し、すべて完了するまで呼び出し元をブロックして待機する
 	/// @param count 実行するタスク数
 	/// @param taskForIndex インデックス（0～count-1）を受け取り実行するタスク本体。
 	///        複数のワーカースレッドから並列に呼ばれるため、スレッドセーフに実装すること
 	/// @param priority タスクの優先度（数値が小さいほど高優先度）
 	inline void RunParallelAndWait(size_t count, const std::function<void(size_t)>& taskForIndex, int priority = 0) {
-		if (count == 0) return;
-
-		std::atomic<size_t> remaining{ count };
-		for (size_t i = 0; i < count; ++i) {
-			addAsyncTask([&taskForIndex, &remaining, i]() {
+		ParallelFor(count, 1, [&taskForIndex](size_t begin, size_t end) {
+			for (size_t i = begin; i < end; ++i) {
 				taskForIndex(i);
-				remaining.fetch_sub(1, std::memory_order_acq_rel);
-				}, priority);
-		}
-
-		// タスクディスパッチャは空いたワーカーへ随時流し込む方式のため、
-		// 全タスク完了までexecuteAsyncTasksを呼び続けてポーリングする
-		while (remaining.load(std::memory_order_acquire) != 0) {
-			executeAsyncTasks();
-			std::this_thread::sleep_for(std::chrono::microseconds(200));
-		}
+			}
+			}, priority);
 	}
 }
\ No newline at end of file
@@ -0,0 +1,296 @@
+#include "JobSystem.h"
+#include <algorithm>
+
+namespace {
+	/// @brief 呼び出し元スレッドのワーカー番号と所属するJobSystem（ワーカー以外はnullptr）
+	thread_local const Plugin::JobSystem* tlsOwner = nullptr;
+	thread_local size_t tlsWorkerIndex = 0;
+	/// @brief 他のワーカーから盗む際の開始位置をずらすための値（特定のワーカーへ集中しないようにする）
+	thread_local size_t tlsStealCursor = 0;
+
+	/// @brief Waitでジョブが見つからなかった場合に、スレッドを譲る前に空回りする回数
+	constexpr int kWaitSpinCount = 64;
+}
+
+//==================================================
+// JobQueue
+//==================================================
+
+void Plugin::JobSystem::JobQueue::PushBack(Job* job) {
+	std::lock_guard<std::mutex> lock(mutex);
+	jobs.push_back(job);
+}
+
+Plugin::JobSystem::Job* Plugin::JobSystem::JobQueue::PopBack() {
+	std::lock_guard<std::mutex> lock(mutex);
+	if (jobs.empty()) return nullptr;
+	Job* job = jobs.back();
+	jobs.pop_back();
+	return job;
+}
+
+Plugin::JobSystem::Job* Plugin::JobSystem::JobQueue::PopFront() {
+	std::lock_guard<std::mutex> lock(mutex);
+	if (jobs.empty()) return nullptr;
+	Job* job = jobs.front();
+	jobs.pop_front();
+	return job;
+}
+
+Plugin::JobSystem::Job* Plugin::JobSystem::JobQueue::PopFrontWithSignal(const JobCounter* signal) {
+	std::lock_guard<std::mutex> lock(mutex);
+	auto it = std::find_if(jobs.begin(), jobs.end(), [signal](const Job* job) { return job->signal == signal; });
+	if (it == jobs.end()) return nullptr;
+	Job* job = *it;
+	jobs.erase(it);
+	return job;
+}
+
+//==================================================
+// JobSystem
+//==================================================
+
+size_t Plugin::JobSystem::GetDefaultWorkerCount() {
+	const size_t threadCount = std::thread::hardware_concurrency();
+	// メインスレッドを残す（最低1スレッドは確保）
+	return threadCount > 1 ? threadCount - 1 : 1;
+}
+
+Plugin::JobSystem::JobSystem(size_t workerCount,
+	std::function<void()> onWorkerStart,
+	std::function<void()> onWorkerExit,
+	std::function<void(std::exception_ptr)> onUnhandledException) :
+	onWorkerStart_(std::move(onWorkerStart)),
+	onWorkerExit_(std::move(onWorkerExit)),
+	onUnhandledException_(std::move(onUnhandledException)) {
+	// 全ワーカーのキューが揃ってからスレッドを起動する（起動直後から他のワーカーのキューを参照するため）
+	workers_.reserve(workerCount);
+	for (size_t i = 0; i < workerCount; ++i) {
+		workers_.emplace_back(std::make_unique<Worker>());
+	}
+	for (size_t i = 0; i < workerCount; ++i) {
+		workers_[i]->thread = std::thread([this, i]() { WorkerMain(i); });
+	}
+}
+
+Plugin::JobSystem::~JobSystem() {
+	// 投入済みのジョブ（キャプチャした参照の寿命がJobSystemと同じもの等）を取りこぼさないよう、全て実行し終えてから止める
+	while (RunPendingJob()) {}
+
+	{
+		std::lock_guard<std::mutex> lock(sleepMutex_);
+		isRunning_ = false;
+	}
+	sleepCondition_.notify_all();
+	for (auto& worker : workers_) {
+		if (worker->thread.joinable()) {
+			worker->thread.join();
+		}
+	}
+}
+
+void Plugin::JobSystem::Schedule(std::function<void()> func, JobPriority priority,
+	JobCounter* signal, JobCounter* dependency) {
+	Job* job = new Job{ std::move(func), priority, signal };
+	if (signal) {
+		signal->count_.fetch_add(1, std::memory_order_acq_rel);
+	}
+
+	if (dependency) {
+		// 依存先の減算（Signal）と同じロックの中で判定するため、0になる瞬間との競合で取りこぼすことはない
+		std::lock_guard<std::mutex> lock(dependency->mutex_);
+		if (dependency->count_.load(std::memory_order_acquire) != 0) {
+			dependency->waitingJobs_.push_back(job);
+			return;
+		}
+	}
+	Enqueue(job);
+}
+
+void Plugin::JobSystem::Wait(JobCounter& counter) {
+	const size_t workerIndex = GetCurrentWorkerIndex();
+	int idleSpins = 0;
+	while (!counter.IsDone()) {
+		// 無関係な低優先度のジョブ（数フレームかかりうる）を拾うと、待っている側（フレーム処理等）が止まってしまう
+		if (Job* job = FindJobForWait(workerIndex, counter)) {
+			Execute(job);
+			idleSpins = 0;
+			continue;
+		}
+		// 実行できるジョブが無い（他スレッドが実行中の）間は、短く空回りしてからスレッドを譲る
+		if (++idleSpins < kWaitSpinCount) continue;
+		std::this_thread::yield();
+	}
+	// 最後の減算を行ったスレッドがカウンタのロックを手放すまで待ち、戻った直後に破棄されても安全にする
+	std::exception_ptr exception;
+	{
+		std::lock_guard<std::mutex> lock(counter.mutex_);
+		exception.swap(counter.exception_);
+	}
+	if (exception) std::rethrow_exception(exception);
+}
+
+void Plugin::JobSystem::ParallelFor(size_t count, size_t grainSize,
+	const std::function<void(size_t, size_t)>& func, JobPriority priority) {
+	if (count == 0) return;
+	grainSize = std::max<size_t>(1, grainSize);
+	const size_t chunkCount = (count + grainSize - 1) / grainSize;
+	if (chunkCount <= 1 || workers_.empty()) {
+		func(0, count);
+		return;
+	}
+
+	JobCounter counter;
+	for (size_t chunk = 1; chunk < chunkCount; ++chunk) {
+		const size_t begin = chunk * grainSize;
+		const size_t end = std::min(count, begin + grainSize);
+		Schedule([&func, begin, end]() { func(begin, end); }, priority, &counter);
+	}
+	// 先頭の範囲が例外を投げても、投入済みのジョブ（funcとcounterを参照する）が終わるまでは戻れない
+	std::exception_ptr exception;
+	try {
+		func(0, std::min(count, grainSize));
+	} catch (...) {
+		exception = std::current_exception();
+	}
+	try {
+		Wait(counter);
+	} catch (...) {
+		if (!exception) exception = std::current_exception();
+	}
+	if (exception) std::rethrow_exception(exception);
+}
+
+bool Plugin::JobSystem::RunPendingJob() {
+	Job* job = FindJob(GetCurrentWorkerIndex());
+	if (!job) return false;
+	Execute(job);
+	return true;
+}
+
+void Plugin::JobSystem::WorkerMain(size_t workerIndex) {
+	tlsOwner = this;
+	tlsWorkerIndex = workerIndex;
+	tlsStealCursor = workerIndex + 1;
+	if (onWorkerStart_) onWorkerStart_();
+
+	while (true) {
+		if (Job* job = FindJob(workerIndex)) {
+			Execute(job);
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock(sleepMutex_);
+		sleepingWorkers_.fetch_add(1);
+		// Enqueueは実行待ち数を増やしてから眠っているワーカーの数を見るため、ここで実行待ち数を見れば起こし損ねない
+		sleepCondition_.wait(lock, [this]() {
+			return pendingJobs_.load() > 0 || !isRunning_.load();
+		});
+		sleepingWorkers_.fetch_sub(1);
+		if (!isRunning_.load() && pendingJobs_.load() == 0) break;
+	}
+
+	if (onWorkerExit_) onWorkerExit_();
+	tlsOwner = nullptr;
+}
+
+Plugin::JobSystem::Job* Plugin::JobSystem::FindJob(size_t workerIndex) {
+	if (pendingJobs_.load(std::memory_order_acquire) == 0) return nullptr;
+
+	Job* job = FindUrgentJob(workerIndex);
+	if (!job) {
+		job = sharedQueues_[static_cast<size_t>(JobPriority::Low)].PopFront();
+		if (job) pendingJobs_.fetch_sub(1, std::memory_order_acq_rel);
+	}
+	return job;
+}
+
+Plugin::JobSystem::Job* Plugin::JobSystem::FindJobForWait(size_t workerIndex, const JobCounter& counter) {
+	if (pendingJobs_.load(std::memory_order_acquire) == 0) return nullptr;
+
+	Job* job = FindUrgentJob(workerIndex);
+	if (!job) {
+		job = sharedQueues_[static_cast<size_t>(JobPriority::Low)].PopFrontWithSignal(&counter);
+		if (job) pendingJobs_.fetch_sub(1, std::memory_order_acq_rel);
+	}
+	return job;
+}
+
+Plugin::JobSystem::Job* Plugin::JobSystem::FindUrgentJob(size_t workerIndex) {
+	// 低優先度のジョブは必ず共有キューへ入るため、ワーカーのキューには高・標準優先度のジョブしか無い
+	Job* job = nullptr;
+	if (workerIndex != kNoWorker) {
+		job = workers_[workerIndex]->queue.PopBack();
+	}
+	for (size_t i = 0; !job && i < static_cast<size_t>(JobPriority::Low); ++i) {
+		job = sharedQueues_[i].PopFront();
+	}
+	for (size_t i = 0; !job && i < workers_.size(); ++i) {
+		const size_t victim = (tlsStealCursor + i) % workers_.size();
+		if (victim == workerIndex) continue;
+		job = workers_[victim]->queue.PopFront();
+		if (job) tlsStealCursor = victim;
+	}
+
+	if (job) pendingJobs_.fetch_sub(1, std::memory_order_acq_rel);
+	return job;
+}
+
+void Plugin::JobSystem::Enqueue(Job* job) {
+	// 取り出し側（FindJob）より先に数えておき、実行待ち数が一時的に負へ回り込まないようにする
+	pendingJobs_.fetch_add(1);
+	// 低優先度のジョブはWaitで無関係なスレッドに拾われないよう、共有キューでまとめて管理する
+	const size_t workerIndex = GetCurrentWorkerIndex();
+	if (workerIndex != kNoWorker && job->priority == JobPriority::Normal) {
+		workers_[workerIndex]->queue.PushBack(job);
+	} else {
+		sharedQueues_[static_cast<size_t>(job->priority)].PushBack(job);
+	}
+
+	if (sleepingWorkers_.load() > 0) {
+		// ワーカーが判定を終えてから眠るまでの間に通知が割り込まないよう、ロックを取ってから起こす
+		{ std::lock_guard<std::mutex> lock(sleepMutex_); }
+		sleepCondition_.notify_one();
+	}
+}
+
+void Plugin::JobSystem::Execute(Job* job) {
+	std::exception_ptr exception;
+	try {
+		if (job->func) job->func();
+	} catch (...) {
+		exception = std::current_exception();
+	}
+	JobCounter* signal = job->signal;
+	delete job;
+
+	if (signal) {
+		// 例外を投げたジョブも完了として数え、Waitしているスレッドへ例外を引き渡す
+		if (exception) {
+			std::lock_guard<std::mutex> lock(signal->mutex_);
+			if (!signal->exception_) signal->exception_ = exception;
+		}
+		Signal(*signal);
+	} else if (exception) {
+		if (!onUnhandledException_) std::rethrow_exception(exception);
+		onUnhandledException_(exception);
+	}
+}
+
+void Plugin::JobSystem::Signal(JobCounter& counter) {
+	std::vector<Job*> released;
+	{
+		std::lock_guard<std::mutex> lock(counter.mutex_);
+		if (counter.count_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+			released.swap(counter.waitingJobs_);
+		}
+	}
+	// ロックを手放した後はカウンタに触れない（Waitから戻ったスレッドが破棄しうるため）
+	for (Job* job : released) {
+		Enqueue(job);
+	}
+}
+
+size_t Plugin::JobSystem::GetCurrentWorkerIndex() const noexcept {
+	return tlsOwner == this ? tlsWorkerIndex : kNoWorker;
+}
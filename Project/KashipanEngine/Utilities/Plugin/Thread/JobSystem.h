@@ -0,0 +1,181 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Plugin {
+	/// @brief ジョブの優先度
+	enum class JobPriority : std::uint8_t {
+		High,
+		Normal,
+		Low,
+	};
+
+	/// @brief 従来のaddAsyncTaskの優先度（数値が小さいほど高優先度。0が標準）をJobPriorityへ変換する
+	constexpr JobPriority ToJobPriority(int priority) noexcept {
+		return priority < 0 ? JobPriority::High : (priority == 0 ? JobPriority::Normal : JobPriority::Low);
+	}
+
+	class JobSystem;
+	class JobCounter;
+
+	namespace Detail {
+		/// @brief JobSystemが管理する1件のジョブ
+		struct Job {
+			std::function<void()> func;
+			JobPriority priority = JobPriority::Normal;
+			JobCounter* signal = nullptr;
+		};
+	}
+
+	/// @brief 未完了のジョブ数を数えるカウンタ
+	/// @details ジョブの投入時に完了通知先として渡すと、そのジョブの完了までカウントが残る。
+	///          JobSystem::Waitで0になるまで待機でき、依存先として渡したジョブは0になるまで実行が保留される。
+	///          カウンタはWaitが返るまで（またはカウンタに依存するジョブが全て投入されるまで）破棄しないこと。
+	///          ジョブが例外を投げた場合もカウントは減算され、最初の例外をWaitが再送出する
+	class JobCounter final {
+	public:
+		JobCounter() = default;
+		~JobCounter() = default;
+		// コピーとムーブを禁止
+		JobCounter(const JobCounter&) = delete;
+		JobCounter& operator=(const JobCounter&) = delete;
+		JobCounter(JobCounter&&) = delete;
+		JobCounter& operator=(JobCounter&&) = delete;
+
+		/// @brief 未完了のジョブが無いかどうかを返す
+		bool IsDone() const noexcept { return count_.load(std::memory_order_acquire) == 0; }
+
+	private:
+		friend class JobSystem;
+
+		std::atomic<std::uint32_t> count_{ 0 };
+		/// @brief count_の減算と待機中ジョブの受け渡しを排他する（Waitから戻った後に触れられないようにするため）
+		std::mutex mutex_;
+		/// @brief このカウンタが0になるまで実行を保留しているジョブ
+		std::vector<Detail::Job*> waitingJobs_;
+		/// @brief 完了通知先がこのカウンタのジョブが投げた最初の例外（Waitが取り出して再送出する）
+		std::exception_ptr exception_;
+	};
+
+	/// @brief ワーカーごとのジョブキューとワークスティーリングで並列実行するジョブシステム
+	/// @details 各ワーカーは自身のキューを後ろから（LIFO）取り出し、空なら共有キューを優先度順に、
+	///          それも空なら他のワーカーのキューを前から（FIFO）盗んで実行する。
+	///          ワーカー以外のスレッド（メインスレッド等）から投入したジョブと、高・低優先度のジョブは共有キューへ入る。
+	///          Waitは完了を待つ間も呼び出し元スレッドでジョブを実行するため、ジョブ内からWaitしてもデッドロックしない。
+	///          ただしWait中に拾うのは高・標準優先度のジョブと、待っているカウンタへ完了を通知する低優先度のジョブだけで、
+	///          それ以外の低優先度のジョブ（長時間かかりうるバックグラウンド処理）は手の空いたワーカーだけが実行する
+	///          OS依存の処理（COMの初期化等）は持たず、ワーカーの開始・終了時のコールバックで呼び出し側が行う
+	class JobSystem final {
+	public:
+		/// @brief 既定のワーカー数（論理コア数-1。メインスレッドの分を残す。最低1）
+		static size_t GetDefaultWorkerCount();
+
+		/// @param workerCount ワーカースレッドの数
+		/// @param onWorkerStart 各ワーカースレッドの開始時にそのスレッド上で呼ばれる
+		/// @param onWorkerExit 各ワーカースレッドの終了時にそのスレッド上で呼ばれる
+		/// @param onUnhandledException 完了通知先を持たないジョブが例外を投げた場合に、実行したスレッド上で呼ばれる
+		///        （未設定の場合は例外をそのまま送出するため、ワーカースレッド上ではstd::terminateになる）
+		explicit JobSystem(size_t workerCount = GetDefaultWorkerCount(),
+			std::function<void()> onWorkerStart = {},
+			std::function<void()> onWorkerExit = {},
+			std::function<void(std::exception_ptr)> onUnhandledException = {});
+		/// @brief 残っているジョブを実行し終えてからワーカーを停止する
+		~JobSystem();
+		// コピーとムーブを禁止
+		JobSystem(const JobSystem&) = delete;
+		JobSystem& operator=(const JobSystem&) = delete;
+		JobSystem(JobSystem&&) = delete;
+		JobSystem& operator=(JobSystem&&) = delete;
+
+		/// @brief ジョブを投入する
+		/// @param func 実行する処理
+		/// @param priority 優先度
+		/// @param signal 完了通知先のカウンタ（投入時に加算され、完了時に減算される）
+		/// @param dependency このカウンタが0になるまで実行を保留する
+		void Schedule(std::function<void()> func, JobPriority priority = JobPriority::Normal,
+			JobCounter* signal = nullptr, JobCounter* dependency = nullptr);
+
+		/// @brief カウンタが0になるまで、呼び出し元スレッドでもジョブを実行しながら待機する
+		/// @details 待機中に実行するのは高・標準優先度のジョブと、このカウンタへ完了を通知する低優先度のジョブに限る。
+		///          このカウンタへ完了を通知するジョブが例外を投げていた場合は、0になった後に最初の例外を再送出する
+		void Wait(JobCounter& counter);
+
+		/// @brief [0, count) をgrainSize件ずつのジョブに分けて並列実行し、完了まで待機する
+		/// @param func 担当範囲 [begin, end) を受け取る処理。複数スレッドから並列に呼ばれる
+		/// @details 先頭の範囲は呼び出し元スレッドで実行する。いずれかの範囲が例外を投げた場合も全範囲の完了を待ってから、
+		///          最初の例外を再送出する
+		void ParallelFor(size_t count, size_t grainSize, const std::function<void(size_t, size_t)>& func,
+			JobPriority priority = JobPriority::Normal);
+
+		/// @brief 実行待ちのジョブを1つ呼び出し元スレッドで実行する
+		/// @details 低優先度のジョブも対象になるため、フレーム処理の途中などで呼ぶと長時間戻らないことがある
+		/// @return 実行した場合はtrue
+		bool RunPendingJob();
+		/// @brief 実行待ち（依存による保留は含まない）のジョブがあるかどうかを返す
+		bool HasPendingJobs() const noexcept { return pendingJobs_.load(std::memory_order_acquire) > 0; }
+		/// @brief ワーカースレッドの数を返す
+		size_t GetWorkerCount() const noexcept { return workers_.size(); }
+
+	private:
+		using Job = Detail::Job;
+
+		/// @brief 排他制御付きのジョブキュー
+		struct JobQueue {
+			std::mutex mutex;
+			std::deque<Job*> jobs;
+
+			void PushBack(Job* job);
+			Job* PopBack();
+			Job* PopFront();
+			/// @brief 完了通知先がsignalであるジョブのうち、最も古いものを取り出す
+			Job* PopFrontWithSignal(const JobCounter* signal);
+		};
+
+		struct Worker {
+			std::thread thread;
+			JobQueue queue;
+		};
+
+		static constexpr size_t kPriorityCount = 3;
+		/// @brief ワーカー以外のスレッドを表すワーカー番号
+		static constexpr size_t kNoWorker = static_cast<size_t>(-1);
+
+		void WorkerMain(size_t workerIndex);
+		/// @brief 実行可能なジョブを探す（FindUrgentJobで見つからなければ低優先度の共有キューから取り出す）
+		Job* FindJob(size_t workerIndex);
+		/// @brief Wait中に実行してよいジョブを探す（低優先度はcounterへ完了を通知するものだけ）
+		Job* FindJobForWait(size_t workerIndex, const JobCounter& counter);
+		/// @brief 自身のキュー → 高・標準優先度の共有キュー → 他のワーカーのキューの順に探す（低優先度は含まない）
+		Job* FindUrgentJob(size_t workerIndex);
+		void Enqueue(Job* job);
+		/// @brief ジョブを実行して完了を通知し、破棄する（例外を投げても完了通知と破棄は必ず行う）
+		void Execute(Job* job);
+		/// @brief 完了したジョブの分だけカウンタを減算し、0になったら保留中のジョブを投入する
+		void Signal(JobCounter& counter);
+		/// @brief 呼び出し元スレッドのワーカー番号（ワーカー以外はkNoWorker）
+		size_t GetCurrentWorkerIndex() const noexcept;
+
+		std::vector<std::unique_ptr<Worker>> workers_;
+		/// @brief ワーカー以外のスレッドから投入されたジョブと高・低優先度のジョブを入れる、優先度ごとの共有キュー
+		JobQueue sharedQueues_[kPriorityCount];
+
+		std::function<void()> onWorkerStart_;
+		std::function<void()> onWorkerExit_;
+		std::function<void(std::exception_ptr)> onUnhandledException_;
+
+		std::atomic<size_t> pendingJobs_{ 0 };
+		std::atomic<size_t> sleepingWorkers_{ 0 };
+		std::atomic<bool> isRunning_{ true };
+		std::mutex sleepMutex_;
+		std::condition_variable sleepCondition_;
+	};
+}
@@ -0,0 +1,461 @@
+#include "Utilities/StageGenerationService.h"
+#include "Core/ProjectPaths.h"
+#include "Utilities/ChunkedWaveFunctionCollapse.h"
+#include "Utilities/FileIO/BinaryStream.h"
+#include "Utilities/Plugin/Plugins.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+namespace KashipanEngine {
+
+namespace {
+
+/// @brief 生成結果の保存先（プロジェクトルート基準）
+constexpr const char *kCacheFolderName = "Cache/StageGeneration";
+constexpr const char *kCacheExtension = ".ksg";
+/// @brief 生成結果ファイルの識別子とフォーマットのバージョン（生成手順を変えた場合も上げる）
+constexpr std::uint32_t kCacheMagic = 0x4753534Bu; // "KSSG"
+constexpr std::uint32_t kCacheFormatVersion = 1;
+
+/// @brief メモリに保持する生成結果の数（超えた分は古いものから破棄する）
+constexpr std::size_t kMemoryCacheCapacity = 8;
+/// @brief 生成タスクの優先度（フレーム内の処理より後に回す）
+constexpr int kTaskPriority = 1;
+
+/// @brief 各段階の終了時点の進捗（タイルの求解が大半を占める）
+constexpr float kCacheProgressEnd = 0.02f;
+constexpr float kGraphProgressEnd = 0.05f;
+constexpr float kGridProgressEnd = 0.1f;
+
+std::mutex sMutex;
+std::unordered_map<std::uint64_t, std::shared_ptr<const StageGenerationResult>> sMemoryCache;
+std::deque<std::uint64_t> sMemoryCacheOrder;
+/// @brief 実行中のタスク（同じキーの要求には同じタスクを返す）
+std::unordered_map<std::uint64_t, std::weak_ptr<StageGenerationTask>> sRunningTasks;
+
+std::shared_ptr<const StageGenerationResult> FindInMemoryCache(std::uint64_t key) {
+    auto it = sMemoryCache.find(key);
+    return it != sMemoryCache.end() ? it->second : nullptr;
+}
+
+void StoreInMemoryCache(std::uint64_t key, std::shared_ptr<const StageGenerationResult> result) {
+    std::lock_guard<std::mutex> lock(sMutex);
+    if (sMemoryCache.insert_or_assign(key, std::move(result)).second) {
+        sMemoryCacheOrder.push_back(key);
+    }
+    while (sMemoryCacheOrder.size() > kMemoryCacheCapacity) {
+        sMemoryCache.erase(sMemoryCacheOrder.front());
+        sMemoryCacheOrder.pop_front();
+    }
+}
+
+std::string GetCachePath(std::uint64_t key) {
+    char fileName[32] = {};
+    std::snprintf(fileName, sizeof(fileName), "%016llx", static_cast<unsigned long long>(key));
+    return ProjectPaths::InProjectRoot(std::string(kCacheFolderName) + "/" + fileName + kCacheExtension);
+}
+
+void SaveToDisk(std::uint64_t key, const StageGenerationResult &result) {
+    std::vector<std::uint8_t> data;
+    BinaryWriter writer(data);
+    writer.U32(kCacheMagic);
+    writer.U32(kCacheFormatVersion);
+    writer.U64(key);
+
+    const auto &rooms = result.graph.GetRooms();
+    writer.U32(static_cast<std::uint32_t>(rooms.size()));
+    for (const auto &room : rooms) {
+        writer.U32(room.id);
+        writer.U8(static_cast<std::uint8_t>(room.type));
+        writer.U32(room.x);
+        writer.U32(room.y);
+        writer.U32(room.z);
+        writer.Array(room.connectedRoomIDs);
+    }
+
+    writer.U32(result.gridWidth);
+    writer.U32(result.gridHeight);
+    writer.U32(result.gridDepth);
+    writer.Strings(result.tileNames);
+    writer.Array(result.tiles);
+    SaveChecksummedBinaryFile(GetCachePath(key), std::move(data));
+}
+
+/// @param graph 生成時と同じ設定の部屋グラフ（読み込んだ部屋を復元する）
+std::shared_ptr<const StageGenerationResult> LoadFromDisk(std::uint64_t key, StageGraphGenerator graph) {
+    std::vector<std::uint8_t> data;
+    if (!LoadChecksummedBinaryFile(GetCachePath(key), data)) return nullptr;
+
+    BinaryReader reader(data.data(), data.size());
+    if (reader.U32() != kCacheMagic || reader.U32() != kCacheFormatVersion || reader.U64() != key) return nullptr;
+
+    const std::uint32_t roomCount = reader.U32();
+    std::vector<RoomNode> rooms;
+    for (std::uint32_t i = 0; i < roomCount && reader.IsValid(); ++i) {
+        RoomNode room;
+        room.id = reader.U32();
+        room.type = static_cast<RoomType>(reader.U8());
+        room.x = reader.U32();
+        room.y = reader.U32();
+        room.z = reader.U32();
+        room.connectedRoomIDs = reader.Array<std::uint32_t>();
+        rooms.push_back(std::move(room));
+    }
+
+    auto result = std::make_shared<StageGenerationResult>();
+    result->gridWidth = reader.U32();
+    result->gridHeight = reader.U32();
+    result->gridDepth = reader.U32();
+    result->tileNames = reader.Strings();
+    result->tiles = reader.Array<std::uint32_t>();
+    if (!reader.IsValid() || !reader.IsAtEnd()) return nullptr;
+
+    const std::size_t cellCount = static_cast<std::size_t>(result->gridWidth) * result->gridHeight * result->gridDepth;
+    const std::uint32_t tileCount = static_cast<std::uint32_t>(result->tileNames.size());
+    if (result->tiles.size() != cellCount
+        || std::any_of(result->tiles.begin(), result->tiles.end(), [&](std::uint32_t tile) { return tile >= tileCount; })) {
+        return nullptr;
+    }
+    if (!graph.RestoreRooms(std::move(rooms))) return nullptr;
+    result->graph = std::move(graph);
+    return result;
+}
+
+/// @brief wfc.Solve の結果を GetRuleTileNames のインデックスで取り出す
+bool CollectSolvedTiles(const WaveFunctionCollapse &wfc, StageGenerationResult &result) {
+    std::unordered_map<std::string, std::uint32_t> tileIndices;
+    for (std::uint32_t t = 0; t < result.tileNames.size(); ++t) {
+        tileIndices.emplace(result.tileNames[t], t);
+    }
+
+    result.tiles.resize(static_cast<std::size_t>(result.gridWidth) * result.gridHeight * result.gridDepth);
+    std::size_t index = 0;
+    for (std::uint32_t x = 0; x < result.gridWidth; ++x) {
+        for (std::uint32_t y = 0; y < result.gridHeight; ++y) {
+            for (std::uint32_t z = 0; z < result.gridDepth; ++z) {
+                const auto tileName = wfc.GetResolvedTile(x, y, z);
+                if (!tileName) return false;
+                result.tiles[index++] = tileIndices.at(*tileName);
+            }
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+const std::string *StageGenerationResult::GetTile(std::uint32_t x, std::uint32_t y, std::uint32_t z) const noexcept {
+    if (x >= gridWidth || y >= gridHeight || z >= gridDepth) return nullptr;
+    return &tileNames[tiles[(static_cast<std::size_t>(x) * gridHeight + y) * gridDepth + z]];
+}
+
+bool StageGenerationTask::IsDone() const noexcept {
+    const State state = GetState();
+    return state == State::Completed || state == State::Failed || state == State::Cancelled;
+}
+
+std::shared_ptr<const StageGenerationResult> StageGenerationTask::GetResult() const noexcept {
+    return GetState() == State::Completed ? result_ : nullptr;
+}
+
+void StageGenerationTask::SetProgress(Phase phase, float progress) noexcept {
+    phase_.store(phase, std::memory_order_release);
+    progress_.store(progress, std::memory_order_relaxed);
+}
+
+void StageGenerationTask::Finish(State state, std::shared_ptr<const StageGenerationResult> result) noexcept {
+    result_ = std::move(result);
+    if (state == State::Completed) {
+        SetProgress(Phase::Done, 1.0f);
+    }
+    state_.store(state, std::memory_order_release);
+}
+
+struct StageGenerationService::GenerationContext {
+    enum class Step : std::uint8_t {
+        /// @brief キャッシュの確認～タイルグリッドへの展開
+        Setup,
+        /// @brief チャンクを段ごとに並列に解く
+        Chunks,
+        /// @brief 全体の解き直し（必要な場合）と保存
+        Completion,
+    };
+
+    GenerationContext(std::shared_ptr<StageGenerationTask> task, std::uint32_t seed, const StageGraphGenerator &graph,
+        const StageGridBuilder &builder, const WaveFunctionCollapse &wfc, const StageGenerationOptions &options)
+        : task(std::move(task)), seed(seed), graph(graph), builder(builder), wfc(wfc), options(options) {}
+
+    std::shared_ptr<StageGenerationTask> task;
+    std::uint32_t seed;
+    StageGraphGenerator graph;
+    StageGridBuilder builder;
+    WaveFunctionCollapse wfc;
+    StageGenerationOptions options;
+    /// @brief 段階の投入先（nullptr の場合は呼び出し元スレッドで順に実行する）
+    Plugin::JobSystem *jobSystem = nullptr;
+
+    Step step = Step::Setup;
+    std::shared_ptr<StageGenerationResult> result = std::make_shared<StageGenerationResult>();
+    ChunkedWaveFunctionCollapse chunked;
+    /// @brief 段（座標の偶奇）ごとのチャンク座標（同じ段のチャンク同士は隣接しないため並列に解ける）
+    std::vector<std::vector<WfcChunkCoord>> chunkPhases;
+    std::size_t nextPhase = 0;
+    std::size_t chunkCount = 0;
+    /// @brief 解き終えたチャンクの数（並列に解くジョブの間で共有し、進捗に使う）
+    std::atomic<std::size_t> finishedChunkCount{ 0 };
+    /// @brief result->tiles がチャンクの結果で埋まっているか
+    bool isSolved = false;
+};
+
+std::uint64_t StageGenerationService::ComputeKey(std::uint32_t seed, const StageGraphGenerator &graph,
+    const StageGridBuilder &builder, const WaveFunctionCollapse &tileSet, const StageGenerationOptions &options) {
+    const std::uint64_t values[] = {
+        kCacheFormatVersion,
+        seed,
+        graph.GetSettingsHash(),
+        builder.GetSettingsHash(),
+        tileSet.GetTileSetHash(),
+        options.chunkSize,
+    };
+    return HashFnv1a(kFnv1aOffsetBasis, values, sizeof(values));
+}
+
+std::shared_ptr<StageGenerationTask> StageGenerationService::Request(std::uint32_t seed, const StageGraphGenerator &graph,
+    const StageGridBuilder &builder, const WaveFunctionCollapse &tileSet, const StageGenerationOptions &options) {
+    const std::uint64_t key = ComputeKey(seed, graph, builder, tileSet, options);
+
+    auto task = std::make_shared<StageGenerationTask>();
+    task->key_ = key;
+    {
+        std::lock_guard<std::mutex> lock(sMutex);
+        if (auto cached = FindInMemoryCache(key)) {
+            task->isCacheHit_.store(true, std::memory_order_relaxed);
+            task->Finish(StageGenerationTask::State::Completed, std::move(cached));
+            return task;
+        }
+        auto it = sRunningTasks.find(key);
+        if (it != sRunningTasks.end()) {
+            auto running = it->second.lock();
+            if (running && !running->IsCancelRequested() && !running->IsDone()) {
+                return running;
+            }
+        }
+        sRunningTasks[key] = task;
+    }
+
+    // 呼び出し元のオブジェクトはワーカースレッドから触らないよう、ここでコピーする
+    auto context = std::make_shared<GenerationContext>(task, seed, graph, builder, tileSet, options);
+    // 段階の間で Plugin::jobSystem を読み直さないよう、投入先はここで決めておく（終了処理との競合を避けるため）
+    context->jobSystem = Plugin::jobSystem;
+    ScheduleSteps(context);
+    return task;
+}
+
+void StageGenerationService::ClearMemoryCache() {
+    std::lock_guard<std::mutex> lock(sMutex);
+    sMemoryCache.clear();
+    sMemoryCacheOrder.clear();
+}
+
+void StageGenerationService::ScheduleSteps(const std::shared_ptr<GenerationContext> &context) {
+    if (!context->jobSystem) {
+        while (ExecuteStep(*context)) {}
+        return;
+    }
+    // 次の段階は前の段階の終わりに投入する（1つのジョブは段階1つ分で終わり、ワーカーを長く占有しない）
+    context->jobSystem->Schedule([context]() {
+        if (ExecuteStep(*context)) {
+            ScheduleSteps(context);
+        }
+    }, Plugin::ToJobPriority(kTaskPriority));
+}
+
+bool StageGenerationService::ExecuteStep(GenerationContext &context) {
+    using State = StageGenerationTask::State;
+
+    if (context.task->IsCancelRequested()) {
+        Finish(context, State::Cancelled);
+        return false;
+    }
+    switch (context.step) {
+    case GenerationContext::Step::Setup:
+        context.task->state_.store(State::Running, std::memory_order_release);
+        return ExecuteSetup(context);
+    case GenerationContext::Step::Chunks:
+        return ExecuteChunkPhase(context);
+    case GenerationContext::Step::Completion:
+        ExecuteCompletion(context);
+        return false;
+    }
+    return false;
+}
+
+bool StageGenerationService::ExecuteSetup(GenerationContext &context) {
+    using State = StageGenerationTask::State;
+    using Phase = StageGenerationTask::Phase;
+    auto &task = *context.task;
+
+    task.SetProgress(Phase::Cache, 0.0f);
+    if (context.options.useDiskCache) {
+        if (auto cached = LoadFromDisk(task.key_, context.graph)) {
+            StoreInMemoryCache(task.key_, cached);
+            task.isCacheHit_.store(true, std::memory_order_relaxed);
+            Finish(context, State::Completed, std::move(cached));
+            return false;
+        }
+    }
+
+    // --- 部屋グラフ ---
+    task.SetProgress(Phase::Graph, kCacheProgressEnd);
+    context.graph.SetSeed(context.seed);
+    context.graph.Generate();
+    if (context.graph.GetRoomCount() == 0) {
+        Finish(context, State::Failed);
+        return false;
+    }
+    if (task.IsCancelRequested()) {
+        Finish(context, State::Cancelled);
+        return false;
+    }
+
+    // --- タイルグリッドへの展開 ---
+    task.SetProgress(Phase::Grid, kGraphProgressEnd);
+    context.wfc.SetSeed(context.seed);
+    if (!context.builder.Build(context.graph, context.wfc)) {
+        Finish(context, State::Failed);
+        return false;
+    }
+
+    // --- タイルの求解の準備 ---
+    task.SetProgress(Phase::Tiles, kGridProgressEnd);
+    auto &result = *context.result;
+    context.builder.GetRequiredGridSize(context.graph, result.gridWidth, result.gridHeight, result.gridDepth);
+    context.wfc.GetRuleSet();
+    result.tileNames = context.wfc.GetRuleTileNames();
+
+    context.step = GenerationContext::Step::Completion;
+    const std::uint32_t chunkSize = context.options.chunkSize;
+    if (chunkSize > 0 && context.chunked.Setup(context.wfc, true)) {
+        context.chunked.SetChunkSize(chunkSize, result.gridHeight, chunkSize);
+        const std::int32_t chunkCountX = static_cast<std::int32_t>((result.gridWidth + chunkSize - 1) / chunkSize);
+        const std::int32_t chunkCountZ = static_cast<std::int32_t>((result.gridDepth + chunkSize - 1) / chunkSize);
+        // 段（座標の偶奇）の順に解くと、各チャンクの前の段の隣接チャンクは先に解き終わっているため、
+        // 1回の GenerateChunks で解くのはその段のチャンクだけになる
+        for (std::int32_t pz = 0; pz < 2; ++pz) {
+            for (std::int32_t px = 0; px < 2; ++px) {
+                std::vector<WfcChunkCoord> phase;
+                for (std::int32_t cx = px; cx < chunkCountX; cx += 2) {
+                    for (std::int32_t cz = pz; cz < chunkCountZ; cz += 2) {
+                        phase.push_back({ cx, 0, cz });
+                    }
+                }
+                context.chunkCount += phase.size();
+                if (!phase.empty()) context.chunkPhases.push_back(std::move(phase));
+            }
+        }
+        if (!context.chunkPhases.empty()) context.step = GenerationContext::Step::Chunks;
+    }
+    return true;
+}
+
+bool StageGenerationService::ExecuteChunkPhase(GenerationContext &context) {
+    using State = StageGenerationTask::State;
+    auto &task = *context.task;
+
+    // 段の中のチャンクは JobSystem::ParallelFor で並列に解き、各チャンクの前にキャンセルを確かめる
+    WfcChunkGenerateOptions options;
+    options.priority = kTaskPriority;
+    options.shouldContinue = [&task]() { return !task.IsCancelRequested(); };
+    options.onChunkFinished = [&context, &task](bool) {
+        const std::size_t finished = context.finishedChunkCount.fetch_add(1, std::memory_order_relaxed) + 1;
+        const float solvedRatio = static_cast<float>(finished) / static_cast<float>(context.chunkCount);
+        const float progress = kGridProgressEnd + (1.0f - kGridProgressEnd) * solvedRatio;
+        // 複数のジョブから書き込むため、進捗が戻らないよう大きい値だけを残す
+        float current = task.progress_.load(std::memory_order_relaxed);
+        while (current < progress && !task.progress_.compare_exchange_weak(current, progress, std::memory_order_relaxed)) {}
+    };
+    const bool isSolved = context.chunked.GenerateChunks(context.chunkPhases[context.nextPhase], options);
+    if (task.IsCancelRequested()) {
+        Finish(context, State::Cancelled);
+        return false;
+    }
+    if (!isSolved) {
+        // チャンク境界の組み合わせで解けなかった。残りの段は解かずに全体の解き直しへ進む
+        context.step = GenerationContext::Step::Completion;
+        return true;
+    }
+    if (++context.nextPhase < context.chunkPhases.size()) return true;
+
+    auto &result = *context.result;
+    result.tiles.resize(static_cast<std::size_t>(result.gridWidth) * result.gridHeight * result.gridDepth);
+    std::size_t index = 0;
+    for (std::uint32_t x = 0; x < result.gridWidth; ++x) {
+        for (std::uint32_t y = 0; y < result.gridHeight; ++y) {
+            for (std::uint32_t z = 0; z < result.gridDepth; ++z) {
+                result.tiles[index++] = context.chunked.GetTileIndex(
+                    static_cast<std::int32_t>(x), static_cast<std::int32_t>(y), static_cast<std::int32_t>(z));
+            }
+        }
+    }
+    context.isSolved = true;
+    context.step = GenerationContext::Step::Completion;
+    return true;
+}
+
+void StageGenerationService::ExecuteCompletion(GenerationContext &context) {
+    using State = StageGenerationTask::State;
+    using Phase = StageGenerationTask::Phase;
+    auto &task = *context.task;
+    auto &result = context.result;
+
+    // チャンク境界の組み合わせで解けなかった場合は、グリッド全体をバックトラック付きで解き直す
+    if (!context.isSolved) {
+        context.chunked.ClearChunks();
+        const float progressStart = task.GetProgress();
+        const bool isSolved = context.wfc.Solve([&task, progressStart](float resolvedRatio) {
+            task.SetProgress(Phase::Tiles, progressStart + (1.0f - progressStart) * resolvedRatio);
+            return !task.IsCancelRequested();
+        });
+        if (task.IsCancelRequested()) {
+            Finish(context, State::Cancelled);
+            return;
+        }
+        if (!isSolved || !CollectSolvedTiles(context.wfc, *result)) {
+            Finish(context, State::Failed);
+            return;
+        }
+    }
+
+    // キャンセルされたタスクの結果は保存しない（同じキーで要求し直したタスクが別に走っている場合がある）
+    if (task.IsCancelRequested()) {
+        Finish(context, State::Cancelled);
+        return;
+    }
+    result->graph = std::move(context.graph);
+    if (context.options.useDiskCache) {
+        SaveToDisk(task.key_, *result);
+    }
+    StoreInMemoryCache(task.key_, result);
+    Finish(context, State::Completed, std::move(result));
+}
+
+void StageGenerationService::Finish(GenerationContext &context, StageGenerationTask::State state,
+    std::shared_ptr<const StageGenerationResult> result) {
+    const auto &task = context.task;
+    {
+        std::lock_guard<std::mutex> lock(sMutex);
+        auto it = sRunningTasks.find(task->key_);
+        if (it != sRunningTasks.end() && it->second.lock() == task) {
+            sRunningTasks.erase(it);
+        }
+    }
+    task->Finish(state, std::move(result));
+}
+
+} // namespace KashipanEngine
@@ -0,0 +1,147 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Utilities/StageGraphGenerator.h"
+#include "Utilities/StageGridBuilder.h"
+#include "Utilities/WaveFunctionCollapse.h"
+
+namespace KashipanEngine {
+
+/// @brief StageGenerationService の生成オプション（キャッシュキーに含まれる）
+struct StageGenerationOptions final {
+    /// @brief タイルを解くチャンクの X・Z 方向のタイル数（Y 方向はグリッド全体）。0 の場合はグリッド全体を1回で解く
+    std::uint32_t chunkSize = 32;
+    /// @brief ディスクキャッシュ（Cache/StageGeneration）を読み書きするか
+    bool useDiskCache = true;
+};
+
+/// @brief ステージ生成の結果（部屋グラフとタイルグリッド）
+struct StageGenerationResult final {
+    /// @brief 生成済みの部屋グラフ（キャッシュから読み込んだ場合も RestoreRooms で復元済み）
+    StageGraphGenerator graph;
+    std::uint32_t gridWidth = 0;
+    std::uint32_t gridHeight = 0;
+    std::uint32_t gridDepth = 0;
+    /// @brief タイルインデックスに対応するタイル名（名前順）
+    std::vector<std::string> tileNames;
+    /// @brief 確定したタイル（tileNames のインデックス。[x][y][z] の順に並ぶ）
+    std::vector<std::uint32_t> tiles;
+
+    /// @brief 確定したタイル名（座標が範囲外の場合は nullptr）
+    const std::string *GetTile(std::uint32_t x, std::uint32_t y, std::uint32_t z) const noexcept;
+};
+
+/// @brief StageGenerationService::Request が返す生成タスク（ポーリング用のハンドル）
+/// @details 状態・進捗・結果はどのスレッドから読んでもよい。結果は Completed になった後は変更されない
+class StageGenerationTask final {
+public:
+    enum class State : std::uint8_t {
+        /// @brief ワーカースレッドでの実行待ち
+        Pending,
+        Running,
+        Completed,
+        /// @brief 部屋グラフの生成・タイルへの展開・求解のいずれかに失敗した
+        Failed,
+        Cancelled,
+    };
+
+    /// @brief 現在実行している段階（進捗表示用）
+    enum class Phase : std::uint8_t {
+        Queued,
+        /// @brief キャッシュの確認
+        Cache,
+        /// @brief 部屋グラフの生成
+        Graph,
+        /// @brief 部屋グラフのタイルグリッドへの展開
+        Grid,
+        /// @brief タイルの求解
+        Tiles,
+        Done,
+    };
+
+    State GetState() const noexcept { return state_.load(std::memory_order_acquire); }
+    Phase GetPhase() const noexcept { return phase_.load(std::memory_order_acquire); }
+    /// @brief 完了・失敗・キャンセルのいずれかで終了しているか
+    bool IsDone() const noexcept;
+    /// @brief 全体の進捗（0.0～1.0）
+    float GetProgress() const noexcept { return progress_.load(std::memory_order_relaxed); }
+    /// @brief メモリ・ディスクのキャッシュから結果を得たか
+    bool IsCacheHit() const noexcept { return isCacheHit_.load(std::memory_order_relaxed); }
+    /// @brief シード・設定・タイルセットから求めたキャッシュキー
+    std::uint64_t GetKey() const noexcept { return key_; }
+
+    /// @brief キャンセルを要求する（段階・チャンクの区切りで中断される。完了済みの場合は何もしない）
+    void Cancel() noexcept { isCancelRequested_.store(true, std::memory_order_relaxed); }
+    bool IsCancelRequested() const noexcept { return isCancelRequested_.load(std::memory_order_relaxed); }
+
+    /// @brief 生成結果（Completed 以外では nullptr）
+    std::shared_ptr<const StageGenerationResult> GetResult() const noexcept;
+
+private:
+    friend class StageGenerationService;
+
+    void SetProgress(Phase phase, float progress) noexcept;
+    void Finish(State state, std::shared_ptr<const StageGenerationResult> result = nullptr) noexcept;
+
+    std::uint64_t key_ = 0;
+    std::atomic<State> state_{ State::Pending };
+    std::atomic<Phase> phase_{ Phase::Queued };
+    std::atomic<float> progress_{ 0.0f };
+    std::atomic<bool> isCacheHit_{ false };
+    std::atomic<bool> isCancelRequested_{ false };
+    /// @brief state_ を Completed にする前に書き込む（以降は読み取り専用）
+    std::shared_ptr<const StageGenerationResult> result_;
+};
+
+/// @brief StageGraphGenerator → StageGridBuilder → タイルの求解をワーカースレッドで非同期に行うサービス
+/// @details 結果は（シード, 部屋グラフの設定, 展開の設定, タイルセット, オプション）のハッシュをキーとして
+///          メモリとディスク（Cache/StageGeneration）にキャッシュし、同じフロアの再訪やリトライでは
+///          再計算せずに返す。同じキーの生成が実行中であれば同じタスクを返す。
+///          生成は段階ごとの低優先度ジョブ（キャッシュ確認～展開、チャンクの段ごとの求解、仕上げ）に分けて
+///          順に投入し、1つのジョブがワーカーを長く占有しないようにする。タイルはチャンク単位
+///          （ChunkedWaveFunctionCollapse）で解き、互いに隣接しない同じ段のチャンクは低優先度の
+///          ParallelFor で並列に解く。チャンクごとに進捗を更新してキャンセルを確かめ、解けなかったチャンクが
+///          あればグリッド全体を WaveFunctionCollapse::Solve で解き直す（こちらも一定間隔でキャンセルを確認する）
+class StageGenerationService final {
+public:
+    /// @brief 生成を開始する（引数はコピーされるため、呼び出し後に変更・破棄してよい）
+    /// @param seed 部屋グラフとタイルの求解に使うシード（graph・tileSet に設定済みのシードは使わない）
+    /// @param graph 部屋グラフの設定（グリッドサイズ・寄り道の確率と種別）
+    /// @param builder タイルグリッドへの展開の設定
+    /// @param tileSet 使用する全タイルを登録した WaveFunctionCollapse（グリッド・固定タイルは使わない）
+    /// @details ジョブシステムが無い場合（エンジンの初期化前など）は呼び出し元スレッドで完了まで実行する
+    static std::shared_ptr<StageGenerationTask> Request(std::uint32_t seed, const StageGraphGenerator &graph,
+        const StageGridBuilder &builder, const WaveFunctionCollapse &tileSet, const StageGenerationOptions &options = {});
+
+    /// @brief 生成結果のキャッシュキー（Request と同じ値）
+    static std::uint64_t ComputeKey(std::uint32_t seed, const StageGraphGenerator &graph,
+        const StageGridBuilder &builder, const WaveFunctionCollapse &tileSet, const StageGenerationOptions &options = {});
+
+    /// @brief メモリキャッシュの結果を破棄する（ディスクキャッシュは残る）
+    static void ClearMemoryCache();
+
+private:
+    /// @brief 生成タスク1件の途中状態（段階ごとのジョブの間で受け渡す）
+    struct GenerationContext;
+
+    /// @brief 生成処理の段階を1つずつジョブとして投入する（ジョブシステムが無い場合は呼び出し元スレッドで最後まで実行する）
+    static void ScheduleSteps(const std::shared_ptr<GenerationContext> &context);
+    /// @brief 生成処理の段階を1つ実行する
+    /// @return 次の段階がある場合は true
+    static bool ExecuteStep(GenerationContext &context);
+    /// @brief キャッシュの確認・部屋グラフの生成・タイルグリッドへの展開と、チャンクを解く順序の決定
+    static bool ExecuteSetup(GenerationContext &context);
+    /// @brief チャンクを1段分（互いに隣接しないチャンク）まとめて並列に解く
+    static bool ExecuteChunkPhase(GenerationContext &context);
+    /// @brief 解けなかった場合の全体の解き直しと、結果のキャッシュへの保存
+    static void ExecuteCompletion(GenerationContext &context);
+    /// @brief 実行中のタスクの登録を外してタスクを終了させる
+    static void Finish(GenerationContext &context, StageGenerationTask::State state,
+        std::shared_ptr<const StageGenerationResult> result = nullptr);
+};
+
+} // namespace KashipanEngine
@@ -1,4 +1,5 @@
 #include "Utilities/StageGraphGenerator.h"
+#include "Utilities/FileIO/BinaryStream.h"
 
 #include <algorithm>
 
@@ -132,6 +133,45 @@ void StageGraphGenerator::Generate() {
     goalRoomID_ = prevRoomID;
 }
 
+bool StageGraphGenerator::RestoreRooms(std::vector<RoomNode> rooms) {
+    rooms_.clear();
+    startRoomID_.reset();
+    goalRoomID_.reset();
+    occupied_.assign(width_, std::vector<std::vector<bool>>(height_, std::vector<bool>(depth_, false)));
+
+    for (std::size_t i = 0; i < rooms.size(); ++i) {
+        const RoomNode &room = rooms[i];
+        const bool isValid = room.id == i && room.x < width_ && room.y < height_ && room.z < depth_
+            && std::all_of(room.connectedRoomIDs.begin(), room.connectedRoomIDs.end(),
+                [&](std::uint32_t id) { return id < rooms.size(); });
+        if (!isValid) {
+            occupied_.assign(width_, std::vector<std::vector<bool>>(height_, std::vector<bool>(depth_, false)));
+            return false;
+        }
+        occupied_[room.x][room.y][room.z] = true;
+        if (room.type == RoomType::Start) {
+            startRoomID_ = room.id;
+        } else if (room.type == RoomType::Goal) {
+            goalRoomID_ = room.id;
+        }
+    }
+
+    rooms_ = std::move(rooms);
+    return true;
+}
+
+std::uint64_t StageGraphGenerator::GetSettingsHash() const noexcept {
+    std::uint64_t hash = kFnv1aOffsetBasis;
+    const std::uint32_t gridSize[] = { width_, height_, depth_ };
+    hash = HashFnv1a(hash, gridSize, sizeof(gridSize));
+    hash = HashFnv1a(hash, &branchProbability_, sizeof(branchProbability_));
+    for (const auto &entry : sideRoomTypes_) {
+        hash = HashFnv1a(hash, &entry.type, sizeof(entry.type));
+        hash = HashFnv1a(hash, &entry.weight, sizeof(entry.weight));
+    }
+    return hash;
+}
+
 const RoomNode *StageGraphGenerator::GetRoomByIndex(std::size_t index) const {
     if (index >= rooms_.size()) {
         return nullptr;
@@ -89,6 +89,15 @@ public:
     std::optional<std::uint32_t> GetStartRoomID() const noexcept { return startRoomID_; }
     std::optional<std::uint32_t> GetGoalRoomID() const noexcept { return goalRoomID_; }
 
+    /// @brief 保存しておいた生成結果（GetRooms）を復元する
+    /// @details StageGenerationService のキャッシュ等から使う。スタート・ゴールの部屋IDは部屋種別から求める。
+    ///          グリッドサイズは生成時と同じものを設定しておくこと
+    /// @return 部屋の座標がグリッド外・IDが登録順と一致しない・接続先の部屋が存在しない場合は false（生成結果は空になる）
+    bool RestoreRooms(std::vector<RoomNode> rooms);
+
+    /// @brief 生成結果に影響する設定（グリッドサイズ・寄り道の確率と種別。シードは含まない）のハッシュ値
+    std::uint64_t GetSettingsHash() const noexcept;
+
 private:
     RoomType PickSideRoomType();
     std::uint32_t AddRoom(RoomType type, std::uint32_t x, std::uint32_t y, std::uint32_t z);
@@ -1,7 +1,10 @@
 #include "Utilities/StageGridBuilder.h"
+#include "Utilities/FileIO/BinaryStream.h"
 
 #include <algorithm>
+#include <cmath>
 #include <utility>
+#include <vector>
 
 namespace KashipanEngine {
 
@@ -184,4 +187,39 @@ bool StageGridBuilder::GetRoomWorldCenter(const StageGraphGenerator &graph, std:
     return true;
 }
 
+void StageGridBuilder::WorldToGrid(const Vector3 &position, std::int32_t &outX, std::int32_t &outY, std::int32_t &outZ) const {
+    // タイルの中心がタイル座標×サイズの位置に来るため、半タイル分ずらしてから切り捨てる
+    const float inverseSize = tileWorldSize_ > 0.0f ? 1.0f / tileWorldSize_ : 1.0f;
+    outX = static_cast<std::int32_t>(std::floor(position.x * inverseSize + 0.5f));
+    outY = static_cast<std::int32_t>(std::floor(position.y * inverseSize + 0.5f));
+    outZ = static_cast<std::int32_t>(std::floor(position.z * inverseSize + 0.5f));
+}
+
+std::uint64_t StageGridBuilder::GetSettingsHash() const {
+    std::vector<std::uint8_t> data;
+    BinaryWriter writer(data);
+    writer.U32(roomSizeX_);
+    writer.U32(roomSizeY_);
+    writer.U32(roomSizeZ_);
+    writer.U32(roomSpacing_);
+    writer.U32(corridorWidth_);
+    writer.String(defaultRoomTileName_.value_or(""));
+    writer.U8(defaultRoomTileName_.has_value() ? 1 : 0);
+    writer.String(corridorTileName_.value_or(""));
+    writer.U8(corridorTileName_.has_value() ? 1 : 0);
+
+    // unordered_mapの列挙順に依存しないよう、部屋種別順に並べる
+    std::vector<std::pair<RoomType, const std::string *>> roomTileNames;
+    for (const auto &[type, name] : roomTileNames_) {
+        roomTileNames.emplace_back(type, &name);
+    }
+    std::sort(roomTileNames.begin(), roomTileNames.end(),
+        [](const auto &a, const auto &b) { return a.first < b.first; });
+    for (const auto &[type, name] : roomTileNames) {
+        writer.U8(static_cast<std::uint8_t>(type));
+        writer.String(*name);
+    }
+    return HashFnv1a(kFnv1aOffsetBasis, data.data(), data.size());
+}
+
 } // namespace KashipanEngine
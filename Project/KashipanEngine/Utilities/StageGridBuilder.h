@@ -37,6 +37,7 @@ public:
 
     /// @brief タイル1個分に対応する実際のワールド座標上のサイズ
     void SetTileWorldSize(float size);
+    float GetTileWorldSize() const noexcept { return tileWorldSize_; }
 
     /// @brief 部屋種別ごとに固定するタイル名を設定する
     void SetRoomTileName(RoomType type, const std::string &tileName);
@@ -64,10 +65,17 @@ public:
     /// @return 部屋が存在しない場合はfalse
     bool GetRoomWorldCenter(const StageGraphGenerator &graph, std::uint32_t roomID, Vector3 &outPosition) const;
 
+    /// @brief ワールド座標を含むタイルの座標（GetRoomWorldCenterの逆変換。グリッド外も負の値などでそのまま返す）
+    /// @details ChunkedWaveFunctionCollapse::GenerateAround にプレイヤー位置を渡す際などに使う
+    void WorldToGrid(const Vector3 &position, std::int32_t &outX, std::int32_t &outY, std::int32_t &outZ) const;
+
     /// @brief Buildで実際に必要となるWaveFunctionCollapseのグリッドサイズを取得する
     void GetRequiredGridSize(const StageGraphGenerator &graph,
         std::uint32_t &outWidth, std::uint32_t &outHeight, std::uint32_t &outDepth) const;
 
+    /// @brief Buildの結果に影響する設定（部屋・通路のサイズとタイル名。タイルのワールドサイズは含まない）のハッシュ値
+    std::uint64_t GetSettingsHash() const;
+
 private:
     /// @brief 抽象部屋グリッド上の1マス分が占めるタイル範囲の原点を求める
     std::uint32_t OriginOf(std::uint32_t slot, std::uint32_t cellSize) const;
@@ -1,22 +1,12 @@
 #include "Utilities/WaveFunctionCollapse.h"
+#include "Utilities/FileIO/BinaryStream.h"
 
 #include <algorithm>
-#include <iterator>
 
 namespace KashipanEngine {
 
 namespace {
 
-/// @brief Direction列挙の並び順（Up, Down, Left, Right, Front, Back）に対応する座標オフセット
-constexpr std::array<std::array<std::int32_t, 3>, WaveFunctionCollapse::kDirectionCount> kDirectionOffsets = { {
-    { 0, 1, 0 },   // Up
-    { 0, -1, 0 },  // Down
-    { -1, 0, 0 },  // Left
-    { 1, 0, 0 },   // Right
-    { 0, 0, 1 },   // Front
-    { 0, 0, -1 },  // Back
-} };
-
 /// @brief JSON保存/読込で使うDirection列挙の並び順に対応するキー名
 constexpr std::array<const char *, WaveFunctionCollapse::kDirectionCount> kDirectionKeys = {
     "up", "down", "left", "right", "front", "back",
@@ -33,7 +23,7 @@ void WaveFunctionCollapse::SetGridSize(std::uint32_t width, std::uint32_t height
     width_ = width;
     height_ = height;
     depth_ = depth;
-    grid_.assign(width_, std::vector<std::vector<Cell>>(height_, std::vector<Cell>(depth_)));
+    grid_.assign(static_cast<std::size_t>(width_) * height_ * depth_, Cell{});
     startPosition_.reset();
 }
 
@@ -41,7 +31,11 @@ bool WaveFunctionCollapse::RegisterTile(const Tile &tile) {
     if (tile.name.empty()) {
         return false;
     }
-    return tiles_.emplace(tile.name, tile).second;
+    if (!tiles_.emplace(tile.name, tile).second) {
+        return false;
+    }
+    ruleSet_.reset();
+    return true;
 }
 
 bool WaveFunctionCollapse::RegisterTile(const std::string &name) {
@@ -58,6 +52,7 @@ bool WaveFunctionCollapse::AddTileConnection(const std::string &tileName, Direct
     auto &connections = it->second.connections[static_cast<std::size_t>(direction)];
     if (std::find(connections.begin(), connections.end(), connectedTileName) == connections.end()) {
         connections.push_back(connectedTileName);
+        ruleSet_.reset();
     }
     return true;
 }
@@ -67,16 +62,14 @@ bool WaveFunctionCollapse::RemoveTile(const std::string &tileName) {
         return false;
     }
 
-    for (auto &plane : grid_) {
-        for (auto &row : plane) {
-            for (auto &cell : row) {
-                if (cell.fixedTileName == tileName) {
-                    cell.fixedTileName.reset();
-                }
-                if (cell.resolvedTileName == tileName) {
-                    cell.resolvedTileName.reset();
-                }
-            }
+    ruleSet_.reset();
+
+    for (auto &cell : grid_) {
+        if (cell.fixedTileName == tileName) {
+            cell.fixedTileName.reset();
+        }
+        if (cell.resolvedTile != WfcSolver::kUnresolvedTile && resolvedTileNames_[cell.resolvedTile] == tileName) {
+            cell.resolvedTile = WfcSolver::kUnresolvedTile;
         }
     }
     return true;
@@ -86,7 +79,7 @@ bool WaveFunctionCollapse::FixTile(std::uint32_t x, std::uint32_t y, std::uint32
     if (!IsInBounds(x, y, z) || !tiles_.contains(tileName)) {
         return false;
     }
-    grid_[x][y][z].fixedTileName = tileName;
+    grid_[CellIndexOf(x, y, z)].fixedTileName = tileName;
     return true;
 }
 
@@ -94,7 +87,7 @@ std::optional<std::string> WaveFunctionCollapse::GetFixedTile(std::uint32_t x, s
     if (!IsInBounds(x, y, z)) {
         return std::nullopt;
     }
-    return grid_[x][y][z].fixedTileName;
+    return grid_[CellIndexOf(x, y, z)].fixedTileName;
 }
 
 bool WaveFunctionCollapse::SetStartPosition(std::uint32_t x, std::uint32_t y, std::uint32_t z) {
@@ -109,191 +102,120 @@ std::optional<std::string> WaveFunctionCollapse::GetResolvedTile(std::uint32_t x
     if (!IsInBounds(x, y, z)) {
         return std::nullopt;
     }
-    return grid_[x][y][z].resolvedTileName;
+    const std::uint32_t resolved = grid_[CellIndexOf(x, y, z)].resolvedTile;
+    if (resolved == WfcSolver::kUnresolvedTile) {
+        return std::nullopt;
+    }
+    return resolvedTileNames_[resolved];
 }
 
-bool WaveFunctionCollapse::Solve() {
-    if (width_ == 0 || height_ == 0 || depth_ == 0 || tiles_.empty()) {
-        return false;
-    }
+std::shared_ptr<const WfcRuleSet> WaveFunctionCollapse::GetRuleSet() {
+    EnsureRuleSet();
+    return ruleSet_;
+}
 
-    for (auto &plane : grid_) {
-        for (auto &row : plane) {
-            for (auto &cell : row) {
-                cell.resolvedTileName.reset();
-            }
-        }
+void WaveFunctionCollapse::EnsureRuleSet() {
+    if (ruleSet_) {
+        return;
     }
 
-    // 候補集合の演算（ソート・積集合）を文字列比較で行うと遅いため、
-    // Solve内ではタイル名を一時的な整数インデックスへ変換して処理する
-    std::vector<const Tile *> tileList;
-    std::unordered_map<std::string, std::uint32_t> nameToIndex;
-    tileList.reserve(tiles_.size());
-    nameToIndex.reserve(tiles_.size());
+    // unordered_mapの列挙順に依存しないよう、インデックスは名前順に振る（同じシードで同じ結果にするため）
+    ruleTileNames_.clear();
+    ruleTileNames_.reserve(tiles_.size());
     for (const auto &[name, tile] : tiles_) {
-        nameToIndex.emplace(name, static_cast<std::uint32_t>(tileList.size()));
-        tileList.push_back(&tile);
+        ruleTileNames_.push_back(name);
+    }
+    std::sort(ruleTileNames_.begin(), ruleTileNames_.end());
+    ruleTileIndices_.clear();
+    for (std::uint32_t t = 0; t < ruleTileNames_.size(); ++t) {
+        ruleTileIndices_.emplace(ruleTileNames_[t], t);
     }
-    const std::uint32_t tileCount = static_cast<std::uint32_t>(tileList.size());
 
-    // 各タイルの方向別接続リストをインデックスへ変換しておく（未登録名の接続先は無視する）
-    std::vector<std::array<std::vector<std::uint32_t>, kDirectionCount>> connectionIndices(tileCount);
-    for (std::uint32_t t = 0; t < tileCount; ++t) {
+    // 未登録名の接続先は無視する
+    auto rules = std::make_shared<WfcRuleSet>(static_cast<std::uint32_t>(ruleTileNames_.size()));
+    for (std::uint32_t t = 0; t < ruleTileNames_.size(); ++t) {
+        const Tile &tile = tiles_.at(ruleTileNames_[t]);
         for (std::size_t dir = 0; dir < kDirectionCount; ++dir) {
-            auto &indices = connectionIndices[t][dir];
-            for (const auto &connectedName : tileList[t]->connections[dir]) {
-                auto it = nameToIndex.find(connectedName);
-                if (it != nameToIndex.end()) {
-                    indices.push_back(it->second);
+            for (const auto &connectedName : tile.connections[dir]) {
+                auto it = ruleTileIndices_.find(connectedName);
+                if (it != ruleTileIndices_.end()) {
+                    rules->Allow(t, dir, it->second);
                 }
             }
-            std::sort(indices.begin(), indices.end());
-            indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
         }
     }
+    rules->Build();
+    ruleSet_ = std::move(rules);
+}
 
-    std::vector<std::uint32_t> allTileIndices(tileCount);
-    for (std::uint32_t t = 0; t < tileCount; ++t) allTileIndices[t] = t;
+bool WaveFunctionCollapse::Solve() {
+    return Solve(nullptr);
+}
 
-    // 各セルの残り候補タイルインデックス一覧（波動関数の重ね合わせ状態）
-    using Possibilities = std::vector<std::vector<std::vector<std::vector<std::uint32_t>>>>;
-    Possibilities possibilities(width_,
-        std::vector<std::vector<std::vector<std::uint32_t>>>(height_,
-            std::vector<std::vector<std::uint32_t>>(depth_)));
+bool WaveFunctionCollapse::Solve(const std::function<bool(float)> &onProgress) {
+    for (auto &cell : grid_) {
+        cell.resolvedTile = WfcSolver::kUnresolvedTile;
+    }
+    if (width_ == 0 || height_ == 0 || depth_ == 0 || tiles_.empty()) {
+        return false;
+    }
 
-    std::vector<std::array<std::uint32_t, 3>> queue;
+    EnsureRuleSet();
+    WfcSolver solver(*ruleSet_, width_, height_, depth_);
     for (std::uint32_t x = 0; x < width_; ++x) {
         for (std::uint32_t y = 0; y < height_; ++y) {
             for (std::uint32_t z = 0; z < depth_; ++z) {
-                if (const auto &fixed = grid_[x][y][z].fixedTileName) {
-                    auto it = nameToIndex.find(*fixed);
-                    if (it == nameToIndex.end()) {
-                        // FixTile/RemoveTileの整合性維持により通常起こらないが、念のため未登録名は全候補として扱う
-                        possibilities[x][y][z] = allTileIndices;
-                        continue;
+                if (const auto &fixed = grid_[CellIndexOf(x, y, z)].fixedTileName) {
+                    // FixTile/RemoveTileの整合性維持により通常起こらないが、念のため未登録名は全候補として扱う
+                    auto it = ruleTileIndices_.find(*fixed);
+                    if (it != ruleTileIndices_.end()) {
+                        solver.FixTile(x, y, z, it->second);
                     }
-                    possibilities[x][y][z] = { it->second };
-                    queue.push_back({ x, y, z });
-                } else {
-                    possibilities[x][y][z] = allTileIndices;
                 }
             }
         }
     }
+    if (startPosition_) {
+        const auto &[sx, sy, sz] = *startPosition_;
+        solver.SetStartCell(sx, sy, sz);
+    }
 
-    // 指定セルの候補集合から、各方向の隣接セルの候補を絞り込み、変化があれば伝播キューへ積む
-    auto propagateFrom = [&](std::uint32_t x, std::uint32_t y, std::uint32_t z) -> bool {
-        for (std::size_t dir = 0; dir < kDirectionCount; ++dir) {
-            const auto &offset = kDirectionOffsets[dir];
-            const std::int64_t nx = static_cast<std::int64_t>(x) + offset[0];
-            const std::int64_t ny = static_cast<std::int64_t>(y) + offset[1];
-            const std::int64_t nz = static_cast<std::int64_t>(z) + offset[2];
-            if (nx < 0 || ny < 0 || nz < 0 ||
-                nx >= static_cast<std::int64_t>(width_) ||
-                ny >= static_cast<std::int64_t>(height_) ||
-                nz >= static_cast<std::int64_t>(depth_)) {
-                continue;
-            }
-
-            std::vector<std::uint32_t> allowed;
-            for (std::uint32_t candidate : possibilities[x][y][z]) {
-                const auto &connections = connectionIndices[candidate][dir];
-                allowed.insert(allowed.end(), connections.begin(), connections.end());
-            }
-            std::sort(allowed.begin(), allowed.end());
-            allowed.erase(std::unique(allowed.begin(), allowed.end()), allowed.end());
-
-            auto &neighborPossibilities = possibilities[static_cast<std::size_t>(nx)][static_cast<std::size_t>(ny)][static_cast<std::size_t>(nz)];
-            std::vector<std::uint32_t> filtered;
-            filtered.reserve(neighborPossibilities.size());
-            std::set_intersection(neighborPossibilities.begin(), neighborPossibilities.end(),
-                allowed.begin(), allowed.end(), std::back_inserter(filtered));
+    WfcSolveSettings settings = solveSettings_;
+    settings.onProgress = onProgress;
+    if (!solver.Solve(randomEngine_, settings)) {
+        return false;
+    }
 
-            if (filtered.size() == neighborPossibilities.size()) {
-                continue;
-            }
-            if (filtered.empty()) {
-                return false; // 矛盾（候補が0件になった）
-            }
-            neighborPossibilities = std::move(filtered);
-            queue.push_back({ static_cast<std::uint32_t>(nx), static_cast<std::uint32_t>(ny), static_cast<std::uint32_t>(nz) });
-        }
-        return true;
-    };
-
-    std::size_t head = 0;
-    while (head < queue.size()) {
-        const auto [x, y, z] = queue[head++];
-        if (!propagateFrom(x, y, z)) {
-            return false;
-        }
+    resolvedTileNames_ = ruleTileNames_;
+    const auto &resolvedTiles = solver.GetResolvedTiles();
+    for (std::size_t i = 0; i < grid_.size(); ++i) {
+        grid_[i].resolvedTile = resolvedTiles[i];
     }
+    return true;
+}
 
-    bool firstCollapse = true;
-    while (true) {
-        std::optional<std::array<std::uint32_t, 3>> target;
+std::uint64_t WaveFunctionCollapse::GetTileSetHash() const {
+    std::vector<std::uint8_t> data;
+    BinaryWriter writer(data);
+    writer.U32(solveSettings_.maxBacktracks);
+    writer.U32(solveSettings_.maxRestarts);
 
-        if (firstCollapse && startPosition_) {
-            const auto &[sx, sy, sz] = *startPosition_;
-            if (possibilities[sx][sy][sz].size() > 1) {
-                target = *startPosition_;
-            }
-        }
-        firstCollapse = false;
-
-        if (!target) {
-            std::size_t bestCount = 0;
-            std::vector<std::array<std::uint32_t, 3>> candidates;
-            for (std::uint32_t x = 0; x < width_; ++x) {
-                for (std::uint32_t y = 0; y < height_; ++y) {
-                    for (std::uint32_t z = 0; z < depth_; ++z) {
-                        const std::size_t count = possibilities[x][y][z].size();
-                        if (count <= 1) {
-                            continue;
-                        }
-                        if (candidates.empty() || count < bestCount) {
-                            bestCount = count;
-                            candidates.clear();
-                            candidates.push_back({ x, y, z });
-                        } else if (count == bestCount) {
-                            candidates.push_back({ x, y, z });
-                        }
-                    }
-                }
-            }
-            if (candidates.empty()) {
-                break; // 全セル確定済み
-            }
-            std::uniform_int_distribution<std::size_t> tieBreak(0, candidates.size() - 1);
-            target = candidates[tieBreak(randomEngine_)];
-        }
-
-        const auto &[tx, ty, tz] = *target;
-        auto &options = possibilities[tx][ty][tz];
-        std::uniform_int_distribution<std::size_t> pick(0, options.size() - 1);
-        const std::uint32_t chosen = options[pick(randomEngine_)];
-        options = { chosen };
-
-        queue.clear();
-        queue.push_back({ tx, ty, tz });
-        head = 0;
-        while (head < queue.size()) {
-            const auto [x, y, z] = queue[head++];
-            if (!propagateFrom(x, y, z)) {
-                return false;
-            }
-        }
+    // unordered_mapの列挙順・接続の登録順に依存しないよう、名前順に並べる
+    std::vector<const Tile *> tiles;
+    tiles.reserve(tiles_.size());
+    for (const auto &[name, tile] : tiles_) {
+        tiles.push_back(&tile);
     }
-
-    for (std::uint32_t x = 0; x < width_; ++x) {
-        for (std::uint32_t y = 0; y < height_; ++y) {
-            for (std::uint32_t z = 0; z < depth_; ++z) {
-                grid_[x][y][z].resolvedTileName = tileList[possibilities[x][y][z].front()]->name;
-            }
+    std::sort(tiles.begin(), tiles.end(), [](const Tile *a, const Tile *b) { return a->name < b->name; });
+    for (const Tile *tile : tiles) {
+        writer.String(tile->name);
+        for (const auto &connections : tile->connections) {
+            std::vector<std::string> sorted = connections;
+            std::sort(sorted.begin(), sorted.end());
+            writer.Strings(sorted);
         }
     }
-    return true;
+    return HashFnv1a(kFnv1aOffsetBasis, data.data(), data.size());
 }
 
 JSON WaveFunctionCollapse::SaveToJson() const {
@@ -302,6 +224,8 @@ JSON WaveFunctionCollapse::SaveToJson() const {
     json["gridWidth"] = width_;
     json["gridHeight"] = height_;
     json["gridDepth"] = depth_;
+    json["maxBacktracks"] = solveSettings_.maxBacktracks;
+    json["maxRestarts"] = solveSettings_.maxRestarts;
 
     JSON tilesJson = JSON::array();
     for (const auto &[name, tile] : tiles_) {
@@ -320,7 +244,7 @@ JSON WaveFunctionCollapse::SaveToJson() const {
     for (std::uint32_t x = 0; x < width_; ++x) {
         for (std::uint32_t y = 0; y < height_; ++y) {
             for (std::uint32_t z = 0; z < depth_; ++z) {
-                if (const auto &fixed = grid_[x][y][z].fixedTileName) {
+                if (const auto &fixed = grid_[CellIndexOf(x, y, z)].fixedTileName) {
                     JSON entry = JSON::object();
                     entry["x"] = x;
                     entry["y"] = y;
@@ -351,6 +275,8 @@ bool WaveFunctionCollapse::LoadFromJson(const JSON &json) {
 
     seed_ = json.value("seed", std::uint32_t{ 0 });
     randomEngine_.seed(seed_);
+    solveSettings_.maxBacktracks = json.value("maxBacktracks", WfcSolveSettings{}.maxBacktracks);
+    solveSettings_.maxRestarts = json.value("maxRestarts", WfcSolveSettings{}.maxRestarts);
 
     SetGridSize(
         json.at("gridWidth").get<std::uint32_t>(),
@@ -358,6 +284,7 @@ bool WaveFunctionCollapse::LoadFromJson(const JSON &json) {
         json.at("gridDepth").get<std::uint32_t>());
 
     tiles_.clear();
+    ruleSet_.reset();
     if (json.contains("tiles")) {
         for (const auto &tileJson : json.at("tiles")) {
             Tile tile;
@@ -1,6 +1,8 @@
 #pragma once
 #include <array>
 #include <cstdint>
+#include <functional>
+#include <memory>
 #include <optional>
 #include <random>
 #include <string>
@@ -8,13 +10,15 @@
 #include <vector>
 
 #include "Utilities/FileIO/JSON.h"
+#include "Utilities/WfcSolver.h"
 
 namespace KashipanEngine {
 
 /// @brief 波動関数崩壊アルゴリズム（Wave Function Collapse）で使うタイル群と、
 ///        タイルを配置していく3次元グリッドを管理するユーティリティクラス
-/// @details タイルは名前（文字列）で管理する。Solve()の内部では性能のため
-///          名前を整数インデックスへ変換してから候補集合の演算を行う
+/// @details タイルは名前（文字列）で管理する。Solve()の内部では名前順に振った整数インデックスと
+///          接続規則のビットマスク（WfcRuleSet）を使って WfcSolver で求解する。接続規則は
+///          タイルの登録・接続の変更があるまで使い回す
 class WaveFunctionCollapse final {
 public:
     /// @brief タイルの接続方向
@@ -28,7 +32,7 @@ public:
     };
 
     /// @brief 接続方向の数（上下左右前奥の最大6方向）
-    static constexpr std::size_t kDirectionCount = 6;
+    static constexpr std::size_t kDirectionCount = kWfcDirectionCount;
 
     /// @brief WFCで扱うタイル1種類分の定義
     struct Tile final {
@@ -84,6 +88,12 @@ public:
     /// @brief 登録済みのタイル一覧を取得する
     const std::unordered_map<std::string, Tile> &GetTiles() const noexcept { return tiles_; }
 
+    /// @brief 登録済みのタイルから構築した接続規則を取得する（ChunkedWaveFunctionCollapse 等で共有する）
+    /// @details タイルの登録・接続の変更までは同じものを返す。タイルインデックスは GetRuleTileNames の並び
+    std::shared_ptr<const WfcRuleSet> GetRuleSet();
+    /// @brief GetRuleSet のタイルインデックスに対応するタイル名（名前順。GetRuleSet 呼び出し後に有効）
+    const std::vector<std::string> &GetRuleTileNames() const noexcept { return ruleTileNames_; }
+
     /// @brief 指定した座標のタイルを固定する
     /// @param x,y,z 固定するグリッド座標
     /// @param tileName 固定するタイルの名前
@@ -102,14 +112,30 @@ public:
     /// @return 未指定の場合はstd::nullopt
     std::optional<std::array<std::uint32_t, 3>> GetStartPosition() const noexcept { return startPosition_; }
 
+    /// @brief 矛盾時のバックトラック回数の上限（1回の試行あたり。超えると最初からやり直す）
+    void SetMaxBacktracks(std::uint32_t maxBacktracks) noexcept { solveSettings_.maxBacktracks = maxBacktracks; }
+    std::uint32_t GetMaxBacktracks() const noexcept { return solveSettings_.maxBacktracks; }
+
+    /// @brief バックトラックが上限を超えた際に最初からやり直す回数の上限
+    void SetMaxRestarts(std::uint32_t maxRestarts) noexcept { solveSettings_.maxRestarts = maxRestarts; }
+    std::uint32_t GetMaxRestarts() const noexcept { return solveSettings_.maxRestarts; }
+
+    /// @brief 登録タイル・接続・打ち切り設定から求めたタイルセットのハッシュ値（シード・グリッドは含まない）
+    /// @details タイルセットのバージョンとして、生成結果のキャッシュキー（StageGenerationService）に使う
+    std::uint64_t GetTileSetHash() const;
+
     /// @brief 波動関数崩壊アルゴリズムを実行し、グリッド全体のタイルを確定させる
     /// @details 固定済みのセルはFixTileで指定したタイルを制約として扱う。生成開始座標が
     ///          指定されている場合、最初の1マスはその座標から崩壊させる（以降はエントロピー
     ///          （残り候補数）が最小のセルを乱数で選びながら崩壊・伝播を繰り返す）。
-    ///          矛盾（候補が0件になるセル）が発生した場合はバックトラックせずfalseを返す。
+    ///          矛盾（候補が0件になるセル）が発生した場合は直前の選択を取り消して別の候補を試し、
+    ///          バックトラックが上限を超えた場合は最初からやり直す。
     ///          再実行するたびに前回の解決結果はクリアされ、シードに基づき再抽選される。
     /// @return グリッド全体を矛盾なく確定できた場合はtrue
     bool Solve();
+    /// @brief Solve()と同じ求解を、途中経過を通知しながら行う
+    /// @param onProgress 確定したセルの割合（0.0～1.0）を受け取る。falseを返すと中断し、Solveはfalseを返す
+    bool Solve(const std::function<bool(float)> &onProgress);
 
     /// @brief Solve()によって確定したタイル名を取得する
     /// @return 未確定（Solve未実行・矛盾で失敗・座標が範囲外）の場合はstd::nullopt
@@ -129,17 +155,24 @@ private:
     struct Cell final {
         /// @brief 固定されているタイル名（未固定の場合はstd::nullopt）
         std::optional<std::string> fixedTileName;
-        /// @brief Solve()によって確定したタイル名（未確定の場合はstd::nullopt）
-        std::optional<std::string> resolvedTileName;
+        /// @brief Solve()によって確定したタイル（resolvedTileNames_のインデックス。未確定の場合はWfcSolver::kUnresolvedTile）
+        std::uint32_t resolvedTile = WfcSolver::kUnresolvedTile;
     };
 
     bool IsInBounds(std::uint32_t x, std::uint32_t y, std::uint32_t z) const noexcept;
+    std::size_t CellIndexOf(std::uint32_t x, std::uint32_t y, std::uint32_t z) const noexcept {
+        return (static_cast<std::size_t>(x) * height_ + y) * depth_ + z;
+    }
+    /// @brief 接続規則が未構築（またはタイル変更で破棄済み）であれば構築する
+    void EnsureRuleSet();
 
     std::uint32_t width_ = 0;
     std::uint32_t height_ = 0;
     std::uint32_t depth_ = 0;
-    /// @brief タイルを格納するための3次元配列（[x][y][z]の順で参照する）
-    std::vector<std::vector<std::vector<Cell>>> grid_;
+    /// @brief タイルを格納するための平坦な配列（[x][y][z]の順に並ぶ。WfcSolverと同じ並び）
+    std::vector<Cell> grid_;
+    /// @brief 直前のSolve()時点のタイル名（Cell::resolvedTileの参照先）
+    std::vector<std::string> resolvedTileNames_;
 
     std::uint32_t seed_ = 0;
     std::mt19937 randomEngine_{ seed_ };
@@ -147,6 +180,14 @@ private:
     /// @brief 公開API経由で登録されたタイル群（キーはタイル名）
     std::unordered_map<std::string, Tile> tiles_;
 
+    /// @brief tiles_から構築した接続規則（タイルの登録・接続の変更時に破棄する）
+    std::shared_ptr<const WfcRuleSet> ruleSet_;
+    /// @brief ruleSet_のタイルインデックスに対応するタイル名（名前順）
+    std::vector<std::string> ruleTileNames_;
+    std::unordered_map<std::string, std::uint32_t> ruleTileIndices_;
+
+    WfcSolveSettings solveSettings_;
+
     std::optional<std::array<std::uint32_t, 3>> startPosition_;
 };
 
@@ -0,0 +1,345 @@
+#include "Utilities/WfcSolver.h"
+
+#include <algorithm>
+#include <bit>
+
+namespace KashipanEngine {
+
+namespace {
+
+/// @brief 方向ごとの座標オフセット（Up, Down, Left, Right, Front, Back）
+constexpr std::array<std::array<std::int32_t, 3>, kWfcDirectionCount> kDirectionOffsets = { {
+    { 0, 1, 0 },
+    { 0, -1, 0 },
+    { -1, 0, 0 },
+    { 1, 0, 0 },
+    { 0, 0, 1 },
+    { 0, 0, -1 },
+} };
+
+bool TestBit(const std::uint64_t *bits, std::uint32_t index) noexcept {
+    return (bits[index >> 6] >> (index & 63u)) & 1u;
+}
+
+std::uint32_t CountBits(const std::uint64_t *bits, std::uint32_t wordCount) noexcept {
+    std::uint32_t count = 0;
+    for (std::uint32_t w = 0; w < wordCount; ++w) count += static_cast<std::uint32_t>(std::popcount(bits[w]));
+    return count;
+}
+
+/// @brief 立っているビットを小さい順に列挙する
+template <typename Func>
+void ForEachBit(const std::uint64_t *bits, std::uint32_t wordCount, Func &&func) {
+    for (std::uint32_t w = 0; w < wordCount; ++w) {
+        std::uint64_t word = bits[w];
+        while (word != 0) {
+            func(w * 64u + static_cast<std::uint32_t>(std::countr_zero(word)));
+            word &= word - 1;
+        }
+    }
+}
+
+/// @brief ヒープの先頭に（残り候補数, 乱数）が最小の要素が来るようにする比較
+template <typename Entry>
+bool HeapGreater(const Entry &lhs, const Entry &rhs) noexcept {
+    if (lhs.count != rhs.count) return lhs.count > rhs.count;
+    if (lhs.noise != rhs.noise) return lhs.noise > rhs.noise;
+    return lhs.cell > rhs.cell;
+}
+
+} // namespace
+
+//==================================================
+// WfcRuleSet
+//==================================================
+
+WfcRuleSet::WfcRuleSet(std::uint32_t tileCount)
+    : tileCount_(tileCount), wordCount_((tileCount + 63u) / 64u) {
+    declaredMasks_.assign(kWfcDirectionCount * tileCount_ * wordCount_, 0);
+}
+
+void WfcRuleSet::Allow(std::uint32_t tile, std::size_t direction, std::uint32_t neighborTile) {
+    if (tile >= tileCount_ || neighborTile >= tileCount_ || direction >= kWfcDirectionCount) return;
+    declaredMasks_[MaskOffset(direction, tile) + (neighborTile >> 6)] |= std::uint64_t{ 1 } << (neighborTile & 63u);
+}
+
+void WfcRuleSet::Build() {
+    // 片側だけの許可は、最終的に両側のセルが確定した時点で必ず矛盾するため最初から除いておく
+    compatibleMasks_.assign(declaredMasks_.size(), 0);
+    compatibleTiles_.assign(kWfcDirectionCount * tileCount_, {});
+    for (std::size_t dir = 0; dir < kWfcDirectionCount; ++dir) {
+        const std::size_t opposite = GetOppositeWfcDirection(dir);
+        for (std::uint32_t a = 0; a < tileCount_; ++a) {
+            const std::uint64_t *declared = declaredMasks_.data() + MaskOffset(dir, a);
+            ForEachBit(declared, wordCount_, [&](std::uint32_t b) {
+                if (!TestBit(declaredMasks_.data() + MaskOffset(opposite, b), a)) return;
+                compatibleMasks_[MaskOffset(dir, a) + (b >> 6)] |= std::uint64_t{ 1 } << (b & 63u);
+                compatibleTiles_[dir * tileCount_ + a].push_back(b);
+            });
+        }
+    }
+}
+
+//==================================================
+// WfcSolver
+//==================================================
+
+WfcSolver::WfcSolver(const WfcRuleSet &rules, std::uint32_t width, std::uint32_t height, std::uint32_t depth)
+    : rules_(rules), width_(width), height_(height), depth_(depth),
+    tileCount_(rules.GetTileCount()), wordCount_(rules.GetWordCount()),
+    cellCount_(static_cast<std::size_t>(width) * height * depth) {
+    neighbors_.resize(cellCount_);
+    for (std::uint32_t x = 0; x < width_; ++x) {
+        for (std::uint32_t y = 0; y < height_; ++y) {
+            for (std::uint32_t z = 0; z < depth_; ++z) {
+                auto &neighbors = neighbors_[GetCellIndex(x, y, z)];
+                for (std::size_t dir = 0; dir < kWfcDirectionCount; ++dir) {
+                    const std::int64_t nx = static_cast<std::int64_t>(x) + kDirectionOffsets[dir][0];
+                    const std::int64_t ny = static_cast<std::int64_t>(y) + kDirectionOffsets[dir][1];
+                    const std::int64_t nz = static_cast<std::int64_t>(z) + kDirectionOffsets[dir][2];
+                    const bool inside = nx >= 0 && ny >= 0 && nz >= 0 &&
+                        nx < static_cast<std::int64_t>(width_) && ny < static_cast<std::int64_t>(height_) && nz < static_cast<std::int64_t>(depth_);
+                    neighbors[dir] = inside
+                        ? static_cast<std::int32_t>(GetCellIndex(static_cast<std::uint32_t>(nx), static_cast<std::uint32_t>(ny), static_cast<std::uint32_t>(nz)))
+                        : -1;
+                }
+            }
+        }
+    }
+
+    // 全タイルを候補とした状態から始める（端数ワードの余分なビットは立てない）
+    initialDomains_.assign(cellCount_ * wordCount_, ~std::uint64_t{ 0 });
+    if (const std::uint32_t rest = tileCount_ & 63u; rest != 0) {
+        const std::uint64_t lastWordMask = (std::uint64_t{ 1 } << rest) - 1;
+        for (std::size_t cell = 0; cell < cellCount_; ++cell) {
+            initialDomains_[cell * wordCount_ + wordCount_ - 1] = lastWordMask;
+        }
+    }
+}
+
+void WfcSolver::FixTile(std::uint32_t x, std::uint32_t y, std::uint32_t z, std::uint32_t tile) {
+    std::vector<std::uint64_t> mask(wordCount_, 0);
+    if (tile < tileCount_) mask[tile >> 6] = std::uint64_t{ 1 } << (tile & 63u);
+    Constrain(x, y, z, mask);
+}
+
+void WfcSolver::Constrain(std::uint32_t x, std::uint32_t y, std::uint32_t z, std::span<const std::uint64_t> mask) {
+    if (x >= width_ || y >= height_ || z >= depth_) return;
+    std::uint64_t *domain = initialDomains_.data() + GetCellIndex(x, y, z) * wordCount_;
+    for (std::uint32_t w = 0; w < wordCount_; ++w) {
+        domain[w] &= w < mask.size() ? mask[w] : 0;
+    }
+}
+
+void WfcSolver::ConstrainToNeighbor(std::uint32_t x, std::uint32_t y, std::uint32_t z, std::size_t direction, std::uint32_t neighborTile) {
+    if (direction >= kWfcDirectionCount || neighborTile >= tileCount_) return;
+    // direction 側に neighborTile を置けるタイル = neighborTile の逆方向側に置けるタイル
+    Constrain(x, y, z, rules_.GetCompatibleMask(GetOppositeWfcDirection(direction), neighborTile));
+}
+
+void WfcSolver::SetStartCell(std::uint32_t x, std::uint32_t y, std::uint32_t z) {
+    if (x >= width_ || y >= height_ || z >= depth_) return;
+    startCell_ = static_cast<std::uint32_t>(GetCellIndex(x, y, z));
+}
+
+bool WfcSolver::Solve(std::mt19937 &randomEngine, const WfcSolveSettings &settings) {
+    resolvedTiles_.clear();
+    backtrackCount_ = 0;
+    restartCount_ = 0;
+    isAborted_ = false;
+    if (tileCount_ == 0 || cellCount_ == 0) return false;
+
+    while (true) {
+        switch (RunAttempt(randomEngine, settings)) {
+        case AttemptResult::Solved:
+            resolvedTiles_.resize(cellCount_);
+            for (std::size_t cell = 0; cell < cellCount_; ++cell) {
+                ForEachBit(DomainOf(cell), wordCount_, [&](std::uint32_t tile) { resolvedTiles_[cell] = tile; });
+            }
+            return true;
+        case AttemptResult::Unsatisfiable:
+            return false;
+        case AttemptResult::Aborted:
+            isAborted_ = true;
+            return false;
+        case AttemptResult::GaveUp:
+            if (restartCount_ >= settings.maxRestarts) return false;
+            ++restartCount_;
+            break;
+        }
+    }
+}
+
+WfcSolver::AttemptResult WfcSolver::RunAttempt(std::mt19937 &randomEngine, const WfcSolveSettings &settings) {
+    if (!InitializeAttempt(randomEngine)) return AttemptResult::Unsatisfiable;
+
+    std::uint32_t attemptBacktracks = 0;
+    std::uint32_t collapseCount = 0;
+    bool firstCollapse = true;
+    while (true) {
+        if (settings.onProgress && settings.progressInterval > 0 && ++collapseCount % settings.progressInterval == 0) {
+            if (!settings.onProgress(static_cast<float>(resolvedCellCount_) / static_cast<float>(cellCount_))) {
+                return AttemptResult::Aborted;
+            }
+        }
+        std::optional<std::uint32_t> target;
+        if (firstCollapse && startCell_ && domainCounts_[*startCell_] > 1) {
+            target = *startCell_;
+        }
+        firstCollapse = false;
+        if (!target) target = PopLowestEntropyCell();
+        if (!target) return AttemptResult::Solved;
+
+        const std::uint32_t cell = *target;
+        std::uniform_int_distribution<std::uint32_t> pick(0, domainCounts_[cell] - 1);
+        std::uint32_t remaining = pick(randomEngine);
+        std::uint32_t chosen = 0;
+        ForEachBit(DomainOf(cell), wordCount_, [&](std::uint32_t tile) {
+            if (remaining-- == 0) chosen = tile;
+        });
+
+        decisions_.push_back({ cell, chosen, trail_.size() });
+        ForEachBit(DomainOf(cell), wordCount_, [&](std::uint32_t tile) {
+            if (tile != chosen) pendingBans_.emplace_back(cell, tile);
+        });
+
+        // 矛盾したら直前の選択を取り消し、選んだタイルを候補から外して伝播し直す
+        bool consistent = Propagate();
+        while (!consistent) {
+            if (decisions_.empty()) return AttemptResult::Unsatisfiable;
+            if (attemptBacktracks >= settings.maxBacktracks) return AttemptResult::GaveUp;
+            ++attemptBacktracks;
+            ++backtrackCount_;
+
+            const Decision decision = decisions_.back();
+            decisions_.pop_back();
+            pendingBans_.clear();
+            UndoTo(decision.trailMark);
+            pendingBans_.emplace_back(decision.cell, decision.tile);
+            consistent = Propagate();
+        }
+    }
+}
+
+bool WfcSolver::InitializeAttempt(std::mt19937 &randomEngine) {
+    domains_ = initialDomains_;
+    domainCounts_.resize(cellCount_);
+    resolvedCellCount_ = 0;
+    for (std::size_t cell = 0; cell < cellCount_; ++cell) {
+        domainCounts_[cell] = CountBits(DomainOf(cell), wordCount_);
+        if (domainCounts_[cell] == 0) return false;
+        if (domainCounts_[cell] == 1) ++resolvedCellCount_;
+    }
+
+    cellNoise_.resize(cellCount_);
+    for (auto &noise : cellNoise_) noise = randomEngine();
+
+    supports_.assign(cellCount_ * kWfcDirectionCount * tileCount_, 0);
+    trail_.clear();
+    pendingBans_.clear();
+    decisions_.clear();
+    heap_.clear();
+    for (std::size_t cell = 0; cell < cellCount_; ++cell) {
+        for (std::size_t dir = 0; dir < kWfcDirectionCount; ++dir) {
+            const std::int32_t neighbor = neighbors_[cell][dir];
+            if (neighbor < 0) continue;
+            const std::uint64_t *neighborDomain = DomainOf(static_cast<std::size_t>(neighbor));
+            for (std::uint32_t tile = 0; tile < tileCount_; ++tile) {
+                const auto compatible = rules_.GetCompatibleMask(dir, tile);
+                std::uint32_t support = 0;
+                for (std::uint32_t w = 0; w < wordCount_; ++w) {
+                    support += static_cast<std::uint32_t>(std::popcount(compatible[w] & neighborDomain[w]));
+                }
+                SupportOf(cell, dir, tile) = static_cast<std::uint16_t>(support);
+                if (support == 0 && TestBit(DomainOf(cell), tile)) pendingBans_.emplace_back(static_cast<std::uint32_t>(cell), tile);
+            }
+        }
+    }
+    if (!Propagate()) return false;
+    // 初期制約による絞り込みは取り消す対象にならない
+    trail_.clear();
+
+    heap_.clear();
+    for (std::size_t cell = 0; cell < cellCount_; ++cell) {
+        if (domainCounts_[cell] > 1) PushHeap(static_cast<std::uint32_t>(cell));
+    }
+    return true;
+}
+
+bool WfcSolver::Ban(std::uint32_t cell, std::uint32_t tile) {
+    DomainOf(cell)[tile >> 6] &= ~(std::uint64_t{ 1 } << (tile & 63u));
+    --domainCounts_[cell];
+    if (domainCounts_[cell] == 1) {
+        ++resolvedCellCount_;
+    } else if (domainCounts_[cell] == 0) {
+        --resolvedCellCount_;
+    }
+    trail_.emplace_back(cell, tile);
+
+    for (std::size_t dir = 0; dir < kWfcDirectionCount; ++dir) {
+        const std::int32_t neighbor = neighbors_[cell][dir];
+        if (neighbor < 0) continue;
+        const std::size_t opposite = GetOppositeWfcDirection(dir);
+        const std::uint64_t *neighborDomain = DomainOf(static_cast<std::size_t>(neighbor));
+        for (const std::uint32_t neighborTile : rules_.GetCompatibleTiles(dir, tile)) {
+            if (--SupportOf(static_cast<std::size_t>(neighbor), opposite, neighborTile) == 0 && TestBit(neighborDomain, neighborTile)) {
+                pendingBans_.emplace_back(static_cast<std::uint32_t>(neighbor), neighborTile);
+            }
+        }
+    }
+
+    if (domainCounts_[cell] == 0) return false;
+    if (domainCounts_[cell] > 1) PushHeap(cell);
+    return true;
+}
+
+bool WfcSolver::Propagate() {
+    while (!pendingBans_.empty()) {
+        const auto [cell, tile] = pendingBans_.back();
+        pendingBans_.pop_back();
+        if (!TestBit(DomainOf(cell), tile)) continue;
+        if (!Ban(cell, tile)) return false;
+    }
+    return true;
+}
+
+void WfcSolver::UndoTo(std::size_t trailMark) {
+    while (trail_.size() > trailMark) {
+        const auto [cell, tile] = trail_.back();
+        trail_.pop_back();
+        DomainOf(cell)[tile >> 6] |= std::uint64_t{ 1 } << (tile & 63u);
+        ++domainCounts_[cell];
+        if (domainCounts_[cell] == 1) {
+            ++resolvedCellCount_;
+        } else if (domainCounts_[cell] == 2) {
+            --resolvedCellCount_;
+        }
+
+        for (std::size_t dir = 0; dir < kWfcDirectionCount; ++dir) {
+            const std::int32_t neighbor = neighbors_[cell][dir];
+            if (neighbor < 0) continue;
+            const std::size_t opposite = GetOppositeWfcDirection(dir);
+            for (const std::uint32_t neighborTile : rules_.GetCompatibleTiles(dir, tile)) {
+                ++SupportOf(static_cast<std::size_t>(neighbor), opposite, neighborTile);
+            }
+        }
+        if (domainCounts_[cell] > 1) PushHeap(cell);
+    }
+}
+
+std::optional<std::uint32_t> WfcSolver::PopLowestEntropyCell() {
+    while (!heap_.empty()) {
+        std::pop_heap(heap_.begin(), heap_.end(), HeapGreater<HeapEntry>);
+        const HeapEntry entry = heap_.back();
+        heap_.pop_back();
+        if (entry.count > 1 && domainCounts_[entry.cell] == entry.count) return entry.cell;
+    }
+    return std::nullopt;
+}
+
+void WfcSolver::PushHeap(std::uint32_t cell) {
+    heap_.push_back({ domainCounts_[cell], cellNoise_[cell], cell });
+    std::push_heap(heap_.begin(), heap_.end(), HeapGreater<HeapEntry>);
+}
+
+} // namespace KashipanEngine
@@ -0,0 +1,194 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <random>
+#include <span>
+#include <vector>
+
+namespace KashipanEngine {
+
+/// @brief WFCの接続方向の数（WaveFunctionCollapse::Direction と同じ並び: 上下左右前奥）
+inline constexpr std::size_t kWfcDirectionCount = 6;
+
+/// @brief 指定方向の逆方向（Up⇔Down, Left⇔Right, Front⇔Back）
+constexpr std::size_t GetOppositeWfcDirection(std::size_t direction) noexcept {
+    return direction ^ 1u;
+}
+
+/// @brief タイル同士の接続規則をインデックスとビットマスクで保持する（WfcSolver用）
+/// @details Allow で片側ずつ登録した接続を Build で「双方が互いを許可している組」だけに絞り、
+///          方向・タイルごとに接続可能なタイル集合のビットマスクと一覧を作る。
+///          Build 後は読み取り専用のため、複数スレッドのソルバーから共有してよい
+class WfcRuleSet final {
+public:
+    explicit WfcRuleSet(std::uint32_t tileCount = 0);
+
+    /// @brief tile の direction 側に neighborTile を置けることを登録する（逆側の許可は別途必要）
+    void Allow(std::uint32_t tile, std::size_t direction, std::uint32_t neighborTile);
+    /// @brief 登録した接続からビットマスクと一覧を構築する
+    void Build();
+
+    std::uint32_t GetTileCount() const noexcept { return tileCount_; }
+    /// @brief タイル集合1つ分のビットマスクの64bitワード数
+    std::uint32_t GetWordCount() const noexcept { return wordCount_; }
+
+    /// @brief tile の direction 側に置けるタイル集合（GetWordCount ワード）
+    std::span<const std::uint64_t> GetCompatibleMask(std::size_t direction, std::uint32_t tile) const noexcept {
+        return { compatibleMasks_.data() + MaskOffset(direction, tile), wordCount_ };
+    }
+    /// @brief tile の direction 側に置けるタイルの一覧
+    const std::vector<std::uint32_t> &GetCompatibleTiles(std::size_t direction, std::uint32_t tile) const noexcept {
+        return compatibleTiles_[direction * tileCount_ + tile];
+    }
+
+private:
+    std::size_t MaskOffset(std::size_t direction, std::uint32_t tile) const noexcept {
+        return (direction * tileCount_ + tile) * wordCount_;
+    }
+
+    std::uint32_t tileCount_ = 0;
+    std::uint32_t wordCount_ = 0;
+    /// @brief Allow で登録された片側の許可（[方向][タイル][ワード]）
+    std::vector<std::uint64_t> declaredMasks_;
+    /// @brief 双方向に許可された接続（[方向][タイル][ワード]）
+    std::vector<std::uint64_t> compatibleMasks_;
+    std::vector<std::vector<std::uint32_t>> compatibleTiles_;
+};
+
+/// @brief WfcSolver の打ち切り設定
+struct WfcSolveSettings final {
+    /// @brief 1回の試行で許すバックトラック回数（超えた場合はやり直す）
+    std::uint32_t maxBacktracks = 256;
+    /// @brief 最初からやり直す回数の上限
+    std::uint32_t maxRestarts = 4;
+    /// @brief 求解の途中で呼ばれる進捗の通知（確定したセルの割合 0.0～1.0。false を返すと中断して Solve は false を返す）
+    std::function<bool(float)> onProgress;
+    /// @brief onProgress を呼ぶ間隔（崩壊させたセルの数）
+    std::uint32_t progressInterval = 256;
+};
+
+/// @brief 波動関数崩壊アルゴリズムの求解部分（タイルはインデックスで扱う）
+/// @details セルの候補集合は固定幅のビット集合を平坦な配列に並べて持ち、伝播はAC-4
+///          （セル・方向・タイルごとに「隣のセルに残っている接続可能なタイル数」を数え、
+///          0になったタイルを候補から外す）で行う。崩壊させるセルは（残り候補数, セルごとの乱数）が
+///          最小のものを二分ヒープから選ぶ。矛盾した場合は直前の選択を取り消して別の候補を試す
+///          バックトラックを行い、回数が上限を超えたら最初からやり直す。
+///          同じ規則・制約・乱数状態からは常に同じ結果になる
+class WfcSolver final {
+public:
+    /// @brief 未確定セルを表すタイル値
+    static constexpr std::uint32_t kUnresolvedTile = std::numeric_limits<std::uint32_t>::max();
+
+    /// @param rules Build 済みの接続規則（ソルバーより長く生存すること）
+    WfcSolver(const WfcRuleSet &rules, std::uint32_t width, std::uint32_t height, std::uint32_t depth);
+
+    std::uint32_t GetWidth() const noexcept { return width_; }
+    std::uint32_t GetHeight() const noexcept { return height_; }
+    std::uint32_t GetDepth() const noexcept { return depth_; }
+    /// @brief セル座標から配列のインデックスを求める（[x][y][z] の順に並ぶ）
+    std::size_t GetCellIndex(std::uint32_t x, std::uint32_t y, std::uint32_t z) const noexcept {
+        return (static_cast<std::size_t>(x) * height_ + y) * depth_ + z;
+    }
+
+    /// @brief セルの候補を1つのタイルに固定する
+    void FixTile(std::uint32_t x, std::uint32_t y, std::uint32_t z, std::uint32_t tile);
+    /// @brief セルの候補を mask との積集合に絞る（GetWordCount ワード）
+    void Constrain(std::uint32_t x, std::uint32_t y, std::uint32_t z, std::span<const std::uint64_t> mask);
+    /// @brief グリッド外の direction 側に neighborTile が確定していることを制約として加える
+    void ConstrainToNeighbor(std::uint32_t x, std::uint32_t y, std::uint32_t z, std::size_t direction, std::uint32_t neighborTile);
+    /// @brief 最初に崩壊させるセルを指定する
+    void SetStartCell(std::uint32_t x, std::uint32_t y, std::uint32_t z);
+
+    /// @brief 制約を満たすようにグリッド全体のタイルを確定させる
+    /// @details 制約（FixTile/Constrain）はそのまま残るため、繰り返し呼び出せる
+    /// @return 全セルを確定できた場合は true（制約同士が矛盾している、打ち切り回数を超えた、または onProgress で中断した場合は false）
+    bool Solve(std::mt19937 &randomEngine, const WfcSolveSettings &settings = {});
+
+    /// @brief Solve で確定したタイル（未確定の場合は kUnresolvedTile）
+    std::uint32_t GetTile(std::uint32_t x, std::uint32_t y, std::uint32_t z) const noexcept {
+        return resolvedTiles_.empty() ? kUnresolvedTile : resolvedTiles_[GetCellIndex(x, y, z)];
+    }
+    const std::vector<std::uint32_t> &GetResolvedTiles() const noexcept { return resolvedTiles_; }
+
+    /// @brief 直前の Solve で行ったバックトラックとやり直しの回数
+    std::uint32_t GetBacktrackCount() const noexcept { return backtrackCount_; }
+    std::uint32_t GetRestartCount() const noexcept { return restartCount_; }
+    /// @brief 直前の Solve が onProgress によって中断されたか
+    bool IsAborted() const noexcept { return isAborted_; }
+
+private:
+    /// @brief 崩壊させるセルの選択に使うヒープ要素（値が古くなった要素は取り出し時に読み飛ばす）
+    struct HeapEntry {
+        std::uint32_t count;
+        std::uint32_t noise;
+        std::uint32_t cell;
+    };
+    /// @brief 崩壊の選択1回分（矛盾時は trailMark まで巻き戻して tile を候補から外す）
+    struct Decision {
+        std::uint32_t cell;
+        std::uint32_t tile;
+        std::size_t trailMark;
+    };
+    enum class AttemptResult {
+        Solved,
+        Unsatisfiable,
+        GaveUp,
+        Aborted,
+    };
+
+    std::uint64_t *DomainOf(std::size_t cell) noexcept { return domains_.data() + cell * wordCount_; }
+    const std::uint64_t *DomainOf(std::size_t cell) const noexcept { return domains_.data() + cell * wordCount_; }
+    std::uint16_t &SupportOf(std::size_t cell, std::size_t direction, std::uint32_t tile) noexcept {
+        return supports_[(cell * kWfcDirectionCount + direction) * tileCount_ + tile];
+    }
+
+    AttemptResult RunAttempt(std::mt19937 &randomEngine, const WfcSolveSettings &settings);
+    bool InitializeAttempt(std::mt19937 &randomEngine);
+    /// @brief cell の候補から tile を外し、隣接セルのサポート数を減らす（0になったタイルは保留キューへ積む）
+    /// @return cell の候補が0件になった場合は false
+    bool Ban(std::uint32_t cell, std::uint32_t tile);
+    /// @brief 保留キューが空になるまで Ban を続ける
+    bool Propagate();
+    /// @brief 記録した Ban を trailMark まで逆順に取り消す
+    void UndoTo(std::size_t trailMark);
+    std::optional<std::uint32_t> PopLowestEntropyCell();
+    void PushHeap(std::uint32_t cell);
+
+    const WfcRuleSet &rules_;
+    std::uint32_t width_ = 0;
+    std::uint32_t height_ = 0;
+    std::uint32_t depth_ = 0;
+    std::uint32_t tileCount_ = 0;
+    std::uint32_t wordCount_ = 0;
+    std::size_t cellCount_ = 0;
+
+    /// @brief セルごとの方向別の隣接セル（グリッド外は -1）
+    std::vector<std::array<std::int32_t, kWfcDirectionCount>> neighbors_;
+    /// @brief FixTile/Constrain で絞った求解開始時の候補集合
+    std::vector<std::uint64_t> initialDomains_;
+    std::optional<std::uint32_t> startCell_;
+
+    // --- 求解中の状態 ---
+    std::vector<std::uint64_t> domains_;
+    std::vector<std::uint32_t> domainCounts_;
+    /// @brief 候補が1つに絞られたセルの数（進捗の通知用）
+    std::size_t resolvedCellCount_ = 0;
+    /// @brief [セル][方向][タイル]: 隣接セルに残っている、そのタイルと接続可能なタイル数
+    std::vector<std::uint16_t> supports_;
+    std::vector<std::uint32_t> cellNoise_;
+    std::vector<HeapEntry> heap_;
+    /// @brief Ban の記録（セル, タイル）。バックトラック時に逆順に取り消す
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> trail_;
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> pendingBans_;
+    std::vector<Decision> decisions_;
+
+    std::vector<std::uint32_t> resolvedTiles_;
+    std::uint32_t backtrackCount_ = 0;
+    std::uint32_t restartCount_ = 0;
+    bool isAborted_ = false;
+};
+
+} // namespace KashipanEngine
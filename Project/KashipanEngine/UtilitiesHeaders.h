@@ -18,6 +18,9 @@
 #include "Utilities/StageGraphGenerator.h"
 #include "Utilities/StageGridBuilder.h"
 #include "Utilities/WaveFunctionCollapse.h"
+#include "Utilities/WfcSolver.h"
+#include "Utilities/ChunkedWaveFunctionCollapse.h"
+#include "Utilities/StageGenerationService.h"
 #include "Utilities/GameTimer.h"
 #include "Utilities/UUID128.h"
 #include "Utilities/ImGuiCustom.h"
@@ -0,0 +1,152 @@
+// シーンファイルの形式変換ツール（SceneConverter.exe）
+//
+// エディターを起動せずに、シーンJSON（.json）とバイナリシーン（.kscene）を相互に変換する。
+// ビルド時のアセット変換やCIから呼び出すことを想定している。変換はJSONの内容を失わないため、
+// .kscene から .json へ戻すこともできる。フォルダ形式（.scene）はプロジェクトのパス解決が必要なため、
+// エディターの Tools > Scene Binary Converter（EditorTools/SceneBinaryConverter.as）で変換する。
+//
+// 使い方:
+//   SceneConverter <変換元> <変換先> [--compress] [--verify]
+//     --compress  変換先が .kscene の場合に本体を LZ ブロック圧縮する
+//     --verify    書き出したファイルを読み直し、変換元と同じJSONに戻ることを確かめる
+//
+// 終了コード: 0 成功 / 1 引数の誤り / 2 読み込み・書き込み・検証の失敗
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "Scene/SceneBinaryFormat.h"
+#include "Utilities/Conversion/ConvertString.h"
+#include "Utilities/FileIO/Directory.h"
+#include "Utilities/FileIO/JSON.h"
+#include "Utilities/Plugin/Plugins.h"
+
+using namespace KashipanEngine;
+
+namespace {
+
+constexpr int kExitSucceeded = 0;
+constexpr int kExitUsage = 1;
+constexpr int kExitFailed = 2;
+
+enum class SceneFileFormat {
+    Unknown,
+    Json,
+    Binary,
+};
+
+SceneFileFormat GetSceneFileFormat(const std::string &path) {
+    if (path.ends_with(".json")) return SceneFileFormat::Json;
+    if (path.ends_with(kSceneBinaryExtension)) return SceneFileFormat::Binary;
+    return SceneFileFormat::Unknown;
+}
+
+void PrintUsage() {
+    std::fprintf(stderr,
+        "usage: SceneConverter <source> <destination> [--compress] [--verify]\n"
+        "  source, destination: .json or .kscene\n"
+        "  --compress  compress the body when writing .kscene\n"
+        "  --verify    read the written file back and compare it with the source\n");
+}
+
+/// @brief 形式に合わせてシーンJSONを読み込む（失敗した場合は null）
+JSON LoadScene(const std::string &path, SceneFileFormat format) {
+    if (format == SceneFileFormat::Json) return LoadJSON(path);
+    SceneBinaryReader reader;
+    if (!reader.OpenFile(path)) return JSON();
+    return reader.DecodeScene();
+}
+
+bool SaveScene(const JSON &sceneJson, const std::string &path, SceneFileFormat format, bool compress) {
+    if (format == SceneFileFormat::Json) return SaveJSON(sceneJson, path);
+
+    if (!EnsureParentDirectoryExists(path)) return false;
+    const std::vector<std::uint8_t> bytes = EncodeSceneBinary(sceneJson, compress);
+    std::ofstream file(Utf8StringToPath(path), std::ios::binary | std::ios::trunc);
+    if (!file) return false;
+    file.write(reinterpret_cast<const char *>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    return static_cast<bool>(file);
+}
+
+/// @brief 列形式で格納した種別（エンジンがJSONを経由せずに読み込める候補）を表示する
+void PrintBinaryLayout(const std::string &path) {
+    SceneBinaryReader reader;
+    if (!reader.OpenFile(path)) return;
+    std::printf("  objects: %u, components: %u\n", reader.GetObjectCount(), reader.GetComponentCount());
+    for (std::uint32_t typeIndex = 0; typeIndex < reader.GetComponentTypeCount(); ++typeIndex) {
+        const std::string typeName(reader.GetComponentTypeName(typeIndex));
+        std::printf("  %-32s %8u  %s\n", typeName.c_str(), reader.GetComponentCountOfType(typeIndex),
+            reader.IsColumnarType(typeIndex) ? "columnar" : "per component");
+    }
+}
+
+int RunSceneConverter(const std::vector<std::string> &arguments) {
+    std::vector<std::string> paths;
+    bool compress = false;
+    bool verify = false;
+    for (const auto &argument : arguments) {
+        if (argument == "--compress") {
+            compress = true;
+        } else if (argument == "--verify") {
+            verify = true;
+        } else if (argument.starts_with("--")) {
+            std::fprintf(stderr, "unknown option: %s\n", argument.c_str());
+            PrintUsage();
+            return kExitUsage;
+        } else {
+            paths.push_back(argument);
+        }
+    }
+    if (paths.size() != 2) {
+        PrintUsage();
+        return kExitUsage;
+    }
+
+    const std::string &sourcePath = paths[0];
+    const std::string &destinationPath = paths[1];
+    const SceneFileFormat sourceFormat = GetSceneFileFormat(sourcePath);
+    const SceneFileFormat destinationFormat = GetSceneFileFormat(destinationPath);
+    if (sourceFormat == SceneFileFormat::Unknown || destinationFormat == SceneFileFormat::Unknown) {
+        std::fprintf(stderr, "unsupported extension (use .json or %s)\n", kSceneBinaryExtension);
+        return kExitUsage;
+    }
+
+    const JSON sceneJson = LoadScene(sourcePath, sourceFormat);
+    if (sceneJson.is_null() || sceneJson.is_discarded()) {
+        std::fprintf(stderr, "failed to load: %s\n", sourcePath.c_str());
+        return kExitFailed;
+    }
+    if (!SaveScene(sceneJson, destinationPath, destinationFormat, compress)) {
+        std::fprintf(stderr, "failed to write: %s\n", destinationPath.c_str());
+        return kExitFailed;
+    }
+    std::printf("%s -> %s\n", sourcePath.c_str(), destinationPath.c_str());
+    if (destinationFormat == SceneFileFormat::Binary) PrintBinaryLayout(destinationPath);
+
+    if (verify) {
+        if (LoadScene(destinationPath, destinationFormat) != sceneJson) {
+            std::fprintf(stderr, "verify failed: %s does not match %s\n", destinationPath.c_str(), sourcePath.c_str());
+            return kExitFailed;
+        }
+        std::printf("verified\n");
+    }
+    return kExitSucceeded;
+}
+
+} // namespace
+
+int wmain(int argc, wchar_t *argv[]) {
+    // 引数はコマンドラインの文字コードに依らずUTF-16で受け取り、エンジンと同じUTF-8のパスにする
+    std::vector<std::string> arguments;
+    for (int i = 1; i < argc; ++i) arguments.push_back(PathToUtf8String(std::filesystem::path(argv[i])));
+
+    // 圧縮ブロックの展開・オブジェクトのデコードはエンジンと同じくジョブシステムで並列に行う
+    Plugin::JobSystem jobSystem(Plugin::JobSystem::GetDefaultWorkerCount());
+    Plugin::jobSystem = &jobSystem;
+    const int exitCode = RunSceneConverter(arguments);
+    Plugin::jobSystem = nullptr;
+    return exitCode;
+}
@@ -0,0 +1,155 @@
+// アニメーションクリップ圧縮（AnimationClipCompression）の往復テスト
+//
+// 圧縮 → 再生（サンプリング）・キーの復元の結果が、元のキーに対して許容誤差内に収まることを確かめる。
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "TestFramework.h"
+#include "Assets/AnimationClipCompression.h"
+
+using namespace KashipanEngine;
+
+namespace {
+
+constexpr AnimationCompressionSettings kSettings{};
+
+/// @brief 等間隔のキーを持つ float のタイムラインを作る
+template <typename Func>
+KeyframeTimeline MakeFloatTimeline(float duration, float keysPerSecond, Func valueAt) {
+    KeyframeTimeline timeline;
+    timeline.name = "Joint.Translate.X";
+    timeline.valueType = KeyframeValueType::Float;
+    timeline.duration = duration;
+    const int keyCount = static_cast<int>(duration * keysPerSecond) + 1;
+    for (int i = 0; i < keyCount; ++i) {
+        const float time = static_cast<float>(i) / keysPerSecond;
+        timeline.keys.push_back({ time, valueAt(time), EaseType::Linear });
+    }
+    return timeline;
+}
+
+/// @brief Y軸回りに回り続けるクォータニオンのタイムラインを作る
+KeyframeTimeline MakeRotateTimeline(float duration, float keysPerSecond, float radiansPerSecond) {
+    KeyframeTimeline timeline;
+    timeline.name = "Joint.Rotate";
+    timeline.valueType = KeyframeValueType::Quaternion;
+    timeline.duration = duration;
+    const int keyCount = static_cast<int>(duration * keysPerSecond) + 1;
+    for (int i = 0; i < keyCount; ++i) {
+        const float time = static_cast<float>(i) / keysPerSecond;
+        // 揺れを混ぜて、キー削減で全てのキーが消えないようにする
+        const float angle = radiansPerSecond * time + 0.3f * std::sin(time * 0.5f);
+        timeline.keys.push_back({ time, Quaternion(0.0f, std::sin(angle * 0.5f), 0.0f, std::cos(angle * 0.5f)), EaseType::Linear });
+    }
+    return timeline;
+}
+
+/// @brief 元のキー時刻でサンプリングした値の最大誤差（前方再生と同じく1つのカーソルを使い回す）
+float MeasureSampledError(const KeyframeTimeline &source, const CompressedTimeline &compressed) {
+    TimelineCursor cursor;
+    float maxError = 0.0f;
+    for (const auto &key : source.keys) {
+        if (compressed.isQuaternion) {
+            // acos(内積) は1付近で精度が足りないため、差と和の長さから角度を求める（元のキーは正規化済み）
+            const Quaternion a = SampleCompressedQuaternion(compressed, key.time, false, cursor);
+            Quaternion b = std::get<Quaternion>(key.value);
+            if (a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w < 0.0f) b = Quaternion(-b.x, -b.y, -b.z, -b.w);
+            const float difference = std::hypot(std::hypot(a.x - b.x, a.y - b.y), std::hypot(a.z - b.z, a.w - b.w));
+            const float sum = std::hypot(std::hypot(a.x + b.x, a.y + b.y), std::hypot(a.z + b.z, a.w + b.w));
+            maxError = std::max(maxError, 4.0f * std::atan2(difference, sum));
+        } else {
+            const float value = SampleCompressedFloat(compressed, key.time, false, cursor);
+            maxError = std::max(maxError, std::abs(value - std::get<float>(key.value)));
+        }
+    }
+    return maxError;
+}
+
+} // namespace
+
+TEST_CASE(AnimationCompression_SmoothTimelineIsReduced) {
+    // 直線はキー2つまで削減でき、量子化の誤差も許容誤差内に収まる
+    const auto source = MakeFloatTimeline(2.0f, 60.0f, [](float t) { return 0.25f * t; });
+    const auto result = CompressTimelineWithinTolerance(source, kSettings.translateTolerance);
+    TEST_CHECK(!result.timeline.IsRaw());
+    TEST_CHECK(result.timeline.GetKeyCount() == 2);
+    TEST_CHECK(result.error <= kSettings.translateTolerance);
+    TEST_CHECK(MeasureSampledError(source, result.timeline) <= kSettings.translateTolerance);
+}
+
+TEST_CASE(AnimationCompression_ErrorStaysWithinTolerance) {
+    // 値の幅・長さの異なるタイムラインで、圧縮後の誤差が常に許容誤差以内であることを確かめる
+    const float amplitudes[] = { 0.1f, 2.0f, 20.0f, 60.0f };
+    const float durations[] = { 1.0f, 10.0f, 60.0f };
+    for (const float amplitude : amplitudes) {
+        for (const float duration : durations) {
+            const auto source = MakeFloatTimeline(duration, 30.0f, [amplitude](float t) {
+                return amplitude * std::sin(t * 1.7f) + 0.05f * std::sin(t * 23.0f);
+            });
+            const auto result = CompressTimelineWithinTolerance(source, kSettings.translateTolerance);
+            const std::string label = "amplitude=" + std::to_string(amplitude) + " duration=" + std::to_string(duration) +
+                " error=" + std::to_string(result.error) + " retries=" + std::to_string(result.retryCount);
+            TEST_CHECK_MESSAGE(result.error <= kSettings.translateTolerance, label);
+            TEST_CHECK_MESSAGE(MeasureSampledError(source, result.timeline) <= kSettings.translateTolerance, label);
+        }
+    }
+
+    const auto rotate = MakeRotateTimeline(30.0f, 30.0f, 2.0f);
+    const auto rotateResult = CompressTimelineWithinTolerance(rotate, kSettings.rotateToleranceRadians);
+    TEST_CHECK(rotateResult.error <= kSettings.rotateToleranceRadians);
+    TEST_CHECK(MeasureSampledError(rotate, rotateResult.timeline) <= kSettings.rotateToleranceRadians);
+    TEST_CHECK(!rotateResult.timeline.IsRaw());
+    TEST_CHECK(rotateResult.timeline.GetKeyCount() < rotate.keys.size());
+}
+
+TEST_CASE(AnimationCompression_OverToleranceIsRecompressed) {
+    // 許容誤差ぎりぎりまでキーを削ると量子化の誤差が上乗せされて超えるため、キー削減を狭めて圧縮し直す
+    const auto source = MakeFloatTimeline(60.0f, 30.0f, [](float t) { return 0.1f * std::sin(t * 1.7f); });
+    const auto firstPass = CompressFloatTimeline(source, kSettings.translateTolerance);
+    TEST_CHECK(MeasureCompressionError(source, firstPass) > kSettings.translateTolerance);
+
+    const auto result = CompressTimelineWithinTolerance(source, kSettings.translateTolerance);
+    TEST_CHECK(result.retryCount > 0);
+    TEST_CHECK(!result.timeline.IsRaw());
+    TEST_CHECK(result.error <= kSettings.translateTolerance);
+    TEST_CHECK(result.timeline.GetKeyCount() < source.keys.size());
+}
+
+TEST_CASE(AnimationCompression_WideRangeKeepsRawKeys) {
+    // 値の幅が1000あると16bitの量子化の刻み（約0.015）が許容誤差を超えるため、キーを量子化せずに保持する
+    const auto source = MakeFloatTimeline(10.0f, 30.0f, [](float t) { return 500.0f * std::sin(t * 0.9f); });
+    const auto result = CompressTimelineWithinTolerance(source, kSettings.translateTolerance);
+    TEST_CHECK(result.timeline.IsRaw());
+    TEST_CHECK(result.error <= kSettings.translateTolerance);
+    TEST_CHECK(result.timeline.GetKeyCount() == source.keys.size());
+    TEST_CHECK(MeasureSampledError(source, result.timeline) == 0.0f);
+
+    // ループ再生で末尾を越えても先頭へ戻る
+    TimelineCursor cursor;
+    const float wrapped = SampleCompressedFloat(result.timeline, result.timeline.duration + 1.0f, true, cursor);
+    TEST_CHECK(std::abs(wrapped - std::get<float>(source.keys[30].value)) <= kSettings.translateTolerance);
+}
+
+TEST_CASE(AnimationCompression_DecompressedKeysRoundTrip) {
+    // 復元したキー（KeyframeAnimator へ渡す形）を線形補間しても、元のキーを許容誤差内で再現できる
+    const auto source = MakeFloatTimeline(5.0f, 60.0f, [](float t) { return 3.0f * std::sin(t * 2.3f); });
+    const auto result = CompressTimelineWithinTolerance(source, kSettings.translateTolerance);
+    const auto keys = DecompressTimelineKeys(result.timeline);
+    TEST_CHECK(keys.size() == result.timeline.GetKeyCount());
+    TEST_CHECK(keys.size() < source.keys.size());
+
+    float maxError = 0.0f;
+    size_t segment = 0;
+    for (const auto &key : source.keys) {
+        while (segment + 2 < keys.size() && keys[segment + 1].time <= key.time) ++segment;
+        const auto &from = keys[segment];
+        const auto &to = keys[std::min(segment + 1, keys.size() - 1)];
+        const float span = to.time - from.time;
+        const float n = span > 0.0f ? std::clamp((key.time - from.time) / span, 0.0f, 1.0f) : 0.0f;
+        const float value = std::get<float>(from.value) + (std::get<float>(to.value) - std::get<float>(from.value)) * n;
+        maxError = std::max(maxError, std::abs(value - std::get<float>(key.value)));
+    }
+    TEST_CHECK_MESSAGE(maxError <= kSettings.translateTolerance, "error=" + std::to_string(maxError));
+}
@@ -0,0 +1,204 @@
+// Broadphase2D のテストと、置き換え前の一様グリッドとのベンチマーク
+//
+// ペアキャッシュがフレームをまたいで保持されること（追加・除去が1度だけ報告され、
+// 呼び出し側が書き込んだ接触状態が残ること）と、乱数で動かした後も重なっている組を漏らさないことを確かめる。
+
+#include <algorithm>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "TestFramework.h"
+#include "Legacy/LegacyGridBroadphase2D.h"
+#include "Objects/Collision/Broadphase2D.h"
+
+using KashipanEngine::Aabb2D;
+using KashipanEngine::Broadphase2D;
+
+namespace {
+
+Aabb2D MakeBox(float centerX, float centerY, float halfSize) {
+    return Aabb2D{ centerX - halfSize, centerY - halfSize, centerX + halfSize, centerY + halfSize };
+}
+
+bool ContainsPair(const std::vector<Broadphase2D::Pair> &pairs, Broadphase2D::ColliderID a, Broadphase2D::ColliderID b) {
+    const auto key = Broadphase2D::MakePairKey(a, b);
+    return std::any_of(pairs.begin(), pairs.end(), [key](const Broadphase2D::Pair &p) { return p.key == key; });
+}
+
+} // namespace
+
+TEST_CASE(Broadphase2D_PairPersistsWhileOverlapping) {
+    Broadphase2D broadphase;
+    broadphase.UpdateProxy(1, MakeBox(0.0f, 0.0f, 1.0f));
+    broadphase.UpdateProxy(2, MakeBox(1.5f, 0.0f, 1.0f));
+    broadphase.UpdateProxy(3, MakeBox(50.0f, 0.0f, 1.0f));
+    broadphase.UpdatePairs();
+
+    TEST_CHECK(broadphase.GetAddedPairs().size() == 1 && ContainsPair(broadphase.GetAddedPairs(), 1, 2));
+    TEST_CHECK(broadphase.GetPairs().size() == 1);
+    // 呼び出し側（Collider::Update2D）は狭域判定の結果をペアへ書き込み、次のフレームのEnter/Stay判定に使う
+    broadphase.FindPair(Broadphase2D::MakePairKey(1, 2))->isTouching = true;
+
+    // fat AABBの中での小さな移動では、ペアの追加・除去は報告されず接触状態も保持される
+    for (int frame = 1; frame <= 5; ++frame) {
+        broadphase.UpdateProxy(2, MakeBox(1.5f + 0.01f * static_cast<float>(frame), 0.0f, 1.0f));
+        broadphase.UpdatePairs();
+        TEST_CHECK(broadphase.GetAddedPairs().empty());
+        TEST_CHECK(broadphase.GetRemovedPairs().empty());
+        const auto *pair = broadphase.FindPair(Broadphase2D::MakePairKey(1, 2));
+        TEST_CHECK(pair != nullptr && pair->isTouching);
+    }
+
+    // 離れたフレームで1度だけ除去が報告され、除去時点の接触状態（Exitの発火に使う）が残っている
+    broadphase.UpdateProxy(2, MakeBox(1.5f, 20.0f, 1.0f));
+    broadphase.UpdatePairs();
+    TEST_CHECK(broadphase.GetRemovedPairs().size() == 1);
+    TEST_CHECK(!broadphase.GetRemovedPairs().empty() && broadphase.GetRemovedPairs()[0].isTouching);
+    TEST_CHECK(broadphase.GetPairs().empty());
+    broadphase.UpdatePairs();
+    TEST_CHECK(broadphase.GetRemovedPairs().empty());
+
+    // 再び重なった場合は新しいペアとして追加され、接触状態は初期値に戻る
+    broadphase.UpdateProxy(2, MakeBox(1.0f, 0.0f, 1.0f));
+    broadphase.UpdatePairs();
+    TEST_CHECK(ContainsPair(broadphase.GetAddedPairs(), 1, 2));
+    const auto *readded = broadphase.FindPair(Broadphase2D::MakePairKey(1, 2));
+    TEST_CHECK(readded != nullptr && !readded->isTouching);
+}
+
+TEST_CASE(Broadphase2D_RemovedProxyReportsPairOnce) {
+    Broadphase2D broadphase;
+    broadphase.UpdateProxy(1, MakeBox(0.0f, 0.0f, 1.0f));
+    broadphase.UpdateProxy(2, MakeBox(1.0f, 0.0f, 1.0f));
+    broadphase.UpdateProxy(3, MakeBox(0.0f, 1.0f, 1.0f));
+    broadphase.UpdatePairs();
+    TEST_CHECK(broadphase.GetPairs().size() == 3);
+
+    broadphase.RemoveProxy(2);
+    // 破棄したノードが別のコライダーで再利用されても、古いペアを生きていると誤認しない
+    broadphase.UpdateProxy(4, MakeBox(100.0f, 100.0f, 1.0f));
+    broadphase.UpdatePairs();
+    TEST_CHECK(broadphase.GetRemovedPairs().size() == 2);
+    TEST_CHECK(ContainsPair(broadphase.GetRemovedPairs(), 1, 2) && ContainsPair(broadphase.GetRemovedPairs(), 2, 3));
+    TEST_CHECK(broadphase.GetPairs().size() == 1 && ContainsPair(broadphase.GetPairs(), 1, 3));
+
+    broadphase.UpdatePairs();
+    TEST_CHECK(broadphase.GetRemovedPairs().empty() && broadphase.GetAddedPairs().empty());
+}
+
+TEST_CASE(Broadphase2D_ForcedPairIsDroppedNextFrame) {
+    // スイープでのみ検出した接触は、fat AABBが重なっていなくても1フレームだけキャッシュへ持ち越す
+    Broadphase2D broadphase;
+    broadphase.UpdateProxy(1, MakeBox(0.0f, 0.0f, 1.0f));
+    broadphase.UpdateProxy(2, MakeBox(30.0f, 0.0f, 1.0f));
+    broadphase.UpdatePairs();
+    TEST_CHECK(broadphase.GetPairs().empty());
+
+    broadphase.AddPair(2, 1, true);
+    const auto *pair = broadphase.FindPair(Broadphase2D::MakePairKey(1, 2));
+    TEST_CHECK(pair != nullptr && pair->a == 1 && pair->b == 2 && pair->isTouching);
+
+    broadphase.UpdatePairs();
+    TEST_CHECK(broadphase.GetRemovedPairs().size() == 1 && broadphase.GetRemovedPairs()[0].isTouching);
+    TEST_CHECK(broadphase.GetPairs().empty());
+}
+
+TEST_CASE(Broadphase2D_RandomMotionKeepsAllOverlaps) {
+    constexpr std::uint32_t kCount = 300;
+    std::mt19937 random(12345);
+    std::uniform_real_distribution<float> position(0.0f, 60.0f);
+    std::uniform_real_distribution<float> size(0.2f, 2.0f);
+    std::uniform_real_distribution<float> step(-0.6f, 0.6f);
+
+    std::vector<float> xs(kCount), ys(kCount), halves(kCount);
+    Broadphase2D broadphase;
+    for (std::uint32_t i = 0; i < kCount; ++i) {
+        xs[i] = position(random);
+        ys[i] = position(random);
+        halves[i] = size(random);
+        broadphase.UpdateProxy(i + 1, MakeBox(xs[i], ys[i], halves[i]));
+    }
+
+    for (int frame = 0; frame < 60; ++frame) {
+        for (std::uint32_t i = 0; i < kCount; i += 2) {
+            xs[i] += step(random);
+            ys[i] += step(random);
+            broadphase.UpdateProxy(i + 1, MakeBox(xs[i], ys[i], halves[i]));
+        }
+        broadphase.UpdatePairs();
+
+        // ペアキー昇順・重複なしで、実際に重なっている組は全て含まれている
+        const auto &pairs = broadphase.GetPairs();
+        TEST_CHECK(std::is_sorted(pairs.begin(), pairs.end(), [](const auto &l, const auto &r) { return l.key < r.key; }));
+        TEST_CHECK(std::adjacent_find(pairs.begin(), pairs.end(), [](const auto &l, const auto &r) { return l.key == r.key; }) == pairs.end());
+        std::size_t missing = 0;
+        for (std::uint32_t a = 0; a < kCount; ++a) {
+            for (std::uint32_t b = a + 1; b < kCount; ++b) {
+                if (!MakeBox(xs[a], ys[a], halves[a]).Overlaps(MakeBox(xs[b], ys[b], halves[b]))) continue;
+                if (!broadphase.FindPair(Broadphase2D::MakePairKey(a + 1, b + 1))) ++missing;
+            }
+        }
+        TEST_CHECK_MESSAGE(missing == 0, "frame " + std::to_string(frame) + ": " + std::to_string(missing) + " overlapping pairs missing");
+    }
+}
+
+BENCHMARK_CASE(Broadphase2D_TreeVsLegacyGrid) {
+    // 200x200の範囲に大きさの異なる箱を置き、半数を毎フレーム少しずつ動かす（Update2Dの候補ペア列挙に相当する部分）
+    constexpr std::uint32_t kCount = 4000;
+    constexpr int kFrameCount = 60;
+    std::mt19937 random(2024);
+    std::uniform_real_distribution<float> position(0.0f, 200.0f);
+    std::uniform_real_distribution<float> size(0.25f, 1.5f);
+    std::uniform_real_distribution<float> step(-0.1f, 0.1f);
+
+    std::vector<float> xs(kCount), ys(kCount), halves(kCount);
+    for (std::uint32_t i = 0; i < kCount; ++i) {
+        xs[i] = position(random);
+        ys[i] = position(random);
+        halves[i] = size(random);
+    }
+    // 両方の実装で同じ動きになるよう、移動量は先に決めておく
+    std::vector<float> steps(static_cast<std::size_t>(kFrameCount) * kCount);
+    for (auto &s : steps) s = step(random);
+
+    std::size_t legacyPairs = 0;
+    const double legacyMs = Tests::MeasureMilliseconds([&]() {
+        auto x = xs;
+        auto y = ys;
+        std::vector<std::optional<Aabb2D>> bounds(kCount);
+        for (int frame = 0; frame < kFrameCount; ++frame) {
+            for (std::uint32_t i = 0; i < kCount; i += 2) {
+                x[i] += steps[frame * kCount + i];
+                y[i] += steps[frame * kCount + i + 1];
+            }
+            for (std::uint32_t i = 0; i < kCount; ++i) bounds[i] = MakeBox(x[i], y[i], halves[i]);
+            legacyPairs = Tests::Legacy::BuildCandidatePairs2D(bounds).size();
+        }
+    });
+
+    std::size_t treePairs = 0;
+    const double treeMs = Tests::MeasureMilliseconds([&]() {
+        auto x = xs;
+        auto y = ys;
+        Broadphase2D broadphase;
+        for (std::uint32_t i = 0; i < kCount; ++i) broadphase.UpdateProxy(i + 1, MakeBox(x[i], y[i], halves[i]));
+        broadphase.UpdatePairs();
+        for (int frame = 0; frame < kFrameCount; ++frame) {
+            for (std::uint32_t i = 0; i < kCount; i += 2) {
+                x[i] += steps[frame * kCount + i];
+                y[i] += steps[frame * kCount + i + 1];
+            }
+            // Update2Dと同様に、動いていないコライダーも毎フレームAABBを渡す
+            for (std::uint32_t i = 0; i < kCount; ++i) broadphase.UpdateProxy(i + 1, MakeBox(x[i], y[i], halves[i]));
+            broadphase.UpdatePairs();
+            treePairs = broadphase.GetPairs().size();
+        }
+    });
+
+    Tests::ReportBenchmark("Broadphase2D 4k boxes, legacy grid (per frame)", legacyMs / kFrameCount, "ms");
+    Tests::ReportBenchmark("Broadphase2D 4k boxes, tree + pair cache (per frame)", treeMs / kFrameCount, "ms");
+    Tests::ReportBenchmark("Broadphase2D legacy grid candidate pairs", static_cast<double>(legacyPairs), "pairs");
+    Tests::ReportBenchmark("Broadphase2D tree candidate pairs", static_cast<double>(treePairs), "pairs");
+}
@@ -0,0 +1,279 @@
+// Collider の並列処理と逐次処理の同値性テストとベンチマーク
+//
+// Plugin::jobSystem を設定しない場合（逐次）と設定した場合（並列）で、同じ配置・同じ動きの
+// コライダーを更新し、衝突コールバックの発火順と内容が完全に一致することを確かめる。
+// シーンクエリはまとめて渡したクエリを QueryExecution::Serial / Parallel で処理した結果を比べる。
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "TestFramework.h"
+#include "Objects/Collision/Collider.h"
+#include "Utilities/Plugin/Plugins.h"
+#include "Utilities/Plugin/Thread/JobSystem.h"
+
+using KashipanEngine::Collider;
+using KashipanEngine::ColliderInfo2D;
+using KashipanEngine::EmptyObject;
+using KashipanEngine::HitInfo2D;
+using KashipanEngine::OverlapQuery2D;
+using KashipanEngine::QueryExecution;
+using KashipanEngine::QueryHit2D;
+using KashipanEngine::RaycastQuery2D;
+using Plugin::JobSystem;
+namespace Math = KashipanEngine::Math;
+
+namespace {
+
+/// @brief コールバックの呼び出し1回分の記録
+struct HitEvent2D final {
+    int frame = 0;
+    char kind = ' '; // 'E'nter / 'S'tay / 'X' (Exit)
+    std::uint32_t self = 0;
+    std::uintptr_t other = 0;
+    float normalX = 0.0f;
+    float normalY = 0.0f;
+    float penetration = 0.0f;
+
+    bool operator==(const HitEvent2D &) const = default;
+};
+
+/// @brief 所属オブジェクトとして渡すだけの、参照されないポインタを作る（コールバックで相手を識別するのに使う）
+EmptyObject *DummyOwner(std::uint32_t index) {
+    return reinterpret_cast<EmptyObject *>(static_cast<std::uintptr_t>(index + 1) * 16u);
+}
+
+/// @brief 乱数で決めた配置・移動量を保持し、同じシナリオを何度でも再生できるようにする
+struct Scenario2D final {
+    std::vector<Vector2> positions;
+    std::vector<float> sizes;
+    std::vector<bool> isRect;
+    std::vector<bool> isContinuous;
+    std::vector<Vector2> steps; // frame * count + index
+    int frameCount = 0;
+
+    Scenario2D(std::uint32_t count, int frames, float area, float maxStep, std::uint32_t seed) : frameCount(frames) {
+        std::mt19937 random(seed);
+        std::uniform_real_distribution<float> position(0.0f, area);
+        std::uniform_real_distribution<float> size(0.3f, 1.5f);
+        std::uniform_real_distribution<float> step(-maxStep, maxStep);
+        std::uniform_int_distribution<int> coin(0, 3);
+        for (std::uint32_t i = 0; i < count; ++i) {
+            positions.push_back({ position(random), position(random) });
+            sizes.push_back(size(random));
+            isRect.push_back(coin(random) == 0);
+            isContinuous.push_back(coin(random) == 0);
+        }
+        steps.resize(static_cast<std::size_t>(frames) * count);
+        for (auto &s : steps) s = { step(random), step(random) };
+    }
+
+    std::uint32_t GetCount() const { return static_cast<std::uint32_t>(positions.size()); }
+
+    ColliderInfo2D MakeInfo(std::uint32_t index, const Vector2 &center) const {
+        ColliderInfo2D info;
+        if (isRect[index]) {
+            Math::Rect rect;
+            rect.center = center;
+            rect.halfSize = { sizes[index], sizes[index] * 0.5f };
+            info.shape = rect;
+        } else {
+            Math::Circle circle;
+            circle.center = center;
+            circle.radius = sizes[index];
+            info.shape = circle;
+        }
+        info.ownerObject = DummyOwner(index);
+        info.continuousDetection = isContinuous[index];
+        // 属性で判定対象外になる組も混ぜる
+        info.attribute.set(index % 3);
+        if (index % 7 == 0) info.ignoreAttribute.set((index + 1) % 3);
+        return info;
+    }
+
+    /// @brief シナリオを再生し、発火したコールバックを順に返す
+    std::vector<HitEvent2D> Run() const {
+        std::vector<HitEvent2D> events;
+        int currentFrame = 0;
+        Collider collider;
+        std::vector<Collider::ColliderID> ids;
+        auto positionsNow = positions;
+
+        auto attach = [&](ColliderInfo2D &info, std::uint32_t index) {
+            auto record = [&events, &currentFrame, index](char kind) {
+                return [&events, &currentFrame, index, kind](const HitInfo2D &hit) {
+                    events.push_back(HitEvent2D{ currentFrame, kind, index, reinterpret_cast<std::uintptr_t>(hit.otherObject),
+                        hit.normal.x, hit.normal.y, hit.penetration });
+                };
+            };
+            info.onCollisionEnter = record('E');
+            info.onCollisionStay = record('S');
+            info.onCollisionExit = record('X');
+        };
+
+        for (std::uint32_t i = 0; i < GetCount(); ++i) {
+            auto info = MakeInfo(i, positionsNow[i]);
+            attach(info, i);
+            ids.push_back(collider.Add(info));
+        }
+        for (currentFrame = 0; currentFrame < frameCount; ++currentFrame) {
+            // 半数だけを動かす（動いていないコライダーの組も毎フレーム判定される）
+            for (std::uint32_t i = 0; i < GetCount(); i += 2) {
+                const auto &s = steps[static_cast<std::size_t>(currentFrame) * GetCount() + i];
+                positionsNow[i].x += s.x;
+                positionsNow[i].y += s.y;
+                auto info = MakeInfo(i, positionsNow[i]);
+                attach(info, i);
+                collider.UpdateColliderInfo2D(ids[i], info);
+            }
+            collider.Update2D();
+        }
+        return events;
+    }
+};
+
+/// @brief 乱数で配置したコライダーへ向けたレイキャスト・オーバーラップのクエリ
+struct QueryScenario2D final {
+    std::vector<RaycastQuery2D> raycasts;
+    std::vector<OverlapQuery2D> overlaps;
+
+    QueryScenario2D(std::uint32_t count, float area, std::uint32_t seed) {
+        std::mt19937 random(seed);
+        std::uniform_real_distribution<float> position(0.0f, area);
+        std::uniform_real_distribution<float> angle(0.0f, 6.2831853f);
+        std::uniform_real_distribution<float> size(0.5f, 3.0f);
+        for (std::uint32_t i = 0; i < count; ++i) {
+            RaycastQuery2D ray;
+            ray.origin = { position(random), position(random) };
+            const float a = angle(random);
+            ray.direction = { std::cos(a), std::sin(a) };
+            ray.maxDistance = area * 0.25f;
+            raycasts.push_back(ray);
+
+            OverlapQuery2D overlap;
+            Math::Circle circle;
+            circle.center = { position(random), position(random) };
+            circle.radius = size(random);
+            overlap.shape = circle;
+            overlaps.push_back(overlap);
+        }
+    }
+};
+
+/// @brief クエリの結果が完全に一致するか（ヒットしたコライダー・距離・法線・位置）
+bool SameHits(const std::vector<QueryHit2D> &a, const std::vector<QueryHit2D> &b) {
+    if (a.size() != b.size()) return false;
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        if (a[i].queryIndex != b[i].queryIndex || a[i].collider != b[i].collider || a[i].distance != b[i].distance ||
+            a[i].hitInfo.normal.x != b[i].hitInfo.normal.x || a[i].hitInfo.normal.y != b[i].hitInfo.normal.y ||
+            a[i].point.x != b[i].point.x || a[i].point.y != b[i].point.y) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+TEST_CASE(Collider2D_ParallelNarrowphaseMatchesSerial) {
+    // 狭域判定の並列化の閾値（1タスクあたり64ペア）を十分に超えるペア数になるよう密に配置する。
+    // 動きの大きいコライダーにはCCDのスイープ（1タスクあたり4件）も並列に走る
+    const Scenario2D scenario(800, 30, 40.0f, 1.2f, 4242);
+    JobSystem jobSystem(4);
+
+    const auto serial = Tests::WithJobSystem(nullptr, [&]() { return scenario.Run(); });
+    const auto parallel = Tests::WithJobSystem(&jobSystem, [&]() { return scenario.Run(); });
+
+    TEST_CHECK_MESSAGE(serial.size() > 1000, "too few events to exercise the parallel path: " + std::to_string(serial.size()));
+    TEST_CHECK_MESSAGE(serial.size() == parallel.size(),
+        "event count differs: serial " + std::to_string(serial.size()) + ", parallel " + std::to_string(parallel.size()));
+    std::size_t firstMismatch = 0;
+    while (firstMismatch < serial.size() && firstMismatch < parallel.size() && serial[firstMismatch] == parallel[firstMismatch]) {
+        ++firstMismatch;
+    }
+    TEST_CHECK_MESSAGE(firstMismatch == serial.size() && firstMismatch == parallel.size(),
+        "first mismatching event at index " + std::to_string(firstMismatch));
+
+    bool hasEnter = false, hasExit = false;
+    for (const auto &e : serial) {
+        hasEnter |= e.kind == 'E';
+        hasExit |= e.kind == 'X';
+    }
+    TEST_CHECK(hasEnter && hasExit);
+}
+
+BENCHMARK_CASE(Collider2D_SerialVsParallelNarrowphase) {
+    // 4000個のコライダーを密に置き、半数を毎フレーム動かす（Update2D全体の時間を測る）
+    const Scenario2D scenario(4000, 30, 120.0f, 0.3f, 777);
+    JobSystem jobSystem;
+
+    std::size_t serialEvents = 0;
+    const double serialMs = Tests::MeasureMilliseconds([&]() {
+        serialEvents = Tests::WithJobSystem(nullptr, [&]() { return scenario.Run(); }).size();
+    });
+    std::size_t parallelEvents = 0;
+    const double parallelMs = Tests::MeasureMilliseconds([&]() {
+        parallelEvents = Tests::WithJobSystem(&jobSystem, [&]() { return scenario.Run(); }).size();
+    });
+
+    const double frames = static_cast<double>(scenario.frameCount);
+    Tests::ReportBenchmark("Collider2D 4k colliders, serial (per frame)", serialMs / frames, "ms");
+    Tests::ReportBenchmark("Collider2D 4k colliders, parallel narrowphase (per frame)", parallelMs / frames, "ms");
+    Tests::ReportBenchmark("Collider2D worker threads", static_cast<double>(jobSystem.GetWorkerCount()), "threads");
+    Tests::ReportBenchmark("Collider2D callbacks (serial / parallel must match)",
+        static_cast<double>(serialEvents == parallelEvents ? serialEvents : 0), "calls");
+}
+
+BENCHMARK_CASE(Collider2D_BatchedQueries) {
+    // 4000個のコライダーに対し、レイキャストとオーバーラップを4096件ずつ発行する。
+    // 1件ずつ呼ぶ場合（バッチ化前の呼び出し方）、まとめて逐次、まとめて並列の3通りを比べる
+    const Scenario2D scenario(4000, 0, 120.0f, 0.0f, 555);
+    const QueryScenario2D queries(4096, 120.0f, 556);
+    JobSystem jobSystem;
+
+    Collider collider;
+    for (std::uint32_t i = 0; i < scenario.GetCount(); ++i) collider.Add(scenario.MakeInfo(i, scenario.positions[i]));
+    collider.Update2D();
+
+    std::vector<QueryHit2D> singleRaycasts, serialRaycasts, parallelRaycasts;
+    std::vector<QueryHit2D> singleOverlaps, serialOverlaps, parallelOverlaps;
+    constexpr int kRepeat = 5;
+
+    const double singleMs = Tests::MeasureBestMilliseconds(kRepeat, [&]() {
+        singleRaycasts.clear();
+        singleOverlaps.clear();
+        std::vector<QueryHit2D> hits;
+        for (std::size_t i = 0; i < queries.raycasts.size(); ++i) {
+            collider.Raycast2D(std::span(&queries.raycasts[i], 1), hits);
+            for (auto &hit : hits) hit.queryIndex = static_cast<std::uint32_t>(i);
+            singleRaycasts.insert(singleRaycasts.end(), hits.begin(), hits.end());
+        }
+        for (std::size_t i = 0; i < queries.overlaps.size(); ++i) {
+            collider.Overlap2D(std::span(&queries.overlaps[i], 1), hits);
+            for (auto &hit : hits) hit.queryIndex = static_cast<std::uint32_t>(i);
+            singleOverlaps.insert(singleOverlaps.end(), hits.begin(), hits.end());
+        }
+    });
+    const double serialMs = Tests::MeasureBestMilliseconds(kRepeat, [&]() {
+        collider.Raycast2D(queries.raycasts, serialRaycasts, QueryExecution::Serial);
+        collider.Overlap2D(queries.overlaps, serialOverlaps, QueryExecution::Serial);
+    });
+    const double parallelMs = Tests::WithJobSystem(&jobSystem, [&]() {
+        return Tests::MeasureBestMilliseconds(kRepeat, [&]() {
+            collider.Raycast2D(queries.raycasts, parallelRaycasts, QueryExecution::Parallel);
+            collider.Overlap2D(queries.overlaps, parallelOverlaps, QueryExecution::Parallel);
+        });
+    });
+
+    TEST_CHECK(SameHits(singleRaycasts, serialRaycasts) && SameHits(singleOverlaps, serialOverlaps));
+    TEST_CHECK(SameHits(serialRaycasts, parallelRaycasts) && SameHits(serialOverlaps, parallelOverlaps));
+
+    Tests::ReportBenchmark("Queries2D 4096 rays + 4096 overlaps, one call per query", singleMs, "ms");
+    Tests::ReportBenchmark("Queries2D 4096 rays + 4096 overlaps, batched serial", serialMs, "ms");
+    Tests::ReportBenchmark("Queries2D 4096 rays + 4096 overlaps, batched parallel", parallelMs, "ms");
+    Tests::ReportBenchmark("Queries2D overlap hits", static_cast<double>(serialOverlaps.size()), "hits");
+}
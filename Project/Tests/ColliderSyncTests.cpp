@@ -0,0 +1,289 @@
+// Collider の3Dコライダー情報の差分同期（SyncMode3D::Incremental）のテストと、
+// 毎回作り直す従来の同期（SyncMode3D::Rebuild）とのベンチマーク
+//
+// ClassifyChange3D は前回・今回の情報と状態だけから分類する静的関数のため、状態を直接組み立てて検証する。
+// UpdateColliderInfo3D を通す検証では、所属オブジェクト・RigidBody3D の参照は Fakes/ColliderFakes の差し替えを使う。
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "TestFramework.h"
+#include "Fakes/ColliderFakes.h"
+#include "Objects/Collision/Collider.h"
+
+using KashipanEngine::Collider;
+using KashipanEngine::ColliderInfo3D;
+using ChangeKind3D = Collider::ChangeKind3D;
+using SyncState3D = Collider::SyncState3D;
+
+namespace {
+
+ColliderInfo3D MakeBoxInfo(const Vector3 &center, const Vector3 &halfExtents) {
+    ColliderInfo3D info;
+    ColliderInfo3D::BoxShape3D box;
+    box.center = center;
+    box.halfExtents = halfExtents;
+    info.shape = box;
+    return info;
+}
+
+ColliderInfo3D MakeSphereInfo(const Vector3 &center, float radius) {
+    ColliderInfo3D info;
+    ColliderInfo3D::SphereShape3D sphere;
+    sphere.center = center;
+    sphere.radius = radius;
+    info.shape = sphere;
+    return info;
+}
+
+SyncState3D MakeState(float x, float y, float z) {
+    SyncState3D state;
+    state.transform = reactphysics3d::Transform(reactphysics3d::Vector3(x, y, z), reactphysics3d::Quaternion::identity());
+    return state;
+}
+
+const char *ToString(ChangeKind3D kind) {
+    switch (kind) {
+    case ChangeKind3D::None: return "None";
+    case ChangeKind3D::Transform: return "Transform";
+    case ChangeKind3D::ShapeParameter: return "ShapeParameter";
+    case ChangeKind3D::Structural: return "Structural";
+    }
+    return "?";
+}
+
+void CheckKind(ChangeKind3D actual, ChangeKind3D expected, const char *label) {
+    TEST_CHECK_MESSAGE(actual == expected,
+        std::string(label) + ": expected " + ToString(expected) + ", actual " + ToString(actual));
+}
+
+/// @brief ポインタの比較だけに使うダミーの参照先（参照先は読まない）
+int gDummyTargets[4]{};
+
+template <typename T>
+T *DummyPointer(int index) {
+    return reinterpret_cast<T *>(&gDummyTargets[index]);
+}
+
+} // namespace
+
+TEST_CASE(ClassifyChange3D_PrimitiveTransitions) {
+    const ColliderInfo3D box = MakeBoxInfo(Vector3{ 1.0f, 2.0f, 3.0f }, Vector3{ 0.5f, 0.5f, 0.5f });
+    const SyncState3D current = MakeState(1.0f, 2.0f, 3.0f);
+
+    CheckKind(Collider::ClassifyChange3D(box, current, box, current), ChangeKind3D::None, "unchanged");
+
+    // 位置だけが変わった場合（形状の中心は反映先のTransformとして比較される）
+    const ColliderInfo3D moved = MakeBoxInfo(Vector3{ 4.0f, 2.0f, 3.0f }, Vector3{ 0.5f, 0.5f, 0.5f });
+    CheckKind(Collider::ClassifyChange3D(box, current, moved, MakeState(4.0f, 2.0f, 3.0f)), ChangeKind3D::Transform, "moved");
+
+    // 寸法の変更は、同時に動いていても寸法の変更として扱う（SyncRuntime3DがTransformも合わせて反映する）
+    const ColliderInfo3D resized = MakeBoxInfo(Vector3{ 1.0f, 2.0f, 3.0f }, Vector3{ 1.0f, 0.5f, 0.5f });
+    CheckKind(Collider::ClassifyChange3D(box, current, resized, current), ChangeKind3D::ShapeParameter, "resized");
+    const ColliderInfo3D movedAndResized = MakeBoxInfo(Vector3{ 4.0f, 2.0f, 3.0f }, Vector3{ 1.0f, 0.5f, 0.5f });
+    CheckKind(Collider::ClassifyChange3D(box, current, movedAndResized, MakeState(4.0f, 2.0f, 3.0f)),
+        ChangeKind3D::ShapeParameter, "moved and resized");
+
+    const ColliderInfo3D sphere = MakeSphereInfo(Vector3{ 1.0f, 2.0f, 3.0f }, 0.5f);
+    CheckKind(Collider::ClassifyChange3D(box, current, sphere, current), ChangeKind3D::Structural, "box to sphere");
+    CheckKind(Collider::ClassifyChange3D(sphere, current, MakeSphereInfo(Vector3{ 1.0f, 2.0f, 3.0f }, 2.0f), current),
+        ChangeKind3D::ShapeParameter, "sphere radius");
+
+    ColliderInfo3D capsule;
+    capsule.shape = ColliderInfo3D::CapsuleShape3D{ Vector3{ 0.0f, 0.0f, 0.0f }, 0.5f, 2.0f };
+    ColliderInfo3D tallerCapsule;
+    tallerCapsule.shape = ColliderInfo3D::CapsuleShape3D{ Vector3{ 0.0f, 0.0f, 0.0f }, 0.5f, 3.0f };
+    CheckKind(Collider::ClassifyChange3D(capsule, current, tallerCapsule, current), ChangeKind3D::ShapeParameter, "capsule height");
+
+    // コールバックや属性だけの変更はランタイムに反映する必要がない
+    ColliderInfo3D retagged = box;
+    retagged.attribute.set(3);
+    retagged.isTrigger = true;
+    CheckKind(Collider::ClassifyChange3D(box, current, retagged, current), ChangeKind3D::None, "attribute and trigger");
+}
+
+TEST_CASE(ClassifyChange3D_StructuralTransitions) {
+    const ColliderInfo3D box = MakeBoxInfo(Vector3{ 0.0f, 0.0f, 0.0f }, Vector3{ 0.5f, 0.5f, 0.5f });
+    const SyncState3D current = MakeState(0.0f, 0.0f, 0.0f);
+
+    // 前回の構築に失敗している場合は変更が無くても作り直す
+    SyncState3D broken = current;
+    broken.hasRuntime = false;
+    CheckKind(Collider::ClassifyChange3D(box, broken, box, current), ChangeKind3D::Structural, "missing runtime");
+
+    ColliderInfo3D otherOwner = box;
+    otherOwner.ownerObject = DummyPointer<KashipanEngine::EmptyObject>(0);
+    CheckKind(Collider::ClassifyChange3D(box, current, otherOwner, current), ChangeKind3D::Structural, "owner object");
+    ColliderInfo3D otherSource = box;
+    otherSource.sourceCollider = DummyPointer<KashipanEngine::ICollider>(1);
+    CheckKind(Collider::ClassifyChange3D(box, current, otherSource, current), ChangeKind3D::Structural, "source collider");
+
+    SyncState3D attached = current;
+    attached.attachedBody = DummyPointer<reactphysics3d::RigidBody>(2);
+    CheckKind(Collider::ClassifyChange3D(box, current, box, attached), ChangeKind3D::Structural, "attached to rigid body");
+    CheckKind(Collider::ClassifyChange3D(box, attached, box, current), ChangeKind3D::Structural, "detached from rigid body");
+    CheckKind(Collider::ClassifyChange3D(box, attached, box, attached), ChangeKind3D::None, "same rigid body");
+
+    // ネイティブ判定とRP3Dの切り替えは作り直し、ネイティブ判定のままなら反映するランタイムが無い
+    SyncState3D native = current;
+    native.isNative = true;
+    native.hasRuntime = false;
+    CheckKind(Collider::ClassifyChange3D(box, current, box, native), ChangeKind3D::Structural, "to native");
+    CheckKind(Collider::ClassifyChange3D(box, native, box, current), ChangeKind3D::Structural, "from native");
+    const ColliderInfo3D movedBox = MakeBoxInfo(Vector3{ 5.0f, 0.0f, 0.0f }, Vector3{ 2.0f, 0.5f, 0.5f });
+    CheckKind(Collider::ClassifyChange3D(box, native, movedBox, native), ChangeKind3D::None, "native stays native");
+}
+
+TEST_CASE(ClassifyChange3D_MeshAndHeightFieldTransitions) {
+    const SyncState3D current = MakeState(0.0f, 0.0f, 0.0f);
+
+    ColliderInfo3D::ConvexMeshShape3D convex;
+    convex.modelHandle = 1;
+    ColliderInfo3D mesh;
+    mesh.shape = convex;
+
+    ColliderInfo3D scaled = mesh;
+    std::get<ColliderInfo3D::ConvexMeshShape3D>(scaled.shape).scale = Vector3{ 2.0f, 2.0f, 2.0f };
+    CheckKind(Collider::ClassifyChange3D(mesh, current, scaled, current), ChangeKind3D::ShapeParameter, "mesh scale");
+
+    ColliderInfo3D otherModel = mesh;
+    std::get<ColliderInfo3D::ConvexMeshShape3D>(otherModel.shape).modelHandle = 2;
+    CheckKind(Collider::ClassifyChange3D(mesh, current, otherModel, current), ChangeKind3D::Structural, "mesh model");
+
+    // 同じハンドルでもモデルが再登録されていれば、古い頂点から作ったメッシュは使えない
+    ColliderInfo3D reloadedModel = mesh;
+    std::get<ColliderInfo3D::ConvexMeshShape3D>(reloadedModel.shape).modelRevision = 7;
+    CheckKind(Collider::ClassifyChange3D(mesh, current, reloadedModel, current), ChangeKind3D::Structural, "mesh model revision");
+
+    ColliderInfo3D::HeightFieldShape3D field;
+    field.width = 2;
+    field.length = 2;
+    field.heights = { 0.0f, 1.0f, 2.0f, 3.0f };
+    field.maxHeight = 3.0f;
+    ColliderInfo3D heightField;
+    heightField.shape = field;
+
+    ColliderInfo3D wider = heightField;
+    std::get<ColliderInfo3D::HeightFieldShape3D>(wider.shape).scale.x = 2.0f;
+    CheckKind(Collider::ClassifyChange3D(heightField, current, wider, current), ChangeKind3D::ShapeParameter, "height field xz scale");
+
+    // 高さ方向のスケールは生成時に焼き込まれるため作り直す
+    ColliderInfo3D taller = heightField;
+    std::get<ColliderInfo3D::HeightFieldShape3D>(taller.shape).scale.y = 2.0f;
+    CheckKind(Collider::ClassifyChange3D(heightField, current, taller, current), ChangeKind3D::Structural, "height field y scale");
+
+    ColliderInfo3D reshaped = heightField;
+    std::get<ColliderInfo3D::HeightFieldShape3D>(reshaped.shape).heights[1] = 0.5f;
+    CheckKind(Collider::ClassifyChange3D(heightField, current, reshaped, current), ChangeKind3D::Structural, "height field heights");
+}
+
+TEST_CASE(ColliderSync3D_IncrementalReusesRuntime) {
+    Tests::Fakes::ResetColliderFakes();
+    Collider collider;
+    ColliderInfo3D info = MakeBoxInfo(Vector3{ 0.0f, 0.0f, 0.0f }, Vector3{ 0.5f, 0.5f, 0.5f });
+    const auto id = collider.Add(info);
+    const auto *world = collider.GetPhysicsWorld();
+    TEST_CHECK(world->getNbRigidBodies() == 1);
+
+    collider.UpdateColliderInfo3D(id, info);
+    TEST_CHECK(collider.GetSyncCount3D(ChangeKind3D::None) == 1);
+
+    info = MakeBoxInfo(Vector3{ 3.0f, 0.0f, 0.0f }, Vector3{ 0.5f, 0.5f, 0.5f });
+    collider.UpdateColliderInfo3D(id, info);
+    TEST_CHECK(collider.GetSyncCount3D(ChangeKind3D::Transform) == 1);
+    const auto *body = world->getRigidBody(0);
+    TEST_CHECK(body->getTransform().getPosition() == reactphysics3d::Vector3(3.0f, 0.0f, 0.0f));
+
+    info = MakeBoxInfo(Vector3{ 3.0f, 0.0f, 0.0f }, Vector3{ 2.0f, 0.5f, 0.5f });
+    collider.UpdateColliderInfo3D(id, info);
+    TEST_CHECK(collider.GetSyncCount3D(ChangeKind3D::ShapeParameter) == 1);
+    // 寸法の変更は既存の形状の書き換えで済むため、ボディは作り直されない
+    TEST_CHECK(world->getNbRigidBodies() == 1 && world->getRigidBody(0) == body);
+    const auto *shape = static_cast<const reactphysics3d::BoxShape *>(body->getCollider(0)->getCollisionShape());
+    TEST_CHECK(shape->getHalfExtents() == reactphysics3d::Vector3(2.0f, 0.5f, 0.5f));
+
+    info = MakeSphereInfo(Vector3{ 3.0f, 0.0f, 0.0f }, 1.0f);
+    collider.UpdateColliderInfo3D(id, info);
+    TEST_CHECK(collider.GetSyncCount3D(ChangeKind3D::Structural) == 1);
+    TEST_CHECK(world->getNbRigidBodies() == 1);
+    TEST_CHECK(world->getRigidBody(0)->getCollider(0)->getCollisionShape()->getName() == reactphysics3d::CollisionShapeName::SPHERE);
+}
+
+TEST_CASE(ColliderSync3D_RebuildCountsEveryUpdateAsStructural) {
+    Tests::Fakes::ResetColliderFakes();
+    Collider collider;
+    collider.SetSyncMode3D(Collider::SyncMode3D::Rebuild);
+    const ColliderInfo3D info = MakeBoxInfo(Vector3{ 0.0f, 0.0f, 0.0f }, Vector3{ 0.5f, 0.5f, 0.5f });
+    const auto id = collider.Add(info);
+    collider.UpdateColliderInfo3D(id, info);
+    collider.UpdateColliderInfo3D(id, info);
+    TEST_CHECK(collider.GetSyncCount3D(ChangeKind3D::Structural) == 2);
+    TEST_CHECK(collider.GetSyncCount3D(ChangeKind3D::None) == 0);
+}
+
+TEST_CASE(ColliderSync3D_AttachingRigidBodyRebuilds) {
+    Tests::Fakes::ResetColliderFakes();
+    Collider collider;
+    auto *world = collider.GetPhysicsWorld();
+    auto *rigidBody = world->createRigidBody(reactphysics3d::Transform::identity());
+    auto *owner = DummyPointer<KashipanEngine::EmptyObject>(0);
+
+    ColliderInfo3D info = MakeBoxInfo(Vector3{ 0.0f, 0.0f, 0.0f }, Vector3{ 0.5f, 0.5f, 0.5f });
+    info.ownerObject = owner;
+    const auto id = collider.Add(info);
+    TEST_CHECK(rigidBody->getNbColliders() == 0);
+
+    Tests::Fakes::SetAttachedBody3D(owner, rigidBody);
+    collider.UpdateColliderInfo3D(id, info);
+    TEST_CHECK(collider.GetSyncCount3D(ChangeKind3D::Structural) == 1);
+    TEST_CHECK(rigidBody->getNbColliders() == 1);
+
+    collider.UpdateColliderInfo3D(id, info);
+    TEST_CHECK(collider.GetSyncCount3D(ChangeKind3D::None) == 1);
+
+    collider.Remove3D(id);
+    TEST_CHECK(rigidBody->getNbColliders() == 0);
+    world->destroyRigidBody(rigidBody);
+    Tests::Fakes::ResetColliderFakes();
+}
+
+BENCHMARK_CASE(ColliderSync3D_RebuildVsIncremental) {
+    // 静止した箱1000個と毎フレーム動く箱1000個を、シーンの同期と同じく毎フレーム全て UpdateColliderInfo3D する
+    constexpr std::size_t kStaticCount = 1000;
+    constexpr std::size_t kMovingCount = 1000;
+    constexpr int kFrameCount = 60;
+
+    const auto run = [&](Collider::SyncMode3D mode) {
+        Tests::Fakes::ResetColliderFakes();
+        Collider collider;
+        collider.SetSyncMode3D(mode);
+
+        std::vector<Collider::ColliderID> ids;
+        std::vector<ColliderInfo3D> infos;
+        for (std::size_t i = 0; i < kStaticCount + kMovingCount; ++i) {
+            const float x = static_cast<float>(i % 50) * 2.0f;
+            const float z = static_cast<float>(i / 50) * 2.0f;
+            infos.push_back(MakeBoxInfo(Vector3{ x, 0.0f, z }, Vector3{ 0.5f, 0.5f, 0.5f }));
+            ids.push_back(collider.Add(infos.back()));
+        }
+
+        const double ms = Tests::MeasureMilliseconds([&]() {
+            for (int frame = 0; frame < kFrameCount; ++frame) {
+                for (std::size_t i = kStaticCount; i < infos.size(); ++i) {
+                    std::get<ColliderInfo3D::BoxShape3D>(infos[i].shape).center.y = static_cast<float>(frame) * 0.01f;
+                }
+                for (std::size_t i = 0; i < infos.size(); ++i) {
+                    collider.UpdateColliderInfo3D(ids[i], infos[i]);
+                }
+            }
+        });
+        return ms / kFrameCount;
+    };
+
+    const double rebuild = run(Collider::SyncMode3D::Rebuild);
+    const double incremental = run(Collider::SyncMode3D::Incremental);
+    Tests::ReportBenchmark("ColliderSync3D 1k static + 1k moving boxes, Rebuild (per frame)", rebuild, "ms");
+    Tests::ReportBenchmark("ColliderSync3D 1k static + 1k moving boxes, Incremental (per frame)", incremental, "ms");
+    Tests::ReportBenchmark("ColliderSync3D Rebuild / Incremental", rebuild / incremental, "x");
+}
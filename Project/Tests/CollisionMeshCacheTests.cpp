@@ -0,0 +1,98 @@
+// CollisionMeshCache のテスト
+//
+// モデルの頂点は Fakes/ColliderFakes の差し替えで与える。SetModelGeometry で同じハンドルへ
+// 別の世代番号を設定し直すことで、ModelManager でのモデルの再登録・ハンドルの再利用を再現する。
+
+#include <vector>
+
+#include "TestFramework.h"
+#include "Fakes/ColliderFakes.h"
+#include "Objects/Collision/Collider.h"
+#include "Objects/Collision/CollisionMeshCache.h"
+
+using KashipanEngine::Collider;
+using KashipanEngine::ColliderInfo3D;
+using KashipanEngine::CollisionMeshCache;
+
+namespace {
+
+constexpr std::uint32_t kModel = 1;
+
+/// @brief 原点を中心とする一辺 2 * halfSize の立方体を設定する
+void SetCubeModel(std::uint32_t revision, float halfSize) {
+    const float h = halfSize;
+    std::vector<Vector3> vertices = {
+        { -h, -h, -h }, { h, -h, -h }, { h, h, -h }, { -h, h, -h },
+        { -h, -h, h }, { h, -h, h }, { h, h, h }, { -h, h, h },
+    };
+    std::vector<std::uint32_t> indices = {
+        0, 2, 1, 0, 3, 2, 4, 5, 6, 4, 6, 7,
+        0, 1, 5, 0, 5, 4, 3, 7, 6, 3, 6, 2,
+        0, 4, 7, 0, 7, 3, 1, 2, 6, 1, 6, 5,
+    };
+    Tests::Fakes::SetModelGeometry(kModel, revision, std::move(vertices), std::move(indices));
+}
+
+ColliderInfo3D MakeConvexMeshInfo(std::uint32_t revision) {
+    ColliderInfo3D info;
+    ColliderInfo3D::ConvexMeshShape3D shape;
+    shape.modelHandle = kModel;
+    shape.modelRevision = revision;
+    info.shape = shape;
+    return info;
+}
+
+} // namespace
+
+TEST_CASE(CollisionMeshCache_SharesMeshPerModelRevision) {
+    Tests::Fakes::ResetColliderFakes();
+    reactphysics3d::PhysicsCommon physicsCommon;
+    CollisionMeshCache cache(physicsCommon);
+
+    SetCubeModel(1, 1.0f);
+    auto *first = cache.AcquireConvex(kModel, 1);
+    auto *second = cache.AcquireConvex(kModel, 1);
+    TEST_CHECK(first != nullptr && first == second);
+    TEST_CHECK(cache.GetRefCount(kModel, 1, true) == 2);
+
+    // モデルが再登録された後は、同じハンドルでも新しい世代のメッシュを別に構築する
+    SetCubeModel(2, 3.0f);
+    auto *reloaded = cache.AcquireConvex(kModel, 2);
+    TEST_CHECK(reloaded != nullptr && reloaded != first);
+    TEST_CHECK(reloaded->getBounds().getMax().x == 3.0f);
+    TEST_CHECK(cache.GetEntryCount() == 2);
+
+    // 古い世代の参照が残っている間は古いメッシュを保持し、全て返却された時点で破棄する
+    cache.Release(kModel, 1, true);
+    cache.Release(kModel, 1, true);
+    TEST_CHECK(cache.GetRefCount(kModel, 1, true) == 0);
+    TEST_CHECK(cache.GetEntryCount() == 1);
+
+    // 既に置き換わった世代のメッシュを新たに要求しても、新しい世代の頂点で構築したりはしない
+    TEST_CHECK(cache.AcquireConvex(kModel, 1) == nullptr);
+    TEST_CHECK(cache.GetEntryCount() == 1);
+
+    cache.Release(kModel, 2, true);
+    TEST_CHECK(cache.GetEntryCount() == 0);
+}
+
+TEST_CASE(CollisionMeshCache_ColliderRebuildsOnModelReload) {
+    Tests::Fakes::ResetColliderFakes();
+    Collider collider;
+    const auto &cache = collider.GetMeshCache();
+
+    SetCubeModel(1, 1.0f);
+    const auto id = collider.Add(MakeConvexMeshInfo(1));
+    TEST_CHECK(cache.GetRefCount(kModel, 1, true) == 1);
+
+    SetCubeModel(2, 3.0f);
+    collider.UpdateColliderInfo3D(id, MakeConvexMeshInfo(2));
+    TEST_CHECK(collider.GetSyncCount3D(Collider::ChangeKind3D::Structural) == 1);
+    TEST_CHECK(cache.GetRefCount(kModel, 1, true) == 0);
+    TEST_CHECK(cache.GetRefCount(kModel, 2, true) == 1);
+    TEST_CHECK(cache.GetEntryCount() == 1);
+
+    collider.Remove3D(id);
+    TEST_CHECK(cache.GetEntryCount() == 0);
+    Tests::Fakes::ResetColliderFakes();
+}
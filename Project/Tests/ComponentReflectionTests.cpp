@@ -0,0 +1,572 @@
+// コンポーネントのメンバー変数表（ADD_MEMBER_VARIABLE）のテストと、生成・複製のベンチマーク
+//
+// 保存キーを指定したメンバー変数（ADD_SERIALIZED_MEMBER_VARIABLE）は、表だけで保存・読み込み・複製できることも確かめる。
+// コンストラクター内だけで登録される型が実行中に加わっても、他のスレッドが読んでいる既存の表が動かないことも確かめる。
+// 表を使う外部からの書き込み（ParameterBinding の解決済みハンドル）についても、コンポーネントの追加・削除や
+// スクリプトのリロードで失効して解決し直されることと、onModified の呼び出しがまとまることを確かめる。
+//
+// 実際のコンポーネントはDirectX等に依存するため、同じ登録の仕組みを使うテスト用のコンポーネントで測る。
+// スクリプト変数への適用は、SerializedReflectionTestComponent を ScriptComponent として扱う差し替え（Tests/Fakes/ScriptFakes.h）で確かめる。
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "TestFramework.h"
+#include "Fakes/ScriptFakes.h"
+#include "Objects/IObjectComponent.h"
+#include "Objects/ObjectContext.h"
+#include "Objects/ParameterBinding.h"
+#include "Scene/SceneContext.h"
+
+namespace KashipanEngine {
+
+/// @brief 基底クラスでのメンバー変数登録を確かめるための基底コンポーネント
+class ReflectionTestBase : public IObjectComponent {
+public:
+    template <typename Self>
+    static void RegisterMemberVariables(MemberVariableTableBuilder<Self> &builder) {
+        ADD_MEMBER_VARIABLE(baseValue_);
+    }
+
+    /// @brief 所属オブジェクトのコンテキスト（ParameterBinding の解決用）
+    ObjectContext *GetContext() const { return GetOwnerObjectContext(); }
+
+protected:
+    ReflectionTestBase(const std::string &typeName, size_t componentTypeID)
+        : IObjectComponent(typeName, 0xFF, componentTypeID) {}
+
+private:
+    int baseValue_ = 7;
+};
+
+/// @brief Transform程度の規模のメンバー変数を持つテスト用コンポーネント
+class ReflectionTestComponent final : public ReflectionTestBase {
+public:
+    struct Params {
+        float intensity = 1.0f;
+        float color[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+    };
+
+    ReflectionTestComponent() : ReflectionTestBase("ReflectionTestComponent", GetComponentTypeID<ReflectionTestComponent>()) {}
+    OBJECT_COMPONENT_MEMBER_VARIABLES(ReflectionTestComponent,
+        ReflectionTestBase::RegisterMemberVariables(builder);
+        ADD_MEMBER_VARIABLE_WITH_CALLBACK(translate_, [](auto &self) { ++self.modifiedCount_; });
+        ADD_MEMBER_VARIABLE_WITH_CALLBACK(rotate_, [](auto &self) { ++self.modifiedCount_; });
+        ADD_MEMBER_VARIABLE_WITH_CALLBACK(scale_, [](auto &self) { ++self.modifiedCount_; });
+        ADD_MEMBER_VARIABLE(name_);
+        ADD_MEMBER_VARIABLE(enabled_);
+        ADD_MEMBER_VARIABLE(params_.intensity);
+        ADD_MEMBER_VARIABLE(params_.color[0]);
+        ADD_MEMBER_VARIABLE(params_.color[1]);
+        ADD_MEMBER_VARIABLE(params_.color[2]);
+        ADD_MEMBER_VARIABLE(params_.color[3]);
+        ADD_NAMED_MEMBER_VARIABLE_WITH_CALLBACK("speed", speed_, [](auto &self) { ++self.modifiedCount_; });
+    )
+
+    std::unique_ptr<IObjectComponent> Clone() const override {
+        auto ptr = std::make_unique<ReflectionTestComponent>();
+        ptr->translate_ = translate_;
+        ptr->rotate_ = rotate_;
+        ptr->scale_ = scale_;
+        ptr->name_ = name_;
+        ptr->enabled_ = enabled_;
+        ptr->params_ = params_;
+        ptr->speed_ = speed_;
+        return ptr;
+    }
+
+    float GetTranslate() const { return translate_; }
+    float GetColor(size_t index) const { return params_.color[index]; }
+    int GetModifiedCount() const { return modifiedCount_; }
+
+private:
+    float translate_ = 0.0f;
+    float rotate_ = 0.0f;
+    float scale_ = 1.0f;
+    std::string name_ = "reflection";
+    bool enabled_ = true;
+    Params params_;
+    float speed_ = 0.0f;
+    int modifiedCount_ = 0;
+};
+
+REGISTER_COMPONENT_OBJECT(ReflectionTestComponent)
+
+/// @brief 保存・読み込み・複製をメンバー変数表だけで行うテスト用コンポーネント
+class SerializedReflectionTestComponent final : public IObjectComponent {
+public:
+    OBJECT_COMPONENT_CONSTRUCTOR(SerializedReflectionTestComponent, 1, )
+    OBJECT_COMPONENT_MEMBER_VARIABLES(SerializedReflectionTestComponent,
+        ADD_SERIALIZED_MEMBER_VARIABLE(velocity_, { .serializedKey = "velocity", .labelKey = "component.velocity.velocity", .dragSpeed = 0.01f });
+        ADD_SERIALIZED_MEMBER_VARIABLE(speed_, { .serializedKey = "speed" }, [](auto &self) { ++self.modifiedCount_; });
+        ADD_SERIALIZED_MEMBER_VARIABLE(name_, { .serializedKey = "name" });
+        ADD_MEMBER_VARIABLE(runtimeOnly_);
+        MEMBER_VARIABLES_COVER_ALL_STATE();
+    )
+
+    std::unique_ptr<IObjectComponent> Clone() const override { return CloneByMemberVariables<SerializedReflectionTestComponent>(); }
+
+    void Set(const Vector3 &velocity, float speed, const std::string &name, int runtimeOnly) {
+        velocity_ = velocity;
+        speed_ = speed;
+        name_ = name;
+        runtimeOnly_ = runtimeOnly;
+    }
+    const Vector3 &GetVelocity() const { return velocity_; }
+    float GetSpeed() const { return speed_; }
+    const std::string &GetName() const { return name_; }
+    int GetRuntimeOnly() const { return runtimeOnly_; }
+    int GetModifiedCount() const { return modifiedCount_; }
+
+    ObjectContext *GetContext() const { return GetOwnerObjectContext(); }
+    JSON Save() const { return SaveToJson(); }
+    bool Load(const JSON &json) { return LoadFromJson(json); }
+    void CopyFrom(const SerializedReflectionTestComponent &source) { CopyMemberVariablesFrom(source); }
+
+private:
+    Vector3 velocity_{ 0.0f, 0.0f, 0.0f };
+    float speed_ = 1.0f;
+    std::string name_;
+    /// @brief 保存キーを持たない（保存しないが、複製ではコピーする）
+    int runtimeOnly_ = 0;
+    int modifiedCount_ = 0;
+};
+
+REGISTER_COMPONENT_OBJECT(SerializedReflectionTestComponent)
+
+/// @brief 名前空間スコープでは登録せず、最初の生成時にコンストラクター内の REGISTER_COMPONENT_OBJECT で登録されるテスト用コンポーネント
+class LateRegisteredReflectionTestComponent final : public IObjectComponent {
+public:
+    OBJECT_COMPONENT_CONSTRUCTOR(LateRegisteredReflectionTestComponent, 1, )
+    OBJECT_COMPONENT_MEMBER_VARIABLES(LateRegisteredReflectionTestComponent,
+        ADD_MEMBER_VARIABLE(value_);
+    )
+
+    std::unique_ptr<IObjectComponent> Clone() const override { return std::make_unique<LateRegisteredReflectionTestComponent>(); }
+
+private:
+    float value_ = 0.0f;
+};
+
+} // namespace KashipanEngine
+
+using KashipanEngine::IObjectComponent;
+using KashipanEngine::LateRegisteredReflectionTestComponent;
+using KashipanEngine::ParameterBinding;
+using KashipanEngine::ParameterBindingHandle;
+using KashipanEngine::ParameterBindingTable;
+using KashipanEngine::ReflectionTestComponent;
+using KashipanEngine::SerializedReflectionTestComponent;
+
+namespace {
+
+ParameterBinding MakeMemberBinding(const std::string &componentType, int componentIndex, const std::string &parameterName) {
+    ParameterBinding binding;
+    binding.componentType = componentType;
+    binding.componentIndex = componentIndex;
+    binding.parameterName = parameterName;
+    return binding;
+}
+
+ParameterBinding MakeScriptBinding(const std::string &variableName) {
+    ParameterBinding binding = MakeMemberBinding("SerializedReflectionTestComponent", 0, variableName);
+    binding.isScriptVariable = true;
+    return binding;
+}
+
+} // namespace
+
+TEST_CASE(ComponentReflection_TableIsRegisteredOnce) {
+    // 静的初期化で登録済みのため、インスタンスを作る前から型の表が引ける
+    ReflectionTestComponent first;
+    ReflectionTestComponent second;
+    const auto members = first.GetAllMemberVariables();
+    TEST_CHECK(members.size() == 12);
+    TEST_CHECK(members.data() == second.GetAllMemberVariables().data());
+    if (members.size() == 12) {
+        // 基底クラスの登録が先に来る
+        TEST_CHECK(members[0].name == "baseValue_");
+        TEST_CHECK(members[1].name == "translate_");
+        TEST_CHECK(members[7].name == "params_.color[0]");
+        TEST_CHECK(members[11].name == "speed");
+    }
+}
+
+TEST_CASE(ComponentReflection_LateRegistrationKeepsExistingTables) {
+    ReflectionTestComponent existing;
+    const auto members = existing.GetAllMemberVariables();
+    const auto *speed = existing.GetMemberVariable("speed");
+    TEST_CHECK(speed != nullptr);
+
+    // 他のスレッドが登録済みの型の表を読み続けている間に、コンストラクター内での登録を初めて実行する
+    std::atomic<bool> isReading{ true };
+    std::atomic<bool> hasStarted{ false };
+    std::atomic<size_t> mismatchCount{ 0 };
+    std::thread reader([&]() {
+        while (isReading.load()) {
+            if (existing.GetMemberVariable("speed") != speed || existing.GetAllMemberVariables().data() != members.data()) {
+                mismatchCount.fetch_add(1);
+            }
+            hasStarted.store(true);
+        }
+    });
+    while (!hasStarted.load()) std::this_thread::yield();
+    std::vector<std::unique_ptr<LateRegisteredReflectionTestComponent>> lateComponents;
+    for (int i = 0; i < 4; ++i) lateComponents.push_back(std::make_unique<LateRegisteredReflectionTestComponent>());
+    isReading.store(false);
+    reader.join();
+
+    // 後から登録された型の表が加わっても、既存の表は同じ位置のまま読める
+    TEST_CHECK(mismatchCount.load() == 0);
+    TEST_CHECK(existing.GetAllMemberVariables().data() == members.data());
+    TEST_CHECK(lateComponents.front()->GetAllMemberVariables().size() == 1);
+    TEST_CHECK(lateComponents.front()->GetMemberVariable("value_") != nullptr);
+    TEST_CHECK(lateComponents.front()->GetAllMemberVariables().data() == lateComponents.back()->GetAllMemberVariables().data());
+}
+
+TEST_CASE(ComponentReflection_AddressAndCallback) {
+    ReflectionTestComponent component;
+    const auto *translate = component.GetMemberVariable("translate_");
+    TEST_CHECK(translate != nullptr);
+    if (translate) {
+        *static_cast<float *>(translate->GetAddress(component)) = 3.5f;
+        translate->NotifyModified(component);
+        TEST_CHECK(component.GetTranslate() == 3.5f);
+        TEST_CHECK(component.GetModifiedCount() == 1);
+    }
+
+    const auto *color = component.GetMemberVariable("params_.color[2]");
+    TEST_CHECK(color != nullptr);
+    if (color) {
+        *static_cast<float *>(color->GetAddress(component)) = 0.25f;
+        TEST_CHECK(component.GetColor(2) == 0.25f);
+        TEST_CHECK(color->onModified == nullptr);
+    }
+
+    const auto *baseValue = component.GetMemberVariable("baseValue_");
+    TEST_CHECK(baseValue != nullptr);
+    if (baseValue) {
+        TEST_CHECK(*static_cast<int *>(baseValue->GetAddress(component)) == 7);
+    }
+    TEST_CHECK(component.GetMemberVariable("missing") == nullptr);
+}
+
+TEST_CASE(ComponentReflection_SerializedMembersSaveAndLoad) {
+    SerializedReflectionTestComponent source;
+    source.Set(Vector3(1.0f, -2.0f, 3.5f), 4.0f, "enemy", 9);
+    const auto json = source.Save();
+    TEST_CHECK(json.size() == 3);
+    TEST_CHECK(json.contains("velocity") && json["velocity"]["y"].get<float>() == -2.0f);
+    TEST_CHECK(json.value("speed", 0.0f) == 4.0f);
+    TEST_CHECK(json.value("name", std::string{}) == "enemy");
+
+    SerializedReflectionTestComponent loaded;
+    TEST_CHECK(loaded.Load(json));
+    TEST_CHECK(loaded.GetVelocity() == Vector3(1.0f, -2.0f, 3.5f));
+    TEST_CHECK(loaded.GetSpeed() == 4.0f && loaded.GetName() == "enemy");
+    TEST_CHECK(loaded.GetRuntimeOnly() == 0);
+    TEST_CHECK(loaded.GetModifiedCount() == 1);
+
+    // JSONに無いキーの変数はそのまま残す
+    SerializedReflectionTestComponent partial;
+    TEST_CHECK(partial.Load(KashipanEngine::JSON{ { "name", "player" } }));
+    TEST_CHECK(partial.GetName() == "player" && partial.GetSpeed() == 1.0f);
+    TEST_CHECK(partial.GetModifiedCount() == 0);
+
+    // MEMBER_VARIABLES_COVER_ALL_STATE を指定していない型は、オブジェクトの複製で今まで通り Clone を使う
+    ReflectionTestComponent uncovered;
+    TEST_CHECK(!uncovered.IsStateCoveredByMemberVariables());
+}
+
+TEST_CASE(ComponentReflection_CloneCopiesTableMembers) {
+    SerializedReflectionTestComponent source;
+    source.Set(Vector3(0.5f, 0.25f, 0.125f), 2.0f, "copied", 42);
+    TEST_CHECK(source.IsStateCoveredByMemberVariables());
+
+    auto clone = source.Clone();
+    auto *copied = dynamic_cast<SerializedReflectionTestComponent *>(clone.get());
+    TEST_CHECK(copied != nullptr);
+    if (copied) {
+        TEST_CHECK(copied->GetVelocity() == source.GetVelocity());
+        TEST_CHECK(copied->GetSpeed() == 2.0f && copied->GetName() == "copied");
+        // 保存しない変数も複製ではコピーする
+        TEST_CHECK(copied->GetRuntimeOnly() == 42);
+        TEST_CHECK(copied->GetModifiedCount() == 1);
+    }
+}
+
+BENCHMARK_CASE(ComponentReflection_InstantiateAndClone) {
+    constexpr size_t kComponentCount = 100000;
+    std::vector<std::unique_ptr<IObjectComponent>> components;
+    components.reserve(kComponentCount);
+
+    // 型名からの生成（シーン・プレハブの読み込みと同じ経路）
+    const double instantiateMs = Tests::MeasureBestMilliseconds(5, [&]() {
+        components.clear();
+        for (size_t i = 0; i < kComponentCount; ++i) {
+            components.push_back(KashipanEngine::CreateObjectComponentByType("ReflectionTestComponent"));
+        }
+    });
+    Tests::ReportBenchmark("instantiate by type name (per component)", instantiateMs * 1.0e6 / kComponentCount, "ns");
+
+    std::vector<std::unique_ptr<IObjectComponent>> clones;
+    clones.reserve(kComponentCount);
+    const double cloneMs = Tests::MeasureBestMilliseconds(5, [&]() {
+        clones.clear();
+        for (const auto &component : components) {
+            clones.push_back(component->Clone());
+        }
+    });
+    Tests::ReportBenchmark("clone (per component)", cloneMs * 1.0e6 / kComponentCount, "ns");
+
+    // メンバー変数表による複製（MEMBER_VARIABLES_COVER_ALL_STATE の型。オブジェクトの複製と同じ経路）と、
+    // 表を使う前の複製（Clone で一時インスタンスを作り、JSONを経由してプールのインスタンスへ移す）の比較
+    std::vector<std::unique_ptr<SerializedReflectionTestComponent>> sources;
+    std::vector<std::unique_ptr<SerializedReflectionTestComponent>> targets;
+    for (size_t i = 0; i < kComponentCount; ++i) {
+        sources.push_back(std::make_unique<SerializedReflectionTestComponent>());
+        sources.back()->Set(Vector3(static_cast<float>(i), 1.0f, 2.0f), 3.0f, "copy", static_cast<int>(i));
+        targets.push_back(std::make_unique<SerializedReflectionTestComponent>());
+    }
+    const double tableCopyMs = Tests::MeasureBestMilliseconds(5, [&]() {
+        for (size_t i = 0; i < kComponentCount; ++i) targets[i]->CopyFrom(*sources[i]);
+    });
+    const double jsonCopyMs = Tests::MeasureBestMilliseconds(5, [&]() {
+        for (size_t i = 0; i < kComponentCount; ++i) {
+            auto clone = sources[i]->Clone();
+            targets[i]->Load(static_cast<SerializedReflectionTestComponent &>(*clone).Save());
+        }
+    });
+    Tests::ReportBenchmark("copy state by member table (per component)", tableCopyMs * 1.0e6 / kComponentCount, "ns");
+    Tests::ReportBenchmark("copy state by Clone + JSON (per component)", jsonCopyMs * 1.0e6 / kComponentCount, "ns");
+    TEST_CHECK(targets.back()->GetRuntimeOnly() == static_cast<int>(kComponentCount - 1));
+
+    // 外部からのメンバー変数アクセス（ParameterBinding・KeyFrameAnimatorと同じ経路）
+    float sink = 0.0f;
+    const double lookupMs = Tests::MeasureBestMilliseconds(5, [&]() {
+        for (const auto &component : components) {
+            const auto *member = component->GetMemberVariable("params_.intensity");
+            sink += *static_cast<float *>(member->GetAddress(*component));
+        }
+    });
+    Tests::ReportBenchmark("member lookup + read (per component)", lookupMs * 1.0e6 / kComponentCount, "ns");
+    TEST_CHECK(sink > 0.0f);
+}
+
+TEST_CASE(ParameterBinding_HandleGoesStaleOnComponentChanges) {
+    KashipanEngine::Scene scene(std::string("ParameterBindingTest"));
+    auto *object = scene.GetSceneContext()->CreateEmptyObject("Target");
+    auto *first = object->AddComponent<ReflectionTestComponent>();
+    TEST_CHECK(first != nullptr);
+    if (!first) return;
+    auto *context = first->GetContext();
+
+    ParameterBindingHandle handle;
+    TEST_CHECK(KashipanEngine::BindParameterBinding(context, MakeMemberBinding("ReflectionTestComponent", 0, "translate_"), nullptr, handle));
+    TEST_CHECK(handle.IsCurrent());
+    TEST_CHECK(KashipanEngine::WriteParameterBindingHandle(handle, 2.0f));
+    TEST_CHECK(first->GetTranslate() == 2.0f);
+    TEST_CHECK(first->GetModifiedCount() == 1);
+
+    // 他の型のコンポーネントでも、追加・削除で構成の世代が進んで失効する
+    auto *other = object->AddComponent<SerializedReflectionTestComponent>();
+    TEST_CHECK(!handle.IsCurrent());
+    TEST_CHECK(KashipanEngine::BindParameterBinding(context, MakeMemberBinding("ReflectionTestComponent", 0, "translate_"), nullptr, handle));
+    TEST_CHECK(handle.IsCurrent());
+    TEST_CHECK(object->RemoveComponent(other));
+    TEST_CHECK(!handle.IsCurrent());
+
+    // 解決に失敗したハンドルも世代を記録し、構成が変わるまでは解決し直さなくてよい
+    ParameterBindingHandle missing;
+    TEST_CHECK(!KashipanEngine::BindParameterBinding(context, MakeMemberBinding("ReflectionTestComponent", 1, "translate_"), nullptr, missing));
+    TEST_CHECK(!missing.IsBound() && missing.IsCurrent());
+    object->AddComponent<ReflectionTestComponent>();
+    TEST_CHECK(!missing.IsCurrent());
+    TEST_CHECK(KashipanEngine::BindParameterBinding(context, MakeMemberBinding("ReflectionTestComponent", 1, "translate_"), nullptr, missing));
+
+    // 自分自身へのバインドは解決しない
+    ParameterBindingHandle self;
+    TEST_CHECK(!KashipanEngine::BindParameterBinding(context, MakeMemberBinding("ReflectionTestComponent", 0, "translate_"), first, self));
+}
+
+TEST_CASE(ParameterBinding_ScriptHandleGoesStaleOnReload) {
+    Tests::Fakes::ResetScriptFakes();
+    KashipanEngine::Scene scene(std::string("ParameterBindingTest"));
+    auto *object = scene.GetSceneContext()->CreateEmptyObject("Target");
+    auto *script = object->AddComponent<SerializedReflectionTestComponent>();
+    TEST_CHECK(script != nullptr);
+    if (!script) return;
+    auto *context = script->GetContext();
+
+    float beforeReload = 0.0f;
+    Tests::Fakes::SetFakeScriptFloatVariable(script, "hp", &beforeReload);
+    ParameterBindingHandle handle;
+    TEST_CHECK(KashipanEngine::BindParameterBinding(context, MakeScriptBinding("hp"), nullptr, handle));
+    TEST_CHECK(handle.kind == ParameterBindingHandle::Kind::ScriptFloat);
+    TEST_CHECK(KashipanEngine::WriteParameterBindingHandle(handle, 5.0f));
+    TEST_CHECK(beforeReload == 5.0f);
+
+    // まだ無い変数へのバインドも、リロードで現れる場合に備えてスクリプトの世代を記録する
+    ParameterBindingHandle pending;
+    TEST_CHECK(!KashipanEngine::BindParameterBinding(context, MakeScriptBinding("speed"), nullptr, pending));
+    TEST_CHECK(pending.IsCurrent());
+
+    // コンポーネント構成が変わらなくても、リロード（変数一覧の作り直し）で失効する
+    Tests::Fakes::ReloadFakeScript(script);
+    float afterReload = 0.0f;
+    float speed = 0.0f;
+    Tests::Fakes::SetFakeScriptFloatVariable(script, "hp", &afterReload);
+    Tests::Fakes::SetFakeScriptFloatVariable(script, "speed", &speed);
+    TEST_CHECK(!handle.IsCurrent());
+    TEST_CHECK(!pending.IsCurrent());
+    TEST_CHECK(KashipanEngine::BindParameterBinding(context, MakeScriptBinding("hp"), nullptr, handle));
+    TEST_CHECK(KashipanEngine::WriteParameterBindingHandle(handle, 7.0f));
+    TEST_CHECK(afterReload == 7.0f && beforeReload == 5.0f);
+    TEST_CHECK(KashipanEngine::BindParameterBinding(context, MakeScriptBinding("speed"), nullptr, pending));
+
+    // ScriptComponent でない対象へのスクリプト変数のバインドは解決しない
+    ParameterBindingHandle notScript;
+    ParameterBinding memberAsScript = MakeMemberBinding("ReflectionTestComponent", 0, "translate_");
+    memberAsScript.isScriptVariable = true;
+    object->AddComponent<ReflectionTestComponent>();
+    TEST_CHECK(!KashipanEngine::BindParameterBinding(context, memberAsScript, nullptr, notScript));
+    Tests::Fakes::ResetScriptFakes();
+}
+
+TEST_CASE(ParameterBindingTable_UpdateRebindsStaleHandles) {
+    Tests::Fakes::ResetScriptFakes();
+    KashipanEngine::Scene scene(std::string("ParameterBindingTest"));
+    auto *object = scene.GetSceneContext()->CreateEmptyObject("Target");
+    auto *first = object->AddComponent<ReflectionTestComponent>();
+    auto *second = object->AddComponent<ReflectionTestComponent>();
+    auto *script = object->AddComponent<SerializedReflectionTestComponent>();
+    TEST_CHECK(first && second && script);
+    if (!first || !second || !script) return;
+    auto *context = first->GetContext();
+    float hp = 0.0f;
+    Tests::Fakes::SetFakeScriptFloatVariable(script, "hp", &hp);
+
+    std::vector<ParameterBinding> bindings{
+        MakeMemberBinding("ReflectionTestComponent", 0, "translate_"),
+        MakeScriptBinding("hp"),
+    };
+    ParameterBindingTable table;
+    TEST_CHECK(table.Apply(context, bindings, 1.0f, nullptr) == 2);
+    TEST_CHECK(first->GetTranslate() == 1.0f && hp == 1.0f);
+    const void *resolvedAddress = table.GetHandles()[0].address;
+
+    // 構成・変数一覧が変わらない間は解決し直さない（同じ書き込み先を使い続ける）
+    TEST_CHECK(table.Apply(context, bindings, 2.0f, nullptr) == 2);
+    TEST_CHECK(table.GetHandles()[0].address == resolvedAddress);
+
+    // 0番目の同型コンポーネントを削除すると、次の適用で残った方（新しい0番目）へ解決し直す
+    TEST_CHECK(object->RemoveComponent(first));
+    TEST_CHECK(table.Apply(context, bindings, 3.0f, nullptr) == 2);
+    TEST_CHECK(second->GetTranslate() == 3.0f);
+    TEST_CHECK(table.GetHandles()[0].IsCurrent());
+
+    // スクリプトのリロードでは、コンポーネント構成が同じでもスクリプト変数のハンドルを解決し直す
+    Tests::Fakes::ReloadFakeScript(script);
+    float reloadedHp = 0.0f;
+    Tests::Fakes::SetFakeScriptFloatVariable(script, "hp", &reloadedHp);
+    TEST_CHECK(table.Apply(context, bindings, 4.0f, nullptr) == 2);
+    TEST_CHECK(reloadedHp == 4.0f && hp == 3.0f);
+
+    // 一覧を編集した場合は Invalidate で解決し直す
+    bindings[0].parameterName = "rotate_";
+    table.Invalidate();
+    TEST_CHECK(table.Apply(context, bindings, 5.0f, nullptr) == 2);
+    TEST_CHECK(second->GetTranslate() == 4.0f);
+    TEST_CHECK(*static_cast<float *>(table.GetHandles()[0].address) == 5.0f);
+    Tests::Fakes::ResetScriptFakes();
+}
+
+TEST_CASE(ParameterBinding_BatchWriteCoalescesModifiedCallbacks) {
+    KashipanEngine::Scene scene(std::string("ParameterBindingTest"));
+    auto *object = scene.GetSceneContext()->CreateEmptyObject("Target");
+    auto *first = object->AddComponent<ReflectionTestComponent>();
+    auto *second = object->AddComponent<ReflectionTestComponent>();
+    TEST_CHECK(first && second);
+    if (!first || !second) return;
+    auto *context = first->GetContext();
+
+    auto bind = [context](int componentIndex, const std::string &parameterName) {
+        ParameterBindingHandle handle;
+        KashipanEngine::BindParameterBinding(context, MakeMemberBinding("ReflectionTestComponent", componentIndex, parameterName), nullptr, handle);
+        return handle;
+    };
+
+    // 同じ対象・同じコールバックが続く間は1回にまとめ、値は全て書き込む（後の値が残る）
+    const std::vector<ParameterBindingHandle> duplicated{ bind(0, "speed"), bind(0, "speed"), bind(0, "speed") };
+    const std::vector<float> values{ 1.0f, 2.0f, 3.0f };
+    TEST_CHECK(KashipanEngine::WriteParameterBindingHandles(duplicated, values) == 3);
+    TEST_CHECK(first->GetModifiedCount() == 1);
+    TEST_CHECK(*static_cast<float *>(duplicated[0].address) == 3.0f);
+
+    // コールバックか対象が変わる時点で区切る
+    const std::vector<ParameterBindingHandle> mixed{
+        bind(0, "speed"), bind(0, "speed"), bind(0, "translate_"), bind(1, "translate_"), bind(0, "speed"),
+    };
+    TEST_CHECK(KashipanEngine::WriteParameterBindingHandles(mixed, 4.0f) == 5);
+    // speed×2（1回）・first の translate_（1回）・second の translate_（1回）・speed（1回）
+    TEST_CHECK(first->GetModifiedCount() == 1 + 3);
+    TEST_CHECK(second->GetModifiedCount() == 1);
+    TEST_CHECK(first->GetTranslate() == 4.0f && second->GetTranslate() == 4.0f);
+
+    // 書き込めないハンドル（未解決）は数えず、コールバックの区切りにもならない
+    const std::vector<ParameterBindingHandle> withUnbound{ bind(0, "speed"), bind(0, "missing"), bind(0, "speed") };
+    TEST_CHECK(KashipanEngine::WriteParameterBindingHandles(withUnbound, 5.0f) == 2);
+    TEST_CHECK(first->GetModifiedCount() == 4 + 1);
+}
+
+BENCHMARK_CASE(ParameterBinding_HandleWritesVsNameLookup) {
+    constexpr size_t kFrameCount = 100000;
+    KashipanEngine::Scene scene(std::string("ParameterBindingBenchmark"));
+    auto *object = scene.GetSceneContext()->CreateEmptyObject("Target");
+    object->AddComponent<SerializedReflectionTestComponent>();
+    auto *target = object->AddComponent<ReflectionTestComponent>();
+    TEST_CHECK(target != nullptr);
+    if (!target) return;
+    auto *context = target->GetContext();
+
+    // KeyFrameAnimator で Transform 相当の値と色を毎フレーム動かす場合と同じ規模のバインド先
+    const std::vector<ParameterBinding> bindings{
+        MakeMemberBinding("ReflectionTestComponent", 0, "translate_"),
+        MakeMemberBinding("ReflectionTestComponent", 0, "rotate_"),
+        MakeMemberBinding("ReflectionTestComponent", 0, "scale_"),
+        MakeMemberBinding("ReflectionTestComponent", 0, "params_.intensity"),
+        MakeMemberBinding("ReflectionTestComponent", 0, "params_.color[0]"),
+        MakeMemberBinding("ReflectionTestComponent", 0, "params_.color[1]"),
+        MakeMemberBinding("ReflectionTestComponent", 0, "params_.color[2]"),
+        MakeMemberBinding("ReflectionTestComponent", 0, "params_.color[3]"),
+    };
+    const std::vector<float> values{ 1.0f, 2.0f, 3.0f, 4.0f, 0.1f, 0.2f, 0.3f, 0.4f };
+    const double bindingCount = static_cast<double>(kFrameCount * bindings.size());
+
+    // 適用のたびに型名・メンバー名で検索する（ハンドルを使う前の ApplyParameterBinding と同じ経路）
+    size_t lookupWritten = 0;
+    const double lookupMs = Tests::MeasureBestMilliseconds(5, [&]() {
+        for (size_t frame = 0; frame < kFrameCount; ++frame) {
+            for (size_t i = 0; i < bindings.size(); ++i) {
+                if (KashipanEngine::ApplyParameterBinding(context, bindings[i], values[i], nullptr)) ++lookupWritten;
+            }
+        }
+    });
+    Tests::ReportBenchmark("apply by name lookup (per binding)", lookupMs * 1.0e6 / bindingCount, "ns");
+
+    // 解決済みのハンドルへ一括で書き込む（KeyFrameAnimator 等が毎フレーム使う経路）
+    ParameterBindingTable table;
+    size_t handleWritten = 0;
+    const double handleMs = Tests::MeasureBestMilliseconds(5, [&]() {
+        for (size_t frame = 0; frame < kFrameCount; ++frame) {
+            handleWritten += table.ApplyEach(context, bindings, values, nullptr);
+        }
+    });
+    Tests::ReportBenchmark("apply by resolved handles (per binding)", handleMs * 1.0e6 / bindingCount, "ns");
+
+    TEST_CHECK(lookupWritten == handleWritten);
+    TEST_CHECK(target->GetTranslate() == 1.0f && target->GetColor(3) == 0.4f);
+}
@@ -0,0 +1,91 @@
+#include "ColliderFakes.h"
+
+#include <unordered_map>
+#include <utility>
+
+#include "Objects/Collision/Collider.h"
+
+namespace Tests::Fakes {
+
+namespace {
+
+struct OwnerPose {
+    Vector3 position{ 0.0f, 0.0f, 0.0f };
+    Quaternion rotation = Quaternion::Identity();
+};
+
+struct ModelSource {
+    std::uint32_t revision = 0;
+    std::vector<Vector3> vertices;
+    std::vector<std::uint32_t> indices;
+};
+
+std::unordered_map<const KashipanEngine::EmptyObject *, reactphysics3d::RigidBody *> sAttachedBodies;
+std::unordered_map<const KashipanEngine::ICollider *, OwnerPose> sOwnerPoses;
+std::unordered_map<std::uint32_t, ModelSource> sModelSources;
+
+} // namespace
+
+void SetAttachedBody3D(const KashipanEngine::EmptyObject *owner, reactphysics3d::RigidBody *body) {
+    if (body) {
+        sAttachedBodies[owner] = body;
+    } else {
+        sAttachedBodies.erase(owner);
+    }
+}
+
+void SetOwnerPose3D(const KashipanEngine::ICollider *collider, const Vector3 &position, const Quaternion &rotation) {
+    sOwnerPoses[collider] = OwnerPose{ position, rotation };
+}
+
+void SetModelGeometry(std::uint32_t model, std::uint32_t revision, std::vector<Vector3> vertices, std::vector<std::uint32_t> indices) {
+    sModelSources[model] = ModelSource{ revision, std::move(vertices), std::move(indices) };
+}
+
+void ResetColliderFakes() {
+    sAttachedBodies.clear();
+    sOwnerPoses.clear();
+    sModelSources.clear();
+}
+
+} // namespace Tests::Fakes
+
+namespace KashipanEngine {
+
+Collider::RigidBody *Collider::ResolveAttachedBody3D(const ColliderInfo3D &info) const {
+    if (!info.ownerObject) return nullptr;
+    auto it = Tests::Fakes::sAttachedBodies.find(info.ownerObject);
+    if (it == Tests::Fakes::sAttachedBodies.end()) return nullptr;
+    // エンジン側と同じく、三角形メッシュは静的なボディにしか取り付けない
+    if (std::holds_alternative<ColliderInfo3D::ConcaveMeshShape3D>(info.shape) &&
+        it->second->getType() != reactphysics3d::BodyType::STATIC) {
+        return nullptr;
+    }
+    return it->second;
+}
+
+bool Collider::GetSyncedOwnerPose3D(const ColliderInfo3D &info, Vector3 &outPosition, Quaternion &outRotation) const {
+    if (!info.sourceCollider) return false;
+    auto it = Tests::Fakes::sOwnerPoses.find(info.sourceCollider);
+    if (it == Tests::Fakes::sOwnerPoses.end()) {
+        outPosition = Vector3{ 0.0f, 0.0f, 0.0f };
+        outRotation = Quaternion::Identity();
+    } else {
+        outPosition = it->second.position;
+        outRotation = it->second.rotation;
+    }
+    return true;
+}
+
+bool CollisionMeshCache::GetModelGeometry(ModelHandle model, ModelRevision revision, ModelGeometry &outGeometry) {
+    auto it = Tests::Fakes::sModelSources.find(model);
+    if (it == Tests::Fakes::sModelSources.end() || it->second.revision != revision) return false;
+    outGeometry.vertices = it->second.vertices.data();
+    outGeometry.vertexCount = static_cast<std::uint32_t>(it->second.vertices.size());
+    outGeometry.vertexStride = static_cast<std::uint32_t>(sizeof(Vector3));
+    outGeometry.indices = it->second.indices.data();
+    outGeometry.indexCount = static_cast<std::uint32_t>(it->second.indices.size());
+    return true;
+}
+
+} // namespace KashipanEngine
@@ -0,0 +1,34 @@
+#pragma once
+
+// Collider / CollisionMeshCache がエンジン本体を参照する関数（ColliderOwnerBinding.cpp・
+// CollisionMeshCacheModels.cpp で定義されるもの）の、テスト用の差し替え
+//
+// 所属オブジェクト・コライダーのポインタは参照先を読まず、登録時のキーとしてだけ使う。
+// そのため、テストでは適当なアドレス（ダミーの変数のアドレス等）を ownerObject / sourceCollider に設定してよい。
+
+#include <cstdint>
+#include <vector>
+
+#include "Math/Quaternion.h"
+#include "Math/Vector3.h"
+
+#include <reactphysics3d/reactphysics3d.h>
+
+namespace KashipanEngine {
+class EmptyObject;
+class ICollider;
+} // namespace KashipanEngine
+
+namespace Tests::Fakes {
+
+/// @brief 所属オブジェクトに取り付けるRigidBody3Dのボディを設定する（nullptrで取り外す）
+void SetAttachedBody3D(const KashipanEngine::EmptyObject *owner, reactphysics3d::RigidBody *body);
+/// @brief 同期元のコライダーが返す所属オブジェクトの位置・回転を設定する
+void SetOwnerPose3D(const KashipanEngine::ICollider *collider, const Vector3 &position, const Quaternion &rotation);
+/// @brief モデルハンドルに対応する頂点・インデックスを設定する（CollisionMeshCacheの構築元）
+/// @param revision モデルの世代番号（同じハンドルへ設定し直すと、以前の世代での構築要求は失敗する）
+void SetModelGeometry(std::uint32_t model, std::uint32_t revision, std::vector<Vector3> vertices, std::vector<std::uint32_t> indices);
+/// @brief 設定した内容を全て破棄する
+void ResetColliderFakes();
+
+} // namespace Tests::Fakes
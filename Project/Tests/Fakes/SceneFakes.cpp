@@ -0,0 +1,55 @@
+// Transform 等のヘッダーで定義されるコンポーネント・EmptyObject が参照する Scene の関数
+// （Scene.cpp で定義されるもの）の、テスト用の差し替え
+//
+// テストのシーンはオブジェクトの生成（CreateEmptyObject）と、コンポーネントのプール（SceneContext 経由）だけを持つ。
+// 読み込み・保存・更新・エディター・シーンコンポーネントは扱わず、破棄時のバックアップ書き出しも行わない。
+// バッチ処理対象の型のプールは生成しても一括更新の対象へ登録しない（テストではシーンの更新を呼ばない）。
+
+#include "Objects/EmptyObject.h"
+#include "Scene/Scene.h"
+#include "Scene/SceneContext.h"
+
+namespace KashipanEngine {
+
+Scene::Scene(const std::string &sceneName)
+    : name_(sceneName) {
+    sceneContext_ = std::make_unique<SceneContext>(Passkey<Scene>{}, this);
+}
+
+Scene::~Scene() {
+    // コンポーネントはプールへ返してから破棄するため、プールより先にオブジェクトを破棄する
+    for (auto *obj : objects_) {
+        if (obj) obj->FinalizeInterface(Passkey<Scene>());
+    }
+    objectPool_.Clear();
+    objects_.clear();
+    objectsByUUID_.clear();
+    objectsExistingSet_.clear();
+    objectsByName_.clear();
+}
+
+EmptyObject *Scene::CreateEmptyObject(const std::string &name, const UUID128 &objectID, size_t index) {
+    EmptyObject *newObjPtr = objectPool_.Emplace(Passkey<Scene>{}, sceneContext_.get(), name);
+    if (objectID.IsValid()) {
+        newObjPtr->SetObjectID(objectID);
+    }
+    if (index >= objects_.size()) {
+        objects_.push_back(newObjPtr);
+    } else {
+        objects_.insert(objects_.begin() + index, newObjPtr);
+    }
+    objectsByUUID_[newObjPtr->GetObjectID()] = newObjPtr;
+    objectsExistingSet_.insert(newObjPtr);
+    objectsByName_[name].insert(newObjPtr);
+    return newObjPtr;
+}
+
+EmptyObject *Scene::GetSceneObject(const UUID128 &uuid) const {
+    auto it = objectsByUUID_.find(uuid);
+    return it != objectsByUUID_.end() ? it->second : nullptr;
+}
+
+void Scene::RegisterBatchProcessedPool(IComponentPoolBase *) {
+}
+
+} // namespace KashipanEngine
@@ -0,0 +1,109 @@
+// ScriptModuleCache・ScriptContextPool・ParameterBinding が参照する関数の、テスト用の差し替え（Tests/Fakes/ScriptFakes.h）
+//
+// テストではプロジェクトを開かないため、プロジェクトルートを一時フォルダ内の固定の場所とする
+// （バイトコードキャッシュは <一時フォルダ>/KashipanEngineTests/ScriptProject/Cache/ScriptByteCode/ へ書き出される）。
+// テストでは ScriptModuleCache に SceneScriptEngine を、ScriptContextPool にデバッグサーバーを渡さないため、
+// メッセージ収集・ラインコールバックの転送先の関数は呼ばれない。
+
+#include "ScriptFakes.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Core/ProjectPaths.h"
+#include "Objects/ParameterBinding.h"
+#include "Scene/Components/Script/AngelScriptDebugServer.h"
+#include "Scene/Components/Script/SceneScriptEngine.h"
+#include "Utilities/Conversion/ConvertString.h"
+
+namespace KashipanEngine {
+
+namespace {
+
+const std::string &GetTestProjectRoot() {
+    static const std::string root = [] {
+        const std::filesystem::path path = std::filesystem::temp_directory_path() / "KashipanEngineTests" / "ScriptProject";
+        std::filesystem::create_directories(path);
+        return ProjectPaths::NormalizeSeparators(PathToUtf8String(path));
+    }();
+    return root;
+}
+
+/// @brief ScriptComponent として扱うコンポーネント1つ分の状態
+struct FakeScript {
+    std::unordered_map<std::string, float *> floatVariables;
+    std::uint32_t fieldsGeneration = 0;
+};
+
+std::unordered_map<const IObjectComponent *, FakeScript> &GetFakeScripts() {
+    static std::unordered_map<const IObjectComponent *, FakeScript> scripts;
+    return scripts;
+}
+
+} // namespace
+
+std::string ProjectPaths::NormalizeSeparators(std::string path) {
+    std::replace(path.begin(), path.end(), '\\', '/');
+    while (path.size() > 1 && path.back() == '/') path.pop_back();
+    return path;
+}
+
+std::string ProjectPaths::ToPhysical(const std::string &logicalPath) {
+    if (logicalPath.empty()) return logicalPath;
+    const std::string normalized = NormalizeSeparators(logicalPath);
+    if (Utf8StringToPath(normalized).is_absolute()) return normalized;
+    return GetTestProjectRoot() + "/" + normalized;
+}
+
+std::string ProjectPaths::InProjectRoot(const std::string &relativePath) {
+    return GetTestProjectRoot() + "/" + NormalizeSeparators(relativePath);
+}
+
+void SceneScriptEngine::BeginMessageCapture() {
+}
+
+std::vector<std::string> SceneScriptEngine::EndMessageCapture() {
+    return {};
+}
+
+void AngelScriptDebugServer::OnLine(asIScriptContext *) const {
+}
+
+float *FindScriptFloatVariable(IObjectComponent &component, const std::string &name, bool &outIsScript) {
+    auto &scripts = GetFakeScripts();
+    auto it = scripts.find(&component);
+    outIsScript = it != scripts.end();
+    if (!outIsScript) return nullptr;
+    auto variable = it->second.floatVariables.find(name);
+    return variable != it->second.floatVariables.end() ? variable->second : nullptr;
+}
+
+std::uint32_t GetScriptFieldsGeneration(const IObjectComponent &script) {
+    auto &scripts = GetFakeScripts();
+    auto it = scripts.find(&script);
+    return it != scripts.end() ? it->second.fieldsGeneration : 0;
+}
+
+} // namespace KashipanEngine
+
+namespace Tests::Fakes {
+
+void SetFakeScriptFloatVariable(const KashipanEngine::IObjectComponent *component, const std::string &name, float *address) {
+    KashipanEngine::GetFakeScripts()[component].floatVariables[name] = address;
+}
+
+void ReloadFakeScript(const KashipanEngine::IObjectComponent *component) {
+    auto &script = KashipanEngine::GetFakeScripts()[component];
+    script.floatVariables.clear();
+    ++script.fieldsGeneration;
+}
+
+void ResetScriptFakes() {
+    KashipanEngine::GetFakeScripts().clear();
+}
+
+} // namespace Tests::Fakes
@@ -0,0 +1,26 @@
+#pragma once
+
+// ScriptModuleCache・ScriptContextPool・ParameterBinding がスクリプト関連の処理を参照する関数
+// （ProjectPaths.cpp・SceneScriptEngine.cpp・AngelScriptDebugServer.cpp・ScriptComponent.cpp で定義されるもの）の、
+// テスト用の差し替え（定義は ScriptFakes.cpp）
+//
+// ScriptComponent 本体はテストでは使えないため、ParameterBinding のスクリプト変数への適用は、
+// SetFakeScriptFloatVariable で登録したコンポーネントを ScriptComponent として扱って確かめる。
+// コンポーネントのポインタは参照先を読まず、登録時のキーとしてだけ使う。
+
+#include <string>
+
+namespace KashipanEngine {
+class IObjectComponent;
+} // namespace KashipanEngine
+
+namespace Tests::Fakes {
+
+/// @brief component を ScriptComponent として扱い、float型の [SerializeField] 変数 name の格納先を設定する
+void SetFakeScriptFloatVariable(const KashipanEngine::IObjectComponent *component, const std::string &name, float *address);
+/// @brief component のスクリプトをリロードしたことにする（変数一覧の世代を進め、設定した変数を全て外す）
+void ReloadFakeScript(const KashipanEngine::IObjectComponent *component);
+/// @brief 設定した内容を全て破棄する
+void ResetScriptFakes();
+
+} // namespace Tests::Fakes
@@ -0,0 +1,265 @@
+// JobSystem のテストとベンチマーク
+//
+// ベンチマークは投入（spawn）・盗み（steal）・待機（wait）それぞれの1ジョブあたりのコストを測る。
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "TestFramework.h"
+#include "Utilities/Plugin/Thread/JobSystem.h"
+
+using Plugin::JobCounter;
+using Plugin::JobPriority;
+using Plugin::JobSystem;
+
+namespace {
+
+/// @brief ワーカーを塞いでおくためのジョブを投入し、ワーカーが実行を始めるまで待つ
+/// @param release trueにするとジョブが終わる
+void BlockWorker(JobSystem &jobSystem, std::atomic<bool> &release) {
+    std::atomic<bool> started = false;
+    jobSystem.Schedule([&started, &release]() {
+        started = true;
+        while (!release.load()) std::this_thread::yield();
+    });
+    while (!started.load()) std::this_thread::yield();
+}
+
+/// @brief ベンチマークで使うワーカー数（最低2つ。盗みが起こるようにするため）
+size_t GetBenchmarkWorkerCount() {
+    return std::max<size_t>(2, JobSystem::GetDefaultWorkerCount());
+}
+
+} // namespace
+
+TEST_CASE(JobSystem_WaitRunsScheduledJobs) {
+    JobSystem jobSystem(2);
+    std::atomic<int> sum = 0;
+    JobCounter counter;
+    for (int i = 1; i <= 100; ++i) {
+        jobSystem.Schedule([&sum, i]() { sum += i; }, JobPriority::Normal, &counter);
+    }
+    jobSystem.Wait(counter);
+    TEST_CHECK(sum.load() == 5050);
+}
+
+TEST_CASE(JobSystem_DependencyRunsAfterCounter) {
+    JobSystem jobSystem(2);
+    std::atomic<int> finishedCount = 0;
+    std::atomic<bool> isOrdered = true;
+    JobCounter first;
+    JobCounter second;
+    for (int i = 0; i < 16; ++i) {
+        jobSystem.Schedule([&finishedCount]() { ++finishedCount; }, JobPriority::Normal, &first);
+    }
+    jobSystem.Schedule([&finishedCount, &isOrdered]() {
+        if (finishedCount.load() != 16) isOrdered = false;
+    }, JobPriority::Normal, &second, &first);
+    jobSystem.Wait(second);
+    TEST_CHECK(isOrdered.load());
+}
+
+TEST_CASE(JobSystem_ParallelForCoversRange) {
+    JobSystem jobSystem(2);
+    std::vector<int> visited(1000, 0);
+    jobSystem.ParallelFor(visited.size(), 7, [&visited](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) ++visited[i];
+    });
+    TEST_CHECK(std::all_of(visited.begin(), visited.end(), [](int v) { return v == 1; }));
+}
+
+TEST_CASE(JobSystem_WaitSkipsUnrelatedLowJobs) {
+    // 待っているジョブがワーカーで実行中の間も、無関係な低優先度のジョブを待機側のスレッドで拾わないことを確かめる
+    JobSystem jobSystem(1);
+    std::atomic<bool> started = false;
+    JobCounter counter;
+    jobSystem.Schedule([&started]() {
+        started = true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }, JobPriority::Normal, &counter);
+    while (!started.load()) std::this_thread::yield();
+
+    const std::thread::id waiter = std::this_thread::get_id();
+    std::atomic<bool> lowJobRan = false;
+    std::atomic<bool> lowJobRanOnWaiter = false;
+    jobSystem.Schedule([&lowJobRan, &lowJobRanOnWaiter, waiter]() {
+        if (std::this_thread::get_id() == waiter) lowJobRanOnWaiter = true;
+        lowJobRan = true;
+    }, JobPriority::Low);
+
+    jobSystem.Wait(counter);
+    TEST_CHECK(!lowJobRanOnWaiter.load());
+
+    // 手の空いたワーカーは低優先度のジョブも実行する
+    while (!lowJobRan.load()) std::this_thread::yield();
+    TEST_CHECK(!lowJobRanOnWaiter.load());
+}
+
+TEST_CASE(JobSystem_WaitRunsOwnLowJobs) {
+    // 待っているカウンタへ完了を通知する低優先度のジョブは、ワーカーが塞がっていてもWait中に実行される
+    JobSystem jobSystem(1);
+    std::atomic<bool> release = false;
+    BlockWorker(jobSystem, release);
+
+    std::atomic<int> lowJobCount = 0;
+    JobCounter counter;
+    for (int i = 0; i < 4; ++i) {
+        jobSystem.Schedule([&lowJobCount]() { ++lowJobCount; }, JobPriority::Low, &counter);
+    }
+    jobSystem.Wait(counter);
+    TEST_CHECK(lowJobCount.load() == 4);
+    release = true;
+}
+
+TEST_CASE(JobSystem_LowParallelForInsideJobCompletes) {
+    // 低優先度のジョブの中から低優先度のParallelForを呼んでも、分割したジョブは待機側で実行できる
+    JobSystem jobSystem(1);
+    std::atomic<int> sum = 0;
+    JobCounter counter;
+    jobSystem.Schedule([&jobSystem, &sum]() {
+        jobSystem.ParallelFor(64, 1, [&sum](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) sum += static_cast<int>(i);
+        }, JobPriority::Low);
+    }, JobPriority::Low, &counter);
+    jobSystem.Wait(counter);
+    TEST_CHECK(sum.load() == 64 * 63 / 2);
+}
+
+TEST_CASE(JobSystem_WaitRethrowsJobException) {
+    // 例外を投げたジョブも完了として数えられ、Waitは全ジョブの完了後に例外を再送出する
+    JobSystem jobSystem(2);
+    std::atomic<int> finishedCount = 0;
+    JobCounter counter;
+    for (int i = 0; i < 32; ++i) {
+        jobSystem.Schedule([&finishedCount, i]() {
+            if (i % 8 == 3) throw std::runtime_error("job failed");
+            ++finishedCount;
+        }, JobPriority::Normal, &counter);
+    }
+    bool isThrown = false;
+    try {
+        jobSystem.Wait(counter);
+    } catch (const std::runtime_error &) {
+        isThrown = true;
+    }
+    TEST_CHECK(isThrown);
+    TEST_CHECK(counter.IsDone());
+    TEST_CHECK(finishedCount.load() == 28);
+
+    // 再送出した例外はカウンタから取り除かれ、再利用したカウンタのWaitでは投げない
+    jobSystem.Schedule([&finishedCount]() { ++finishedCount; }, JobPriority::Normal, &counter);
+    jobSystem.Wait(counter);
+    TEST_CHECK(finishedCount.load() == 29);
+}
+
+TEST_CASE(JobSystem_ParallelForRethrowsAfterAllChunks) {
+    // 先頭（呼び出し元スレッド）・途中の範囲のどちらが投げても、全範囲が終わってから例外が届く
+    JobSystem jobSystem(2);
+    for (const size_t failingChunk : { size_t(0), size_t(5) }) {
+        std::atomic<int> finishedChunks = 0;
+        bool isThrown = false;
+        try {
+            jobSystem.ParallelFor(16 * 4, 4, [&finishedChunks, failingChunk](size_t begin, size_t) {
+                if (begin / 4 == failingChunk) throw std::runtime_error("chunk failed");
+                std::this_thread::sleep_for(std::chrono::microseconds(200));
+                ++finishedChunks;
+            });
+        } catch (const std::runtime_error &) {
+            isThrown = true;
+        }
+        TEST_CHECK(isThrown);
+        TEST_CHECK(finishedChunks.load() == 15);
+    }
+}
+
+TEST_CASE(JobSystem_UnhandledExceptionKeepsWorkerAlive) {
+    // 完了通知先の無いジョブの例外はonUnhandledExceptionへ渡り、ワーカーはその後もジョブを実行する
+    std::atomic<int> reportedCount = 0;
+    JobSystem jobSystem(1, {}, {}, [&reportedCount](std::exception_ptr exception) {
+        if (exception) ++reportedCount;
+    });
+    jobSystem.Schedule([]() { throw std::runtime_error("fire and forget"); });
+
+    std::atomic<bool> isRun = false;
+    JobCounter counter;
+    jobSystem.Schedule([&isRun]() { isRun = true; }, JobPriority::Normal, &counter);
+    jobSystem.Wait(counter);
+    while (reportedCount.load() == 0) std::this_thread::yield();
+    TEST_CHECK(isRun.load());
+    TEST_CHECK(reportedCount.load() == 1);
+}
+
+BENCHMARK_CASE(JobSystem_SpawnLatency) {
+    // メインスレッドから空のジョブを投入し切るまでの、1ジョブあたりの時間
+    constexpr size_t kJobCount = 100000;
+    JobSystem jobSystem(GetBenchmarkWorkerCount());
+    double bestMs = -1.0;
+    for (int repeat = 0; repeat < 5; ++repeat) {
+        JobCounter counter;
+        const double ms = Tests::MeasureMilliseconds([&]() {
+            for (size_t i = 0; i < kJobCount; ++i) {
+                jobSystem.Schedule([]() {}, JobPriority::Normal, &counter);
+            }
+        });
+        jobSystem.Wait(counter);
+        if (bestMs < 0.0 || ms < bestMs) bestMs = ms;
+    }
+    Tests::ReportBenchmark("spawn (main thread, per job)", bestMs * 1.0e6 / kJobCount, "ns");
+}
+
+BENCHMARK_CASE(JobSystem_StealLatency) {
+    // ワーカー上で自身のキューへ投入したジョブを、他のワーカーが盗んで実行し終えるまでの1ジョブあたりの時間
+    constexpr size_t kJobCount = 100000;
+    JobSystem jobSystem(GetBenchmarkWorkerCount());
+    std::atomic<size_t> stolenCount = 0;
+    double bestMs = -1.0;
+    for (int repeat = 0; repeat < 5; ++repeat) {
+        JobCounter outer;
+        std::atomic<double> elapsedMs = 0.0;
+        jobSystem.Schedule([&]() {
+            const std::thread::id owner = std::this_thread::get_id();
+            JobCounter inner;
+            elapsedMs = Tests::MeasureMilliseconds([&]() {
+                for (size_t i = 0; i < kJobCount; ++i) {
+                    jobSystem.Schedule([&stolenCount, owner]() {
+                        if (std::this_thread::get_id() != owner) ++stolenCount;
+                    }, JobPriority::Normal, &inner);
+                }
+                jobSystem.Wait(inner);
+            });
+        }, JobPriority::Normal, &outer);
+        jobSystem.Wait(outer);
+        if (bestMs < 0.0 || elapsedMs.load() < bestMs) bestMs = elapsedMs.load();
+    }
+    Tests::ReportBenchmark("spawn + steal + run (worker, per job)", bestMs * 1.0e6 / kJobCount, "ns");
+    Tests::ReportBenchmark("stolen ratio", 100.0 * static_cast<double>(stolenCount.load()) / (5.0 * kJobCount), "%");
+}
+
+BENCHMARK_CASE(JobSystem_WaitLatency) {
+    // 1つのジョブを投入してからWaitが戻るまでの往復時間（ワーカーが寝ている状態からの起床を含む）
+    constexpr size_t kRoundTripCount = 10000;
+    JobSystem jobSystem(GetBenchmarkWorkerCount());
+    const double ms = Tests::MeasureBestMilliseconds(5, [&]() {
+        for (size_t i = 0; i < kRoundTripCount; ++i) {
+            JobCounter counter;
+            jobSystem.Schedule([]() {}, JobPriority::Normal, &counter);
+            jobSystem.Wait(counter);
+        }
+    });
+    Tests::ReportBenchmark("schedule + wait round trip", ms * 1.0e6 / kRoundTripCount, "ns");
+
+    // 細かいParallelFor（フレーム処理でよく使う形）1回あたりの時間
+    constexpr size_t kParallelForCount = 10000;
+    std::atomic<size_t> sink = 0;
+    const double parallelMs = Tests::MeasureBestMilliseconds(5, [&]() {
+        for (size_t i = 0; i < kParallelForCount; ++i) {
+            jobSystem.ParallelFor(64, 8, [&sink](size_t begin, size_t end) { sink += end - begin; });
+        }
+    });
+    Tests::ReportBenchmark("ParallelFor(64, grain 8)", parallelMs * 1.0e6 / kParallelForCount, "ns");
+}
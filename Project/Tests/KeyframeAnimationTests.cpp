@@ -0,0 +1,139 @@
+// キーフレーム評価の精度テスト
+//
+// カーソルを使った評価（KeyframeAnimation::Evaluate(time, cursor)）がカーソル無しの評価と完全に一致すること、
+// 焼き込み表のイージング（ApplyBaked）が Apply との差を GetBakedEaseMaxError 以内に保つことを確かめる。
+
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "TestFramework.h"
+#include "Utilities/KeyframeAnimation.h"
+#include "Utilities/Plugin/Plugins.h"
+
+using KashipanEngine::KeyframeAnimation;
+
+namespace {
+
+constexpr size_t kEaseTypeCount = static_cast<size_t>(EaseType::EaseOutInBounce) + 1;
+/// @brief 焼き込み表で近似する誤差の上限（Easings.cpp の kBakedEaseTolerance と同じ値）
+constexpr float kBakedEaseTolerance = 0.001f;
+
+/// @brief 不等間隔の時刻・全種類のイージングを持つキーフレームアニメーションを作る
+KeyframeAnimation MakeAnimation(std::mt19937 &random, size_t keyCount) {
+    std::uniform_real_distribution<float> step(0.01f, 0.5f);
+    std::uniform_real_distribution<float> value(-10.0f, 10.0f);
+    KeyframeAnimation animation;
+    float time = 0.0f;
+    for (size_t i = 0; i < keyCount; ++i) {
+        animation.AddKeyframe(time, value(random), static_cast<EaseType>(i % kEaseTypeCount));
+        time += step(random);
+    }
+    return animation;
+}
+
+/// @brief float の値がビット単位で一致するか（NaN 同士も一致扱い）
+bool IsSameFloat(float a, float b) {
+    return std::memcmp(&a, &b, sizeof(float)) == 0;
+}
+
+} // namespace
+
+TEST_CASE(KeyframeAnimation_CursorMatchesExactEvaluation) {
+    std::mt19937 random(12345);
+    const KeyframeAnimation animation = MakeAnimation(random, 200);
+    const float duration = animation.GetDuration();
+
+    // 前方再生（小さい刻み・数キーを飛ばす刻み）、巻き戻し、ランダムなシークを同じカーソルで続けて評価する
+    std::vector<float> times;
+    for (float t = -0.5f; t <= duration + 0.5f; t += 1.0f / 60.0f) times.push_back(t);
+    for (float t = 0.0f; t <= duration; t += 0.37f) times.push_back(t);
+    for (float t = duration; t >= 0.0f; t -= 0.13f) times.push_back(t);
+    std::uniform_real_distribution<float> seek(-1.0f, duration + 1.0f);
+    for (int i = 0; i < 2000; ++i) times.push_back(seek(random));
+    // キーの時刻ちょうど
+    for (const auto &key : animation.GetKeyframes()) times.push_back(key.time);
+
+    KeyframeAnimation::Cursor cursor;
+    size_t mismatchCount = 0;
+    for (const float time : times) {
+        if (!IsSameFloat(animation.Evaluate(time, cursor), animation.Evaluate(time))) ++mismatchCount;
+    }
+    TEST_CHECK_MESSAGE(mismatchCount == 0, std::to_string(mismatchCount) + " / " + std::to_string(times.size()) + " samples differ");
+}
+
+TEST_CASE(KeyframeAnimation_BatchMatchesExactEvaluation) {
+    // 並列に評価される件数でも、1件ずつ評価した結果と一致する
+    Plugin::JobSystem jobSystem(2);
+    const Tests::ScopedJobSystem scopedJobSystem(&jobSystem);
+
+    std::mt19937 random(678);
+    std::vector<KeyframeAnimation> animations;
+    for (int i = 0; i < 16; ++i) animations.push_back(MakeAnimation(random, 32));
+
+    constexpr size_t kSampleCount = 8192;
+    std::vector<KeyframeAnimation::Cursor> cursors(kSampleCount);
+    std::vector<KeyframeAnimation::BatchSample> samples(kSampleCount);
+    std::vector<float> values(kSampleCount);
+    size_t mismatchCount = 0;
+    for (int frame = 0; frame < 30; ++frame) {
+        for (size_t i = 0; i < kSampleCount; ++i) {
+            const KeyframeAnimation &animation = animations[i % animations.size()];
+            samples[i].animation = &animation;
+            samples[i].time = static_cast<float>(frame) * 0.2f + static_cast<float>(i % 7) * 0.01f;
+            // 半分はカーソル無し（毎回二分探索）
+            samples[i].cursor = (i % 2 == 0) ? &cursors[i] : nullptr;
+        }
+        KeyframeAnimation::EvaluateBatch(samples, values);
+        for (size_t i = 0; i < kSampleCount; ++i) {
+            if (!IsSameFloat(values[i], samples[i].animation->Evaluate(samples[i].time))) ++mismatchCount;
+        }
+    }
+    TEST_CHECK_MESSAGE(mismatchCount == 0, std::to_string(mismatchCount) + " samples differ");
+}
+
+TEST_CASE(Easings_BakedMatchesApply) {
+    // 表の作成時とは異なる点（区間の途中の半端な位置・t == 0 のすぐ後）でも、Apply との差が記録された最大誤差を超えない
+    constexpr int kSampleCount = 100003;
+    for (size_t typeIndex = 0; typeIndex < kEaseTypeCount; ++typeIndex) {
+        const auto type = static_cast<EaseType>(typeIndex);
+        const float recordedError = GetBakedEaseMaxError(type);
+        TEST_CHECK_MESSAGE(recordedError <= kBakedEaseTolerance, EaseTypeToString(type));
+
+        float maxError = 0.0f;
+        for (int i = 0; i <= kSampleCount; ++i) {
+            const float t = static_cast<float>(i) / static_cast<float>(kSampleCount);
+            maxError = std::max(maxError, std::abs(ApplyBaked(t, type) - Apply(t, type)));
+        }
+        for (const float t : { 1.0e-7f, 1.0f - 1.0e-7f }) {
+            maxError = std::max(maxError, std::abs(ApplyBaked(t, type) - Apply(t, type)));
+        }
+        // 記録値を測った点とは補間の丸め方が異なるため、float の丸め誤差分だけ許す
+        TEST_CHECK_MESSAGE(maxError <= recordedError + 1.0e-6f,
+            std::string(EaseTypeToString(type)) + " measured=" + std::to_string(maxError) + " recorded=" + std::to_string(recordedError));
+        // 表を持たない種類は Apply と同じ計算になる
+        if (recordedError == 0.0f) TEST_CHECK_MESSAGE(maxError == 0.0f, EaseTypeToString(type));
+    }
+}
+
+TEST_CASE(KeyframeAnimation_BakedEasingWithinRecordedError) {
+    // 焼き込み表で評価した値と正確な値の差は、区間の値の幅 × そのイージングの最大誤差 以内に収まる
+    std::mt19937 random(9);
+    KeyframeAnimation exact = MakeAnimation(random, 2 * kEaseTypeCount + 1);
+    KeyframeAnimation baked = exact;
+    baked.SetUseBakedEasing(true);
+
+    const auto &keys = exact.GetKeyframes();
+    size_t violationCount = 0;
+    for (size_t k = 0; k + 1 < keys.size(); ++k) {
+        const float span = keys[k + 1].time - keys[k].time;
+        const float bound = std::abs(keys[k + 1].value - keys[k].value) * GetBakedEaseMaxError(keys[k].easeType) + 1.0e-5f;
+        for (int i = 0; i < 500; ++i) {
+            const float time = keys[k].time + span * (static_cast<float>(i) + 0.5f) / 500.0f;
+            if (std::abs(baked.Evaluate(time) - exact.Evaluate(time)) > bound) ++violationCount;
+        }
+    }
+    TEST_CHECK_MESSAGE(violationCount == 0, std::to_string(violationCount) + " samples exceed the bound");
+}
@@ -0,0 +1,109 @@
+// 置き換え前の Collider::Update2D の候補ペアの列挙（ベンチマークの比較用）
+//
+// 本体は置き換え前の Objects/Collision/Collider.cpp の BuildCandidatePairs2D と同じ。
+// コライダーの配列の代わりに、形状から求めたAABBの配列を受け取る点だけが異なる。
+
+#include "LegacyGridBroadphase2D.h"
+
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace Tests::Legacy {
+
+namespace {
+
+struct IndexPair {
+    std::size_t a = 0;
+    std::size_t b = 0;
+
+    bool operator==(const IndexPair &o) const noexcept {
+        return a == o.a && b == o.b;
+    }
+};
+
+struct IndexPairHash {
+    std::size_t operator()(const IndexPair &p) const noexcept {
+        std::size_t h1 = std::hash<std::size_t>{}(p.a);
+        std::size_t h2 = std::hash<std::size_t>{}(p.b);
+        return h1 ^ (h2 + 0x9e3779b9u + (h1 << 6) + (h1 >> 2));
+    }
+};
+
+inline IndexPair MakeIndexPair(std::size_t a, std::size_t b) {
+    if (a > b) std::swap(a, b);
+    return IndexPair{a, b};
+}
+
+inline int ToCell(float v, float cellSize) {
+    return static_cast<int>(std::floor(v / cellSize));
+}
+
+} // namespace
+
+std::vector<std::pair<std::size_t, std::size_t>> BuildCandidatePairs2D(const std::vector<std::optional<KashipanEngine::Aabb2D>> &bounds) {
+    constexpr float kCellSize = 10.0f;
+    constexpr int kMaxCellsPerShape = 256;
+
+    std::unordered_map<std::uint64_t, std::vector<std::size_t>> grid;
+    std::vector<std::size_t> active;
+    std::vector<std::size_t> global;
+
+    active.reserve(bounds.size());
+    global.reserve(bounds.size());
+
+    for (std::size_t i = 0; i < bounds.size(); ++i) {
+        active.push_back(i);
+
+        if (!bounds[i].has_value()) {
+            global.push_back(i);
+            continue;
+        }
+
+        const int minX = ToCell(bounds[i]->minX, kCellSize);
+        const int minY = ToCell(bounds[i]->minY, kCellSize);
+        const int maxX = ToCell(bounds[i]->maxX, kCellSize);
+        const int maxY = ToCell(bounds[i]->maxY, kCellSize);
+
+        const int cellsX = (maxX - minX + 1);
+        const int cellsY = (maxY - minY + 1);
+        if (cellsX <= 0 || cellsY <= 0 || cellsX > kMaxCellsPerShape || cellsY > kMaxCellsPerShape || (cellsX * cellsY) > kMaxCellsPerShape) {
+            global.push_back(i);
+            continue;
+        }
+
+        for (int y = minY; y <= maxY; ++y) {
+            for (int x = minX; x <= maxX; ++x) {
+                const std::uint64_t key = (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32)
+                                        | static_cast<std::uint32_t>(y);
+                grid[key].push_back(i);
+            }
+        }
+    }
+
+    std::unordered_set<IndexPair, IndexPairHash> uniquePairs;
+
+    for (const auto &[_, indices] : grid) {
+        for (std::size_t i = 0; i < indices.size(); ++i) {
+            for (std::size_t j = i + 1; j < indices.size(); ++j) {
+                uniquePairs.insert(MakeIndexPair(indices[i], indices[j]));
+            }
+        }
+    }
+
+    for (std::size_t gi = 0; gi < global.size(); ++gi) {
+        const std::size_t g = global[gi];
+        for (std::size_t a : active) {
+            if (a == g) continue;
+            uniquePairs.insert(MakeIndexPair(g, a));
+        }
+    }
+
+    std::vector<std::pair<std::size_t, std::size_t>> out;
+    out.reserve(uniquePairs.size());
+    for (const auto &p : uniquePairs) out.emplace_back(p.a, p.b);
+    return out;
+}
+
+} // namespace Tests::Legacy
@@ -0,0 +1,19 @@
+#pragma once
+#include <cstddef>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "Objects/Collision/Broadphase2D.h"
+
+namespace Tests::Legacy {
+
+/// @brief 永続的なブロードフェーズ（Broadphase2D）へ置き換える前の、Collider::Update2D の候補ペアの列挙
+/// @details ベンチマークで新しい実装と比べるためだけに残している。毎フレーム一様グリッドを作り直し、
+///          同じセルに入ったコライダーの組を候補とする。AABBを求められない形状やセルをまたぎすぎる形状は
+///          全コライダーとの組を候補にする。Collider から切り離すため、入力はコライダーごとのAABBにしている
+/// @param bounds コライダーごとのAABB（無効なコライダーは含めない。AABBを求められない形状はnullopt）
+/// @return 候補ペア（bounds内のインデックスの組。順序は不定）
+std::vector<std::pair<std::size_t, std::size_t>> BuildCandidatePairs2D(const std::vector<std::optional<KashipanEngine::Aabb2D>> &bounds);
+
+} // namespace Tests::Legacy
@@ -0,0 +1,242 @@
+// 置き換え前の、1パーティクルにつき EmptyObject を1つ使うCPUパーティクルの更新（ベンチマークの比較用）
+//
+// 寿命管理は置き換え前の ParticleSystemBase::UpdateParticles / SpawnParticle と同じ。
+// コンポーネントの更新は Velocity・Rotation、ワールド行列は Transform と同じ式で求める。
+// シーンの代わりに ObjectParticlePool が全オブジェクトを順に更新する点だけが異なる。
+
+#include "LegacyObjectParticles.h"
+
+#include <algorithm>
+#include <cstdint>
+
+#include "Math/Quaternion.h"
+#include "Utilities/MathUtils/Matrix4x4.h"
+
+namespace Tests::Legacy {
+
+namespace {
+
+/// @brief IObjectComponent の代わり（オブジェクトごとにヒープへ確保し、仮想関数で更新する）
+class Component {
+public:
+    explicit Component(std::size_t typeID) : typeID_(typeID) {}
+    virtual ~Component() = default;
+    virtual void Update(ParticleObject &owner, float deltaTime) = 0;
+    std::size_t GetTypeID() const noexcept { return typeID_; }
+
+private:
+    std::size_t typeID_;
+};
+
+enum ComponentTypeID : std::size_t {
+    kTransformTypeID,
+    kVelocityTypeID,
+    kRotationTypeID,
+    kRendererTypeID,
+    kComponentTypeCount,
+};
+
+} // namespace
+
+/// @brief EmptyObject の代わり（型IDごとのインデックス表からコンポーネントを引く）
+class ParticleObject final {
+public:
+    template<typename T>
+    T *AddComponent() {
+        auto component = std::make_unique<T>();
+        T *result = component.get();
+        componentsIndexByType_[result->GetTypeID()].push_back(components_.size());
+        components_.push_back(std::move(component));
+        return result;
+    }
+
+    template<typename T>
+    T *GetComponent() const {
+        for (const std::size_t index : componentsIndexByType_[T::kTypeID]) {
+            if (index < components_.size()) return static_cast<T *>(components_[index].get());
+        }
+        return nullptr;
+    }
+
+    void Update(float deltaTime) {
+        if (!isActive_) return;
+        for (auto &component : components_) component->Update(*this, deltaTime);
+    }
+
+    bool IsActive() const noexcept { return isActive_; }
+    void SetActive(bool isActive) noexcept { isActive_ = isActive; }
+
+private:
+    std::vector<std::unique_ptr<Component>> components_;
+    std::vector<std::size_t> componentsIndexByType_[kComponentTypeCount];
+    bool isActive_ = false;
+};
+
+namespace {
+
+class LegacyTransform final : public Component {
+public:
+    static constexpr std::size_t kTypeID = kTransformTypeID;
+    LegacyTransform() : Component(kTypeID) {}
+    void Update(ParticleObject &, float) override {}
+
+    const Vector3 &GetTranslate() const noexcept { return translate_; }
+    const Vector3 &GetRotate() const noexcept { return rotate_; }
+    void SetTranslate(const Vector3 &translate) {
+        if (translate_ == translate) return;
+        translate_ = translate;
+        isWorldMatrixDirty_ = true;
+    }
+    void SetRotate(const Vector3 &rotate) {
+        if (rotate_ == rotate) return;
+        rotate_ = rotate;
+        rotateQuat_ = Quaternion::MakeRotateEuler(rotate);
+        isWorldMatrixDirty_ = true;
+    }
+    void SetScale(const Vector3 &scale) {
+        if (scale_ == scale) return;
+        scale_ = scale;
+        isWorldMatrixDirty_ = true;
+    }
+    const Matrix4x4 &GetWorldMatrix() {
+        if (isWorldMatrixDirty_) {
+            worldMatrix_ = KashipanEngine::MathUtils::Matrix4x4ComposeTRS(scale_, rotateQuat_, translate_);
+            isWorldMatrixDirty_ = false;
+        }
+        return worldMatrix_;
+    }
+
+private:
+    Vector3 translate_{ 0.0f, 0.0f, 0.0f };
+    Vector3 rotate_{ 0.0f, 0.0f, 0.0f };
+    Quaternion rotateQuat_ = Quaternion::Identity();
+    Vector3 scale_{ 1.0f, 1.0f, 1.0f };
+    Matrix4x4 worldMatrix_ = Matrix4x4::Identity();
+    bool isWorldMatrixDirty_ = true;
+};
+
+class LegacyVelocity final : public Component {
+public:
+    static constexpr std::size_t kTypeID = kVelocityTypeID;
+    LegacyVelocity() : Component(kTypeID) {}
+    void Update(ParticleObject &owner, float deltaTime) override {
+        auto *transform = owner.GetComponent<LegacyTransform>();
+        if (!transform) return;
+        velocity = velocity + acceleration * deltaTime;
+        transform->SetTranslate(transform->GetTranslate() + velocity * deltaTime);
+    }
+
+    Vector3 velocity{ 0.0f, 0.0f, 0.0f };
+    Vector3 acceleration{ 0.0f, 0.0f, 0.0f };
+};
+
+class LegacyRotation final : public Component {
+public:
+    static constexpr std::size_t kTypeID = kRotationTypeID;
+    LegacyRotation() : Component(kTypeID) {}
+    void Update(ParticleObject &owner, float deltaTime) override {
+        auto *transform = owner.GetComponent<LegacyTransform>();
+        if (!transform) return;
+        angularVelocity = angularVelocity + angularAcceleration * deltaTime;
+        transform->SetRotate(transform->GetRotate() + angularVelocity * deltaTime);
+    }
+
+    Vector3 angularVelocity{ 0.0f, 0.0f, 0.0f };
+    Vector3 angularAcceleration{ 0.0f, 0.0f, 0.0f };
+};
+
+/// @brief 描画コンポーネントの代わり（描画時に Transform からワールド行列を取り出すだけ）
+class LegacyRenderer final : public Component {
+public:
+    static constexpr std::size_t kTypeID = kRendererTypeID;
+    LegacyRenderer() : Component(kTypeID) {}
+    void Update(ParticleObject &, float) override {}
+
+    Matrix4x4 GetInstanceMatrix(ParticleObject &owner) const {
+        auto *transform = owner.GetComponent<LegacyTransform>();
+        return transform ? transform->GetWorldMatrix() : Matrix4x4::Identity();
+    }
+};
+
+} // namespace
+
+ObjectParticlePool::ObjectParticlePool(std::size_t capacity) {
+    pool_.reserve(capacity);
+    slots_.resize(capacity);
+    freeIndices_.reserve(capacity);
+    for (std::size_t i = 0; i < capacity; ++i) {
+        auto object = std::make_unique<ParticleObject>();
+        object->AddComponent<LegacyTransform>();
+        object->AddComponent<LegacyRenderer>();
+        object->AddComponent<LegacyVelocity>();
+        object->AddComponent<LegacyRotation>();
+        pool_.push_back(std::move(object));
+    }
+    for (std::size_t i = capacity; i > 0; --i) freeIndices_.push_back(static_cast<int>(i - 1));
+}
+
+ObjectParticlePool::~ObjectParticlePool() = default;
+
+bool ObjectParticlePool::Spawn(const KashipanEngine::ParticleSimulation::SpawnParams &params) {
+    if (freeIndices_.empty()) return false;
+    const int slotIndex = freeIndices_.back();
+    freeIndices_.pop_back();
+    auto *particleObj = pool_[slotIndex].get();
+
+    if (auto *transform = particleObj->GetComponent<LegacyTransform>()) {
+        transform->SetScale(params.startScale);
+        transform->SetTranslate(params.position);
+        transform->SetRotate(params.rotation);
+    }
+    particleObj->SetActive(true);
+    if (auto *velocity = particleObj->GetComponent<LegacyVelocity>()) {
+        velocity->velocity = params.velocity;
+        velocity->acceleration = params.acceleration;
+    }
+    if (auto *rotation = particleObj->GetComponent<LegacyRotation>()) {
+        rotation->angularVelocity = params.angularVelocity;
+        rotation->angularAcceleration = params.angularAcceleration;
+    }
+
+    slots_[slotIndex].active = true;
+    slots_[slotIndex].age = 0.0f;
+    slots_[slotIndex].lifetime = std::max(0.01f, params.lifetime);
+    slots_[slotIndex].startScale = params.startScale;
+    slots_[slotIndex].endScale = params.endScale;
+    ++aliveCount_;
+    return true;
+}
+
+void ObjectParticlePool::Update(float deltaTime) {
+    // シーンの更新（全オブジェクトのコンポーネント）
+    for (auto &object : pool_) object->Update(deltaTime);
+
+    // ParticleSystemBase::UpdateParticles の寿命管理・スケール変化
+    for (std::size_t i = 0; i < slots_.size(); ++i) {
+        if (!slots_[i].active) continue;
+        auto *particleObject = pool_[i].get();
+        slots_[i].age += deltaTime;
+        if (slots_[i].age >= slots_[i].lifetime) {
+            particleObject->SetActive(false);
+            slots_[i].active = false;
+            freeIndices_.push_back(static_cast<int>(i));
+            --aliveCount_;
+            continue;
+        }
+        if (auto *transform = particleObject->GetComponent<LegacyTransform>()) {
+            const float t = slots_[i].lifetime > 0.0f ? slots_[i].age / slots_[i].lifetime : 1.0f;
+            transform->SetScale(Vector3::Lerp(slots_[i].startScale, slots_[i].endScale, t));
+        }
+    }
+}
+
+std::size_t ObjectParticlePool::WriteInstanceMatrices(Matrix4x4 *out) const {
+    std::size_t count = 0;
+    for (const auto &object : pool_) {
+        if (!object->IsActive()) continue;
+        if (auto *renderer = object->GetComponent<LegacyRenderer>()) out[count++] = renderer->GetInstanceMatrix(*object);
+    }
+    return count;
+}
+
+} // namespace Tests::Legacy
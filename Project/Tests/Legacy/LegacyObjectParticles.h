@@ -0,0 +1,49 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "Math/Matrix4x4.h"
+#include "Objects/ParticleSimulation.h"
+
+namespace Tests::Legacy {
+
+class ParticleObject;
+
+/// @brief ParticleSimulation へ置き換える前の、1パーティクルにつき EmptyObject を1つ使うCPUパーティクルの更新
+/// @details ベンチマークで新しい実装と比べるためだけに残している。シーンから切り離すため、EmptyObject と
+///          Transform・Velocity・Rotation・描画コンポーネントを必要な部分だけ写し取っている。
+///          オブジェクトとコンポーネントはそれぞれヒープに確保し、毎フレーム全オブジェクトのコンポーネントを
+///          型から引き直して更新する。寿命管理とスケール変化は置き換え前の ParticleSystemBase::UpdateParticles と同じ
+class ObjectParticlePool final {
+public:
+    /// @brief capacity 個のパーティクルオブジェクトを事前に生成する（置き換え前の EnsurePoolSize）
+    explicit ObjectParticlePool(std::size_t capacity);
+    ~ObjectParticlePool();
+
+    /// @brief 空きオブジェクトを1つ有効にする（置き換え前の SpawnParticle）
+    /// @return 空きが無く追加できなかった場合は false
+    bool Spawn(const KashipanEngine::ParticleSimulation::SpawnParams &params);
+    /// @brief 全オブジェクトのコンポーネントを更新し、寿命を迎えたものを無効にする
+    void Update(float deltaTime);
+    /// @brief 有効なオブジェクトのワールド行列を、描画コンポーネント経由で out へ書き出す
+    /// @return 書き出した数
+    std::size_t WriteInstanceMatrices(Matrix4x4 *out) const;
+
+    std::size_t GetAliveCount() const noexcept { return aliveCount_; }
+
+private:
+    struct ParticleSlot {
+        bool active = false;
+        float age = 0.0f;
+        float lifetime = 1.0f;
+        Vector3 startScale{ 1.0f, 1.0f, 1.0f };
+        Vector3 endScale{ 0.0f, 0.0f, 0.0f };
+    };
+    std::vector<std::unique_ptr<ParticleObject>> pool_;
+    std::vector<ParticleSlot> slots_;
+    std::vector<int> freeIndices_;
+    std::size_t aliveCount_ = 0;
+};
+
+} // namespace Tests::Legacy
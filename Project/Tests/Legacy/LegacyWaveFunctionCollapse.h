@@ -0,0 +1,70 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Tests::Legacy {
+
+/// @brief ビット集合・AC-4 のソルバー（WfcSolver）へ置き換える前の WaveFunctionCollapse の求解部分
+/// @details ベンチマークで新しい実装と比べるためだけに残している。候補集合をソート済みのインデックス列で持ち、
+///          伝播のたびに積集合を作り直す。崩壊させるセルは毎回全セルを走査して選び、矛盾した時点で失敗する
+///          （バックトラックしない）。JSON の保存・読み込みなど求解に関係しない機能は省いている
+class WaveFunctionCollapse final {
+public:
+    /// @brief タイルの接続方向（KashipanEngine::WaveFunctionCollapse::Direction と同じ並び）
+    enum class Direction : std::uint8_t {
+        Up = 0,
+        Down,
+        Left,
+        Right,
+        Front,
+        Back,
+    };
+
+    static constexpr std::size_t kDirectionCount = 6;
+
+    struct Tile final {
+        std::string name;
+        std::array<std::vector<std::string>, kDirectionCount> connections;
+    };
+
+    void SetSeed(std::uint32_t seed);
+    void SetGridSize(std::uint32_t width, std::uint32_t height, std::uint32_t depth);
+    bool RegisterTile(const std::string &name);
+    bool AddTileConnection(const std::string &tileName, Direction direction, const std::string &connectedTileName);
+    bool FixTile(std::uint32_t x, std::uint32_t y, std::uint32_t z, const std::string &tileName);
+    bool SetStartPosition(std::uint32_t x, std::uint32_t y, std::uint32_t z);
+
+    /// @brief グリッド全体のタイルを確定させる（矛盾した場合は false）
+    bool Solve();
+
+    std::optional<std::string> GetResolvedTile(std::uint32_t x, std::uint32_t y, std::uint32_t z) const;
+
+private:
+    struct Cell final {
+        std::optional<std::string> fixedTileName;
+        std::optional<std::string> resolvedTileName;
+    };
+
+    bool IsInBounds(std::uint32_t x, std::uint32_t y, std::uint32_t z) const noexcept {
+        return x < width_ && y < height_ && z < depth_;
+    }
+
+    std::uint32_t width_ = 0;
+    std::uint32_t height_ = 0;
+    std::uint32_t depth_ = 0;
+    std::vector<std::vector<std::vector<Cell>>> grid_;
+
+    std::uint32_t seed_ = 0;
+    std::mt19937 randomEngine_{ seed_ };
+
+    std::unordered_map<std::string, Tile> tiles_;
+
+    std::optional<std::array<std::uint32_t, 3>> startPosition_;
+};
+
+} // namespace Tests::Legacy
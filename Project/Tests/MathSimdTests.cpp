@@ -0,0 +1,465 @@
+// 行列演算のSIMD実装（Math/MathSimd.h）の精度テストとベンチマーク
+//
+// 各カーネルの結果を、テスト内に書いたスカラー実装（SIMD導入前と同じ計算式）と倍精度で計算した参照値の
+// 両方と比べる。SIMD版の誤差は、スカラー版の誤差と同程度（数倍以内）に収まっていることを確かめる。
+// KASHIPAN_MATH_NO_SIMD を定義したビルドでは、エンジン側もスカラー実装になるため同じテストがそのまま通る。
+// ランダムな入力に加え、非アフィン（透視投影を含む）行列と、行列式が小さい（ほぼ特異な）行列も使う。
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "TestFramework.h"
+#include "Math/Matrix4x4.h"
+#include "Math/Quaternion.h"
+#include "Math/Vector3.h"
+#include "Utilities/MathUtils/Matrix4x4.h"
+#include "Utilities/MathUtils/Vector3.h"
+
+namespace MathUtils = KashipanEngine::MathUtils;
+
+namespace {
+
+/// @brief 倍精度の4x4行列（参照値の計算用）
+struct Matrix4x4d {
+    double m[4][4] = {};
+};
+
+Matrix4x4d ToDouble(const Matrix4x4 &matrix) {
+    Matrix4x4d result;
+    for (int i = 0; i < 4; ++i) {
+        for (int j = 0; j < 4; ++j) result.m[i][j] = matrix.m[i][j];
+    }
+    return result;
+}
+
+Matrix4x4d MultiplyReference(const Matrix4x4d &a, const Matrix4x4d &b) {
+    Matrix4x4d result;
+    for (int i = 0; i < 4; ++i) {
+        for (int j = 0; j < 4; ++j) {
+            for (int k = 0; k < 4; ++k) result.m[i][j] += a.m[i][k] * b.m[k][j];
+        }
+    }
+    return result;
+}
+
+/// @brief 部分ピボット選択付きのガウス・ジョルダン法による倍精度の逆行列
+Matrix4x4d InverseReference(const Matrix4x4d &matrix) {
+    double a[4][8] = {};
+    for (int i = 0; i < 4; ++i) {
+        for (int j = 0; j < 4; ++j) a[i][j] = matrix.m[i][j];
+        a[i][4 + i] = 1.0;
+    }
+    for (int col = 0; col < 4; ++col) {
+        int pivot = col;
+        for (int row = col + 1; row < 4; ++row) {
+            if (std::abs(a[row][col]) > std::abs(a[pivot][col])) pivot = row;
+        }
+        for (int j = 0; j < 8; ++j) std::swap(a[col][j], a[pivot][j]);
+        const double rcp = 1.0 / a[col][col];
+        for (int j = 0; j < 8; ++j) a[col][j] *= rcp;
+        for (int row = 0; row < 4; ++row) {
+            if (row == col) continue;
+            const double factor = a[row][col];
+            for (int j = 0; j < 8; ++j) a[row][j] -= factor * a[col][j];
+        }
+    }
+    Matrix4x4d result;
+    for (int i = 0; i < 4; ++i) {
+        for (int j = 0; j < 4; ++j) result.m[i][j] = a[i][4 + j];
+    }
+    return result;
+}
+
+/// @brief SIMD導入前と同じ展開式による単精度の行列積
+Matrix4x4 MultiplyScalar(const Matrix4x4 &a, const Matrix4x4 &b) {
+    Matrix4x4 result;
+    for (int i = 0; i < 4; ++i) {
+        for (int j = 0; j < 4; ++j) {
+            result.m[i][j] = a.m[i][0] * b.m[0][j] + a.m[i][1] * b.m[1][j] + a.m[i][2] * b.m[2][j] + a.m[i][3] * b.m[3][j];
+        }
+    }
+    return result;
+}
+
+/// @brief 3x3の小行列式（row・col を除いた行列）
+float Minor3x3(const Matrix4x4 &matrix, int row, int col) {
+    // 除いた行・列以外の添字
+    constexpr int kOthers[4][3] = { { 1, 2, 3 }, { 0, 2, 3 }, { 0, 1, 3 }, { 0, 1, 2 } };
+    const int *r = kOthers[row];
+    const int *c = kOthers[col];
+    auto at = [&](int i, int j) { return matrix.m[r[i]][c[j]]; };
+    return at(0, 0) * (at(1, 1) * at(2, 2) - at(1, 2) * at(2, 1))
+        - at(0, 1) * (at(1, 0) * at(2, 2) - at(1, 2) * at(2, 0))
+        + at(0, 2) * (at(1, 0) * at(2, 1) - at(1, 1) * at(2, 0));
+}
+
+/// @brief SIMD導入前と同じ余因子展開による単精度の逆行列
+Matrix4x4 InverseScalar(const Matrix4x4 &matrix) {
+    float cofactor[4][4];
+    for (int i = 0; i < 4; ++i) {
+        for (int j = 0; j < 4; ++j) cofactor[i][j] = ((i + j) % 2 == 0 ? 1.0f : -1.0f) * Minor3x3(matrix, i, j);
+    }
+    const float rcpDet = 1.0f / (matrix.m[0][0] * cofactor[0][0] + matrix.m[0][1] * cofactor[0][1] +
+        matrix.m[0][2] * cofactor[0][2] + matrix.m[0][3] * cofactor[0][3]);
+    Matrix4x4 result;
+    for (int i = 0; i < 4; ++i) {
+        for (int j = 0; j < 4; ++j) result.m[i][j] = cofactor[j][i] * rcpDet;
+    }
+    return result;
+}
+
+/// @brief SIMD導入前の S * R * T（行列積2回）による単精度のアフィン行列
+Matrix4x4 ComposeTRSScalar(const Vector3 &scale, const Quaternion &rotate, const Vector3 &translate) {
+    const float x = rotate.x, y = rotate.y, z = rotate.z, w = rotate.w;
+    const Matrix4x4 rotateMatrix(
+        1.0f - 2.0f * (y * y + z * z), 2.0f * (x * y + w * z), 2.0f * (x * z - w * y), 0.0f,
+        2.0f * (x * y - w * z), 1.0f - 2.0f * (x * x + z * z), 2.0f * (y * z + w * x), 0.0f,
+        2.0f * (x * z + w * y), 2.0f * (y * z - w * x), 1.0f - 2.0f * (x * x + y * y), 0.0f,
+        0.0f, 0.0f, 0.0f, 1.0f);
+    return MultiplyScalar(MultiplyScalar(MathUtils::Matrix4x4MakeScale(scale), rotateMatrix), MathUtils::Matrix4x4MakeTranslate(translate));
+}
+
+/// @brief 倍精度で計算した S * R * T
+Matrix4x4d ComposeTRSReference(const Vector3 &scale, const Quaternion &rotate, const Vector3 &translate) {
+    const double x = rotate.x, y = rotate.y, z = rotate.z, w = rotate.w;
+    const double s[3] = { scale.x, scale.y, scale.z };
+    const double r[3][3] = {
+        { 1.0 - 2.0 * (y * y + z * z), 2.0 * (x * y + w * z), 2.0 * (x * z - w * y) },
+        { 2.0 * (x * y - w * z), 1.0 - 2.0 * (x * x + z * z), 2.0 * (y * z + w * x) },
+        { 2.0 * (x * z + w * y), 2.0 * (y * z - w * x), 1.0 - 2.0 * (x * x + y * y) },
+    };
+    Matrix4x4d result;
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) result.m[i][j] = s[i] * r[i][j];
+    }
+    result.m[3][0] = translate.x;
+    result.m[3][1] = translate.y;
+    result.m[3][2] = translate.z;
+    result.m[3][3] = 1.0;
+    return result;
+}
+
+/// @brief 参照値との差の最大値を、参照値の最大絶対値で割った相対誤差
+double RelativeError(const Matrix4x4 &value, const Matrix4x4d &reference) {
+    double maxDiff = 0.0;
+    double maxAbs = 0.0;
+    for (int i = 0; i < 4; ++i) {
+        for (int j = 0; j < 4; ++j) {
+            maxDiff = std::max(maxDiff, std::abs(static_cast<double>(value.m[i][j]) - reference.m[i][j]));
+            maxAbs = std::max(maxAbs, std::abs(reference.m[i][j]));
+        }
+    }
+    return maxDiff / std::max(maxAbs, 1e-30);
+}
+
+/// @brief 1つのカーネルについて集計した誤差
+/// @details 個々のサンプルではスカラー版がたまたま丸め誤差0に近くなることがあるため、平均と最悪値で比べる
+struct ErrorStats {
+    double max = 0.0;
+    double sum = 0.0;
+    int count = 0;
+
+    void Add(double error) {
+        max = std::max(max, error);
+        sum += error;
+        ++count;
+    }
+    double Mean() const { return count ? sum / count : 0.0; }
+};
+
+/// @brief SIMD版の誤差がスカラー版と同程度か（平均は1.5倍、最悪値は4倍まで。加えて単精度の丸め数回分は許す）
+bool IsAsAccurateAsScalar(const ErrorStats &simd, const ErrorStats &scalar) {
+    constexpr double kFloatEpsilon = 1.1920929e-7;
+    return simd.Mean() <= scalar.Mean() * 1.5 + kFloatEpsilon &&
+        simd.max <= scalar.max * 4.0 + kFloatEpsilon * 16.0;
+}
+
+std::string FormatStats(const std::string &name, const ErrorStats &simd, const ErrorStats &scalar) {
+    return name + ": simd mean " + std::to_string(simd.Mean()) + " max " + std::to_string(simd.max) +
+        ", scalar mean " + std::to_string(scalar.Mean()) + " max " + std::to_string(scalar.max);
+}
+
+/// @brief テスト・ベンチマーク用の入力を乱数で作る
+class MatrixGenerator {
+public:
+    explicit MatrixGenerator(unsigned seed) : random_(seed) {}
+
+    float Uniform(float min, float max) { return std::uniform_real_distribution<float>(min, max)(random_); }
+
+    Quaternion RandomRotation() {
+        Quaternion q(Uniform(-1.0f, 1.0f), Uniform(-1.0f, 1.0f), Uniform(-1.0f, 1.0f), Uniform(-1.0f, 1.0f));
+        return q.Normalize();
+    }
+    Vector3 RandomScale(float min, float max) { return Vector3(Uniform(min, max), Uniform(min, max), Uniform(min, max)); }
+    Vector3 RandomTranslate() { return Vector3(Uniform(-100.0f, 100.0f), Uniform(-100.0f, 100.0f), Uniform(-100.0f, 100.0f)); }
+
+    /// @brief 拡大縮小・回転・平行移動からなるアフィン行列
+    Matrix4x4 RandomAffine() { return ComposeTRSScalar(RandomScale(0.1f, 10.0f), RandomRotation(), RandomTranslate()); }
+
+    /// @brief 全要素が乱数の（4列目も (0, 0, 0, 1) でない）非アフィン行列
+    Matrix4x4 RandomGeneral() {
+        Matrix4x4 result;
+        for (auto &row : result.m) {
+            for (float &value : row) value = Uniform(-2.0f, 2.0f);
+        }
+        return result;
+    }
+
+    /// @brief ワールド行列とビュー・透視投影行列を掛けた行列（非アフィン）
+    Matrix4x4 RandomWorldViewProjection() {
+        const Matrix4x4 projection = MathUtils::Matrix4x4MakePerspectiveFovMatrix(Uniform(0.5f, 1.5f), Uniform(1.0f, 2.0f), 0.1f, 1000.0f);
+        return MultiplyScalar(MultiplyScalar(RandomAffine(), RandomAffine()), projection);
+    }
+
+    /// @brief 1軸だけ極端に潰した拡大縮小を含む、行列式の小さいアフィン行列
+    Matrix4x4 RandomNearSingularAffine() {
+        Vector3 scale = RandomScale(0.5f, 2.0f);
+        (&scale.x)[std::uniform_int_distribution<int>(0, 2)(random_)] = Uniform(1e-4f, 1e-3f);
+        return ComposeTRSScalar(scale, RandomRotation(), RandomTranslate());
+    }
+
+    /// @brief ある行を他の2行の和にわずかな乱れを足したものにした、ほぼ特異な非アフィン行列
+    Matrix4x4 RandomNearSingularGeneral() {
+        Matrix4x4 result = RandomGeneral();
+        const float epsilon = 1e-3f;
+        for (int j = 0; j < 4; ++j) result.m[3][j] = result.m[1][j] + result.m[2][j] + Uniform(-epsilon, epsilon);
+        return result;
+    }
+
+private:
+    std::mt19937 random_;
+};
+
+/// @brief 全要素がビット単位で一致するか
+bool IsSameMatrix(const Matrix4x4 &a, const Matrix4x4 &b) {
+    return std::memcmp(a.m, b.m, sizeof(a.m)) == 0;
+}
+
+/// @brief 名前付きの入力の種類（失敗時のメッセージ用）
+struct MatrixCase {
+    const char *name;
+    Matrix4x4 (MatrixGenerator::*make)();
+};
+
+constexpr MatrixCase kInverseCases[] = {
+    { "affine", &MatrixGenerator::RandomAffine },
+    { "general", &MatrixGenerator::RandomGeneral },
+    { "world-view-projection", &MatrixGenerator::RandomWorldViewProjection },
+    { "near-singular affine", &MatrixGenerator::RandomNearSingularAffine },
+    { "near-singular general", &MatrixGenerator::RandomNearSingularGeneral },
+};
+
+constexpr int kSampleCount = 2000;
+
+} // namespace
+
+TEST_CASE(MathSimd_MultiplyMatchesScalar) {
+    MatrixGenerator generator(1);
+    for (const auto &testCase : kInverseCases) {
+        ErrorStats simd;
+        ErrorStats scalar;
+        for (int i = 0; i < kSampleCount; ++i) {
+            const Matrix4x4 a = (generator.*testCase.make)();
+            const Matrix4x4 b = (generator.*testCase.make)();
+            const Matrix4x4d reference = MultiplyReference(ToDouble(a), ToDouble(b));
+            simd.Add(RelativeError(a * b, reference));
+            scalar.Add(RelativeError(MultiplyScalar(a, b), reference));
+        }
+        TEST_CHECK_MESSAGE(IsAsAccurateAsScalar(simd, scalar), FormatStats(testCase.name, simd, scalar));
+    }
+}
+
+TEST_CASE(MathSimd_InverseMatchesScalar) {
+    // 逆行列の誤差は条件数に比例して大きくなるため、倍精度の参照値との差をスカラー版（余因子展開）と比べる
+    MatrixGenerator generator(2);
+    for (const auto &testCase : kInverseCases) {
+        ErrorStats simd;
+        ErrorStats scalar;
+        for (int i = 0; i < kSampleCount; ++i) {
+            const Matrix4x4 matrix = (generator.*testCase.make)();
+            const Matrix4x4d reference = InverseReference(ToDouble(matrix));
+            simd.Add(RelativeError(matrix.Inverse(), reference));
+            scalar.Add(RelativeError(InverseScalar(matrix), reference));
+        }
+        TEST_CHECK_MESSAGE(IsAsAccurateAsScalar(simd, scalar), FormatStats(testCase.name, simd, scalar));
+    }
+}
+
+TEST_CASE(MathSimd_InverseAffineMatchesGeneralInverse) {
+    MatrixGenerator generator(3);
+    for (const auto &testCase : { kInverseCases[0], kInverseCases[3] }) {
+        ErrorStats affine;
+        ErrorStats scalar;
+        bool isLastColumnExact = true;
+        for (int i = 0; i < kSampleCount; ++i) {
+            const Matrix4x4 matrix = (generator.*testCase.make)();
+            const Matrix4x4d reference = InverseReference(ToDouble(matrix));
+            const Matrix4x4 inverse = matrix.InverseAffine();
+            affine.Add(RelativeError(inverse, reference));
+            scalar.Add(RelativeError(InverseScalar(matrix), reference));
+            // 4列目は計算せずに (0, 0, 0, 1) を置く
+            isLastColumnExact = isLastColumnExact && inverse.m[0][3] == 0.0f && inverse.m[1][3] == 0.0f &&
+                inverse.m[2][3] == 0.0f && inverse.m[3][3] == 1.0f;
+        }
+        TEST_CHECK_MESSAGE(IsAsAccurateAsScalar(affine, scalar), FormatStats(testCase.name, affine, scalar));
+        TEST_CHECK(isLastColumnExact);
+    }
+}
+
+TEST_CASE(MathSimd_ComposeTRSMatchesScalar) {
+    MatrixGenerator generator(4);
+    ErrorStats compose, composeScalar;
+    ErrorStats rotate, rotateScalar;
+    for (int i = 0; i < kSampleCount; ++i) {
+        // 極端に小さい・大きい拡大率も混ぜる
+        const Vector3 scale = (i % 4 == 0) ? generator.RandomScale(1e-4f, 1e-3f) : generator.RandomScale(0.1f, 1000.0f);
+        const Quaternion rotation = generator.RandomRotation();
+        const Vector3 translate = generator.RandomTranslate();
+        const Matrix4x4d reference = ComposeTRSReference(scale, rotation, translate);
+        compose.Add(RelativeError(MathUtils::Matrix4x4ComposeTRS(scale, rotation, translate), reference));
+        composeScalar.Add(RelativeError(ComposeTRSScalar(scale, rotation, translate), reference));
+
+        const Matrix4x4d rotateReference = ComposeTRSReference(Vector3(1.0f), rotation, Vector3(0.0f));
+        rotate.Add(RelativeError(rotation.MakeRotateMatrix(), rotateReference));
+        rotateScalar.Add(RelativeError(ComposeTRSScalar(Vector3(1.0f), rotation, Vector3(0.0f)), rotateReference));
+    }
+    TEST_CHECK_MESSAGE(IsAsAccurateAsScalar(compose, composeScalar), FormatStats("ComposeTRS", compose, composeScalar));
+    TEST_CHECK_MESSAGE(IsAsAccurateAsScalar(rotate, rotateScalar), FormatStats("MakeRotateMatrix", rotate, rotateScalar));
+}
+
+TEST_CASE(MathSimd_ArrayKernelsMatchSingleCalls) {
+    // 一括処理は1要素ずつの呼び出しと同じ計算順のため、結果は完全に一致する
+    MatrixGenerator generator(5);
+    constexpr std::size_t kCount = 257;
+    std::vector<Matrix4x4> lhs(kCount), rhs(kCount), out(kCount);
+    std::vector<Vector3> scales(kCount), translates(kCount), points(kCount), transformed(kCount);
+    std::vector<Quaternion> rotates(kCount);
+    for (std::size_t i = 0; i < kCount; ++i) {
+        lhs[i] = i % 2 ? generator.RandomGeneral() : generator.RandomAffine();
+        rhs[i] = generator.RandomWorldViewProjection();
+        scales[i] = generator.RandomScale(0.1f, 10.0f);
+        rotates[i] = generator.RandomRotation();
+        translates[i] = generator.RandomTranslate();
+        points[i] = generator.RandomTranslate();
+    }
+    const Matrix4x4 shared = generator.RandomWorldViewProjection();
+
+    int mismatched = 0;
+    MathUtils::Matrix4x4MultiplyArray(lhs.data(), rhs.data(), out.data(), kCount);
+    for (std::size_t i = 0; i < kCount; ++i) mismatched += !IsSameMatrix(out[i], lhs[i] * rhs[i]);
+    TEST_CHECK_MESSAGE(mismatched == 0, "MultiplyArray (pairwise): " + std::to_string(mismatched));
+
+    mismatched = 0;
+    MathUtils::Matrix4x4MultiplyArray(lhs.data(), shared, out.data(), kCount);
+    for (std::size_t i = 0; i < kCount; ++i) mismatched += !IsSameMatrix(out[i], lhs[i] * shared);
+    TEST_CHECK_MESSAGE(mismatched == 0, "MultiplyArray (shared): " + std::to_string(mismatched));
+
+    mismatched = 0;
+    MathUtils::Matrix4x4ComposeTRSArray(scales.data(), rotates.data(), translates.data(), out.data(), kCount);
+    for (std::size_t i = 0; i < kCount; ++i) {
+        mismatched += !IsSameMatrix(out[i], MathUtils::Matrix4x4ComposeTRS(scales[i], rotates[i], translates[i]));
+    }
+    TEST_CHECK_MESSAGE(mismatched == 0, "ComposeTRSArray: " + std::to_string(mismatched));
+
+    // 透視除算を伴う（非アフィンの）変換は積和の順序（FMA）で丸めが変わるため、倍精度の参照値との差で比べる
+    ErrorStats batch;
+    ErrorStats perCall;
+    MathUtils::Matrix4x4TransformPoints(shared, points.data(), transformed.data(), kCount);
+    const Matrix4x4d sharedReference = ToDouble(shared);
+    for (std::size_t i = 0; i < kCount; ++i) {
+        const double p[4] = { points[i].x, points[i].y, points[i].z, 1.0 };
+        double r[4] = {};
+        for (int j = 0; j < 4; ++j) {
+            for (int k = 0; k < 4; ++k) r[j] += p[k] * sharedReference.m[k][j];
+        }
+        const double scale = std::max({ 1.0, std::abs(r[0] / r[3]), std::abs(r[1] / r[3]), std::abs(r[2] / r[3]) });
+        auto error = [&](const Vector3 &v) {
+            return std::max({ std::abs(v.x - r[0] / r[3]), std::abs(v.y - r[1] / r[3]), std::abs(v.z - r[2] / r[3]) }) / scale;
+        };
+        batch.Add(error(transformed[i]));
+        perCall.Add(error(MathUtils::Transform(points[i], shared)));
+    }
+    TEST_CHECK_MESSAGE(IsAsAccurateAsScalar(batch, perCall), FormatStats("TransformPoints", batch, perCall));
+
+    // w が0になる点は Transform と同じく原点を返す
+    Matrix4x4 projectToInfinity = Matrix4x4::Identity();
+    projectToInfinity.m[3][3] = 0.0f;
+    const Vector3 origin(0.0f);
+    Vector3 projected(1.0f);
+    MathUtils::Matrix4x4TransformPoints(projectToInfinity, &origin, &projected, 1);
+    TEST_CHECK(projected.x == 0.0f && projected.y == 0.0f && projected.z == 0.0f);
+}
+
+BENCHMARK_CASE(MathSimd_KernelsVsScalar) {
+    constexpr std::size_t kCount = 100000;
+    constexpr int kRepeat = 5;
+    MatrixGenerator generator(6);
+    std::vector<Matrix4x4> lhs(kCount), rhs(kCount), out(kCount);
+    std::vector<Vector3> scales(kCount), translates(kCount), points(kCount), transformed(kCount);
+    std::vector<Quaternion> rotates(kCount);
+    for (std::size_t i = 0; i < kCount; ++i) {
+        lhs[i] = generator.RandomAffine();
+        rhs[i] = generator.RandomAffine();
+        scales[i] = generator.RandomScale(0.1f, 10.0f);
+        rotates[i] = generator.RandomRotation();
+        translates[i] = generator.RandomTranslate();
+        points[i] = generator.RandomTranslate();
+    }
+    const Matrix4x4 viewProjection = generator.RandomWorldViewProjection();
+    // 最適化で計算が消えないよう、結果の一部を足し合わせて最後に使う
+    float sink = 0.0f;
+
+    auto report = [](const char *name, double milliseconds) {
+        Tests::ReportBenchmark(name, milliseconds * 1.0e6 / static_cast<double>(kCount), "ns/op");
+    };
+
+    report("Multiply, scalar", Tests::MeasureBestMilliseconds(kRepeat, [&]() {
+        for (std::size_t i = 0; i < kCount; ++i) out[i] = MultiplyScalar(lhs[i], rhs[i]);
+        sink += out[kCount / 2].m[1][1];
+    }));
+    report("Multiply, engine", Tests::MeasureBestMilliseconds(kRepeat, [&]() {
+        MathUtils::Matrix4x4MultiplyArray(lhs.data(), rhs.data(), out.data(), kCount);
+        sink += out[kCount / 2].m[1][1];
+    }));
+    report("Multiply shared rhs, scalar", Tests::MeasureBestMilliseconds(kRepeat, [&]() {
+        for (std::size_t i = 0; i < kCount; ++i) out[i] = MultiplyScalar(lhs[i], viewProjection);
+        sink += out[kCount / 2].m[1][1];
+    }));
+    report("Multiply shared rhs, engine", Tests::MeasureBestMilliseconds(kRepeat, [&]() {
+        MathUtils::Matrix4x4MultiplyArray(lhs.data(), viewProjection, out.data(), kCount);
+        sink += out[kCount / 2].m[1][1];
+    }));
+    report("Inverse, scalar cofactor", Tests::MeasureBestMilliseconds(kRepeat, [&]() {
+        for (std::size_t i = 0; i < kCount; ++i) out[i] = InverseScalar(lhs[i]);
+        sink += out[kCount / 2].m[1][1];
+    }));
+    report("Inverse, engine", Tests::MeasureBestMilliseconds(kRepeat, [&]() {
+        for (std::size_t i = 0; i < kCount; ++i) out[i] = lhs[i].Inverse();
+        sink += out[kCount / 2].m[1][1];
+    }));
+    report("InverseAffine, engine", Tests::MeasureBestMilliseconds(kRepeat, [&]() {
+        for (std::size_t i = 0; i < kCount; ++i) out[i] = lhs[i].InverseAffine();
+        sink += out[kCount / 2].m[1][1];
+    }));
+    report("ComposeTRS, scalar S*R*T", Tests::MeasureBestMilliseconds(kRepeat, [&]() {
+        for (std::size_t i = 0; i < kCount; ++i) out[i] = ComposeTRSScalar(scales[i], rotates[i], translates[i]);
+        sink += out[kCount / 2].m[1][1];
+    }));
+    report("ComposeTRS, engine", Tests::MeasureBestMilliseconds(kRepeat, [&]() {
+        MathUtils::Matrix4x4ComposeTRSArray(scales.data(), rotates.data(), translates.data(), out.data(), kCount);
+        sink += out[kCount / 2].m[1][1];
+    }));
+    report("TransformPoint, per call", Tests::MeasureBestMilliseconds(kRepeat, [&]() {
+        for (std::size_t i = 0; i < kCount; ++i) transformed[i] = MathUtils::Transform(points[i], viewProjection);
+        sink += transformed[kCount / 2].x;
+    }));
+    report("TransformPoints, engine", Tests::MeasureBestMilliseconds(kRepeat, [&]() {
+        MathUtils::Matrix4x4TransformPoints(viewProjection, points.data(), transformed.data(), kCount);
+        sink += transformed[kCount / 2].x;
+    }));
+    Tests::ReportBenchmark("checksum (ignore)", static_cast<double>(sink), "");
+}
@@ -0,0 +1,223 @@
+// Collider のプリミティブ形状のトリガーのネイティブ判定（SetNativeTriggers3D(true)）と、
+// RP3Dのワールドで判定する従来の経路（SetNativeTriggers3D(false)）との同値性テストとベンチマーク
+//
+// 同じ配置・同じ動きのトリガーと、RigidBody3Dへ取り付けたコライダー（Fakes/ColliderFakes で差し替える）を
+// 両方の経路で更新し、フレームごとのEnter/Stay/Exitの組と、法線・めり込み量が一致することを確かめる。
+// 法線・めり込み量はRP3Dの接触点生成とCollisionAlgorithms3Dで計算方法が異なるため、誤差を許して比べる。
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "TestFramework.h"
+#include "Fakes/ColliderFakes.h"
+#include "Objects/Collision/Collider.h"
+
+using KashipanEngine::Collider;
+using KashipanEngine::ColliderInfo3D;
+using KashipanEngine::EmptyObject;
+using KashipanEngine::HitInfo3D;
+
+namespace {
+
+/// @brief コールバックの呼び出し1回分の記録
+struct HitEvent3D final {
+    int frame = 0;
+    char kind = ' '; // 'E'nter / 'S'tay / 'X' (Exit)
+    std::uint32_t self = 0;
+    std::uintptr_t other = 0;
+    Vector3 normal{ 0.0f, 0.0f, 0.0f };
+    float penetration = 0.0f;
+
+    /// @brief 法線・めり込み量以外で並べる（Update3Dはフレーム内の発火順を保証しないため、比較前に並べ替える）
+    bool operator<(const HitEvent3D &rhs) const {
+        return std::tie(frame, self, other, kind) < std::tie(rhs.frame, rhs.self, rhs.other, rhs.kind);
+    }
+};
+
+/// @brief 所属オブジェクトとして渡すだけの、参照されないポインタを作る
+EmptyObject *DummyOwner(std::uint32_t index) {
+    return reinterpret_cast<EmptyObject *>(static_cast<std::uintptr_t>(index + 1) * 16u);
+}
+
+enum class ShapeKind { Sphere, Box, Capsule };
+
+/// @brief 乱数で決めた配置・移動量を保持し、同じシナリオを両方の経路で再生できるようにする
+struct Scenario3D final {
+    std::uint32_t triggerCount = 0;
+    std::uint32_t bodyCount = 0;
+    std::vector<Vector3> positions;
+    std::vector<float> sizes;
+    std::vector<ShapeKind> kinds;
+    std::vector<bool> isContinuous;
+    std::vector<Vector3> steps; // frame * (triggerCount + bodyCount) + index
+    int frameCount = 0;
+
+    Scenario3D(std::uint32_t triggers, std::uint32_t bodies, int frames, float area, float maxStep, std::uint32_t seed)
+        : triggerCount(triggers), bodyCount(bodies), frameCount(frames) {
+        std::mt19937 random(seed);
+        std::uniform_real_distribution<float> position(0.0f, area);
+        std::uniform_real_distribution<float> size(0.3f, 1.2f);
+        std::uniform_real_distribution<float> step(-maxStep, maxStep);
+        std::uniform_int_distribution<int> shape(0, 2);
+        std::uniform_int_distribution<int> coin(0, 3);
+        for (std::uint32_t i = 0; i < GetCount(); ++i) {
+            positions.push_back({ position(random), position(random), position(random) });
+            sizes.push_back(size(random));
+            // 取り付けるボディ側は接触点の計算が安定する球と箱に限る
+            kinds.push_back(static_cast<ShapeKind>(i < triggerCount ? shape(random) : shape(random) % 2));
+            isContinuous.push_back(i < triggerCount && coin(random) == 0);
+        }
+        steps.resize(static_cast<std::size_t>(frames) * GetCount());
+        for (auto &s : steps) s = { step(random), step(random), step(random) };
+    }
+
+    std::uint32_t GetCount() const { return triggerCount + bodyCount; }
+
+    ColliderInfo3D MakeInfo(std::uint32_t index, const Vector3 &center) const {
+        ColliderInfo3D info;
+        switch (kinds[index]) {
+        case ShapeKind::Sphere: {
+            ColliderInfo3D::SphereShape3D sphere;
+            sphere.center = center;
+            sphere.radius = sizes[index];
+            info.shape = sphere;
+            break;
+        }
+        case ShapeKind::Box: {
+            ColliderInfo3D::BoxShape3D box;
+            box.center = center;
+            box.halfExtents = { sizes[index], sizes[index] * 0.75f, sizes[index] * 0.5f };
+            info.shape = box;
+            break;
+        }
+        case ShapeKind::Capsule: {
+            ColliderInfo3D::CapsuleShape3D capsule;
+            capsule.center = center;
+            capsule.radius = sizes[index] * 0.5f;
+            capsule.height = sizes[index] * 2.0f;
+            info.shape = capsule;
+            break;
+        }
+        }
+        info.ownerObject = DummyOwner(index);
+        info.isTrigger = index < triggerCount;
+        info.continuousDetection = isContinuous[index];
+        return info;
+    }
+
+    /// @brief シナリオを再生し、発火したコールバックをフレーム内で並べ替えて返す
+    std::vector<HitEvent3D> Run(bool nativeTriggers) const {
+        Tests::Fakes::ResetColliderFakes();
+        std::vector<HitEvent3D> events;
+        int currentFrame = 0;
+        Collider collider;
+        collider.SetNativeTriggers3D(nativeTriggers);
+        auto *world = collider.GetPhysicsWorld();
+
+        // 取り付け先のボディは重力・スリープを切り、シミュレーションで動かないようにする
+        std::vector<reactphysics3d::RigidBody *> bodies;
+        for (std::uint32_t i = triggerCount; i < GetCount(); ++i) {
+            auto *body = world->createRigidBody(reactphysics3d::Transform::identity());
+            body->enableGravity(false);
+            body->setIsAllowedToSleep(false);
+            Tests::Fakes::SetAttachedBody3D(DummyOwner(i), body);
+            bodies.push_back(body);
+        }
+
+        auto attach = [&](ColliderInfo3D &info, std::uint32_t index) {
+            auto record = [&events, &currentFrame, index](char kind) {
+                return [&events, &currentFrame, index, kind](const HitInfo3D &hit) {
+                    events.push_back(HitEvent3D{ currentFrame, kind, index, reinterpret_cast<std::uintptr_t>(hit.otherObject),
+                        hit.normal, hit.penetration });
+                };
+            };
+            info.onCollisionEnter = record('E');
+            info.onCollisionStay = record('S');
+            info.onCollisionExit = record('X');
+        };
+
+        std::vector<Collider::ColliderID> ids;
+        auto positionsNow = positions;
+        for (std::uint32_t i = 0; i < GetCount(); ++i) {
+            auto info = MakeInfo(i, positionsNow[i]);
+            attach(info, i);
+            ids.push_back(collider.Add(info));
+        }
+        for (currentFrame = 0; currentFrame < frameCount; ++currentFrame) {
+            for (std::uint32_t i = 0; i < GetCount(); ++i) {
+                const auto &s = steps[static_cast<std::size_t>(currentFrame) * GetCount() + i];
+                positionsNow[i] += s;
+                auto info = MakeInfo(i, positionsNow[i]);
+                attach(info, i);
+                collider.UpdateColliderInfo3D(ids[i], info);
+            }
+            collider.Update3D();
+        }
+
+        for (auto id : ids) collider.Remove3D(id);
+        for (auto *body : bodies) world->destroyRigidBody(body);
+        Tests::Fakes::ResetColliderFakes();
+
+        std::stable_sort(events.begin(), events.end());
+        return events;
+    }
+};
+
+std::string Describe(const HitEvent3D &e) {
+    return "frame " + std::to_string(e.frame) + " " + e.kind + " self " + std::to_string(e.self) +
+        " other " + std::to_string(e.other);
+}
+
+} // namespace
+
+TEST_CASE(NativeTriggers3D_MatchesRp3dPath) {
+    // トリガー300個と、RigidBody3Dへ取り付けた球・箱100個を同じ範囲で動かす。
+    // 動きの大きいトリガーの一部は連続衝突判定（スイープ）も行う
+    const Scenario3D scenario(300, 100, 30, 30.0f, 0.5f, 31337);
+    const auto rp3d = scenario.Run(false);
+    const auto native = scenario.Run(true);
+
+    TEST_CHECK_MESSAGE(rp3d.size() > 100, "too few events to compare: " + std::to_string(rp3d.size()));
+    TEST_CHECK_MESSAGE(rp3d.size() == native.size(),
+        "event count differs: rp3d " + std::to_string(rp3d.size()) + ", native " + std::to_string(native.size()));
+
+    std::size_t mismatched = 0;
+    std::string firstMismatch;
+    const std::size_t count = std::min(rp3d.size(), native.size());
+    for (std::size_t i = 0; i < count; ++i) {
+        const auto &a = rp3d[i];
+        const auto &b = native[i];
+        bool same = !(a < b) && !(b < a);
+        if (same && a.kind != 'X') {
+            // 同じ向きの法線（RP3Dは接触点ごとに法線を持つため、最大5度程度のずれは許す）と、近いめり込み量
+            const float dot = a.normal.x * b.normal.x + a.normal.y * b.normal.y + a.normal.z * b.normal.z;
+            same = dot >= 0.996f && std::abs(a.penetration - b.penetration) <= 0.01f + 0.05f * a.penetration;
+        }
+        if (!same) {
+            if (mismatched == 0) firstMismatch = "rp3d " + Describe(a) + " / native " + Describe(b);
+            ++mismatched;
+        }
+    }
+    TEST_CHECK_MESSAGE(mismatched == 0, std::to_string(mismatched) + " mismatching events, first: " + firstMismatch);
+}
+
+BENCHMARK_CASE(NativeTriggers3D_NativeVsRp3d) {
+    // 当たり判定の範囲やアイテムなど、動かない・動くトリガーが多数あり、ボディは少数という構成
+    const Scenario3D scenario(2000, 200, 30, 120.0f, 0.2f, 99);
+
+    std::size_t rp3dEvents = 0;
+    const double rp3dMs = Tests::MeasureMilliseconds([&]() { rp3dEvents = scenario.Run(false).size(); });
+    std::size_t nativeEvents = 0;
+    const double nativeMs = Tests::MeasureMilliseconds([&]() { nativeEvents = scenario.Run(true).size(); });
+
+    const double frames = static_cast<double>(scenario.frameCount);
+    Tests::ReportBenchmark("Triggers3D 2k triggers + 200 bodies, RP3D (per frame)", rp3dMs / frames, "ms");
+    Tests::ReportBenchmark("Triggers3D 2k triggers + 200 bodies, native (per frame)", nativeMs / frames, "ms");
+    Tests::ReportBenchmark("Triggers3D callbacks, RP3D", static_cast<double>(rp3dEvents), "calls");
+    Tests::ReportBenchmark("Triggers3D callbacks, native", static_cast<double>(nativeEvents), "calls");
+}
@@ -0,0 +1,202 @@
+// PerlinNoise / FractalNoise のまとめて評価する関数（GetValues・FillGrid）のテストと、
+// GetValue を1点ずつ呼ぶ場合との速度のベンチマーク
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "TestFramework.h"
+#include "Utilities/MathUtils/FractalNoise.h"
+#include "Utilities/MathUtils/PerlinNoise.h"
+#include "Utilities/Plugin/Plugins.h"
+#include "Utilities/Plugin/Thread/JobSystem.h"
+
+using KashipanEngine::FractalNoise;
+using KashipanEngine::NoiseGrid;
+using KashipanEngine::PerlinNoise;
+using Plugin::JobSystem;
+
+namespace {
+
+/// @brief 出力の番兵値（書き込まれていないことの確認用）
+constexpr float kSentinel = 1234.5f;
+
+std::vector<float> MakeCoordinates(size_t count, float scale, float offset) {
+    std::vector<float> values(count);
+    for (size_t i = 0; i < count; ++i) values[i] = static_cast<float>(i) * scale + offset;
+    return values;
+}
+
+/// @brief FillGrid のテスト用の格子
+/// @details 行の端数（SSE の4点に満たない残り）を通るよう sizeX を4の倍数にせず、
+///          行単位の並列化を通るよう点数を PerlinNoise・FractalNoise の並列化の閾値（4096・1024点）より多くする
+NoiseGrid MakeTestGrid(bool is3D) {
+    NoiseGrid grid;
+    grid.sizeX = is3D ? 37 : 67;
+    grid.sizeY = is3D ? 13 : 71;
+    grid.sizeZ = is3D ? 11 : 1;
+    grid.originX = -3.7f;
+    grid.originY = 1.25f;
+    grid.originZ = is3D ? 0.3f : 0.0f;
+    grid.stepX = 0.173f;
+    grid.stepY = 0.091f;
+    grid.stepZ = is3D ? 0.217f : 1.0f;
+    return grid;
+}
+
+/// @brief 格子の各点を、FillGrid と同じ式（origin + (float)index * step）・同じ並び（[z][y][x]）で GetValue に渡して比べる
+template <typename GetValueFunc>
+void CheckGridMatchesGetValue(const NoiseGrid &grid, const std::vector<float> &out, bool is3D, const std::string &what, GetValueFunc &&getValue) {
+    size_t mismatchCount = 0;
+    for (uint32_t z = 0; z < grid.sizeZ; ++z) {
+        for (uint32_t y = 0; y < grid.sizeY; ++y) {
+            for (uint32_t x = 0; x < grid.sizeX; ++x) {
+                const float px = grid.originX + static_cast<float>(x) * grid.stepX;
+                const float py = grid.originY + static_cast<float>(y) * grid.stepY;
+                const float pz = grid.originZ + static_cast<float>(z) * grid.stepZ;
+                const size_t index = (static_cast<size_t>(z) * grid.sizeY + y) * grid.sizeX + x;
+                // 2次元の格子は GetValue(x, y) と同じ値になる
+                const float expected = is3D ? getValue(px, py, pz) : getValue(px, py);
+                if (out[index] != expected) ++mismatchCount;
+            }
+        }
+    }
+    TEST_CHECK_MESSAGE(mismatchCount == 0, what + ": " + std::to_string(mismatchCount) + " mismatches");
+}
+
+} // namespace
+
+TEST_CASE(PerlinNoise_GetValuesMatchesGetValue) {
+    const PerlinNoise noise(42);
+    const auto xs = MakeCoordinates(37, 0.173f, -2.0f);
+    const auto ys = MakeCoordinates(37, 0.091f, 5.0f);
+    const auto zs = MakeCoordinates(37, 0.057f, 0.5f);
+    std::vector<float> out(37);
+    noise.GetValues(xs, ys, zs, out);
+    for (size_t i = 0; i < out.size(); ++i) TEST_CHECK(out[i] == noise.GetValue(xs[i], ys[i], zs[i]));
+
+    // ys・zs が空の場合は 0 として扱う
+    noise.GetValues(xs, {}, {}, out);
+    for (size_t i = 0; i < out.size(); ++i) TEST_CHECK(out[i] == noise.GetValue(xs[i], 0.0f, 0.0f));
+}
+
+TEST_CASE(PerlinNoise_GetValuesClampsToShortestInput) {
+    // ys・zs が xs より短くても、その先を読まずに短い方の要素数だけ計算する
+    const PerlinNoise noise(7);
+    const auto xs = MakeCoordinates(32, 0.21f, 0.0f);
+    const auto ys = MakeCoordinates(32, 0.13f, 1.0f);
+    const auto zs = MakeCoordinates(32, 0.07f, 2.0f);
+    std::vector<float> out(32, kSentinel);
+    noise.GetValues(xs, std::span<const float>(ys).first(11), zs, out);
+    for (size_t i = 0; i < 11; ++i) TEST_CHECK(out[i] == noise.GetValue(xs[i], ys[i], zs[i]));
+    for (size_t i = 11; i < out.size(); ++i) TEST_CHECK(out[i] == kSentinel);
+
+    std::fill(out.begin(), out.end(), kSentinel);
+    noise.GetValues(xs, ys, std::span<const float>(zs).first(6), out);
+    for (size_t i = 0; i < 6; ++i) TEST_CHECK(out[i] == noise.GetValue(xs[i], ys[i], zs[i]));
+    for (size_t i = 6; i < out.size(); ++i) TEST_CHECK(out[i] == kSentinel);
+}
+
+TEST_CASE(FractalNoise_GetValuesClampsToShortestInput) {
+    const FractalNoise noise(3);
+    const auto xs = MakeCoordinates(100, 0.05f, 0.0f);
+    const auto ys = MakeCoordinates(100, 0.03f, 1.0f);
+    const auto zs = MakeCoordinates(100, 0.02f, 2.0f);
+    std::vector<float> out(100, kSentinel);
+    noise.GetValues(xs, ys, std::span<const float>(zs).first(70), out, 5, 2.0f, 0.5f);
+    for (size_t i = 0; i < 70; ++i) TEST_CHECK(out[i] == noise.GetValue(xs[i], ys[i], zs[i], 5, 2.0f, 0.5f));
+    for (size_t i = 70; i < out.size(); ++i) TEST_CHECK(out[i] == kSentinel);
+}
+
+TEST_CASE(PerlinNoise_FillGridMatchesGetValue) {
+    const PerlinNoise noise(42);
+    JobSystem jobSystem(4);
+    for (const bool is3D : { false, true }) {
+        const NoiseGrid grid = MakeTestGrid(is3D);
+        TEST_CHECK(grid.sizeX % 4 != 0 && grid.GetCount() > 4096);
+        for (JobSystem *system : { static_cast<JobSystem *>(nullptr), &jobSystem }) {
+            // 格子の後ろの要素は書き換えない
+            std::vector<float> out(grid.GetCount() + 3, kSentinel);
+            Tests::WithJobSystem(system, [&]() { noise.FillGrid(grid, out); });
+            const std::string what = std::string(is3D ? "3D" : "2D") + (system ? " parallel" : " serial");
+            CheckGridMatchesGetValue(grid, out, is3D, what, [&](auto... position) { return noise.GetValue(position...); });
+            TEST_CHECK_MESSAGE(std::all_of(out.end() - 3, out.end(), [](float value) { return value == kSentinel; }), what);
+        }
+    }
+
+    // 出力が格子の点数より短い場合は何もしない
+    const NoiseGrid grid = MakeTestGrid(false);
+    std::vector<float> shortOut(grid.GetCount() - 1, kSentinel);
+    noise.FillGrid(grid, shortOut);
+    TEST_CHECK(std::all_of(shortOut.begin(), shortOut.end(), [](float value) { return value == kSentinel; }));
+}
+
+TEST_CASE(FractalNoise_FillGridMatchesGetValue) {
+    const FractalNoise noise(3);
+    JobSystem jobSystem(4);
+    for (const bool is3D : { false, true }) {
+        const NoiseGrid grid = MakeTestGrid(is3D);
+        TEST_CHECK(grid.sizeX % 4 != 0 && grid.GetCount() > 1024);
+        for (JobSystem *system : { static_cast<JobSystem *>(nullptr), &jobSystem }) {
+            std::vector<float> out(grid.GetCount(), kSentinel);
+            Tests::WithJobSystem(system, [&]() { noise.FillGrid(grid, out, 5, 2.0f, 0.5f); });
+            const std::string what = std::string(is3D ? "3D" : "2D") + (system ? " parallel" : " serial");
+            CheckGridMatchesGetValue(grid, out, is3D, what, [&](auto... position) { return noise.GetValue(position..., 5, 2.0f, 0.5f); });
+        }
+    }
+}
+
+BENCHMARK_CASE(Noise_ScalarVsBatched) {
+    // 256x256 のハイトマップ（2次元）と 64x64x64 のボリューム（3次元）を、GetValue を1点ずつ呼ぶ場合・
+    // 座標を用意して GetValues に渡す場合・FillGrid に格子を渡す場合で比べる。
+    // まとめて評価する関数は、ジョブシステム無し（SSE だけ）とジョブシステム有り（SSE + 並列）の両方で測る
+    const PerlinNoise perlin(42);
+    const FractalNoise fractal(42);
+    JobSystem jobSystem(JobSystem::GetDefaultWorkerCount());
+
+    for (const bool is3D : { false, true }) {
+        NoiseGrid grid;
+        grid.sizeX = is3D ? 64 : 256;
+        grid.sizeY = is3D ? 64 : 256;
+        grid.sizeZ = is3D ? 64 : 1;
+        grid.stepX = grid.stepY = grid.stepZ = 0.037f;
+        const size_t count = grid.GetCount();
+        std::vector<float> xs(count), ys(count), zs(count), out(count);
+        for (size_t i = 0; i < count; ++i) {
+            xs[i] = grid.originX + static_cast<float>(i % grid.sizeX) * grid.stepX;
+            ys[i] = grid.originY + static_cast<float>((i / grid.sizeX) % grid.sizeY) * grid.stepY;
+            zs[i] = grid.originZ + static_cast<float>(i / (static_cast<size_t>(grid.sizeX) * grid.sizeY)) * grid.stepZ;
+        }
+        const std::string label = is3D ? "64^3 grid" : "256^2 grid";
+
+        const auto report = [&](const std::string &name, auto &&scalar, auto &&values, auto &&fill) {
+            const double scalarMs = Tests::MeasureBestMilliseconds(3, scalar);
+            const double valuesMs = Tests::MeasureBestMilliseconds(3, values);
+            const double fillMs = Tests::MeasureBestMilliseconds(3, fill);
+            double valuesParallelMs = 0.0;
+            double fillParallelMs = 0.0;
+            Tests::WithJobSystem(&jobSystem, [&]() {
+                valuesParallelMs = Tests::MeasureBestMilliseconds(3, values);
+                fillParallelMs = Tests::MeasureBestMilliseconds(3, fill);
+            });
+            Tests::ReportBenchmark(label + " " + name + " GetValue per point", scalarMs, "ms");
+            Tests::ReportBenchmark(label + " " + name + " GetValues", valuesMs, "ms");
+            Tests::ReportBenchmark(label + " " + name + " FillGrid", fillMs, "ms");
+            Tests::ReportBenchmark(label + " " + name + " GetValues + jobs", valuesParallelMs, "ms");
+            Tests::ReportBenchmark(label + " " + name + " FillGrid + jobs", fillParallelMs, "ms");
+            Tests::ReportBenchmark(label + " " + name + " speedup (FillGrid / scalar)", scalarMs / fillMs, "x");
+            Tests::ReportBenchmark(label + " " + name + " speedup (FillGrid + jobs / scalar)", scalarMs / fillParallelMs, "x");
+        };
+
+        Tests::WithJobSystem(nullptr, [&]() {
+            report("perlin",
+                [&]() { for (size_t i = 0; i < count; ++i) out[i] = perlin.GetValue(xs[i], ys[i], zs[i]); },
+                [&]() { perlin.GetValues(xs, ys, zs, out); },
+                [&]() { perlin.FillGrid(grid, out); });
+            report("fractal(4 octaves)",
+                [&]() { for (size_t i = 0; i < count; ++i) out[i] = fractal.GetValue(xs[i], ys[i], zs[i]); },
+                [&]() { fractal.GetValues(xs, ys, zs, out); },
+                [&]() { fractal.FillGrid(grid, out); });
+        });
+    }
+}
@@ -0,0 +1,197 @@
+// ParticleSimulation のテストと、置き換え前の1パーティクル1オブジェクトの更新とのベンチマーク
+//
+// 寿命を迎えたパーティクルを末尾と入れ替えて詰めた後も、生き残ったパーティクルが自分の状態
+// （位置・速度・回転・スケール変化の進み具合）を保っていることを、1パーティクルずつ計算する参照実装と比べて確かめる。
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "TestFramework.h"
+#include "Legacy/LegacyObjectParticles.h"
+#include "Objects/ParticleSimulation.h"
+#include "Utilities/MathUtils/Matrix4x4.h"
+
+using KashipanEngine::ParticleSimulation;
+
+namespace MathUtils = KashipanEngine::MathUtils;
+
+namespace {
+
+/// @brief 1パーティクルずつ状態を持つ参照実装（ParticleSimulation::Simulate と同じ式・同じ順序で進める）
+struct ReferenceParticle {
+    ParticleSimulation::SpawnParams params;
+    float age = 0.0f;
+};
+
+void SimulateReference(std::vector<ReferenceParticle> &particles, float deltaTime) {
+    for (auto &particle : particles) particle.age += deltaTime;
+    std::erase_if(particles, [](const ReferenceParticle &particle) { return particle.age >= particle.params.lifetime; });
+    for (auto &particle : particles) {
+        auto &p = particle.params;
+        p.velocity = p.velocity + p.acceleration * deltaTime;
+        p.position = p.position + p.velocity * deltaTime;
+        p.rotation = p.rotation + (p.angularVelocity + p.angularAcceleration * (0.5f * deltaTime)) * deltaTime;
+        p.angularVelocity = p.angularVelocity + p.angularAcceleration * deltaTime;
+    }
+}
+
+/// @brief 親・ビルボード無しのインスタンス行列（Scale * RotateXYZ * Translate）
+Matrix4x4 MakeReferenceMatrix(const ReferenceParticle &particle) {
+    const auto &p = particle.params;
+    const float t = std::clamp(particle.age / p.lifetime, 0.0f, 1.0f);
+    const Vector3 scale = p.startScale + (p.endScale - p.startScale) * t;
+    return MathUtils::Matrix4x4MakeScale(scale) * MathUtils::Matrix4x4MakeRotate(p.rotation) * MathUtils::Matrix4x4MakeTranslate(p.position);
+}
+
+bool IsNearlyEqual(const Matrix4x4 &a, const Matrix4x4 &b) {
+    for (int i = 0; i < 4; ++i) {
+        for (int j = 0; j < 4; ++j) {
+            if (std::abs(a.m[i][j] - b.m[i][j]) > 1e-4f * std::max(1.0f, std::abs(b.m[i][j]))) return false;
+        }
+    }
+    return true;
+}
+
+/// @brief 位置のY成分にパーティクルの番号を入れた初期値（Y方向には動かさないため、行列から番号を読み戻せる）
+ParticleSimulation::SpawnParams MakeRandomParams(std::mt19937 &random, int id) {
+    std::uniform_real_distribution<float> value(-1.0f, 1.0f);
+    std::uniform_int_distribution<int> lifetimeSteps(1, 12);
+    ParticleSimulation::SpawnParams params;
+    params.position = Vector3(value(random) * 10.0f, static_cast<float>(id), value(random) * 10.0f);
+    params.velocity = Vector3(value(random), 0.0f, value(random));
+    params.acceleration = Vector3(value(random), 0.0f, value(random));
+    params.rotation = Vector3(value(random), value(random), value(random));
+    params.angularVelocity = Vector3(value(random), value(random), value(random));
+    params.angularAcceleration = Vector3(value(random), value(random), value(random));
+    params.startScale = Vector3(1.0f + value(random) * 0.5f, 1.0f + value(random) * 0.5f, 1.0f + value(random) * 0.5f);
+    params.endScale = Vector3(value(random) * 0.5f + 0.5f, value(random) * 0.5f + 0.5f, value(random) * 0.5f + 0.5f);
+    // 寿命はフレーム時間の途中に来るようにずらし、同じフレームに並んだ位置のパーティクルが複数死ぬようにする
+    params.lifetime = (static_cast<float>(lifetimeSteps(random)) - 0.5f) * 0.1f;
+    return params;
+}
+
+} // namespace
+
+TEST_CASE(ParticleSimulation_SwapCompactionKeepsSurvivorState) {
+    constexpr std::uint32_t kCapacity = 203;
+    constexpr float kDeltaTime = 0.1f;
+    std::mt19937 random(11);
+    std::uniform_int_distribution<int> spawnCount(0, 40);
+
+    ParticleSimulation simulation;
+    simulation.SetCapacity(kCapacity);
+    std::vector<ReferenceParticle> reference;
+    std::vector<Matrix4x4> matrices(kCapacity);
+    int nextID = 0;
+    int totalDeaths = 0;
+
+    for (int frame = 0; frame < 60; ++frame) {
+        const int count = frame == 0 ? static_cast<int>(kCapacity) : spawnCount(random);
+        for (int i = 0; i < count; ++i) {
+            const auto params = MakeRandomParams(random, nextID);
+            const bool spawned = simulation.Spawn(params);
+            TEST_CHECK(spawned == (reference.size() < kCapacity));
+            if (!spawned) break;
+            reference.push_back({ params, 0.0f });
+            ++nextID;
+        }
+
+        const std::size_t aliveBefore = reference.size();
+        simulation.Simulate(kDeltaTime);
+        SimulateReference(reference, kDeltaTime);
+        totalDeaths += static_cast<int>(aliveBefore - reference.size());
+        TEST_CHECK_MESSAGE(simulation.GetAliveCount() == reference.size(), "frame " + std::to_string(frame) + ": alive " +
+            std::to_string(simulation.GetAliveCount()) + ", expected " + std::to_string(reference.size()));
+        if (simulation.GetAliveCount() != reference.size()) return;
+
+        // 詰めた後の並びは参照実装と異なるため、行列に残した番号で突き合わせる
+        ParticleSimulation::InstanceParams instanceParams;
+        simulation.WriteInstanceMatrices(instanceParams, matrices.data(), 0, simulation.GetAliveCount());
+        std::vector<int> seen(static_cast<std::size_t>(nextID), 0);
+        int mismatched = 0;
+        for (std::uint32_t i = 0; i < simulation.GetAliveCount(); ++i) {
+            const int id = static_cast<int>(std::lround(matrices[i].m[3][1]));
+            const auto it = std::find_if(reference.begin(), reference.end(),
+                [id](const ReferenceParticle &particle) { return static_cast<int>(particle.params.position.y) == id; });
+            if (it == reference.end() || seen[id]++ || !IsNearlyEqual(matrices[i], MakeReferenceMatrix(*it))) ++mismatched;
+        }
+        TEST_CHECK_MESSAGE(mismatched == 0, "frame " + std::to_string(frame) + ": " + std::to_string(mismatched) + " particles lost their state");
+    }
+    // 毎フレーム複数のパーティクルが入れ替わったことも確かめておく
+    TEST_CHECK(totalDeaths > static_cast<int>(kCapacity));
+}
+
+TEST_CASE(ParticleSimulation_CapacityLimitsSpawnAndShrinkKeepsFront) {
+    ParticleSimulation simulation;
+    simulation.SetCapacity(4);
+    for (int id = 0; id < 4; ++id) {
+        ParticleSimulation::SpawnParams params;
+        params.position = Vector3(0.0f, static_cast<float>(id), 0.0f);
+        TEST_CHECK(simulation.Spawn(params));
+    }
+    TEST_CHECK(!simulation.Spawn({}));
+    TEST_CHECK(simulation.GetAliveCount() == 4);
+
+    simulation.SetCapacity(2);
+    TEST_CHECK(simulation.GetAliveCount() == 2);
+    std::vector<Matrix4x4> matrices(2);
+    simulation.WriteInstanceMatrices({}, matrices.data(), 0, 4);
+    TEST_CHECK(matrices[0].m[3][1] == 0.0f && matrices[1].m[3][1] == 1.0f);
+
+    simulation.Clear();
+    TEST_CHECK(simulation.GetAliveCount() == 0);
+    TEST_CHECK(simulation.Spawn({}));
+}
+
+BENCHMARK_CASE(ParticleSimulation_SoAVsObjectPerParticle) {
+    // 寿命1〜2秒のパーティクルを上限まで発生させ続ける定常状態で、シミュレーションと行列の書き出しにかかる時間を比べる
+    constexpr float kDeltaTime = 1.0f / 60.0f;
+    constexpr int kFrameCount = 30;
+
+    for (const std::uint32_t count : { 1000u, 10000u, 100000u }) {
+        std::mt19937 random(count);
+        std::uniform_real_distribution<float> value(-1.0f, 1.0f);
+        std::vector<ParticleSimulation::SpawnParams> spawnParams(count * 2);
+        for (auto &params : spawnParams) {
+            params.position = Vector3(value(random), value(random), value(random));
+            params.velocity = Vector3(value(random), value(random) + 2.0f, value(random));
+            params.acceleration = Vector3(0.0f, -9.8f, 0.0f);
+            params.angularVelocity = Vector3(value(random), value(random), value(random));
+            params.lifetime = 1.5f + value(random) * 0.5f;
+        }
+        std::vector<Matrix4x4> matrices(count);
+        const std::string label = std::to_string(count / 1000) + "k";
+
+        std::size_t legacyAlive = 0;
+        std::size_t nextSpawn = 0;
+        Tests::Legacy::ObjectParticlePool pool(count);
+        const double legacyMs = Tests::MeasureMilliseconds([&]() {
+            for (int frame = 0; frame < kFrameCount; ++frame) {
+                while (pool.GetAliveCount() < count) pool.Spawn(spawnParams[nextSpawn++ % spawnParams.size()]);
+                pool.Update(kDeltaTime);
+                legacyAlive = pool.WriteInstanceMatrices(matrices.data());
+            }
+        });
+
+        std::size_t simulationAlive = 0;
+        nextSpawn = 0;
+        ParticleSimulation simulation;
+        simulation.SetCapacity(count);
+        const double simulationMs = Tests::MeasureMilliseconds([&]() {
+            for (int frame = 0; frame < kFrameCount; ++frame) {
+                while (simulation.GetAliveCount() < count) simulation.Spawn(spawnParams[nextSpawn++ % spawnParams.size()]);
+                simulation.Simulate(kDeltaTime);
+                simulation.WriteInstanceMatrices({}, matrices.data(), 0, simulation.GetAliveCount());
+                simulationAlive = simulation.GetAliveCount();
+            }
+        });
+
+        Tests::ReportBenchmark("Particles " + label + ", EmptyObject per particle (per frame)", legacyMs / kFrameCount, "ms");
+        Tests::ReportBenchmark("Particles " + label + ", ParticleSimulation (per frame)", simulationMs / kFrameCount, "ms");
+        TEST_CHECK(legacyAlive == simulationAlive);
+    }
+}
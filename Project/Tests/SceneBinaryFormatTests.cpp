@@ -0,0 +1,610 @@
+// バイナリシーン（.kscene）のテストと、JSONとの読み込み時間のベンチマーク
+//
+// シーンはScene::SaveToJSONの出力と同じ形（オブジェクトごとにTransform等のコンポーネントを持つ）を乱数で作る。
+// SceneBinary_LoadLargeScene はファイルからシーンJSONを得るまで（SceneFile::MeasureLoadMillisecondsと同じ範囲）を測り、
+// SceneBinary_LoadComponentsDirect は列形式の行をコンポーネントへ直接書き込む場合と、JSONを経由して
+// LoadFromJson で読み込む場合とを、コンポーネントの状態ができるまでの範囲で比べる。
+// 直接読み込みの比較には、DirectX等に依存しないエンジンのコンポーネント（Transform・Velocity・Rotation・Comment）を使う。
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "TestFramework.h"
+#include "TestFiles.h"
+#include "Objects/IObjectComponent.h"
+#include "Objects/Components/Comment.h"
+#include "Objects/Components/Rotation.h"
+#include "Objects/Components/Transform.h"
+#include "Objects/Components/Velocity.h"
+#include "Scene/SceneBinaryComponentLoader.h"
+#include "Scene/SceneBinaryFormat.h"
+#include "Utilities/Conversion/ConvertString.h"
+#include "Utilities/Plugin/Plugins.h"
+
+namespace KashipanEngine {
+
+/// @brief 状態が全てメンバー変数表にある（バイナリシーンから直接読み込める）テスト用コンポーネント
+class SceneBinaryTestMover final : public IObjectComponent {
+public:
+    OBJECT_COMPONENT_CONSTRUCTOR(SceneBinaryTestMover, 1, )
+    OBJECT_COMPONENT_MEMBER_VARIABLES(SceneBinaryTestMover,
+        ADD_SERIALIZED_MEMBER_VARIABLE(velocity_, { .serializedKey = "velocity" }, [](auto &self) { ++self.modifiedCount_; });
+        ADD_SERIALIZED_MEMBER_VARIABLE(color_, { .serializedKey = "color" }, [](auto &self) { ++self.modifiedCount_; });
+        ADD_SERIALIZED_MEMBER_VARIABLE(speed_, { .serializedKey = "speed" });
+        ADD_SERIALIZED_MEMBER_VARIABLE(count_, { .serializedKey = "count" });
+        ADD_SERIALIZED_MEMBER_VARIABLE(enabled_, { .serializedKey = "enabled" });
+        ADD_SERIALIZED_MEMBER_VARIABLE(label_, { .serializedKey = "label" });
+        MEMBER_VARIABLES_COVER_ALL_STATE();
+    )
+
+    std::unique_ptr<IObjectComponent> Clone() const override { return CloneByMemberVariables<SceneBinaryTestMover>(); }
+
+    JSON Save() const { return SaveToJson(); }
+    bool Load(const JSON &json) { return LoadFromJson(json); }
+    int GetModifiedCount() const { return modifiedCount_; }
+
+private:
+    Vector3 velocity_{ 0.0f, 0.0f, 0.0f };
+    Color color_{ 1.0f, 1.0f, 1.0f, 1.0f };
+    float speed_ = 1.0f;
+    std::int32_t count_ = 0;
+    bool enabled_ = true;
+    std::string label_ = "mover";
+    int modifiedCount_ = 0;
+};
+
+REGISTER_COMPONENT_OBJECT(SceneBinaryTestMover)
+
+/// @brief 保存・読み込みを独自に実装する（JSONを経由して読み込む）テスト用コンポーネント
+class SceneBinaryTestCustom final : public IObjectComponent {
+public:
+    OBJECT_COMPONENT_CONSTRUCTOR(SceneBinaryTestCustom, 1, )
+
+    std::unique_ptr<IObjectComponent> Clone() const override { return std::make_unique<SceneBinaryTestCustom>(); }
+};
+
+REGISTER_COMPONENT_OBJECT(SceneBinaryTestCustom)
+
+} // namespace KashipanEngine
+
+using KashipanEngine::JSON;
+using KashipanEngine::SceneBinaryColumnKind;
+using KashipanEngine::SceneBinaryComponentLoader;
+using KashipanEngine::SceneBinaryReader;
+using KashipanEngine::SceneBinaryTestMover;
+using KashipanEngine::Transform;
+
+namespace {
+
+/// @brief 一時ファイルを置くフォルダ（KashipanEngineTests 内）
+constexpr const char *kTemporaryFolder = "SceneBinary";
+
+/// @brief UUID128の文字列表現と同じ長さ・形のID
+std::string MakeObjectID(std::mt19937_64 &random) {
+    char text[40] = {};
+    std::snprintf(text, sizeof(text), "%016llx-%016llx",
+        static_cast<unsigned long long>(random()), static_cast<unsigned long long>(random()));
+    return text;
+}
+
+JSON MakeVector3(std::mt19937_64 &random) {
+    std::uniform_real_distribution<float> value(-100.0f, 100.0f);
+    return JSON{ { "x", value(random) }, { "y", value(random) }, { "z", value(random) } };
+}
+
+/// @brief Transform::SaveToJson と同じ data（回転はクォータニオン、親が無い場合は空文字）
+JSON MakeTransformData(std::mt19937_64 &random, const std::string &parent) {
+    std::uniform_real_distribution<float> angle(-3.0f, 3.0f);
+    const Quaternion rotate = Quaternion::MakeRotateEuler(Vector3(angle(random), angle(random), angle(random)));
+    return {
+        { "translate", MakeVector3(random) },
+        { "rotate", KashipanEngine::ToJSON(rotate) },
+        { "scale", { { "x", 1.0 }, { "y", 1.0 }, { "z", 1.0 } } },
+        { "parent", parent },
+    };
+}
+
+JSON MakeComponent(const std::string &type, JSON customData) {
+    return JSON{
+        { "type", type },
+        { "data", { { "priority", 1 }, { "isActive", true }, { "tag", "" }, { "customData", std::move(customData) } } },
+    };
+}
+
+/// @brief Scene::SaveToJSONの出力と同じ形のシーン（オブジェクトあたり2～4コンポーネント）
+JSON MakeScene(std::size_t objectCount, std::uint64_t seed) {
+    std::mt19937_64 random(seed);
+    std::vector<std::string> objectIDs;
+    objectIDs.reserve(objectCount);
+
+    JSON objects = JSON::array();
+    for (std::size_t i = 0; i < objectCount; ++i) {
+        objectIDs.push_back(MakeObjectID(random));
+        // 半分ほどは既に作ったオブジェクトを親にする
+        const std::string parent = (i > 0 && random() % 2 == 0) ? objectIDs[random() % i] : std::string();
+
+        JSON components = JSON::array();
+        components.push_back(MakeComponent("Transform", MakeTransformData(random, parent)));
+        components.push_back(MakeComponent("MeshRenderer", {
+            { "modelPath", "Assets/Models/Prop" + std::to_string(random() % 32) + ".gltf" },
+            { "castShadow", random() % 2 == 0 },
+            { "materials", JSON::array({ { { "name", "Default" }, { "color", { 1.0, 1.0, 1.0, 1.0 } } } }) },
+        }));
+        if (random() % 2 == 0) {
+            components.push_back(MakeComponent("BoxCollider", {
+                { "size", MakeVector3(random) },
+                { "layer", static_cast<int>(random() % 8) },
+            }));
+        }
+        if (random() % 4 == 0) {
+            components.push_back(MakeComponent("Script", {
+                { "scriptPath", "Assets/Scripts/Enemy.as" },
+                { "hp", static_cast<int>(random() % 100) },
+            }));
+        }
+
+        objects.push_back({
+            { "name", "Object" + std::to_string(i) },
+            { "tag", "" },
+            { "isActive", true },
+            { "editorOnly", false },
+            { "objectID", objectIDs.back() },
+            { "prefabNodeID", "" },
+            { "components", std::move(components) },
+        });
+    }
+
+    return JSON{
+        { "sceneName", "BenchmarkScene" },
+        { "sceneComponents", JSON::array({ { { "type", "LightManager" }, { "data", JSON::object() } } }) },
+        { "sceneObjects", std::move(objects) },
+    };
+}
+
+JSON DecodeBytes(const std::vector<std::uint8_t> &bytes) {
+    SceneBinaryReader reader;
+    if (!reader.Open(bytes.data(), bytes.size())) return JSON();
+    return reader.DecodeScene();
+}
+
+std::optional<std::uint32_t> FindTypeIndex(const SceneBinaryReader &reader, std::string_view typeName) {
+    for (std::uint32_t i = 0; i < reader.GetComponentTypeCount(); ++i) {
+        if (reader.GetComponentTypeName(i) == typeName) return i;
+    }
+    return std::nullopt;
+}
+
+/// @brief コンポーネントの LoadFromJson（protected）を、EmptyObject::LoadFromJson と同じく外から呼ぶ
+struct ComponentJsonAccess : KashipanEngine::IObjectComponent {
+    static bool Load(IObjectComponent &component, const JSON &customData) {
+        return (component.*(&ComponentJsonAccess::LoadFromJson))(customData);
+    }
+};
+
+/// @brief オブジェクトごとに1つずつ、指定した data のコンポーネントを持つシーン
+JSON MakeSceneOfComponents(const std::string &type, const std::vector<JSON> &datas) {
+    JSON objects = JSON::array();
+    for (std::size_t i = 0; i < datas.size(); ++i) {
+        objects.push_back({
+            { "name", "Object" + std::to_string(i) },
+            { "objectID", "object-" + std::to_string(i) },
+            { "components", JSON::array({ { { "type", type }, { "data", datas[i] } } }) },
+        });
+    }
+    return JSON{ { "sceneName", "ComponentScene" }, { "sceneObjects", std::move(objects) } };
+}
+
+/// @brief EmptyObject::SaveToJson が SceneBinaryTestMover に書き出すのと同じ data
+JSON MakeMoverData(std::mt19937_64 &random, std::size_t index) {
+    std::uniform_real_distribution<float> value(-10.0f, 10.0f);
+    return {
+        { "priority", static_cast<int>(index % 5) },
+        { "isActive", index % 3 != 0 },
+        { "tag", index % 2 == 0 ? "Enemy" : "" },
+        { "customData", {
+            { "velocity", MakeVector3(random) },
+            { "color", { { "r", value(random) }, { "g", value(random) }, { "b", value(random) }, { "a", 1.0f } } },
+            { "speed", value(random) },
+            { "count", static_cast<std::int32_t>(random() % 1000) - 500 },
+            { "enabled", random() % 2 == 0 },
+            { "label", "Mover" + std::to_string(random() % 16) },
+        } },
+    };
+}
+
+} // namespace
+
+TEST_CASE(SceneBinary_RoundTripIsLossless) {
+    JSON scene = MakeScene(200, 1);
+    // 数値の型（符号付き/なし整数・floatに収まらない浮動小数）と端の値も保たれる
+    scene["settings"] = {
+        { "negative", -12345678901234LL },
+        { "unsigned", std::numeric_limits<std::uint64_t>::max() },
+        { "precise", 0.1 },
+        { "tiny", std::numeric_limits<double>::denorm_min() },
+        { "empty", JSON::object() },
+        { "nothing", nullptr },
+    };
+    for (const bool compress : { false, true }) {
+        const JSON decoded = DecodeBytes(KashipanEngine::EncodeSceneBinary(scene, compress));
+        TEST_CHECK_MESSAGE(decoded == scene, compress ? "compressed" : "uncompressed");
+        TEST_CHECK(decoded["settings"]["unsigned"].is_number_unsigned());
+        TEST_CHECK(decoded["settings"]["negative"].is_number_integer());
+    }
+
+    // sceneObjects を持たないJSONもそのまま戻る
+    const JSON notScene = JSON::array({ 1, "two", 3.5 });
+    TEST_CHECK(DecodeBytes(KashipanEngine::EncodeSceneBinary(notScene)) == notScene);
+}
+
+TEST_CASE(SceneBinary_FindObjectByID) {
+    const JSON scene = MakeScene(500, 2);
+    const auto bytes = KashipanEngine::EncodeSceneBinary(scene);
+    SceneBinaryReader reader;
+    TEST_CHECK(reader.Open(bytes.data(), bytes.size()));
+    TEST_CHECK(reader.GetObjectCount() == 500);
+
+    for (const std::size_t index : { std::size_t{ 0 }, std::size_t{ 123 }, std::size_t{ 499 } }) {
+        const auto &object = scene["sceneObjects"][index];
+        const auto found = reader.FindObjectIndex(object["objectID"].get<std::string>());
+        TEST_CHECK(found.has_value() && *found == index);
+        if (found) TEST_CHECK(reader.DecodeObject(*found) == object);
+    }
+    TEST_CHECK(!reader.FindObjectIndex("missing").has_value());
+}
+
+TEST_CASE(SceneBinary_CorruptedDataIsRejected) {
+    const JSON scene = MakeScene(50, 3);
+    for (const bool compress : { false, true }) {
+        auto bytes = KashipanEngine::EncodeSceneBinary(scene, compress);
+        bytes[bytes.size() / 2] ^= 0x5A;
+        SceneBinaryReader reader;
+        TEST_CHECK(!reader.Open(bytes.data(), bytes.size()));
+        TEST_CHECK(DecodeBytes(bytes).is_null());
+    }
+}
+
+TEST_CASE(SceneBinary_UncompressedFileIsMapped) {
+    // 既定（非圧縮）で保存したファイルは展開せずにメモリマップを直接参照し、圧縮したファイルは展開して参照する
+    const JSON scene = MakeScene(100, 4);
+    const std::string mappedPath = Tests::GetTemporaryPath(kTemporaryFolder, "Mapped.kscene");
+    const std::string compressedPath = Tests::GetTemporaryPath(kTemporaryFolder, "Compressed.kscene");
+    TEST_CHECK(Tests::WriteBytes(mappedPath, KashipanEngine::EncodeSceneBinary(scene)));
+    TEST_CHECK(Tests::WriteBytes(compressedPath, KashipanEngine::EncodeSceneBinary(scene, true)));
+
+    SceneBinaryReader mapped;
+    TEST_CHECK(mapped.OpenFile(mappedPath));
+    TEST_CHECK(mapped.IsMapped());
+    TEST_CHECK(mapped.DecodeScene() == scene);
+
+    SceneBinaryReader compressed;
+    TEST_CHECK(compressed.OpenFile(compressedPath));
+    TEST_CHECK(!compressed.IsMapped());
+    TEST_CHECK(compressed.DecodeScene() == scene);
+}
+
+TEST_CASE(SceneBinary_ColumnarTypesRoundTrip) {
+    // data のキーと値の種類が揃う種別は列形式になり、配列を含む種別はコンポーネントごとに格納される
+    const JSON scene = MakeScene(300, 5);
+    SceneBinaryReader reader;
+    const auto bytes = KashipanEngine::EncodeSceneBinary(scene);
+    TEST_CHECK(reader.Open(bytes.data(), bytes.size()));
+    const auto transform = FindTypeIndex(reader, "Transform");
+    const auto meshRenderer = FindTypeIndex(reader, "MeshRenderer");
+    TEST_CHECK(transform && meshRenderer);
+    if (!transform || !meshRenderer) return;
+    TEST_CHECK(reader.IsColumnarType(*transform));
+    TEST_CHECK(!reader.IsColumnarType(*meshRenderer));
+    TEST_CHECK(reader.GetColumns(*meshRenderer).empty());
+
+    // 列はキー順の深さ優先で並ぶ（customData.parent, customData.rotate.w, ..., isActive, priority, tag）
+    const auto columns = reader.GetColumns(*transform);
+    TEST_CHECK(columns.size() == 14);
+    if (columns.size() == 14) {
+        TEST_CHECK(columns[0].path.size() == 2 && columns[0].path[1] == "parent" && columns[0].kind == SceneBinaryColumnKind::String);
+        TEST_CHECK(columns[1].path.size() == 3 && columns[1].path[1] == "rotate" && columns[1].path[2] == "w");
+        TEST_CHECK(columns[1].kind == SceneBinaryColumnKind::Float32);
+        TEST_CHECK(columns[13].path.size() == 1 && columns[13].path[0] == "tag");
+    }
+    for (std::uint32_t i = 0; i < reader.GetComponentCount(); ++i) {
+        const bool isColumnar = reader.GetComponentTypeIndex(i) != meshRenderer;
+        TEST_CHECK((reader.GetComponentRow(i) != nullptr) == isColumnar);
+    }
+
+    // 列の中で整数の符号の有無・float に収まるかが混在しても、値ごとの型が保たれる
+    std::vector<JSON> mixed;
+    for (int i = 0; i < 40; ++i) {
+        JSON data = { { "ratio", i % 3 == 0 ? 0.1 : 0.5 }, { "flag", i % 2 == 0 }, { "name", "n" + std::to_string(i % 4) } };
+        if (i % 2 == 0) {
+            data["value"] = static_cast<std::uint64_t>(i) * 1000000000000ull;
+        } else {
+            data["value"] = -static_cast<std::int64_t>(i);
+        }
+        data["small"] = static_cast<std::uint32_t>(i);
+        data["nested"] = { { "empty", JSON::object() }, { "nothing", nullptr } };
+        mixed.push_back(std::move(data));
+    }
+    const JSON mixedScene = MakeSceneOfComponents("Mixed", mixed);
+    for (const bool compress : { false, true }) {
+        const auto mixedBytes = KashipanEngine::EncodeSceneBinary(mixedScene, compress);
+        SceneBinaryReader mixedReader;
+        TEST_CHECK(mixedReader.Open(mixedBytes.data(), mixedBytes.size()));
+        TEST_CHECK(mixedReader.IsColumnarType(0));
+        const JSON decoded = mixedReader.DecodeScene();
+        TEST_CHECK(decoded == mixedScene);
+        if (decoded != mixedScene) continue;
+        for (int i = 0; i < 40; ++i) {
+            const auto &value = decoded["sceneObjects"][i]["components"][0]["data"]["value"];
+            TEST_CHECK(value.is_number_unsigned() == (i % 2 == 0));
+        }
+    }
+
+    // 一部のコンポーネントだけキーが違う種別は、列形式にせずに元へ戻す
+    std::vector<JSON> ragged = { { { "a", 1 } }, { { "a", 2 } }, { { "b", 3 } } };
+    const JSON raggedScene = MakeSceneOfComponents("Ragged", ragged);
+    const auto raggedBytes = KashipanEngine::EncodeSceneBinary(raggedScene);
+    SceneBinaryReader raggedReader;
+    TEST_CHECK(raggedReader.Open(raggedBytes.data(), raggedBytes.size()));
+    TEST_CHECK(!raggedReader.IsColumnarType(0));
+    TEST_CHECK(raggedReader.DecodeScene() == raggedScene);
+}
+
+TEST_CASE(SceneBinary_DirectLoadMatchesJsonLoad) {
+    std::mt19937_64 random(6);
+    std::vector<JSON> datas;
+    for (std::size_t i = 0; i < 64; ++i) datas.push_back(MakeMoverData(random, i));
+    // メンバー変数に無いキー・要素は LoadFromJson と同じく無視する
+    for (auto &data : datas) {
+        data["customData"]["legacy"] = 1;
+        data["customData"]["velocity"]["w"] = 0.0;
+    }
+    const JSON scene = MakeSceneOfComponents("SceneBinaryTestMover", datas);
+
+    const auto bytes = KashipanEngine::EncodeSceneBinary(scene);
+    SceneBinaryReader reader;
+    TEST_CHECK(reader.Open(bytes.data(), bytes.size()));
+    const SceneBinaryComponentLoader loader(reader);
+    TEST_CHECK(reader.GetComponentCount() == datas.size());
+    for (std::uint32_t i = 0; i < reader.GetComponentCount(); ++i) {
+        const auto typeID = loader.FindDirectTypeID(i);
+        TEST_CHECK(typeID.has_value() && *typeID == KashipanEngine::IObjectComponent::GetComponentTypeID<SceneBinaryTestMover>());
+        const JSON component = reader.DecodeComponent(i);
+        const JSON &data = component["data"];
+
+        SceneBinaryTestMover direct;
+        TEST_CHECK(loader.LoadDirect(i, direct));
+        SceneBinaryTestMover viaJson;
+        TEST_CHECK(viaJson.Load(data["customData"]));
+        TEST_CHECK_MESSAGE(direct.Save() == viaJson.Save(), "component " + std::to_string(i));
+        TEST_CHECK(direct.GetUpdatePriority() == data["priority"].get<int>());
+        TEST_CHECK(direct.GetTagName() == data["tag"].get<std::string>());
+        // 書き込み後コールバックは変数ごとに1回（Vector3・Color の要素ごとではない）
+        TEST_CHECK(direct.GetModifiedCount() == viaJson.GetModifiedCount() && direct.GetModifiedCount() == 2);
+    }
+
+    // ファイルに無い変数は変更せず、優先度・タグは LoadFromJsonInterface と同じ既定値になる
+    const JSON partialScene = MakeSceneOfComponents("SceneBinaryTestMover", { { { "customData", { { "speed", 3 } } } } });
+    const auto partialBytes = KashipanEngine::EncodeSceneBinary(partialScene);
+    SceneBinaryReader partialReader;
+    TEST_CHECK(partialReader.Open(partialBytes.data(), partialBytes.size()));
+    const SceneBinaryComponentLoader partialLoader(partialReader);
+    SceneBinaryTestMover partial;
+    TEST_CHECK(partialLoader.FindDirectTypeID(0).has_value() && partialLoader.LoadDirect(0, partial));
+    SceneBinaryTestMover expected;
+    TEST_CHECK(expected.Load(partialScene["sceneObjects"][0]["components"][0]["data"]["customData"]));
+    TEST_CHECK(partial.Save() == expected.Save() && partial.Save()["speed"].get<float>() == 3.0f);
+    TEST_CHECK(partial.GetUpdatePriority() == 1 && partial.GetTagName().empty() && partial.GetModifiedCount() == 0);
+}
+
+TEST_CASE(SceneBinary_TransformDirectLoadMatchesJsonLoad) {
+    // Transform は保存・読み込みを独自に実装しているが、列（translate・rotate・scale の要素と parent）を直接読み込む
+    std::mt19937_64 random(8);
+    std::vector<JSON> datas;
+    std::vector<std::string> objectIDs;
+    for (std::size_t i = 0; i < 64; ++i) {
+        objectIDs.push_back(MakeObjectID(random));
+        const std::string parent = (i > 0 && i % 2 == 0) ? objectIDs[random() % i] : std::string();
+        JSON data = { { "priority", static_cast<int>(i % 3) }, { "isActive", i % 5 != 0 }, { "tag", "" },
+            { "customData", MakeTransformData(random, parent) } };
+        datas.push_back(std::move(data));
+    }
+    const JSON scene = MakeSceneOfComponents("Transform", datas);
+
+    const auto bytes = KashipanEngine::EncodeSceneBinary(scene);
+    SceneBinaryReader reader;
+    TEST_CHECK(reader.Open(bytes.data(), bytes.size()));
+    TEST_CHECK(reader.IsColumnarType(0));
+    const SceneBinaryComponentLoader loader(reader);
+    for (std::uint32_t i = 0; i < reader.GetComponentCount(); ++i) {
+        const auto typeID = loader.FindDirectTypeID(i);
+        TEST_CHECK(typeID.has_value() && *typeID == KashipanEngine::IObjectComponent::GetComponentTypeID<Transform>());
+        const JSON &data = datas[i];
+
+        Transform direct;
+        TEST_CHECK(loader.LoadDirect(i, direct));
+        Transform viaJson;
+        TEST_CHECK(viaJson.LoadFromJson(data["customData"]));
+        const std::string message = "component " + std::to_string(i);
+        TEST_CHECK_MESSAGE(direct.GetTranslate() == viaJson.GetTranslate(), message);
+        TEST_CHECK_MESSAGE(direct.GetRotate() == viaJson.GetRotate(), message);
+        TEST_CHECK_MESSAGE(direct.GetScale() == viaJson.GetScale(), message);
+        const Quaternion &directRotate = direct.GetRotateQuaternion();
+        const Quaternion &jsonRotate = viaJson.GetRotateQuaternion();
+        TEST_CHECK_MESSAGE(directRotate.x == jsonRotate.x && directRotate.y == jsonRotate.y &&
+            directRotate.z == jsonRotate.z && directRotate.w == jsonRotate.w, message);
+        TEST_CHECK(direct.GetUpdatePriority() == data["priority"].get<int>());
+        TEST_CHECK(direct.IsActive() == data["isActive"].get<bool>());
+        // 所属シーンが無いため、親はどちらも解決されずに空文字で保存される
+        TEST_CHECK(direct.SaveToJson() == viaJson.SaveToJson());
+    }
+
+    // 親の無い Transform も parent を書き出し、全てのTransformのキーが揃う（列形式になる）
+    const Transform root;
+    const JSON saved = root.SaveToJson();
+    TEST_CHECK(saved.contains("parent") && saved["parent"] == "");
+
+    // rotate が Vector3（古い形式）のように要素が欠けている場合は、JSONを経由させる
+    JSON legacy = datas[0];
+    legacy["customData"]["rotate"] = MakeVector3(random);
+    const JSON legacyScene = MakeSceneOfComponents("Transform", { legacy });
+    const auto legacyBytes = KashipanEngine::EncodeSceneBinary(legacyScene);
+    SceneBinaryReader legacyReader;
+    TEST_CHECK(legacyReader.Open(legacyBytes.data(), legacyBytes.size()));
+    const SceneBinaryComponentLoader legacyLoader(legacyReader);
+    TEST_CHECK(!legacyLoader.FindDirectTypeID(0).has_value());
+}
+
+TEST_CASE(SceneBinary_DirectLoadFallsBackToJson) {
+    // メンバー変数の型と合わない値・要素が欠けた値・独自に読み込む型・未登録の型は、JSONを経由させる
+    auto expectFallback = [](const std::string &type, const JSON &customData, const char *what) {
+        const JSON scene = MakeSceneOfComponents(type, { { { "priority", 1 }, { "customData", customData } } });
+        const auto bytes = KashipanEngine::EncodeSceneBinary(scene);
+        SceneBinaryReader reader;
+        TEST_CHECK(reader.Open(bytes.data(), bytes.size()));
+        TEST_CHECK_MESSAGE(reader.IsColumnarType(0), what);
+        const SceneBinaryComponentLoader loader(reader);
+        TEST_CHECK_MESSAGE(!loader.FindDirectTypeID(0).has_value(), what);
+        SceneBinaryTestMover mover;
+        TEST_CHECK_MESSAGE(!loader.LoadDirect(0, mover), what);
+        TEST_CHECK_MESSAGE(reader.DecodeComponent(0) == scene["sceneObjects"][0]["components"][0], what);
+    };
+    expectFallback("SceneBinaryTestMover", { { "velocity", 1.0 } }, "scalar for Vector3");
+    expectFallback("SceneBinaryTestMover", { { "velocity", { { "x", 1.0 }, { "y", 2.0 } } } }, "missing field");
+    expectFallback("SceneBinaryTestMover", { { "speed", "fast" } }, "string for float");
+    expectFallback("SceneBinaryTestMover", { { "enabled", 1 } }, "number for bool");
+    expectFallback("SceneBinaryTestCustom", { { "value", 1 } }, "custom serialization");
+    expectFallback("Unregistered", { { "value", 1 } }, "unregistered type");
+}
+
+BENCHMARK_CASE(SceneBinary_LoadComponentsDirect) {
+    Plugin::JobSystem jobSystem(Plugin::JobSystem::GetDefaultWorkerCount());
+    const Tests::ScopedJobSystem scopedJobSystem(&jobSystem);
+
+    // 全オブジェクトが Transform・Velocity を持ち、半分が Rotation、4分の1が Comment を持つシーン
+    constexpr std::size_t kObjectCount = 50000;
+    std::mt19937_64 random(7);
+    std::uniform_real_distribution<float> value(-10.0f, 10.0f);
+    std::vector<std::string> objectIDs;
+    objectIDs.reserve(kObjectCount);
+    JSON objects = JSON::array();
+    for (std::size_t i = 0; i < kObjectCount; ++i) {
+        objectIDs.push_back(MakeObjectID(random));
+        const std::string parent = (i > 0 && random() % 2 == 0) ? objectIDs[random() % i] : std::string();
+        JSON components = JSON::array();
+        components.push_back(MakeComponent("Transform", MakeTransformData(random, parent)));
+        components.push_back(MakeComponent("Velocity", { { "velocity", MakeVector3(random) }, { "acceleration", MakeVector3(random) } }));
+        if (i % 2 == 0) {
+            components.push_back(MakeComponent("Rotation", { { "angularVelocity", MakeVector3(random) }, { "angularAcceleration", MakeVector3(random) } }));
+        }
+        if (i % 4 == 0) {
+            components.push_back(MakeComponent("Comment", { { "comment", "Comment" + std::to_string(random() % 16) } }));
+        }
+        objects.push_back({ { "name", "Object" + std::to_string(i) }, { "objectID", objectIDs.back() }, { "components", std::move(components) } });
+    }
+    const JSON scene = { { "sceneName", "ComponentScene" }, { "sceneObjects", std::move(objects) } };
+    const std::string path = Tests::GetTemporaryPath(kTemporaryFolder, "BenchmarkComponents.kscene");
+    TEST_CHECK(Tests::WriteBytes(path, KashipanEngine::EncodeSceneBinary(scene)));
+
+    // コンポーネントの構築（エンジンではプールへのデフォルト構築）は両方に共通のため、測定から除く
+    std::vector<Transform> transforms(kObjectCount);
+    std::vector<KashipanEngine::Velocity> velocities(kObjectCount);
+    std::vector<KashipanEngine::Rotation> rotations(kObjectCount / 2);
+    std::vector<KashipanEngine::Comment> comments(kObjectCount / 4);
+    std::vector<KashipanEngine::IObjectComponent *> targets;
+    for (std::size_t i = 0; i < kObjectCount; ++i) {
+        targets.push_back(&transforms[i]);
+        targets.push_back(&velocities[i]);
+        if (i % 2 == 0) targets.push_back(&rotations[i / 2]);
+        if (i % 4 == 0) targets.push_back(&comments[i / 4]);
+    }
+
+    bool isLoaded = true;
+    const double viaJsonMs = Tests::MeasureBestMilliseconds(3, [&]() {
+        SceneBinaryReader reader;
+        isLoaded = reader.OpenFile(path) && isLoaded;
+        const JSON decoded = reader.DecodeScene();
+        std::size_t target = 0;
+        for (const auto &object : decoded["sceneObjects"]) {
+            for (const auto &component : object["components"]) {
+                isLoaded = ComponentJsonAccess::Load(*targets[target++], component["data"]["customData"]) && isLoaded;
+            }
+        }
+    });
+    std::size_t directCount = 0;
+    const double directMs = Tests::MeasureBestMilliseconds(3, [&]() {
+        SceneBinaryReader reader;
+        isLoaded = reader.OpenFile(path) && isLoaded;
+        const SceneBinaryComponentLoader loader(reader);
+        std::size_t target = 0;
+        directCount = 0;
+        for (std::uint32_t i = 0; i < kObjectCount; ++i) {
+            for (std::uint32_t slot = 0, count = reader.GetObjectComponentCount(i); slot < count; ++slot) {
+                const auto componentIndex = reader.GetObjectComponentIndex(i, slot);
+                const bool isDirect = componentIndex && loader.FindDirectTypeID(*componentIndex).has_value();
+                isLoaded = isDirect && loader.LoadDirect(*componentIndex, *targets[target++]) && isLoaded;
+                directCount += isDirect ? 1 : 0;
+            }
+        }
+    });
+    // 全ての種別（Transform を含む）が直接読み込まれる
+    TEST_CHECK(isLoaded && directCount == targets.size());
+    const std::string label = "50k objects (" + std::to_string(targets.size()) + " engine components)";
+    Tests::ReportBenchmark(label + ", DecodeScene + LoadFromJson", viaJsonMs, "ms");
+    Tests::ReportBenchmark(label + ", direct from columns", directMs, "ms");
+    Tests::ReportBenchmark(label + " speedup (direct / json)", viaJsonMs / directMs, "x");
+}
+
+BENCHMARK_CASE(SceneBinary_LoadLargeScene) {
+    // エンジンと同じく、デコードはジョブシステムで並列に行う
+    Plugin::JobSystem jobSystem(Plugin::JobSystem::GetDefaultWorkerCount());
+    const Tests::ScopedJobSystem scopedJobSystem(&jobSystem);
+
+    for (const std::size_t objectCount : { std::size_t{ 5000 }, std::size_t{ 50000 } }) {
+        const JSON scene = MakeScene(objectCount, objectCount);
+        const std::string label = std::to_string(objectCount) + " objects";
+        const std::string jsonPath = Tests::GetTemporaryPath(kTemporaryFolder, "Benchmark.json");
+        const std::string mappedPath = Tests::GetTemporaryPath(kTemporaryFolder, "Benchmark.kscene");
+        const std::string compressedPath = Tests::GetTemporaryPath(kTemporaryFolder, "BenchmarkCompressed.kscene");
+        {
+            std::ofstream file(KashipanEngine::Utf8StringToPath(jsonPath), std::ios::trunc);
+            file << scene.dump(4);
+        }
+        const auto mappedBytes = KashipanEngine::EncodeSceneBinary(scene);
+        const auto compressedBytes = KashipanEngine::EncodeSceneBinary(scene, true);
+        TEST_CHECK(Tests::WriteBytes(mappedPath, mappedBytes));
+        TEST_CHECK(Tests::WriteBytes(compressedPath, compressedBytes));
+        Tests::ReportBenchmark(label + " json size", std::filesystem::file_size(KashipanEngine::Utf8StringToPath(jsonPath)) / 1048576.0, "MB");
+        Tests::ReportBenchmark(label + " kscene size", mappedBytes.size() / 1048576.0, "MB");
+        Tests::ReportBenchmark(label + " kscene (compressed) size", compressedBytes.size() / 1048576.0, "MB");
+
+        bool isLoaded = true;
+        const double jsonMs = Tests::MeasureBestMilliseconds(3, [&]() {
+            isLoaded = KashipanEngine::LoadJSON(jsonPath).is_object() && isLoaded;
+        });
+        // 開くだけ（メモリマップ・チェックサム・文字列表の検証）と、シーンJSONの組み立てまでを分けて測る
+        const double mappedOpenMs = Tests::MeasureBestMilliseconds(3, [&]() {
+            SceneBinaryReader reader;
+            isLoaded = reader.OpenFile(mappedPath) && isLoaded;
+        });
+        const double mappedMs = Tests::MeasureBestMilliseconds(3, [&]() {
+            SceneBinaryReader reader;
+            isLoaded = reader.OpenFile(mappedPath) && reader.DecodeScene().is_object() && isLoaded;
+        });
+        const double compressedMs = Tests::MeasureBestMilliseconds(3, [&]() {
+            SceneBinaryReader reader;
+            isLoaded = reader.OpenFile(compressedPath) && reader.DecodeScene().is_object() && isLoaded;
+        });
+        TEST_CHECK(isLoaded);
+        Tests::ReportBenchmark(label + " json", jsonMs, "ms");
+        Tests::ReportBenchmark(label + " kscene open only", mappedOpenMs, "ms");
+        Tests::ReportBenchmark(label + " kscene", mappedMs, "ms");
+        Tests::ReportBenchmark(label + " kscene (compressed)", compressedMs, "ms");
+        Tests::ReportBenchmark(label + " speedup (kscene / json)", jsonMs / mappedMs, "x");
+    }
+}
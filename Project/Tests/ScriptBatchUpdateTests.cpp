@@ -0,0 +1,232 @@
+// ScriptComponent の一括更新（UpdateBatch → EndBatchUpdate、RemoveFromBatchQueue）のテスト
+//
+// ScriptComponent 本体はウィンドウ系コンポーネント等を通してDirectXに依存するため、同じ一括更新の宣言
+// （IsBatchProcessed・GetBatchUpdatePriority・GetBatchUpdateOrder の値）と同じ待ち行列の操作（ComponentBatchQueueSlot・
+// GroupComponentBatchQueue・DrainComponentBatchQueue）を使うテスト用のコンポーネントを、実際の ComponentPool で動かす。
+// - Scene の更新順（RunComponentBatchStages）で、全オブジェクトの個別更新より先に実行されること
+// - 同じモジュールのインスタンスが、プールの走査順を保ったまま連続して実行されること
+// - 実行中に削除されたインスタンスは待ち行列の要素が nullptr に置き換えられ、飛ばされること
+// - 例外で一括更新を抜けた後に残った位置が、次のフレームの別の要素を消さないこと
+
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "TestFramework.h"
+#include "Objects/ComponentPool.h"
+#include "Objects/IObjectComponent.h"
+
+namespace KashipanEngine {
+
+/// @brief ScriptComponent と同じ一括更新を行うテスト用コンポーネント
+/// @details モジュール（ScriptModuleCache::Entry）の代わりに整数の moduleId でまとめる。
+///          ScriptComponent.h はコンポーネントの登録（REGISTER_COMPONENT_OBJECT）で本体の定義を参照するため含めず、
+///          一括更新の宣言は ScriptComponent と同じ値をここに書く
+class ScriptBatchTestComponent final : public IObjectComponent {
+public:
+    static constexpr bool IsBatchProcessed() { return true; }
+    static constexpr int GetBatchUpdatePriority() { return std::numeric_limits<int>::min(); }
+    static constexpr int GetBatchUpdateOrder() { return -100; }
+
+    OBJECT_COMPONENT_CONSTRUCTOR(ScriptBatchTestComponent, 0xFF, )
+
+    std::unique_ptr<IObjectComponent> Clone() const override { return std::make_unique<ScriptBatchTestComponent>(); }
+
+    void UpdateBatch(Passkey<ComponentPool<ScriptBatchTestComponent>>, ComponentBatchQueue<ScriptBatchTestComponent> &queue, const ComponentBatchContext &) {
+        batchQueueSlot_.Push(queue, this);
+    }
+
+    static void EndBatchUpdate(Passkey<ComponentPool<ScriptBatchTestComponent>>, ComponentBatchQueue<ScriptBatchTestComponent> &queue, const ComponentBatchContext &) {
+        const auto slotOf = [](ScriptBatchTestComponent &component) -> ComponentBatchQueueSlot<ScriptBatchTestComponent> & { return component.batchQueueSlot_; };
+        GroupComponentBatchQueue(queue, [](const ScriptBatchTestComponent &component) { return component.moduleId; }, slotOf);
+        DrainComponentBatchQueue(queue, slotOf, [](ScriptBatchTestComponent &component) {
+            if (component.IsActive()) component.UpdateFrame();
+        });
+    }
+
+    /// @brief ScriptComponent::Finalize と同じく、破棄・無効化の前に待ち行列から外す
+    void RemoveFromBatchQueue() { batchQueueSlot_.Remove(this); }
+    bool IsInBatchQueue() const noexcept { return batchQueueSlot_.IsQueued(); }
+
+    int id = 0;
+    int moduleId = 0;
+    /// @brief 実行順の記録先
+    std::vector<int> *log = nullptr;
+    /// @brief 実行時の追加の処理（スクリプトから他のオブジェクトを削除する場合等）
+    std::function<void(ScriptBatchTestComponent &)> onUpdate;
+
+private:
+    void UpdateFrame() {
+        if (log) log->push_back(id);
+        if (onUpdate) onUpdate(*this);
+    }
+
+    ComponentBatchQueueSlot<ScriptBatchTestComponent> batchQueueSlot_;
+};
+
+} // namespace KashipanEngine
+
+using KashipanEngine::ComponentBatchContext;
+using KashipanEngine::ComponentPool;
+using KashipanEngine::IComponentPoolBase;
+using KashipanEngine::ScriptBatchTestComponent;
+
+namespace {
+
+/// @brief 積んだ順の moduleId を持つコンポーネントをプールへ作る
+std::vector<ScriptBatchTestComponent *> EmplaceComponents(ComponentPool<ScriptBatchTestComponent> &pool,
+    const std::vector<int> &moduleIds, std::vector<int> &log) {
+    std::vector<ScriptBatchTestComponent *> components;
+    for (size_t i = 0; i < moduleIds.size(); ++i) {
+        auto *component = pool.Emplace();
+        component->id = static_cast<int>(i);
+        component->moduleId = moduleIds[i];
+        component->log = &log;
+        components.push_back(component);
+    }
+    return components;
+}
+
+/// @brief 一括更新の優先度だけを持つ、他の型のプールの代わり
+class PriorityOnlyPool final : public IComponentPoolBase {
+public:
+    PriorityOnlyPool(int priority, std::string name, std::vector<std::string> &log) : priority_(priority), name_(std::move(name)), log_(log) {}
+    KashipanEngine::IObjectComponent *EmplaceDefault() override { return nullptr; }
+    bool Remove(const KashipanEngine::IObjectComponent *) override { return false; }
+    bool Owns(const KashipanEngine::IObjectComponent *) const override { return false; }
+    bool IsBatchProcessed() const override { return true; }
+    int GetBatchUpdatePriority() const override { return priority_; }
+    void UpdateBatch(const ComponentBatchContext &) override { log_.push_back(name_); }
+
+private:
+    int priority_;
+    std::string name_;
+    std::vector<std::string> &log_;
+};
+
+} // namespace
+
+TEST_CASE(ScriptBatch_RunsBeforeAllObjectUpdates) {
+    TEST_CHECK(KashipanEngine::ComponentBatchTraits<ScriptBatchTestComponent>::kIsBatchProcessed);
+    TEST_CHECK(KashipanEngine::ComponentBatchTraits<ScriptBatchTestComponent>::kUpdatePriority == std::numeric_limits<int>::min());
+
+    std::vector<std::string> log;
+    std::vector<int> scriptLog;
+    ComponentPool<ScriptBatchTestComponent> scriptPool;
+    EmplaceComponents(scriptPool, { 0, 0 }, scriptLog);
+    PriorityOnlyPool defaultPool(1, "batch(default)", log);
+    PriorityOnlyPool latePool(100, "batch(late)", log);
+
+    // Scene::RegisterBatchProcessedPool と同じく、一括更新の優先度順に並んだプールの一覧
+    std::vector<IComponentPoolBase *> pools{ &scriptPool, &defaultPool, &latePool };
+    KashipanEngine::RunComponentBatchStages(pools,
+        [&log](int minPriority, int maxPriority) {
+            log.push_back("objects(" + std::to_string(minPriority) + ", " + std::to_string(maxPriority) + ")");
+        },
+        [&log, &scriptPool, &scriptLog](IComponentPoolBase *pool) {
+            pool->UpdateBatch(ComponentBatchContext{});
+            // スクリプトのプールは、実行されたインスタンスの数を記録する
+            if (pool == &scriptPool) log.push_back("scripts x" + std::to_string(scriptLog.size()));
+        });
+
+    const std::string minText = std::to_string(std::numeric_limits<int>::min());
+    const std::string maxText = std::to_string(std::numeric_limits<int>::max());
+    const std::vector<std::string> expected{
+        // 優先度 INT_MIN の個別更新も含め、どのオブジェクトの個別更新よりも先にスクリプトが全て実行される
+        "scripts x2",
+        "objects(" + minText + ", 0)",
+        "batch(default)",
+        "objects(1, 99)",
+        "batch(late)",
+        "objects(100, " + maxText + ")",
+    };
+    TEST_CHECK(log == expected);
+}
+
+TEST_CASE(ScriptBatch_GroupsByModuleKeepingPoolOrder) {
+    std::vector<int> log;
+    ComponentPool<ScriptBatchTestComponent> pool;
+    const auto components = EmplaceComponents(pool, { 10, 20, 10, 30, 20, 10, 30 }, log);
+    // 無効なインスタンスは積まれない
+    components[4]->SetActive(false);
+
+    pool.UpdateBatch(ComponentBatchContext{});
+    TEST_CHECK((log == std::vector<int>{ 0, 2, 5, 1, 3, 6 }));
+    for (const auto *component : components) TEST_CHECK(!component->IsInBatchQueue());
+
+    // 毎フレーム同じ順になる（前のフレームの並べ替えの影響を受けない）
+    log.clear();
+    components[4]->SetActive(true);
+    pool.UpdateBatch(ComponentBatchContext{});
+    TEST_CHECK((log == std::vector<int>{ 0, 2, 5, 1, 4, 3, 6 }));
+}
+
+TEST_CASE(ScriptBatch_RemovedDuringBatchIsSkipped) {
+    std::vector<int> log;
+    ComponentPool<ScriptBatchTestComponent> pool;
+    auto components = EmplaceComponents(pool, { 1, 2, 1, 2, 1 }, log);
+    // 実行順は 0, 2, 4, 1, 3
+    auto destroy = [&pool](ScriptBatchTestComponent *component) {
+        // EmptyObject がコンポーネントを削除する場合と同じく、Finalize（RemoveFromBatchQueue）の後でプールから破棄する
+        component->RemoveFromBatchQueue();
+        pool.Remove(component);
+    };
+    ScriptBatchTestComponent *later = components[3];
+    ScriptBatchTestComponent *earlier = components[0];
+    components[2]->onUpdate = [&](ScriptBatchTestComponent &self) {
+        // まだ実行されていない（並べ替えで位置が変わった）インスタンスと、実行済みのインスタンスを削除する
+        destroy(later);
+        destroy(earlier);
+        // 実行中の自身を外しても何も起きない
+        self.RemoveFromBatchQueue();
+    };
+    // 無効化されたインスタンスは待ち行列に残っていても実行されない
+    components[4]->onUpdate = [&](ScriptBatchTestComponent &) { components[1]->SetActive(false); };
+
+    pool.UpdateBatch(ComponentBatchContext{});
+    TEST_CHECK((log == std::vector<int>{ 0, 2, 4 }));
+
+    // 次のフレームでは残ったインスタンスだけが実行される（最初に現れるモジュールが 2 になる）
+    log.clear();
+    components[2]->onUpdate = nullptr;
+    components[4]->onUpdate = nullptr;
+    components[1]->SetActive(true);
+    pool.UpdateBatch(ComponentBatchContext{});
+    TEST_CHECK((log == std::vector<int>{ 1, 2, 4 }));
+}
+
+TEST_CASE(ScriptBatch_StaleSlotAfterExceptionLeavesNextFrameIntact) {
+    std::vector<int> log;
+    ComponentPool<ScriptBatchTestComponent> pool;
+    auto components = EmplaceComponents(pool, { 1, 1, 1, 1 }, log);
+    components[1]->onUpdate = [](ScriptBatchTestComponent &) { throw std::runtime_error("script error"); };
+
+    bool isThrown = false;
+    try {
+        pool.UpdateBatch(ComponentBatchContext{});
+    } catch (const std::runtime_error &) {
+        isThrown = true;
+    }
+    TEST_CHECK(isThrown);
+    TEST_CHECK((log == std::vector<int>{ 0, 1 }));
+    // 実行されなかったインスタンスは、プールが待ち行列を空にした後も位置を持ったまま
+    TEST_CHECK(components[3]->IsInBatchQueue());
+
+    // 次のフレームでは components[3] は積まれず、同じ位置（3）には新しいインスタンスが入る
+    log.clear();
+    components[1]->onUpdate = nullptr;
+    components[3]->SetActive(false);
+    auto *added = pool.Emplace();
+    added->id = 4;
+    added->moduleId = 1;
+    added->log = &log;
+    components[0]->onUpdate = [&](ScriptBatchTestComponent &) {
+        // 前のフレームの位置は今のフレームでは別のインスタンスを指すため、消してはいけない
+        components[3]->RemoveFromBatchQueue();
+    };
+    pool.UpdateBatch(ComponentBatchContext{});
+    TEST_CHECK(!components[3]->IsInBatchQueue());
+    TEST_CHECK((log == std::vector<int>{ 0, 1, 2, 4 }));
+}
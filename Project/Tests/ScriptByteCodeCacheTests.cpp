@@ -0,0 +1,183 @@
+// ScriptByteCodeCacheFile（スクリプトのバイトコードキャッシュファイル）のテスト
+//
+// ソース（include先を含む）の内容・AngelScriptのバージョン・登録APIが変わった場合と、ファイルが壊れている・
+// 書き込み途中で切れている場合に読み込みを拒否すること（ScriptModuleCache はこの場合ソースからコンパイルし直す）と、
+// コンパイルし直して保存し直せば再び使えることを確かめる。
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "TestFramework.h"
+#include "TestFiles.h"
+#include "Scene/Components/Script/ScriptByteCodeCacheFile.h"
+#include "Utilities/Conversion/ConvertString.h"
+#include "Utilities/FileIO/BinaryStream.h"
+
+using KashipanEngine::ScriptByteCodeCacheFile;
+
+namespace {
+
+/// @brief 一時ファイルを置くフォルダ（KashipanEngineTests 内）
+constexpr const char *kTemporaryFolder = "ScriptByteCode";
+
+ScriptByteCodeCacheFile::Key MakeKey() {
+    return { "2.37.0|AS_MAX_PORTABILITY|8", 0x1234'5678'9abc'def0ull, "Assets/Scripts/Player.as", "DEBUG;EDITOR;" };
+}
+
+/// @brief 本体とinclude先の2つのソースを書き出し、それらを記録したキャッシュの中身を作る
+ScriptByteCodeCacheFile MakeCacheFile(const std::string &mainSourcePath, const std::string &includeSourcePath) {
+    Tests::WriteText(mainSourcePath, "#include \"Common.as\"\nvoid Update(float dt) { Move(dt); }\n");
+    Tests::WriteText(includeSourcePath, "void Move(float dt) {}\n");
+
+    ScriptByteCodeCacheFile file;
+    file.key = MakeKey();
+    file.sources = {
+        { mainSourcePath, KashipanEngine::HashFileContentFnv1a(mainSourcePath) },
+        { includeSourcePath, KashipanEngine::HashFileContentFnv1a(includeSourcePath) },
+    };
+    file.hasGlobalState = true;
+    file.buildMessages = { "[Warning] Player.as (2, 1): unused variable" };
+    for (std::uint8_t i = 0; i < 200; ++i) file.byteCode.push_back(static_cast<std::uint8_t>(i * 7));
+    return file;
+}
+
+/// @brief 読み込みに失敗した場合に out が書き換えられていないか確かめるための目印
+ScriptByteCodeCacheFile MakeSentinel() {
+    ScriptByteCodeCacheFile sentinel;
+    sentinel.buildMessages = { "sentinel" };
+    return sentinel;
+}
+
+bool IsSentinel(const ScriptByteCodeCacheFile &file) {
+    return file.buildMessages.size() == 1 && file.buildMessages[0] == "sentinel" && file.byteCode.empty();
+}
+
+} // namespace
+
+TEST_CASE(ScriptByteCodeCache_LoadsWhenNothingChanged) {
+    const std::string mainPath = Tests::GetTemporaryPath(kTemporaryFolder, "Unchanged.as");
+    const std::string includePath = Tests::GetTemporaryPath(kTemporaryFolder, "UnchangedCommon.as");
+    const std::string cachePath = Tests::GetTemporaryPath(kTemporaryFolder, "Unchanged.kbc");
+    const ScriptByteCodeCacheFile saved = MakeCacheFile(mainPath, includePath);
+    TEST_CHECK(saved.Save(cachePath));
+
+    ScriptByteCodeCacheFile loaded;
+    TEST_CHECK(ScriptByteCodeCacheFile::Load(cachePath, MakeKey(), loaded));
+    TEST_CHECK(loaded.byteCode == saved.byteCode);
+    TEST_CHECK(loaded.buildMessages == saved.buildMessages);
+    TEST_CHECK(loaded.hasGlobalState);
+    TEST_CHECK(loaded.sources.size() == 2 && loaded.sources[1].path == includePath &&
+        loaded.sources[1].contentHash == saved.sources[1].contentHash);
+
+    // 保存し直しただけ（内容が同じ）のソースは更新日時が変わっても使い続ける
+    Tests::WriteText(includePath, "void Move(float dt) {}\n");
+    TEST_CHECK(ScriptByteCodeCacheFile::Load(cachePath, MakeKey(), loaded));
+}
+
+TEST_CASE(ScriptByteCodeCache_InvalidatedWhenSourceChanges) {
+    const std::string mainPath = Tests::GetTemporaryPath(kTemporaryFolder, "SourceChange.as");
+    const std::string includePath = Tests::GetTemporaryPath(kTemporaryFolder, "SourceChangeCommon.as");
+    const std::string cachePath = Tests::GetTemporaryPath(kTemporaryFolder, "SourceChange.kbc");
+    const ScriptByteCodeCacheFile saved = MakeCacheFile(mainPath, includePath);
+    TEST_CHECK(saved.Save(cachePath));
+
+    ScriptByteCodeCacheFile loaded = MakeSentinel();
+    // 本体の変更
+    Tests::WriteText(mainPath, "#include \"Common.as\"\nvoid Update(float dt) { Move(dt * 2.0f); }\n");
+    TEST_CHECK(!ScriptByteCodeCacheFile::Load(cachePath, MakeKey(), loaded));
+    TEST_CHECK(IsSentinel(loaded));
+
+    // include先だけの変更（本体を元に戻しても、include先が違えば使わない）
+    Tests::WriteText(mainPath, "#include \"Common.as\"\nvoid Update(float dt) { Move(dt); }\n");
+    Tests::WriteText(includePath, "void Move(float dt) { dt += 1.0f; }\n");
+    TEST_CHECK(!ScriptByteCodeCacheFile::Load(cachePath, MakeKey(), loaded));
+
+    // include先が削除された
+    std::filesystem::remove(KashipanEngine::Utf8StringToPath(includePath));
+    TEST_CHECK(!ScriptByteCodeCacheFile::Load(cachePath, MakeKey(), loaded));
+    TEST_CHECK(IsSentinel(loaded));
+
+    // 保存時と同じ内容へ戻れば再び使える
+    Tests::WriteText(includePath, "void Move(float dt) {}\n");
+    TEST_CHECK(ScriptByteCodeCacheFile::Load(cachePath, MakeKey(), loaded));
+}
+
+TEST_CASE(ScriptByteCodeCache_InvalidatedWhenEngineOrKeyChanges) {
+    const std::string mainPath = Tests::GetTemporaryPath(kTemporaryFolder, "EngineChange.as");
+    const std::string includePath = Tests::GetTemporaryPath(kTemporaryFolder, "EngineChangeCommon.as");
+    const std::string cachePath = Tests::GetTemporaryPath(kTemporaryFolder, "EngineChange.kbc");
+    TEST_CHECK(MakeCacheFile(mainPath, includePath).Save(cachePath));
+
+    ScriptByteCodeCacheFile loaded = MakeSentinel();
+    auto key = MakeKey();
+    key.runtimeSignature = "2.38.0|AS_MAX_PORTABILITY|8";
+    TEST_CHECK_MESSAGE(!ScriptByteCodeCacheFile::Load(cachePath, key, loaded), "AngelScript version");
+
+    key = MakeKey();
+    key.runtimeSignature = "2.37.0|AS_MAX_PORTABILITY|4";
+    TEST_CHECK_MESSAGE(!ScriptByteCodeCacheFile::Load(cachePath, key, loaded), "pointer size");
+
+    key = MakeKey();
+    ++key.apiSignatureHash;
+    TEST_CHECK_MESSAGE(!ScriptByteCodeCacheFile::Load(cachePath, key, loaded), "registered API");
+
+    key = MakeKey();
+    key.defineKey = "DEBUG;";
+    TEST_CHECK_MESSAGE(!ScriptByteCodeCacheFile::Load(cachePath, key, loaded), "defines");
+
+    // ファイル名はキーのハッシュのため、衝突した別のスクリプトのキャッシュも読まない
+    key = MakeKey();
+    key.scriptPath = "Assets/Scripts/Enemy.as";
+    TEST_CHECK_MESSAGE(!ScriptByteCodeCacheFile::Load(cachePath, key, loaded), "script path");
+    TEST_CHECK(IsSentinel(loaded));
+}
+
+TEST_CASE(ScriptByteCodeCache_CorruptOrTruncatedFileFallsBack) {
+    const std::string mainPath = Tests::GetTemporaryPath(kTemporaryFolder, "Corrupt.as");
+    const std::string includePath = Tests::GetTemporaryPath(kTemporaryFolder, "CorruptCommon.as");
+    const std::string cachePath = Tests::GetTemporaryPath(kTemporaryFolder, "Corrupt.kbc");
+    const std::string brokenPath = Tests::GetTemporaryPath(kTemporaryFolder, "Broken.kbc");
+    const ScriptByteCodeCacheFile saved = MakeCacheFile(mainPath, includePath);
+    TEST_CHECK(saved.Save(cachePath));
+    const std::vector<std::uint8_t> original = Tests::ReadBytes(cachePath);
+    TEST_CHECK(original.size() > 64);
+
+    ScriptByteCodeCacheFile loaded = MakeSentinel();
+    auto expectRejected = [&](const std::vector<std::uint8_t> &bytes, const char *what) {
+        Tests::WriteBytes(brokenPath, bytes);
+        TEST_CHECK_MESSAGE(!ScriptByteCodeCacheFile::Load(brokenPath, MakeKey(), loaded), what);
+        TEST_CHECK_MESSAGE(IsSentinel(loaded), what);
+    };
+
+    TEST_CHECK(!ScriptByteCodeCacheFile::Load(Tests::GetTemporaryPath(kTemporaryFolder, "Missing.kbc"), MakeKey(), loaded));
+    expectRejected({}, "empty file");
+    expectRejected(std::vector<std::uint8_t>(original.begin(), original.begin() + 5), "shorter than checksum");
+    expectRejected(std::vector<std::uint8_t>(original.begin(), original.end() - 1), "last byte cut");
+    expectRejected(std::vector<std::uint8_t>(original.begin(), original.begin() + original.size() / 2), "cut in half");
+    for (const std::size_t offset : { std::size_t{ 0 }, std::size_t{ 4 }, original.size() / 2, original.size() - 9, original.size() - 1 }) {
+        auto flipped = original;
+        flipped[offset] ^= 0x10;
+        expectRejected(flipped, ("bit flip at " + std::to_string(offset)).c_str());
+    }
+
+    // チェックサムは合っているが中身が途中で切れている・余分なデータが付いている（旧フォーマット等）
+    const std::vector<std::uint8_t> payload(original.begin(), original.end() - sizeof(std::uint64_t));
+    TEST_CHECK(KashipanEngine::SaveChecksummedBinaryFile(brokenPath, std::vector<std::uint8_t>(payload.begin(), payload.end() - 10)));
+    TEST_CHECK(!ScriptByteCodeCacheFile::Load(brokenPath, MakeKey(), loaded));
+    auto extended = payload;
+    extended.push_back(0);
+    TEST_CHECK(KashipanEngine::SaveChecksummedBinaryFile(brokenPath, extended));
+    TEST_CHECK(!ScriptByteCodeCacheFile::Load(brokenPath, MakeKey(), loaded));
+    auto otherFormat = payload;
+    otherFormat[4] ^= 0xFF;
+    TEST_CHECK(KashipanEngine::SaveChecksummedBinaryFile(brokenPath, otherFormat));
+    TEST_CHECK(!ScriptByteCodeCacheFile::Load(brokenPath, MakeKey(), loaded));
+    TEST_CHECK(IsSentinel(loaded));
+
+    // コンパイルし直した結果で上書きすれば、壊れていたファイルも再び使える
+    TEST_CHECK(saved.Save(brokenPath));
+    TEST_CHECK(ScriptByteCodeCacheFile::Load(brokenPath, MakeKey(), loaded));
+    TEST_CHECK(loaded.byteCode == saved.byteCode);
+}
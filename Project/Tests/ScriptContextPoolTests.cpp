@@ -0,0 +1,171 @@
+// ScriptContextPool（スクリプト実行用コンテキストの再利用プール）のテスト
+//
+// 実際のAngelScriptエンジンで、空きコンテキストが最後に返されたものから貸し出されることと、
+// エンジンの RequestContext / ReturnContext（アドオンが内部で使うコンテキスト）もプールを通ることと、
+// 中断されたまま返されたコンテキストが打ち切られ、Prepare 済みの関数は返却後も保たれることと、
+// プロファイラーのサンプリングの有効・無効に合わせてラインコールバックが付け外しされることを確かめる。
+// デバッグサーバーは渡さない（AngelScriptDebugServer::OnLine は Tests/Fakes/ScriptFakes.cpp で空にしている）。
+
+#include <string>
+
+#include <angelscript.h>
+
+#include "TestFramework.h"
+#include "Scene/Components/Script/ScriptContextPool.h"
+#include "Scene/Components/Script/ScriptProfiler.h"
+
+using KashipanEngine::ScriptContextPool;
+using KashipanEngine::ScriptProfiler;
+
+namespace {
+
+constexpr const char *kPoolScript =
+    "int Sum(int count) {\n"
+    "    int sum = 0;\n"
+    "    for (int i = 0; i < count; ++i) {\n"
+    "        sum += i;\n"
+    "    }\n"
+    "    return sum;\n"
+    "}\n"
+    "int YieldOnce() {\n"
+    "    Yield();\n"
+    "    return 1;\n"
+    "}\n";
+
+void Yield() {
+    if (asIScriptContext *context = asGetActiveContext()) context->Suspend();
+}
+
+/// @brief テスト用のスクリプトエンジン（kPoolScript をビルドしたモジュールを1つ持つ）
+class PoolTestEngine final {
+public:
+    PoolTestEngine() : engine_(asCreateScriptEngine()) {
+        engine_->RegisterGlobalFunction("void Yield()", asFUNCTION(Yield), asCALL_CDECL);
+        module_ = engine_->GetModule("ContextPoolTest", asGM_ALWAYS_CREATE);
+        module_->AddScriptSection("ContextPoolTest.as", kPoolScript);
+        isBuilt_ = module_->Build() >= 0;
+    }
+    ~PoolTestEngine() { engine_->ShutDownAndRelease(); }
+
+    PoolTestEngine(const PoolTestEngine &) = delete;
+    PoolTestEngine &operator=(const PoolTestEngine &) = delete;
+
+    asIScriptEngine *Get() const noexcept { return engine_; }
+    bool IsBuilt() const noexcept { return isBuilt_; }
+    asIScriptFunction *Function(const char *declaration) const { return module_->GetFunctionByDecl(declaration); }
+
+private:
+    asIScriptEngine *engine_ = nullptr;
+    asIScriptModule *module_ = nullptr;
+    bool isBuilt_ = false;
+};
+
+/// @brief Sum(count) を実行して結果を返す（失敗した場合は -1）
+int ExecuteSum(asIScriptContext *context, asIScriptFunction *function, int count) {
+    if (context->Prepare(function) < 0) return -1;
+    context->SetArgDWord(0, static_cast<asDWORD>(count));
+    if (context->Execute() != asEXECUTION_FINISHED) return -1;
+    return static_cast<int>(context->GetReturnDWord());
+}
+
+} // namespace
+
+TEST_CASE(ScriptContextPool_ReusesLastReturnedContext) {
+    PoolTestEngine engine;
+    TEST_CHECK(engine.IsBuilt());
+    ScriptContextPool pool(engine.Get(), nullptr, nullptr);
+
+    asIScriptContext *first = pool.Acquire();
+    asIScriptContext *second = pool.Acquire();
+    TEST_CHECK(first && second && first != second);
+    TEST_CHECK(pool.GetCreatedCount() == 2);
+    TEST_CHECK(pool.GetIdleCount() == 0);
+
+    pool.Return(first);
+    pool.Return(second);
+    TEST_CHECK(pool.GetIdleCount() == 2);
+    // 最後に返されたものから貸し出す
+    TEST_CHECK(pool.Acquire() == second);
+    TEST_CHECK(pool.Acquire() == first);
+    TEST_CHECK(pool.GetCreatedCount() == 2);
+
+    pool.Return(first);
+    pool.Return(second);
+    pool.Return(nullptr);
+    TEST_CHECK(pool.GetIdleCount() == 2);
+}
+
+TEST_CASE(ScriptContextPool_EngineContextRequestsGoThroughPool) {
+    PoolTestEngine engine;
+    ScriptContextPool pool(engine.Get(), nullptr, nullptr);
+
+    asIScriptContext *context = engine.Get()->RequestContext();
+    TEST_CHECK(context != nullptr);
+    TEST_CHECK(pool.GetCreatedCount() == 1);
+    TEST_CHECK(pool.GetIdleCount() == 0);
+    engine.Get()->ReturnContext(context);
+    TEST_CHECK(pool.GetIdleCount() == 1);
+    TEST_CHECK(pool.Acquire() == context);
+    pool.Return(context);
+}
+
+TEST_CASE(ScriptContextPool_ReturnAbortsSuspendedAndKeepsPrepared) {
+    PoolTestEngine engine;
+    TEST_CHECK(engine.IsBuilt());
+    ScriptContextPool pool(engine.Get(), nullptr, nullptr);
+    asIScriptFunction *sum = engine.Function("int Sum(int)");
+    asIScriptFunction *yieldOnce = engine.Function("int YieldOnce()");
+    TEST_CHECK(sum && yieldOnce);
+
+    // 中断されたまま返されたコンテキストは打ち切られ、次に借りた側がそのまま Prepare できる
+    asIScriptContext *context = pool.Acquire();
+    TEST_CHECK(context->Prepare(yieldOnce) >= 0);
+    TEST_CHECK(context->Execute() == asEXECUTION_SUSPENDED);
+    pool.Return(context);
+    TEST_CHECK(context->GetState() == asEXECUTION_ABORTED);
+    TEST_CHECK(pool.Acquire() == context);
+    TEST_CHECK(ExecuteSum(context, sum, 5) == 10);
+
+    // 返却時に Unprepare しないため、同じ関数を続けて実行する場合は準備済みの状態が引き継がれる
+    pool.Return(context);
+    TEST_CHECK(context->GetState() == asEXECUTION_FINISHED);
+    TEST_CHECK(context->GetFunction() == sum);
+    asIScriptContext *reused = pool.Acquire();
+    TEST_CHECK(reused == context);
+    TEST_CHECK(ExecuteSum(reused, sum, 4) == 6);
+    pool.Return(reused);
+}
+
+TEST_CASE(ScriptContextPool_LineCallbackFollowsProfilerSampling) {
+    PoolTestEngine engine;
+    TEST_CHECK(engine.IsBuilt());
+    ScriptProfiler profiler;
+    profiler.SetSamplingIntervalMicroseconds(0);
+    ScriptContextPool pool(engine.Get(), nullptr, &profiler);
+    asIScriptFunction *sum = engine.Function("int Sum(int)");
+
+    // サンプリングが無効な間はラインコールバックを付けない
+    asIScriptContext *context = pool.Acquire();
+    profiler.SetSamplingEnabled(true);
+    TEST_CHECK(ExecuteSum(context, sum, 8) == 28);
+    TEST_CHECK(profiler.GetSampleCount() == 0);
+
+    // 有効にして付け直すと、作成済みのコンテキストでも1行ごとに記録される
+    pool.RefreshLineCallbacks();
+    TEST_CHECK(ExecuteSum(context, sum, 8) == 28);
+    TEST_CHECK(profiler.GetSampleCount() > 0);
+    bool isSumSampled = false;
+    for (const auto &stats : profiler.GetStats()) {
+        if (stats.declaration.find("Sum") != std::string::npos) isSumSampled = stats.selfSamples > 0;
+    }
+    TEST_CHECK(isSumSampled);
+
+    // 無効にして付け直すと外れる
+    const auto sampleCount = profiler.GetSampleCount();
+    profiler.SetSamplingEnabled(false);
+    pool.RefreshLineCallbacks();
+    profiler.SetSamplingEnabled(true);
+    TEST_CHECK(ExecuteSum(context, sum, 8) == 28);
+    TEST_CHECK(profiler.GetSampleCount() == sampleCount);
+    pool.Return(context);
+}
@@ -0,0 +1,370 @@
+// ScriptModuleCache（スクリプトのコンパイル結果の共有キャッシュ）のテスト
+//
+// 実際のAngelScriptエンジンでスクリプトをコンパイル・実行し、ディスク上のバイトコードキャッシュ
+// （SaveByteCode → .kbc → LoadByteCode）を通して読み込んだモジュールがソースからのコンパイルと同じ結果を返すことと、
+// キャッシュが古い・壊れている・登録APIが変わった場合はソースからコンパイルし直すことと、
+// 同じスクリプトを使うインスタンスがエントリを共有し、define集合ごとに別のエントリになり、
+// 置き換えられたエントリのモジュールは最後の利用権が返された時点で破棄されることを確かめる。
+// 描画・シーンには依存しない（ProjectPaths のプロジェクトルートは Tests/Fakes/ScriptFakes.cpp で一時フォルダにしている）。
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include <angelscript.h>
+
+#include "TestFramework.h"
+#include "TestFiles.h"
+#include "Core/ProjectPaths.h"
+#include "Scene/Components/Script/ScriptBindings.h"
+#include "Scene/Components/Script/ScriptByteCodeCacheFile.h"
+#include "Scene/Components/Script/ScriptModuleCache.h"
+#include "Utilities/Conversion/ConvertString.h"
+
+using KashipanEngine::ScriptByteCodeCacheFile;
+using KashipanEngine::ScriptModuleCache;
+
+namespace {
+
+/// @brief 一時ファイルを置くフォルダ（KashipanEngineTests 内）
+constexpr const char *kTemporaryFolder = "ScriptModuleCache";
+
+constexpr const char *kSharedScript =
+    "const int kBase = 40;\n"
+    "int Answer(int add) { return kBase + add; }\n";
+
+/// @brief 変更可能なグローバル変数を持つ（インスタンスごとにモジュールを複製する）スクリプト
+constexpr const char *kGlobalStateScript =
+    "[SerializeField]\n"
+    "int counter = 0;\n"
+    "int Tick() { return ++counter; }\n";
+
+/// @brief バイトコードキャッシュの保存先フォルダを空にする（前のテスト・前回の実行の結果を使わないため）
+std::filesystem::path ResetDiskCacheFolder() {
+    const std::filesystem::path folder = KashipanEngine::Utf8StringToPath(KashipanEngine::ProjectPaths::InProjectRoot("Cache/ScriptByteCode"));
+    std::error_code ec;
+    std::filesystem::remove_all(folder, ec);
+    return folder;
+}
+
+/// @brief 保存先フォルダ内のバイトコードキャッシュファイル（1つだけ書き出された前提）
+std::string FindOnlyDiskCacheFile(const std::filesystem::path &folder) {
+    std::string found;
+    std::size_t count = 0;
+    std::error_code ec;
+    for (const auto &item : std::filesystem::directory_iterator(folder, ec)) {
+        if (item.path().extension() != ".kbc") continue;
+        found = KashipanEngine::PathToUtf8String(item.path());
+        ++count;
+    }
+    TEST_CHECK(count == 1);
+    return found;
+}
+
+int ExtraApi() {
+    return 7;
+}
+
+/// @brief テスト用のスクリプトエンジン（登録APIは無し。withExtraApi の場合だけグローバル関数を1つ登録する）
+class TestScriptEngine final {
+public:
+    explicit TestScriptEngine(bool withExtraApi = false) : engine_(asCreateScriptEngine()) {
+        if (withExtraApi) {
+            engine_->RegisterGlobalFunction("int ExtraApi()", asFUNCTION(ExtraApi), asCALL_CDECL);
+        }
+    }
+    ~TestScriptEngine() { engine_->ShutDownAndRelease(); }
+
+    TestScriptEngine(const TestScriptEngine &) = delete;
+    TestScriptEngine &operator=(const TestScriptEngine &) = delete;
+
+    asIScriptEngine *Get() const noexcept { return engine_; }
+
+    /// @brief モジュールの int 関数を呼んで結果を返す（見つからない・失敗した場合は -1）
+    int CallInt(asIScriptModule *module, const char *declaration, int argument = 0) const {
+        asIScriptFunction *function = module ? module->GetFunctionByDecl(declaration) : nullptr;
+        if (!function) return -1;
+        asIScriptContext *context = engine_->CreateContext();
+        int result = -1;
+        if (context->Prepare(function) >= 0) {
+            if (function->GetParamCount() > 0) context->SetArgDWord(0, static_cast<asDWORD>(argument));
+            if (context->Execute() == asEXECUTION_FINISHED) result = static_cast<int>(context->GetReturnDWord());
+        }
+        context->Release();
+        return result;
+    }
+
+private:
+    asIScriptEngine *engine_ = nullptr;
+};
+
+/// @brief ScriptModuleCache がキャッシュファイルを使う条件（ScriptModuleCache.cpp の MakeDiskCacheKey と同じ組み立て）
+ScriptByteCodeCacheFile::Key MakeDiskCacheKey(asIScriptEngine *engine, const std::string &scriptPath) {
+    return {
+        std::string(ANGELSCRIPT_VERSION_STRING) + "|" + asGetLibraryOptions() + "|" + std::to_string(sizeof(void *)),
+        KashipanEngine::ComputeScriptApiSignatureHash(engine), scriptPath, "" };
+}
+
+} // namespace
+
+TEST_CASE(ScriptModuleCache_DiskCacheRoundTripMatchesCompile) {
+    ResetDiskCacheFolder();
+    const std::string sharedPath = Tests::GetTemporaryPath(kTemporaryFolder, "RoundTripShared.as");
+    const std::string globalPath = Tests::GetTemporaryPath(kTemporaryFolder, "RoundTripGlobal.as");
+    Tests::WriteText(sharedPath, kSharedScript);
+    Tests::WriteText(globalPath, kGlobalStateScript);
+
+    // 1回目の起動: ソースからコンパイルし、バイトコードを保存する
+    {
+        TestScriptEngine engine;
+        ScriptModuleCache cache(nullptr, engine.Get());
+        auto shared = cache.Acquire(sharedPath, {}, "RoundTripShared_0");
+        auto global = cache.Acquire(globalPath, {}, "RoundTripGlobal_0");
+        TEST_CHECK(cache.GetCompileCount() == 2 && cache.GetDiskLoadCount() == 0);
+        TEST_CHECK(shared.entry->IsBuilt() && !shared.entry->HasGlobalState());
+        TEST_CHECK(global.entry->IsBuilt() && global.entry->HasGlobalState());
+        TEST_CHECK(engine.CallInt(shared.module, "int Answer(int)", 2) == 42);
+        TEST_CHECK(engine.CallInt(global.module, "int Tick()") == 1);
+        cache.Release(shared);
+        cache.Release(global);
+    }
+
+    // 2回目の起動（別のエンジン）: コンパイルせずにバイトコードから読み込み、同じ結果になる
+    TestScriptEngine engine;
+    ScriptModuleCache cache(nullptr, engine.Get());
+    auto shared = cache.Acquire(sharedPath, {}, "RoundTripShared_1");
+    auto first = cache.Acquire(globalPath, {}, "RoundTripGlobal_1");
+    auto second = cache.Acquire(globalPath, {}, "RoundTripGlobal_2");
+    TEST_CHECK(cache.GetCompileCount() == 0);
+    TEST_CHECK(cache.GetDiskLoadCount() == 2);
+    TEST_CHECK(shared.entry->IsBuilt() && !shared.entry->HasGlobalState());
+    TEST_CHECK(engine.CallInt(shared.module, "int Answer(int)", 2) == 42);
+
+    // 読み込んだバイトコードから複製したモジュールも、グローバル変数はインスタンスごとに分かれる
+    TEST_CHECK(first.entry == second.entry && first.entry->HasGlobalState());
+    TEST_CHECK(first.module && second.module && first.module != second.module);
+    TEST_CHECK(engine.CallInt(first.module, "int Tick()") == 1);
+    TEST_CHECK(engine.CallInt(first.module, "int Tick()") == 2);
+    TEST_CHECK(engine.CallInt(second.module, "int Tick()") == 1);
+
+    // コンパイル時にしか取れないメタデータもキャッシュから復元される
+    const auto &metadata = first.entry->GetMetadata().ForGlobalVar("", "counter");
+    TEST_CHECK(metadata.size() == 1 && metadata[0] == "SerializeField");
+
+    cache.Release(shared);
+    cache.Release(first);
+    cache.Release(second);
+}
+
+TEST_CASE(ScriptModuleCache_StaleOrCorruptDiskCacheFallsBackToCompile) {
+    const auto cacheFolder = ResetDiskCacheFolder();
+    const std::string scriptPath = Tests::GetTemporaryPath(kTemporaryFolder, "Fallback.as");
+    Tests::WriteText(scriptPath, kSharedScript);
+
+    TestScriptEngine engine;
+    const auto acquireAnswer = [&](int &outAnswer, std::uint32_t &outCompileCount, std::uint32_t &outDiskLoadCount) {
+        ScriptModuleCache cache(nullptr, engine.Get());
+        auto lease = cache.Acquire(scriptPath, {}, "Fallback");
+        outAnswer = engine.CallInt(lease.module, "int Answer(int)", 2);
+        outCompileCount = cache.GetCompileCount();
+        outDiskLoadCount = cache.GetDiskLoadCount();
+        cache.Release(lease);
+    };
+    int answer = 0;
+    std::uint32_t compileCount = 0;
+    std::uint32_t diskLoadCount = 0;
+
+    acquireAnswer(answer, compileCount, diskLoadCount);
+    TEST_CHECK(answer == 42 && compileCount == 1 && diskLoadCount == 0);
+    acquireAnswer(answer, compileCount, diskLoadCount);
+    TEST_CHECK(answer == 42 && compileCount == 0 && diskLoadCount == 1);
+    const std::string cachePath = FindOnlyDiskCacheFile(cacheFolder);
+
+    // ソースが変わった: 古いバイトコードは使わず、変更後のソースをコンパイルする（結果は保存し直される）
+    Tests::WriteText(scriptPath, "const int kBase = 50;\nint Answer(int add) { return kBase + add; }\n");
+    acquireAnswer(answer, compileCount, diskLoadCount);
+    TEST_CHECK_MESSAGE(answer == 52 && compileCount == 1 && diskLoadCount == 0, "source changed");
+    acquireAnswer(answer, compileCount, diskLoadCount);
+    TEST_CHECK_MESSAGE(answer == 52 && compileCount == 0 && diskLoadCount == 1, "recompiled cache reused");
+
+    // ファイルが壊れている（チェックサム不一致）
+    auto bytes = Tests::ReadBytes(cachePath);
+    TEST_CHECK(bytes.size() > 64);
+    bytes[bytes.size() / 2] ^= 0x10;
+    Tests::WriteBytes(cachePath, bytes);
+    acquireAnswer(answer, compileCount, diskLoadCount);
+    TEST_CHECK_MESSAGE(answer == 52 && compileCount == 1 && diskLoadCount == 0, "corrupt file");
+
+    // ファイル自体は正しいが、バイトコードが途中で切れていて LoadByteCode に失敗する
+    ScriptByteCodeCacheFile file;
+    TEST_CHECK(ScriptByteCodeCacheFile::Load(cachePath, MakeDiskCacheKey(engine.Get(), scriptPath), file));
+    TEST_CHECK(file.byteCode.size() > 16);
+    file.byteCode.resize(file.byteCode.size() / 2);
+    TEST_CHECK(file.Save(cachePath));
+    acquireAnswer(answer, compileCount, diskLoadCount);
+    TEST_CHECK_MESSAGE(answer == 52 && compileCount == 1 && diskLoadCount == 0, "truncated bytecode");
+
+    // コンパイルし直した結果で上書きされているため、次回は再び読み込める
+    acquireAnswer(answer, compileCount, diskLoadCount);
+    TEST_CHECK(answer == 52 && compileCount == 0 && diskLoadCount == 1);
+}
+
+TEST_CASE(ScriptModuleCache_ApiSignatureChangeInvalidatesDiskCache) {
+    ResetDiskCacheFolder();
+    const std::string scriptPath = Tests::GetTemporaryPath(kTemporaryFolder, "ApiChange.as");
+    Tests::WriteText(scriptPath, kSharedScript);
+
+    TestScriptEngine baseEngine;
+    TestScriptEngine extendedEngine(true);
+    TestScriptEngine sameExtendedEngine(true);
+    const std::uint64_t baseHash = KashipanEngine::ComputeScriptApiSignatureHash(baseEngine.Get());
+    TEST_CHECK(baseHash != KashipanEngine::ComputeScriptApiSignatureHash(extendedEngine.Get()));
+    TEST_CHECK(KashipanEngine::ComputeScriptApiSignatureHash(extendedEngine.Get()) ==
+        KashipanEngine::ComputeScriptApiSignatureHash(sameExtendedEngine.Get()));
+    TEST_CHECK(baseHash == KashipanEngine::ComputeScriptApiSignatureHash(TestScriptEngine().Get()));
+
+    const auto acquire = [&](const TestScriptEngine &engine, std::uint32_t &outCompileCount, std::uint32_t &outDiskLoadCount) {
+        ScriptModuleCache cache(nullptr, engine.Get());
+        auto lease = cache.Acquire(scriptPath, {}, "ApiChange");
+        TEST_CHECK(engine.CallInt(lease.module, "int Answer(int)", 2) == 42);
+        outCompileCount = cache.GetCompileCount();
+        outDiskLoadCount = cache.GetDiskLoadCount();
+        cache.Release(lease);
+    };
+    std::uint32_t compileCount = 0;
+    std::uint32_t diskLoadCount = 0;
+
+    acquire(baseEngine, compileCount, diskLoadCount);
+    TEST_CHECK(compileCount == 1 && diskLoadCount == 0);
+    acquire(baseEngine, compileCount, diskLoadCount);
+    TEST_CHECK(compileCount == 0 && diskLoadCount == 1);
+
+    // バインディングが1つ増えたエンジンでは、ソースが同じでもバイトコードを読まずにコンパイルし直す
+    acquire(extendedEngine, compileCount, diskLoadCount);
+    TEST_CHECK_MESSAGE(compileCount == 1 && diskLoadCount == 0, "API added");
+    // 同じAPIを登録したエンジンなら、保存し直されたキャッシュを読み込める
+    acquire(sameExtendedEngine, compileCount, diskLoadCount);
+    TEST_CHECK_MESSAGE(compileCount == 0 && diskLoadCount == 1, "same API");
+}
+
+TEST_CASE(ScriptModuleCache_SameScriptSharesOneEntry) {
+    const std::string sharedPath = Tests::GetTemporaryPath(kTemporaryFolder, "ShareShared.as");
+    const std::string globalPath = Tests::GetTemporaryPath(kTemporaryFolder, "ShareGlobal.as");
+    Tests::WriteText(sharedPath, kSharedScript);
+    Tests::WriteText(globalPath, kGlobalStateScript);
+
+    TestScriptEngine engine;
+    ScriptModuleCache cache(nullptr, engine.Get());
+    cache.SetDiskCacheEnabled(false);
+
+    // ScriptComponent::Reload と同じく、インスタンスごとに別のモジュール名を渡して取得する
+    auto first = cache.Acquire(sharedPath, {}, "ScriptComponent_1");
+    auto second = cache.Acquire(sharedPath, {}, "ScriptComponent_2");
+    TEST_CHECK(cache.GetEntryCount() == 1);
+    TEST_CHECK(cache.GetCompileCount() == 1 && cache.GetHitCount() == 1);
+    TEST_CHECK(first.entry == second.entry);
+    // グローバル変数を持たないスクリプトはモジュール自体も共有する（インスタンス専用のモジュールは作らない）
+    TEST_CHECK(first.module && first.module == second.module);
+    TEST_CHECK(first.instanceModuleName.empty() && second.instanceModuleName.empty());
+    TEST_CHECK(engine.Get()->GetModule("ScriptComponent_1", asGM_ONLY_IF_EXISTS) == nullptr);
+
+    // グローバル変数を持つスクリプトも、コンパイルは1度だけでエントリを共有する
+    auto firstGlobal = cache.Acquire(globalPath, {}, "ScriptComponent_3");
+    auto secondGlobal = cache.Acquire(globalPath, {}, "ScriptComponent_4");
+    TEST_CHECK(cache.GetEntryCount() == 2);
+    TEST_CHECK(cache.GetCompileCount() == 2 && cache.GetHitCount() == 2);
+    TEST_CHECK(firstGlobal.entry == secondGlobal.entry);
+    TEST_CHECK(firstGlobal.module == engine.Get()->GetModule("ScriptComponent_3", asGM_ONLY_IF_EXISTS));
+    TEST_CHECK(secondGlobal.module == engine.Get()->GetModule("ScriptComponent_4", asGM_ONLY_IF_EXISTS));
+
+    cache.Release(first);
+    cache.Release(second);
+    cache.Release(firstGlobal);
+    cache.Release(secondGlobal);
+}
+
+TEST_CASE(ScriptModuleCache_DifferentDefinesGetDistinctEntries) {
+    const std::string scriptPath = Tests::GetTemporaryPath(kTemporaryFolder, "Defines.as");
+    Tests::WriteText(scriptPath,
+        "int Base() { return 2; }\n"
+        "#if EDITOR\n"
+        "int EditorOnly() { return 1; }\n"
+        "#endif\n");
+
+    TestScriptEngine engine;
+    ScriptModuleCache cache(nullptr, engine.Get());
+    cache.SetDiskCacheEnabled(false);
+
+    auto plain = cache.Acquire(scriptPath, {}, "DefinesPlain");
+    auto editor = cache.Acquire(scriptPath, { "EDITOR" }, "DefinesEditor");
+    TEST_CHECK(cache.GetEntryCount() == 2 && cache.GetCompileCount() == 2);
+    TEST_CHECK(plain.entry != editor.entry && plain.module != editor.module);
+    TEST_CHECK(engine.CallInt(plain.module, "int Base()") == 2 && engine.CallInt(editor.module, "int Base()") == 2);
+    TEST_CHECK(plain.module && plain.module->GetFunctionByDecl("int EditorOnly()") == nullptr);
+    TEST_CHECK(engine.CallInt(editor.module, "int EditorOnly()") == 1);
+
+    // define集合は順不同・重複無視で同じキーになる
+    auto reordered = cache.Acquire(scriptPath, { "DEBUG", "EDITOR" }, "DefinesReordered");
+    auto same = cache.Acquire(scriptPath, { "EDITOR", "DEBUG", "EDITOR" }, "DefinesSame");
+    TEST_CHECK(cache.GetEntryCount() == 3 && cache.GetCompileCount() == 3 && cache.GetHitCount() == 1);
+    TEST_CHECK(reordered.entry == same.entry && reordered.entry != editor.entry);
+
+    cache.Release(plain);
+    cache.Release(editor);
+    cache.Release(reordered);
+    cache.Release(same);
+}
+
+TEST_CASE(ScriptModuleCache_ReleasingLastLeaseDiscardsModule) {
+    const std::string sharedPath = Tests::GetTemporaryPath(kTemporaryFolder, "ReleaseShared.as");
+    const std::string globalPath = Tests::GetTemporaryPath(kTemporaryFolder, "ReleaseGlobal.as");
+    Tests::WriteText(sharedPath, kSharedScript);
+    Tests::WriteText(globalPath, kGlobalStateScript);
+
+    TestScriptEngine engine;
+    asIScriptEngine *scriptEngine = engine.Get();
+    ScriptModuleCache cache(nullptr, scriptEngine);
+    cache.SetDiskCacheEnabled(false);
+
+    // インスタンス専用のモジュールは、そのインスタンスの利用権を返した時点で破棄される
+    auto firstGlobal = cache.Acquire(globalPath, {}, "ReleaseGlobal_1");
+    auto secondGlobal = cache.Acquire(globalPath, {}, "ReleaseGlobal_2");
+    cache.Release(firstGlobal);
+    TEST_CHECK(!firstGlobal.entry && !firstGlobal.module);
+    TEST_CHECK(scriptEngine->GetModule("ReleaseGlobal_1", asGM_ONLY_IF_EXISTS) == nullptr);
+    TEST_CHECK(engine.CallInt(secondGlobal.module, "int Tick()") == 1);
+    cache.Release(secondGlobal);
+    TEST_CHECK(scriptEngine->GetModule("ReleaseGlobal_2", asGM_ONLY_IF_EXISTS) == nullptr);
+
+    // ソースの変更で置き換えられたエントリは、使用中のインスタンスがある間は古いモジュールのまま動き続け、
+    // 最後の利用権を返した時点でモジュールが破棄される
+    auto oldFirst = cache.Acquire(sharedPath, {}, "ReleaseShared_1");
+    auto oldSecond = cache.Acquire(sharedPath, {}, "ReleaseShared_2");
+    const std::shared_ptr<const ScriptModuleCache::Entry> oldEntry = oldFirst.entry;
+    const asUINT moduleCountBeforeChange = scriptEngine->GetModuleCount();
+    Tests::WriteText(sharedPath, "const int kBase = 10;\nint Answer(int add) { return kBase + add; }\n");
+    auto updated = cache.Acquire(sharedPath, {}, "ReleaseShared_3");
+    TEST_CHECK(updated.entry != oldEntry && oldEntry->IsSuperseded() && !updated.entry->IsSuperseded());
+    TEST_CHECK(cache.GetEntryCount() == 2);
+    TEST_CHECK(scriptEngine->GetModuleCount() == moduleCountBeforeChange + 1);
+    TEST_CHECK(engine.CallInt(updated.module, "int Answer(int)", 2) == 12);
+
+    cache.Release(oldFirst);
+    TEST_CHECK(oldEntry->IsBuilt());
+    TEST_CHECK(engine.CallInt(oldSecond.module, "int Answer(int)", 2) == 42);
+    cache.Release(oldSecond);
+    TEST_CHECK(!oldEntry->IsBuilt());
+    TEST_CHECK(scriptEngine->GetModuleCount() == moduleCountBeforeChange);
+
+    // 置き換えられていない最新のエントリは、利用権が無くなってもキャッシュに残して次の取得で使い回す
+    cache.Release(updated);
+    TEST_CHECK(updated.entry == nullptr);
+    auto reacquired = cache.Acquire(sharedPath, {}, "ReleaseShared_4");
+    TEST_CHECK(reacquired.entry->IsBuilt() && engine.CallInt(reacquired.module, "int Answer(int)", 2) == 12);
+    TEST_CHECK(cache.GetCompileCount() == 3);
+    cache.Release(reacquired);
+
+    cache.Clear();
+    TEST_CHECK(cache.GetEntryCount() == 0 && scriptEngine->GetModuleCount() == 0);
+}
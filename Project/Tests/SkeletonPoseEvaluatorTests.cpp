@@ -0,0 +1,343 @@
+// SkeletonPoseEvaluator（Animator の姿勢評価）のテストと、並列評価・アニメーションLODのベンチマーク
+//
+// Plugin::ParallelFor でインスタンス単位に並列評価したジョイント行列が逐次評価と完全に一致すること、
+// 間引き評価（HalfRate / ReducedBones）が毎フレームの評価に近い姿勢を保つことと、
+// 保持しているクリップのバインディング（BindClip）がクリップ・スケルトンの差し替えで作り直されることを確かめる。
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "TestFramework.h"
+#include "Assets/AnimationClipCompression.h"
+#include "Assets/AnimationManager.h"
+#include "Assets/SkeletonPoseEvaluator.h"
+#include "Utilities/Plugin/Plugins.h"
+#include "Utilities/Plugin/Thread/JobSystem.h"
+
+using namespace KashipanEngine;
+using Plugin::JobSystem;
+
+namespace {
+
+constexpr float kFrameTime = 1.0f / 60.0f;
+/// @brief Animator::EndBatchUpdate と同じ、ジョブ1つが受け持つインスタンスの最小数
+constexpr size_t kGrainSize = 4;
+
+/// @brief 各ジョイントが depth 段の子を2つずつ持つ木（人型の手足・指程度の深さ）のスケルトンを作る
+Skeleton MakeSkeleton(int depth) {
+    Skeleton skeleton{};
+    skeleton.rootJointIndex = 0;
+    std::vector<int> depths;
+    auto addJoint = [&](std::optional<int32_t> parentIndex) {
+        SkeletonJoint joint;
+        joint.transform = std::make_unique<SkeletonTransform>();
+        joint.transform->SetTranslate(Vector3(0.0f, 0.5f, 0.0f));
+        joint.transform->CaptureBindPose();
+        joint.name = "Joint" + std::to_string(skeleton.joints.size());
+        joint.parentIndex = parentIndex;
+        const int32_t index = static_cast<int32_t>(skeleton.joints.size());
+        if (parentIndex) {
+            skeleton.joints[static_cast<size_t>(*parentIndex)].childrenIndices.push_back(index);
+            joint.transform->SetParent(skeleton.joints[static_cast<size_t>(*parentIndex)].transform.get());
+        }
+        depths.push_back(parentIndex ? depths[static_cast<size_t>(*parentIndex)] + 1 : 0);
+        skeleton.jointNameToIndexMap.emplace(joint.name, index);
+        skeleton.joints.push_back(std::move(joint));
+    };
+    addJoint(std::nullopt);
+    for (size_t i = 0; i < skeleton.joints.size(); ++i) {
+        if (depths[i] >= depth) continue;
+        addJoint(static_cast<int32_t>(i));
+        addJoint(static_cast<int32_t>(i));
+    }
+    return skeleton;
+}
+
+/// @brief ジョイントごとに平行移動3本と回転1本のタイムラインを持つクリップ（30fpsのキー、4秒）を作る
+std::vector<CompressedTimeline> MakeClipTimelines(size_t jointCount, float phaseOffset = 0.0f) {
+    constexpr float kDuration = 4.0f;
+    constexpr float kKeysPerSecond = 30.0f;
+    const int keyCount = static_cast<int>(kDuration * kKeysPerSecond) + 1;
+    std::vector<CompressedTimeline> timelines;
+    for (size_t joint = 0; joint < jointCount; ++joint) {
+        const float phase = static_cast<float>(joint) * 0.37f + phaseOffset;
+        for (int axis = 0; axis < 3; ++axis) {
+            KeyframeTimeline source;
+            source.valueType = KeyframeValueType::Float;
+            source.duration = kDuration;
+            for (int i = 0; i < keyCount; ++i) {
+                const float time = static_cast<float>(i) / kKeysPerSecond;
+                source.keys.push_back({ time, 0.2f * std::sin(time * (2.0f + static_cast<float>(axis)) + phase), EaseType::Linear });
+            }
+            timelines.push_back(CompressTimelineWithinTolerance(source, 0.0005f).timeline);
+        }
+        KeyframeTimeline source;
+        source.valueType = KeyframeValueType::Quaternion;
+        source.duration = kDuration;
+        for (int i = 0; i < keyCount; ++i) {
+            const float time = static_cast<float>(i) / kKeysPerSecond;
+            const float angle = 0.6f * std::sin(time * 3.0f + phase);
+            source.keys.push_back({ time, Quaternion(std::sin(angle * 0.5f), 0.0f, 0.0f, std::cos(angle * 0.5f)), EaseType::Linear });
+        }
+        timelines.push_back(CompressTimelineWithinTolerance(source, 0.001f).timeline);
+    }
+    return timelines;
+}
+
+/// @brief MakeClipTimelines のタイムラインに AnimationManager と同じ名前（"ジョイント名.Translate.X" 等）を付けたクリップを作る
+AnimationClip MakeClip(size_t jointCount, float phaseOffset) {
+    static constexpr const char *kSuffixes[] = { ".Translate.X", ".Translate.Y", ".Translate.Z", ".Rotate" };
+    AnimationClip clip;
+    clip.compressedTimelines = MakeClipTimelines(jointCount, phaseOffset);
+    for (uint32_t i = 0; i < clip.compressedTimelines.size(); ++i) {
+        const std::string nodeName = "Joint" + std::to_string(i / 4);
+        KeyframeTimeline timeline;
+        timeline.name = nodeName + kSuffixes[i % 4];
+        timeline.valueType = i % 4 == 3 ? KeyframeValueType::Quaternion : KeyframeValueType::Float;
+        timeline.duration = clip.compressedTimelines[i].duration;
+        clip.duration = std::max(clip.duration, timeline.duration);
+        clip.timelines.push_back(std::move(timeline));
+        clip.nodeNameToTimelineIndices[nodeName].push_back(i);
+    }
+    return clip;
+}
+
+/// @brief ジョイント名を逆順に付け直したスケルトン（同じ名前のジョイントが別の番号になる）を作る
+Skeleton MakeRenamedSkeleton(int depth) {
+    Skeleton skeleton = MakeSkeleton(depth);
+    skeleton.jointNameToIndexMap.clear();
+    const size_t jointCount = skeleton.joints.size();
+    for (size_t i = 0; i < jointCount; ++i) {
+        skeleton.joints[i].name = "Joint" + std::to_string(jointCount - 1 - i);
+        skeleton.jointNameToIndexMap.emplace(skeleton.joints[i].name, static_cast<int32_t>(i));
+    }
+    return skeleton;
+}
+
+/// @brief 新しく作った姿勢評価で、クリップを time の姿勢へ評価したジョイント行列
+std::vector<Matrix4x4> EvaluateFresh(Skeleton skeleton, const AnimationClip &clip, float time) {
+    SkeletonPoseEvaluator evaluator;
+    evaluator.SetSkeleton(std::move(skeleton));
+    evaluator.Evaluate(evaluator.BindClip(&clip), AnimationLod::Full, time, kFrameTime, true, 2);
+    return evaluator.GetJointMatrices();
+}
+
+SkeletonPoseEvaluator::ClipBinding MakeBinding(const std::vector<CompressedTimeline> &timelines) {
+    using Channel = SkeletonPoseEvaluator::Channel;
+    SkeletonPoseEvaluator::ClipBinding binding;
+    binding.timelines = &timelines;
+    for (uint32_t i = 0; i < timelines.size(); ++i) {
+        static constexpr Channel kChannels[] = { Channel::TranslateX, Channel::TranslateY, Channel::TranslateZ, Channel::Rotate };
+        binding.channels.push_back({ i / 4, i, kChannels[i % 4], {} });
+        binding.endTime = std::max(binding.endTime, timelines[i].duration);
+    }
+    return binding;
+}
+
+/// @brief Animator と同じく、インスタンスごとに姿勢評価・バインディング（カーソル）・再生時刻・LODを持つ
+struct Instance final {
+    SkeletonPoseEvaluator evaluator;
+    SkeletonPoseEvaluator::ClipBinding binding;
+    float time = 0.0f;
+    AnimationLod lod = AnimationLod::Full;
+};
+
+std::vector<Instance> MakeInstances(size_t count, int depth, const std::vector<CompressedTimeline> &timelines, bool mixLods) {
+    std::vector<Instance> instances(count);
+    for (size_t i = 0; i < count; ++i) {
+        instances[i].evaluator.SetSkeleton(MakeSkeleton(depth));
+        instances[i].binding = MakeBinding(timelines);
+        // 再生位置をずらして、同じ姿勢ばかり評価しないようにする
+        instances[i].time = static_cast<float>(i % 97) * 0.041f;
+        if (mixLods) {
+            // Auto で距離に応じて選ばれる段階の、典型的な混ざり方（近くの少数だけを毎フレーム評価する）
+            static constexpr AnimationLod kLods[] = { AnimationLod::Full, AnimationLod::HalfRate, AnimationLod::HalfRate,
+                AnimationLod::ReducedBones, AnimationLod::ReducedBones, AnimationLod::ReducedBones, AnimationLod::Frozen, AnimationLod::Frozen };
+            instances[i].lod = kLods[i % std::size(kLods)];
+        }
+    }
+    return instances;
+}
+
+/// @brief 1フレーム分、Animator::UpdateBatch / EndBatchUpdate と同じ手順で全インスタンスを評価する
+void EvaluateFrame(std::vector<Instance> &instances) {
+    for (auto &instance : instances) instance.time += kFrameTime;
+    Plugin::ParallelFor(instances.size(), kGrainSize, [&instances](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            auto &instance = instances[i];
+            // Frozen は Animator と同じく再生時間だけを進め、クリップを渡さない
+            auto *binding = instance.lod == AnimationLod::Frozen ? nullptr : &instance.binding;
+            instance.evaluator.Evaluate(binding, instance.lod, instance.time, kFrameTime, true, 2);
+        }
+    });
+}
+
+float MaxTranslationDifference(const std::vector<Matrix4x4> &a, const std::vector<Matrix4x4> &b) {
+    float maxDifference = 0.0f;
+    for (size_t i = 0; i < a.size(); ++i) {
+        for (int axis = 0; axis < 3; ++axis) maxDifference = std::max(maxDifference, std::abs(a[i].m[3][axis] - b[i].m[3][axis]));
+    }
+    return maxDifference;
+}
+
+} // namespace
+
+TEST_CASE(SkeletonPoseEvaluator_ParallelMatchesSerial) {
+    const auto timelines = MakeClipTimelines(MakeSkeleton(4).joints.size());
+    auto serial = MakeInstances(64, 4, timelines, true);
+    auto parallel = MakeInstances(64, 4, timelines, true);
+    JobSystem jobSystem(4);
+
+    for (int frame = 0; frame < 30; ++frame) {
+        Tests::WithJobSystem(nullptr, [&]() { EvaluateFrame(serial); });
+        Tests::WithJobSystem(&jobSystem, [&]() { EvaluateFrame(parallel); });
+    }
+    // HalfRate / ReducedBones は評価を始めるフレームをインスタンスのアドレスでずらすため、
+    // 逐次と並列で結果が揃うのは毎フレーム評価する Full のインスタンスだけになる
+    size_t mismatched = 0;
+    for (size_t i = 0; i < serial.size(); ++i) {
+        if (serial[i].lod != AnimationLod::Full) continue;
+        if (MaxTranslationDifference(serial[i].evaluator.GetJointMatrices(), parallel[i].evaluator.GetJointMatrices()) != 0.0f) ++mismatched;
+    }
+    TEST_CHECK_MESSAGE(mismatched == 0, std::to_string(mismatched) + " instances differ between serial and parallel evaluation");
+}
+
+TEST_CASE(SkeletonPoseEvaluator_ThrottledLodStaysCloseToFull) {
+    const auto timelines = MakeClipTimelines(MakeSkeleton(5).joints.size());
+    auto instances = MakeInstances(3, 5, timelines, false);
+    for (auto &instance : instances) instance.time = 0.0f;
+    // Animator と同じく、Full で評価していた状態から距離が離れて間引き評価へ切り替わる
+    // （間引き評価は直前の姿勢を補間の始点にするため、バインドポーズからいきなり始めると最初の1フレームが補間途中になる）
+    Tests::WithJobSystem(nullptr, [&]() { EvaluateFrame(instances); });
+    instances[1].lod = AnimationLod::HalfRate;
+    instances[2].lod = AnimationLod::ReducedBones;
+    std::vector<Vector3> switchedPose;
+    for (const auto &joint : instances[2].evaluator.GetSkeleton().joints) switchedPose.push_back(joint.transform->GetTranslate());
+
+    float halfRateError = 0.0f;
+    for (int frame = 0; frame < 120; ++frame) {
+        Tests::WithJobSystem(nullptr, [&]() { EvaluateFrame(instances); });
+        halfRateError = std::max(halfRateError,
+            MaxTranslationDifference(instances[0].evaluator.GetJointMatrices(), instances[1].evaluator.GetJointMatrices()));
+    }
+    // 補間は1フレーム分の先読みとの間で行うため、ずれはクリップの1フレーム分の移動量より十分小さい
+    TEST_CHECK_MESSAGE(halfRateError < 0.005f, "HalfRate drifted by " + std::to_string(halfRateError));
+
+    // ReducedBones は深さ2より深いジョイントのローカル姿勢を切り替えた時点のまま残し、浅いジョイントだけを動かし続ける
+    const auto &skeleton = instances[2].evaluator.GetSkeleton();
+    size_t movedDeepJoints = 0;
+    size_t animatedShallowJoints = 0;
+    for (size_t i = 0; i < skeleton.joints.size(); ++i) {
+        const auto &translate = skeleton.joints[i].transform->GetTranslate();
+        const bool isUnchanged = translate.x == switchedPose[i].x && translate.y == switchedPose[i].y && translate.z == switchedPose[i].z;
+        if (instances[2].evaluator.GetJointDepth(i) > 2) {
+            movedDeepJoints += isUnchanged ? 0 : 1;
+        } else {
+            animatedShallowJoints += isUnchanged ? 0 : 1;
+        }
+    }
+    TEST_CHECK(movedDeepJoints == 0);
+    TEST_CHECK(animatedShallowJoints > 0);
+}
+
+TEST_CASE(SkeletonPoseEvaluator_ClipBindingRebuiltWhenClipSwapped) {
+    constexpr int kDepth = 3;
+    const size_t jointCount = MakeSkeleton(kDepth).joints.size();
+    const AnimationClip walk = MakeClip(jointCount, 0.0f);
+    const AnimationClip run = MakeClip(jointCount, 1.3f);
+    SkeletonPoseEvaluator evaluator;
+    evaluator.SetSkeleton(MakeSkeleton(kDepth));
+    TEST_CHECK(evaluator.BindClip(nullptr) == nullptr);
+
+    auto *binding = evaluator.BindClip(&walk);
+    TEST_CHECK(binding && binding->timelines == &walk.compressedTimelines);
+    TEST_CHECK(binding && binding->channels.size() == walk.timelines.size());
+    float time = 0.0f;
+    for (int frame = 0; frame < 20; ++frame) {
+        time += kFrameTime;
+        evaluator.Evaluate(evaluator.BindClip(&walk), AnimationLod::Full, time, kFrameTime, true, 2);
+    }
+
+    // Animator がクリップ名を変えた場合と同じく、同じ姿勢評価へ別のクリップを渡す
+    for (int frame = 0; frame < 20; ++frame) {
+        time += kFrameTime;
+        binding = evaluator.BindClip(&run);
+        evaluator.Evaluate(binding, AnimationLod::Full, time, kFrameTime, true, 2);
+    }
+    TEST_CHECK(binding && binding->timelines == &run.compressedTimelines);
+    const auto &swapped = evaluator.GetJointMatrices();
+    const float difference = MaxTranslationDifference(swapped, EvaluateFresh(MakeSkeleton(kDepth), run, time));
+    TEST_CHECK_MESSAGE(difference == 0.0f, "swapped clip differs from a fresh evaluation by " + std::to_string(difference));
+    // 古いクリップのままなら姿勢が変わることを確かめ、上の比較が差し替えを見分けられることを保証する
+    TEST_CHECK(MaxTranslationDifference(swapped, EvaluateFresh(MakeSkeleton(kDepth), walk, time)) > 0.01f);
+
+    // 同じクリップのキーを読み直した場合は、InvalidateClipBinding の後で作り直される
+    AnimationClip reloaded = MakeClip(jointCount, 0.0f);
+    const auto boundChannelCount = [&evaluator, &reloaded]() {
+        auto *reloadedBinding = evaluator.BindClip(&reloaded);
+        return reloadedBinding ? reloadedBinding->channels.size() : 0;
+    };
+    TEST_CHECK(boundChannelCount() == reloaded.timelines.size());
+    reloaded.nodeNameToTimelineIndices.erase("Joint0");
+    TEST_CHECK(boundChannelCount() == reloaded.timelines.size());
+    evaluator.InvalidateClipBinding();
+    TEST_CHECK(boundChannelCount() == reloaded.timelines.size() - 4);
+}
+
+TEST_CASE(SkeletonPoseEvaluator_ClipBindingRebuiltWhenSkeletonSwapped) {
+    constexpr int kDepth = 3;
+    const size_t jointCount = MakeSkeleton(kDepth).joints.size();
+    const AnimationClip clip = MakeClip(jointCount, 0.0f);
+    SkeletonPoseEvaluator evaluator;
+    evaluator.SetSkeleton(MakeSkeleton(kDepth));
+    float time = 0.0f;
+    for (int frame = 0; frame < 20; ++frame) {
+        time += kFrameTime;
+        evaluator.Evaluate(evaluator.BindClip(&clip), AnimationLod::Full, time, kFrameTime, true, 2);
+    }
+
+    // Animator がメッシュの変更でスケルトンを複製し直した場合と同じく、同じクリップのまま別のスケルトンへ差し替える
+    evaluator.SetSkeleton(MakeRenamedSkeleton(kDepth));
+    auto *binding = evaluator.BindClip(&clip);
+    // 先頭のジョイントは、クリップ上では最後のジョイントのタイムラインで動く
+    TEST_CHECK(binding && !binding->channels.empty() && binding->channels.front().timelineIndex == (jointCount - 1) * 4);
+    for (int frame = 0; frame < 20; ++frame) {
+        time += kFrameTime;
+        evaluator.Evaluate(evaluator.BindClip(&clip), AnimationLod::Full, time, kFrameTime, true, 2);
+    }
+    const auto &swapped = evaluator.GetJointMatrices();
+    const float difference = MaxTranslationDifference(swapped, EvaluateFresh(MakeRenamedSkeleton(kDepth), clip, time));
+    TEST_CHECK_MESSAGE(difference == 0.0f, "swapped skeleton differs from a fresh evaluation by " + std::to_string(difference));
+    // 古いスケルトンのジョイント番号のままなら姿勢が変わる
+    TEST_CHECK(MaxTranslationDifference(swapped, EvaluateFresh(MakeSkeleton(kDepth), clip, time)) > 0.01f);
+}
+
+BENCHMARK_CASE(SkeletonPoseEvaluator_ParallelAndLod) {
+    // 63ジョイントのスケルトン500体を60フレーム評価する
+    constexpr size_t kInstanceCount = 500;
+    constexpr int kDepth = 5;
+    constexpr int kFrameCount = 60;
+    const auto timelines = MakeClipTimelines(MakeSkeleton(kDepth).joints.size());
+    JobSystem jobSystem;
+
+    const auto run = [&](JobSystem *jobs, bool mixLods) {
+        auto instances = MakeInstances(kInstanceCount, kDepth, timelines, mixLods);
+        const double ms = Tests::MeasureMilliseconds([&]() {
+            Tests::WithJobSystem(jobs, [&]() {
+                for (int frame = 0; frame < kFrameCount; ++frame) EvaluateFrame(instances);
+            });
+        });
+        return ms / kFrameCount;
+    };
+
+    Tests::ReportBenchmark("Animator 500 x 63 joints, serial, all Full (per frame)", run(nullptr, false), "ms");
+    Tests::ReportBenchmark("Animator 500 x 63 joints, parallel, all Full (per frame)", run(&jobSystem, false), "ms");
+    Tests::ReportBenchmark("Animator 500 x 63 joints, serial, LOD mix (per frame)", run(nullptr, true), "ms");
+    Tests::ReportBenchmark("Animator 500 x 63 joints, parallel, LOD mix (per frame)", run(&jobSystem, true), "ms");
+    Tests::ReportBenchmark("Animator worker threads", static_cast<double>(jobSystem.GetWorkerCount()), "threads");
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "Utilities/Conversion/ConvertString.h"
+
+namespace Tests {
+
+/// @brief テスト用の一時フォルダ（KashipanEngineTests/subfolder）内のパス（UTF-8）
+/// @details テストファイルごとに subfolder を分け、同じファイル名を使っても他のテストの結果を上書きしないようにする
+inline std::string GetTemporaryPath(const std::string &subfolder, const std::string &fileName) {
+    const std::filesystem::path directory = std::filesystem::temp_directory_path() / "KashipanEngineTests" / subfolder;
+    std::filesystem::create_directories(directory);
+    return KashipanEngine::PathToUtf8String(directory / fileName);
+}
+
+inline bool WriteText(const std::string &path, const std::string &text) {
+    std::ofstream file(KashipanEngine::Utf8StringToPath(path), std::ios::binary | std::ios::trunc);
+    file << text;
+    return static_cast<bool>(file);
+}
+
+inline std::vector<std::uint8_t> ReadBytes(const std::string &path) {
+    std::ifstream file(KashipanEngine::Utf8StringToPath(path), std::ios::binary);
+    return std::vector<std::uint8_t>((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+}
+
+inline bool WriteBytes(const std::string &path, const std::vector<std::uint8_t> &bytes) {
+    std::ofstream file(KashipanEngine::Utf8StringToPath(path), std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char *>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    return static_cast<bool>(file);
+}
+
+} // namespace Tests
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "Utilities/Plugin/Plugins.h"
+
+namespace Tests {
+
+/// @brief 登録された1件のテスト（またはベンチマーク）
+struct TestCase {
+    const char *name = nullptr;
+    void (*function)() = nullptr;
+    /// @brief ベンチマークの場合は true（--bench 指定時だけ実行する）
+    bool isBenchmark = false;
+};
+
+/// @brief 登録済みのテストの一覧を返す
+/// @details 静的初期化の順序に依存しないよう、関数内の静的変数として保持する
+std::vector<TestCase> &GetTestCases();
+
+/// @brief 静的変数の初期化でテストを登録するためのヘルパー
+struct TestRegistrar {
+    TestRegistrar(const char *name, void (*function)(), bool isBenchmark) {
+        GetTestCases().push_back(TestCase{ name, function, isBenchmark });
+    }
+};
+
+/// @brief 検証の失敗を報告する（実行中のテストは失敗扱いになるが、最後まで実行は続ける）
+void ReportFailure(const std::string &message, const char *file, int line);
+
+/// @brief ベンチマークの計測結果を1行出力する
+void ReportBenchmark(const std::string &name, double value, const char *unit);
+
+/// @brief 処理を1回実行し、かかった時間をミリ秒で返す
+template<typename Func>
+double MeasureMilliseconds(Func &&func) {
+    const auto start = std::chrono::steady_clock::now();
+    func();
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+/// @brief 処理をrepeatCount回計測し、最も速かった時間をミリ秒で返す（ファイルキャッシュや割り込みの影響を除くため）
+template<typename Func>
+double MeasureBestMilliseconds(size_t repeatCount, Func &&func) {
+    double best = -1.0;
+    for (size_t i = 0; i < repeatCount; ++i) {
+        const double ms = MeasureMilliseconds(func);
+        if (best < 0.0 || ms < best) best = ms;
+    }
+    return best;
+}
+
+/// @brief スコープの間だけ Plugin::jobSystem を差し替える（例外で抜けた場合も元に戻す）
+class ScopedJobSystem final {
+public:
+    explicit ScopedJobSystem(Plugin::JobSystem *jobSystem) : previous_(Plugin::jobSystem) { Plugin::jobSystem = jobSystem; }
+    ~ScopedJobSystem() { Plugin::jobSystem = previous_; }
+    ScopedJobSystem(const ScopedJobSystem &) = delete;
+    ScopedJobSystem &operator=(const ScopedJobSystem &) = delete;
+
+private:
+    Plugin::JobSystem *previous_;
+};
+
+/// @brief 関数の実行中だけ Plugin::jobSystem を差し替え、関数の戻り値を返す（nullptr の場合は呼び出し元スレッドで順に実行される）
+template<typename Func>
+auto WithJobSystem(Plugin::JobSystem *jobSystem, Func &&func) {
+    const ScopedJobSystem scopedJobSystem(jobSystem);
+    return func();
+}
+
+} // namespace Tests
+
+/// @brief テストを定義して登録する
+#define TEST_CASE(name) \
+    static void name(); \
+    static const ::Tests::TestRegistrar name##Registrar(#name, &name, false); \
+    static void name()
+
+/// @brief ベンチマークを定義して登録する（--bench 指定時だけ実行される）
+#define BENCHMARK_CASE(name) \
+    static void name(); \
+    static const ::Tests::TestRegistrar name##Registrar(#name, &name, true); \
+    static void name()
+
+/// @brief 条件が成り立つことを検証する
+#define TEST_CHECK(expression) \
+    do { \
+        if (!(expression)) ::Tests::ReportFailure(#expression, __FILE__, __LINE__); \
+    } while (false)
+
+/// @brief 条件が成り立つことを検証し、失敗した場合は補足情報も出力する
+#define TEST_CHECK_MESSAGE(expression, message) \
+    do { \
+        if (!(expression)) ::Tests::ReportFailure(std::string(#expression) + " (" + (message) + ")", __FILE__, __LINE__); \
+    } while (false)
@@ -0,0 +1,76 @@
+// KashipanEngine のテスト・ベンチマーク実行用コンソールアプリ
+//
+// エンジンのうちDirectX・ImGuiに依存しない部分（ジョブシステム、WFC、アニメーション、
+// シーンのバイナリ形式など）のソースを直接取り込み、ヘッドレスで検証する。
+//
+// 使い方:
+//   KashipanEngineTests.exe                 全てのテストを実行する（失敗があれば終了コード1）
+//   KashipanEngineTests.exe --bench         全てのベンチマークを実行する
+//   KashipanEngineTests.exe --filter <文字列> 名前に文字列を含むものだけを実行する
+
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <string>
+
+#include "TestFramework.h"
+
+namespace {
+
+/// @brief 実行中のテストで報告された失敗の数
+int gFailureCount = 0;
+
+} // namespace
+
+std::vector<Tests::TestCase> &Tests::GetTestCases() {
+    static std::vector<TestCase> testCases;
+    return testCases;
+}
+
+void Tests::ReportFailure(const std::string &message, const char *file, int line) {
+    ++gFailureCount;
+    std::printf("    FAILED: %s\n      at %s(%d)\n", message.c_str(), file, line);
+}
+
+void Tests::ReportBenchmark(const std::string &name, double value, const char *unit) {
+    std::printf("    %-48s %12.3f %s\n", name.c_str(), value, unit);
+}
+
+int main(int argc, char **argv) {
+    bool runBenchmarks = false;
+    std::string filter;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--bench") == 0) {
+            runBenchmarks = true;
+        } else if (std::strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+            filter = argv[++i];
+        }
+    }
+
+    int executedCount = 0;
+    int failedCount = 0;
+    for (const auto &testCase : Tests::GetTestCases()) {
+        if (testCase.isBenchmark != runBenchmarks) continue;
+        if (!filter.empty() && std::string(testCase.name).find(filter) == std::string::npos) continue;
+
+        std::printf("[ RUN  ] %s\n", testCase.name);
+        std::fflush(stdout);
+        gFailureCount = 0;
+        try {
+            testCase.function();
+        } catch (const std::exception &e) {
+            Tests::ReportFailure(std::string("例外が送出されました: ") + e.what(), __FILE__, __LINE__);
+        }
+        ++executedCount;
+        if (gFailureCount > 0) {
+            ++failedCount;
+            std::printf("[ FAIL ] %s\n", testCase.name);
+        } else {
+            std::printf("[  OK  ] %s\n", testCase.name);
+        }
+        std::fflush(stdout);
+    }
+
+    std::printf("%d / %d passed\n", executedCount - failedCount, executedCount);
+    return failedCount == 0 ? 0 : 1;
+}
@@ -0,0 +1,165 @@
+// TransformHierarchy（シーンのTransform階層表）のフレームの途中の読み取りのテストとベンチマーク
+//
+// 一括更新（UpdateWorldMatrices）の前にローカル値を変えたTransformのワールド行列を読むと、スレッドごとの控えを使っても
+// 一括更新後と同じ値になることと、ダーティフラグが立った後の変更・親の付け替えでは控えが使われないことを確かめる。
+// 親の付け替え直後に別のスレッドから読んでも表が再構築されず、PrepareParallelReads の後は新しい親で計算されることも確かめる。
+// シーンは Tests/Fakes/SceneFakes.cpp の差し替え（オブジェクトの生成とコンポーネントのプールだけ）を使う。
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "TestFramework.h"
+#include "Objects/Components/Transform.h"
+#include "Objects/EmptyObject.h"
+#include "Scene/Scene.h"
+#include "Scene/SceneContext.h"
+
+using KashipanEngine::EmptyObject;
+using KashipanEngine::Scene;
+using KashipanEngine::Transform;
+using KashipanEngine::TransformHierarchy;
+
+namespace {
+
+/// @brief depth 段の親子の鎖を作り、各段のTransformを根から順に返す
+std::vector<Transform *> MakeChain(Scene &scene, int depth, const std::string &name) {
+    std::vector<Transform *> chain;
+    EmptyObject *parent = nullptr;
+    for (int i = 0; i < depth; ++i) {
+        EmptyObject *object = scene.GetSceneContext()->CreateEmptyObject(name + std::to_string(i));
+        // オブジェクトは生成時に Transform を持つ
+        auto *transform = object->GetComponent<Transform>();
+        transform->SetTranslate(Vector3(1.0f, 0.0f, 0.0f));
+        transform->SetRotate(Vector3(0.0f, 0.1f * static_cast<float>(i + 1), 0.0f));
+        if (parent) transform->SetParentObject(parent);
+        chain.push_back(transform);
+        parent = object;
+    }
+    return chain;
+}
+
+float MaxDifference(const Matrix4x4 &a, const Matrix4x4 &b) {
+    float maxDifference = 0.0f;
+    for (int row = 0; row < 4; ++row) {
+        for (int column = 0; column < 4; ++column) maxDifference = std::max(maxDifference, std::abs(a.m[row][column] - b.m[row][column]));
+    }
+    return maxDifference;
+}
+
+} // namespace
+
+TEST_CASE(TransformHierarchy_MidFrameReadsMatchBatchUpdate) {
+    Scene scene(std::string("TransformHierarchyTest"));
+    TransformHierarchy &hierarchy = scene.GetSceneContext()->GetTransformHierarchy();
+    const auto chain = MakeChain(scene, 6, "Chain");
+    hierarchy.UpdateWorldMatrices();
+    Transform *leaf = chain.back();
+
+    chain[1]->SetTranslate(Vector3(0.0f, 2.0f, 0.0f));
+    const Matrix4x4 first = leaf->GetWorldMatrix();
+    // 読み取りは表へ書き込まないため、一括更新までは未計算のまま
+    TEST_CHECK(!leaf->IsWorldMatrixCalculated());
+    // 2回目は控えから返り、同じ値になる
+    TEST_CHECK(MaxDifference(leaf->GetWorldMatrix(), first) == 0.0f);
+    // 控えは読み取ったスレッドごとのため、別のスレッドでも同じ値を計算する
+    Matrix4x4 otherThread;
+    std::thread([&]() { otherThread = leaf->GetWorldMatrix(); }).join();
+    TEST_CHECK(MaxDifference(otherThread, first) == 0.0f);
+
+    // ダーティフラグが立ったままの祖先をもう一度変更しても、控えは使われない
+    chain[1]->SetTranslate(Vector3(0.0f, 3.0f, 0.0f));
+    const Matrix4x4 second = leaf->GetWorldMatrix();
+    TEST_CHECK(MaxDifference(first, second) > 0.5f);
+    // 葉を読んだときに控えへ残った祖先も、祖先自身の読み取りで同じ値を返す
+    const Matrix4x4 middle = chain[3]->GetWorldMatrix();
+
+    hierarchy.UpdateWorldMatrices();
+    TEST_CHECK(leaf->IsWorldMatrixCalculated());
+    TEST_CHECK(MaxDifference(leaf->GetWorldMatrix(), second) == 0.0f);
+    TEST_CHECK(MaxDifference(chain[3]->GetWorldMatrix(), middle) == 0.0f);
+}
+
+TEST_CASE(TransformHierarchy_MidFrameReadAfterReparent) {
+    Scene scene(std::string("TransformHierarchyTest"));
+    TransformHierarchy &hierarchy = scene.GetSceneContext()->GetTransformHierarchy();
+    const auto chainA = MakeChain(scene, 4, "ChainA");
+    const auto chainB = MakeChain(scene, 4, "ChainB");
+    chainB.front()->SetTranslate(Vector3(0.0f, 0.0f, 5.0f));
+    hierarchy.UpdateWorldMatrices();
+    Transform *leaf = chainA.back();
+
+    chainA[1]->SetScale(Vector3(2.0f, 2.0f, 2.0f));
+    const Matrix4x4 beforeReparent = leaf->GetWorldMatrix();
+    // 親の付け替えで構造が作り直されると、インデックスが同じでも前の構造の控えは使われない
+    leaf->SetParentObject(chainB.back()->GetOwnerObject()->GetObjectID());
+    const Matrix4x4 afterReparent = leaf->GetWorldMatrix();
+    TEST_CHECK(MaxDifference(beforeReparent, afterReparent) > 0.5f);
+
+    hierarchy.UpdateWorldMatrices();
+    TEST_CHECK(MaxDifference(leaf->GetWorldMatrix(), afterReparent) == 0.0f);
+}
+
+TEST_CASE(TransformHierarchy_WorkerReadsDoNotRebuildStructure) {
+    Scene scene(std::string("TransformHierarchyTest"));
+    TransformHierarchy &hierarchy = scene.GetSceneContext()->GetTransformHierarchy();
+    const auto chain = MakeChain(scene, 4, "Chain");
+    EmptyObject *newParent = scene.GetSceneContext()->CreateEmptyObject("NewParent");
+    newParent->GetComponent<Transform>()->SetTranslate(Vector3(0.0f, 0.0f, 7.0f));
+    hierarchy.UpdateWorldMatrices();
+    Transform *leaf = chain.back();
+    const Matrix4x4 beforeReparent = leaf->GetWorldMatrix();
+
+    // 親の付け替えで再構築が予約された状態で、別のスレッドから読む
+    leaf->SetParentObject(newParent);
+    Matrix4x4 workerRead;
+    Transform *workerParent = nullptr;
+    std::thread([&]() {
+        workerRead = leaf->GetWorldMatrix();
+        workerParent = hierarchy.GetParentTransform(*leaf);
+    }).join();
+    // 表は再構築されず前回の一括更新の値が返り、親はUUIDから解決される
+    TEST_CHECK(MaxDifference(workerRead, beforeReparent) == 0.0f);
+    TEST_CHECK(workerParent == newParent->GetComponent<Transform>());
+    TEST_CHECK(!leaf->IsWorldMatrixCalculated());
+
+    // 所有スレッドで再構築を済ませた後は、別のスレッドからも新しい親で計算される
+    hierarchy.PrepareParallelReads();
+    std::thread([&]() { workerRead = leaf->GetWorldMatrix(); }).join();
+    TEST_CHECK(MaxDifference(workerRead, beforeReparent) > 0.5f);
+    hierarchy.UpdateWorldMatrices();
+    TEST_CHECK(MaxDifference(leaf->GetWorldMatrix(), workerRead) == 0.0f);
+}
+
+BENCHMARK_CASE(TransformHierarchy_MidFrameReads) {
+    // 深さ8の鎖64本（512個）の根を動かし、一括更新の前に全ての葉のワールド行列を読む
+    constexpr int kChainCount = 64;
+    constexpr int kDepth = 8;
+    Scene scene(std::string("TransformHierarchyBenchmark"));
+    TransformHierarchy &hierarchy = scene.GetSceneContext()->GetTransformHierarchy();
+    std::vector<std::vector<Transform *>> chains;
+    for (int i = 0; i < kChainCount; ++i) chains.push_back(MakeChain(scene, kDepth, "Chain" + std::to_string(i) + "_"));
+    hierarchy.UpdateWorldMatrices();
+
+    float sink = 0.0f;
+    float offset = 0.0f;
+    const auto readLeaves = [&]() {
+        for (const auto &chain : chains) sink += chain.back()->GetWorldMatrix().m[3][0];
+    };
+    const double firstReadMs = Tests::MeasureBestMilliseconds(20, [&]() {
+        offset += 0.01f;
+        for (const auto &chain : chains) chain.front()->SetTranslate(Vector3(offset, 0.0f, 0.0f));
+        readLeaves();
+    });
+    // 根を動かした直後の状態のまま読み直す（控えから返る）
+    const double repeatedReadMs = Tests::MeasureBestMilliseconds(20, readLeaves);
+    hierarchy.UpdateWorldMatrices();
+    const double updatedReadMs = Tests::MeasureBestMilliseconds(20, readLeaves);
+
+    Tests::ReportBenchmark("TransformHierarchy 64 leaves at depth 8, first mid-frame read", firstReadMs * 1000.0, "us");
+    Tests::ReportBenchmark("TransformHierarchy 64 leaves at depth 8, repeated mid-frame read", repeatedReadMs * 1000.0, "us");
+    Tests::ReportBenchmark("TransformHierarchy 64 leaves at depth 8, read after UpdateWorldMatrices", updatedReadMs * 1000.0, "us");
+    TEST_CHECK(std::isfinite(sink));
+}
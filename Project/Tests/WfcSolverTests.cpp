@@ -0,0 +1,330 @@
+// WaveFunctionCollapse / WfcSolver / ChunkedWaveFunctionCollapse のテストと、置き換え前の実装とのベンチマーク
+//
+// 規則はタイル数と密度（ある方向・タイルの組を接続可能にする確率）から乱数で作る。
+// 接続は常に両側から登録するため、置き換え前後の実装で同じ規則になる。
+
+#include <atomic>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "TestFramework.h"
+#include "Legacy/LegacyWaveFunctionCollapse.h"
+#include "Utilities/ChunkedWaveFunctionCollapse.h"
+#include "Utilities/Plugin/Plugins.h"
+#include "Utilities/WaveFunctionCollapse.h"
+
+using KashipanEngine::ChunkedWaveFunctionCollapse;
+using KashipanEngine::WaveFunctionCollapse;
+using KashipanEngine::WfcChunkCoord;
+using KashipanEngine::WfcChunkGenerateOptions;
+using KashipanEngine::WfcRuleSet;
+using KashipanEngine::WfcSolver;
+
+namespace {
+
+/// @brief 片方向の接続1件（tile の direction 側に neighbor を置ける）
+struct Connection {
+    std::uint32_t tile;
+    std::uint32_t direction;
+    std::uint32_t neighbor;
+};
+
+std::string MakeTileName(std::uint32_t tile) {
+    return "tile" + std::to_string(tile);
+}
+
+/// @brief 乱数で接続規則を作る（上下・左右・前後の組ごとに、両側の接続をまとめて登録する）
+std::vector<Connection> MakeRandomRules(std::uint32_t tileCount, float density, std::uint32_t seed) {
+    std::mt19937 random(seed);
+    std::bernoulli_distribution allow(density);
+    std::vector<Connection> connections;
+    for (std::uint32_t direction = 0; direction < KashipanEngine::kWfcDirectionCount; direction += 2) {
+        for (std::uint32_t a = 0; a < tileCount; ++a) {
+            for (std::uint32_t b = 0; b < tileCount; ++b) {
+                if (!allow(random)) continue;
+                connections.push_back({ a, direction, b });
+                connections.push_back({ b, direction + 1, a });
+            }
+        }
+    }
+    return connections;
+}
+
+/// @brief タイルと接続を登録する（置き換え前後の実装で共通）
+template <typename Wfc>
+void SetUpTiles(Wfc &wfc, std::uint32_t tileCount, const std::vector<Connection> &connections, bool reverseOrder = false) {
+    for (std::uint32_t i = 0; i < tileCount; ++i) {
+        wfc.RegisterTile(MakeTileName(reverseOrder ? tileCount - 1 - i : i));
+    }
+    for (const auto &connection : connections) {
+        wfc.AddTileConnection(MakeTileName(connection.tile), static_cast<typename Wfc::Direction>(connection.direction),
+            MakeTileName(connection.neighbor));
+    }
+}
+
+/// @brief 確定したグリッドをタイル名の列として取り出す（未確定のセルは空文字）
+template <typename Wfc>
+std::vector<std::string> CollectResolvedTiles(const Wfc &wfc, std::uint32_t width, std::uint32_t height) {
+    std::vector<std::string> tiles;
+    tiles.reserve(static_cast<std::size_t>(width) * height);
+    for (std::uint32_t x = 0; x < width; ++x) {
+        for (std::uint32_t y = 0; y < height; ++y) {
+            tiles.push_back(wfc.GetResolvedTile(x, y, 0).value_or(""));
+        }
+    }
+    return tiles;
+}
+
+bool SolveNew(std::uint32_t tileCount, const std::vector<Connection> &rules, std::uint32_t size, std::uint32_t seed,
+    std::vector<std::string> *outTiles = nullptr, bool reverseOrder = false) {
+    WaveFunctionCollapse wfc;
+    SetUpTiles(wfc, tileCount, rules, reverseOrder);
+    wfc.SetGridSize(size, size, 1);
+    wfc.SetSeed(seed);
+    const bool solved = wfc.Solve();
+    if (outTiles) *outTiles = CollectResolvedTiles(wfc, size, size);
+    return solved;
+}
+
+bool SolveLegacy(std::uint32_t tileCount, const std::vector<Connection> &rules, std::uint32_t size, std::uint32_t seed) {
+    Tests::Legacy::WaveFunctionCollapse wfc;
+    SetUpTiles(wfc, tileCount, rules);
+    wfc.SetGridSize(size, size, 1);
+    wfc.SetSeed(seed);
+    return wfc.Solve();
+}
+
+/// @brief X・Z 方向に広いグリッドをチャンクに分ける設定（Y 方向は1段）
+constexpr std::uint32_t kChunkedGridSize = 24;
+constexpr std::uint32_t kChunkedChunkSize = 6;
+
+void SetUpChunked(ChunkedWaveFunctionCollapse &chunked, const std::vector<Connection> &rules, std::uint32_t tileCount) {
+    WaveFunctionCollapse wfc;
+    SetUpTiles(wfc, tileCount, rules);
+    wfc.SetGridSize(kChunkedGridSize, 1, kChunkedGridSize);
+    wfc.SetSeed(42);
+    chunked.Setup(wfc, true);
+    chunked.SetChunkSize(kChunkedChunkSize, 1, kChunkedChunkSize);
+}
+
+std::vector<WfcChunkCoord> MakeAllChunkCoords() {
+    std::vector<WfcChunkCoord> coords;
+    for (std::int32_t x = 0; x < static_cast<std::int32_t>(kChunkedGridSize / kChunkedChunkSize); ++x) {
+        for (std::int32_t z = 0; z < static_cast<std::int32_t>(kChunkedGridSize / kChunkedChunkSize); ++z) {
+            coords.push_back({ x, 0, z });
+        }
+    }
+    return coords;
+}
+
+std::vector<std::uint32_t> CollectChunkedTiles(const ChunkedWaveFunctionCollapse &chunked) {
+    std::vector<std::uint32_t> tiles;
+    for (std::int32_t x = 0; x < static_cast<std::int32_t>(kChunkedGridSize); ++x) {
+        for (std::int32_t z = 0; z < static_cast<std::int32_t>(kChunkedGridSize); ++z) {
+            tiles.push_back(chunked.GetTileIndex(x, 0, z));
+        }
+    }
+    return tiles;
+}
+
+} // namespace
+
+TEST_CASE(WfcSolver_SameSeedGivesSameGrid) {
+    const auto rules = MakeRandomRules(24, 0.5f, 1);
+    std::vector<std::string> first;
+    std::vector<std::string> second;
+    std::vector<std::string> reordered;
+    TEST_CHECK(SolveNew(24, rules, 24, 100, &first));
+    TEST_CHECK(SolveNew(24, rules, 24, 100, &second));
+    // タイルの登録順（unordered_map の並び）が変わっても、同じシードなら同じ結果になる
+    TEST_CHECK(SolveNew(24, rules, 24, 100, &reordered, true));
+    TEST_CHECK(first == second);
+    TEST_CHECK(first == reordered);
+
+    std::vector<std::string> otherSeed;
+    TEST_CHECK(SolveNew(24, rules, 24, 101, &otherSeed));
+    TEST_CHECK(first != otherSeed);
+}
+
+TEST_CASE(WfcSolver_DirectSolverIsDeterministic) {
+    // 疎な規則（バックトラック・やり直しが起こる）でも、同じ乱数状態からは同じ結果・同じ手数になる
+    constexpr std::uint32_t kTileCount = 24;
+    const auto connections = MakeRandomRules(kTileCount, 0.2f, 7);
+    WfcRuleSet rules(kTileCount);
+    for (const auto &connection : connections) rules.Allow(connection.tile, connection.direction, connection.neighbor);
+    rules.Build();
+
+    WfcSolver first(rules, 20, 20, 1);
+    WfcSolver second(rules, 20, 20, 1);
+    std::mt19937 firstRandom(5);
+    std::mt19937 secondRandom(5);
+    const bool firstSolved = first.Solve(firstRandom);
+    const bool secondSolved = second.Solve(secondRandom);
+    TEST_CHECK(firstSolved == secondSolved);
+    TEST_CHECK(first.GetResolvedTiles() == second.GetResolvedTiles());
+    TEST_CHECK(first.GetBacktrackCount() == second.GetBacktrackCount());
+    TEST_CHECK(first.GetRestartCount() == second.GetRestartCount());
+
+    // 同じソルバーで解き直しても同じ結果になる（制約は残り、状態は作り直される）
+    std::mt19937 againRandom(5);
+    TEST_CHECK(first.Solve(againRandom) == firstSolved);
+    TEST_CHECK(first.GetResolvedTiles() == second.GetResolvedTiles());
+}
+
+TEST_CASE(WfcSolver_ResultSatisfiesRules) {
+    constexpr std::uint32_t kTileCount = 16;
+    constexpr std::uint32_t kSize = 16;
+    const auto connections = MakeRandomRules(kTileCount, 0.3f, 3);
+    WfcRuleSet rules(kTileCount);
+    for (const auto &connection : connections) rules.Allow(connection.tile, connection.direction, connection.neighbor);
+    rules.Build();
+
+    WfcSolver solver(rules, kSize, kSize, 1);
+    solver.FixTile(0, 0, 0, 2);
+    solver.FixTile(kSize - 1, kSize - 1, 0, 5);
+    std::mt19937 random(11);
+    TEST_CHECK(solver.Solve(random));
+    TEST_CHECK(solver.GetTile(0, 0, 0) == 2);
+    TEST_CHECK(solver.GetTile(kSize - 1, kSize - 1, 0) == 5);
+
+    // 右隣・上隣との組が、規則で許可されているか
+    size_t violationCount = 0;
+    for (std::uint32_t x = 0; x < kSize; ++x) {
+        for (std::uint32_t y = 0; y < kSize; ++y) {
+            const std::uint32_t tile = solver.GetTile(x, y, 0);
+            if (tile == WfcSolver::kUnresolvedTile) {
+                ++violationCount;
+                continue;
+            }
+            const auto isAllowed = [&](std::size_t direction, std::uint32_t neighbor) {
+                const auto mask = rules.GetCompatibleMask(direction, tile);
+                return (mask[neighbor / 64] >> (neighbor % 64)) & 1u;
+            };
+            if (x + 1 < kSize && !isAllowed(static_cast<std::size_t>(WaveFunctionCollapse::Direction::Right), solver.GetTile(x + 1, y, 0))) ++violationCount;
+            if (y + 1 < kSize && !isAllowed(static_cast<std::size_t>(WaveFunctionCollapse::Direction::Up), solver.GetTile(x, y + 1, 0))) ++violationCount;
+        }
+    }
+    TEST_CHECK_MESSAGE(violationCount == 0, std::to_string(violationCount) + " cells violate the rules");
+}
+
+TEST_CASE(WfcSolver_ProgressCanAbort) {
+    constexpr std::uint32_t kTileCount = 24;
+    constexpr std::uint32_t kSize = 32;
+    const auto rules = MakeRandomRules(kTileCount, 0.5f, 1);
+    std::vector<std::string> expected;
+    TEST_CHECK(SolveNew(kTileCount, rules, kSize, 100, &expected));
+
+    // 進捗を受け取るだけなら結果は変わらない
+    WaveFunctionCollapse wfc;
+    SetUpTiles(wfc, kTileCount, rules);
+    wfc.SetGridSize(kSize, kSize, 1);
+    wfc.SetSeed(100);
+    std::uint32_t callCount = 0;
+    bool isInRange = true;
+    TEST_CHECK(wfc.Solve([&](float resolvedRatio) {
+        ++callCount;
+        if (resolvedRatio < 0.0f || resolvedRatio > 1.0f) isInRange = false;
+        return true;
+    }));
+    TEST_CHECK(callCount > 0);
+    TEST_CHECK(isInRange);
+    TEST_CHECK(CollectResolvedTiles(wfc, kSize, kSize) == expected);
+
+    // false を返すと中断し、確定結果は残らない
+    wfc.SetSeed(100);
+    callCount = 0;
+    TEST_CHECK(!wfc.Solve([&](float) { return ++callCount < 2; }));
+    TEST_CHECK(callCount == 2);
+    TEST_CHECK(!wfc.GetResolvedTile(0, 0, 0).has_value());
+}
+
+BENCHMARK_CASE(WfcSolver_VersusLegacy) {
+    struct Config {
+        std::uint32_t tileCount;
+        std::uint32_t size;
+    };
+    const Config configs[] = { { 24, 32 }, { 64, 48 } };
+    for (const auto &config : configs) {
+        const auto rules = MakeRandomRules(config.tileCount, 0.5f, config.tileCount);
+        bool legacySolved = false;
+        bool newSolved = false;
+        const double legacyMs = Tests::MeasureBestMilliseconds(3, [&]() {
+            legacySolved = SolveLegacy(config.tileCount, rules, config.size, 1);
+        });
+        const double newMs = Tests::MeasureBestMilliseconds(3, [&]() {
+            newSolved = SolveNew(config.tileCount, rules, config.size, 1);
+        });
+        const std::string label = std::to_string(config.tileCount) + " tiles " + std::to_string(config.size) + "x" + std::to_string(config.size);
+        Tests::ReportBenchmark(label + " legacy" + (legacySolved ? "" : " (failed)"), legacyMs, "ms");
+        Tests::ReportBenchmark(label + " new" + (newSolved ? "" : " (failed)"), newMs, "ms");
+        Tests::ReportBenchmark(label + " speedup", legacyMs / newMs, "x");
+        TEST_CHECK(newSolved);
+    }
+
+    // 疎な規則での成功率（置き換え前はバックトラックしないため、途中の矛盾で失敗する）
+    constexpr std::uint32_t kTrialCount = 10;
+    for (const float density : { 0.15f, 0.2f }) {
+        std::uint32_t legacySuccess = 0;
+        std::uint32_t newSuccess = 0;
+        for (std::uint32_t trial = 0; trial < kTrialCount; ++trial) {
+            const auto rules = MakeRandomRules(24, density, 1000 + trial);
+            legacySuccess += SolveLegacy(24, rules, 24, trial) ? 1 : 0;
+            newSuccess += SolveNew(24, rules, 24, trial) ? 1 : 0;
+        }
+        const std::string label = "density " + std::to_string(density).substr(0, 4) + " success";
+        Tests::ReportBenchmark(label + " legacy", 100.0 * legacySuccess / kTrialCount, "%");
+        Tests::ReportBenchmark(label + " new", 100.0 * newSuccess / kTrialCount, "%");
+    }
+}
+
+TEST_CASE(ChunkedWfc_ParallelPhasesMatchChunkByChunk) {
+    constexpr std::uint32_t kTileCount = 24;
+    const auto rules = MakeRandomRules(kTileCount, 0.5f, 1);
+    const auto coords = MakeAllChunkCoords();
+
+    // ジョブシステム無しで1チャンクずつ解いた結果を基準にする
+    ChunkedWaveFunctionCollapse sequential;
+    SetUpChunked(sequential, rules, kTileCount);
+    for (const auto &coord : coords) TEST_CHECK(sequential.GenerateChunk(coord));
+    const auto expected = CollectChunkedTiles(sequential);
+
+    Plugin::JobSystem jobSystem(4);
+    const Tests::ScopedJobSystem scopedJobSystem(&jobSystem);
+    ChunkedWaveFunctionCollapse parallel;
+    SetUpChunked(parallel, rules, kTileCount);
+    std::atomic<std::size_t> finishedCount{ 0 };
+    WfcChunkGenerateOptions options;
+    options.priority = 1;
+    options.onChunkFinished = [&finishedCount](bool) { finishedCount.fetch_add(1, std::memory_order_relaxed); };
+    TEST_CHECK(parallel.GenerateChunks(coords, options));
+    TEST_CHECK(finishedCount.load() == coords.size());
+    TEST_CHECK(CollectChunkedTiles(parallel) == expected);
+}
+
+TEST_CASE(ChunkedWfc_CancelLeavesRemainingChunksUngenerated) {
+    constexpr std::uint32_t kTileCount = 24;
+    const auto rules = MakeRandomRules(kTileCount, 0.5f, 1);
+    const auto coords = MakeAllChunkCoords();
+
+    ChunkedWaveFunctionCollapse reference;
+    SetUpChunked(reference, rules, kTileCount);
+    TEST_CHECK(reference.GenerateChunks(coords));
+    const auto expected = CollectChunkedTiles(reference);
+
+    Plugin::JobSystem jobSystem(4);
+    const Tests::ScopedJobSystem scopedJobSystem(&jobSystem);
+    ChunkedWaveFunctionCollapse chunked;
+    SetUpChunked(chunked, rules, kTileCount);
+    // 最初の段の途中（各チャンクの前の確認が5回目）でキャンセルする
+    std::atomic<int> checkCount{ 0 };
+    WfcChunkGenerateOptions options;
+    options.shouldContinue = [&checkCount]() { return checkCount.fetch_add(1) < 4; };
+    TEST_CHECK(!chunked.GenerateChunks(coords, options));
+    TEST_CHECK(chunked.GetGeneratedChunkCount() == 4);
+
+    // 解かなかったチャンクは未生成のまま残り、生成し直すとキャンセルしなかった場合と同じ結果になる
+    TEST_CHECK(chunked.GenerateChunks(coords));
+    TEST_CHECK(chunked.GetGeneratedChunkCount() == coords.size());
+    TEST_CHECK(CollectChunkedTiles(chunked) == expected);
+}